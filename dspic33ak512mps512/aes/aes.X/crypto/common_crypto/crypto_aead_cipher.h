@@ -106,4 +106,23 @@ crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E h
                                                             uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
                                                             uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID);
 
+/* Bytes of workspace the *DirectEx() functions need for a handler, 0 when the
+ * handler does not support them. */
+uint32_t Crypto_Aead_AesGcm_WorkspaceSize(crypto_HandlerType_E handlerType_en);
+
+/* As the *Direct() functions, with the cipher context in a caller workspace
+ * aligned to CRYPTO_WORKSPACE_ALIGN instead of on the stack. The workspace may
+ * be shared by calls that do not overlap. Return CRYPTO_AEAD_ERROR_CTX for a
+ * workspace that is NULL, misaligned or smaller than
+ * Crypto_Aead_AesGcm_WorkspaceSize(). */
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthDirectEx(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace, uint32_t workspaceLen);
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirectEx(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace, uint32_t workspaceLen);
+
 #endif //CRYPTO_AEAD_CIPHER_H
@@ -104,6 +104,23 @@ crypto_Sym_Status_E Crypto_Sym_Aes_EncryptDirect(crypto_HandlerType_E handlerTyp
 crypto_Sym_Status_E Crypto_Sym_Aes_DecryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData, 
                                                         uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID);                                                
 
+/* Bytes of workspace the *DirectEx() functions need for a handler, 0 when the
+ * handler does not support them. */
+uint32_t Crypto_Sym_Aes_WorkspaceSize(crypto_HandlerType_E handlerType_en);
+
+/* As the *Direct() functions, with the cipher context in a caller workspace
+ * aligned to CRYPTO_WORKSPACE_ALIGN instead of on the stack. The workspace may
+ * be shared by calls that do not overlap. Return CRYPTO_SYM_ERROR_CTX for a
+ * workspace that is NULL, misaligned or smaller than
+ * Crypto_Sym_Aes_WorkspaceSize(). */
+crypto_Sym_Status_E Crypto_Sym_Aes_EncryptDirectEx(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData, 
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace, uint32_t workspaceLen);
+
+crypto_Sym_Status_E Crypto_Sym_Aes_DecryptDirectEx(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData, 
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace, uint32_t workspaceLen);
+
 crypto_Sym_Status_E Crypto_Sym_Aes_Cipher(st_Crypto_Sym_BlockCtx *ptr_aesCtx_st, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData);
 
 crypto_Sym_Status_E Crypto_Sym_AesXts_Cipher(st_Crypto_Sym_BlockCtx *ptr_aesCtx_st, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_tweak);
@@ -53,6 +53,14 @@
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_aead_cipher.h"
 #include "crypto/drivers/wrapper/crypto_aead_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+#include "crypto/drivers/sw/crypto_aead_sw_wrapper.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#endif
+
+#if (CRYPTO_CONFIG_AEAD_AESGCM == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -62,6 +70,189 @@
 
 #define CRYPTO_AEAD_SESSION_MAX (1)
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+/**
+ * @brief Resolve CRYPTO_HANDLER_AUTO to the handler that runs an operation.
+ * @param handlerType_en The handler asked for; other handlers are returned as they are.
+ * @param dataLen Length of the data and AAD, or UINT32_MAX when it is not known yet.
+ * @return CRYPTO_HANDLER_SW_INTERNAL when the data is below
+ *         CRYPTO_CONFIG_AUTO_GCM_CROSSOVER or the engine is busy,
+ *         CRYPTO_HANDLER_HW_INTERNAL otherwise.
+ */
+static crypto_HandlerType_E lCrypto_Aead_AesGcm_AutoHandler(crypto_HandlerType_E handlerType_en, uint32_t dataLen)
+{
+    crypto_HandlerType_E handler = handlerType_en;
+
+    if (handlerType_en == CRYPTO_HANDLER_AUTO)
+    {
+        handler = CRYPTO_HANDLER_HW_INTERNAL;
+
+        if (CRYPTO_AUTO_GCM_BELOW_CROSSOVER(dataLen) || Crypto_Osal_EngineBusy(CRYPTO_OSAL_ENGINE_SYM))
+        {
+            handler = CRYPTO_HANDLER_SW_INTERNAL;
+        }
+    }
+
+    return handler;
+}
+
+#define CRYPTO_AEAD_GCM_HANDLER(handler, len)  lCrypto_Aead_AesGcm_AutoHandler((handler), (len))
+#else
+#define CRYPTO_AEAD_GCM_HANDLER(handler, len)  (handler)
+#endif
+
+static crypto_Aead_Status_E lCrypto_Aead_AesGcm_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+
+    if (CRYPTO_API_CHECK((ptr_inputData == NULL) == (dataLen > 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if (CRYPTO_API_CHECK((ptr_inputData == NULL) != (ptr_outData == NULL)))
+    {
+        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_key == NULL) ||
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) ))
+    {
+        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK((ptr_initVect == NULL) || (initVectLen == 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if (CRYPTO_API_CHECK((ptr_aad == NULL) == (aadLen > 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if(CRYPTO_API_CHECK((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) ))
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(AEAD_AESGCM))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_AEAD_GCM_HANDLER(handlerType_en, dataLen + aadLen)))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+                    ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                            ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
+                }
+                else
+                {
+                    ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_EncryptAuthDirectEx(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                            ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_EncryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                        ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, ptr_workspace);
+                break;
+#endif
+            default:
+                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+
+    return ret_aesGcmStat_en;
+}
+
+static crypto_Aead_Status_E lCrypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+
+    if (CRYPTO_API_CHECK((ptr_inputData == NULL) == (dataLen > 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if (CRYPTO_API_CHECK((ptr_inputData == NULL) != (ptr_outData == NULL)))
+    {
+        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_key == NULL) ||
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) ))
+    {
+        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK((ptr_initVect == NULL) || (initVectLen == 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if (CRYPTO_API_CHECK((ptr_aad == NULL) == (aadLen > 0u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if(CRYPTO_API_CHECK((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u)))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) ))
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(AEAD_AESGCM))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_AEAD_GCM_HANDLER(handlerType_en, dataLen + aadLen)))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+                    ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
+                }
+                else
+                {
+                    ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_DecryptAuthDirectEx(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_DecryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
+                                                                        ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, ptr_workspace);
+                break;
+#endif
+            default:
+                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+
+    return ret_aesGcmStat_en;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Function Definitions
@@ -75,246 +266,265 @@ crypto_Aead_Status_E Crypto_Aead_AesGcm_Init(st_Crypto_Aead_AesGcm_ctx *ptr_aesG
 {
     crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
 
-    if(ptr_aesGcmCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_INIT, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_aesGcmCtx_st == NULL))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
-    else if( (ptr_key == NULL) ||
+    else if(CRYPTO_API_CHECK( (ptr_key == NULL) ||
                     ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
                         && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
-                        && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+                        && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) ))
     {
        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
     }
-    else if((ptr_initVect == NULL) || (initVectLen == 0u))
+    else if(CRYPTO_API_CHECK((ptr_initVect == NULL) || (initVectLen == 0u)))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
     }
-    else if((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    else if(CRYPTO_API_CHECK((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT)))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPOPER;
     }
-    else if( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    else if(CRYPTO_API_CHECK( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) ))
     {
        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID;
     }
+    else if(!CRYPTO_SELFTEST_REQUIRE(AEAD_AESGCM))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
     else
     {
         ptr_aesGcmCtx_st->cryptoSessionID =  sessionID;
-        ptr_aesGcmCtx_st->aeadHandlerType_en = handlerType_en;
+        // CRYPTO_HANDLER_AUTO is settled here for the whole stream; its length is not known yet.
+        ptr_aesGcmCtx_st->aeadHandlerType_en = CRYPTO_AEAD_GCM_HANDLER(handlerType_en, UINT32_MAX);
         ptr_aesGcmCtx_st->ptr_key = ptr_key;
         ptr_aesGcmCtx_st->aeadKeySize = keyLen;
         ptr_aesGcmCtx_st->aeadCipherOper_en = cipherOper_en;
         ptr_aesGcmCtx_st->ptr_initVect = ptr_initVect;
         ptr_aesGcmCtx_st->initVectLen = initVectLen;
 
-        switch(ptr_aesGcmCtx_st->aeadHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesGcmCtx_st->aeadHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_Init((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
                     cipherOper_en, ptr_aesGcmCtx_st->ptr_key, ptr_aesGcmCtx_st->aeadKeySize, ptr_initVect, initVectLen);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_Init((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
+                    cipherOper_en, ptr_aesGcmCtx_st->ptr_key, ptr_aesGcmCtx_st->aeadKeySize, ptr_initVect, initVectLen);
+                break;
+#endif
             default:
                 ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
                 break;
         }
 
     }
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_INIT, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 
 crypto_Aead_Status_E Crypto_Aead_AesGcm_AddAadData(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_aad, uint32_t aadLen)
 {
     crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
-    if(ptr_aesGcmCtx_st == NULL)
+
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_ADDAADDATA, aadLen);
+
+    if(CRYPTO_API_CHECK(ptr_aesGcmCtx_st == NULL))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
-    else if( ((ptr_aad == NULL) && (aadLen > 0u)) || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    else if(CRYPTO_API_CHECK( ((ptr_aad == NULL) && (aadLen > 0u)) || ((ptr_aad != NULL) && (aadLen == 0u)) ))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
     }
     else
     {
-        switch(ptr_aesGcmCtx_st->aeadHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesGcmCtx_st->aeadHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_AddAadData((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx, ptr_aad, aadLen);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_AddAadData((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx, ptr_aad, aadLen);
+                break;
+#endif
             default:
                 ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
                 break;
         }
     }
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_ADDAADDATA, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 
 crypto_Aead_Status_E Crypto_Aead_AesGcm_Cipher(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_inputData, uint32_t dataLen,
                                                     uint8_t *ptr_outData)
 {
     crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
-    if(ptr_aesGcmCtx_st == NULL)
+
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_CIPHER, dataLen);
+
+    if(CRYPTO_API_CHECK(ptr_aesGcmCtx_st == NULL))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
-    if( ((ptr_inputData == NULL) && (dataLen > 0u))
-                || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    if(CRYPTO_API_CHECK( ((ptr_inputData == NULL) && (dataLen > 0u))
+                || ((ptr_inputData != NULL) && (dataLen == 0u)) ))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
     }
-    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
-                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    else if(CRYPTO_API_CHECK( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) ))
     {
         ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA;
     }
     else
     {
-        switch(ptr_aesGcmCtx_st->aeadHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesGcmCtx_st->aeadHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_Cipher((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
                     ptr_inputData, dataLen, ptr_outData);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_Cipher((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
+                    ptr_inputData, dataLen, ptr_outData);
+                break;
+#endif
             default:
                 ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
                 break;
         }
     }
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_CIPHER, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 
 crypto_Aead_Status_E Crypto_Aead_AesGcm_Final(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_authTag, uint8_t authTagLen)
 {
     crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
-    if(ptr_aesGcmCtx_st == NULL)
+
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_FINAL, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_aesGcmCtx_st == NULL))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
-    else if((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u))
+    else if(CRYPTO_API_CHECK((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u)))
     {
         ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
     }
     else
     {
-        switch(ptr_aesGcmCtx_st->aeadHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesGcmCtx_st->aeadHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_Final((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
                     ptr_authTag, authTagLen);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Sw_AesGcm_Final((void*)ptr_aesGcmCtx_st->arr_aeadDataCtx,
+                    ptr_authTag, authTagLen);
+                break;
+#endif
             default:
                 ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
                 break;
         }
     }
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_FINAL, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 
-crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
-                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
-                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID)
+uint32_t Crypto_Aead_AesGcm_WorkspaceSize(crypto_HandlerType_E handlerType_en)
 {
-    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    uint32_t size = 0UL;
 
-    if ((ptr_inputData == NULL) == (dataLen > 0u))
+    if (handlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
     {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+        size = (uint32_t)sizeof(CRYPTO_AEAD_HW_CONTEXT);
     }
-    else if ((ptr_inputData == NULL) != (ptr_outData == NULL))
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    else if (handlerType_en == CRYPTO_HANDLER_SW_INTERNAL)
     {
-        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA;
+        size = (uint32_t)sizeof(CRYPTO_AEAD_SW_CONTEXT);
     }
-    else if( (ptr_key == NULL) ||
-                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
-                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
-                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+    else if (handlerType_en == CRYPTO_HANDLER_AUTO)
     {
-        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
+        // Either handler may run the operation.
+        size = (uint32_t)((sizeof(CRYPTO_AEAD_HW_CONTEXT) > sizeof(CRYPTO_AEAD_SW_CONTEXT)) ?
+            sizeof(CRYPTO_AEAD_HW_CONTEXT) : sizeof(CRYPTO_AEAD_SW_CONTEXT));
     }
-    else if((ptr_initVect == NULL) || (initVectLen == 0u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
-    }
-    else if ((ptr_aad == NULL) == (aadLen > 0u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
-    }
-    else if((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
-    }
-    else if( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+#endif
+
+    return size;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID)
+{
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_ENCRYPTAUTHDIRECT, dataLen);
+
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_ENCRYPTAUTHDIRECT, crypto_Aead_Status_E,
+        lCrypto_Aead_AesGcm_EncryptAuthDirect(handlerType_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID, NULL));
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthDirectEx(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en;
+
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_ENCRYPTAUTHDIRECTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Aead_AesGcm_WorkspaceSize(handlerType_en))))
     {
-       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID;
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
     else
     {
-        switch(handlerType_en)
-        {
-            case CRYPTO_HANDLER_HW_INTERNAL:
-                ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
-                                                                        ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
-                break;
-            default:
-                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
-                break;
-        }
+        ret_aesGcmStat_en = lCrypto_Aead_AesGcm_EncryptAuthDirect(handlerType_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID, ptr_workspace);
     }
 
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_ENCRYPTAUTHDIRECTEX, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 
 crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
                                                             uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
                                                             uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID)
 {
-    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_DECRYPTAUTHDIRECT, dataLen);
 
-    if ((ptr_inputData == NULL) == (dataLen > 0u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
-    }
-    else if ((ptr_inputData == NULL) != (ptr_outData == NULL))
-    {
-        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA;
-    }
-    else if( (ptr_key == NULL) ||
-                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
-                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
-                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
-    {
-        ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
-    }
-    else if((ptr_initVect == NULL) || (initVectLen == 0u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
-    }
-    else if ((ptr_aad == NULL) == (aadLen > 0u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
-    }
-    else if((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u))
-    {
-        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
-    }
-    else if( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_DECRYPTAUTHDIRECT, crypto_Aead_Status_E,
+        lCrypto_Aead_AesGcm_DecryptAuthDirect(handlerType_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID, NULL));
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirectEx(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID,
+                                                            void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en;
+
+    CRYPTO_TRACE_ENTER(AEAD_AESGCM_DECRYPTAUTHDIRECTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Aead_AesGcm_WorkspaceSize(handlerType_en))))
     {
-       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID;
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CTX;
     }
     else
     {
-        switch(handlerType_en)
-        {
-            case CRYPTO_HANDLER_HW_INTERNAL:
-                ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen,
-                                                            ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
-                break;
-            default:
-                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
-                break;
-        }
+        ret_aesGcmStat_en = lCrypto_Aead_AesGcm_DecryptAuthDirect(handlerType_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID, ptr_workspace);
     }
 
-    return ret_aesGcmStat_en;
+    return CRYPTO_TRACE_EXIT(AEAD_AESGCM_DECRYPTAUTHDIRECTEX, crypto_Aead_Status_E, ret_aesGcmStat_en);
 }
 // *****************************************************************************
+
+#endif /* CRYPTO_CONFIG_AEAD_AESGCM == 1 */
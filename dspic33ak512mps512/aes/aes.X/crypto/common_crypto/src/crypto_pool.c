@@ -0,0 +1,422 @@
+/*******************************************************************************
+  Crypto Context Pool Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_pool.c
+
+  Summary:
+    This source file implements the fixed-block pools of the context types.
+
+  Description:
+    The blocks of all pools share one state array and one free-block stack
+    array, each pool using the slots from its first slot on. A pool hands out
+    the blocks on its free stack first and then the blocks it never handed
+    out, tracked by a watermark, so the pools start out valid from zeroed
+    memory. The pool counters and block states are only changed with
+    interrupts disabled (Crypto_Int_Hw_Lock()); wiping a released block is
+    done with interrupts enabled while the block belongs to no pool.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_pool.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#if (CRYPTO_POOL_SYM_BLOCK_COUNT > 0U)
+#include "crypto/common_crypto/crypto_sym_cipher.h"
+#endif
+#if (CRYPTO_POOL_AEAD_AESGCM_COUNT > 0U)
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#endif
+#if (CRYPTO_POOL_MAC_AESCMAC_COUNT > 0U)
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#endif
+#if (CRYPTO_POOL_HASH_SHA_COUNT > 0U)
+#include "crypto/common_crypto/crypto_hash.h"
+#endif
+#if (CRYPTO_POOL_AES_HW_COUNT > 0U)
+#include "crypto/drivers/wrapper/crypto_sym_cam05346_wrapper.h"
+#endif
+#if (CRYPTO_POOL_AEAD_HW_COUNT > 0U)
+#include "crypto/drivers/wrapper/crypto_aead_cam05346_wrapper.h"
+#endif
+#if (CRYPTO_POOL_CMAC_HW_COUNT > 0U)
+#include "crypto/drivers/wrapper/crypto_mac_cam05346_wrapper.h"
+#endif
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+#include "crypto/drivers/wrapper/crypto_hash_cam05346_wrapper.h"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// Block size of a type in 32-bit words, which keeps every block aligned.
+#define CRYPTO_POOL_WORDS(type) ((sizeof(type) + sizeof(uint32_t) - 1U) / sizeof(uint32_t))
+
+// First slot of each pool in the shared state and free-stack arrays.
+#define CRYPTO_POOL_FIRST_SYM_BLOCK         (0U)
+#define CRYPTO_POOL_FIRST_AEAD_AESGCM       (CRYPTO_POOL_FIRST_SYM_BLOCK + CRYPTO_POOL_SYM_BLOCK_COUNT)
+#define CRYPTO_POOL_FIRST_MAC_AESCMAC       (CRYPTO_POOL_FIRST_AEAD_AESGCM + CRYPTO_POOL_AEAD_AESGCM_COUNT)
+#define CRYPTO_POOL_FIRST_HASH_SHA          (CRYPTO_POOL_FIRST_MAC_AESCMAC + CRYPTO_POOL_MAC_AESCMAC_COUNT)
+#define CRYPTO_POOL_FIRST_AES_HW            (CRYPTO_POOL_FIRST_HASH_SHA + CRYPTO_POOL_HASH_SHA_COUNT)
+#define CRYPTO_POOL_FIRST_AEAD_HW           (CRYPTO_POOL_FIRST_AES_HW + CRYPTO_POOL_AES_HW_COUNT)
+#define CRYPTO_POOL_FIRST_CMAC_HW           (CRYPTO_POOL_FIRST_AEAD_HW + CRYPTO_POOL_AEAD_HW_COUNT)
+#define CRYPTO_POOL_FIRST_HASH_HW_DIGEST    (CRYPTO_POOL_FIRST_CMAC_HW + CRYPTO_POOL_CMAC_HW_COUNT)
+#define CRYPTO_POOL_TOTAL_COUNT             (CRYPTO_POOL_FIRST_HASH_HW_DIGEST + CRYPTO_POOL_HASH_HW_DIGEST_COUNT)
+
+// Block states. Zero is the state of the blocks never handed out.
+#define CRYPTO_POOL_BLOCK_FREE              (0U)    // Free and zeroed
+#define CRYPTO_POOL_BLOCK_USED              (1U)    // Acquired
+#define CRYPTO_POOL_BLOCK_WIPING            (2U)    // Released, being wiped outside any pool
+#define CRYPTO_POOL_BLOCK_DIRTY             (3U)    // Free, wiped at its next acquisition
+
+typedef struct{
+    uint32_t *ptr_storage;      // First word of the first block, NULL without blocks
+    uint16_t blockWords;        // Words per block
+    uint16_t blockCount;        // Blocks in the pool
+    uint16_t firstSlot;         // First slot in the shared arrays
+}st_Crypto_Pool_Desc;
+
+typedef struct{
+    uint16_t freeTop;           // Blocks on the free stack
+    uint16_t fresh;             // Blocks handed out at least once; the others are zeroed
+    uint16_t inUse;
+    uint16_t highWater;
+    uint16_t dirty;
+    uint32_t acquisitions;
+    uint32_t failures;
+}st_Crypto_Pool_Data;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_POOL_SYM_BLOCK_COUNT > 0U)
+static uint32_t poolSymBlock[CRYPTO_POOL_SYM_BLOCK_COUNT][CRYPTO_POOL_WORDS(st_Crypto_Sym_BlockCtx)];
+#define CRYPTO_POOL_DESC_SYM_BLOCK          &poolSymBlock[0][0], CRYPTO_POOL_WORDS(st_Crypto_Sym_BlockCtx)
+#else
+#define CRYPTO_POOL_DESC_SYM_BLOCK          NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_AEAD_AESGCM_COUNT > 0U)
+static uint32_t poolAeadAesGcm[CRYPTO_POOL_AEAD_AESGCM_COUNT][CRYPTO_POOL_WORDS(st_Crypto_Aead_AesGcm_ctx)];
+#define CRYPTO_POOL_DESC_AEAD_AESGCM        &poolAeadAesGcm[0][0], CRYPTO_POOL_WORDS(st_Crypto_Aead_AesGcm_ctx)
+#else
+#define CRYPTO_POOL_DESC_AEAD_AESGCM        NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_MAC_AESCMAC_COUNT > 0U)
+static uint32_t poolMacAesCmac[CRYPTO_POOL_MAC_AESCMAC_COUNT][CRYPTO_POOL_WORDS(st_Crypto_Mac_Aes_ctx)];
+#define CRYPTO_POOL_DESC_MAC_AESCMAC        &poolMacAesCmac[0][0], CRYPTO_POOL_WORDS(st_Crypto_Mac_Aes_ctx)
+#else
+#define CRYPTO_POOL_DESC_MAC_AESCMAC        NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_HASH_SHA_COUNT > 0U)
+static uint32_t poolHashSha[CRYPTO_POOL_HASH_SHA_COUNT][CRYPTO_POOL_WORDS(st_Crypto_Hash_Sha_Ctx)];
+#define CRYPTO_POOL_DESC_HASH_SHA           &poolHashSha[0][0], CRYPTO_POOL_WORDS(st_Crypto_Hash_Sha_Ctx)
+#else
+#define CRYPTO_POOL_DESC_HASH_SHA           NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_AES_HW_COUNT > 0U)
+static uint32_t poolAesHw[CRYPTO_POOL_AES_HW_COUNT][CRYPTO_POOL_WORDS(CRYPTO_AES_HW_CONTEXT)];
+#define CRYPTO_POOL_DESC_AES_HW             &poolAesHw[0][0], CRYPTO_POOL_WORDS(CRYPTO_AES_HW_CONTEXT)
+#else
+#define CRYPTO_POOL_DESC_AES_HW             NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_AEAD_HW_COUNT > 0U)
+static uint32_t poolAeadHw[CRYPTO_POOL_AEAD_HW_COUNT][CRYPTO_POOL_WORDS(CRYPTO_AEAD_HW_CONTEXT)];
+#define CRYPTO_POOL_DESC_AEAD_HW            &poolAeadHw[0][0], CRYPTO_POOL_WORDS(CRYPTO_AEAD_HW_CONTEXT)
+#else
+#define CRYPTO_POOL_DESC_AEAD_HW            NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_CMAC_HW_COUNT > 0U)
+static uint32_t poolCmacHw[CRYPTO_POOL_CMAC_HW_COUNT][CRYPTO_POOL_WORDS(CRYPTO_CMAC_HW_CONTEXT)];
+#define CRYPTO_POOL_DESC_CMAC_HW            &poolCmacHw[0][0], CRYPTO_POOL_WORDS(CRYPTO_CMAC_HW_CONTEXT)
+#else
+#define CRYPTO_POOL_DESC_CMAC_HW            NULL, 0U
+#endif
+
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+static uint32_t poolHashHwDigest[CRYPTO_POOL_HASH_HW_DIGEST_COUNT][CRYPTO_POOL_WORDS(CRYPTO_HASH_HW_DIGEST_CONTEXT)];
+#define CRYPTO_POOL_DESC_HASH_HW_DIGEST     &poolHashHwDigest[0][0], CRYPTO_POOL_WORDS(CRYPTO_HASH_HW_DIGEST_CONTEXT)
+#else
+#define CRYPTO_POOL_DESC_HASH_HW_DIGEST     NULL, 0U
+#endif
+
+// Storage, block words, block count and first slot of each type.
+#define CRYPTO_POOL_DESC(type) \
+    { CRYPTO_POOL_DESC_##type, CRYPTO_POOL_##type##_COUNT, CRYPTO_POOL_FIRST_##type }
+
+static const st_Crypto_Pool_Desc poolDesc[CRYPTO_POOL_TYPE_MAX] =
+{
+    CRYPTO_POOL_DESC(SYM_BLOCK),
+    CRYPTO_POOL_DESC(AEAD_AESGCM),
+    CRYPTO_POOL_DESC(MAC_AESCMAC),
+    CRYPTO_POOL_DESC(HASH_SHA),
+    CRYPTO_POOL_DESC(AES_HW),
+    CRYPTO_POOL_DESC(AEAD_HW),
+    CRYPTO_POOL_DESC(CMAC_HW),
+    CRYPTO_POOL_DESC(HASH_HW_DIGEST),
+};
+
+static st_Crypto_Pool_Data poolData[CRYPTO_POOL_TYPE_MAX];
+
+// One more slot than the blocks, so the arrays exist without any blocks.
+static uint8_t poolState[CRYPTO_POOL_TOTAL_COUNT + 1U];
+static uint16_t poolFreeStack[CRYPTO_POOL_TOTAL_COUNT + 1U];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t *lCrypto_Pool_Block(crypto_Pool_Type_E type, uint32_t index)
+{
+    return &poolDesc[type].ptr_storage[index * poolDesc[type].blockWords];
+}
+
+static void lCrypto_Pool_Wipe(crypto_Pool_Type_E type, uint32_t index)
+{
+    (void)memset(lCrypto_Pool_Block(type, index), 0, (size_t)poolDesc[type].blockWords * sizeof(uint32_t));
+}
+
+// Index of the block at ptr_block, or the block count if it is not a block of the pool.
+static uint32_t lCrypto_Pool_Index(crypto_Pool_Type_E type, const void *ptr_block)
+{
+    uint32_t count = poolDesc[type].blockCount;
+    uint32_t index = count;
+
+    if ((count > 0U) && (ptr_block != NULL))
+    {
+        uintptr_t blockBytes = (uintptr_t)poolDesc[type].blockWords * sizeof(uint32_t);
+        uintptr_t first = (uintptr_t)poolDesc[type].ptr_storage;
+        uintptr_t address = (uintptr_t)ptr_block;
+
+        if ((address >= first) && (address < (first + (blockBytes * count)))
+            && (((address - first) % blockBytes) == 0U))
+        {
+            index = (uint32_t)((address - first) / blockBytes);
+        }
+    }
+
+    return index;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void *Crypto_Pool_Acquire(crypto_Pool_Type_E type)
+{
+    void *ptr_block = NULL;
+
+    if ((type >= CRYPTO_POOL_SYM_BLOCK) && (type < CRYPTO_POOL_TYPE_MAX))
+    {
+        st_Crypto_Pool_Data *ptr_pool = &poolData[type];
+        uint32_t count = poolDesc[type].blockCount;
+        uint32_t first = poolDesc[type].firstSlot;
+        uint32_t index = count;
+        uint8_t state = CRYPTO_POOL_BLOCK_FREE;
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        if (ptr_pool->freeTop > 0U)
+        {
+            ptr_pool->freeTop--;
+            index = poolFreeStack[first + ptr_pool->freeTop];
+        }
+        else if (ptr_pool->fresh < count)
+        {
+            index = ptr_pool->fresh;
+            ptr_pool->fresh++;
+        }
+        else
+        {
+            ptr_pool->failures++;
+        }
+
+        if (index < count)
+        {
+            state = poolState[first + index];
+            poolState[first + index] = CRYPTO_POOL_BLOCK_USED;
+            if (state == CRYPTO_POOL_BLOCK_DIRTY)
+            {
+                ptr_pool->dirty--;
+            }
+            ptr_pool->inUse++;
+            if (ptr_pool->inUse > ptr_pool->highWater)
+            {
+                ptr_pool->highWater = ptr_pool->inUse;
+            }
+            ptr_pool->acquisitions++;
+        }
+
+        Crypto_Int_Hw_Unlock(lockState);
+
+        if (index < count)
+        {
+            // The block now belongs to the caller, so it is wiped without the lock.
+            if (state == CRYPTO_POOL_BLOCK_DIRTY)
+            {
+                lCrypto_Pool_Wipe(type, index);
+            }
+            ptr_block = lCrypto_Pool_Block(type, index);
+        }
+    }
+
+    return ptr_block;
+}
+
+crypto_Pool_Status_E Crypto_Pool_Release(crypto_Pool_Type_E type, void *ptr_block)
+{
+    crypto_Pool_Status_E status = CRYPTO_POOL_ERROR_ARG;
+
+    if ((type >= CRYPTO_POOL_SYM_BLOCK) && (type < CRYPTO_POOL_TYPE_MAX) && (ptr_block != NULL))
+    {
+        st_Crypto_Pool_Data *ptr_pool = &poolData[type];
+        uint32_t first = poolDesc[type].firstSlot;
+        uint32_t index = lCrypto_Pool_Index(type, ptr_block);
+        uint32_t lockState;
+
+        status = (poolDesc[type].blockCount > 0U) ? CRYPTO_POOL_ERROR_NOTOWNED : CRYPTO_POOL_ERROR_NOTSUPPTD;
+        if (index < poolDesc[type].blockCount)
+        {
+            status = CRYPTO_POOL_ERROR_NOTINUSE;
+            lockState = Crypto_Int_Hw_Lock();
+            if (poolState[first + index] == CRYPTO_POOL_BLOCK_USED)
+            {
+                ptr_pool->inUse--;
+#ifdef CRYPTO_POOL_LAZY_ZEROIZE
+                poolState[first + index] = CRYPTO_POOL_BLOCK_DIRTY;
+                ptr_pool->dirty++;
+                poolFreeStack[first + ptr_pool->freeTop] = (uint16_t)index;
+                ptr_pool->freeTop++;
+#else
+                poolState[first + index] = CRYPTO_POOL_BLOCK_WIPING;
+#endif
+                status = CRYPTO_POOL_SUCCESS;
+            }
+            Crypto_Int_Hw_Unlock(lockState);
+
+#ifndef CRYPTO_POOL_LAZY_ZEROIZE
+            if (status == CRYPTO_POOL_SUCCESS)
+            {
+                // No pool hands out a block being wiped, so the lock is not held.
+                lCrypto_Pool_Wipe(type, index);
+
+                lockState = Crypto_Int_Hw_Lock();
+                poolState[first + index] = CRYPTO_POOL_BLOCK_FREE;
+                poolFreeStack[first + ptr_pool->freeTop] = (uint16_t)index;
+                ptr_pool->freeTop++;
+                Crypto_Int_Hw_Unlock(lockState);
+            }
+#endif
+        }
+    }
+
+    return status;
+}
+
+uint32_t Crypto_Pool_Scrub(void)
+{
+    uint32_t wiped = 0U;
+    uint32_t type;
+    uint32_t index;
+
+    for (type = 0U; type < (uint32_t)CRYPTO_POOL_TYPE_MAX; type++)
+    {
+        uint32_t first = poolDesc[type].firstSlot;
+
+        for (index = 0U; index < poolDesc[type].blockCount; index++)
+        {
+            /* A dirty block stays on the free stack, where an interrupt may
+             * acquire it, so it is wiped with the lock held. */
+            uint32_t lockState = Crypto_Int_Hw_Lock();
+
+            if (poolState[first + index] == CRYPTO_POOL_BLOCK_DIRTY)
+            {
+                lCrypto_Pool_Wipe((crypto_Pool_Type_E)type, index);
+                poolState[first + index] = CRYPTO_POOL_BLOCK_FREE;
+                poolData[type].dirty--;
+                wiped++;
+            }
+
+            Crypto_Int_Hw_Unlock(lockState);
+        }
+    }
+
+    return wiped;
+}
+
+crypto_Pool_Status_E Crypto_Pool_Stats_Get(crypto_Pool_Type_E type, st_Crypto_Pool_Stats *ptr_stats_st, bool reset)
+{
+    crypto_Pool_Status_E status = CRYPTO_POOL_ERROR_ARG;
+
+    if ((type >= CRYPTO_POOL_SYM_BLOCK) && (type < CRYPTO_POOL_TYPE_MAX) && (ptr_stats_st != NULL))
+    {
+        st_Crypto_Pool_Data *ptr_pool = &poolData[type];
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        ptr_stats_st->blockSize = (uint32_t)poolDesc[type].blockWords * sizeof(uint32_t);
+        ptr_stats_st->blockCount = poolDesc[type].blockCount;
+        ptr_stats_st->inUse = ptr_pool->inUse;
+        ptr_stats_st->highWater = ptr_pool->highWater;
+        ptr_stats_st->dirty = ptr_pool->dirty;
+        ptr_stats_st->acquisitions = ptr_pool->acquisitions;
+        ptr_stats_st->failures = ptr_pool->failures;
+
+        if (reset == true)
+        {
+            ptr_pool->highWater = ptr_pool->inUse;
+            ptr_pool->acquisitions = 0U;
+            ptr_pool->failures = 0U;
+        }
+
+        Crypto_Int_Hw_Unlock(lockState);
+        status = CRYPTO_POOL_SUCCESS;
+    }
+
+    return status;
+}
@@ -0,0 +1,276 @@
+/*******************************************************************************
+  Crypto Statistics Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_stats.c
+
+  Summary:
+    This source file implements the CAM engine usage counters.
+
+  Description:
+    All counters are kept in one st_Crypto_Stats structure and only changed
+    with interrupts disabled (Crypto_Int_Hw_Lock()), which keeps every update
+    and every snapshot consistent. The 32-bit timestamps are extended to the
+    64-bit elapsed time at every update, so the counters stay correct as long
+    as some update or snapshot happens within one timestamp wrap period.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+
+#ifdef CRYPTO_STATS_ENABLE
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+static const crypto_Stats_Engine_E statsAlgoEngine[CRYPTO_STATS_ALGO_MAX] =
+{
+    CRYPTO_STATS_ENGINE_AES,    // CRYPTO_STATS_ALGO_SYM_AES
+    CRYPTO_STATS_ENGINE_AES,    // CRYPTO_STATS_ALGO_AEAD_AESGCM
+    CRYPTO_STATS_ENGINE_AES,    // CRYPTO_STATS_ALGO_MAC_AESCMAC
+    CRYPTO_STATS_ENGINE_HASH,   // CRYPTO_STATS_ALGO_HASH_SHA
+    CRYPTO_STATS_ENGINE_TRNG,   // CRYPTO_STATS_ALGO_RNG_TRNG
+    CRYPTO_STATS_ENGINE_PKE,    // CRYPTO_STATS_ALGO_DIGISIGN_ECDSA_SIGN
+    CRYPTO_STATS_ENGINE_PKE,    // CRYPTO_STATS_ALGO_DIGISIGN_ECDSA_VERIFY
+    CRYPTO_STATS_ENGINE_PKE,    // CRYPTO_STATS_ALGO_KAS_ECDH
+};
+
+static st_Crypto_Stats statsData;
+
+// Start of the current busy period of each engine with calls in progress.
+static uint32_t statsBusyStart[CRYPTO_STATS_ENGINE_MAX];
+
+// Timestamp of the last update, used to extend elapsedTicks.
+static uint32_t statsLastTimestamp;
+
+static bool statsStarted;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+// Called with interrupts disabled.
+static uint32_t lCrypto_Stats_Now(void)
+{
+    uint32_t now = CRYPTO_STATS_PORT_Timestamp();
+
+    if (statsStarted == true)
+    {
+        statsData.elapsedTicks += (uint64_t)(now - statsLastTimestamp);
+    }
+    statsStarted = true;
+    statsLastTimestamp = now;
+
+    return now;
+}
+
+static void lCrypto_Stats_Enter(st_Crypto_Stats_Counters *ptr_counters_st)
+{
+    ptr_counters_st->queueDepth++;
+    if (ptr_counters_st->queueDepth > ptr_counters_st->peakQueueDepth)
+    {
+        ptr_counters_st->peakQueueDepth = ptr_counters_st->queueDepth;
+    }
+}
+
+static void lCrypto_Stats_Leave(st_Crypto_Stats_Counters *ptr_counters_st, uint32_t length, int32_t status)
+{
+    if (ptr_counters_st->queueDepth > 0U)
+    {
+        ptr_counters_st->queueDepth--;
+    }
+    ptr_counters_st->operations++;
+    ptr_counters_st->bytes += length;
+
+    if (status < 0)
+    {
+        ptr_counters_st->errors++;
+        if ((status >= CRYPTO_STATS_ERROR_CODE_FIRST) && (status <= CRYPTO_STATS_ERROR_CODE_LAST))
+        {
+            ptr_counters_st->errorCodes[status - CRYPTO_STATS_ERROR_CODE_FIRST]++;
+        }
+    }
+}
+
+/* Called with interrupts disabled. Calls in progress stay counted; their
+ * algorithm busy time is still measured from the start of the call. */
+static void lCrypto_Stats_Clear(uint32_t now)
+{
+    uint32_t index;
+
+    statsData.elapsedTicks = 0U;
+    statsData.interrupts[0] = 0UL;
+    statsData.interrupts[1] = 0UL;
+    statsData.interrupts[2] = 0UL;
+
+    for (index = 0U; index < (uint32_t)CRYPTO_STATS_ALGO_MAX; index++)
+    {
+        uint16_t depth = statsData.algo[index].queueDepth;
+
+        (void)memset(&statsData.algo[index], 0, sizeof(statsData.algo[index]));
+        statsData.algo[index].queueDepth = depth;
+        statsData.algo[index].peakQueueDepth = depth;
+    }
+
+    for (index = 0U; index < (uint32_t)CRYPTO_STATS_ENGINE_MAX; index++)
+    {
+        uint16_t depth = statsData.engine[index].queueDepth;
+
+        (void)memset(&statsData.engine[index], 0, sizeof(statsData.engine[index]));
+        statsData.engine[index].queueDepth = depth;
+        statsData.engine[index].peakQueueDepth = depth;
+        statsBusyStart[index] = now;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t Crypto_Stats_Begin(crypto_Stats_Algo_E algo)
+{
+    uint32_t lockState = Crypto_Int_Hw_Lock();
+    uint32_t now = lCrypto_Stats_Now();
+    crypto_Stats_Engine_E engine = statsAlgoEngine[algo];
+
+    if (statsData.engine[engine].queueDepth == 0U)
+    {
+        statsBusyStart[engine] = now;
+    }
+    lCrypto_Stats_Enter(&statsData.engine[engine]);
+    lCrypto_Stats_Enter(&statsData.algo[algo]);
+
+    Crypto_Int_Hw_Unlock(lockState);
+
+    return now;
+}
+
+int32_t Crypto_Stats_End(crypto_Stats_Algo_E algo, uint32_t start, uint32_t length, int32_t status)
+{
+    uint32_t lockState = Crypto_Int_Hw_Lock();
+    uint32_t now = lCrypto_Stats_Now();
+    crypto_Stats_Engine_E engine = statsAlgoEngine[algo];
+
+    lCrypto_Stats_Leave(&statsData.algo[algo], length, status);
+    statsData.algo[algo].busyTicks += (uint64_t)(now - start);
+
+    lCrypto_Stats_Leave(&statsData.engine[engine], length, status);
+    if (statsData.engine[engine].queueDepth == 0U)
+    {
+        statsData.engine[engine].busyTicks += (uint64_t)(now - statsBusyStart[engine]);
+    }
+
+    Crypto_Int_Hw_Unlock(lockState);
+
+    return status;
+}
+
+void Crypto_Stats_Interrupt(uint32_t vector)
+{
+    /* Each vector has its own counter and an interrupt is not preempted by
+     * itself, so no lock is needed. */
+    if (vector < CRYPTO_STATS_VECTOR_COUNT)
+    {
+        statsData.interrupts[vector]++;
+    }
+}
+
+crypto_Stats_Status_E Crypto_Stats_Get(st_Crypto_Stats *ptr_stats_st, bool reset)
+{
+    crypto_Stats_Status_E status = CRYPTO_STATS_ERROR_ARG;
+
+    if (ptr_stats_st != NULL)
+    {
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+        uint32_t now = lCrypto_Stats_Now();
+        uint32_t engine;
+
+        *ptr_stats_st = statsData;
+        ptr_stats_st->tickRate = CRYPTO_STATS_PORT_TickRate();
+
+        // Include the part of the current busy periods seen so far.
+        for (engine = 0U; engine < (uint32_t)CRYPTO_STATS_ENGINE_MAX; engine++)
+        {
+            if (statsData.engine[engine].queueDepth > 0U)
+            {
+                ptr_stats_st->engine[engine].busyTicks += (uint64_t)(now - statsBusyStart[engine]);
+            }
+        }
+
+        if (reset == true)
+        {
+            lCrypto_Stats_Clear(now);
+        }
+
+        Crypto_Int_Hw_Unlock(lockState);
+        status = CRYPTO_STATS_SUCCESS;
+    }
+
+    return status;
+}
+
+void Crypto_Stats_Reset(void)
+{
+    uint32_t lockState = Crypto_Int_Hw_Lock();
+
+    lCrypto_Stats_Clear(lCrypto_Stats_Now());
+
+    Crypto_Int_Hw_Unlock(lockState);
+}
+
+#else
+
+crypto_Stats_Status_E Crypto_Stats_Get(st_Crypto_Stats *ptr_stats_st, bool reset)
+{
+    (void)ptr_stats_st;
+    (void)reset;
+
+    return CRYPTO_STATS_ERROR_NOTSUPPTD;
+}
+
+void Crypto_Stats_Reset(void)
+{
+}
+
+#endif /* CRYPTO_STATS_ENABLE */
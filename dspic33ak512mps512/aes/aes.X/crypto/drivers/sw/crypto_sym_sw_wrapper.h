@@ -0,0 +1,110 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_sym_sw_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES.
+
+  Description:
+    This header file contains the software implementation of the symmetric
+    AES modes used by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SYM_SW_WRAPPER_H
+#define CRYPTO_SYM_SW_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_sym_cipher.h"
+#include "crypto/drivers/sw/crypto_sw_aes.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+  CRYPTO_SW_AES_KEY key;
+  CRYPTO_SW_AES_CTR ctr;
+  crypto_Sym_OpModes_E mode;
+  crypto_CipherOper_E operation;
+
+} CRYPTO_AES_SW_CONTEXT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Symmetric Algorithms Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+/* ECB and CTR. ECB takes whole blocks; CTR takes any length and continues the
+ * keystream across Crypto_Sym_Sw_Aes_Cipher() calls. */
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_Init(void *aesInitCtx, crypto_CipherOper_E cipherOpType_en,
+    crypto_Sym_OpModes_E opMode_en, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect);
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_Cipher(void *aesCipherCtx, uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData);
+
+// With a NULL workspace the context is kept on the stack.
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_EncryptDirect(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace);
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_DecryptDirect(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_SYM_SW_WRAPPER_H */
@@ -0,0 +1,239 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_sw_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES-CMAC.
+
+  Description:
+    This source file contains the software implementation of AES-CMAC used
+    by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/drivers/sw/crypto_mac_sw_wrapper.h"
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1) && (CRYPTO_CONFIG_MAC_AESCMAC == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Double a block in GF(2^128), as for the CMAC subkeys.
+ * @param in The block.
+ * @param out A buffer to hold the doubled block.
+ */
+static void lCrypto_Sym_Sw_Cmac_Double(const uint8_t *in, uint8_t *out)
+{
+    // 0x87 is folded in when the top bit shifts out, selected with a mask.
+    uint8_t reduce = (uint8_t)(0x87U & (0U - (uint32_t)(in[0] >> 7)));
+    uint32_t i;
+
+    for (i = 0UL; i < (CRYPTO_SW_AES_BLOCK_SIZE - 1UL); i++)
+    {
+        out[i] = (uint8_t)((uint32_t)in[i] << 1) | (uint8_t)(in[i + 1UL] >> 7);
+    }
+    out[CRYPTO_SW_AES_BLOCK_SIZE - 1UL] = (uint8_t)((uint32_t)in[CRYPTO_SW_AES_BLOCK_SIZE - 1UL] << 1) ^ reduce;
+}
+
+/**
+ * @brief Chain one block into the CBC-MAC state.
+ * @param macCtx The context.
+ * @param block The block.
+ */
+static void lCrypto_Sym_Sw_Cmac_Block(CRYPTO_CMAC_SW_CONTEXT *macCtx, const uint8_t *block)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < CRYPTO_SW_AES_BLOCK_SIZE; i++)
+    {
+        macCtx->state[i] ^= block[i];
+    }
+    Crypto_Sw_Aes_Encrypt(&macCtx->key, macCtx->state, macCtx->state, 1UL);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MAC Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Init(void *contextData, uint8_t *key, uint32_t keyLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_SW_CONTEXT *macCtx = (CRYPTO_CMAC_SW_CONTEXT*) contextData;
+    crypto_Mac_Status_E status = CRYPTO_MAC_CIPHER_SUCCESS;
+
+    (void)memset(macCtx, 0, sizeof(CRYPTO_CMAC_SW_CONTEXT));
+
+    if (!Crypto_Sw_Aes_SetKey(&macCtx->key, key, keyLen))
+    {
+        status = CRYPTO_MAC_ERROR_KEY;
+    }
+    else
+    {
+        // L = E(K, 0^128), K1 = 2L, K2 = 4L; state is still zero.
+        Crypto_Sw_Aes_Encrypt(&macCtx->key, macCtx->state, macCtx->k2, 1UL);
+        lCrypto_Sym_Sw_Cmac_Double(macCtx->k2, macCtx->k1);
+        lCrypto_Sym_Sw_Cmac_Double(macCtx->k1, macCtx->k2);
+        macCtx->initialized = true;
+    }
+
+    return status;
+}
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Cipher(void *contextData, uint8_t *inputData, uint32_t dataLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_SW_CONTEXT *macCtx = (CRYPTO_CMAC_SW_CONTEXT*) contextData;
+    crypto_Mac_Status_E status = CRYPTO_MAC_CIPHER_SUCCESS;
+
+    if (!macCtx->initialized)
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+    else
+    {
+        while (dataLen > 0UL)
+        {
+            // A full held block is only chained once more data shows it is not the last.
+            if (macCtx->blockLen == CRYPTO_SW_AES_BLOCK_SIZE)
+            {
+                lCrypto_Sym_Sw_Cmac_Block(macCtx, macCtx->block);
+                macCtx->blockLen = 0UL;
+            }
+
+            if ((macCtx->blockLen == 0UL) && (dataLen > CRYPTO_SW_AES_BLOCK_SIZE))
+            {
+                lCrypto_Sym_Sw_Cmac_Block(macCtx, inputData);
+                inputData = &inputData[CRYPTO_SW_AES_BLOCK_SIZE];
+                dataLen -= CRYPTO_SW_AES_BLOCK_SIZE;
+            }
+            else
+            {
+                uint32_t take = CRYPTO_SW_AES_BLOCK_SIZE - macCtx->blockLen;
+
+                if (take > dataLen)
+                {
+                    take = dataLen;
+                }
+                (void)memcpy(&macCtx->block[macCtx->blockLen], inputData, take);
+                macCtx->blockLen += take;
+                inputData = &inputData[take];
+                dataLen -= take;
+            }
+        }
+    }
+
+    return status;
+}
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Final(void *contextData, uint8_t *outputMac, uint32_t macLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_SW_CONTEXT *macCtx = (CRYPTO_CMAC_SW_CONTEXT*) contextData;
+    crypto_Mac_Status_E status = CRYPTO_MAC_CIPHER_SUCCESS;
+    uint32_t i;
+
+    if (!macCtx->initialized)
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+    else if ((macLen == 0UL) || (macLen > CRYPTO_SW_AES_BLOCK_SIZE))
+    {
+        status = CRYPTO_MAC_ERROR_MACDATA;
+    }
+    else
+    {
+        if (macCtx->blockLen == CRYPTO_SW_AES_BLOCK_SIZE)
+        {
+            for (i = 0UL; i < CRYPTO_SW_AES_BLOCK_SIZE; i++)
+            {
+                macCtx->block[i] ^= macCtx->k1[i];
+            }
+        }
+        else
+        {
+            // 10* padding, for an empty message too.
+            macCtx->block[macCtx->blockLen] = 0x80U;
+            (void)memset(&macCtx->block[macCtx->blockLen + 1UL], 0, CRYPTO_SW_AES_BLOCK_SIZE - macCtx->blockLen - 1UL);
+            for (i = 0UL; i < CRYPTO_SW_AES_BLOCK_SIZE; i++)
+            {
+                macCtx->block[i] ^= macCtx->k2[i];
+            }
+        }
+
+        lCrypto_Sym_Sw_Cmac_Block(macCtx, macCtx->block);
+        (void)memcpy(outputMac, macCtx->state, macLen);
+        Crypto_Sw_Wipe(macCtx, (uint32_t)sizeof(CRYPTO_CMAC_SW_CONTEXT));
+    }
+
+    return status;
+}
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Direct(uint8_t *ptr_inputData, uint32_t dataLen,
+                                              uint8_t *ptr_outMac, uint32_t macLen,
+                                              uint8_t *ptr_key, uint32_t keyLen, void *workspace)
+{
+    CRYPTO_CMAC_SW_CONTEXT macCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_SW_CONTEXT *ptr_macCtx = (workspace != NULL) ? (CRYPTO_CMAC_SW_CONTEXT*) workspace : &macCtx;
+    crypto_Mac_Status_E status = Crypto_Sym_Sw_Cmac_Init(ptr_macCtx, ptr_key, keyLen);
+
+    if (status == CRYPTO_MAC_CIPHER_SUCCESS)
+    {
+        status = Crypto_Sym_Sw_Cmac_Cipher(ptr_macCtx, ptr_inputData, dataLen);
+    }
+
+    if (status == CRYPTO_MAC_CIPHER_SUCCESS)
+    {
+        status = Crypto_Sym_Sw_Cmac_Final(ptr_macCtx, ptr_outMac, macLen);
+    }
+
+    Crypto_Sw_Wipe(ptr_macCtx, (uint32_t)sizeof(CRYPTO_CMAC_SW_CONTEXT));
+
+    return status;
+}
+
+#endif /* CRYPTO_CONFIG_SW_HANDLER == 1 */
@@ -0,0 +1,811 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_sw_aes.c
+
+  Summary:
+    Crypto Framework Library software AES block cipher.
+
+  Description:
+    This source file contains the bitsliced AES block cipher, counter mode
+    and GHASH of the software handler. Two blocks are processed at a time in
+    eight 32-bit words, word i holding bit i of all 32 bytes, so SubBytes is
+    a fixed sequence of 113 logic operations (the Boyar-Peralta S-box
+    circuit) and ShiftRows and MixColumns are rotations of the words.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/drivers/sw/crypto_sw_aes.h"
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCrypto_Sw_Aes_Load32(const uint8_t *src)
+{
+    return (uint32_t)src[0] | ((uint32_t)src[1] << 8) | ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24);
+}
+
+static void lCrypto_Sw_Aes_Store32(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)value;
+    dst[1] = (uint8_t)(value >> 8);
+    dst[2] = (uint8_t)(value >> 16);
+    dst[3] = (uint8_t)(value >> 24);
+}
+
+static uint32_t lCrypto_Sw_Load32Be(const uint8_t *src)
+{
+    return ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | (uint32_t)src[3];
+}
+
+static void lCrypto_Sw_Store32Be(uint8_t *dst, uint32_t value)
+{
+    dst[0] = (uint8_t)(value >> 24);
+    dst[1] = (uint8_t)(value >> 16);
+    dst[2] = (uint8_t)(value >> 8);
+    dst[3] = (uint8_t)value;
+}
+
+/**
+ * @brief Move between byte order and bitsliced order, in either direction.
+ * @param q The eight state words.
+ */
+static void lCrypto_Sw_Aes_Ortho(uint32_t *q)
+{
+    static const uint32_t mask[3] = { 0x55555555UL, 0x33333333UL, 0x0F0F0F0FUL };
+    uint32_t step;
+    uint32_t shift = 1UL;
+    uint32_t i;
+
+    for (step = 0UL; step < 3UL; step++)
+    {
+        uint32_t span = 1UL << step;
+
+        for (i = 0UL; i < 8UL; i++)
+        {
+            if ((i & span) == 0UL)
+            {
+                uint32_t a = q[i];
+                uint32_t b = q[i + span];
+
+                q[i] = (a & mask[step]) | ((b & mask[step]) << shift);
+                q[i + span] = ((a >> shift) & mask[step]) | (b & ~mask[step]);
+            }
+        }
+        shift <<= 1;
+    }
+}
+
+/**
+ * @brief SubBytes on the eight bitsliced words.
+ * @param q The eight state words.
+ */
+static void lCrypto_Sw_Aes_SubBytes(uint32_t *q)
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint32_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint32_t y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint32_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint32_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint32_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint32_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint32_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint32_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint32_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // Top linear transformation.
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // Non-linear section.
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // Bottom linear transformation.
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/**
+ * @brief The affine map L(x) = A^-1(x ^ 0x63) of the inverse S-box, which
+ *        is L(S(L(x))).
+ * @param q The eight state words.
+ */
+static void lCrypto_Sw_Aes_InvAffine(uint32_t *q)
+{
+    uint32_t q0 = ~q[0];
+    uint32_t q1 = ~q[1];
+    uint32_t q2 = q[2];
+    uint32_t q3 = q[3];
+    uint32_t q4 = q[4];
+    uint32_t q5 = ~q[5];
+    uint32_t q6 = ~q[6];
+    uint32_t q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+static void lCrypto_Sw_Aes_InvSubBytes(uint32_t *q)
+{
+    lCrypto_Sw_Aes_InvAffine(q);
+    lCrypto_Sw_Aes_SubBytes(q);
+    lCrypto_Sw_Aes_InvAffine(q);
+}
+
+static void lCrypto_Sw_Aes_ShiftRows(uint32_t *q)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 8UL; i++)
+    {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FFUL)
+            | ((x & 0x0000FC00UL) >> 2) | ((x & 0x00000300UL) << 6)
+            | ((x & 0x00F00000UL) >> 4) | ((x & 0x000F0000UL) << 4)
+            | ((x & 0xC0000000UL) >> 6) | ((x & 0x3F000000UL) << 2);
+    }
+}
+
+static void lCrypto_Sw_Aes_InvShiftRows(uint32_t *q)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 8UL; i++)
+    {
+        uint32_t x = q[i];
+
+        q[i] = (x & 0x000000FFUL)
+            | ((x & 0x00003F00UL) << 2) | ((x & 0x0000C000UL) >> 6)
+            | ((x & 0x000F0000UL) << 4) | ((x & 0x00F00000UL) >> 4)
+            | ((x & 0x03000000UL) << 6) | ((x & 0xFC000000UL) >> 2);
+    }
+}
+
+static uint32_t lCrypto_Sw_Aes_Rotr16(uint32_t x)
+{
+    return (x << 16) | (x >> 16);
+}
+
+static void lCrypto_Sw_Aes_MixColumns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24);
+    uint32_t r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24);
+    uint32_t r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24);
+    uint32_t r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24);
+    uint32_t r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q7 ^ r7 ^ r0 ^ lCrypto_Sw_Aes_Rotr16(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ lCrypto_Sw_Aes_Rotr16(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ lCrypto_Sw_Aes_Rotr16(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ lCrypto_Sw_Aes_Rotr16(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ lCrypto_Sw_Aes_Rotr16(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ lCrypto_Sw_Aes_Rotr16(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ lCrypto_Sw_Aes_Rotr16(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q7 ^ r7);
+}
+
+static void lCrypto_Sw_Aes_InvMixColumns(uint32_t *q)
+{
+    uint32_t q0 = q[0], q1 = q[1], q2 = q[2], q3 = q[3];
+    uint32_t q4 = q[4], q5 = q[5], q6 = q[6], q7 = q[7];
+    uint32_t r0 = (q0 >> 8) | (q0 << 24);
+    uint32_t r1 = (q1 >> 8) | (q1 << 24);
+    uint32_t r2 = (q2 >> 8) | (q2 << 24);
+    uint32_t r3 = (q3 >> 8) | (q3 << 24);
+    uint32_t r4 = (q4 >> 8) | (q4 << 24);
+    uint32_t r5 = (q5 >> 8) | (q5 << 24);
+    uint32_t r6 = (q6 >> 8) | (q6 << 24);
+    uint32_t r7 = (q7 >> 8) | (q7 << 24);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^ lCrypto_Sw_Aes_Rotr16(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ lCrypto_Sw_Aes_Rotr16(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+/**
+ * @brief XOR round key round into the state, expanding it from four words
+ *        (both blocks share the key) to eight.
+ */
+static void lCrypto_Sw_Aes_AddRoundKey(uint32_t *q, const CRYPTO_SW_AES_KEY *aesKey, uint32_t round)
+{
+    const uint32_t *rk = &aesKey->roundKey[round * 4UL];
+    uint32_t i;
+
+    for (i = 0UL; i < 4UL; i++)
+    {
+        uint32_t even = rk[i] & 0x55555555UL;
+        uint32_t odd = rk[i] & 0xAAAAAAAAUL;
+
+        q[2UL * i] ^= even | (even << 1);
+        q[(2UL * i) + 1UL] ^= odd | (odd >> 1);
+    }
+}
+
+static uint32_t lCrypto_Sw_Aes_SubWord(uint32_t word)
+{
+    uint32_t q[8] = { 0UL };
+
+    q[0] = word;
+    lCrypto_Sw_Aes_Ortho(q);
+    lCrypto_Sw_Aes_SubBytes(q);
+    lCrypto_Sw_Aes_Ortho(q);
+
+    return q[0];
+}
+
+/**
+ * @brief Load up to two blocks into bitsliced order; a missing second block is zero.
+ */
+static void lCrypto_Sw_Aes_Load(uint32_t *q, const uint8_t *in, uint32_t blocks)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 4UL; i++)
+    {
+        q[2UL * i] = lCrypto_Sw_Aes_Load32(&in[4UL * i]);
+        q[(2UL * i) + 1UL] = (blocks > 1UL) ? lCrypto_Sw_Aes_Load32(&in[16UL + (4UL * i)]) : 0UL;
+    }
+    lCrypto_Sw_Aes_Ortho(q);
+}
+
+static void lCrypto_Sw_Aes_Store(uint32_t *q, uint8_t *out, uint32_t blocks)
+{
+    uint32_t i;
+
+    lCrypto_Sw_Aes_Ortho(q);
+    for (i = 0UL; i < 4UL; i++)
+    {
+        lCrypto_Sw_Aes_Store32(&out[4UL * i], q[2UL * i]);
+        if (blocks > 1UL)
+        {
+            lCrypto_Sw_Aes_Store32(&out[16UL + (4UL * i)], q[(2UL * i) + 1UL]);
+        }
+    }
+}
+
+static void lCrypto_Sw_Aes_EncryptState(const CRYPTO_SW_AES_KEY *aesKey, uint32_t *q)
+{
+    uint32_t round;
+
+    lCrypto_Sw_Aes_AddRoundKey(q, aesKey, 0UL);
+    for (round = 1UL; round < aesKey->rounds; round++)
+    {
+        lCrypto_Sw_Aes_SubBytes(q);
+        lCrypto_Sw_Aes_ShiftRows(q);
+        lCrypto_Sw_Aes_MixColumns(q);
+        lCrypto_Sw_Aes_AddRoundKey(q, aesKey, round);
+    }
+    lCrypto_Sw_Aes_SubBytes(q);
+    lCrypto_Sw_Aes_ShiftRows(q);
+    lCrypto_Sw_Aes_AddRoundKey(q, aesKey, aesKey->rounds);
+}
+
+static void lCrypto_Sw_Aes_DecryptState(const CRYPTO_SW_AES_KEY *aesKey, uint32_t *q)
+{
+    uint32_t round;
+
+    lCrypto_Sw_Aes_AddRoundKey(q, aesKey, aesKey->rounds);
+    for (round = aesKey->rounds - 1UL; round > 0UL; round--)
+    {
+        lCrypto_Sw_Aes_InvShiftRows(q);
+        lCrypto_Sw_Aes_InvSubBytes(q);
+        lCrypto_Sw_Aes_AddRoundKey(q, aesKey, round);
+        lCrypto_Sw_Aes_InvMixColumns(q);
+    }
+    lCrypto_Sw_Aes_InvShiftRows(q);
+    lCrypto_Sw_Aes_InvSubBytes(q);
+    lCrypto_Sw_Aes_AddRoundKey(q, aesKey, 0UL);
+}
+
+static void lCrypto_Sw_Aes_IncrementCounter(uint8_t *counter, uint32_t counterBytes)
+{
+    uint32_t carry = 1UL;
+    uint32_t i;
+
+    for (i = CRYPTO_SW_AES_BLOCK_SIZE; i > (CRYPTO_SW_AES_BLOCK_SIZE - counterBytes); i--)
+    {
+        carry += counter[i - 1UL];
+        counter[i - 1UL] = (uint8_t)carry;
+        carry >>= 8;
+    }
+}
+
+/**
+ * @brief Y = (Y ^ X) * H in GF(2^128), one bit of H per step with masks.
+ */
+static void lCrypto_Sw_Ghash_Block(CRYPTO_SW_GHASH *ghash, const uint8_t *block)
+{
+    uint32_t x[4];
+    uint32_t v[4];
+    uint32_t z[4] = { 0UL, 0UL, 0UL, 0UL };
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < 4UL; i++)
+    {
+        x[i] = ghash->y[i] ^ lCrypto_Sw_Load32Be(&block[4UL * i]);
+        v[i] = ghash->h[i];
+    }
+
+    for (i = 0UL; i < 128UL; i++)
+    {
+        uint32_t bit = 0UL - ((x[i >> 5] >> (31UL - (i & 31UL))) & 1UL);
+        uint32_t reduce = 0UL - (v[3] & 1UL);
+
+        for (j = 0UL; j < 4UL; j++)
+        {
+            z[j] ^= v[j] & bit;
+        }
+        v[3] = (v[3] >> 1) | (v[2] << 31);
+        v[2] = (v[2] >> 1) | (v[1] << 31);
+        v[1] = (v[1] >> 1) | (v[0] << 31);
+        v[0] = (v[0] >> 1) ^ (0xE1000000UL & reduce);
+    }
+
+    for (i = 0UL; i < 4UL; i++)
+    {
+        ghash->y[i] = z[i];
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Software AES Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+bool Crypto_Sw_Aes_SetKey(CRYPTO_SW_AES_KEY *aesKey, const uint8_t *key, uint32_t keyLen)
+{
+    static const uint8_t rcon[10] = { 0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x1BU, 0x36U };
+    uint32_t words[(CRYPTO_SW_AES_MAX_ROUNDS + 1UL) * 4UL];
+    uint32_t keyWords = keyLen / 4UL;
+    uint32_t totalWords;
+    uint32_t tmp = 0UL;
+    uint32_t i;
+    uint32_t j = 0UL;
+    uint32_t k = 0UL;
+    bool valid = ((keyLen == 16UL) || (keyLen == 24UL) || (keyLen == 32UL));
+
+    if (valid)
+    {
+        aesKey->rounds = keyWords + 6UL;
+        totalWords = (aesKey->rounds + 1UL) * 4UL;
+
+        for (i = 0UL; i < keyWords; i++)
+        {
+            tmp = lCrypto_Sw_Aes_Load32(&key[4UL * i]);
+            words[i] = tmp;
+        }
+        for (i = keyWords; i < totalWords; i++)
+        {
+            if (j == 0UL)
+            {
+                tmp = (tmp << 24) | (tmp >> 8);
+                tmp = lCrypto_Sw_Aes_SubWord(tmp) ^ (uint32_t)rcon[k];
+            }
+            else if ((keyWords > 6UL) && (j == 4UL))
+            {
+                tmp = lCrypto_Sw_Aes_SubWord(tmp);
+            }
+            else
+            {
+                // Other words are the XOR of the previous ones only.
+            }
+            tmp ^= words[i - keyWords];
+            words[i] = tmp;
+            j++;
+            if (j == keyWords)
+            {
+                j = 0UL;
+                k++;
+            }
+        }
+
+        /* Bitslice each round key as a pair of identical blocks and keep one
+         * copy: the even bits of the first block and the odd bits of the
+         * second. */
+        for (i = 0UL; i < totalWords; i += 4UL)
+        {
+            uint32_t q[8];
+
+            for (j = 0UL; j < 4UL; j++)
+            {
+                q[2UL * j] = words[i + j];
+                q[(2UL * j) + 1UL] = words[i + j];
+            }
+            lCrypto_Sw_Aes_Ortho(q);
+            for (j = 0UL; j < 4UL; j++)
+            {
+                aesKey->roundKey[i + j] = (q[2UL * j] & 0x55555555UL) | (q[(2UL * j) + 1UL] & 0xAAAAAAAAUL);
+            }
+            Crypto_Sw_Wipe(q, (uint32_t)sizeof(q));
+        }
+
+        Crypto_Sw_Wipe(words, (uint32_t)sizeof(words));
+    }
+
+    return valid;
+}
+
+void Crypto_Sw_Aes_Encrypt(const CRYPTO_SW_AES_KEY *aesKey, const uint8_t *in, uint8_t *out, uint32_t blocks)
+{
+    uint32_t q[8];
+
+    while (blocks > 0UL)
+    {
+        uint32_t n = (blocks > 1UL) ? 2UL : 1UL;
+
+        lCrypto_Sw_Aes_Load(q, in, n);
+        lCrypto_Sw_Aes_EncryptState(aesKey, q);
+        lCrypto_Sw_Aes_Store(q, out, n);
+        in = &in[n * CRYPTO_SW_AES_BLOCK_SIZE];
+        out = &out[n * CRYPTO_SW_AES_BLOCK_SIZE];
+        blocks -= n;
+    }
+    Crypto_Sw_Wipe(q, (uint32_t)sizeof(q));
+}
+
+void Crypto_Sw_Aes_Decrypt(const CRYPTO_SW_AES_KEY *aesKey, const uint8_t *in, uint8_t *out, uint32_t blocks)
+{
+    uint32_t q[8];
+
+    while (blocks > 0UL)
+    {
+        uint32_t n = (blocks > 1UL) ? 2UL : 1UL;
+
+        lCrypto_Sw_Aes_Load(q, in, n);
+        lCrypto_Sw_Aes_DecryptState(aesKey, q);
+        lCrypto_Sw_Aes_Store(q, out, n);
+        in = &in[n * CRYPTO_SW_AES_BLOCK_SIZE];
+        out = &out[n * CRYPTO_SW_AES_BLOCK_SIZE];
+        blocks -= n;
+    }
+    Crypto_Sw_Wipe(q, (uint32_t)sizeof(q));
+}
+
+void Crypto_Sw_Aes_CtrInit(CRYPTO_SW_AES_CTR *ctr, const uint8_t *initCounter, uint32_t counterBytes)
+{
+    (void)memcpy(ctr->counter, initCounter, CRYPTO_SW_AES_BLOCK_SIZE);
+    ctr->used = CRYPTO_SW_AES_BLOCK_SIZE;
+    ctr->counterBytes = counterBytes;
+}
+
+void Crypto_Sw_Aes_Ctr(const CRYPTO_SW_AES_KEY *aesKey, CRYPTO_SW_AES_CTR *ctr,
+    const uint8_t *in, uint8_t *out, uint32_t dataLen)
+{
+    uint8_t pair[2UL * CRYPTO_SW_AES_BLOCK_SIZE];
+    uint32_t i;
+
+    // Rest of the keystream block of the previous call.
+    while ((dataLen > 0UL) && (ctr->used < CRYPTO_SW_AES_BLOCK_SIZE))
+    {
+        *out = *in ^ ctr->keystream[ctr->used];
+        ctr->used++;
+        in++;
+        out++;
+        dataLen--;
+    }
+
+    // Two counter blocks per cipher call.
+    while (dataLen >= (2UL * CRYPTO_SW_AES_BLOCK_SIZE))
+    {
+        (void)memcpy(pair, ctr->counter, CRYPTO_SW_AES_BLOCK_SIZE);
+        lCrypto_Sw_Aes_IncrementCounter(ctr->counter, ctr->counterBytes);
+        (void)memcpy(&pair[CRYPTO_SW_AES_BLOCK_SIZE], ctr->counter, CRYPTO_SW_AES_BLOCK_SIZE);
+        lCrypto_Sw_Aes_IncrementCounter(ctr->counter, ctr->counterBytes);
+        Crypto_Sw_Aes_Encrypt(aesKey, pair, pair, 2UL);
+        for (i = 0UL; i < (2UL * CRYPTO_SW_AES_BLOCK_SIZE); i++)
+        {
+            out[i] = in[i] ^ pair[i];
+        }
+        in = &in[2UL * CRYPTO_SW_AES_BLOCK_SIZE];
+        out = &out[2UL * CRYPTO_SW_AES_BLOCK_SIZE];
+        dataLen -= 2UL * CRYPTO_SW_AES_BLOCK_SIZE;
+    }
+
+    // Last block, kept for the next call when only part of it is used.
+    while (dataLen > 0UL)
+    {
+        Crypto_Sw_Aes_Encrypt(aesKey, ctr->counter, ctr->keystream, 1UL);
+        lCrypto_Sw_Aes_IncrementCounter(ctr->counter, ctr->counterBytes);
+        ctr->used = 0UL;
+        while ((dataLen > 0UL) && (ctr->used < CRYPTO_SW_AES_BLOCK_SIZE))
+        {
+            *out = *in ^ ctr->keystream[ctr->used];
+            ctr->used++;
+            in++;
+            out++;
+            dataLen--;
+        }
+    }
+
+    Crypto_Sw_Wipe(pair, (uint32_t)sizeof(pair));
+}
+
+void Crypto_Sw_Ghash_Init(CRYPTO_SW_GHASH *ghash, const CRYPTO_SW_AES_KEY *aesKey)
+{
+    uint8_t h[CRYPTO_SW_AES_BLOCK_SIZE] = { 0U };
+    uint32_t i;
+
+    Crypto_Sw_Aes_Encrypt(aesKey, h, h, 1UL);
+    for (i = 0UL; i < 4UL; i++)
+    {
+        ghash->h[i] = lCrypto_Sw_Load32Be(&h[4UL * i]);
+        ghash->y[i] = 0UL;
+    }
+    ghash->blockLen = 0UL;
+    Crypto_Sw_Wipe(h, (uint32_t)sizeof(h));
+}
+
+void Crypto_Sw_Ghash_Update(CRYPTO_SW_GHASH *ghash, const uint8_t *data, uint32_t dataLen)
+{
+    while (dataLen > 0UL)
+    {
+        if ((ghash->blockLen == 0UL) && (dataLen >= CRYPTO_SW_AES_BLOCK_SIZE))
+        {
+            lCrypto_Sw_Ghash_Block(ghash, data);
+            data = &data[CRYPTO_SW_AES_BLOCK_SIZE];
+            dataLen -= CRYPTO_SW_AES_BLOCK_SIZE;
+        }
+        else
+        {
+            ghash->block[ghash->blockLen] = *data;
+            ghash->blockLen++;
+            data++;
+            dataLen--;
+            if (ghash->blockLen == CRYPTO_SW_AES_BLOCK_SIZE)
+            {
+                lCrypto_Sw_Ghash_Block(ghash, ghash->block);
+                ghash->blockLen = 0UL;
+            }
+        }
+    }
+}
+
+void Crypto_Sw_Ghash_Pad(CRYPTO_SW_GHASH *ghash)
+{
+    if (ghash->blockLen > 0UL)
+    {
+        (void)memset(&ghash->block[ghash->blockLen], 0, CRYPTO_SW_AES_BLOCK_SIZE - ghash->blockLen);
+        lCrypto_Sw_Ghash_Block(ghash, ghash->block);
+        ghash->blockLen = 0UL;
+    }
+}
+
+void Crypto_Sw_Ghash_Final(CRYPTO_SW_GHASH *ghash, uint64_t aadLen, uint64_t dataLen, uint8_t *out)
+{
+    uint8_t lengths[CRYPTO_SW_AES_BLOCK_SIZE];
+    uint32_t i;
+
+    Crypto_Sw_Ghash_Pad(ghash);
+    lCrypto_Sw_Store32Be(&lengths[0], (uint32_t)((aadLen * 8ULL) >> 32));
+    lCrypto_Sw_Store32Be(&lengths[4], (uint32_t)(aadLen * 8ULL));
+    lCrypto_Sw_Store32Be(&lengths[8], (uint32_t)((dataLen * 8ULL) >> 32));
+    lCrypto_Sw_Store32Be(&lengths[12], (uint32_t)(dataLen * 8ULL));
+    lCrypto_Sw_Ghash_Block(ghash, lengths);
+
+    for (i = 0UL; i < 4UL; i++)
+    {
+        lCrypto_Sw_Store32Be(&out[4UL * i], ghash->y[i]);
+    }
+}
+
+void Crypto_Sw_Wipe(void *ptr, uint32_t len)
+{
+    volatile uint8_t *p = (volatile uint8_t *)ptr;
+
+    while (len > 0UL)
+    {
+        *p = 0U;
+        p++;
+        len--;
+    }
+}
+
+uint32_t Crypto_Sw_Compare(const uint8_t *a, const uint8_t *b, uint32_t len)
+{
+    uint32_t diff = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < len; i++)
+    {
+        diff |= (uint32_t)a[i] ^ (uint32_t)b[i];
+    }
+
+    return (diff != 0UL) ? 1UL : 0UL;
+}
+
+#endif /* CRYPTO_CONFIG_SW_HANDLER == 1 */
@@ -99,6 +99,15 @@ crypto_Sym_Status_E Crypto_Sym_Hw_Aes_DecryptDirect(crypto_Sym_OpModes_E opMode_
     uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
     uint8_t *key, uint32_t keyLen, uint8_t *initVect);
 
+// As the *Direct() functions, with the context in a CRYPTO_AES_HW_CONTEXT workspace.
+crypto_Sym_Status_E Crypto_Sym_Hw_Aes_EncryptDirectEx(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace);
+
+crypto_Sym_Status_E Crypto_Sym_Hw_Aes_DecryptDirectEx(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -51,6 +51,12 @@ Microchip or any third party.
 #include "crypto/drivers/wrapper/crypto_sym_cam05346_wrapper.h"
 #include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_aes.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_SYM_AES == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -69,11 +75,49 @@ Microchip or any third party.
 
 /**
  * @brief Initialize the CAM library's AES interrupt handlers.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
  */
-static void lCrypto_Sym_Hw_Aes_InterruptSetup(void)
+static crypto_Int_Status_E lCrypto_Sym_Hw_Aes_InterruptSetup(void)
 {
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the SHA engine, which the caller holds as
+         * well, so the vector is taken over from the SHA handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lCrypto_Sym_Hw_Aes_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lCrypto_Sym_Hw_Aes_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
 }
 
 /**
@@ -89,18 +133,24 @@ static crypto_Sym_Status_E lCrypto_Sym_Hw_Aes_GetCipherMode(crypto_Sym_OpModes_E
 
     switch (opMode)
     {
+#if (CRYPTO_CONFIG_AES_ECB == 1)
         case CRYPTO_SYM_OPMODE_ECB:
             *mode = MODE_ECB;
             status = CRYPTO_SYM_CIPHER_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_AES_CTR == 1)
         case CRYPTO_SYM_OPMODE_CTR:
             *mode = MODE_CTR;
             status = CRYPTO_SYM_CIPHER_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_AES_XTS == 1)
         case CRYPTO_SYM_OPMODE_XTS:
             *mode = MODE_XTS;
             status = CRYPTO_SYM_CIPHER_SUCCESS;
             break;
+#endif
         default:
             status = CRYPTO_SYM_ERROR_OPMODE;
             break;
@@ -156,7 +206,8 @@ static uint32_t lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(uint32_t dataLen)
     return numOfInvalidBytes;
 }
 /**
- * @brief Common symmetric AES direct-cipher function.
+ * @brief Common symmetric AES direct-cipher function on a given context.
+ * @param aesContext The cleared CAM library context data.
  * @param mode The cipher mode.
  * @param operation The operation type.
  * @param inputData Pointer to input data.
@@ -167,21 +218,15 @@ static uint32_t lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(uint32_t dataLen)
  * @param initVect Pointer to the initialization vector data.
  * @return CRYPTO_SYM_CIPHER_SUCCESS on success, other on failure.
  */
-static crypto_Sym_Status_E lCrypto_Sym_Hw_Aes_Direct(AESCON_MODE mode, AESCON_OPERATION operation,
+static crypto_Sym_Status_E lCrypto_Sym_Hw_Aes_DirectCtx(uint8_t *aesContext,
+    AESCON_MODE mode, AESCON_OPERATION operation,
     uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
     uint8_t *key, uint32_t keyLen, uint8_t *initVect)
 {
-    CRYPTO_AES_HW_CONTEXT aesCtx;
-    register uint8_t *aesContext = aesCtx.contextData;
     crypto_Sym_Status_E result = CRYPTO_SYM_ERROR_CIPFAIL;
-    AES_ERROR aesStatus = AES_INITIALIZE_ERROR;
-    // Context data must be cleared as the context may be on a stack versus static memory.
-    (void)memset(aesContext, 0, sizeof(aesCtx.contextData));
-    aesStatus = DRV_CRYPTO_AES_Initialize(aesContext, mode, operation, key, keyLen, initVect, AES_SYM_INIT_VECTOR_LENGTH);
+    AES_ERROR aesStatus = DRV_CRYPTO_AES_Initialize(aesContext, mode, operation, key, keyLen, initVect, AES_SYM_INIT_VECTOR_LENGTH);
     if(aesStatus == AES_NO_ERROR)
     {
-        lCrypto_Sym_Hw_Aes_InterruptSetup();
-
         if (mode == MODE_XTS)
         {
             aesStatus = DRV_CRYPTO_AES_AddTweakData(aesContext, initVect, AES_SYM_XTS_TWEAK_LENGTH);
@@ -232,6 +277,43 @@ static crypto_Sym_Status_E lCrypto_Sym_Hw_Aes_Direct(AESCON_MODE mode, AESCON_OP
     return result;
 }
 
+/**
+ * @brief Common symmetric AES direct-cipher function; the context is taken
+ *        from the stack, or from the CRYPTO_POOL_AES_HW pool when it has blocks.
+ * @param mode The cipher mode.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @return CRYPTO_SYM_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Sym_Status_E lCrypto_Sym_Hw_Aes_Direct(AESCON_MODE mode, AESCON_OPERATION operation,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect)
+{
+    crypto_Sym_Status_E result = CRYPTO_SYM_ERROR_CIPFAIL;
+#if (CRYPTO_POOL_AES_HW_COUNT > 0U)
+    // Pool blocks are zeroed when acquired.
+    CRYPTO_AES_HW_CONTEXT *ptr_aesCtx = (CRYPTO_AES_HW_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_AES_HW);
+
+    if (ptr_aesCtx != NULL)
+    {
+        result = lCrypto_Sym_Hw_Aes_DirectCtx(ptr_aesCtx->contextData, mode, operation, inputData, dataLen, outData, key, keyLen, initVect);
+        (void)Crypto_Pool_Release(CRYPTO_POOL_AES_HW, ptr_aesCtx);
+    }
+#else
+    CRYPTO_AES_HW_CONTEXT aesCtx;
+
+    // Context data must be cleared as the context may be on a stack versus static memory.
+    (void)memset(aesCtx.contextData, 0, sizeof(aesCtx.contextData));
+    result = lCrypto_Sym_Hw_Aes_DirectCtx(aesCtx.contextData, mode, operation, inputData, dataLen, outData, key, keyLen, initVect);
+#endif
+    return result;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Symmetric Common Interface Implementation
@@ -257,31 +339,39 @@ crypto_Sym_Status_E Crypto_Sym_Hw_Aes_Init(void *aesInitCtx,
     AESCON_MODE mode;
     AESCON_OPERATION operation;
 
-    status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(SYM_AES);
 
-    if(status == CRYPTO_SYM_CIPHER_SUCCESS)
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
     {
-        status = lCrypto_Sym_Hw_Aes_GetOperation(cipherOpType_en, &operation);
-    }
+        status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
 
-    if(status == CRYPTO_SYM_CIPHER_SUCCESS)
-    {
-        // Context data must be cleared as the context may be on a stack versus static memory.
-        (void)memset(aesCtx->contextData, 0, sizeof(aesCtx->contextData));
+        if(status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            status = lCrypto_Sym_Hw_Aes_GetOperation(cipherOpType_en, &operation);
+        }
 
-        aesStatus = DRV_CRYPTO_AES_Initialize(aesCtx->contextData, mode, operation, key, keyLen, initVect, AES_SYM_INIT_VECTOR_LENGTH);
-    }
+        if(status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            // Context data must be cleared as the context may be on a stack versus static memory.
+            (void)memset(aesCtx->contextData, 0, sizeof(aesCtx->contextData));
 
-    if(aesStatus == AES_NO_ERROR)
-    {
-        lCrypto_Sym_Hw_Aes_InterruptSetup();
+            aesStatus = DRV_CRYPTO_AES_Initialize(aesCtx->contextData, mode, operation, key, keyLen, initVect, AES_SYM_INIT_VECTOR_LENGTH);
+        }
+
+        if(aesStatus != AES_NO_ERROR)
+        {
+            status = CRYPTO_SYM_ERROR_CIPFAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
     }
     else
     {
         status = CRYPTO_SYM_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_INIT, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, 0UL, status));
 }
 
 crypto_Sym_Status_E Crypto_Sym_Hw_Aes_Cipher(void *aesCipherCtx,
@@ -299,35 +389,48 @@ crypto_Sym_Status_E Crypto_Sym_Hw_Aes_Cipher(void *aesCipherCtx,
     AES_ERROR aesStatus;
     AES_ERROR aesActive;
 
-    aesStatus = DRV_CRYPTO_AES_IsActive(aesCtx->contextData, &aesActive);
-    if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
-    {
-        /* AES block cipher/decipher only operates upon block-size aligned data.
-         * Since the full input data is being processed as one block, its size
-         * must be aligned to the AES block size. */
-        uint32_t numOfInvalidBytes = lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(dataLen);
-        uint32_t fullBlockLen = dataLen + numOfInvalidBytes;
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_CIPHER, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
 
-        aesStatus = DRV_CRYPTO_AES_AddInputData(aesCtx->contextData, inputData, fullBlockLen);
-        if(aesStatus == AES_NO_ERROR)
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(aesCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
         {
-            aesStatus = DRV_CRYPTO_AES_AddOutputData(aesCtx->contextData, outData, fullBlockLen);
-        }
+            /* AES block cipher/decipher only operates upon block-size aligned data.
+             * Since the full input data is being processed as one block, its size
+             * must be aligned to the AES block size. */
+            uint32_t numOfInvalidBytes = lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(dataLen);
+            uint32_t fullBlockLen = dataLen + numOfInvalidBytes;
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            aesStatus = DRV_CRYPTO_AES_Execute(aesCtx->contextData);
-        }
+            aesStatus = DRV_CRYPTO_AES_AddInputData(aesCtx->contextData, inputData, fullBlockLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddOutputData(aesCtx->contextData, outData, fullBlockLen);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            status = CRYPTO_SYM_CIPHER_SUCCESS;
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_Execute(aesCtx->contextData);
+            }
+
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_SYM_CIPHER_SUCCESS;
+            }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_CIPHER, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
 }
 
+#if (CRYPTO_CONFIG_AES_XTS == 1)
 crypto_Sym_Status_E Crypto_Sym_Hw_AesXts_Cipher(void *aesCipherCtx,
     uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t* tweakData)
 {
@@ -343,44 +446,57 @@ crypto_Sym_Status_E Crypto_Sym_Hw_AesXts_Cipher(void *aesCipherCtx,
     AES_ERROR aesStatus;
     AES_ERROR aesActive;
 
-    aesStatus = DRV_CRYPTO_AES_IsActive(aesCtx->contextData, &aesActive);
-    if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
-    {
-        aesStatus = DRV_CRYPTO_AES_AddTweakData(aesCtx->contextData, tweakData, AES_SYM_XTS_TWEAK_LENGTH);
+    CRYPTO_TRACE_ENTER(SYM_HW_AESXTS_CIPHER, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
 
-        if(aesStatus == AES_NO_ERROR)
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(aesCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
         {
-            /* XTS block cipher accepts the given input data length and the AES driver
-             * automatically pads to the next block size, marking the extra bytes as
-             * invalid. */
-            aesStatus = DRV_CRYPTO_AES_AddInputData(aesCtx->contextData, inputData, dataLen);
-        }
+            aesStatus = DRV_CRYPTO_AES_AddTweakData(aesCtx->contextData, tweakData, AES_SYM_XTS_TWEAK_LENGTH);
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            aesStatus = DRV_CRYPTO_AES_AddOutputData(aesCtx->contextData, outData, dataLen);
-        }
+            if(aesStatus == AES_NO_ERROR)
+            {
+                /* XTS block cipher accepts the given input data length and the AES driver
+                 * automatically pads to the next block size, marking the extra bytes as
+                 * invalid. */
+                aesStatus = DRV_CRYPTO_AES_AddInputData(aesCtx->contextData, inputData, dataLen);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            /* For XTS ciphers, the extra bytes in the output stream must be discarded. */
-            uint32_t numOfDiscardBytes = lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(dataLen);
-            aesStatus = DRV_CRYPTO_AES_DiscardData(aesCtx->contextData, numOfDiscardBytes);
-        }
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddOutputData(aesCtx->contextData, outData, dataLen);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            aesStatus = DRV_CRYPTO_AES_Execute(aesCtx->contextData);
-        }
+            if(aesStatus == AES_NO_ERROR)
+            {
+                /* For XTS ciphers, the extra bytes in the output stream must be discarded. */
+                uint32_t numOfDiscardBytes = lCrypto_Sym_Hw_Aes_GetNumOfInvalidBytes(dataLen);
+                aesStatus = DRV_CRYPTO_AES_DiscardData(aesCtx->contextData, numOfDiscardBytes);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            status = CRYPTO_SYM_CIPHER_SUCCESS;
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_Execute(aesCtx->contextData);
+            }
+
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_SYM_CIPHER_SUCCESS;
+            }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(SYM_HW_AESXTS_CIPHER, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
 }
+#endif /* CRYPTO_CONFIG_AES_XTS == 1 */
 
 crypto_Sym_Status_E Crypto_Sym_Hw_Aes_EncryptDirect(crypto_Sym_OpModes_E opMode_en,
     uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
@@ -390,12 +506,24 @@ crypto_Sym_Status_E Crypto_Sym_Hw_Aes_EncryptDirect(crypto_Sym_OpModes_E opMode_
 
     crypto_Sym_Status_E status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
 
-    if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_ENCRYPTDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
+
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
+    {
+        if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            status = lCrypto_Sym_Hw_Aes_Direct(mode, OP_ENCRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
     {
-        status = lCrypto_Sym_Hw_Aes_Direct(mode, OP_ENCRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_ENCRYPTDIRECT, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
 }
 
 crypto_Sym_Status_E Crypto_Sym_Hw_Aes_DecryptDirect(crypto_Sym_OpModes_E opMode_en,
@@ -406,10 +534,86 @@ crypto_Sym_Status_E Crypto_Sym_Hw_Aes_DecryptDirect(crypto_Sym_OpModes_E opMode_
 
     crypto_Sym_Status_E status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
 
-    if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_DECRYPTDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
+
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
+    {
+        if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            status = lCrypto_Sym_Hw_Aes_Direct(mode, OP_DECRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_DECRYPTDIRECT, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
+}
+
+crypto_Sym_Status_E Crypto_Sym_Hw_Aes_EncryptDirectEx(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace)
+{
+    AESCON_MODE mode;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_HW_CONTEXT *aesCtx = (CRYPTO_AES_HW_CONTEXT*) workspace;
+
+    crypto_Sym_Status_E status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
+
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_ENCRYPTDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
+
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
     {
-        status = lCrypto_Sym_Hw_Aes_Direct(mode, OP_DECRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            (void)memset(aesCtx->contextData, 0, sizeof(aesCtx->contextData));
+            status = lCrypto_Sym_Hw_Aes_DirectCtx(aesCtx->contextData, mode, OP_ENCRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_ENCRYPTDIRECTEX, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
+}
+
+crypto_Sym_Status_E Crypto_Sym_Hw_Aes_DecryptDirectEx(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace)
+{
+    AESCON_MODE mode;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_HW_CONTEXT *aesCtx = (CRYPTO_AES_HW_CONTEXT*) workspace;
+
+    crypto_Sym_Status_E status = lCrypto_Sym_Hw_Aes_GetCipherMode(opMode_en, &mode);
+
+    CRYPTO_TRACE_ENTER(SYM_HW_AES_DECRYPTDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(SYM_AES);
+
+    if (lCrypto_Sym_Hw_Aes_EngineAcquire())
+    {
+        if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+        {
+            (void)memset(aesCtx->contextData, 0, sizeof(aesCtx->contextData));
+            status = lCrypto_Sym_Hw_Aes_DirectCtx(aesCtx->contextData, mode, OP_DECRYPT, inputData, dataLen, outData, key, keyLen, initVect);
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_SYM_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_AES_DECRYPTDIRECTEX, crypto_Sym_Status_E, CRYPTO_STATS_END(SYM_AES, crypto_Sym_Status_E, dataLen, status));
 }
+
+#endif /* CRYPTO_CONFIG_SYM_AES == 1 */
@@ -0,0 +1,85 @@
+/*******************************************************************************
+  Software/CAM Crossover Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_crossover.h
+
+  Summary:
+    This header file provides the software/CAM crossover benchmark of the
+    application.
+
+  Description:
+    test_crossover() runs AES-128-ECB, AES-128-CTR, AES-128-GCM, AES-128-CMAC
+    and SHA-256 through CRYPTO_HANDLER_HW_INTERNAL and
+    CRYPTO_HANDLER_SW_INTERNAL for each payload length of
+    APP_CROSSOVER_LENGTHS, checks that both handlers give the same output and
+    prints the average time of each as CSV. It then prints the
+    CRYPTO_CONFIG_AUTO_*_CROSSOVER values that send to software only the
+    lengths at which software was faster, to copy into crypto_config.h or
+    the project configuration. The benchmark needs CRYPTO_CONFIG_SW_HANDLER
+    set to 1.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_CROSSOVER_H
+#define	APP_CROSSOVER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Calls timed per handler and payload length.
+#ifndef APP_CROSSOVER_ITERATIONS
+#define APP_CROSSOVER_ITERATIONS    (50UL)
+#endif
+
+// Payload lengths measured, in bytes, ascending and multiples of 16 for ECB.
+#ifndef APP_CROSSOVER_LENGTHS
+#define APP_CROSSOVER_LENGTHS       16UL, 32UL, 48UL, 64UL, 96UL, 128UL, 192UL, 256UL, 512UL, 1024UL
+#endif
+
+// Largest payload length of APP_CROSSOVER_LENGTHS.
+#ifndef APP_CROSSOVER_MAX_LENGTH
+#define APP_CROSSOVER_MAX_LENGTH    (1024UL)
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_CROSSOVER_H */
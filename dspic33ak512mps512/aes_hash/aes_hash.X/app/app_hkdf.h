@@ -0,0 +1,84 @@
+/*******************************************************************************
+  HKDF Test and Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_hkdf.h
+
+  Summary:
+    This header file provides the HKDF known-answer test and key derivation
+    benchmark of the application.
+
+  Description:
+    test_hkdf() runs the SHA-256 test cases of RFC 5869 (A.1 to A.3) through
+    Crypto_Kdf_Hkdf_Extract() and Crypto_Kdf_Hkdf_Expand() on the CAM and
+    prints PASS or FAIL for the PRK and the output of each. It then derives
+    APP_HKDF_KEY_COUNT keys of APP_HKDF_KEY_SIZE bytes from one PRK, once
+    with an HMAC that hashes the key pads again for every output block and
+    once with the pad states kept by the HKDF context, checks that both give
+    the same keys and prints the average time of each as CSV.
+*******************************************************************************/
+
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_HKDF_H
+#define	APP_HKDF_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Derivations timed per algorithm and method.
+#ifndef APP_HKDF_ITERATIONS
+#define APP_HKDF_ITERATIONS         (20UL)
+#endif
+
+// Keys derived from one PRK, each with its own label.
+#ifndef APP_HKDF_KEY_COUNT
+#define APP_HKDF_KEY_COUNT          (16UL)
+#endif
+
+// Bytes of each key.
+#ifndef APP_HKDF_KEY_SIZE
+#define APP_HKDF_KEY_SIZE           (32UL)
+#endif
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_HKDF_H */
@@ -0,0 +1,141 @@
+/*******************************************************************************
+  Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_log.h
+
+  Summary:
+    This header file provides the framed binary logging protocol used in place
+    of the text result output when USE_BINARY_LOG is defined.
+
+  Description:
+    Each record is sent on UART1 as a frame:
+
+        +------+------+-----------+-------------------+-----------+
+        | SOF  | TYPE | LENGTH    | PAYLOAD           | CRC16     |
+        | 0xA5 | 1 B  | 2 B (LE)  | LENGTH bytes      | 2 B (LE)  |
+        +------+------+-----------+-------------------+-----------+
+
+    The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) computed over
+    TYPE, LENGTH and PAYLOAD. Plain text printed with printf() may be mixed
+    with frames on the same stream; 0xA5 never occurs in ASCII text so the
+    host decoder (tools/app_log_decoder.c) resynchronizes on the SOF byte
+    and passes everything else through unchanged.
+
+    Payload layouts (multi-byte fields are little-endian):
+      APP_LOG_RECORD_HEX    : labelLen(1) label[labelLen] data[...]
+      APP_LOG_RECORD_STEP   : testMode(1) printSize(1) size(4)
+                              stepLen(1) step[stepLen] opLen(1) op[opLen]
+      APP_LOG_RECORD_RESULT : result(1) status(4, signed)
+      APP_LOG_RECORD_TIMING : tickRateHz(4) ticks(4) labelLen(1) label[labelLen]
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_LOG_H
+#define	APP_LOG_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app_aes_hash.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Start of frame marker.
+#define APP_LOG_SOF                 (0xA5U)
+
+// Largest payload accepted by the host decoder.
+#define APP_LOG_MAX_PAYLOAD         (4096U)
+
+// Labels and step strings are truncated to this length.
+#define APP_LOG_MAX_LABEL           (255U)
+
+/**
+ * @brief Defines the record types carried in a log frame.
+ */
+typedef enum APP_LOG_RECORD_TYPE {
+    APP_LOG_RECORD_HEX = 1,
+    APP_LOG_RECORD_STEP = 2,
+    APP_LOG_RECORD_RESULT = 3,
+    APP_LOG_RECORD_TIMING = 4,
+} APP_LOG_RECORD_TYPE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Emit a labelled byte array record.
+ * @param label A label to apply to the output.
+ * @param data The array data to send.
+ * @param size The length of the data to send.
+ */
+void APP_LOG_HexArray(const char *label, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Emit an operation step record.
+ * @param step String describing the current step.
+ * @param op String describing the current operation type.
+ * @param testMode The test mode.
+ * @param size The data size in bytes.
+ * @param printSize If TRUE, the decoder prints the size.
+ */
+void APP_LOG_OperationStep(const char *step, const char *op, TEST_MODE testMode, uint32_t size, bool printSize);
+
+/**
+ * @brief Emit a test result record.
+ * @param result The test result error code.
+ * @param status The status of the operation.
+ */
+void APP_LOG_Result(TEST_RESULT result, int32_t status);
+
+/**
+ * @brief Emit an elapsed time record.
+ * @param label A label to apply to the output.
+ * @param tickRateHz The tick rate of the timer used for the measurement.
+ * @param ticks The elapsed number of ticks.
+ */
+void APP_LOG_Timing(const char *label, uint32_t tickRateHz, uint32_t ticks);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_LOG_H */
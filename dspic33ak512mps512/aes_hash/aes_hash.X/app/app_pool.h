@@ -0,0 +1,103 @@
+/*******************************************************************************
+  Context Pool Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_pool.h
+
+  Summary:
+    This header file provides the context pool benchmark of the application.
+
+  Description:
+    test_pool() times Crypto_Pool_Acquire()/Crypto_Pool_Release() pairs for
+    every context type whose pool has blocks, and measures the peak stack
+    depth of the one-shot AES, AES-GCM, AES-CMAC and SHA-256 calls by
+    painting the unused stack before each call. Build the project once with
+    the pool counts at 0 and once with CRYPTO_POOL_AES_HW_COUNT,
+    CRYPTO_POOL_AEAD_HW_COUNT, CRYPTO_POOL_CMAC_HW_COUNT and
+    CRYPTO_POOL_HASH_HW_DIGEST_COUNT set, to compare the stack depth before
+    and after the wrapper contexts move to the pools. The same calls are
+    measured again through their *DirectEx() variants, which take the
+    context from one static workspace of APP_POOL_WORKSPACE_SIZE bytes
+    shared by all of them.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_POOL_H
+#define	APP_POOL_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Acquire/release pairs timed per pool.
+#ifndef APP_POOL_BENCH_ITERATIONS
+#define APP_POOL_BENCH_ITERATIONS   (1000UL)
+#endif
+
+// Stack bytes above the stack pointer left unpainted for the painting code.
+#define APP_POOL_STACK_GUARD        (64UL)
+
+// Pattern written to the unused stack.
+#define APP_POOL_STACK_PATTERN      (0xA5C3E187UL)
+
+// Bytes of the workspace shared by the *DirectEx() calls; must cover the
+// largest Crypto_*_WorkspaceSize() of the measured calls.
+#ifndef APP_POOL_WORKSPACE_SIZE
+#define APP_POOL_WORKSPACE_SIZE     (256UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Measure the stack used by a call, including the interrupts taken
+ *        during the call.
+ * @param function The call to measure.
+ * @return The bytes between the stack pointer of the caller and the highest
+ *         stack word written during the call.
+ */
+uint32_t APP_POOL_StackDepth(void (*function)(void));
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_POOL_H */
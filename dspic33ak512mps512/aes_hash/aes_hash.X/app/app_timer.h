@@ -0,0 +1,95 @@
+/*******************************************************************************
+  Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_timer.h
+
+  Summary:
+    This header file provides a free-running timestamp for the application.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_TIMER_H
+#define	APP_TIMER_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Timer1 runs from the standard peripheral clock (100 MHz) with a 1:8
+ * prescaler, giving an 80 ns tick and a 32-bit wrap time of ~343 seconds. */
+#define APP_TIMER_PRESCALER         (8UL)
+#define APP_TIMER_TICK_RATE_HZ      (100000000UL / APP_TIMER_PRESCALER)
+#define APP_TIMER_TICKS_PER_US      (APP_TIMER_TICK_RATE_HZ / 1000000UL)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Start Timer1 as a free-running 32-bit timestamp counter.
+ */
+void APP_TIMER_Initialize(void);
+
+/**
+ * @brief Read the current timestamp.
+ * @return The current Timer1 count, in ticks of APP_TIMER_TICK_RATE_HZ.
+ */
+uint32_t APP_TIMER_Get(void);
+
+/**
+ * @brief Get the number of ticks elapsed since a previous timestamp.
+ * @param start A timestamp previously returned by APP_TIMER_Get().
+ * @return The elapsed ticks (unsigned arithmetic handles a single wrap).
+ */
+uint32_t APP_TIMER_Elapsed(uint32_t start);
+
+/**
+ * @brief Convert a tick count to microseconds.
+ * @param ticks The number of timer ticks.
+ * @return The duration in microseconds.
+ */
+uint32_t APP_TIMER_TicksToUs(uint32_t ticks);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_TIMER_H */
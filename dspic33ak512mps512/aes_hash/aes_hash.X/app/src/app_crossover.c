@@ -0,0 +1,266 @@
+/*******************************************************************************
+  Software/CAM Crossover Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_crossover.c
+
+  Summary:
+    This source file implements the software/CAM crossover benchmark of the
+    application.
+
+  Description:
+    Each measured call goes through the public one-shot API, so the CAM
+    timings include the engine setup and the software timings include the
+    key expansion, as they would for CRYPTO_HANDLER_AUTO. The crossover of an
+    operation is the length after the longest one at which software was
+    faster: lengths below it go to software.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: printf is required for printing to the terminal in this code example
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app_aes_hash.h"
+#include "app/app_crossover.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/common_crypto/crypto_sym_cipher.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+#ifdef RUN_CROSSOVER_TEST
+
+#if (CRYPTO_CONFIG_SW_HANDLER != 1)
+#error "RUN_CROSSOVER_TEST needs CRYPTO_CONFIG_SW_HANDLER set to 1"
+#endif
+
+// Only one test context at a time is supported.
+#define TEST_SESSION_ID     (0x1)
+
+// Bytes of the GCM tag, CMAC and SHA-256 digest.
+#define CROSSOVER_TAG_LEN   (16U)
+#define CROSSOVER_SHA_LEN   (32U)
+
+/**
+ * @brief A measured call: runs the operation on len bytes with a handler and
+ *        writes the output to out.
+ * @return The status of the call, 0 on success.
+ */
+typedef int (*CROSSOVER_CALL)(crypto_HandlerType_E handler, uint32_t len, uint8_t *out);
+
+typedef struct
+{
+    const char *name;       // Operation name printed in the CSV.
+    const char *define;     // Crossover option printed with the result.
+    CROSSOVER_CALL call;
+    bool outPayload;        // The output holds a payload length of data,
+    uint32_t tagLen;        // followed by tagLen bytes of tag or digest.
+    uint32_t configured;    // The crossover the library was built with.
+
+} CROSSOVER_OPERATION;
+
+static const uint32_t crossoverLengths[] = { APP_CROSSOVER_LENGTHS };
+
+// Inputs of the measured calls; the values do not matter.
+static uint8_t crossoverKey[16] __attribute__((aligned(4)));
+static uint8_t crossoverIv[16] __attribute__((aligned(4)));
+static uint8_t crossoverData[APP_CROSSOVER_MAX_LENGTH] __attribute__((aligned(4)));
+
+// Outputs of each handler, with room for the GCM tag after the ciphertext.
+static uint8_t crossoverOutHw[APP_CROSSOVER_MAX_LENGTH + CROSSOVER_TAG_LEN] __attribute__((aligned(4)));
+static uint8_t crossoverOutSw[APP_CROSSOVER_MAX_LENGTH + CROSSOVER_TAG_LEN] __attribute__((aligned(4)));
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Measured Calls
+// *****************************************************************************
+// *****************************************************************************
+
+static int crossoverCallAesEcb(crypto_HandlerType_E handler, uint32_t len, uint8_t *out)
+{
+    return (int)Crypto_Sym_Aes_EncryptDirect(handler, CRYPTO_SYM_OPMODE_ECB,
+        crossoverData, len, out, crossoverKey, sizeof(crossoverKey), NULL, TEST_SESSION_ID);
+}
+
+static int crossoverCallAesCtr(crypto_HandlerType_E handler, uint32_t len, uint8_t *out)
+{
+    return (int)Crypto_Sym_Aes_EncryptDirect(handler, CRYPTO_SYM_OPMODE_CTR,
+        crossoverData, len, out, crossoverKey, sizeof(crossoverKey), crossoverIv, TEST_SESSION_ID);
+}
+
+static int crossoverCallAesGcm(crypto_HandlerType_E handler, uint32_t len, uint8_t *out)
+{
+    return (int)Crypto_Aead_AesGcm_EncryptAuthDirect(handler, crossoverData, len, out,
+        crossoverKey, sizeof(crossoverKey), crossoverIv, 12U, NULL, 0U,
+        &out[len], (uint8_t)CROSSOVER_TAG_LEN, TEST_SESSION_ID);
+}
+
+static int crossoverCallAesCmac(crypto_HandlerType_E handler, uint32_t len, uint8_t *out)
+{
+    return (int)Crypto_Mac_AesCmac_Direct(handler, crossoverData, len, out, CROSSOVER_TAG_LEN,
+        crossoverKey, sizeof(crossoverKey), TEST_SESSION_ID);
+}
+
+static int crossoverCallSha256(crypto_HandlerType_E handler, uint32_t len, uint8_t *out)
+{
+    return (int)Crypto_Hash_Sha_Digest(handler, crossoverData, len, out,
+        CRYPTO_HASH_SHA2_256, TEST_SESSION_ID);
+}
+
+static const CROSSOVER_OPERATION crossoverOperations[] =
+{
+    { "AES-128-ECB",  "CRYPTO_CONFIG_AUTO_AES_CROSSOVER",  crossoverCallAesEcb,  true,  0U,                CRYPTO_CONFIG_AUTO_AES_CROSSOVER },
+    { "AES-128-CTR",  "CRYPTO_CONFIG_AUTO_AES_CROSSOVER",  crossoverCallAesCtr,  true,  0U,                CRYPTO_CONFIG_AUTO_AES_CROSSOVER },
+    { "AES-128-GCM",  "CRYPTO_CONFIG_AUTO_GCM_CROSSOVER",  crossoverCallAesGcm,  true,  CROSSOVER_TAG_LEN, CRYPTO_CONFIG_AUTO_GCM_CROSSOVER },
+    { "AES-128-CMAC", "CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER", crossoverCallAesCmac, false, CROSSOVER_TAG_LEN, CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER },
+    { "SHA-256",      "CRYPTO_CONFIG_AUTO_SHA_CROSSOVER",  crossoverCallSha256,  false, CROSSOVER_SHA_LEN, CRYPTO_CONFIG_AUTO_SHA_CROSSOVER },
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crossover Test Functions
+// *****************************************************************************
+// *****************************************************************************
+
+// Average time of a call in nanoseconds, or 0 when a call fails.
+static uint32_t crossoverTime(CROSSOVER_CALL call, crypto_HandlerType_E handler, uint32_t len, uint8_t *out, int *status)
+{
+    uint32_t start;
+    uint32_t ticks;
+    uint32_t iter;
+
+    *status = call(handler, len, out);
+    if (*status != 0)
+    {
+        return 0U;
+    }
+
+    start = APP_TIMER_Get();
+    for (iter = 0U; iter < APP_CROSSOVER_ITERATIONS; iter++)
+    {
+        (void)call(handler, len, out);
+    }
+    ticks = APP_TIMER_Elapsed(start);
+
+    return (uint32_t)(((uint64_t)ticks * 1000000000ULL) / ((uint64_t)APP_TIMER_TICK_RATE_HZ * APP_CROSSOVER_ITERATIONS));
+}
+
+// Measure one operation at every length; returns the crossover, 0 when software never won.
+static uint32_t crossoverMeasure(const CROSSOVER_OPERATION *op, bool *failed)
+{
+    uint32_t crossover = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(crossoverLengths) / sizeof(crossoverLengths[0])); i++)
+    {
+        uint32_t len = crossoverLengths[i];
+        uint32_t cmpLen = (op->outPayload ? len : 0U) + op->tagLen;
+        uint32_t hwNs;
+        uint32_t swNs;
+        int hwStatus;
+        int swStatus;
+
+        hwNs = crossoverTime(op->call, CRYPTO_HANDLER_HW_INTERNAL, len, crossoverOutHw, &hwStatus);
+        swNs = crossoverTime(op->call, CRYPTO_HANDLER_SW_INTERNAL, len, crossoverOutSw, &swStatus);
+
+        if ((hwStatus != 0) || (swStatus != 0) || !checkArrayEquality(crossoverOutHw, crossoverOutSw, cmpLen))
+        {
+            (void) printf("\r\n" RED "%s,%lu,FAILED,hw %d,sw %d" RESET_COLOR, op->name, len, hwStatus, swStatus);
+            *failed = true;
+        }
+        else
+        {
+            (void) printf("\r\n%s,%lu,%lu,%lu", op->name, len, hwNs, swNs);
+
+            if (swNs < hwNs)
+            {
+                crossover = (i + 1U < (sizeof(crossoverLengths) / sizeof(crossoverLengths[0])))
+                    ? crossoverLengths[i + 1U] : (len + 1U);
+            }
+        }
+    }
+
+    return crossover;
+}
+
+void test_crossover(void)
+{
+    uint32_t crossover[sizeof(crossoverOperations) / sizeof(crossoverOperations[0])];
+    uint32_t aesCrossover;
+    bool failed = false;
+    uint32_t i;
+
+    (void) printf(BLUE "\r\n\r\n Starting software/CAM crossover test\r\n" RESET_COLOR);
+
+    for (i = 0U; i < sizeof(crossoverData); i++)
+    {
+        crossoverData[i] = (uint8_t)i;
+    }
+    for (i = 0U; i < sizeof(crossoverKey); i++)
+    {
+        crossoverKey[i] = (uint8_t)(0xA0U + i);
+        crossoverIv[i] = (uint8_t)(0x50U + i);
+    }
+
+    (void) printf("\r\n\r\noperation,length,hw_ns,sw_ns");
+    for (i = 0U; i < (sizeof(crossoverOperations) / sizeof(crossoverOperations[0])); i++)
+    {
+        crossover[i] = crossoverMeasure(&crossoverOperations[i], &failed);
+    }
+
+    // ECB and CTR share one crossover; keep the larger.
+    aesCrossover = (crossover[0] > crossover[1]) ? crossover[0] : crossover[1];
+    crossover[0] = aesCrossover;
+    crossover[1] = aesCrossover;
+
+    // ECB is skipped: it prints the same option as CTR.
+    (void) printf("\r\n\r\n Suggested crossovers (built with):");
+    for (i = 1U; i < (sizeof(crossoverOperations) / sizeof(crossoverOperations[0])); i++)
+    {
+        (void) printf("\r\n #define %-34s (%luUL)   // (%luUL)", crossoverOperations[i].define,
+            crossover[i], crossoverOperations[i].configured);
+    }
+
+    if (failed)
+    {
+        (void) printf("\r\n\r\n" RED " Software and CAM outputs differ, see FAILED above" RESET_COLOR);
+    }
+    (void) printf("\r\n");
+}
+
+#endif // RUN_CROSSOVER_TEST
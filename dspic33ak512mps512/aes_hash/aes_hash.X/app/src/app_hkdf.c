@@ -0,0 +1,454 @@
+/*******************************************************************************
+  HKDF Test and Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_hkdf.c
+
+  Summary:
+    This source file implements the HKDF known-answer test and key derivation
+    benchmark of the application.
+
+  Description:
+    The benchmark compares two ways of deriving the same keys from one PRK.
+    The rekeyed way computes each HMAC with Crypto_Hash_Sha_Init/Update/Final
+    alone, so it hashes the ipad and opad blocks of the PRK again for every
+    output block: four compressions per block. The cached way sets the PRK
+    once with Crypto_Kdf_Hkdf_Init() and expands every label from the pad
+    states it keeps: two compressions per block.
+*******************************************************************************/
+
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: printf is required for printing to the terminal in this code example
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app_aes_hash.h"
+#include "app/app_hkdf.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+
+#ifdef RUN_HKDF_TEST
+
+#if (CRYPTO_CONFIG_KDF_HKDF != 1)
+#error "RUN_HKDF_TEST needs CRYPTO_CONFIG_KDF_HKDF set to 1"
+#endif
+
+// Only one test context at a time is supported.
+#define TEST_SESSION_ID     (0x1)
+
+#define HKDF_MAX_DIGEST     (64U)
+#define HKDF_MAX_BLOCK      (128U)
+#define HKDF_MAX_LABEL      (16U)
+#define HKDF_MAX_OKM        (82U)
+
+typedef struct
+{
+    const char *name;
+    uint8_t *ikm;
+    uint32_t ikmLen;
+    uint8_t *salt;
+    uint32_t saltLen;
+    uint8_t *info;
+    uint32_t infoLen;
+    uint8_t *prk;
+    uint8_t *okm;
+    uint32_t okmLen;
+
+} HKDF_VECTOR;
+
+typedef struct
+{
+    const char *name;
+    crypto_Hash_Algo_E algorithm;
+    uint32_t blockLen;
+    uint32_t digestLen;
+
+} HKDF_ALGORITHM;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: RFC 5869 Test Vectors
+// *****************************************************************************
+// *****************************************************************************
+
+static uint8_t hkdfIkm1[] =
+{
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B
+};
+
+static uint8_t hkdfSalt1[] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C
+};
+
+static uint8_t hkdfInfo1[] =
+{
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9
+};
+
+static uint8_t hkdfPrk1[] =
+{
+    0x07, 0x77, 0x09, 0x36, 0x2C, 0x2E, 0x32, 0xDF, 0x0D, 0xDC, 0x3F, 0x0D, 0xC4, 0x7B, 0xBA, 0x63,
+    0x90, 0xB6, 0xC7, 0x3B, 0xB5, 0x0F, 0x9C, 0x31, 0x22, 0xEC, 0x84, 0x4A, 0xD7, 0xC2, 0xB3, 0xE5
+};
+
+static uint8_t hkdfOkm1[] =
+{
+    0x3C, 0xB2, 0x5F, 0x25, 0xFA, 0xAC, 0xD5, 0x7A, 0x90, 0x43, 0x4F, 0x64, 0xD0, 0x36, 0x2F, 0x2A,
+    0x2D, 0x2D, 0x0A, 0x90, 0xCF, 0x1A, 0x5A, 0x4C, 0x5D, 0xB0, 0x2D, 0x56, 0xEC, 0xC4, 0xC5, 0xBF,
+    0x34, 0x00, 0x72, 0x08, 0xD5, 0xB8, 0x87, 0x18, 0x58, 0x65
+};
+
+static uint8_t hkdfIkm2[] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F
+};
+
+static uint8_t hkdfSalt2[] =
+{
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF
+};
+
+static uint8_t hkdfInfo2[] =
+{
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+    0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+    0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+static uint8_t hkdfPrk2[] =
+{
+    0x06, 0xA6, 0xB8, 0x8C, 0x58, 0x53, 0x36, 0x1A, 0x06, 0x10, 0x4C, 0x9C, 0xEB, 0x35, 0xB4, 0x5C,
+    0xEF, 0x76, 0x00, 0x14, 0x90, 0x46, 0x71, 0x01, 0x4A, 0x19, 0x3F, 0x40, 0xC1, 0x5F, 0xC2, 0x44
+};
+
+static uint8_t hkdfOkm2[] =
+{
+    0xB1, 0x1E, 0x39, 0x8D, 0xC8, 0x03, 0x27, 0xA1, 0xC8, 0xE7, 0xF7, 0x8C, 0x59, 0x6A, 0x49, 0x34,
+    0x4F, 0x01, 0x2E, 0xDA, 0x2D, 0x4E, 0xFA, 0xD8, 0xA0, 0x50, 0xCC, 0x4C, 0x19, 0xAF, 0xA9, 0x7C,
+    0x59, 0x04, 0x5A, 0x99, 0xCA, 0xC7, 0x82, 0x72, 0x71, 0xCB, 0x41, 0xC6, 0x5E, 0x59, 0x0E, 0x09,
+    0xDA, 0x32, 0x75, 0x60, 0x0C, 0x2F, 0x09, 0xB8, 0x36, 0x77, 0x93, 0xA9, 0xAC, 0xA3, 0xDB, 0x71,
+    0xCC, 0x30, 0xC5, 0x81, 0x79, 0xEC, 0x3E, 0x87, 0xC1, 0x4C, 0x01, 0xD5, 0xC1, 0xF3, 0x43, 0x4F,
+    0x1D, 0x87
+};
+
+static uint8_t hkdfPrk3[] =
+{
+    0x19, 0xEF, 0x24, 0xA3, 0x2C, 0x71, 0x7B, 0x16, 0x7F, 0x33, 0xA9, 0x1D, 0x6F, 0x64, 0x8B, 0xDF,
+    0x96, 0x59, 0x67, 0x76, 0xAF, 0xDB, 0x63, 0x77, 0xAC, 0x43, 0x4C, 0x1C, 0x29, 0x3C, 0xCB, 0x04
+};
+
+static uint8_t hkdfOkm3[] =
+{
+    0x8D, 0xA4, 0xE7, 0x75, 0xA5, 0x63, 0xC1, 0x8F, 0x71, 0x5F, 0x80, 0x2A, 0x06, 0x3C, 0x5A, 0x31,
+    0xB8, 0xA1, 0x1F, 0x5C, 0x5E, 0xE1, 0x87, 0x9E, 0xC3, 0x45, 0x4E, 0x5F, 0x3C, 0x73, 0x8D, 0x2D,
+    0x9D, 0x20, 0x13, 0x95, 0xFA, 0xA4, 0xB6, 0x1A, 0x96, 0xC8
+};
+static const HKDF_VECTOR hkdfVectors[] =
+{
+    { "RFC 5869 A.1", hkdfIkm1, sizeof(hkdfIkm1), hkdfSalt1, sizeof(hkdfSalt1), hkdfInfo1, sizeof(hkdfInfo1), hkdfPrk1, hkdfOkm1, sizeof(hkdfOkm1) },
+    { "RFC 5869 A.2", hkdfIkm2, sizeof(hkdfIkm2), hkdfSalt2, sizeof(hkdfSalt2), hkdfInfo2, sizeof(hkdfInfo2), hkdfPrk2, hkdfOkm2, sizeof(hkdfOkm2) },
+    { "RFC 5869 A.3", hkdfIkm1, sizeof(hkdfIkm1), NULL,      0U,                NULL,      0U,                hkdfPrk3, hkdfOkm3, sizeof(hkdfOkm3) },
+};
+
+static const HKDF_ALGORITHM hkdfAlgorithms[] =
+{
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+    { "SHA-256", CRYPTO_HASH_SHA2_256, 64U,  32U },
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+    { "SHA-384", CRYPTO_HASH_SHA2_384, 128U, 48U },
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+    { "SHA-512", CRYPTO_HASH_SHA2_512, 128U, 64U },
+#endif
+};
+
+static st_Crypto_Kdf_Hkdf_Ctx hkdfCtx __attribute__((aligned(4)));
+static st_Crypto_Hash_Sha_Ctx hmacCtx __attribute__((aligned(4)));
+
+static uint8_t hkdfPrk[HKDF_MAX_DIGEST] __attribute__((aligned(4)));
+static uint8_t hkdfOkm[HKDF_MAX_OKM] __attribute__((aligned(4)));
+
+// Keys of each method, compared after the timing.
+static uint8_t hkdfKeysRekeyed[APP_HKDF_KEY_COUNT][APP_HKDF_KEY_SIZE] __attribute__((aligned(4)));
+static uint8_t hkdfKeysCached[APP_HKDF_KEY_COUNT][APP_HKDF_KEY_SIZE] __attribute__((aligned(4)));
+
+// "channel key <n>", one label per key.
+static uint8_t hkdfLabels[APP_HKDF_KEY_COUNT][HKDF_MAX_LABEL];
+static uint32_t hkdfLabelLens[APP_HKDF_KEY_COUNT];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Rekeyed HMAC
+// *****************************************************************************
+// *****************************************************************************
+
+// HMAC with only the SHA API: the key pads are hashed for every call.
+static crypto_Hash_Status_E hkdfHmacRekeyed(const HKDF_ALGORITHM *algo, uint8_t *key, uint8_t *msg, uint32_t msgLen, uint8_t *mac)
+{
+    uint8_t pad[HKDF_MAX_BLOCK] __attribute__((aligned(4)));
+    crypto_Hash_Status_E status;
+    uint32_t i;
+
+    (void) memset(pad, 0, sizeof(pad));
+    (void) memcpy(pad, key, algo->digestLen);
+    for (i = 0U; i < algo->blockLen; i++)
+    {
+        pad[i] ^= 0x36U;
+    }
+
+    status = Crypto_Hash_Sha_Init(&hmacCtx, algo->algorithm, CRYPTO_HANDLER_HW_INTERNAL, TEST_SESSION_ID);
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Update(&hmacCtx, pad, algo->blockLen);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Update(&hmacCtx, msg, msgLen);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Final(&hmacCtx, mac);
+    }
+
+    for (i = 0U; i < algo->blockLen; i++)
+    {
+        pad[i] ^= (uint8_t)(0x36U ^ 0x5CU);
+    }
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Init(&hmacCtx, algo->algorithm, CRYPTO_HANDLER_HW_INTERNAL, TEST_SESSION_ID);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Update(&hmacCtx, pad, algo->blockLen);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Update(&hmacCtx, mac, algo->digestLen);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Final(&hmacCtx, mac);
+    }
+
+    return status;
+}
+
+// HKDF-Expand of one key with the rekeyed HMAC.
+static crypto_Hash_Status_E hkdfExpandRekeyed(const HKDF_ALGORITHM *algo, uint8_t *prk, uint8_t *info, uint32_t infoLen,
+                                              uint8_t *okm, uint32_t okmLen)
+{
+    uint8_t msg[HKDF_MAX_DIGEST + HKDF_MAX_LABEL + 1U] __attribute__((aligned(4)));
+    uint8_t block[HKDF_MAX_DIGEST] __attribute__((aligned(4)));
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+    uint32_t tLen = 0U;
+    uint32_t done = 0U;
+    uint8_t counter = 0U;
+
+    while ((status == CRYPTO_HASH_SUCCESS) && (done < okmLen))
+    {
+        uint32_t take;
+
+        counter++;
+        (void) memcpy(msg, block, tLen);
+        (void) memcpy(&msg[tLen], info, infoLen);
+        msg[tLen + infoLen] = counter;
+
+        status = hkdfHmacRekeyed(algo, prk, msg, tLen + infoLen + 1U, block);
+        tLen = algo->digestLen;
+
+        take = ((okmLen - done) < tLen) ? (okmLen - done) : tLen;
+        (void) memcpy(&okm[done], block, take);
+        done += take;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: HKDF Test Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static bool hkdfKnownAnswers(void)
+{
+    bool passed = true;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(hkdfVectors) / sizeof(hkdfVectors[0])); i++)
+    {
+        const HKDF_VECTOR *vector = &hkdfVectors[i];
+        crypto_Kdf_Status_E status;
+
+        (void) printf(CYAN "\r\n\r\n %s, SHA-256" RESET_COLOR, vector->name);
+
+        status = Crypto_Kdf_Hkdf_Extract(&hkdfCtx, CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_HASH_SHA2_256,
+            vector->salt, vector->saltLen, vector->ikm, vector->ikmLen, hkdfPrk, TEST_SESSION_ID);
+        if (status == CRYPTO_KDF_SUCCESS)
+        {
+            status = Crypto_Kdf_Hkdf_Expand(&hkdfCtx, vector->info, vector->infoLen, hkdfOkm, vector->okmLen);
+        }
+
+        if (status != CRYPTO_KDF_SUCCESS)
+        {
+            (void) printf(RED "\r\n FAIL - status %d" RESET_COLOR, (int)status);
+            passed = false;
+        }
+        else if (!checkArrayEquality(hkdfPrk, vector->prk, 32U) || !checkArrayEquality(hkdfOkm, vector->okm, vector->okmLen))
+        {
+            (void) printf(RED "\r\n FAIL - Data Mismatch" RESET_COLOR);
+            passed = false;
+        }
+        else
+        {
+            (void) printf(GREEN "\r\n PASS" RESET_COLOR);
+        }
+    }
+
+    return passed;
+}
+
+// Average time of one set of APP_HKDF_KEY_COUNT keys in microseconds, 0 when a call fails.
+static uint32_t hkdfTimeRekeyed(const HKDF_ALGORITHM *algo)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+    uint32_t start = APP_TIMER_Get();
+    uint32_t iter;
+    uint32_t key;
+
+    for (iter = 0U; (iter < APP_HKDF_ITERATIONS) && (status == CRYPTO_HASH_SUCCESS); iter++)
+    {
+        for (key = 0U; (key < APP_HKDF_KEY_COUNT) && (status == CRYPTO_HASH_SUCCESS); key++)
+        {
+            status = hkdfExpandRekeyed(algo, hkdfPrk, hkdfLabels[key], hkdfLabelLens[key],
+                hkdfKeysRekeyed[key], APP_HKDF_KEY_SIZE);
+        }
+    }
+
+    return (status == CRYPTO_HASH_SUCCESS) ? (APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start)) / APP_HKDF_ITERATIONS) : 0U;
+}
+
+static uint32_t hkdfTimeCached(const HKDF_ALGORITHM *algo)
+{
+    crypto_Kdf_Status_E status = CRYPTO_KDF_SUCCESS;
+    uint32_t start = APP_TIMER_Get();
+    uint32_t iter;
+    uint32_t key;
+
+    for (iter = 0U; (iter < APP_HKDF_ITERATIONS) && (status == CRYPTO_KDF_SUCCESS); iter++)
+    {
+        status = Crypto_Kdf_Hkdf_Init(&hkdfCtx, CRYPTO_HANDLER_HW_INTERNAL, algo->algorithm, hkdfPrk, algo->digestLen,
+            TEST_SESSION_ID);
+
+        for (key = 0U; (key < APP_HKDF_KEY_COUNT) && (status == CRYPTO_KDF_SUCCESS); key++)
+        {
+            status = Crypto_Kdf_Hkdf_Expand(&hkdfCtx, hkdfLabels[key], hkdfLabelLens[key],
+                hkdfKeysCached[key], APP_HKDF_KEY_SIZE);
+        }
+    }
+
+    return (status == CRYPTO_KDF_SUCCESS) ? (APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start)) / APP_HKDF_ITERATIONS) : 0U;
+}
+
+void test_hkdf(void)
+{
+    bool failed = false;
+    uint32_t i;
+
+    (void) printf(BLUE "\r\n\r\n Starting HKDF test\r\n" RESET_COLOR);
+
+    failed = !hkdfKnownAnswers();
+
+    for (i = 0U; i < APP_HKDF_KEY_COUNT; i++)
+    {
+        hkdfLabelLens[i] = (uint32_t)snprintf((char *)hkdfLabels[i], HKDF_MAX_LABEL, "channel key %lu", i);
+    }
+
+    (void) printf("\r\n\r\nalgorithm,keys,key_bytes,rekeyed_us,cached_us");
+    for (i = 0U; i < (sizeof(hkdfAlgorithms) / sizeof(hkdfAlgorithms[0])); i++)
+    {
+        const HKDF_ALGORITHM *algo = &hkdfAlgorithms[i];
+        uint32_t rekeyedUs = 0U;
+        uint32_t cachedUs = 0U;
+
+        // The PRK of the RFC 5869 A.1 input keying material, with this algorithm.
+        if (Crypto_Kdf_Hkdf_Extract(&hkdfCtx, CRYPTO_HANDLER_HW_INTERNAL, algo->algorithm, hkdfSalt1, sizeof(hkdfSalt1),
+            hkdfIkm1, sizeof(hkdfIkm1), hkdfPrk, TEST_SESSION_ID) == CRYPTO_KDF_SUCCESS)
+        {
+            rekeyedUs = hkdfTimeRekeyed(algo);
+            cachedUs = hkdfTimeCached(algo);
+        }
+
+        if ((rekeyedUs == 0U) || (cachedUs == 0U) ||
+            (memcmp(hkdfKeysRekeyed, hkdfKeysCached, sizeof(hkdfKeysCached)) != 0))
+        {
+            (void) printf("\r\n" RED "%s,%lu,%lu,FAILED" RESET_COLOR, algo->name, APP_HKDF_KEY_COUNT, APP_HKDF_KEY_SIZE);
+            failed = true;
+        }
+        else
+        {
+            (void) printf("\r\n%s,%lu,%lu,%lu,%lu", algo->name, APP_HKDF_KEY_COUNT, APP_HKDF_KEY_SIZE, rekeyedUs, cachedUs);
+        }
+    }
+
+    (void) memset(&hkdfCtx, 0, sizeof(hkdfCtx));
+
+    if (failed)
+    {
+        (void) printf("\r\n\r\n" RED " HKDF test failed, see FAIL above" RESET_COLOR);
+    }
+    (void) printf("\r\n");
+}
+
+#endif // RUN_HKDF_TEST
@@ -0,0 +1,233 @@
+/*******************************************************************************
+  Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_log.c
+
+  Summary:
+    This source file implements the framed binary logging protocol described
+    in app_log.h.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+/* cppcheck-suppress misra-c2012-21.6
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: stdout is flushed so text printed before a frame is not reordered with it
+*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "app/app_log.h"
+#include "mcc_generated_files/uart/uart1.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define APP_LOG_CRC_INIT            (0xFFFFU)
+#define APP_LOG_CRC_POLY            (0x1021U)
+
+/**
+ * @brief State of the frame currently being transmitted.
+ */
+typedef struct APP_LOG_FRAME {
+    uint16_t crc;
+} APP_LOG_FRAME;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint16_t lAPP_LOG_CrcUpdate(uint16_t crc, uint8_t byte)
+{
+    uint16_t lcrc = crc ^ ((uint16_t)byte << 8);
+
+    for (uint8_t bit = 0U; bit < 8U; bit++)
+    {
+        if ((lcrc & 0x8000U) != 0U)
+        {
+            lcrc = (uint16_t)((lcrc << 1) ^ APP_LOG_CRC_POLY);
+        }
+        else
+        {
+            lcrc = (uint16_t)(lcrc << 1);
+        }
+    }
+
+    return lcrc;
+}
+
+static void lAPP_LOG_PutByte(APP_LOG_FRAME *frame, uint8_t byte)
+{
+    frame->crc = lAPP_LOG_CrcUpdate(frame->crc, byte);
+    UART1_Write(byte);
+}
+
+static void lAPP_LOG_PutBytes(APP_LOG_FRAME *frame, const uint8_t *data, uint32_t size)
+{
+    for (uint32_t index = 0U; index < size; index++)
+    {
+        lAPP_LOG_PutByte(frame, data[index]);
+    }
+}
+
+static void lAPP_LOG_PutU32(APP_LOG_FRAME *frame, uint32_t value)
+{
+    lAPP_LOG_PutByte(frame, (uint8_t)(value));
+    lAPP_LOG_PutByte(frame, (uint8_t)(value >> 8));
+    lAPP_LOG_PutByte(frame, (uint8_t)(value >> 16));
+    lAPP_LOG_PutByte(frame, (uint8_t)(value >> 24));
+}
+
+static void lAPP_LOG_PutString(APP_LOG_FRAME *frame, const char *str, uint8_t len)
+{
+    lAPP_LOG_PutByte(frame, len);
+    lAPP_LOG_PutBytes(frame, (const uint8_t *)str, len);
+}
+
+static uint8_t lAPP_LOG_StringLength(const char *str)
+{
+    size_t len = 0U;
+
+    if (str != NULL)
+    {
+        len = strlen(str);
+    }
+
+    return (len > APP_LOG_MAX_LABEL) ? (uint8_t)APP_LOG_MAX_LABEL : (uint8_t)len;
+}
+
+static void lAPP_LOG_Begin(APP_LOG_FRAME *frame, APP_LOG_RECORD_TYPE type, uint16_t length)
+{
+    // Text still buffered by printf() must reach the UART before the frame.
+    (void) fflush(stdout);
+
+    // The SOF is not covered by the CRC.
+    UART1_Write((uint8_t)APP_LOG_SOF);
+
+    frame->crc = APP_LOG_CRC_INIT;
+    lAPP_LOG_PutByte(frame, (uint8_t)type);
+    lAPP_LOG_PutByte(frame, (uint8_t)length);
+    lAPP_LOG_PutByte(frame, (uint8_t)(length >> 8));
+}
+
+static void lAPP_LOG_End(APP_LOG_FRAME *frame)
+{
+    uint16_t crc = frame->crc;
+
+    UART1_Write((uint8_t)crc);
+    UART1_Write((uint8_t)(crc >> 8));
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void APP_LOG_HexArray(const char *label, const uint8_t *data, uint32_t size)
+{
+    APP_LOG_FRAME frame;
+    uint8_t labelLen = lAPP_LOG_StringLength(label);
+    uint32_t remaining = size;
+    const uint8_t *ldata = data;
+
+    /* Arrays larger than one payload are split into continuation records,
+     * which carry an empty label so the decoder keeps the current line. */
+    do
+    {
+        uint32_t chunk = APP_LOG_MAX_PAYLOAD - 1U - labelLen;
+
+        if (chunk > remaining)
+        {
+            chunk = remaining;
+        }
+
+        lAPP_LOG_Begin(&frame, APP_LOG_RECORD_HEX, (uint16_t)(1U + labelLen + chunk));
+        lAPP_LOG_PutString(&frame, label, labelLen);
+        lAPP_LOG_PutBytes(&frame, ldata, chunk);
+        lAPP_LOG_End(&frame);
+
+        ldata += chunk;
+        remaining -= chunk;
+        labelLen = 0U;
+    } while (remaining > 0U);
+}
+
+void APP_LOG_OperationStep(const char *step, const char *op, TEST_MODE testMode, uint32_t size, bool printSize)
+{
+    APP_LOG_FRAME frame;
+    uint8_t stepLen = lAPP_LOG_StringLength(step);
+    uint8_t opLen = lAPP_LOG_StringLength(op);
+
+    lAPP_LOG_Begin(&frame, APP_LOG_RECORD_STEP, (uint16_t)(8U + stepLen + opLen));
+    lAPP_LOG_PutByte(&frame, (uint8_t)testMode);
+    lAPP_LOG_PutByte(&frame, (true == printSize) ? 1U : 0U);
+    lAPP_LOG_PutU32(&frame, size);
+    lAPP_LOG_PutString(&frame, step, stepLen);
+    lAPP_LOG_PutString(&frame, op, opLen);
+    lAPP_LOG_End(&frame);
+}
+
+void APP_LOG_Result(TEST_RESULT result, int32_t status)
+{
+    APP_LOG_FRAME frame;
+
+    lAPP_LOG_Begin(&frame, APP_LOG_RECORD_RESULT, 5U);
+    lAPP_LOG_PutByte(&frame, (uint8_t)result);
+    lAPP_LOG_PutU32(&frame, (uint32_t)status);
+    lAPP_LOG_End(&frame);
+}
+
+void APP_LOG_Timing(const char *label, uint32_t tickRateHz, uint32_t ticks)
+{
+    APP_LOG_FRAME frame;
+    uint8_t labelLen = lAPP_LOG_StringLength(label);
+
+    lAPP_LOG_Begin(&frame, APP_LOG_RECORD_TIMING, (uint16_t)(9U + labelLen));
+    lAPP_LOG_PutU32(&frame, tickRateHz);
+    lAPP_LOG_PutU32(&frame, ticks);
+    lAPP_LOG_PutString(&frame, label, labelLen);
+    lAPP_LOG_End(&frame);
+}
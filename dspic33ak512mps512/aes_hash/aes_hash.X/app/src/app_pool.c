@@ -0,0 +1,273 @@
+/*******************************************************************************
+  Context Pool Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_pool.c
+
+  Summary:
+    This source file implements the context pool benchmark of the application.
+
+  Description:
+    The stack of the dsPIC33A grows upward from the stack pointer (W15) to
+    the stack limit (SPLIM). Before each measured call the words between the
+    stack pointer and SPLIM are filled with APP_POOL_STACK_PATTERN; after the
+    call the highest word that no longer holds the pattern marks the peak
+    stack depth of the call.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: printf is required for printing to the terminal in this code example
+*/
+#include <stdio.h>
+#include <xc.h>
+
+#include "app_aes_hash.h"
+#include "app/app_pool.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_pool.h"
+#include "crypto/common_crypto/crypto_sym_cipher.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+#ifdef RUN_POOL_TEST
+
+// Only one test context at a time is supported.
+#define TEST_SESSION_ID     (0x1)
+
+// Payload of the one-shot calls measured for stack depth.
+#define POOL_TEST_DATA_LEN  (64U)
+
+static const char * const poolTypeNames[CRYPTO_POOL_TYPE_MAX] =
+{
+    "SYM_BLOCK",
+    "AEAD_AESGCM",
+    "MAC_AESCMAC",
+    "HASH_SHA",
+    "AES_HW",
+    "AEAD_HW",
+    "CMAC_HW",
+    "HASH_HW_DIGEST",
+    "PKE",
+};
+
+// Inputs and outputs of the measured calls; the values do not matter.
+static uint8_t poolKey[16] __attribute__((aligned(4)));
+static uint8_t poolIv[16] __attribute__((aligned(4)));
+static uint8_t poolData[POOL_TEST_DATA_LEN] __attribute__((aligned(4)));
+static uint8_t poolOut[POOL_TEST_DATA_LEN] __attribute__((aligned(4)));
+static uint8_t poolTag[16] __attribute__((aligned(4)));
+
+// Workspace shared by the *DirectEx() calls.
+static uint32_t poolWorkspace[APP_POOL_WORKSPACE_SIZE / sizeof(uint32_t)];
+
+// Status of the last measured call.
+static int poolCallStatus;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Measured Calls
+// *****************************************************************************
+// *****************************************************************************
+
+static void poolCallAesCtr(void)
+{
+    poolCallStatus = (int)Crypto_Sym_Aes_EncryptDirect(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_SYM_OPMODE_CTR,
+        poolData, POOL_TEST_DATA_LEN, poolOut, poolKey, sizeof(poolKey), poolIv, TEST_SESSION_ID);
+}
+
+static void poolCallAesGcm(void)
+{
+    poolCallStatus = (int)Crypto_Aead_AesGcm_EncryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolOut, poolKey, sizeof(poolKey), poolIv, 12U,
+        NULL, 0U, poolTag, (uint8_t)sizeof(poolTag), TEST_SESSION_ID);
+}
+
+static void poolCallAesCmac(void)
+{
+    poolCallStatus = (int)Crypto_Mac_AesCmac_Direct(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolTag, sizeof(poolTag), poolKey, sizeof(poolKey), TEST_SESSION_ID);
+}
+
+static void poolCallSha256(void)
+{
+    poolCallStatus = (int)Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolOut, CRYPTO_HASH_SHA2_256, TEST_SESSION_ID);
+}
+
+static void poolCallAesCtrEx(void)
+{
+    poolCallStatus = (int)Crypto_Sym_Aes_EncryptDirectEx(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_SYM_OPMODE_CTR,
+        poolData, POOL_TEST_DATA_LEN, poolOut, poolKey, sizeof(poolKey), poolIv, TEST_SESSION_ID,
+        poolWorkspace, sizeof(poolWorkspace));
+}
+
+static void poolCallAesGcmEx(void)
+{
+    poolCallStatus = (int)Crypto_Aead_AesGcm_EncryptAuthDirectEx(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolOut, poolKey, sizeof(poolKey), poolIv, 12U,
+        NULL, 0U, poolTag, (uint8_t)sizeof(poolTag), TEST_SESSION_ID,
+        poolWorkspace, sizeof(poolWorkspace));
+}
+
+static void poolCallAesCmacEx(void)
+{
+    poolCallStatus = (int)Crypto_Mac_AesCmac_DirectEx(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolTag, sizeof(poolTag), poolKey, sizeof(poolKey), TEST_SESSION_ID,
+        poolWorkspace, sizeof(poolWorkspace));
+}
+
+static void poolCallSha256Ex(void)
+{
+    poolCallStatus = (int)Crypto_Hash_Sha_DigestEx(CRYPTO_HANDLER_HW_INTERNAL,
+        poolData, POOL_TEST_DATA_LEN, poolOut, CRYPTO_HASH_SHA2_256, TEST_SESSION_ID,
+        poolWorkspace, sizeof(poolWorkspace));
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Pool Test Functions
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t APP_POOL_StackDepth(void (*function)(void))
+{
+    uint32_t stackPointer;
+    volatile uint32_t *word;
+    volatile uint32_t *limit = (volatile uint32_t *)SPLIM;
+    volatile uint32_t *first;
+
+    __asm__ volatile ("mov w15, %0" : "=r"(stackPointer));
+    first = (volatile uint32_t *)(stackPointer + APP_POOL_STACK_GUARD);
+
+    for (word = first; word < limit; word++)
+    {
+        *word = APP_POOL_STACK_PATTERN;
+    }
+
+    function();
+
+    word = limit;
+    while ((word > first) && (word[-1] == APP_POOL_STACK_PATTERN))
+    {
+        word--;
+    }
+
+    return (uint32_t)word - stackPointer;
+}
+
+static void poolBenchmark(void)
+{
+    uint32_t type;
+
+    (void) printf("\r\n\r\n %-16s %10s %7s %14s", "Pool", "Block (B)", "Blocks", "Acq+Rel (ns)");
+
+    for (type = 0U; type < (uint32_t)CRYPTO_POOL_TYPE_MAX; type++)
+    {
+        st_Crypto_Pool_Stats stats;
+
+        (void)Crypto_Pool_Stats_Get((crypto_Pool_Type_E)type, &stats, false);
+        if (stats.blockCount > 0U)
+        {
+            uint32_t start = APP_TIMER_Get();
+            uint32_t ticks;
+            uint32_t iter;
+
+            for (iter = 0U; iter < APP_POOL_BENCH_ITERATIONS; iter++)
+            {
+                void *block = Crypto_Pool_Acquire((crypto_Pool_Type_E)type);
+                (void)Crypto_Pool_Release((crypto_Pool_Type_E)type, block);
+            }
+            ticks = APP_TIMER_Elapsed(start);
+
+            (void) printf("\r\n %-16s %10lu %7u %14lu", poolTypeNames[type], stats.blockSize,
+                stats.blockCount, (uint32_t)(((uint64_t)ticks * 1000000000ULL) / ((uint64_t)APP_TIMER_TICK_RATE_HZ * APP_POOL_BENCH_ITERATIONS)));
+        }
+    }
+}
+
+static void poolStackDepth(const char *name, void (*function)(void))
+{
+    uint32_t depth = APP_POOL_StackDepth(function);
+
+    (void) printf("\r\n %-16s %12lu %8d", name, depth, poolCallStatus);
+}
+
+void test_pool(void)
+{
+    uint32_t type;
+
+    (void) printf(BLUE "\r\n\r\n Starting context pool test\r\n" RESET_COLOR);
+
+#ifdef CRYPTO_POOL_LAZY_ZEROIZE
+    (void) printf("\r\n Released blocks are wiped lazily");
+#else
+    (void) printf("\r\n Released blocks are wiped at release");
+#endif
+
+    poolBenchmark();
+
+    (void) printf("\r\n\r\n %-16s %12s %8s", "One-shot call", "Stack (B)", "Status");
+    poolStackDepth("AES-128-CTR", poolCallAesCtr);
+    poolStackDepth("AES-128-GCM", poolCallAesGcm);
+    poolStackDepth("AES-128-CMAC", poolCallAesCmac);
+    poolStackDepth("SHA-256", poolCallSha256);
+    poolStackDepth("AES-128-CTR Ex", poolCallAesCtrEx);
+    poolStackDepth("AES-128-GCM Ex", poolCallAesGcmEx);
+    poolStackDepth("AES-128-CMAC Ex", poolCallAesCmacEx);
+    poolStackDepth("SHA-256 Ex", poolCallSha256Ex);
+
+    (void) printf("\r\n\r\n %-16s %12s", "Workspace", "Size (B)");
+    (void) printf("\r\n %-16s %12lu", "Shared arena", (uint32_t)sizeof(poolWorkspace));
+    (void) printf("\r\n %-16s %12lu", "AES", Crypto_Sym_Aes_WorkspaceSize(CRYPTO_HANDLER_HW_INTERNAL));
+    (void) printf("\r\n %-16s %12lu", "AES-GCM", Crypto_Aead_AesGcm_WorkspaceSize(CRYPTO_HANDLER_HW_INTERNAL));
+    (void) printf("\r\n %-16s %12lu", "AES-CMAC", Crypto_Mac_AesCmac_WorkspaceSize(CRYPTO_HANDLER_HW_INTERNAL));
+    (void) printf("\r\n %-16s %12lu", "SHA digest", Crypto_Hash_Sha_WorkspaceSize(CRYPTO_HANDLER_HW_INTERNAL));
+
+    (void) printf("\r\n\r\n %-16s %7s %10s %9s", "Pool", "In use", "High water", "Failures");
+    for (type = 0U; type < (uint32_t)CRYPTO_POOL_TYPE_MAX; type++)
+    {
+        st_Crypto_Pool_Stats stats;
+
+        (void)Crypto_Pool_Stats_Get((crypto_Pool_Type_E)type, &stats, false);
+        if (stats.blockCount > 0U)
+        {
+            (void) printf("\r\n %-16s %7u %10u %9lu", poolTypeNames[type], stats.inUse, stats.highWater, stats.failures);
+        }
+    }
+    (void) printf("\r\n");
+}
+
+#endif // RUN_POOL_TEST
@@ -63,8 +63,10 @@ Microchip or any third party.
 #include "app/app_mac.h"
 #include "app/app_aead.h"
 #include "app/app_sha.h"
+#include "app/app_log.h"
 
 #include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_stats.h"
 
 
 // *****************************************************************************
@@ -213,6 +215,9 @@ void printWithLabel(const char* label, const char* format, ...)
 
 void printHexArray(const char* label, void* data, uint32_t size)
 {
+#ifdef USE_BINARY_LOG
+    APP_LOG_HexArray(label, (const uint8_t *) data, size);
+#else
     (void) printf("\r\n %-22s :", label);
 
     if (size > 0U)
@@ -233,11 +238,15 @@ void printHexArray(const char* label, void* data, uint32_t size)
     {
         (void) printf(" None");
     }
+#endif
 }
 
 
 void printOperationStep(const char *step, const char *op, TEST_MODE testMode, uint32_t size, bool printSize)
 {
+#ifdef USE_BINARY_LOG
+    APP_LOG_OperationStep(step, op, testMode, size, printSize);
+#else
     if (true == printSize)
     {
         (void) printf("\r\n %-12s %-8s %-8s OPERATION (%-3lu BYTES)... ", step, op, getTestMode(testMode), size);
@@ -246,11 +255,15 @@ void printOperationStep(const char *step, const char *op, TEST_MODE testMode, ui
     {
         (void) printf("\r\n %-12s %-8s %-8s OPERATION... ", step, op, getTestMode(testMode));
     }
+#endif
 }
 
 
 void printCryptoResult(TEST_RESULT result, int status)
 {
+#ifdef USE_BINARY_LOG
+    APP_LOG_Result(result, (int32_t) status);
+#else
     if (result == TEST_RESULT_SUCCESS)
     {
         (void) printf(GREEN " PASS" RESET_COLOR);
@@ -259,6 +272,7 @@ void printCryptoResult(TEST_RESULT result, int status)
     {
         (void) printf(RED " %s: operation status %d" RESET_COLOR, getTestError(result), status);
     }
+#endif
 }
 
 
@@ -498,6 +512,68 @@ void test_hash(void)
 #error TEST_ITERATIONS CANNOT EXCEED BLOCK_SIZE_ITERATION_COUNT.
 #endif
 
+#ifdef CRYPTO_STATS_ENABLE
+
+static uint32_t statsTicksToUs(uint64_t ticks, uint32_t tickRate)
+{
+    return (tickRate == 0UL) ? 0UL : (uint32_t)((ticks * 1000000ULL) / tickRate);
+}
+
+static uint32_t statsPermille(uint64_t busyTicks, uint64_t elapsedTicks)
+{
+    return (elapsedTicks == 0U) ? 0UL : (uint32_t)((busyTicks * 1000ULL) / elapsedTicks);
+}
+
+// Print how busy each CAM engine was since the counters were last reset.
+static void printEngineUtilization(void)
+{
+    static const char *const engineNames[CRYPTO_STATS_ENGINE_MAX] = {"AES", "HASH", "TRNG", "PKE"};
+    static const char *const algoNames[CRYPTO_STATS_ALGO_MAX] = {
+        "AES", "AES-GCM", "AES-CMAC", "SHA", "TRNG", "ECDSA SIGN", "ECDSA VERIFY", "ECDH"
+    };
+    static st_Crypto_Stats stats;
+
+    if (Crypto_Stats_Get(&stats, false) == CRYPTO_STATS_SUCCESS)
+    {
+        printSeparator(BLUE, '_');
+        (void) printf(BLUE "\r\n\r\n Engine utilization over %lu us" RESET_COLOR "\r\n",
+                      statsTicksToUs(stats.elapsedTicks, stats.tickRate));
+        (void) printf("\r\n %-12s %8s %10s %10s %8s %7s", "ENGINE", "BUSY %", "OPERATIONS", "BYTES", "ERRORS", "PEAK Q");
+
+        for (uint32_t engine = 0U; engine < (uint32_t)CRYPTO_STATS_ENGINE_MAX; engine++)
+        {
+            const st_Crypto_Stats_Counters *counters = &stats.engine[engine];
+            uint32_t permille = statsPermille(counters->busyTicks, stats.elapsedTicks);
+
+            (void) printf("\r\n %-12s %6lu.%lu %10lu %10lu %8lu %7u", engineNames[engine], permille / 10UL, permille % 10UL,
+                          counters->operations, (uint32_t)counters->bytes, counters->errors, counters->peakQueueDepth);
+        }
+
+        (void) printf("\r\n\r\n %-12s %8s %10s %10s %8s %7s", "ALGORITHM", "BUSY us", "OPERATIONS", "BYTES", "ERRORS", "PEAK Q");
+
+        for (uint32_t algo = 0U; algo < (uint32_t)CRYPTO_STATS_ALGO_MAX; algo++)
+        {
+            const st_Crypto_Stats_Counters *counters = &stats.algo[algo];
+
+            if (counters->operations > 0UL)
+            {
+                (void) printf("\r\n %-12s %8lu %10lu %10lu %8lu %7u", algoNames[algo],
+                              statsTicksToUs(counters->busyTicks, stats.tickRate), counters->operations,
+                              (uint32_t)counters->bytes, counters->errors, counters->peakQueueDepth);
+            }
+        }
+
+        (void) printf("\r\n\r\n Interrupts: CRYPTO1 %lu, CRYPTO2 %lu, CRYPTO3 %lu\r\n",
+                      stats.interrupts[0], stats.interrupts[1], stats.interrupts[2]);
+    }
+    else
+    {
+        (void) printf(RED "\r\n\r\n Crypto statistics are not available" RESET_COLOR);
+    }
+}
+
+#endif // CRYPTO_STATS_ENABLE
+
 void test_concurrent(void)
 {
     TEST_CONTEXT symContext;
@@ -513,6 +589,9 @@ void test_concurrent(void)
     // Hash block sizes for iterative testing of arbitrary input sizes.
     const uint32_t blockSizes[] = {BLOCK_SIZE_128, BLOCK_SIZE_64, BLOCK_SIZE_32, BLOCK_SIZE_16, BLOCK_SIZE_13, BLOCK_SIZE_8, BLOCK_SIZE_7};
 
+    // Measure engine usage over the concurrent workload only.
+    Crypto_Stats_Reset();
+
     for (int iter = 0; iter < TEST_ITERATIONS; iter++)
     {
         TEST_RESULT symResult;
@@ -592,5 +671,9 @@ void test_concurrent(void)
             macResult = mac_cmac_test_advance(&macContext);
         }
     }
+
+#ifdef CRYPTO_STATS_ENABLE
+    printEngineUtilization();
+#endif
 }
 #endif
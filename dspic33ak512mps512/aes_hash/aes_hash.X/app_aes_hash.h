@@ -60,10 +60,29 @@ extern "C" {
 #define RUN_HASH_TEST
 #define RUN_CONCURRENT_TEST
 
+/* Uncomment this to benchmark the context pools (crypto_pool.h) and measure
+ * the stack depth of the one-shot calls, see app/app_pool.h. */
+//#define RUN_POOL_TEST
+
+/* Uncomment this to time the software handler against the CAM and find the
+ * CRYPTO_CONFIG_AUTO_*_CROSSOVER values of CRYPTO_HANDLER_AUTO, see
+ * app/app_crossover.h. Needs CRYPTO_CONFIG_SW_HANDLER set to 1. */
+//#define RUN_CROSSOVER_TEST
+
+/* Uncomment this to run the RFC 5869 HKDF vectors and time the derivation of
+ * many keys from one PRK with and without the cached HMAC pads, see
+ * app/app_hkdf.h. */
+//#define RUN_HKDF_TEST
+
 /* Uncomment this to see the test input/result data for each test,
  * or define it as a C macro in the project configuration. */
 //#define SHOW_TEST_DATA
 
+/* Uncomment this to send hex arrays, operation steps and results as framed
+ * binary records (see app/app_log.h) instead of formatted text. Decode the
+ * captured serial stream on the host with tools/app_log_decoder.c. */
+//#define USE_BINARY_LOG
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Type Definitions
@@ -240,6 +259,21 @@ void test_hash(void);
  */
 void test_concurrent(void);
 
+/**
+ * @brief Run the context pool benchmark.
+ */
+void test_pool(void);
+
+/**
+ * @brief Run the software/CAM crossover benchmark.
+ */
+void test_crossover(void);
+
+/**
+ * @brief Run the HKDF test and benchmark.
+ */
+void test_hkdf(void);
+
 
 #ifdef	__cplusplus
 }
@@ -92,6 +92,12 @@ typedef struct{
 
 //SHA-1, SHA-2, SHA-3(Except SHAKE)
 crypto_Hash_Status_E Crypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen, uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en, uint32_t shaSessionId);
+// Bytes of workspace Crypto_Hash_Sha_DigestEx() needs for a handler, 0 when the handler does not support it.
+uint32_t Crypto_Hash_Sha_WorkspaceSize(crypto_HandlerType_E shaHandler_en);
+// As Crypto_Hash_Sha_Digest(), with the context in a caller workspace aligned to CRYPTO_WORKSPACE_ALIGN;
+// returns CRYPTO_HASH_ERROR_CTX for a workspace that is NULL, misaligned or smaller than Crypto_Hash_Sha_WorkspaceSize().
+crypto_Hash_Status_E Crypto_Hash_Sha_DigestEx(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen, uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en, uint32_t shaSessionId,
+                                              void *ptr_workspace, uint32_t workspaceLen);
 crypto_Hash_Status_E Crypto_Hash_Sha_Init(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, crypto_Hash_Algo_E shaAlgorithm_en, crypto_HandlerType_E shaHandler_en, uint32_t shaSessionId);
 crypto_Hash_Status_E Crypto_Hash_Sha_Update(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_data, uint32_t dataLen);
 crypto_Hash_Status_E Crypto_Hash_Sha_Final(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_digest);
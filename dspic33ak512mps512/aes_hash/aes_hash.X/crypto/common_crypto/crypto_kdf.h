@@ -0,0 +1,240 @@
+/*******************************************************************************
+  Crypto Key Derivation Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_kdf.h
+
+  Summary:
+    This header file provides HKDF (RFC 5869) and the ANSI X9.63 KDF on the
+    SHA engine, to derive keys from a shared secret such as an ECDH result.
+
+  Description:
+    Crypto_Kdf_Hkdf_Extract() computes the pseudorandom key (PRK) from the
+    input keying material and a salt, and Crypto_Kdf_Hkdf_Expand() derives
+    output keying material of any length from the PRK and a label (info).
+    Crypto_Kdf_Hkdf_Init() starts from a PRK the application already has.
+
+    HMAC hashes the key XORed with ipad and with opad, one block each, before
+    every message. The context hashes these two blocks once, when the PRK is
+    set, and keeps the two hash states; each HMAC of the expansion starts from
+    a copy of them. Expanding many labels from one PRK, for example a client
+    key, a server key and their IVs, then costs one compression of the inner
+    hash and one of the outer hash per output block, as long as the label
+    fits the block with the previous output block and the padding: 22 bytes
+    for SHA-256, 62 bytes for SHA-384 and 46 bytes for SHA-512.
+
+    A copy only carries on if the handler keeps the whole hash state in the
+    context data. The first key of each handler and algorithm checks this:
+    a copied state and a fresh one run the same message, and the digests
+    must match. When they do not, the context keeps the key block instead
+    and every HMAC hashes the two pad blocks again, two more compressions.
+    Crypto_SelfTest_Run() repeats the check with its HKDF test.
+
+    Crypto_Kdf_X963_Derive() is the KDF of ANSI X9.63 and SEC 1 that ECIES
+    uses: output block i is Hash(Z || i || SharedInfo), with i a 32-bit big
+    endian counter from 1. It hashes the parts in place, one call each, and
+    keeps no state between calls.
+
+    The hashes run through Crypto_Hash_Sha_Init/Update/Final() with the
+    handler given, the CAM for CRYPTO_HANDLER_HW_INTERNAL. The context holds
+    the keyed hash states; clear it once the keys are derived.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_KDF_H
+#define CRYPTO_KDF_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Longest PRK and output block, the SHA-512 digest.
+#define CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE (64)
+
+// Longest hash block, of SHA-384 and SHA-512.
+#define CRYPTO_KDF_HMAC_MAX_BLOCK_SIZE  (128)
+
+typedef enum {
+    CRYPTO_KDF_ERROR_NOTSUPPTED = -127,
+    CRYPTO_KDF_ERROR_CTX = -126,
+    CRYPTO_KDF_ERROR_INPUTDATA = -125,
+    CRYPTO_KDF_ERROR_OUTPUTDATA = -124,
+    CRYPTO_KDF_ERROR_SID = -123,
+    CRYPTO_KDF_ERROR_ALGO = -122,
+    CRYPTO_KDF_ERROR_KEY = -121,
+    CRYPTO_KDF_ERROR_ARG = -120,
+    CRYPTO_KDF_ERROR_HDLR = -119,
+    CRYPTO_KDF_ERROR_FAIL = -118,
+    CRYPTO_KDF_SUCCESS = 0
+}crypto_Kdf_Status_E;
+
+typedef struct{
+    uint32_t kdfSessionId;
+    crypto_Hash_Algo_E kdfAlgo_en;
+    crypto_HandlerType_E kdfHandler_en;
+    uint32_t digestLen;
+    bool keyed;                                 // The pad states hold a PRK
+    bool padCopy;                               // Each HMAC copies the pad states; else it rehashes innerPad
+    st_Crypto_Hash_Sha_Ctx innerPadCtx_st;      // Hash state after (PRK XOR ipad)
+    st_Crypto_Hash_Sha_Ctx outerPadCtx_st;      // Hash state after (PRK XOR opad)
+    st_Crypto_Hash_Sha_Ctx workCtx_st;          // Copy of a pad state being run
+    uint8_t innerPad[CRYPTO_KDF_HMAC_MAX_BLOCK_SIZE] __attribute__((aligned (4)));  // PRK XOR ipad, without padCopy
+}st_Crypto_Kdf_Hkdf_Ctx;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief HKDF-Extract: compute the PRK and set it as the key of the context.
+ * @param ptr_hkdfCtx_st The context.
+ * @param hkdfHandler_en The handler of the hashes.
+ * @param hkdfAlgorithm_en CRYPTO_HASH_SHA1 or a SHA-2 algorithm.
+ * @param ptr_salt The salt, or NULL for none; no salt is a digest of zeros.
+ * @param saltLen Bytes of salt.
+ * @param ptr_ikm The input keying material.
+ * @param ikmLen Bytes of input keying material.
+ * @param ptr_prk Receives the PRK, digest length bytes, or NULL.
+ * @param hkdfSessionId Session ID (maximum of 1).
+ * @return CRYPTO_KDF_SUCCESS, CRYPTO_KDF_ERROR_FAIL when the HKDF self-test
+ *         failed, or the CRYPTO_KDF_ERROR_* of the failed check or hash call.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Extract(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                            crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_salt, uint32_t saltLen,
+                                            uint8_t *ptr_ikm, uint32_t ikmLen, uint8_t *ptr_prk, uint32_t hkdfSessionId);
+
+/**
+ * @brief Crypto_Kdf_Hkdf_Extract() without the self-test gate, for the HKDF
+ *        known-answer test of crypto_selftest.c, which the gate would run
+ *        again.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_ExtractUngated(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                                   crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_salt, uint32_t saltLen,
+                                                   uint8_t *ptr_ikm, uint32_t ikmLen, uint8_t *ptr_prk, uint32_t hkdfSessionId);
+
+/**
+ * @brief Set a PRK computed earlier as the key of the context, to expand
+ *        from it without extracting again.
+ * @param ptr_hkdfCtx_st The context.
+ * @param hkdfHandler_en The handler of the hashes.
+ * @param hkdfAlgorithm_en CRYPTO_HASH_SHA1 or a SHA-2 algorithm.
+ * @param ptr_prk The PRK.
+ * @param prkLen Bytes of PRK, at least the digest length.
+ * @param hkdfSessionId Session ID (maximum of 1).
+ * @return CRYPTO_KDF_SUCCESS, CRYPTO_KDF_ERROR_FAIL when the HKDF self-test
+ *         failed, or the CRYPTO_KDF_ERROR_* of the failed check or hash call.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Init(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                         crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_prk, uint32_t prkLen,
+                                         uint32_t hkdfSessionId);
+
+/**
+ * @brief HKDF-Expand: derive keying material for one label from the PRK of
+ *        the context. The context is left as it was, for the next label.
+ * @param ptr_hkdfCtx_st The context, keyed by Crypto_Kdf_Hkdf_Extract() or
+ *        Crypto_Kdf_Hkdf_Init().
+ * @param ptr_info The label, or NULL for none.
+ * @param infoLen Bytes of label.
+ * @param ptr_okm Receives the output keying material.
+ * @param okmLen Bytes of output, at most 255 times the digest length.
+ * @return CRYPTO_KDF_SUCCESS, or the CRYPTO_KDF_ERROR_* of the failed check
+ *         or hash call.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Expand(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_info, uint32_t infoLen,
+                                           uint8_t *ptr_okm, uint32_t okmLen);
+
+/**
+ * @brief HMAC of a message with the key of the context, the PRK, from the
+ *        cached pad states; for HMAC constructions such as the HMAC-DRBG of
+ *        RFC 6979, keyed with Crypto_Kdf_Hkdf_Init().
+ * @param ptr_hkdfCtx_st The context, keyed by Crypto_Kdf_Hkdf_Extract() or
+ *        Crypto_Kdf_Hkdf_Init().
+ * @param ptr_data The message, or NULL for none.
+ * @param dataLen Bytes of message.
+ * @param ptr_mac Receives the HMAC, digest length bytes; may be the message.
+ * @return CRYPTO_KDF_SUCCESS, or the CRYPTO_KDF_ERROR_* of the failed check
+ *         or hash call.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Mac(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_data, uint32_t dataLen,
+                                        uint8_t *ptr_mac);
+
+/**
+ * @brief Forget the results of the pad state copy checks, so that the next
+ *        key of each handler and algorithm checks again. Crypto_SelfTest_Run()
+ *        calls it before its HKDF test.
+ */
+void Crypto_Kdf_Hkdf_PadCopyReset(void);
+
+/**
+ * @brief ANSI X9.63 KDF: derive keying material from a shared secret and
+ *        shared information.
+ * @param kdfHandler_en The handler of the hashes.
+ * @param kdfAlgorithm_en CRYPTO_HASH_SHA1 or a SHA-2 algorithm.
+ * @param ptr_z The shared secret, for ECDH the X coordinate.
+ * @param zLen Bytes of shared secret.
+ * @param ptr_sharedInfo The shared information, or NULL for none.
+ * @param sharedInfoLen Bytes of shared information.
+ * @param ptr_okm Receives the output keying material, wiped on failure.
+ * @param okmLen Bytes of output.
+ * @param kdfSessionId Session ID (maximum of 1).
+ * @return CRYPTO_KDF_SUCCESS, or the CRYPTO_KDF_ERROR_* of the failed check
+ *         or hash call.
+ */
+crypto_Kdf_Status_E Crypto_Kdf_X963_Derive(crypto_HandlerType_E kdfHandler_en, crypto_Hash_Algo_E kdfAlgorithm_en,
+                                           uint8_t *ptr_z, uint32_t zLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_okm, uint32_t okmLen, uint32_t kdfSessionId);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_KDF_H */
@@ -92,4 +92,17 @@ crypto_Mac_Status_E Crypto_Mac_AesCmac_Final(st_Crypto_Mac_Aes_ctx *ptr_aesCmacC
 crypto_Mac_Status_E Crypto_Mac_AesCmac_Direct(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
                                                 uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID);
 
+/* Bytes of workspace Crypto_Mac_AesCmac_DirectEx() needs for a handler, 0 when
+ * the handler does not support it. */
+uint32_t Crypto_Mac_AesCmac_WorkspaceSize(crypto_HandlerType_E macHandlerType_en);
+
+/* As Crypto_Mac_AesCmac_Direct(), with the CMAC context in a caller workspace
+ * aligned to CRYPTO_WORKSPACE_ALIGN instead of on the stack. The workspace may
+ * be shared by calls that do not overlap. Returns CRYPTO_MAC_ERROR_CTX for a
+ * workspace that is NULL, misaligned or smaller than
+ * Crypto_Mac_AesCmac_WorkspaceSize(). */
+crypto_Mac_Status_E Crypto_Mac_AesCmac_DirectEx(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID,
+                                                void *ptr_workspace, uint32_t workspaceLen);
+
 #endif /* CRYPTO_MAC_CIPHER_H */
\ No newline at end of file
@@ -0,0 +1,324 @@
+/*******************************************************************************
+  Crypto Trace Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_trace.h
+
+  Summary:
+    This header file provides the optional entry/exit trace hooks of the
+    Crypto Library and its CAM hardware wrappers.
+
+  Description:
+    When CRYPTO_TRACE_ENABLE is defined for the project, every Crypto_* API,
+    every Crypto_*_Hw_* wrapper and the CAM interrupt handlers record an entry
+    event (timestamp, function ID, data length) and an exit event (timestamp,
+    function ID, status) in a RAM ring. Events can be recorded from the main
+    line and from interrupts: each writer claims its slot with a single atomic
+    increment and publishes the slot with a sequence number, so no locks or
+    interrupt masking are needed. CRYPTO_TRACE_Read() returns the events in
+    order; the nesting of entry and exit events gives the time spent in each
+    layer.
+
+    The application provides the timestamp through CRYPTO_TRACE_PORT_Timestamp()
+    and CRYPTO_TRACE_PORT_TickRate(). When CRYPTO_TRACE_ENABLE is not defined
+    the hooks expand to nothing and no trace code or data is linked.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_TRACE_H
+#define CRYPTO_TRACE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Number of events kept in the ring; must be a power of two.
+#ifndef CRYPTO_TRACE_DEPTH
+#define CRYPTO_TRACE_DEPTH (256UL)
+#endif
+
+/* Atomically increment the ring head and return its previous value. Override
+ * for toolchains without the GCC __atomic built-ins. */
+#ifndef CRYPTO_TRACE_FETCH_INC
+#define CRYPTO_TRACE_FETCH_INC(ptr) __atomic_fetch_add((ptr), 1UL, __ATOMIC_RELAXED)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum {
+    CRYPTO_TRACE_LAYER_API = 0,     // Crypto_* API: argument checks and dispatch
+    CRYPTO_TRACE_LAYER_HW = 1,      // Crypto_*_Hw_* wrapper, CAM driver and engine
+    CRYPTO_TRACE_LAYER_ISR = 2      // CAM interrupt handlers
+}crypto_Trace_Layer_E;
+
+/* Traced functions: X(ID suffix, function name, layer). The order defines the
+ * ID values; append new entries at the end so host decoders stay compatible. */
+#define CRYPTO_TRACE_ID_LIST(X) \
+    X(SYM_AES_INIT,                 Crypto_Sym_Aes_Init,                    CRYPTO_TRACE_LAYER_API) \
+    X(SYM_AES_CIPHER,               Crypto_Sym_Aes_Cipher,                  CRYPTO_TRACE_LAYER_API) \
+    X(SYM_AESXTS_CIPHER,            Crypto_Sym_AesXts_Cipher,               CRYPTO_TRACE_LAYER_API) \
+    X(SYM_AES_ENCRYPTDIRECT,        Crypto_Sym_Aes_EncryptDirect,           CRYPTO_TRACE_LAYER_API) \
+    X(SYM_AES_DECRYPTDIRECT,        Crypto_Sym_Aes_DecryptDirect,           CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_INIT,             Crypto_Aead_AesGcm_Init,                CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_ADDAADDATA,       Crypto_Aead_AesGcm_AddAadData,          CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_CIPHER,           Crypto_Aead_AesGcm_Cipher,              CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_FINAL,            Crypto_Aead_AesGcm_Final,               CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_ENCRYPTAUTHDIRECT, Crypto_Aead_AesGcm_EncryptAuthDirect,  CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_DECRYPTAUTHDIRECT, Crypto_Aead_AesGcm_DecryptAuthDirect,  CRYPTO_TRACE_LAYER_API) \
+    X(MAC_AESCMAC_INIT,             Crypto_Mac_AesCmac_Init,                CRYPTO_TRACE_LAYER_API) \
+    X(MAC_AESCMAC_CIPHER,           Crypto_Mac_AesCmac_Cipher,              CRYPTO_TRACE_LAYER_API) \
+    X(MAC_AESCMAC_FINAL,            Crypto_Mac_AesCmac_Final,               CRYPTO_TRACE_LAYER_API) \
+    X(MAC_AESCMAC_DIRECT,           Crypto_Mac_AesCmac_Direct,              CRYPTO_TRACE_LAYER_API) \
+    X(HASH_SHA_DIGEST,              Crypto_Hash_Sha_Digest,                 CRYPTO_TRACE_LAYER_API) \
+    X(HASH_SHA_INIT,                Crypto_Hash_Sha_Init,                   CRYPTO_TRACE_LAYER_API) \
+    X(HASH_SHA_UPDATE,              Crypto_Hash_Sha_Update,                 CRYPTO_TRACE_LAYER_API) \
+    X(HASH_SHA_FINAL,               Crypto_Hash_Sha_Final,                  CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_SIGN,          Crypto_DigiSign_Ecdsa_Sign,             CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_VERIFY,        Crypto_DigiSign_Ecdsa_Verify,           CRYPTO_TRACE_LAYER_API) \
+    X(KAS_ECDH_SHAREDSECRET,        Crypto_Kas_Ecdh_SharedSecret,           CRYPTO_TRACE_LAYER_API) \
+    X(RNG_GENERATE,                 Crypto_Rng_Generate,                    CRYPTO_TRACE_LAYER_API) \
+    X(SYM_HW_AES_INIT,              Crypto_Sym_Hw_Aes_Init,                 CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_AES_CIPHER,            Crypto_Sym_Hw_Aes_Cipher,               CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_AESXTS_CIPHER,         Crypto_Sym_Hw_AesXts_Cipher,            CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_AES_ENCRYPTDIRECT,     Crypto_Sym_Hw_Aes_EncryptDirect,        CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_AES_DECRYPTDIRECT,     Crypto_Sym_Hw_Aes_DecryptDirect,        CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_INIT,          Crypto_Aead_Hw_AesGcm_Init,             CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_ADDAADDATA,    Crypto_Aead_Hw_AesGcm_AddAadData,       CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_CIPHER,        Crypto_Aead_Hw_AesGcm_Cipher,           CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_FINAL,         Crypto_Aead_Hw_AesGcm_Final,            CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECT, Crypto_Aead_Hw_AesGcm_EncryptAuthDirect, CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_DECRYPTAUTHDIRECT, Crypto_Aead_Hw_AesGcm_DecryptAuthDirect, CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_CMAC_INIT,             Crypto_Sym_Hw_Cmac_Init,                CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_CMAC_CIPHER,           Crypto_Sym_Hw_Cmac_Cipher,              CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_CMAC_FINAL,            Crypto_Sym_Hw_Cmac_Final,               CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_CMAC_DIRECT,           Crypto_Sym_Hw_Cmac_Direct,              CRYPTO_TRACE_LAYER_HW) \
+    X(HASH_HW_SHA_INIT,             Crypto_Hash_Hw_Sha_Init,                CRYPTO_TRACE_LAYER_HW) \
+    X(HASH_HW_SHA_UPDATE,           Crypto_Hash_Hw_Sha_Update,              CRYPTO_TRACE_LAYER_HW) \
+    X(HASH_HW_SHA_FINAL,            Crypto_Hash_Hw_Sha_Final,               CRYPTO_TRACE_LAYER_HW) \
+    X(HASH_HW_SHA_DIGEST,           Crypto_Hash_Hw_Sha_Digest,              CRYPTO_TRACE_LAYER_HW) \
+    X(DIGISIGN_ECDSA_HW_SIGN,       Crypto_DigiSign_Ecdsa_Hw_Sign,          CRYPTO_TRACE_LAYER_HW) \
+    X(DIGISIGN_ECDSA_HW_VERIFY,     Crypto_DigiSign_Ecdsa_Hw_Verify,        CRYPTO_TRACE_LAYER_HW) \
+    X(KAS_ECDH_HW_SHAREDSECRET,     Crypto_Kas_Ecdh_Hw_SharedSecret,        CRYPTO_TRACE_LAYER_HW) \
+    X(RNG_HW_TRNG_GENERATE,         Crypto_Rng_Hw_Trng_Generate,            CRYPTO_TRACE_LAYER_HW) \
+    X(INT_HW_REGISTER_HANDLER,      Crypto_Int_Hw_Register_Handler,         CRYPTO_TRACE_LAYER_HW) \
+    X(INT_HW_ENABLE,                Crypto_Int_Hw_Enable,                   CRYPTO_TRACE_LAYER_HW) \
+    X(INT_HW_DISABLE,               Crypto_Int_Hw_Disable,                  CRYPTO_TRACE_LAYER_HW) \
+    X(ISR_CRYPTO1,                  _CRYPTO1Interrupt,                      CRYPTO_TRACE_LAYER_ISR) \
+    X(ISR_CRYPTO2,                  _CRYPTO2Interrupt,                      CRYPTO_TRACE_LAYER_ISR) \
+    X(ISR_CRYPTO3,                  _CRYPTO3Interrupt,                      CRYPTO_TRACE_LAYER_ISR) \
+    X(SYM_AES_ENCRYPTDIRECTEX,      Crypto_Sym_Aes_EncryptDirectEx,         CRYPTO_TRACE_LAYER_API) \
+    X(SYM_AES_DECRYPTDIRECTEX,      Crypto_Sym_Aes_DecryptDirectEx,         CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_ENCRYPTAUTHDIRECTEX, Crypto_Aead_AesGcm_EncryptAuthDirectEx, CRYPTO_TRACE_LAYER_API) \
+    X(AEAD_AESGCM_DECRYPTAUTHDIRECTEX, Crypto_Aead_AesGcm_DecryptAuthDirectEx, CRYPTO_TRACE_LAYER_API) \
+    X(MAC_AESCMAC_DIRECTEX,         Crypto_Mac_AesCmac_DirectEx,            CRYPTO_TRACE_LAYER_API) \
+    X(HASH_SHA_DIGESTEX,            Crypto_Hash_Sha_DigestEx,               CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_SIGNEX,        Crypto_DigiSign_Ecdsa_SignEx,           CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_VERIFYEX,      Crypto_DigiSign_Ecdsa_VerifyEx,         CRYPTO_TRACE_LAYER_API) \
+    X(KAS_ECDH_SHAREDSECRETEX,      Crypto_Kas_Ecdh_SharedSecretEx,         CRYPTO_TRACE_LAYER_API) \
+    X(SYM_HW_AES_ENCRYPTDIRECTEX,   Crypto_Sym_Hw_Aes_EncryptDirectEx,      CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_AES_DECRYPTDIRECTEX,   Crypto_Sym_Hw_Aes_DecryptDirectEx,      CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECTEX, Crypto_Aead_Hw_AesGcm_EncryptAuthDirectEx, CRYPTO_TRACE_LAYER_HW) \
+    X(AEAD_HW_AESGCM_DECRYPTAUTHDIRECTEX, Crypto_Aead_Hw_AesGcm_DecryptAuthDirectEx, CRYPTO_TRACE_LAYER_HW) \
+    X(SYM_HW_CMAC_DIRECTEX,         Crypto_Sym_Hw_Cmac_DirectEx,            CRYPTO_TRACE_LAYER_HW) \
+    X(HASH_HW_SHA_DIGESTEX,         Crypto_Hash_Hw_Sha_DigestEx,            CRYPTO_TRACE_LAYER_HW) \
+    X(DIGISIGN_ECDSA_HW_SIGNEX,     Crypto_DigiSign_Ecdsa_Hw_SignEx,        CRYPTO_TRACE_LAYER_HW) \
+    X(DIGISIGN_ECDSA_HW_VERIFYEX,   Crypto_DigiSign_Ecdsa_Hw_VerifyEx,      CRYPTO_TRACE_LAYER_HW) \
+    X(KAS_ECDH_HW_SHAREDSECRETEX,   Crypto_Kas_Ecdh_Hw_SharedSecretEx,      CRYPTO_TRACE_LAYER_HW) \
+    X(INT_HW_REGISTER_COMPLETION,   Crypto_Int_Hw_Register_Completion,      CRYPTO_TRACE_LAYER_HW) \
+    X(KDF_HKDF_EXTRACT,             Crypto_Kdf_Hkdf_Extract,                CRYPTO_TRACE_LAYER_API) \
+    X(KDF_HKDF_INIT,                Crypto_Kdf_Hkdf_Init,                   CRYPTO_TRACE_LAYER_API) \
+    X(KDF_HKDF_EXPAND,              Crypto_Kdf_Hkdf_Expand,                 CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_ECDHE_START,        Crypto_Handshake_Ecdhe_Start,           CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_ECDHE_FINISH,       Crypto_Handshake_Ecdhe_Finish,          CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_ECDHE,              Crypto_Handshake_Ecdhe,                 CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_SESSION_NEXT,       Crypto_Handshake_Session_Next,          CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_POOL_TASK,          Crypto_Handshake_Pool_Task,             CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_KEYPAIR,            Crypto_Handshake_KeyPair,               CRYPTO_TRACE_LAYER_API) \
+    X(HANDSHAKE_AGREE,              Crypto_Handshake_Agree,                 CRYPTO_TRACE_LAYER_API) \
+    X(KDF_X963_DERIVE,              Crypto_Kdf_X963_Derive,                 CRYPTO_TRACE_LAYER_API) \
+    X(ECIES_SEAL,                   Crypto_Ecies_Seal,                      CRYPTO_TRACE_LAYER_API) \
+    X(ECIES_OPEN,                   Crypto_Ecies_Open,                      CRYPTO_TRACE_LAYER_API) \
+    X(KDF_HKDF_MAC,                 Crypto_Kdf_Hkdf_Mac,                    CRYPTO_TRACE_LAYER_API) \
+    X(RFC6979_ECDSA_NONCE,          Crypto_Rfc6979_Ecdsa_Nonce,             CRYPTO_TRACE_LAYER_API) \
+    X(RFC6979_ECDSA_SIGN,           Crypto_Rfc6979_Ecdsa_Sign,              CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_SIGNINIT,      Crypto_DigiSign_Ecdsa_SignInit,         CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_SIGNUPDATE,    Crypto_DigiSign_Ecdsa_SignUpdate,       CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_SIGNFINAL,     Crypto_DigiSign_Ecdsa_SignFinal,        CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_VERIFYINIT,    Crypto_DigiSign_Ecdsa_VerifyInit,       CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_VERIFYUPDATE,  Crypto_DigiSign_Ecdsa_VerifyUpdate,     CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_VERIFYFINAL,   Crypto_DigiSign_Ecdsa_VerifyFinal,      CRYPTO_TRACE_LAYER_API) \
+    X(DIGISIGN_ECDSA_HW_SIGNSTREAM, Crypto_DigiSign_Ecdsa_Hw_SignStream,    CRYPTO_TRACE_LAYER_HW) \
+    X(DIGISIGN_ECDSA_HW_VERIFYSTREAM, Crypto_DigiSign_Ecdsa_Hw_VerifyStream, CRYPTO_TRACE_LAYER_HW) \
+    X(VERIFYCACHE_ECDSA_VERIFY,     Crypto_VerifyCache_Ecdsa_Verify,        CRYPTO_TRACE_LAYER_API)
+
+#define CRYPTO_TRACE_ID_ENUM(id, name, layer) CRYPTO_TRACE_ID_##id,
+
+typedef enum {
+    CRYPTO_TRACE_ID_INVALID = 0,
+    CRYPTO_TRACE_ID_LIST(CRYPTO_TRACE_ID_ENUM)
+    CRYPTO_TRACE_ID_MAX
+}crypto_Trace_Id_E;
+
+// Set in CRYPTO_TRACE_RECORD.id for exit events.
+#define CRYPTO_TRACE_EXIT_FLAG (0x8000U)
+
+/**
+ * @brief One trace event.
+ */
+typedef struct {
+    uint32_t timestamp;     // CRYPTO_TRACE_PORT_Timestamp() at the event
+    uint32_t value;         // Data length on entry, status on exit
+    uint16_t id;            // crypto_Trace_Id_E, with CRYPTO_TRACE_EXIT_FLAG on exit
+    uint16_t seq;           // Publication marker, see crypto_trace.c
+}CRYPTO_TRACE_RECORD;
+
+// Size of one record in CRYPTO_TRACE_Serialize() output.
+#define CRYPTO_TRACE_RECORD_SIZE (10UL)
+
+// Size of the CRYPTO_TRACE_Serialize() header: tick rate and dropped count.
+#define CRYPTO_TRACE_HEADER_SIZE (8UL)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Trace Hooks
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_TRACE_ENABLE
+
+#define CRYPTO_TRACE_ENTER(id, length) \
+    CRYPTO_TRACE_Record((uint16_t)CRYPTO_TRACE_ID_##id, (uint32_t)(length))
+
+/* Wraps the returned status: records the exit event and yields the status
+ * unchanged, so the hook fits any return statement. */
+#define CRYPTO_TRACE_EXIT(id, type, status) \
+    ((type)CRYPTO_TRACE_Exit((uint16_t)CRYPTO_TRACE_ID_##id, (int32_t)(status)))
+
+// Exit hook for functions without a status, such as interrupt handlers.
+#define CRYPTO_TRACE_EXIT_VOID(id) \
+    CRYPTO_TRACE_Record((uint16_t)CRYPTO_TRACE_ID_##id | CRYPTO_TRACE_EXIT_FLAG, 0UL)
+
+#else
+
+#define CRYPTO_TRACE_ENTER(id, length)
+#define CRYPTO_TRACE_EXIT(id, type, status) (status)
+#define CRYPTO_TRACE_EXIT_VOID(id)
+
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_TRACE_ENABLE
+
+/**
+ * @brief Timestamp source for trace events. Provided by the application.
+ * @return A free-running tick count.
+ */
+uint32_t CRYPTO_TRACE_PORT_Timestamp(void);
+
+/**
+ * @brief Tick rate of CRYPTO_TRACE_PORT_Timestamp(). Provided by the application.
+ * @return Ticks per second.
+ */
+uint32_t CRYPTO_TRACE_PORT_TickRate(void);
+
+/**
+ * @brief Record one event. Safe to call from interrupts.
+ * @param id crypto_Trace_Id_E, with CRYPTO_TRACE_EXIT_FLAG for exit events.
+ * @param value Data length on entry, status on exit.
+ */
+void CRYPTO_TRACE_Record(uint16_t id, uint32_t value);
+
+/**
+ * @brief Record an exit event.
+ * @param id crypto_Trace_Id_E.
+ * @param status The status being returned.
+ * @return status, unchanged.
+ */
+int32_t CRYPTO_TRACE_Exit(uint16_t id, int32_t status);
+
+/**
+ * @brief Copy out the events recorded since the previous read, oldest first.
+ *        Only one reader may be active at a time.
+ * @param records Destination array.
+ * @param maxRecords Capacity of the destination array.
+ * @param dropped Incremented by the number of events overwritten before they
+ *        could be read. May be NULL.
+ * @return The number of records copied.
+ */
+uint32_t CRYPTO_TRACE_Read(CRYPTO_TRACE_RECORD *records, uint32_t maxRecords, uint32_t *dropped);
+
+/**
+ * @brief Read events into a little-endian byte stream for host tools:
+ *        a CRYPTO_TRACE_HEADER_SIZE header (tick rate, dropped events)
+ *        followed by CRYPTO_TRACE_RECORD_SIZE records (timestamp, value, id).
+ * @param buffer Destination buffer.
+ * @param size Size of the buffer in bytes.
+ * @return The number of bytes written, or 0 if the buffer cannot hold the header.
+ */
+uint32_t CRYPTO_TRACE_Serialize(uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Discard all recorded events.
+ */
+void CRYPTO_TRACE_Clear(void);
+
+#endif /* CRYPTO_TRACE_ENABLE */
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_TRACE_H */
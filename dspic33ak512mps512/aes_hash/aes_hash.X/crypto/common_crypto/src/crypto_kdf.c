@@ -0,0 +1,769 @@
+/*******************************************************************************
+  Crypto Key Derivation Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_kdf.c
+
+  Summary:
+    This file contains HKDF (RFC 5869) and the ANSI X9.63 KDF on the
+    Crypto_Hash_Sha_* API.
+
+  Description:
+    HMAC is built from two hash contexts keyed once per PRK: the inner one
+    has hashed (PRK XOR ipad) and the outer one (PRK XOR opad). Each HMAC
+    copies them into the work context and runs the message from there. The
+    CAM library context is opaque, so the first key of each handler and
+    algorithm checks that a copy carries on from the same point as the
+    original, and falls back to hashing the pad blocks for every HMAC when
+    it does not. See crypto_kdf.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if (CRYPTO_CONFIG_KDF_HKDF == 1) || (CRYPTO_CONFIG_KDF_X963 == 1)
+
+#if (CRYPTO_CONFIG_HASH_SHA != 1)
+#error "CRYPTO_CONFIG_KDF_HKDF and CRYPTO_CONFIG_KDF_X963 need CRYPTO_CONFIG_HASH_SHA set to 1"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_KDF_SESSION_MAX          (1)
+
+#define CRYPTO_KDF_HMAC_IPAD            (0x36U)
+#define CRYPTO_KDF_HMAC_OPAD            (0x5CU)
+
+// Most output blocks of one expansion; the block counter is one byte.
+#define CRYPTO_KDF_HKDF_MAX_BLOCKS      (255UL)
+
+// Most output blocks of one X9.63 derivation; the counter is 32-bit.
+#define CRYPTO_KDF_X963_MAX_BLOCKS      (0xFFFFFFFEUL)
+
+#if (CRYPTO_CONFIG_KDF_HKDF == 1)
+// Results of the pad state copy check, per handler and algorithm.
+#define CRYPTO_KDF_PADCOPY_UNCHECKED    (0U)
+#define CRYPTO_KDF_PADCOPY_WORKS        (1U)
+#define CRYPTO_KDF_PADCOPY_FAILS        (2U)
+
+static uint8_t kdfPadCopy[CRYPTO_HANDLER_MAX][CRYPTO_HASH_MAX];
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the digest and block lengths of a hash algorithm.
+ * @param hkdfAlgorithm_en The hash algorithm.
+ * @param blockLen Receives the block length.
+ * @return The digest length, 0 for an algorithm that is not built.
+ */
+static uint32_t lCrypto_Kdf_Sizes(crypto_Hash_Algo_E hkdfAlgorithm_en, uint32_t *blockLen)
+{
+    uint32_t digestLen = 0UL;
+
+    *blockLen = 64UL;
+
+    switch(hkdfAlgorithm_en)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            digestLen = 20UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+        case CRYPTO_HASH_SHA2_224:
+            digestLen = 28UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_HASH_SHA2_256:
+            digestLen = 32UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_HASH_SHA2_384:
+            digestLen = 48UL;
+            *blockLen = 128UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_HASH_SHA2_512:
+            digestLen = 64UL;
+            *blockLen = 128UL;
+            break;
+#endif
+        default:
+            digestLen = 0UL;
+            break;
+    }
+
+    return digestLen;
+}
+
+/**
+ * @brief Map the status of a Crypto_Hash_Sha_* call to a KDF status.
+ */
+static crypto_Kdf_Status_E lCrypto_Kdf_HashStatus(crypto_Hash_Status_E hashStatus)
+{
+    crypto_Kdf_Status_E status;
+
+    switch(hashStatus)
+    {
+        case CRYPTO_HASH_SUCCESS:
+            status = CRYPTO_KDF_SUCCESS;
+            break;
+        case CRYPTO_HASH_ERROR_ALGO:
+            status = CRYPTO_KDF_ERROR_ALGO;
+            break;
+        case CRYPTO_HASH_ERROR_HDLR:
+            status = CRYPTO_KDF_ERROR_HDLR;
+            break;
+        default:
+            status = CRYPTO_KDF_ERROR_FAIL;
+            break;
+    }
+
+    return status;
+}
+
+#if (CRYPTO_CONFIG_KDF_HKDF == 1)
+/**
+ * @brief Check the arguments shared by Crypto_Kdf_Hkdf_Extract() and
+ *        Crypto_Kdf_Hkdf_Init().
+ * @return CRYPTO_KDF_SUCCESS with the digest length set in the context.
+ */
+static crypto_Kdf_Status_E lCrypto_Kdf_Hkdf_Setup(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st,
+                                                  crypto_Hash_Algo_E hkdfAlgorithm_en, uint32_t hkdfSessionId)
+{
+    crypto_Kdf_Status_E status = CRYPTO_KDF_SUCCESS;
+    uint32_t blockLen;
+
+    if(CRYPTO_API_CHECK(ptr_hkdfCtx_st == NULL))
+    {
+        status = CRYPTO_KDF_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK( (hkdfSessionId == 0u) || (hkdfSessionId > (uint32_t)CRYPTO_KDF_SESSION_MAX) ))
+    {
+        status = CRYPTO_KDF_ERROR_SID;
+    }
+    else
+    {
+        ptr_hkdfCtx_st->keyed = false;
+        ptr_hkdfCtx_st->kdfSessionId = hkdfSessionId;
+        ptr_hkdfCtx_st->kdfAlgo_en = hkdfAlgorithm_en;
+        ptr_hkdfCtx_st->digestLen = lCrypto_Kdf_Sizes(hkdfAlgorithm_en, &blockLen);
+
+        if (ptr_hkdfCtx_st->digestLen == 0UL)
+        {
+            status = CRYPTO_KDF_ERROR_ALGO;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check, once per handler and algorithm, that a copy of a hash
+ *        context carries on from where the original was: hash a block, copy
+ *        the state, wipe the original, finish the copy on a short message
+ *        and compare with a fresh hash of the block and the message. Uses
+ *        the inner pad and work contexts as scratch.
+ * @param ptr_hkdfCtx_st The context, with its algorithm and handler set;
+ *        receives padCopy.
+ * @param ptr_block The block to hash, blockLen bytes.
+ * @return CRYPTO_HASH_SUCCESS, or the status of the failed hash call.
+ */
+static crypto_Hash_Status_E lCrypto_Kdf_Hkdf_PadCopyCheck(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_block,
+                                                          uint32_t blockLen)
+{
+    uint8_t msg[3] = { 0x61U, 0x62U, 0x63U };
+    uint8_t copied[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    uint8_t fresh[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    st_Crypto_Hash_Sha_Ctx *ptr_orig = &ptr_hkdfCtx_st->innerPadCtx_st;
+    st_Crypto_Hash_Sha_Ctx *ptr_copy = &ptr_hkdfCtx_st->workCtx_st;
+    crypto_Hash_Status_E hashStatus = CRYPTO_HASH_SUCCESS;
+    uint8_t *ptr_result;
+
+    ptr_hkdfCtx_st->padCopy = false;
+
+    if (((uint32_t)ptr_hkdfCtx_st->kdfHandler_en < (uint32_t)CRYPTO_HANDLER_MAX) &&
+        ((uint32_t)ptr_hkdfCtx_st->kdfAlgo_en < (uint32_t)CRYPTO_HASH_MAX))
+    {
+        ptr_result = &kdfPadCopy[ptr_hkdfCtx_st->kdfHandler_en][ptr_hkdfCtx_st->kdfAlgo_en];
+
+        if (*ptr_result == CRYPTO_KDF_PADCOPY_UNCHECKED)
+        {
+            hashStatus = Crypto_Hash_Sha_Init(ptr_orig, ptr_hkdfCtx_st->kdfAlgo_en, ptr_hkdfCtx_st->kdfHandler_en,
+                                              ptr_hkdfCtx_st->kdfSessionId);
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Update(ptr_orig, ptr_block, blockLen);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                *ptr_copy = *ptr_orig;
+                (void)memset(ptr_orig, 0, sizeof(*ptr_orig));
+                hashStatus = Crypto_Hash_Sha_Update(ptr_copy, msg, sizeof(msg));
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Final(ptr_copy, copied);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Init(ptr_orig, ptr_hkdfCtx_st->kdfAlgo_en, ptr_hkdfCtx_st->kdfHandler_en,
+                                                  ptr_hkdfCtx_st->kdfSessionId);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Update(ptr_orig, ptr_block, blockLen);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Update(ptr_orig, msg, sizeof(msg));
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Final(ptr_orig, fresh);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                *ptr_result = (memcmp(copied, fresh, ptr_hkdfCtx_st->digestLen) == 0) ?
+                              CRYPTO_KDF_PADCOPY_WORKS : CRYPTO_KDF_PADCOPY_FAILS;
+            }
+
+            (void)memset(copied, 0, sizeof(copied));
+            (void)memset(fresh, 0, sizeof(fresh));
+            (void)memset(ptr_orig, 0, sizeof(*ptr_orig));
+            (void)memset(ptr_copy, 0, sizeof(*ptr_copy));
+        }
+
+        ptr_hkdfCtx_st->padCopy = (*ptr_result == CRYPTO_KDF_PADCOPY_WORKS);
+    }
+
+    return hashStatus;
+}
+
+/**
+ * @brief Set the HMAC key: hash (key XOR ipad) into the inner pad context
+ *        and (key XOR opad) into the outer one, or keep (key XOR ipad) when
+ *        the pad states cannot be copied.
+ * @param ptr_hkdfCtx_st The context, with its algorithm set.
+ * @param hkdfHandler_en The handler of the hashes.
+ * @param ptr_key The key; a key longer than a block is hashed first.
+ * @param keyLen Bytes of key.
+ * @return CRYPTO_KDF_SUCCESS, or the status of the failed hash call.
+ */
+static crypto_Kdf_Status_E lCrypto_Kdf_Hkdf_Key(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                                uint8_t *ptr_key, uint32_t keyLen)
+{
+    uint8_t pad[CRYPTO_KDF_HMAC_MAX_BLOCK_SIZE] __attribute__((aligned (4)));
+    crypto_Hash_Status_E hashStatus = CRYPTO_HASH_SUCCESS;
+    uint32_t blockLen;
+    uint32_t i;
+
+    (void)lCrypto_Kdf_Sizes(ptr_hkdfCtx_st->kdfAlgo_en, &blockLen);
+    (void)memset(pad, 0, sizeof(pad));
+
+    if (keyLen > blockLen)
+    {
+        hashStatus = Crypto_Hash_Sha_Digest(hkdfHandler_en, ptr_key, keyLen, pad, ptr_hkdfCtx_st->kdfAlgo_en,
+                                            ptr_hkdfCtx_st->kdfSessionId);
+    }
+    else if (keyLen != 0UL)
+    {
+        (void)memcpy(pad, ptr_key, keyLen);
+    }
+    else
+    {
+        // An empty key is a block of zeros.
+    }
+
+    for (i = 0UL; i < blockLen; i++)
+    {
+        pad[i] ^= CRYPTO_KDF_HMAC_IPAD;
+    }
+
+    ptr_hkdfCtx_st->kdfHandler_en = hkdfHandler_en;
+    (void)memset(ptr_hkdfCtx_st->innerPad, 0, sizeof(ptr_hkdfCtx_st->innerPad));
+
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = lCrypto_Kdf_Hkdf_PadCopyCheck(ptr_hkdfCtx_st, pad, blockLen);
+    }
+
+    if ((hashStatus == CRYPTO_HASH_SUCCESS) && !ptr_hkdfCtx_st->padCopy)
+    {
+        (void)memcpy(ptr_hkdfCtx_st->innerPad, pad, blockLen);
+    }
+    else
+    {
+        if (hashStatus == CRYPTO_HASH_SUCCESS)
+        {
+            hashStatus = Crypto_Hash_Sha_Init(&ptr_hkdfCtx_st->innerPadCtx_st, ptr_hkdfCtx_st->kdfAlgo_en, hkdfHandler_en,
+                                              ptr_hkdfCtx_st->kdfSessionId);
+        }
+        if (hashStatus == CRYPTO_HASH_SUCCESS)
+        {
+            hashStatus = Crypto_Hash_Sha_Update(&ptr_hkdfCtx_st->innerPadCtx_st, pad, blockLen);
+        }
+
+        for (i = 0UL; i < blockLen; i++)
+        {
+            pad[i] ^= (uint8_t)(CRYPTO_KDF_HMAC_IPAD ^ CRYPTO_KDF_HMAC_OPAD);
+        }
+
+        if (hashStatus == CRYPTO_HASH_SUCCESS)
+        {
+            hashStatus = Crypto_Hash_Sha_Init(&ptr_hkdfCtx_st->outerPadCtx_st, ptr_hkdfCtx_st->kdfAlgo_en, hkdfHandler_en,
+                                              ptr_hkdfCtx_st->kdfSessionId);
+        }
+        if (hashStatus == CRYPTO_HASH_SUCCESS)
+        {
+            hashStatus = Crypto_Hash_Sha_Update(&ptr_hkdfCtx_st->outerPadCtx_st, pad, blockLen);
+        }
+    }
+
+    (void)memset(pad, 0, sizeof(pad));
+    ptr_hkdfCtx_st->keyed = (hashStatus == CRYPTO_HASH_SUCCESS);
+
+    return lCrypto_Kdf_HashStatus(hashStatus);
+}
+
+/**
+ * @brief Update the work context with a part of the message, if not empty.
+ */
+static crypto_Hash_Status_E lCrypto_Kdf_Hkdf_Update(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_Hash_Status_E hashStatus,
+                                                    uint8_t *ptr_data, uint32_t dataLen)
+{
+    crypto_Hash_Status_E status = hashStatus;
+
+    if ((status == CRYPTO_HASH_SUCCESS) && (dataLen != 0UL))
+    {
+        status = Crypto_Hash_Sha_Update(&ptr_hkdfCtx_st->workCtx_st, ptr_data, dataLen);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Start the work context at the inner or outer pad state: a copy of
+ *        the pad context, or a new hash of the pad block without padCopy.
+ */
+static crypto_Hash_Status_E lCrypto_Kdf_Hkdf_PadStart(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, bool outer)
+{
+    uint8_t pad[CRYPTO_KDF_HMAC_MAX_BLOCK_SIZE] __attribute__((aligned (4)));
+    crypto_Hash_Status_E hashStatus = CRYPTO_HASH_SUCCESS;
+    uint32_t blockLen;
+    uint32_t i;
+
+    if (ptr_hkdfCtx_st->padCopy)
+    {
+        ptr_hkdfCtx_st->workCtx_st = outer ? ptr_hkdfCtx_st->outerPadCtx_st : ptr_hkdfCtx_st->innerPadCtx_st;
+    }
+    else
+    {
+        (void)lCrypto_Kdf_Sizes(ptr_hkdfCtx_st->kdfAlgo_en, &blockLen);
+        (void)memcpy(pad, ptr_hkdfCtx_st->innerPad, blockLen);
+        if (outer)
+        {
+            for (i = 0UL; i < blockLen; i++)
+            {
+                pad[i] ^= (uint8_t)(CRYPTO_KDF_HMAC_IPAD ^ CRYPTO_KDF_HMAC_OPAD);
+            }
+        }
+
+        hashStatus = Crypto_Hash_Sha_Init(&ptr_hkdfCtx_st->workCtx_st, ptr_hkdfCtx_st->kdfAlgo_en,
+                                          ptr_hkdfCtx_st->kdfHandler_en, ptr_hkdfCtx_st->kdfSessionId);
+        if (hashStatus == CRYPTO_HASH_SUCCESS)
+        {
+            hashStatus = Crypto_Hash_Sha_Update(&ptr_hkdfCtx_st->workCtx_st, pad, blockLen);
+        }
+
+        (void)memset(pad, 0, sizeof(pad));
+    }
+
+    return hashStatus;
+}
+
+/**
+ * @brief HMAC of a message of up to three parts with the key of the context,
+ *        starting from copies of the pad states.
+ * @param ptr_hkdfCtx_st The keyed context.
+ * @param ptr_mac Receives the HMAC, digest length bytes; may be one of the parts.
+ * @return CRYPTO_KDF_SUCCESS, or the status of the failed hash call.
+ */
+static crypto_Kdf_Status_E lCrypto_Kdf_Hkdf_Mac(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_part1, uint32_t part1Len,
+                                                uint8_t *ptr_part2, uint32_t part2Len, uint8_t *ptr_part3, uint32_t part3Len,
+                                                uint8_t *ptr_mac)
+{
+    crypto_Hash_Status_E hashStatus;
+
+    hashStatus = lCrypto_Kdf_Hkdf_PadStart(ptr_hkdfCtx_st, false);
+    hashStatus = lCrypto_Kdf_Hkdf_Update(ptr_hkdfCtx_st, hashStatus, ptr_part1, part1Len);
+    hashStatus = lCrypto_Kdf_Hkdf_Update(ptr_hkdfCtx_st, hashStatus, ptr_part2, part2Len);
+    hashStatus = lCrypto_Kdf_Hkdf_Update(ptr_hkdfCtx_st, hashStatus, ptr_part3, part3Len);
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Final(&ptr_hkdfCtx_st->workCtx_st, ptr_mac);
+    }
+
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = lCrypto_Kdf_Hkdf_PadStart(ptr_hkdfCtx_st, true);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Update(&ptr_hkdfCtx_st->workCtx_st, ptr_mac, ptr_hkdfCtx_st->digestLen);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Final(&ptr_hkdfCtx_st->workCtx_st, ptr_mac);
+    }
+
+    return lCrypto_Kdf_HashStatus(hashStatus);
+}
+
+/**
+ * @brief HKDF-Extract, below the self-test gate.
+ */
+static crypto_Kdf_Status_E lCrypto_Kdf_Hkdf_Extract(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                                    crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_salt, uint32_t saltLen,
+                                                    uint8_t *ptr_ikm, uint32_t ikmLen, uint8_t *ptr_prk, uint32_t hkdfSessionId)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en = CRYPTO_KDF_ERROR_NOTSUPPTED;
+    uint8_t prk[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+
+    if(CRYPTO_API_CHECK( (ptr_salt == NULL) && (saltLen != 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_ikm == NULL) && (ikmLen != 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_INPUTDATA;
+    }
+    else
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Setup(ptr_hkdfCtx_st, hkdfAlgorithm_en, hkdfSessionId);
+    }
+
+    if (ret_kdfStat_en == CRYPTO_KDF_SUCCESS)
+    {
+        // PRK = HMAC(salt, IKM); no salt is digest length zeros, the same HMAC key as an empty one.
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Key(ptr_hkdfCtx_st, hkdfHandler_en, ptr_salt, saltLen);
+    }
+    if (ret_kdfStat_en == CRYPTO_KDF_SUCCESS)
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Mac(ptr_hkdfCtx_st, ptr_ikm, ikmLen, NULL, 0UL, NULL, 0UL, prk);
+    }
+    if (ret_kdfStat_en == CRYPTO_KDF_SUCCESS)
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Key(ptr_hkdfCtx_st, hkdfHandler_en, prk, ptr_hkdfCtx_st->digestLen);
+    }
+    if ((ret_kdfStat_en == CRYPTO_KDF_SUCCESS) && (ptr_prk != NULL))
+    {
+        (void)memcpy(ptr_prk, prk, ptr_hkdfCtx_st->digestLen);
+    }
+
+    (void)memset(prk, 0, sizeof(prk));
+
+    return ret_kdfStat_en;
+}
+
+#endif /* CRYPTO_CONFIG_KDF_HKDF == 1 */
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_CONFIG_KDF_HKDF == 1)
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Extract(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                            crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_salt, uint32_t saltLen,
+                                            uint8_t *ptr_ikm, uint32_t ikmLen, uint8_t *ptr_prk, uint32_t hkdfSessionId)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en;
+
+    CRYPTO_TRACE_ENTER(KDF_HKDF_EXTRACT, ikmLen);
+
+    if(!CRYPTO_SELFTEST_REQUIRE(KDF_HKDF))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_FAIL;
+    }
+    else
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Extract(ptr_hkdfCtx_st, hkdfHandler_en, hkdfAlgorithm_en, ptr_salt, saltLen,
+                                                  ptr_ikm, ikmLen, ptr_prk, hkdfSessionId);
+    }
+
+    return CRYPTO_TRACE_EXIT(KDF_HKDF_EXTRACT, crypto_Kdf_Status_E, ret_kdfStat_en);
+}
+
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_ExtractUngated(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                                   crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_salt, uint32_t saltLen,
+                                                   uint8_t *ptr_ikm, uint32_t ikmLen, uint8_t *ptr_prk, uint32_t hkdfSessionId)
+{
+    return lCrypto_Kdf_Hkdf_Extract(ptr_hkdfCtx_st, hkdfHandler_en, hkdfAlgorithm_en, ptr_salt, saltLen,
+                                    ptr_ikm, ikmLen, ptr_prk, hkdfSessionId);
+}
+
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Init(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, crypto_HandlerType_E hkdfHandler_en,
+                                         crypto_Hash_Algo_E hkdfAlgorithm_en, uint8_t *ptr_prk, uint32_t prkLen,
+                                         uint32_t hkdfSessionId)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en = CRYPTO_KDF_ERROR_NOTSUPPTED;
+
+    CRYPTO_TRACE_ENTER(KDF_HKDF_INIT, prkLen);
+
+    if(!CRYPTO_SELFTEST_REQUIRE(KDF_HKDF))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_FAIL;
+    }
+    else
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Setup(ptr_hkdfCtx_st, hkdfAlgorithm_en, hkdfSessionId);
+    }
+
+    if (ret_kdfStat_en == CRYPTO_KDF_SUCCESS)
+    {
+        if(CRYPTO_API_CHECK( (ptr_prk == NULL) || (prkLen < ptr_hkdfCtx_st->digestLen) ))
+        {
+            ret_kdfStat_en = CRYPTO_KDF_ERROR_KEY;
+        }
+        else
+        {
+            ret_kdfStat_en = lCrypto_Kdf_Hkdf_Key(ptr_hkdfCtx_st, hkdfHandler_en, ptr_prk, prkLen);
+        }
+    }
+
+    return CRYPTO_TRACE_EXIT(KDF_HKDF_INIT, crypto_Kdf_Status_E, ret_kdfStat_en);
+}
+
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Expand(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_info, uint32_t infoLen,
+                                           uint8_t *ptr_okm, uint32_t okmLen)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en = CRYPTO_KDF_SUCCESS;
+    uint8_t block[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    uint32_t blockLen = 0UL;
+    uint32_t done = 0UL;
+    uint8_t counter = 0U;
+
+    CRYPTO_TRACE_ENTER(KDF_HKDF_EXPAND, okmLen);
+
+    if(CRYPTO_API_CHECK( (ptr_hkdfCtx_st == NULL) || (!ptr_hkdfCtx_st->keyed) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_info == NULL) && (infoLen != 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_okm == NULL) || (okmLen == 0u) ||
+                              (okmLen > (CRYPTO_KDF_HKDF_MAX_BLOCKS * ptr_hkdfCtx_st->digestLen)) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_OUTPUTDATA;
+    }
+    else
+    {
+        // T(i) = HMAC(PRK, T(i - 1) | info | i), with T(0) empty.
+        while ((ret_kdfStat_en == CRYPTO_KDF_SUCCESS) && (done < okmLen))
+        {
+            uint32_t take;
+
+            counter++;
+            ret_kdfStat_en = lCrypto_Kdf_Hkdf_Mac(ptr_hkdfCtx_st, block, blockLen, ptr_info, infoLen, &counter, 1UL, block);
+            blockLen = ptr_hkdfCtx_st->digestLen;
+
+            take = ((okmLen - done) < blockLen) ? (okmLen - done) : blockLen;
+            if (ret_kdfStat_en == CRYPTO_KDF_SUCCESS)
+            {
+                (void)memcpy(&ptr_okm[done], block, take);
+            }
+            done += take;
+        }
+    }
+
+    (void)memset(block, 0, sizeof(block));
+
+    return CRYPTO_TRACE_EXIT(KDF_HKDF_EXPAND, crypto_Kdf_Status_E, ret_kdfStat_en);
+}
+
+crypto_Kdf_Status_E Crypto_Kdf_Hkdf_Mac(st_Crypto_Kdf_Hkdf_Ctx *ptr_hkdfCtx_st, uint8_t *ptr_data, uint32_t dataLen,
+                                        uint8_t *ptr_mac)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en = CRYPTO_KDF_SUCCESS;
+
+    CRYPTO_TRACE_ENTER(KDF_HKDF_MAC, dataLen);
+
+    if(CRYPTO_API_CHECK( (ptr_hkdfCtx_st == NULL) || (!ptr_hkdfCtx_st->keyed) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_data == NULL) && (dataLen != 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK(ptr_mac == NULL))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_OUTPUTDATA;
+    }
+    else
+    {
+        ret_kdfStat_en = lCrypto_Kdf_Hkdf_Mac(ptr_hkdfCtx_st, ptr_data, dataLen, NULL, 0UL, NULL, 0UL, ptr_mac);
+    }
+
+    return CRYPTO_TRACE_EXIT(KDF_HKDF_MAC, crypto_Kdf_Status_E, ret_kdfStat_en);
+}
+
+void Crypto_Kdf_Hkdf_PadCopyReset(void)
+{
+    (void)memset(kdfPadCopy, 0, sizeof(kdfPadCopy));
+}
+
+#endif /* CRYPTO_CONFIG_KDF_HKDF == 1 */
+
+#if (CRYPTO_CONFIG_KDF_X963 == 1)
+crypto_Kdf_Status_E Crypto_Kdf_X963_Derive(crypto_HandlerType_E kdfHandler_en, crypto_Hash_Algo_E kdfAlgorithm_en,
+                                           uint8_t *ptr_z, uint32_t zLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_okm, uint32_t okmLen, uint32_t kdfSessionId)
+{
+    crypto_Kdf_Status_E ret_kdfStat_en = CRYPTO_KDF_SUCCESS;
+    crypto_Hash_Status_E hashStatus = CRYPTO_HASH_SUCCESS;
+    st_Crypto_Hash_Sha_Ctx shaCtx_st;
+    uint8_t block[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    uint8_t counter[4];
+    uint32_t blockLen;
+    uint32_t digestLen = lCrypto_Kdf_Sizes(kdfAlgorithm_en, &blockLen);
+    uint32_t done = 0UL;
+    uint32_t blocks = 0UL;
+
+    CRYPTO_TRACE_ENTER(KDF_X963_DERIVE, okmLen);
+
+    if(CRYPTO_API_CHECK( (ptr_z == NULL) || (zLen == 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_sharedInfo == NULL) && (sharedInfoLen != 0u) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (kdfSessionId == 0u) || (kdfSessionId > (uint32_t)CRYPTO_KDF_SESSION_MAX) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_SID;
+    }
+    else if(digestLen == 0UL)
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_ALGO;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_okm == NULL) || (okmLen == 0u) ||
+                              (((okmLen - 1UL) / digestLen) >= CRYPTO_KDF_X963_MAX_BLOCKS) ))
+    {
+        ret_kdfStat_en = CRYPTO_KDF_ERROR_OUTPUTDATA;
+    }
+    else
+    {
+        // K(i) = Hash(Z | i | SharedInfo), i 32-bit big endian from 1.
+        while ((hashStatus == CRYPTO_HASH_SUCCESS) && (done < okmLen))
+        {
+            uint32_t take = ((okmLen - done) < digestLen) ? (okmLen - done) : digestLen;
+
+            blocks++;
+            counter[0] = (uint8_t)(blocks >> 24);
+            counter[1] = (uint8_t)(blocks >> 16);
+            counter[2] = (uint8_t)(blocks >> 8);
+            counter[3] = (uint8_t)blocks;
+
+            hashStatus = Crypto_Hash_Sha_Init(&shaCtx_st, kdfAlgorithm_en, kdfHandler_en, kdfSessionId);
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, ptr_z, zLen);
+            }
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, counter, sizeof(counter));
+            }
+            if ((hashStatus == CRYPTO_HASH_SUCCESS) && (sharedInfoLen != 0UL))
+            {
+                hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, ptr_sharedInfo, sharedInfoLen);
+            }
+
+            // A whole block is written in place; only a partial last one goes through the buffer.
+            if ((hashStatus == CRYPTO_HASH_SUCCESS) && (take == digestLen))
+            {
+                hashStatus = Crypto_Hash_Sha_Final(&shaCtx_st, &ptr_okm[done]);
+            }
+            else if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                hashStatus = Crypto_Hash_Sha_Final(&shaCtx_st, block);
+                if (hashStatus == CRYPTO_HASH_SUCCESS)
+                {
+                    (void)memcpy(&ptr_okm[done], block, take);
+                }
+            }
+            else
+            {
+                // The failed call ends the loop.
+            }
+            done += take;
+        }
+
+        ret_kdfStat_en = lCrypto_Kdf_HashStatus(hashStatus);
+        if (ret_kdfStat_en != CRYPTO_KDF_SUCCESS)
+        {
+            (void)memset(ptr_okm, 0, okmLen);
+        }
+    }
+
+    (void)memset(block, 0, sizeof(block));
+    (void)memset(&shaCtx_st, 0, sizeof(shaCtx_st));
+
+    return CRYPTO_TRACE_EXIT(KDF_X963_DERIVE, crypto_Kdf_Status_E, ret_kdfStat_en);
+}
+#endif /* CRYPTO_CONFIG_KDF_X963 == 1 */
+
+#endif /* (CRYPTO_CONFIG_KDF_HKDF == 1) || (CRYPTO_CONFIG_KDF_X963 == 1) */
@@ -53,6 +53,13 @@
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_sym_cipher.h"
 #include "crypto/drivers/wrapper/crypto_sym_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+#include "crypto/drivers/sw/crypto_sym_sw_wrapper.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#endif
+
+#if (CRYPTO_CONFIG_SYM_AES == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -62,6 +69,188 @@
 
 #define CRYPTO_SYM_SESSION_MAX (1)
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+/**
+ * @brief Resolve CRYPTO_HANDLER_AUTO to the handler that runs an operation.
+ * @param handlerType_en The handler asked for; other handlers are returned as they are.
+ * @param opMode_en The cipher mode.
+ * @param dataLen Length of the data, or UINT32_MAX when it is not known yet.
+ * @return CRYPTO_HANDLER_SW_INTERNAL for a mode the software handler has when the
+ *         data is below CRYPTO_CONFIG_AUTO_AES_CROSSOVER or the engine is busy,
+ *         CRYPTO_HANDLER_HW_INTERNAL otherwise.
+ */
+static crypto_HandlerType_E lCrypto_Sym_Aes_AutoHandler(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint32_t dataLen)
+{
+    crypto_HandlerType_E handler = handlerType_en;
+
+    if (handlerType_en == CRYPTO_HANDLER_AUTO)
+    {
+        handler = CRYPTO_HANDLER_HW_INTERNAL;
+
+        if ( ((opMode_en == CRYPTO_SYM_OPMODE_ECB) || (opMode_en == CRYPTO_SYM_OPMODE_CTR))
+            && (CRYPTO_AUTO_AES_BELOW_CROSSOVER(dataLen) || Crypto_Osal_EngineBusy(CRYPTO_OSAL_ENGINE_SYM)) )
+        {
+            handler = CRYPTO_HANDLER_SW_INTERNAL;
+        }
+    }
+
+    return handler;
+}
+
+#define CRYPTO_SYM_AES_HANDLER(handler, mode, len)  lCrypto_Sym_Aes_AutoHandler((handler), (mode), (len))
+#else
+#define CRYPTO_SYM_AES_HANDLER(handler, mode, len)  (handler)
+#endif
+
+static crypto_Sym_Status_E lCrypto_Sym_Aes_EncryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace)
+{
+    crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+
+    if(CRYPTO_API_CHECK( (ptr_inputData == NULL) || (dataLen == 0u) ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK(ptr_outData == NULL))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_OPMODE;
+    }
+    else if(CRYPTO_API_CHECK(ptr_key == NULL))
+	{
+		ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
+	}
+	else if(CRYPTO_API_CHECK(
+            (opMode_en != CRYPTO_SYM_OPMODE_XTS) &&
+            ((keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) ) )) //key length check other than XTS mode
+    {
+       ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
+							(keyLen != (uint32_t) (((uint32_t)CRYPTO_AESKEYSIZE_128)*2UL))
+                            && (keyLen != (uint32_t)(((uint32_t)CRYPTO_AESKEYSIZE_256)*2UL))
+            ))//key length check for XTS mode
+    {
+        ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0u ) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) ))
+    {
+       ret_aesStatus_en =  CRYPTO_SYM_ERROR_SID;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_initVect == NULL)
+            && (opMode_en != CRYPTO_SYM_OPMODE_ECB)
+            ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_IV;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_SYM_AES_HANDLER(handlerType_en, opMode_en, dataLen)))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+                    ret_aesStatus_en = Crypto_Sym_Hw_Aes_EncryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect);
+                }
+                else
+                {
+                    ret_aesStatus_en = Crypto_Sym_Hw_Aes_EncryptDirectEx(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesStatus_en = Crypto_Sym_Sw_Aes_EncryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, ptr_workspace);
+                break;
+#endif
+            default:
+                ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesStatus_en;
+}
+
+static crypto_Sym_Status_E lCrypto_Sym_Aes_DecryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace)
+{
+    crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+
+    if(CRYPTO_API_CHECK( (ptr_inputData == NULL) || (dataLen == 0u) ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK(ptr_outData == NULL))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_OPMODE;
+    }
+    else if(CRYPTO_API_CHECK(
+            (opMode_en != CRYPTO_SYM_OPMODE_XTS) &&
+            ( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) )  )) //key length check other than XTS mode
+    {
+       ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
+                (   (ptr_key == NULL)
+                    ||  ( (keyLen != (uint32_t) (((uint32_t)CRYPTO_AESKEYSIZE_128)*2UL))
+                            && (keyLen != (uint32_t)(((uint32_t)CRYPTO_AESKEYSIZE_256)*2UL)) )
+                )
+            ))//key length check for XTS mode
+    {
+        ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) ))
+    {
+       ret_aesStatus_en =  CRYPTO_SYM_ERROR_SID;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_initVect == NULL)
+            && (opMode_en != CRYPTO_SYM_OPMODE_ECB)
+            ))
+    {
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_IV;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_SYM_AES_HANDLER(handlerType_en, opMode_en, dataLen)))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+                    ret_aesStatus_en = Crypto_Sym_Hw_Aes_DecryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect);
+                }
+                else
+                {
+                    ret_aesStatus_en = Crypto_Sym_Hw_Aes_DecryptDirectEx(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesStatus_en = Crypto_Sym_Sw_Aes_DecryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, ptr_workspace);
+                break;
+#endif
+
+            default:
+                ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesStatus_en;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Function Definitions
@@ -74,123 +263,142 @@ crypto_Sym_Status_E Crypto_Sym_Aes_Init(st_Crypto_Sym_BlockCtx *ptr_aesCtx_st, c
 {
     crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
 
-    if(ptr_aesCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(SYM_AES_INIT, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_aesCtx_st == NULL))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_CTX;
     }
-    else if( (cipherOpType_en <= CRYPTO_CIOP_INVALID) || (cipherOpType_en >= CRYPTO_CIOP_MAX) )
+    else if(CRYPTO_API_CHECK( (cipherOpType_en <= CRYPTO_CIOP_INVALID) || (cipherOpType_en >= CRYPTO_CIOP_MAX) ))
     {
        ret_aesStatus_en =  CRYPTO_SYM_ERROR_CIPOPER;
     }
-    else if( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) )
+    else if(CRYPTO_API_CHECK( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) ))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_OPMODE;
     }
-    else if(
+    else if(CRYPTO_API_CHECK(
             (opMode_en != CRYPTO_SYM_OPMODE_XTS) &&
-            ( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) )  ) //key length check other than XTS mode
+            ( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) )  )) //key length check other than XTS mode
     {
        ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
     }
-    else if( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
+    else if(CRYPTO_API_CHECK( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
                 (   (ptr_key == NULL)
                     ||  ( (keyLen != (uint32_t) (((uint32_t)CRYPTO_AESKEYSIZE_128)*2UL))
                             && (keyLen != (uint32_t)(((uint32_t)CRYPTO_AESKEYSIZE_256)*2UL)) )
                 )
-            )//key length check for XTS mode
+            ))//key length check for XTS mode
     {
         ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
     }
-    else if( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) )
+    else if(CRYPTO_API_CHECK( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) ))
     {
        ret_aesStatus_en =  CRYPTO_SYM_ERROR_SID;
     }
-    else if( (ptr_initVect == NULL)
+    else if(CRYPTO_API_CHECK( (ptr_initVect == NULL)
             && (opMode_en != CRYPTO_SYM_OPMODE_ECB)
             && (opMode_en != CRYPTO_SYM_OPMODE_XTS)
-            )
+            ))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_IV;
     }
     else
     {
         ptr_aesCtx_st->cryptoSessionID =  sessionID;
-        ptr_aesCtx_st->symHandlerType_en = handlerType_en;
+        // CRYPTO_HANDLER_AUTO is settled here for the whole stream; its length is not known yet.
+        ptr_aesCtx_st->symHandlerType_en = CRYPTO_SYM_AES_HANDLER(handlerType_en, opMode_en, UINT32_MAX);
         ptr_aesCtx_st->ptr_initVect = ptr_initVect;
         ptr_aesCtx_st->ptr_key = ptr_key;
         ptr_aesCtx_st->symAlgoMode_en = opMode_en;
         ptr_aesCtx_st->symKeySize = keyLen;
         ptr_aesCtx_st->symCipherOper_en = cipherOpType_en;
 
-        switch(ptr_aesCtx_st->symHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCtx_st->symHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesStatus_en = Crypto_Sym_Hw_Aes_Init((void*)ptr_aesCtx_st->arr_symDataCtx, ptr_aesCtx_st->symCipherOper_en, ptr_aesCtx_st->symAlgoMode_en,
                                                                     ptr_aesCtx_st->ptr_key, ptr_aesCtx_st->symKeySize, ptr_aesCtx_st->ptr_initVect);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesStatus_en = Crypto_Sym_Sw_Aes_Init((void*)ptr_aesCtx_st->arr_symDataCtx, ptr_aesCtx_st->symCipherOper_en, ptr_aesCtx_st->symAlgoMode_en,
+                                                                    ptr_aesCtx_st->ptr_key, ptr_aesCtx_st->symKeySize, ptr_aesCtx_st->ptr_initVect);
+                break;
+#endif
             default:
                 ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
                 break;
         }
 
     }
-    return ret_aesStatus_en;
+    return CRYPTO_TRACE_EXIT(SYM_AES_INIT, crypto_Sym_Status_E, ret_aesStatus_en);
 }
 
 crypto_Sym_Status_E Crypto_Sym_Aes_Cipher(st_Crypto_Sym_BlockCtx *ptr_aesCtx_st, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData)
 {
     crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
 
-    if(ptr_aesCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(SYM_AES_CIPHER, dataLen);
+
+    if(CRYPTO_API_CHECK(ptr_aesCtx_st == NULL))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_CTX;
     }
-    else if( (ptr_inputData == NULL) || (dataLen == 0u) )
+    else if(CRYPTO_API_CHECK( (ptr_inputData == NULL) || (dataLen == 0u) ))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_INPUTDATA;
     }
-    else if(ptr_outData == NULL)
+    else if(CRYPTO_API_CHECK(ptr_outData == NULL))
     {
         ret_aesStatus_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
     }
     else
     {
-        switch(ptr_aesCtx_st->symHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCtx_st->symHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesStatus_en = Crypto_Sym_Hw_Aes_Cipher((void*)ptr_aesCtx_st->arr_symDataCtx, ptr_inputData, dataLen, ptr_outData);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesStatus_en = Crypto_Sym_Sw_Aes_Cipher((void*)ptr_aesCtx_st->arr_symDataCtx, ptr_inputData, dataLen, ptr_outData);
+                break;
+#endif
             default:
                 ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
                 break;
         }
     }
-    return ret_aesStatus_en;
+    return CRYPTO_TRACE_EXIT(SYM_AES_CIPHER, crypto_Sym_Status_E, ret_aesStatus_en);
 }
 
+#if (CRYPTO_CONFIG_AES_XTS == 1)
 crypto_Sym_Status_E Crypto_Sym_AesXts_Cipher(st_Crypto_Sym_BlockCtx *ptr_aesCtx_st, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_tweak)
 {
     crypto_Sym_Status_E ret_aesXtsStat_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
 
-    if(ptr_aesCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(SYM_AESXTS_CIPHER, dataLen);
+
+    if(CRYPTO_API_CHECK(ptr_aesCtx_st == NULL))
     {
         ret_aesXtsStat_en = CRYPTO_SYM_ERROR_CTX;
     }
-    else if( (ptr_inputData == NULL) || (dataLen == 0u) )
+    else if(CRYPTO_API_CHECK( (ptr_inputData == NULL) || (dataLen == 0u) ))
     {
         ret_aesXtsStat_en = CRYPTO_SYM_ERROR_INPUTDATA;
     }
-    else if( (ptr_outData == NULL) )
+    else if(CRYPTO_API_CHECK( (ptr_outData == NULL) ))
     {
         ret_aesXtsStat_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
     }
-    else if(ptr_tweak == NULL)
+    else if(CRYPTO_API_CHECK(ptr_tweak == NULL))
     {
         ret_aesXtsStat_en = CRYPTO_SYM_ERROR_ARG;
     }
     else
     {
-        switch(ptr_aesCtx_st->symHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCtx_st->symHandlerType_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_aesXtsStat_en = Crypto_Sym_Hw_AesXts_Cipher(ptr_aesCtx_st->arr_symDataCtx, ptr_inputData, dataLen, ptr_outData, ptr_tweak);
@@ -200,123 +408,90 @@ crypto_Sym_Status_E Crypto_Sym_AesXts_Cipher(st_Crypto_Sym_BlockCtx *ptr_aesCtx_
                 break;
         }
     }
-    return ret_aesXtsStat_en;
+    return CRYPTO_TRACE_EXIT(SYM_AESXTS_CIPHER, crypto_Sym_Status_E, ret_aesXtsStat_en);
 }
+#endif /* CRYPTO_CONFIG_AES_XTS == 1 */
 
-crypto_Sym_Status_E Crypto_Sym_Aes_EncryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
-                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID)
+uint32_t Crypto_Sym_Aes_WorkspaceSize(crypto_HandlerType_E handlerType_en)
 {
-    crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+    uint32_t size = 0UL;
 
-    if( (ptr_inputData == NULL) || (dataLen == 0u) )
+    if (handlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
     {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_INPUTDATA;
+        size = (uint32_t)sizeof(CRYPTO_AES_HW_CONTEXT);
     }
-    else if(ptr_outData == NULL)
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    else if (handlerType_en == CRYPTO_HANDLER_SW_INTERNAL)
     {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
+        size = (uint32_t)sizeof(CRYPTO_AES_SW_CONTEXT);
     }
-    else if( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) )
+    else if (handlerType_en == CRYPTO_HANDLER_AUTO)
     {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_OPMODE;
+        // Either handler may run the operation.
+        size = (uint32_t)((sizeof(CRYPTO_AES_HW_CONTEXT) > sizeof(CRYPTO_AES_SW_CONTEXT)) ?
+            sizeof(CRYPTO_AES_HW_CONTEXT) : sizeof(CRYPTO_AES_SW_CONTEXT));
     }
-    else if(ptr_key == NULL)
-	{
-		ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
-	}
-	else if(
-            (opMode_en != CRYPTO_SYM_OPMODE_XTS) &&
-            ((keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) ) ) //key length check other than XTS mode
-    {
-       ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
-    }
-    else if( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
-							(keyLen != (uint32_t) (((uint32_t)CRYPTO_AESKEYSIZE_128)*2UL))
-                            && (keyLen != (uint32_t)(((uint32_t)CRYPTO_AESKEYSIZE_256)*2UL))
-            )//key length check for XTS mode
-    {
-        ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
-    }
-    else if( (sessionID == 0u ) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) )
-    {
-       ret_aesStatus_en =  CRYPTO_SYM_ERROR_SID;
-    }
-    else if( (ptr_initVect == NULL)
-            && (opMode_en != CRYPTO_SYM_OPMODE_ECB)
-            )
+#endif
+
+    return size;
+}
+
+crypto_Sym_Status_E Crypto_Sym_Aes_EncryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID)
+{
+    CRYPTO_TRACE_ENTER(SYM_AES_ENCRYPTDIRECT, dataLen);
+
+    return CRYPTO_TRACE_EXIT(SYM_AES_ENCRYPTDIRECT, crypto_Sym_Status_E,
+        lCrypto_Sym_Aes_EncryptDirect(handlerType_en, opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, sessionID, NULL));
+}
+
+crypto_Sym_Status_E Crypto_Sym_Aes_EncryptDirectEx(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Sym_Status_E ret_aesStatus_en;
+
+    CRYPTO_TRACE_ENTER(SYM_AES_ENCRYPTDIRECTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Sym_Aes_WorkspaceSize(handlerType_en))))
     {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_IV;
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_CTX;
     }
     else
     {
-        switch(handlerType_en)
-        {
-            case CRYPTO_HANDLER_HW_INTERNAL:
-                ret_aesStatus_en = Crypto_Sym_Hw_Aes_EncryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect);
-                break;
-            default:
-                ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
-                break;
-        }
+        ret_aesStatus_en = lCrypto_Sym_Aes_EncryptDirect(handlerType_en, opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, sessionID, ptr_workspace);
     }
-    return ret_aesStatus_en;
+
+    return CRYPTO_TRACE_EXIT(SYM_AES_ENCRYPTDIRECTEX, crypto_Sym_Status_E, ret_aesStatus_en);
 }
 
 crypto_Sym_Status_E Crypto_Sym_Aes_DecryptDirect(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
                                                         uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID)
 {
-    crypto_Sym_Status_E ret_aesStatus_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+    CRYPTO_TRACE_ENTER(SYM_AES_DECRYPTDIRECT, dataLen);
 
-    if( (ptr_inputData == NULL) || (dataLen == 0u) )
-    {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_INPUTDATA;
-    }
-    else if(ptr_outData == NULL)
-    {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_OUTPUTDATA;
-    }
-    else if( (opMode_en <= CRYPTO_SYM_OPMODE_INVALID) || (opMode_en >= CRYPTO_SYM_OPMODE_MAX) )
-    {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_OPMODE;
-    }
-    else if(
-            (opMode_en != CRYPTO_SYM_OPMODE_XTS) &&
-            ( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256) )  ) //key length check other than XTS mode
-    {
-       ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
-    }
-    else if( (opMode_en == CRYPTO_SYM_OPMODE_XTS) &&
-                (   (ptr_key == NULL)
-                    ||  ( (keyLen != (uint32_t) (((uint32_t)CRYPTO_AESKEYSIZE_128)*2UL))
-                            && (keyLen != (uint32_t)(((uint32_t)CRYPTO_AESKEYSIZE_256)*2UL)) )
-                )
-            )//key length check for XTS mode
-    {
-        ret_aesStatus_en =  CRYPTO_SYM_ERROR_KEY;
-    }
-    else if( (sessionID == 0u) || (sessionID > (uint32_t)CRYPTO_SYM_SESSION_MAX) )
-    {
-       ret_aesStatus_en =  CRYPTO_SYM_ERROR_SID;
-    }
-    else if( (ptr_initVect == NULL)
-            && (opMode_en != CRYPTO_SYM_OPMODE_ECB)
-            )
+    return CRYPTO_TRACE_EXIT(SYM_AES_DECRYPTDIRECT, crypto_Sym_Status_E,
+        lCrypto_Sym_Aes_DecryptDirect(handlerType_en, opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, sessionID, NULL));
+}
+
+crypto_Sym_Status_E Crypto_Sym_Aes_DecryptDirectEx(crypto_HandlerType_E handlerType_en, crypto_Sym_OpModes_E opMode_en, uint8_t *ptr_inputData,
+                                                        uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t sessionID,
+                                                        void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Sym_Status_E ret_aesStatus_en;
+
+    CRYPTO_TRACE_ENTER(SYM_AES_DECRYPTDIRECTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Sym_Aes_WorkspaceSize(handlerType_en))))
     {
-        ret_aesStatus_en = CRYPTO_SYM_ERROR_IV;
+        ret_aesStatus_en = CRYPTO_SYM_ERROR_CTX;
     }
     else
     {
-        switch(handlerType_en)
-        {
-            case CRYPTO_HANDLER_HW_INTERNAL:
-                ret_aesStatus_en = Crypto_Sym_Hw_Aes_DecryptDirect(opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect);
-                break;
-
-            default:
-                ret_aesStatus_en = CRYPTO_SYM_ERROR_HDLR;
-                break;
-        }
+        ret_aesStatus_en = lCrypto_Sym_Aes_DecryptDirect(handlerType_en, opMode_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, ptr_initVect, sessionID, ptr_workspace);
     }
-    return ret_aesStatus_en;
+
+    return CRYPTO_TRACE_EXIT(SYM_AES_DECRYPTDIRECTEX, crypto_Sym_Status_E, ret_aesStatus_en);
 }
 
+#endif /* CRYPTO_CONFIG_SYM_AES == 1 */
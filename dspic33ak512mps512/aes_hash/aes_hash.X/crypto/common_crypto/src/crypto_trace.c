@@ -0,0 +1,215 @@
+/*******************************************************************************
+  Crypto Trace Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_trace.c
+
+  Summary:
+    This source file implements the Crypto Library trace ring.
+
+  Description:
+    Writers claim a slot by atomically incrementing traceHead, clear the
+    slot's sequence marker, fill in the event and then publish it by writing
+    the marker for that position. Interrupts that preempt a writer claim the
+    following slots and finish first, so events may be published out of
+    order; the reader stops at the first slot that is not yet published and
+    retries it on the next read. A slot overwritten while the reader copies
+    it is detected by comparing the marker before and after the copy.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include "crypto/common_crypto/crypto_trace.h"
+
+#ifdef CRYPTO_TRACE_ENABLE
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#if ((CRYPTO_TRACE_DEPTH & (CRYPTO_TRACE_DEPTH - 1UL)) != 0UL)
+#error "CRYPTO_TRACE_DEPTH must be a power of two"
+#endif
+
+static volatile CRYPTO_TRACE_RECORD traceRing[CRYPTO_TRACE_DEPTH];
+
+// Free-running count of claimed slots; written only through CRYPTO_TRACE_FETCH_INC.
+static volatile uint32_t traceHead;
+
+// Free-running count of slots consumed by the reader.
+static uint32_t traceTail;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the published marker for a ring position. Never zero, so a
+ *        cleared slot is never mistaken for a published one.
+ */
+static uint16_t lCRYPTO_TRACE_Marker(uint32_t position)
+{
+    return (uint16_t)((position & 0x7FFFUL) | 0x8000UL);
+}
+
+static void lCRYPTO_TRACE_PutU32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_TRACE_Record(uint16_t id, uint32_t value)
+{
+    uint32_t position = CRYPTO_TRACE_FETCH_INC(&traceHead);
+    volatile CRYPTO_TRACE_RECORD *record = &traceRing[position & (CRYPTO_TRACE_DEPTH - 1UL)];
+
+    record->seq = 0U;
+    record->timestamp = CRYPTO_TRACE_PORT_Timestamp();
+    record->value = value;
+    record->id = id;
+    record->seq = lCRYPTO_TRACE_Marker(position);
+}
+
+int32_t CRYPTO_TRACE_Exit(uint16_t id, int32_t status)
+{
+    CRYPTO_TRACE_Record(id | CRYPTO_TRACE_EXIT_FLAG, (uint32_t)status);
+
+    return status;
+}
+
+uint32_t CRYPTO_TRACE_Read(CRYPTO_TRACE_RECORD *records, uint32_t maxRecords, uint32_t *dropped)
+{
+    uint32_t head = traceHead;
+    uint32_t count = 0UL;
+    uint32_t lost = 0UL;
+
+    if ((head - traceTail) > CRYPTO_TRACE_DEPTH)
+    {
+        lost = (head - traceTail) - CRYPTO_TRACE_DEPTH;
+        traceTail = head - CRYPTO_TRACE_DEPTH;
+    }
+
+    while ((traceTail != head) && (count < maxRecords))
+    {
+        volatile CRYPTO_TRACE_RECORD *slot = &traceRing[traceTail & (CRYPTO_TRACE_DEPTH - 1UL)];
+        uint16_t marker = lCRYPTO_TRACE_Marker(traceTail);
+
+        if (slot->seq == marker)
+        {
+            records[count].timestamp = slot->timestamp;
+            records[count].value = slot->value;
+            records[count].id = slot->id;
+            records[count].seq = marker;
+
+            // Keep the copy only if no writer reused the slot meanwhile.
+            if (slot->seq == marker)
+            {
+                count++;
+            }
+            else
+            {
+                lost++;
+            }
+            traceTail++;
+        }
+        else if ((traceHead - traceTail) > CRYPTO_TRACE_DEPTH)
+        {
+            // Overwritten by a writer that lapped the reader.
+            lost++;
+            traceTail++;
+        }
+        else
+        {
+            // Claimed by a writer that has not published it yet.
+            break;
+        }
+    }
+
+    if (dropped != NULL)
+    {
+        *dropped += lost;
+    }
+
+    return count;
+}
+
+uint32_t CRYPTO_TRACE_Serialize(uint8_t *buffer, uint32_t size)
+{
+    CRYPTO_TRACE_RECORD record;
+    uint32_t dropped = 0UL;
+    uint32_t used = 0UL;
+
+    if (size >= CRYPTO_TRACE_HEADER_SIZE)
+    {
+        used = CRYPTO_TRACE_HEADER_SIZE;
+
+        while (((size - used) >= CRYPTO_TRACE_RECORD_SIZE) && (CRYPTO_TRACE_Read(&record, 1UL, &dropped) == 1UL))
+        {
+            lCRYPTO_TRACE_PutU32(&buffer[used], record.timestamp);
+            lCRYPTO_TRACE_PutU32(&buffer[used + 4UL], record.value);
+            buffer[used + 8UL] = (uint8_t)record.id;
+            buffer[used + 9UL] = (uint8_t)(record.id >> 8);
+            used += CRYPTO_TRACE_RECORD_SIZE;
+        }
+
+        lCRYPTO_TRACE_PutU32(&buffer[0], CRYPTO_TRACE_PORT_TickRate());
+        lCRYPTO_TRACE_PutU32(&buffer[4], dropped);
+    }
+
+    return used;
+}
+
+void CRYPTO_TRACE_Clear(void)
+{
+    traceTail = traceHead;
+}
+
+#else
+
+/* ISO C requires a translation unit to contain at least one declaration. */
+typedef int crypto_Trace_Disabled_T;
+
+#endif /* CRYPTO_TRACE_ENABLE */
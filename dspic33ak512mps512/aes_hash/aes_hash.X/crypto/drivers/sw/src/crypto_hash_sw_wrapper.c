@@ -0,0 +1,661 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_sw_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for software SHA.
+
+  Description:
+    This source file contains the software implementation of SHA-1 and
+    SHA-2 used by CRYPTO_HANDLER_SW_INTERNAL.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/drivers/sw/crypto_hash_sw_wrapper.h"
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1) && (CRYPTO_CONFIG_HASH_SHA == 1)
+
+#define CRYPTO_HASH_SW_SHA256_FAMILY ((CRYPTO_CONFIG_HASH_SHA2_224 == 1) || (CRYPTO_CONFIG_HASH_SHA2_256 == 1))
+#define CRYPTO_HASH_SW_SHA512_FAMILY ((CRYPTO_CONFIG_HASH_SHA2_384 == 1) || (CRYPTO_CONFIG_HASH_SHA2_512 == 1))
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#if CRYPTO_HASH_SW_SHA256_FAMILY
+static const uint32_t lCrypto_Hash_Sw_Sha256_K[64] =
+{
+    0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+    0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+    0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+    0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+    0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+    0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+    0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+    0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+#endif
+
+#if CRYPTO_HASH_SW_SHA512_FAMILY
+static const uint64_t lCrypto_Hash_Sw_Sha512_K[80] =
+{
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+    0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+    0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+    0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+    0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+    0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+    0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+    0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+    0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+    0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+    0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+    0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+    0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+    0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Zero a context in a way the compiler cannot remove.
+ * @param ptr Pointer to the memory.
+ * @param len Length of the memory.
+ */
+static void lCrypto_Hash_Sw_Wipe(void *ptr, uint32_t len)
+{
+    volatile uint8_t *p = (volatile uint8_t *)ptr;
+
+    while (len > 0UL)
+    {
+        *p = 0U;
+        p++;
+        len--;
+    }
+}
+
+/**
+ * @brief Get the block and digest lengths of an algorithm built into the software handler.
+ * @param shaAlgorithm The crypto SHA algorithm.
+ * @param blockLength Pointer to a value to hold the block length.
+ * @param digestLength Pointer to a value to hold the digest length.
+ * @return CRYPTO_HASH_SUCCESS on success, CRYPTO_HASH_ERROR_ALGO for an algorithm compiled out.
+ */
+static crypto_Hash_Status_E lCrypto_Hash_Sw_Sha_GetLengths(crypto_Hash_Algo_E shaAlgorithm,
+    uint32_t *blockLength, uint32_t *digestLength)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+
+    switch(shaAlgorithm)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            *blockLength = 64;
+            *digestLength = 20;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+        case CRYPTO_HASH_SHA2_224:
+            *blockLength = 64;
+            *digestLength = 28;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_HASH_SHA2_256:
+            *blockLength = 64;
+            *digestLength = 32;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_HASH_SHA2_384:
+            *blockLength = 128;
+            *digestLength = 48;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_HASH_SHA2_512:
+            *blockLength = 128;
+            *digestLength = 64;
+            break;
+#endif
+        default:
+            *blockLength = 0;
+            *digestLength = 0;
+            status = CRYPTO_HASH_ERROR_ALGO;
+            break;
+    }
+
+    return status;
+}
+
+static uint32_t lCrypto_Hash_Sw_Load32(const uint8_t *src)
+{
+    return ((uint32_t)src[0] << 24) | ((uint32_t)src[1] << 16) | ((uint32_t)src[2] << 8) | (uint32_t)src[3];
+}
+
+static uint32_t lCrypto_Hash_Sw_Rotr32(uint32_t x, uint32_t n)
+{
+    return (x >> n) | (x << (32U - n));
+}
+
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+/**
+ * @brief Compress one 64-byte block into a SHA-1 state.
+ * @param state The five chaining words.
+ * @param block The block.
+ */
+static void lCrypto_Hash_Sw_Sha1_Compress(uint64_t *state, const uint8_t *block)
+{
+    uint32_t w[16];
+    uint32_t a = (uint32_t)state[0];
+    uint32_t b = (uint32_t)state[1];
+    uint32_t c = (uint32_t)state[2];
+    uint32_t d = (uint32_t)state[3];
+    uint32_t e = (uint32_t)state[4];
+    uint32_t i;
+
+    for (i = 0; i < 80UL; i++)
+    {
+        uint32_t f;
+        uint32_t k;
+        uint32_t t;
+
+        // The message schedule is kept in a 16-word window.
+        if (i < 16UL)
+        {
+            w[i] = lCrypto_Hash_Sw_Load32(&block[i * 4UL]);
+        }
+        else
+        {
+            w[i & 15UL] = lCrypto_Hash_Sw_Rotr32(w[(i + 13UL) & 15UL] ^ w[(i + 8UL) & 15UL]
+                ^ w[(i + 2UL) & 15UL] ^ w[i & 15UL], 31U);
+        }
+
+        if (i < 20UL)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999UL;
+        }
+        else if (i < 40UL)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1UL;
+        }
+        else if (i < 60UL)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdcUL;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6UL;
+        }
+
+        t = lCrypto_Hash_Sw_Rotr32(a, 27U) + f + e + k + w[i & 15UL];
+        e = d;
+        d = c;
+        c = lCrypto_Hash_Sw_Rotr32(b, 2U);
+        b = a;
+        a = t;
+    }
+
+    state[0] = (uint32_t)(state[0] + a);
+    state[1] = (uint32_t)(state[1] + b);
+    state[2] = (uint32_t)(state[2] + c);
+    state[3] = (uint32_t)(state[3] + d);
+    state[4] = (uint32_t)(state[4] + e);
+
+    lCrypto_Hash_Sw_Wipe(w, (uint32_t)sizeof(w));
+}
+#endif
+
+#if CRYPTO_HASH_SW_SHA256_FAMILY
+/**
+ * @brief Compress one 64-byte block into a SHA-224 or SHA-256 state.
+ * @param state The eight chaining words.
+ * @param block The block.
+ */
+static void lCrypto_Hash_Sw_Sha256_Compress(uint64_t *state, const uint8_t *block)
+{
+    uint32_t w[16];
+    uint32_t v[8];
+    uint32_t i;
+
+    for (i = 0; i < 8UL; i++)
+    {
+        v[i] = (uint32_t)state[i];
+    }
+
+    for (i = 0; i < 64UL; i++)
+    {
+        uint32_t t1;
+        uint32_t t2;
+
+        if (i < 16UL)
+        {
+            w[i] = lCrypto_Hash_Sw_Load32(&block[i * 4UL]);
+        }
+        else
+        {
+            uint32_t w15 = w[(i + 1UL) & 15UL];
+            uint32_t w2 = w[(i + 14UL) & 15UL];
+            uint32_t s0 = lCrypto_Hash_Sw_Rotr32(w15, 7U) ^ lCrypto_Hash_Sw_Rotr32(w15, 18U) ^ (w15 >> 3);
+            uint32_t s1 = lCrypto_Hash_Sw_Rotr32(w2, 17U) ^ lCrypto_Hash_Sw_Rotr32(w2, 19U) ^ (w2 >> 10);
+
+            w[i & 15UL] += s0 + w[(i + 9UL) & 15UL] + s1;
+        }
+
+        t1 = v[7] + (lCrypto_Hash_Sw_Rotr32(v[4], 6U) ^ lCrypto_Hash_Sw_Rotr32(v[4], 11U) ^ lCrypto_Hash_Sw_Rotr32(v[4], 25U))
+            + ((v[4] & v[5]) ^ (~v[4] & v[6])) + lCrypto_Hash_Sw_Sha256_K[i] + w[i & 15UL];
+        t2 = (lCrypto_Hash_Sw_Rotr32(v[0], 2U) ^ lCrypto_Hash_Sw_Rotr32(v[0], 13U) ^ lCrypto_Hash_Sw_Rotr32(v[0], 22U))
+            + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8UL; i++)
+    {
+        state[i] = (uint32_t)(state[i] + v[i]);
+    }
+
+    lCrypto_Hash_Sw_Wipe(w, (uint32_t)sizeof(w));
+    lCrypto_Hash_Sw_Wipe(v, (uint32_t)sizeof(v));
+}
+#endif
+
+#if CRYPTO_HASH_SW_SHA512_FAMILY
+static uint64_t lCrypto_Hash_Sw_Rotr64(uint64_t x, uint32_t n)
+{
+    return (x >> n) | (x << (64U - n));
+}
+
+/**
+ * @brief Compress one 128-byte block into a SHA-384 or SHA-512 state.
+ * @param state The eight chaining words.
+ * @param block The block.
+ */
+static void lCrypto_Hash_Sw_Sha512_Compress(uint64_t *state, const uint8_t *block)
+{
+    uint64_t w[16];
+    uint64_t v[8];
+    uint32_t i;
+
+    for (i = 0; i < 8UL; i++)
+    {
+        v[i] = state[i];
+    }
+
+    for (i = 0; i < 80UL; i++)
+    {
+        uint64_t t1;
+        uint64_t t2;
+
+        if (i < 16UL)
+        {
+            w[i] = ((uint64_t)lCrypto_Hash_Sw_Load32(&block[i * 8UL]) << 32)
+                | (uint64_t)lCrypto_Hash_Sw_Load32(&block[(i * 8UL) + 4UL]);
+        }
+        else
+        {
+            uint64_t w15 = w[(i + 1UL) & 15UL];
+            uint64_t w2 = w[(i + 14UL) & 15UL];
+            uint64_t s0 = lCrypto_Hash_Sw_Rotr64(w15, 1U) ^ lCrypto_Hash_Sw_Rotr64(w15, 8U) ^ (w15 >> 7);
+            uint64_t s1 = lCrypto_Hash_Sw_Rotr64(w2, 19U) ^ lCrypto_Hash_Sw_Rotr64(w2, 61U) ^ (w2 >> 6);
+
+            w[i & 15UL] += s0 + w[(i + 9UL) & 15UL] + s1;
+        }
+
+        t1 = v[7] + (lCrypto_Hash_Sw_Rotr64(v[4], 14U) ^ lCrypto_Hash_Sw_Rotr64(v[4], 18U) ^ lCrypto_Hash_Sw_Rotr64(v[4], 41U))
+            + ((v[4] & v[5]) ^ (~v[4] & v[6])) + lCrypto_Hash_Sw_Sha512_K[i] + w[i & 15UL];
+        t2 = (lCrypto_Hash_Sw_Rotr64(v[0], 28U) ^ lCrypto_Hash_Sw_Rotr64(v[0], 34U) ^ lCrypto_Hash_Sw_Rotr64(v[0], 39U))
+            + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0; i < 8UL; i++)
+    {
+        state[i] += v[i];
+    }
+
+    lCrypto_Hash_Sw_Wipe(w, (uint32_t)sizeof(w));
+    lCrypto_Hash_Sw_Wipe(v, (uint32_t)sizeof(v));
+}
+#endif
+
+/**
+ * @brief Compress one block with the compression function of the context's algorithm.
+ * @param shaCtx The context.
+ * @param block The block, of the algorithm's block length.
+ */
+static void lCrypto_Hash_Sw_Sha_Compress(CRYPTO_HASH_SW_CONTEXT *shaCtx, const uint8_t *block)
+{
+    switch(shaCtx->algorithm)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            lCrypto_Hash_Sw_Sha1_Compress(shaCtx->state, block);
+            break;
+#endif
+#if CRYPTO_HASH_SW_SHA256_FAMILY
+        case CRYPTO_HASH_SHA2_224:
+        case CRYPTO_HASH_SHA2_256:
+            lCrypto_Hash_Sw_Sha256_Compress(shaCtx->state, block);
+            break;
+#endif
+#if CRYPTO_HASH_SW_SHA512_FAMILY
+        case CRYPTO_HASH_SHA2_384:
+        case CRYPTO_HASH_SHA2_512:
+            lCrypto_Hash_Sw_Sha512_Compress(shaCtx->state, block);
+            break;
+#endif
+        default:
+            // Rejected by Crypto_Hash_Sw_Sha_Init().
+            break;
+    }
+}
+
+/**
+ * @brief Load the initial hash value of an algorithm.
+ * @param shaCtx The context, with its algorithm set.
+ */
+static void lCrypto_Hash_Sw_Sha_InitState(CRYPTO_HASH_SW_CONTEXT *shaCtx)
+{
+    switch(shaCtx->algorithm)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            shaCtx->state[0] = 0x67452301UL;
+            shaCtx->state[1] = 0xefcdab89UL;
+            shaCtx->state[2] = 0x98badcfeUL;
+            shaCtx->state[3] = 0x10325476UL;
+            shaCtx->state[4] = 0xc3d2e1f0UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+        case CRYPTO_HASH_SHA2_224:
+            shaCtx->state[0] = 0xc1059ed8UL;
+            shaCtx->state[1] = 0x367cd507UL;
+            shaCtx->state[2] = 0x3070dd17UL;
+            shaCtx->state[3] = 0xf70e5939UL;
+            shaCtx->state[4] = 0xffc00b31UL;
+            shaCtx->state[5] = 0x68581511UL;
+            shaCtx->state[6] = 0x64f98fa7UL;
+            shaCtx->state[7] = 0xbefa4fa4UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_HASH_SHA2_256:
+            shaCtx->state[0] = 0x6a09e667UL;
+            shaCtx->state[1] = 0xbb67ae85UL;
+            shaCtx->state[2] = 0x3c6ef372UL;
+            shaCtx->state[3] = 0xa54ff53aUL;
+            shaCtx->state[4] = 0x510e527fUL;
+            shaCtx->state[5] = 0x9b05688cUL;
+            shaCtx->state[6] = 0x1f83d9abUL;
+            shaCtx->state[7] = 0x5be0cd19UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_HASH_SHA2_384:
+            shaCtx->state[0] = 0xcbbb9d5dc1059ed8ULL;
+            shaCtx->state[1] = 0x629a292a367cd507ULL;
+            shaCtx->state[2] = 0x9159015a3070dd17ULL;
+            shaCtx->state[3] = 0x152fecd8f70e5939ULL;
+            shaCtx->state[4] = 0x67332667ffc00b31ULL;
+            shaCtx->state[5] = 0x8eb44a8768581511ULL;
+            shaCtx->state[6] = 0xdb0c2e0d64f98fa7ULL;
+            shaCtx->state[7] = 0x47b5481dbefa4fa4ULL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_HASH_SHA2_512:
+            shaCtx->state[0] = 0x6a09e667f3bcc908ULL;
+            shaCtx->state[1] = 0xbb67ae8584caa73bULL;
+            shaCtx->state[2] = 0x3c6ef372fe94f82bULL;
+            shaCtx->state[3] = 0xa54ff53a5f1d36f1ULL;
+            shaCtx->state[4] = 0x510e527fade682d1ULL;
+            shaCtx->state[5] = 0x9b05688c2b3e6c1fULL;
+            shaCtx->state[6] = 0x1f83d9abfb41bd6bULL;
+            shaCtx->state[7] = 0x5be0cd19137e2179ULL;
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Hash Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Init(void *shaInitCtx,
+        crypto_Hash_Algo_E shaAlgorithm)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_SW_CONTEXT *shaCtx = (CRYPTO_HASH_SW_CONTEXT*) shaInitCtx;
+    uint32_t blockLength;
+    uint32_t digestLength;
+    crypto_Hash_Status_E status;
+
+    status = lCrypto_Hash_Sw_Sha_GetLengths(shaAlgorithm, &blockLength, &digestLength);
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        (void)memset(shaCtx, 0, sizeof(CRYPTO_HASH_SW_CONTEXT));
+        shaCtx->algorithm = shaAlgorithm;
+        lCrypto_Hash_Sw_Sha_InitState(shaCtx);
+    }
+
+    return status;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Update(void *shaUpdateCtx,
+    uint8_t *data, uint32_t dataLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_SW_CONTEXT *shaCtx = (CRYPTO_HASH_SW_CONTEXT*) shaUpdateCtx;
+    uint32_t blockLength;
+    uint32_t digestLength;
+    crypto_Hash_Status_E status;
+
+    status = lCrypto_Hash_Sw_Sha_GetLengths(shaCtx->algorithm, &blockLength, &digestLength);
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        shaCtx->totalLen += dataLen;
+
+        // Top up a partial block first, then compress whole blocks in place.
+        if ((shaCtx->blockLen > 0UL) && (dataLen > 0UL))
+        {
+            uint32_t take = blockLength - shaCtx->blockLen;
+
+            if (take > dataLen)
+            {
+                take = dataLen;
+            }
+
+            (void)memcpy(&shaCtx->block[shaCtx->blockLen], data, take);
+            shaCtx->blockLen += take;
+            data = &data[take];
+            dataLen -= take;
+
+            if (shaCtx->blockLen == blockLength)
+            {
+                lCrypto_Hash_Sw_Sha_Compress(shaCtx, shaCtx->block);
+                shaCtx->blockLen = 0;
+            }
+        }
+
+        while (dataLen >= blockLength)
+        {
+            lCrypto_Hash_Sw_Sha_Compress(shaCtx, data);
+            data = &data[blockLength];
+            dataLen -= blockLength;
+        }
+
+        if (dataLen > 0UL)
+        {
+            (void)memcpy(shaCtx->block, data, dataLen);
+            shaCtx->blockLen = dataLen;
+        }
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return status;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Final(void *shaFinalCtx,
+    uint8_t *digest)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_SW_CONTEXT *shaCtx = (CRYPTO_HASH_SW_CONTEXT*) shaFinalCtx;
+    uint32_t blockLength;
+    uint32_t digestLength;
+    crypto_Hash_Status_E status;
+
+    status = lCrypto_Hash_Sw_Sha_GetLengths(shaCtx->algorithm, &blockLength, &digestLength);
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        // The length field is 8 bytes for 64-byte blocks and 16 for 128-byte blocks.
+        uint32_t lengthField = blockLength / 8UL;
+        uint64_t bitLen = shaCtx->totalLen << 3;
+        uint32_t i;
+
+        shaCtx->block[shaCtx->blockLen] = 0x80U;
+        shaCtx->blockLen++;
+
+        if (shaCtx->blockLen > (blockLength - lengthField))
+        {
+            (void)memset(&shaCtx->block[shaCtx->blockLen], 0, blockLength - shaCtx->blockLen);
+            lCrypto_Hash_Sw_Sha_Compress(shaCtx, shaCtx->block);
+            shaCtx->blockLen = 0;
+        }
+
+        (void)memset(&shaCtx->block[shaCtx->blockLen], 0, blockLength - shaCtx->blockLen);
+        for (i = 0; i < 8UL; i++)
+        {
+            shaCtx->block[blockLength - 1UL - i] = (uint8_t)(bitLen >> (i * 8UL));
+        }
+        lCrypto_Hash_Sw_Sha_Compress(shaCtx, shaCtx->block);
+
+        // Big-endian words of 4 bytes (64-byte blocks) or 8 bytes, truncated to the digest.
+        for (i = 0; i < digestLength; i++)
+        {
+            if (blockLength == 64UL)
+            {
+                digest[i] = (uint8_t)(shaCtx->state[i / 4UL] >> (24UL - ((i % 4UL) * 8UL)));
+            }
+            else
+            {
+                digest[i] = (uint8_t)(shaCtx->state[i / 8UL] >> (56UL - ((i % 8UL) * 8UL)));
+            }
+        }
+
+        lCrypto_Hash_Sw_Wipe(shaCtx, (uint32_t)sizeof(CRYPTO_HASH_SW_CONTEXT));
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return status;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Digest(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en, void *workspace)
+{
+    CRYPTO_HASH_SW_CONTEXT shaCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_SW_CONTEXT *ptr_shaCtx = (workspace != NULL) ? (CRYPTO_HASH_SW_CONTEXT*) workspace : &shaCtx;
+    crypto_Hash_Status_E status;
+
+    status = Crypto_Hash_Sw_Sha_Init(ptr_shaCtx, shaAlgorithm_en);
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sw_Sha_Update(ptr_shaCtx, data, dataLen);
+    }
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sw_Sha_Final(ptr_shaCtx, digest);
+    }
+
+    return status;
+}
+
+#endif /* CRYPTO_CONFIG_SW_HANDLER == 1 */
@@ -0,0 +1,235 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_sym_sw_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES.
+
+  Description:
+    This source file contains the software implementation of the symmetric
+    AES modes used by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/drivers/sw/crypto_sym_sw_wrapper.h"
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1) && (CRYPTO_CONFIG_SYM_AES == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Check that a mode is built into the software handler.
+ * @param opMode The crypto cipher mode.
+ * @return CRYPTO_SYM_CIPHER_SUCCESS for ECB and CTR, CRYPTO_SYM_ERROR_CIPNOTSUPPTD for another mode.
+ */
+static crypto_Sym_Status_E lCrypto_Sym_Sw_Aes_CheckMode(crypto_Sym_OpModes_E opMode)
+{
+    crypto_Sym_Status_E status;
+
+    switch (opMode)
+    {
+#if (CRYPTO_CONFIG_AES_ECB == 1)
+        case CRYPTO_SYM_OPMODE_ECB:
+            status = CRYPTO_SYM_CIPHER_SUCCESS;
+            break;
+#endif
+#if (CRYPTO_CONFIG_AES_CTR == 1)
+        case CRYPTO_SYM_OPMODE_CTR:
+            status = CRYPTO_SYM_CIPHER_SUCCESS;
+            break;
+#endif
+        default:
+            status = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Common symmetric AES direct-cipher function on a given context.
+ * @param aesCtx The context.
+ * @param opMode The cipher mode.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @return CRYPTO_SYM_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Sym_Status_E lCrypto_Sym_Sw_Aes_Direct(CRYPTO_AES_SW_CONTEXT *aesCtx,
+    crypto_Sym_OpModes_E opMode, crypto_CipherOper_E operation,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect)
+{
+    crypto_Sym_Status_E status = Crypto_Sym_Sw_Aes_Init(aesCtx, operation, opMode, key, keyLen, initVect);
+
+    if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+    {
+        status = Crypto_Sym_Sw_Aes_Cipher(aesCtx, inputData, dataLen, outData);
+    }
+
+    Crypto_Sw_Wipe(aesCtx, (uint32_t)sizeof(CRYPTO_AES_SW_CONTEXT));
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Symmetric Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_Init(void *aesInitCtx,
+    crypto_CipherOper_E cipherOpType_en,
+    crypto_Sym_OpModes_E opMode_en, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_SW_CONTEXT *aesCtx = (CRYPTO_AES_SW_CONTEXT*) aesInitCtx;
+    crypto_Sym_Status_E status = lCrypto_Sym_Sw_Aes_CheckMode(opMode_en);
+
+    if ((status == CRYPTO_SYM_CIPHER_SUCCESS)
+        && (cipherOpType_en != CRYPTO_CIOP_ENCRYPT) && (cipherOpType_en != CRYPTO_CIOP_DECRYPT))
+    {
+        status = CRYPTO_SYM_ERROR_CIPOPER;
+    }
+
+    if ((status == CRYPTO_SYM_CIPHER_SUCCESS) && (opMode_en == CRYPTO_SYM_OPMODE_CTR) && (initVect == NULL))
+    {
+        status = CRYPTO_SYM_ERROR_IV;
+    }
+
+    if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+    {
+        // A context left from a failed Init has no mode and is refused by Cipher.
+        (void)memset(aesCtx, 0, sizeof(CRYPTO_AES_SW_CONTEXT));
+
+        if (!Crypto_Sw_Aes_SetKey(&aesCtx->key, key, keyLen))
+        {
+            status = CRYPTO_SYM_ERROR_KEY;
+        }
+        else
+        {
+            aesCtx->mode = opMode_en;
+            aesCtx->operation = cipherOpType_en;
+
+            if (opMode_en == CRYPTO_SYM_OPMODE_CTR)
+            {
+                // The whole 16-byte IV is the initial counter block.
+                Crypto_Sw_Aes_CtrInit(&aesCtx->ctr, initVect, CRYPTO_SW_AES_BLOCK_SIZE);
+            }
+        }
+    }
+
+    return status;
+}
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_Cipher(void *aesCipherCtx,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_SW_CONTEXT *aesCtx = (CRYPTO_AES_SW_CONTEXT*) aesCipherCtx;
+    crypto_Sym_Status_E status = CRYPTO_SYM_CIPHER_SUCCESS;
+
+    switch (aesCtx->mode)
+    {
+#if (CRYPTO_CONFIG_AES_ECB == 1)
+        case CRYPTO_SYM_OPMODE_ECB:
+            if ((dataLen % CRYPTO_SW_AES_BLOCK_SIZE) != 0UL)
+            {
+                status = CRYPTO_SYM_ERROR_INPUTDATA;
+            }
+            else if (aesCtx->operation == CRYPTO_CIOP_ENCRYPT)
+            {
+                Crypto_Sw_Aes_Encrypt(&aesCtx->key, inputData, outData, dataLen / CRYPTO_SW_AES_BLOCK_SIZE);
+            }
+            else
+            {
+                Crypto_Sw_Aes_Decrypt(&aesCtx->key, inputData, outData, dataLen / CRYPTO_SW_AES_BLOCK_SIZE);
+            }
+            break;
+#endif
+#if (CRYPTO_CONFIG_AES_CTR == 1)
+        case CRYPTO_SYM_OPMODE_CTR:
+            Crypto_Sw_Aes_Ctr(&aesCtx->key, &aesCtx->ctr, inputData, outData, dataLen);
+            break;
+#endif
+        default:
+            // Not initialized.
+            status = CRYPTO_SYM_ERROR_CIPFAIL;
+            break;
+    }
+
+    return status;
+}
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_EncryptDirect(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace)
+{
+    CRYPTO_AES_SW_CONTEXT aesCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_SW_CONTEXT *ptr_aesCtx = (workspace != NULL) ? (CRYPTO_AES_SW_CONTEXT*) workspace : &aesCtx;
+
+    return lCrypto_Sym_Sw_Aes_Direct(ptr_aesCtx, opMode_en, CRYPTO_CIOP_ENCRYPT,
+        inputData, dataLen, outData, key, keyLen, initVect);
+}
+
+crypto_Sym_Status_E Crypto_Sym_Sw_Aes_DecryptDirect(crypto_Sym_OpModes_E opMode_en,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, void *workspace)
+{
+    CRYPTO_AES_SW_CONTEXT aesCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AES_SW_CONTEXT *ptr_aesCtx = (workspace != NULL) ? (CRYPTO_AES_SW_CONTEXT*) workspace : &aesCtx;
+
+    return lCrypto_Sym_Sw_Aes_Direct(ptr_aesCtx, opMode_en, CRYPTO_CIOP_DECRYPT,
+        inputData, dataLen, outData, key, keyLen, initVect);
+}
+
+#endif /* CRYPTO_CONFIG_SW_HANDLER == 1 */
@@ -107,6 +107,17 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
     uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
     uint8_t *authTag, uint32_t authTagLen);
 
+// As the *Direct() functions, with the context in a CRYPTO_AEAD_HW_CONTEXT workspace.
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace);
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -101,6 +101,10 @@ typedef struct
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Digest(uint8_t *data, uint32_t dataLen,
     uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en);
 
+// As Crypto_Hash_Hw_Sha_Digest(), with the context in a CRYPTO_HASH_HW_DIGEST_CONTEXT workspace.
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_DigestEx(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en, void *workspace);
+
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Init(void *shaInitCtx,
     crypto_Hash_Algo_E shaAlgorithm_en);
 
@@ -82,6 +82,11 @@ crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_Direct(uint8_t *ptr_inputData, uint32_t d
                                               uint8_t *ptr_outMac, uint32_t macLen,
                                               uint8_t *ptr_key, uint32_t keyLen);
 
+// As Crypto_Sym_Hw_Cmac_Direct(), with the context in a CRYPTO_CMAC_HW_CONTEXT workspace.
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_DirectEx(uint8_t *ptr_inputData, uint32_t dataLen,
+                                                uint8_t *ptr_outMac, uint32_t macLen,
+                                                uint8_t *ptr_key, uint32_t keyLen, void *workspace);
+
 #ifdef	__cplusplus
 }
 #endif
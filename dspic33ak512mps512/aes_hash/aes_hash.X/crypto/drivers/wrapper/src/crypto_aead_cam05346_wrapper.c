@@ -49,6 +49,12 @@
 #include "crypto/drivers/wrapper/crypto_aead_cam05346_wrapper.h"
 #include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_aes.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_AEAD_AESGCM == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -58,11 +64,49 @@
 
 /**
  * @brief Initialize the CAM library's AES interrupt handler.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
+ */
+static crypto_Int_Status_E lCrypto_Aead_Hw_Aes_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the SHA engine, which the caller holds as
+         * well, so the vector is taken over from the SHA handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
  */
-static void lCrypto_Aead_Hw_Aes_InterruptSetup(void)
+static bool lCrypto_Aead_Hw_Aes_EngineAcquire(void)
 {
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lCrypto_Aead_Hw_Aes_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
 }
 
 /**
@@ -138,7 +182,8 @@ static uint32_t lCrypto_Aead_Hw_CompareAsBytes(uint8_t *cmp1, uint8_t *cmp2, uin
     return result;
 }
 /**
- * @brief Common AES-GCM direct-cipher function.
+ * @brief Common AES-GCM direct-cipher function on a given context.
+ * @param aesContext The cleared CAM library context data.
  * @param mode The cipher mode.
  * @param operation The operation type.
  * @param inputData Pointer to input data.
@@ -154,21 +199,16 @@ static uint32_t lCrypto_Aead_Hw_CompareAsBytes(uint8_t *cmp1, uint8_t *cmp2, uin
  * @param authTagLen Length of the authentication tag.
  * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, other on failure.
  */
-static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_Direct(AESCON_MODE mode, AESCON_OPERATION operation,
+static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_DirectCtx(uint8_t *aesContext,
+    AESCON_MODE mode, AESCON_OPERATION operation,
     uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
     uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
     uint8_t *authTag, uint32_t authTagLen)
 {
-    CRYPTO_AEAD_HW_CONTEXT aeadCtx;
-    register uint8_t *aesContext = aeadCtx.contextData;
-    AES_ERROR aesStatus;
     crypto_Aead_Status_E result = CRYPTO_AEAD_ERROR_CIPFAIL;
-    // Context data must be cleared.
-    (void)memset(aesContext, 0, sizeof(aeadCtx.contextData));
-    aesStatus = DRV_CRYPTO_AES_Initialize(aesContext, mode, operation, key, keyLen, initVect, initVectLen);
+    AES_ERROR aesStatus = DRV_CRYPTO_AES_Initialize(aesContext, mode, operation, key, keyLen, initVect, initVectLen);
     if (aesStatus == AES_NO_ERROR)
     {
-        lCrypto_Aead_Hw_Aes_InterruptSetup();
         if (aadLen > 0UL)
         {
             aesStatus = DRV_CRYPTO_AES_AddHeader(aesContext, aad, aadLen);
@@ -219,6 +259,52 @@ static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_Direct(AESCON_MODE mode, AESC
     return result;
 }
 
+/**
+ * @brief Common AES-GCM direct-cipher function; the context is taken from
+ *        the stack, or from the CRYPTO_POOL_AEAD_HW pool when it has blocks.
+ * @param mode The cipher mode.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @param initVectLen Length of the initialization vector.
+ * @param aad Pointer to the additional authentication data.
+ * @param aadLen Length of the AAD.
+ * @param authTag Pointer to a buffer to hold the authentication tag.
+ * @param authTagLen Length of the authentication tag.
+ * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_Direct(AESCON_MODE mode, AESCON_OPERATION operation,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E result = CRYPTO_AEAD_ERROR_CIPFAIL;
+#if (CRYPTO_POOL_AEAD_HW_COUNT > 0U)
+    // Pool blocks are zeroed when acquired.
+    CRYPTO_AEAD_HW_CONTEXT *ptr_aeadCtx = (CRYPTO_AEAD_HW_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_AEAD_HW);
+
+    if (ptr_aeadCtx != NULL)
+    {
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(ptr_aeadCtx->contextData, mode, operation, inputData, dataLen, outData,
+            key, keyLen, initVect, initVectLen, aad, aadLen, authTag, authTagLen);
+        (void)Crypto_Pool_Release(CRYPTO_POOL_AEAD_HW, ptr_aeadCtx);
+    }
+#else
+    CRYPTO_AEAD_HW_CONTEXT aeadCtx;
+
+    // Context data must be cleared.
+    (void)memset(aeadCtx.contextData, 0, sizeof(aeadCtx.contextData));
+    result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx.contextData, mode, operation, inputData, dataLen, outData,
+        key, keyLen, initVect, initVectLen, aad, aadLen, authTag, authTagLen);
+#endif
+
+    return result;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: AEAD Algorithms Common Interface Implementation
@@ -243,26 +329,34 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Init(void *aeadInitCtx,
     AESCON_MODE mode = MODE_GCM;
     AESCON_OPERATION operation;
 
-    status = lCrypto_Aead_Hw_Aes_GetOperation(cipherOper_en, &operation);
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
 
-    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
     {
-        // Context data must be cleared as the context may be on a stack versus static memory.
-        (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+        status = lCrypto_Aead_Hw_Aes_GetOperation(cipherOper_en, &operation);
 
-        aesStatus = DRV_CRYPTO_AES_Initialize(aeadCtx, mode, operation, key, keyLen, initVect, initVectLen);
-    }
+        if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            // Context data must be cleared as the context may be on a stack versus static memory.
+            (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
 
-    if(aesStatus == AES_NO_ERROR)
-    {
-        lCrypto_Aead_Hw_Aes_InterruptSetup();
+            aesStatus = DRV_CRYPTO_AES_Initialize(aeadCtx, mode, operation, key, keyLen, initVect, initVectLen);
+        }
+
+        if(aesStatus != AES_NO_ERROR)
+        {
+            status = CRYPTO_AEAD_ERROR_CIPFAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
     }
     else
     {
         status = CRYPTO_AEAD_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_INIT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, 0UL, status));
 }
 
 crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_AddAadData(void *aeadCipherCtx,
@@ -280,34 +374,46 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_AddAadData(void *aeadCipherCtx,
     AES_ERROR aesStatus;
     AES_ERROR aesActive;
 
-    aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
-    if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ADDAADDATA, aadLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
     {
-        if (aadLen > 0UL)
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
         {
-            aesStatus = DRV_CRYPTO_AES_AddHeader(aeadCtx->contextData, aad, aadLen);
-            if(aesStatus == AES_NO_ERROR)
+            if (aadLen > 0UL)
             {
-                /* AES-GCM hardware includes the authentication data in its output.  This data needs to be
-                 * discarded from the output stream.  The data is padded to a block size. */
-                uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(aadLen);
-
-                aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, (aadLen + pad));
+                aesStatus = DRV_CRYPTO_AES_AddHeader(aeadCtx->contextData, aad, aadLen);
+                if(aesStatus == AES_NO_ERROR)
+                {
+                    /* AES-GCM hardware includes the authentication data in its output.  This data needs to be
+                     * discarded from the output stream.  The data is padded to a block size. */
+                    uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(aadLen);
+
+                    aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, (aadLen + pad));
+                }
+
+                if(aesStatus == AES_NO_ERROR)
+                {
+                    status = CRYPTO_AEAD_CIPHER_SUCCESS;
+                }
             }
-
-            if(aesStatus == AES_NO_ERROR)
+            else
             {
+                // Empty AAD data is allowed.
                 status = CRYPTO_AEAD_CIPHER_SUCCESS;
             }
-        }
-        else
-        {
-            // Empty AAD data is allowed.
-            status = CRYPTO_AEAD_CIPHER_SUCCESS;
-        }
-}
+    }
 
-    return status;
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ADDAADDATA, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, aadLen, status));
 }
 
 crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Cipher(void *aeadCipherCtx,
@@ -325,34 +431,46 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Cipher(void *aeadCipherCtx,
     AES_ERROR aesStatus;
     AES_ERROR aesActive;
 
-    aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
-    if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_CIPHER, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
     {
-        /* AES GCM cipher/decipher accepts the actual number of bytes, and the library will
-         * automatically pad to a block size and configure the descriptor to ignore the pad bytes.*/
-        aesStatus = DRV_CRYPTO_AES_AddInputData(aeadCtx->contextData, inputData, dataLen);
-        if(aesStatus == AES_NO_ERROR)
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
         {
-            aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, outData, dataLen);
-        }
+            /* AES GCM cipher/decipher accepts the actual number of bytes, and the library will
+             * automatically pad to a block size and configure the descriptor to ignore the pad bytes.*/
+            aesStatus = DRV_CRYPTO_AES_AddInputData(aeadCtx->contextData, inputData, dataLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, outData, dataLen);
+            }
 
-        if((aesStatus == AES_NO_ERROR) && (dataLen > 0UL))
-        {
-            /* AES-GCM hardware operates on block size boundaries.  When data size is not aligned to
-             * a block size boundary, the excess must be discarded from the output stream.
-             * When data is not specified, this is skipped. */
-            uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(dataLen);
+            if((aesStatus == AES_NO_ERROR) && (dataLen > 0UL))
+            {
+                /* AES-GCM hardware operates on block size boundaries.  When data size is not aligned to
+                 * a block size boundary, the excess must be discarded from the output stream.
+                 * When data is not specified, this is skipped. */
+                uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(dataLen);
 
-            aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, pad);
-        }
+                aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, pad);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_CIPHER, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, status));
 }
 
 crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Final(void *aeadFinalCtx,
@@ -370,27 +488,39 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Final(void *aeadFinalCtx,
     AES_ERROR aesStatus;
     AES_ERROR aesActive;
 
-    aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
-    if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_FINAL, 0UL);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
     {
-        aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, authTag, authTagLen);
-        if(aesStatus == AES_NO_ERROR)
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
         {
-            aesStatus = DRV_CRYPTO_AES_AddLenALenC(aeadCtx->contextData);
-        }
+            aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, authTag, authTagLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddLenALenC(aeadCtx->contextData);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            aesStatus = DRV_CRYPTO_AES_Execute(aeadCtx->contextData);
-        }
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_Execute(aeadCtx->contextData);
+            }
 
-        if(aesStatus == AES_NO_ERROR)
-        {
-            status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_FINAL, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, 0UL, status));
 }
 
 crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(uint8_t *inputData,
@@ -398,15 +528,28 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(uint8_t *inputData,
     uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
     uint8_t *authTag, uint32_t authTagLen)
 {
+    crypto_Aead_Status_E result;
 
-    crypto_Aead_Status_E result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_ENCRYPT,
-                                                                inputData, dataLen, outData,
-                                                                key, keyLen, initVect, initVectLen,
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
 
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_ENCRYPT,
+                                                                    inputData, dataLen, outData,
+                                                                    key, keyLen, initVect, initVectLen,
 
-                                                                aad, aadLen, authTag, authTagLen);
 
-    return result;
+                                                                    aad, aadLen, authTag, authTagLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
 }
 
 crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
@@ -418,11 +561,87 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
 
 
         uint8_t generatedAuthTag[AES_GCM_AUTHTAG_SIZE];
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_DECRYPTAUTHDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_DECRYPT,
+                                                                    inputData, dataLen, outData,
+                                                                    key, keyLen, initVect, initVectLen,
+                                                                    aad, aadLen, generatedAuthTag, authTagLen);
+
+            if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
+            {
+                // The tag must be verified against what was calculated.
+                if (0UL != lCrypto_Aead_Hw_CompareAsBytes(generatedAuthTag, authTag, authTagLen))
+                {
+                    result = CRYPTO_AEAD_ERROR_AUTHFAIL;
+                }
+            }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_DECRYPTAUTHDIRECT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) workspace;
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx->contextData, MODE_GCM, OP_ENCRYPT,
+                                                    inputData, dataLen, outData,
+                                                    key, keyLen, initVect, initVectLen,
+                                                    aad, aadLen, authTag, authTagLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
 
-    crypto_Aead_Status_E result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_DECRYPT,
-                                                                inputData, dataLen, outData,
-                                                                key, keyLen, initVect, initVectLen,
-                                                                aad, aadLen, generatedAuthTag, authTagLen);
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECTEX, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) workspace;
+    uint8_t generatedAuthTag[AES_GCM_AUTHTAG_SIZE];
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_DECRYPTAUTHDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx->contextData, MODE_GCM, OP_DECRYPT,
+                                                    inputData, dataLen, outData,
+                                                    key, keyLen, initVect, initVectLen,
+                                                    aad, aadLen, generatedAuthTag, authTagLen);
 
         if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
         {
@@ -433,5 +652,14 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
             }
         }
 
-    return result;
-}
\ No newline at end of file
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_DECRYPTAUTHDIRECTEX, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+#endif /* CRYPTO_CONFIG_AEAD_AESGCM == 1 */
@@ -51,6 +51,12 @@ Microchip or any third party.
 #include "crypto/drivers/wrapper/crypto_hash_cam05346_wrapper.h"
 #include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_hash.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_HASH_SHA == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -60,11 +66,49 @@ Microchip or any third party.
 
 /**
  * @brief Initialize the CAM library's AES interrupt handlers.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
  */
-static void lDRV_CRYPTO_HASH_InterruptSetup(void)
+static crypto_Int_Status_E lDRV_CRYPTO_HASH_InterruptSetup(void)
 {
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_HASH_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_HASH_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the AES engine, which the caller holds as
+         * well, so the vector is taken over from the AES handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_HASH_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lDRV_CRYPTO_HASH_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_HASH_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
 }
 
 /**
@@ -80,26 +124,36 @@ static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetAlgorithm(crypto_Hash_Algo_E
 
     switch(shaAlgorithm)
     {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
         case CRYPTO_HASH_SHA1:
             *mode = MODE_SHA1;
             status = CRYPTO_HASH_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
         case CRYPTO_HASH_SHA2_224:
             *mode = MODE_SHA224;
             status = CRYPTO_HASH_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
         case CRYPTO_HASH_SHA2_256:
             *mode = MODE_SHA256;
             status = CRYPTO_HASH_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
         case CRYPTO_HASH_SHA2_384:
             *mode = MODE_SHA384;
             status = CRYPTO_HASH_SUCCESS;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
         case CRYPTO_HASH_SHA2_512:
             *mode = MODE_SHA512;
             status = CRYPTO_HASH_SUCCESS;
             break;
+#endif
         default:
             status = CRYPTO_HASH_ERROR_ALGO;
             break;
@@ -120,21 +174,31 @@ static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetDigestLength(crypto_Hash_Algo
 
     switch(shaAlgorithm)
     {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
         case CRYPTO_HASH_SHA1:
             *digestLength = 20;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
         case CRYPTO_HASH_SHA2_224:
             *digestLength = 28;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
         case CRYPTO_HASH_SHA2_256:
             *digestLength = 32;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
         case CRYPTO_HASH_SHA2_384:
             *digestLength = 48;
             break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
         case CRYPTO_HASH_SHA2_512:
             *digestLength = 64;
             break;
+#endif
         default:
             *digestLength = 0;
             status = CRYPTO_HASH_ERROR_FAIL;
@@ -144,6 +208,39 @@ static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetDigestLength(crypto_Hash_Algo
     return status;
 }
 
+/**
+ * @brief One-shot SHA digest on a given context.
+ * @param ptr_shaDigestCtx The context; its data is cleared here.
+ * @param mode The CAM library mode of the algorithm.
+ * @param data Pointer to the input data.
+ * @param dataLen Length of the input data.
+ * @param digest Pointer to a buffer to hold the digest.
+ * @param shaAlgorithm_en The SHA algorithm.
+ * @return CRYPTO_HASH_SUCCESS on success, other on failure.
+ */
+static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_DigestCtx(CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx,
+    HASHCON_MODE mode, uint8_t *data, uint32_t dataLen, uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+    HASH_ERROR hashStatus = HASH_INITIALIZE_ERROR;
+    uint32_t digestLength = 0;
+
+    ptr_shaDigestCtx->algorithm = shaAlgorithm_en;
+    (void)memset(ptr_shaDigestCtx->contextData, 0, sizeof(ptr_shaDigestCtx->contextData));
+
+    if (CRYPTO_HASH_SUCCESS == lCrypto_Hash_Hw_Sha_GetDigestLength(ptr_shaDigestCtx->algorithm, &digestLength))
+    {
+        hashStatus = DRV_CRYPTO_HASH_Digest(ptr_shaDigestCtx->contextData, mode, data, dataLen, digest, digestLength);
+    }
+
+    if (hashStatus != HASH_NO_ERROR)
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return status;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Hash Algorithms Common Interface Implementation
@@ -165,25 +262,33 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Init(void *shaInitCtx,
     crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
     HASH_ERROR hashStatus = HASH_INITIALIZE_ERROR;
 
-    status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm, &mode);
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
 
-    if (status == CRYPTO_HASH_SUCCESS)
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
     {
-        shaCtx->algorithm = shaAlgorithm;
-        (void)memset(shaCtx->contextData, 0, sizeof(shaCtx->contextData));
-        hashStatus = DRV_CRYPTO_HASH_Initialize(shaCtx->contextData, mode);
-    }
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm, &mode);
 
-    if (hashStatus == HASH_NO_ERROR)
-    {
-        lDRV_CRYPTO_HASH_InterruptSetup();
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            shaCtx->algorithm = shaAlgorithm;
+            (void)memset(shaCtx->contextData, 0, sizeof(shaCtx->contextData));
+            hashStatus = DRV_CRYPTO_HASH_Initialize(shaCtx->contextData, mode);
+        }
+
+        if (hashStatus != HASH_NO_ERROR)
+        {
+            status = CRYPTO_HASH_ERROR_FAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
     }
     else
     {
         status = CRYPTO_HASH_ERROR_FAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_INIT, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, 0UL, status));
 }
 
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
@@ -201,18 +306,30 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
     HASH_ERROR hashStatus;
     HASH_ERROR hashActive;
 
-    hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
-    if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
-    {
-        hashStatus = DRV_CRYPTO_HASH_Update(shaCtx->contextData, data, dataLen);
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_UPDATE, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
 
-        if (hashStatus == HASH_NO_ERROR)
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
+        if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
         {
-            status = CRYPTO_HASH_SUCCESS;
+            hashStatus = DRV_CRYPTO_HASH_Update(shaCtx->contextData, data, dataLen);
+
+            if (hashStatus == HASH_NO_ERROR)
+            {
+                status = CRYPTO_HASH_SUCCESS;
+            }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_UPDATE, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
 }
 
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Final(void *shaFinalCtx,
@@ -230,45 +347,67 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Final(void *shaFinalCtx,
     HASH_ERROR hashStatus;
     HASH_ERROR hashActive;
 
-    hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
-    if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
-    {
-        uint32_t digestLen;
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_FINAL, 0UL);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
 
-        switch(shaCtx->algorithm)
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
+        if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
         {
-            case CRYPTO_HASH_SHA1:
-                digestLen = 20;
-                break;
-            case CRYPTO_HASH_SHA2_224:
-                digestLen = 28;
-                break;
-            case CRYPTO_HASH_SHA2_256:
-                digestLen = 32;
-                break;
-            case CRYPTO_HASH_SHA2_384:
-                digestLen = 48;
-                break;
-            case CRYPTO_HASH_SHA2_512:
-                digestLen = 64;
-                break;
-            default:
-                digestLen = 0;
-                hashStatus = HASH_READ_ERROR;
-                break;
-        }
+            uint32_t digestLen;
+
+            switch(shaCtx->algorithm)
+            {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+                case CRYPTO_HASH_SHA1:
+                    digestLen = 20;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+                case CRYPTO_HASH_SHA2_224:
+                    digestLen = 28;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+                case CRYPTO_HASH_SHA2_256:
+                    digestLen = 32;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+                case CRYPTO_HASH_SHA2_384:
+                    digestLen = 48;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+                case CRYPTO_HASH_SHA2_512:
+                    digestLen = 64;
+                    break;
+#endif
+                default:
+                    digestLen = 0;
+                    hashStatus = HASH_READ_ERROR;
+                    break;
+            }
 
-        if (hashStatus == HASH_NO_ERROR)
-        {
-            hashStatus = DRV_CRYPTO_HASH_Final(shaCtx->contextData, digest, digestLen);
             if (hashStatus == HASH_NO_ERROR)
             {
-                status = CRYPTO_HASH_SUCCESS;
+                hashStatus = DRV_CRYPTO_HASH_Final(shaCtx->contextData, digest, digestLen);
+                if (hashStatus == HASH_NO_ERROR)
+                {
+                    status = CRYPTO_HASH_SUCCESS;
+                }
             }
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_FINAL, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, 0UL, status));
 }
 
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Digest(uint8_t *data, uint32_t dataLen,
@@ -276,30 +415,81 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Digest(uint8_t *data, uint32_t dataLen,
 {
     HASHCON_MODE mode;
     crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+    CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx = NULL;
+#else
     CRYPTO_HASH_HW_DIGEST_CONTEXT shaDigestCtx;
+    CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx = &shaDigestCtx;
+#endif
 
-    status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm_en, &mode);
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_DIGEST, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
 
-    if (status == CRYPTO_HASH_SUCCESS)
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
     {
-        HASH_ERROR hashStatus = HASH_INITIALIZE_ERROR;
-        uint32_t digestLength = 0;
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm_en, &mode);
 
-        lDRV_CRYPTO_HASH_InterruptSetup();
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            // Pool blocks are zeroed when acquired.
+            ptr_shaDigestCtx = (CRYPTO_HASH_HW_DIGEST_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_HASH_HW_DIGEST);
+            if (ptr_shaDigestCtx == NULL)
+            {
+                status = CRYPTO_HASH_ERROR_FAIL;
+            }
+        }
+#endif
 
-        shaDigestCtx.algorithm = shaAlgorithm_en;
-        (void)memset(shaDigestCtx.contextData, 0, sizeof(shaDigestCtx.contextData));
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            status = lCrypto_Hash_Hw_Sha_DigestCtx(ptr_shaDigestCtx, mode, data, dataLen, digest, shaAlgorithm_en);
+        }
 
-        if (CRYPTO_HASH_SUCCESS == lCrypto_Hash_Hw_Sha_GetDigestLength(shaDigestCtx.algorithm, &digestLength))
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+        if (ptr_shaDigestCtx != NULL)
         {
-            hashStatus = DRV_CRYPTO_HASH_Digest(shaDigestCtx.contextData, mode, data, dataLen, digest, digestLength);
+            (void)Crypto_Pool_Release(CRYPTO_POOL_HASH_HW_DIGEST, ptr_shaDigestCtx);
         }
+#endif
 
-        if (hashStatus != HASH_NO_ERROR)
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_DIGEST, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_DigestEx(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en, void *workspace)
+{
+    HASHCON_MODE mode;
+    crypto_Hash_Status_E status;
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_DIGESTEX, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm_en, &mode);
+
+        if (status == CRYPTO_HASH_SUCCESS)
         {
-            status = CRYPTO_HASH_ERROR_FAIL;
+            /* cppcheck-suppress misra-c2012-11.5 */
+            status = lCrypto_Hash_Hw_Sha_DigestCtx((CRYPTO_HASH_HW_DIGEST_CONTEXT*) workspace, mode, data, dataLen, digest, shaAlgorithm_en);
         }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_DIGESTEX, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
 }
+
+#endif /* CRYPTO_CONFIG_HASH_SHA == 1 */
@@ -53,8 +53,29 @@ Microchip or any third party.
 #include <stdint.h>
 #include "mcc_generated_files/system/system.h"
 #include "app_aes_hash.h"
+#include "app/app_log.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_stats.h"
 
 
+#ifdef CRYPTO_STATS_ENABLE
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Statistics Port
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t CRYPTO_STATS_PORT_Timestamp(void)
+{
+    return APP_TIMER_Get();
+}
+
+uint32_t CRYPTO_STATS_PORT_TickRate(void)
+{
+    return APP_TIMER_TICK_RATE_HZ;
+}
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Main Entry Point
@@ -65,12 +86,18 @@ Microchip or any third party.
 
 int main(void)
 {
+    uint32_t suiteStart;
+    uint32_t suiteTicks;
+
     SYSTEM_Initialize();
+    APP_TIMER_Initialize();
 
     (void) printf("\r\n\r\n\r\n");
     printSeparator(WHITE, '_');
     (void) printf("\r\n\r\n Starting CRYPTO AES/HASH MULTI-OPERATION program");
 
+    suiteStart = APP_TIMER_Get();
+
 #if RUN_SEPARATE_TESTS
     printSeparator(WHITE, '_');
     (void) printf(GREEN "\r\n\r\n Executing in SEPARATE mode" RESET_COLOR);
@@ -105,7 +132,31 @@ int main(void)
     test_concurrent();
     #endif
 
+    #ifdef RUN_POOL_TEST
     printSeparator(WHITE, '_');
+    test_pool();
+    #endif
+
+    #ifdef RUN_CROSSOVER_TEST
+    printSeparator(WHITE, '_');
+    test_crossover();
+    #endif
+
+    #ifdef RUN_HKDF_TEST
+    printSeparator(WHITE, '_');
+    test_hkdf();
+    #endif
+
+    /* The UART transmit queue is only a few bytes deep, so the suite time
+     * includes nearly all of the time spent sending results. */
+    suiteTicks = APP_TIMER_Elapsed(suiteStart);
+
+    printSeparator(WHITE, '_');
+#ifdef USE_BINARY_LOG
+    APP_LOG_Timing("SUITE RUN TIME", APP_TIMER_TICK_RATE_HZ, suiteTicks);
+#else
+    (void) printf("\r\n %-22s : %lu us", "SUITE RUN TIME", APP_TIMER_TicksToUs(suiteTicks));
+#endif
     (void) printf("\r\n");
 
     while(1)
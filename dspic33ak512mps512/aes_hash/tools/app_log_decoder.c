@@ -0,0 +1,382 @@
+/*******************************************************************************
+  Host Tool Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_log_decoder.c
+
+  Summary:
+    Host-side decoder for the framed binary log emitted by the aes_hash
+    application when USE_BINARY_LOG is defined (see aes_hash.X/app/app_log.h).
+
+  Description:
+    Reads a captured serial stream from a file (or stdin) and writes the same
+    text report the application prints in text mode. Bytes outside frames are
+    passed through unchanged. Frames with a bad CRC are counted, reported on
+    stderr and skipped by resynchronizing on the next start-of-frame byte.
+
+    Build with any C99 host compiler, for example:
+        cc -std=c99 -O2 -o app_log_decoder app_log_decoder.c
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// Must match aes_hash.X/app/app_log.h.
+#define APP_LOG_SOF                 (0xA5U)
+#define APP_LOG_MAX_PAYLOAD         (4096U)
+#define APP_LOG_RECORD_HEX          (1U)
+#define APP_LOG_RECORD_STEP         (2U)
+#define APP_LOG_RECORD_RESULT       (3U)
+#define APP_LOG_RECORD_TIMING       (4U)
+
+#define RESET_COLOR "\x1B""[0m"
+#define RED         "\x1B""[1;31m"
+#define GREEN       "\x1B""[1;32m"
+
+// TYPE + LENGTH header bytes following the SOF.
+#define APP_LOG_HEADER_SIZE         (3U)
+#define APP_LOG_CRC_SIZE            (2U)
+
+typedef struct DECODER_STATS {
+    unsigned long frames;
+    unsigned long crcErrors;
+    unsigned long lengthErrors;
+    unsigned long unknownRecords;
+} DECODER_STATS;
+
+// Number of bytes already printed for the hex array being continued.
+static uint32_t hexIndex;
+
+static uint16_t crc16Update(uint16_t crc, uint8_t byte)
+{
+    crc ^= (uint16_t)byte << 8;
+
+    for (int bit = 0; bit < 8; bit++)
+    {
+        crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+static uint32_t getU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static const char *getTestMode(uint8_t testMode)
+{
+    static const char *modes[] = { "ENCRYPT", "DECRYPT", "HASH" };
+
+    return (testMode < 3U) ? modes[testMode] : "???";
+}
+
+static const char *getTestError(uint8_t result)
+{
+    static const char *errors[] = {
+        "SUCCESS", "INITIALIZE FAILED", "HASH FAILED", "ADD AAD FAILED",
+        "CIPHER FAILED", "FINALIZE FAILED", "DATA COMPARE FAILED", "TAG COMPARE FAILED"
+    };
+
+    if (result == 255U)
+    {
+        return "ALL TESTS DONE";
+    }
+
+    return (result < 8U) ? errors[result] : "UNKNOWN";
+}
+
+/* Copy a length-prefixed string out of the payload. Returns the number of
+ * payload bytes consumed, or 0 if the string overruns the payload. */
+static size_t getString(const uint8_t *p, size_t avail, char *out)
+{
+    size_t len;
+
+    if (avail < 1U)
+    {
+        return 0U;
+    }
+
+    len = p[0];
+    if ((len + 1U) > avail)
+    {
+        return 0U;
+    }
+
+    memcpy(out, &p[1], len);
+    out[len] = '\0';
+
+    return len + 1U;
+}
+
+static bool decodeHex(const uint8_t *p, size_t len)
+{
+    char label[256];
+    size_t used = getString(p, len, label);
+
+    if (used == 0U)
+    {
+        return false;
+    }
+
+    // An empty label continues the previous array (see APP_LOG_HexArray()).
+    if (label[0] != '\0')
+    {
+        hexIndex = 0U;
+        printf("\r\n %-22s :", label);
+
+        if (used == len)
+        {
+            printf(" None");
+        }
+    }
+
+    for (size_t i = used; i < len; i++, hexIndex++)
+    {
+        if (((hexIndex % 16U) == 0U) && (hexIndex != 0U))
+        {
+            printf("\r\n%-25s", "");
+        }
+
+        printf(" 0x%02x", p[i]);
+    }
+
+    return true;
+}
+
+static bool decodeStep(const uint8_t *p, size_t len)
+{
+    char step[256];
+    char op[256];
+    size_t used;
+    size_t opUsed;
+
+    if (len < 6U)
+    {
+        return false;
+    }
+
+    used = getString(&p[6], len - 6U, step);
+    if (used == 0U)
+    {
+        return false;
+    }
+
+    opUsed = getString(&p[6U + used], len - 6U - used, op);
+    if (opUsed == 0U)
+    {
+        return false;
+    }
+
+    if (p[1] != 0U)
+    {
+        printf("\r\n %-12s %-8s %-8s OPERATION (%-3lu BYTES)... ", step, op, getTestMode(p[0]),
+               (unsigned long)getU32(&p[2]));
+    }
+    else
+    {
+        printf("\r\n %-12s %-8s %-8s OPERATION... ", step, op, getTestMode(p[0]));
+    }
+
+    return true;
+}
+
+static bool decodeResult(const uint8_t *p, size_t len)
+{
+    if (len != 5U)
+    {
+        return false;
+    }
+
+    if (p[0] == 0U)
+    {
+        printf(GREEN " PASS" RESET_COLOR);
+    }
+    else
+    {
+        printf(RED " %s: operation status %d" RESET_COLOR, getTestError(p[0]), (int)(int32_t)getU32(&p[1]));
+    }
+
+    return true;
+}
+
+static bool decodeTiming(const uint8_t *p, size_t len)
+{
+    char label[256];
+    uint32_t rate;
+    uint32_t ticks;
+
+    if ((len < 9U) || (getString(&p[8], len - 8U, label) == 0U))
+    {
+        return false;
+    }
+
+    rate = getU32(&p[0]);
+    ticks = getU32(&p[4]);
+    printf("\r\n %-22s : %lu us", label,
+           (rate != 0U) ? (unsigned long)(((uint64_t)ticks * 1000000U) / rate) : 0UL);
+
+    return true;
+}
+
+static void decodeFrame(uint8_t type, const uint8_t *p, size_t len, DECODER_STATS *stats)
+{
+    bool ok;
+
+    switch (type)
+    {
+        case APP_LOG_RECORD_HEX:
+            ok = decodeHex(p, len);
+            break;
+
+        case APP_LOG_RECORD_STEP:
+            ok = decodeStep(p, len);
+            break;
+
+        case APP_LOG_RECORD_RESULT:
+            ok = decodeResult(p, len);
+            break;
+
+        case APP_LOG_RECORD_TIMING:
+            ok = decodeTiming(p, len);
+            break;
+
+        default:
+            stats->unknownRecords++;
+            fprintf(stderr, "app_log_decoder: unknown record type %u\n", type);
+            return;
+    }
+
+    if (!ok)
+    {
+        stats->lengthErrors++;
+        fprintf(stderr, "app_log_decoder: malformed record type %u (%zu bytes)\n", type, len);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t frame[APP_LOG_HEADER_SIZE + APP_LOG_MAX_PAYLOAD + APP_LOG_CRC_SIZE];
+    DECODER_STATS stats = { 0 };
+    FILE *in = stdin;
+    size_t have = 0U;
+    size_t need = 0U;
+    bool inFrame = false;
+    int c;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [capture-file]\n", argv[0]);
+        return 2;
+    }
+
+    if (argc == 2)
+    {
+        in = fopen(argv[1], "rb");
+        if (in == NULL)
+        {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    while ((c = fgetc(in)) != EOF)
+    {
+        if (!inFrame)
+        {
+            if ((uint8_t)c == APP_LOG_SOF)
+            {
+                inFrame = true;
+                have = 0U;
+                need = APP_LOG_HEADER_SIZE;
+            }
+            else
+            {
+                putchar(c);
+            }
+            continue;
+        }
+
+        frame[have++] = (uint8_t)c;
+
+        if (have == APP_LOG_HEADER_SIZE)
+        {
+            size_t len = (size_t)frame[1] | ((size_t)frame[2] << 8);
+
+            if (len > APP_LOG_MAX_PAYLOAD)
+            {
+                stats.lengthErrors++;
+                inFrame = false;
+                continue;
+            }
+
+            need = APP_LOG_HEADER_SIZE + len + APP_LOG_CRC_SIZE;
+        }
+
+        if (have == need)
+        {
+            size_t len = need - APP_LOG_HEADER_SIZE - APP_LOG_CRC_SIZE;
+            uint16_t crc = 0xFFFFU;
+            uint16_t rxCrc = (uint16_t)(frame[need - 2U] | (frame[need - 1U] << 8));
+
+            for (size_t i = 0U; i < (need - APP_LOG_CRC_SIZE); i++)
+            {
+                crc = crc16Update(crc, frame[i]);
+            }
+
+            if (crc == rxCrc)
+            {
+                stats.frames++;
+                decodeFrame(frame[0], &frame[APP_LOG_HEADER_SIZE], len, &stats);
+            }
+            else
+            {
+                stats.crcErrors++;
+                fprintf(stderr, "app_log_decoder: CRC error (got 0x%04x, expected 0x%04x)\n", rxCrc, crc);
+            }
+
+            inFrame = false;
+        }
+    }
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    fflush(stdout);
+    fprintf(stderr, "app_log_decoder: %lu frames, %lu CRC errors, %lu malformed, %lu unknown\n",
+            stats.frames, stats.crcErrors, stats.lengthErrors, stats.unknownRecords);
+
+    return ((stats.crcErrors == 0U) && (stats.lengthErrors == 0U)) ? 0 : 1;
+}
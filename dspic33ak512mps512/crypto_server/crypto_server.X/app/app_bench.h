@@ -0,0 +1,68 @@
+/*******************************************************************************
+  Benchmark Output Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_bench.h
+
+  Summary:
+    This header file provides the COM port output shared by the benchmarks of
+    the crypto server.
+
+  Description:
+    The benchmarks of app/ and the latency benchmark port of main.c write
+    their CSV rows with APP_BENCH_WriteLine(), which returns once the row has
+    left UART1 so that it does not overlap the next timed operation.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_BENCH_H
+#define	APP_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Write a line and CR LF to UART1 and wait until it is sent.
+ * @param line Zero-terminated text, without the line end.
+ */
+void APP_BENCH_WriteLine(const char *line);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_BENCH_H */
@@ -0,0 +1,87 @@
+/*******************************************************************************
+  Streaming ECDSA Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_digisign_stream_bench.h
+
+  Summary:
+    This header file provides the streaming ECDSA sign and verify benchmark
+    of the crypto server.
+
+  Description:
+    With CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE, main.c runs
+    APP_DIGISIGN_STREAM_BENCH_Run() at reset, before the server takes
+    requests. It compares hash-then-sign with the streaming calls of
+    crypto_digsign_stream.h and writes the times to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_DIGISIGN_STREAM_BENCH_H
+#define	APP_DIGISIGN_STREAM_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Signs timed per curve, message size and path.
+#ifndef CRYPTO_DIGISIGN_STREAM_BENCH_COUNT
+#define CRYPTO_DIGISIGN_STREAM_BENCH_COUNT  (8UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Time, per curve of app/crypto_rfc6979_vectors.h and for 1 KB and
+ *        64 KB messages, the end-to-end sign of the caller that hashes then
+ *        signs ("hash+sign") and of the streaming API ("stream"), as CSV
+ *        with the minimum, mean and maximum of one sign. Every signature is
+ *        checked with the streaming verify, whose last time is reported.
+ *        The status is that of the first failed call, -1 when a signature
+ *        does not verify, or 0.
+ */
+void APP_DIGISIGN_STREAM_BENCH_Run(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_DIGISIGN_STREAM_BENCH_H */
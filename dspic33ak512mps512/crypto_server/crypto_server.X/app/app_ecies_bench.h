@@ -0,0 +1,88 @@
+/*******************************************************************************
+  ECIES Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_ecies_bench.h
+
+  Summary:
+    This header file provides the ECIES seal and open benchmark of the crypto
+    server.
+
+  Description:
+    With CRYPTO_ECIES_BENCH_ENABLE, main.c runs APP_ECIES_BENCH_Run() at
+    reset, before the server takes requests. It checks the host vectors of
+    app/crypto_ecies_vectors.h and writes the time of Crypto_Ecies_Seal() and
+    Crypto_Ecies_Open() to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_ECIES_BENCH_H
+#define	APP_ECIES_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Seals and opens timed per curve.
+#ifndef CRYPTO_ECIES_BENCH_COUNT
+#define CRYPTO_ECIES_BENCH_COUNT    (8UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Open the host vectors of app/crypto_ecies_vectors.h, then time, per
+ *        curve and pool state, Crypto_Ecies_Seal() and Crypto_Ecies_Open()
+ *        of the report of the last vector of the curve to its recipient, as
+ *        CSV. Cold seals start with the key pair pools empty; warm ones with
+ *        them refilled, untimed, as the idle loop keeps them. The status is
+ *        that of the first failed call, -1 when a message did not come back
+ *        unchanged, or 0. A last seal per curve is written as
+ *        sealed,<curve>,<hex> for host/crypto_ecies_vectors -c to open.
+ */
+void APP_ECIES_BENCH_Run(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_ECIES_BENCH_H */
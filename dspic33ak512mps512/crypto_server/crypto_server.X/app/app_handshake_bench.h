@@ -0,0 +1,87 @@
+/*******************************************************************************
+  ECDHE Handshake Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_handshake_bench.h
+
+  Summary:
+    This header file provides the ECDHE handshake benchmark of the crypto
+    server.
+
+  Description:
+    With CRYPTO_HANDSHAKE_BENCH_ENABLE, main.c runs APP_HANDSHAKE_BENCH_Run()
+    at reset, before the server takes requests. It writes the time of each
+    side of a handshake between two local contexts to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_HANDSHAKE_BENCH_H
+#define	APP_HANDSHAKE_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Handshakes timed per curve.
+#ifndef CRYPTO_HANDSHAKE_BENCH_COUNT
+#define CRYPTO_HANDSHAKE_BENCH_COUNT    (8UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Run handshakes between two local contexts and write, per curve and
+ *        pool state, the average time of each call as CSV: the initiator
+ *        takes Start plus Finish end to end, the responder one
+ *        Crypto_Handshake_Ecdhe(). Cold handshakes start with the key pair
+ *        pools empty; warm ones with them refilled, as the idle loop keeps
+ *        them, so both Starts take a pooled key pair. The status is that of
+ *        the first failed call, -1 when the two sides ended with different
+ *        keys, or 0.
+ */
+void APP_HANDSHAKE_BENCH_Run(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_HANDSHAKE_BENCH_H */
@@ -0,0 +1,95 @@
+/*******************************************************************************
+  Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_load.h
+
+  Summary:
+    This header file provides a periodic background interrupt load.
+
+  Description:
+    SCCP1 runs as a 32-bit period timer from the standard peripheral clock
+    and interrupts at the requested rate. Each interrupt busy-waits
+    APP_LOAD_WORK_TICKS Timer1 ticks, standing in for the UART, control loop
+    or communication handlers of a real application. The interrupt has the
+    same priority as the UART and CRYPTO interrupts.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_LOAD_H
+#define	APP_LOAD_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define APP_LOAD_CLOCK_HZ           (100000000UL)
+
+// Time spent in each load interrupt, in Timer1 ticks (80 ns); 25 is 2 us.
+#ifndef APP_LOAD_WORK_TICKS
+#define APP_LOAD_WORK_TICKS         (25UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Start the periodic load interrupt. Requires APP_TIMER_Initialize().
+ * @param rateHz Interrupts per second; 0 only stops a running load.
+ */
+void APP_LOAD_Start(uint32_t rateHz);
+
+/**
+ * @brief Stop the periodic load interrupt.
+ */
+void APP_LOAD_Stop(void);
+
+/**
+ * @brief Get the number of load interrupts since the last APP_LOAD_Start().
+ * @return The interrupt count.
+ */
+uint32_t APP_LOAD_Count(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_LOAD_H */
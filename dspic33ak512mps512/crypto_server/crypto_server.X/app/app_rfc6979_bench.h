@@ -0,0 +1,87 @@
+/*******************************************************************************
+  Deterministic ECDSA Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_rfc6979_bench.h
+
+  Summary:
+    This header file provides the RFC 6979 deterministic ECDSA benchmark of
+    the crypto server.
+
+  Description:
+    With CRYPTO_RFC6979_BENCH_ENABLE, main.c runs APP_RFC6979_BENCH_Run() at
+    reset, before the server takes requests. It checks the vectors of
+    app/crypto_rfc6979_vectors.h and writes the time of signs with the TRNG
+    nonce and with the RFC 6979 nonce to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_RFC6979_BENCH_H
+#define	APP_RFC6979_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Signs timed per curve and nonce source.
+#ifndef CRYPTO_RFC6979_BENCH_COUNT
+#define CRYPTO_RFC6979_BENCH_COUNT  (32UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Check Crypto_Rfc6979_Ecdsa_Nonce() and Crypto_Rfc6979_Ecdsa_Sign()
+ *        on the vectors of app/crypto_rfc6979_vectors.h, then time, per
+ *        curve, signs of the "sample" hash with the nonce of the TRNG
+ *        (Crypto_DigiSign_Ecdsa_Sign()) and of RFC 6979, as CSV with the
+ *        minimum, mean, maximum and standard deviation of one sign. The
+ *        status is that of the first failed call, -1 when a nonce or a
+ *        deterministic signature differs from its vector, or 0.
+ */
+void APP_RFC6979_BENCH_Run(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_RFC6979_BENCH_H */
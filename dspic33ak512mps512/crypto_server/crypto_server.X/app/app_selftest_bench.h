@@ -0,0 +1,78 @@
+/*******************************************************************************
+  Self-Test Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_selftest_bench.h
+
+  Summary:
+    This header file provides the power-on self-test benchmark of the crypto
+    server.
+
+  Description:
+    With CRYPTO_SELFTEST_ENABLE and CRYPTO_SELFTEST_BENCH_ENABLE, main.c
+    passes the time and status of the reset self-test to
+    APP_SELFTEST_BENCH_Run(), which times each known-answer test, a full and
+    a lazy Crypto_SelfTest_Run() and the first uses the lazy run defers, and
+    writes them to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_SELFTEST_BENCH_H
+#define	APP_SELFTEST_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "crypto/common_crypto/crypto_selftest.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Write the time of the reset self-test, of each known-answer test,
+ *        of a full and a lazy run and of the first use of each algorithm the
+ *        lazy run leaves untested, as CSV, then run the reset self-test
+ *        again so the states are those of bootMode.
+ * @param bootMode   Mode of the reset self-test.
+ * @param bootTicks  Timer ticks the reset self-test took.
+ * @param bootStatus Status of the reset self-test.
+ */
+void APP_SELFTEST_BENCH_Run(crypto_SelfTest_Mode_E bootMode, uint32_t bootTicks, crypto_SelfTest_Status_E bootStatus);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_SELFTEST_BENCH_H */
@@ -0,0 +1,92 @@
+/*******************************************************************************
+  Verified-Signature Cache Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_verify_cache_bench.h
+
+  Summary:
+    This header file provides the verified-signature cache benchmark of the
+    crypto server.
+
+  Description:
+    With CRYPTO_VERIFY_CACHE_BENCH_ENABLE, main.c runs
+    APP_VERIFY_CACHE_BENCH_Run() at reset, before the server takes requests.
+    It times verifications through crypto_verify_cache.h against the PKE and
+    writes them to the COM port as CSV.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef APP_VERIFY_CACHE_BENCH_H
+#define	APP_VERIFY_CACHE_BENCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Verifications timed per curve and case.
+#ifndef CRYPTO_VERIFY_CACHE_BENCH_COUNT
+#define CRYPTO_VERIFY_CACHE_BENCH_COUNT         (8UL)
+#endif
+
+// Reconnects of the storm, each verifying every vector once.
+#ifndef CRYPTO_VERIFY_CACHE_BENCH_RECONNECTS
+#define CRYPTO_VERIFY_CACHE_BENCH_RECONNECTS    (20UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Time, per curve of app/crypto_rfc6979_vectors.h, a verification
+ *        on the PKE (verify), the first one through an empty cache (miss),
+ *        the next ones (hit) and one of a tampered signature after the
+ *        valid one is cached (tampered), as CSV with the minimum, mean and
+ *        maximum. Then time a reconnect storm, every vector verified once
+ *        per reconnect, without and with the cache. The status is that of
+ *        the first failed call, -1 for an unexpected result, or 0.
+ */
+void APP_VERIFY_CACHE_BENCH_Run(void);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* APP_VERIFY_CACHE_BENCH_H */
@@ -0,0 +1,158 @@
+/*******************************************************************************
+  Crypto Boot Verifier Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_boot_verify.h
+
+  Summary:
+    This header file provides the secure-boot verification of signed images
+    in program flash.
+
+  Description:
+    CRYPTO_BOOT_VERIFY_Run() checks a list of images, each signed with ECDSA
+    over its CRYPTO_BOOT_VERIFY_HASH digest. Each image is hashed in chunks of
+    CRYPTO_BOOT_VERIFY_CHUNK_SIZE bytes fed to Crypto_Hash_Sha_Update()
+    straight from flash, through CRYPTO_BOOT_VERIFY_PORT_Flash(), without a
+    copy of the image in RAM.
+
+    In the pipelined mode the signature of image N is verified on a task of
+    its own (Crypto_Osal_TaskStart()) while the caller hashes image N+1, so
+    the SHA engine and the PKE work at the same time. This needs the FreeRTOS
+    or POSIX port of crypto_osal.h; with the bare-metal port, and with the
+    pre-compiled CAM driver that keeps the CPU until a PKE operation ends,
+    the pipelined mode runs in the same order as the sequential one.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_BOOT_VERIFY_H
+#define CRYPTO_BOOT_VERIFY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Bytes of flash passed to each Crypto_Hash_Sha_Update() call.
+#ifndef CRYPTO_BOOT_VERIFY_CHUNK_SIZE
+#define CRYPTO_BOOT_VERIFY_CHUNK_SIZE   (4096UL)
+#endif
+
+// Digest the images are signed over.
+#ifndef CRYPTO_BOOT_VERIFY_HASH
+#define CRYPTO_BOOT_VERIFY_HASH         CRYPTO_HASH_SHA2_384
+#endif
+
+// Curve of the signing key.
+#ifndef CRYPTO_BOOT_VERIFY_CURVE
+#define CRYPTO_BOOT_VERIFY_CURVE        CRYPTO_ECC_CURVE_P384
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_BOOT_VERIFY_DIGEST_MAX   (64UL)
+
+typedef enum
+{
+    CRYPTO_BOOT_VERIFY_ERROR_FLASH = -4,        // The port returned no flash for a chunk
+    CRYPTO_BOOT_VERIFY_ERROR_HASH = -3,         // A Crypto_Hash_Sha_* call failed
+    CRYPTO_BOOT_VERIFY_ERROR_SIGNATURE = -2,    // The signature does not match the image
+    CRYPTO_BOOT_VERIFY_ERROR_ARG = -1,
+    CRYPTO_BOOT_VERIFY_SUCCESS = 0
+} CRYPTO_BOOT_VERIFY_STATUS;
+
+typedef struct
+{
+    uint32_t address;           // Flash address of the first signed byte
+    uint32_t length;            // Signed bytes
+    uint8_t *signature;         // r followed by s
+    uint32_t signatureLen;
+    uint8_t *pubKey;            // Public key, as Crypto_DigiSign_Ecdsa_Verify() takes it
+    uint32_t pubKeyLen;
+} CRYPTO_BOOT_VERIFY_IMAGE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Hash an image from flash.
+ * @param image The image.
+ * @param digest Receives the CRYPTO_BOOT_VERIFY_HASH digest, at most
+ *        CRYPTO_BOOT_VERIFY_DIGEST_MAX bytes.
+ * @return CRYPTO_BOOT_VERIFY_SUCCESS, CRYPTO_BOOT_VERIFY_ERROR_FLASH,
+ *         CRYPTO_BOOT_VERIFY_ERROR_HASH or CRYPTO_BOOT_VERIFY_ERROR_ARG.
+ */
+CRYPTO_BOOT_VERIFY_STATUS CRYPTO_BOOT_VERIFY_Digest(const CRYPTO_BOOT_VERIFY_IMAGE *image, uint8_t *digest);
+
+/**
+ * @brief Verify the signatures of the images, in order.
+ * @param images The images.
+ * @param count Number of images.
+ * @param pipelined true to verify each signature while the next image is
+ *        hashed, false to hash and verify one image after the other.
+ * @param results Receives the status of each image, or NULL.
+ * @return CRYPTO_BOOT_VERIFY_SUCCESS when every image verified, else the
+ *         status of the first image that did not.
+ */
+CRYPTO_BOOT_VERIFY_STATUS CRYPTO_BOOT_VERIFY_Run(const CRYPTO_BOOT_VERIFY_IMAGE *images, uint32_t count,
+                                                 bool pipelined, CRYPTO_BOOT_VERIFY_STATUS *results);
+
+/**
+ * @brief Give the bytes of flash at an address. Provided by the application.
+ *        The SHA engine reads them where they are, so the pointer must stay
+ *        valid until the next call; a port whose flash the engine cannot
+ *        read may copy the chunk into a RAM buffer instead.
+ * @param address Flash address.
+ * @param length Bytes, at most CRYPTO_BOOT_VERIFY_CHUNK_SIZE.
+ * @return The bytes, or NULL when the range is not in flash.
+ */
+uint8_t *CRYPTO_BOOT_VERIFY_PORT_Flash(uint32_t address, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_BOOT_VERIFY_H */
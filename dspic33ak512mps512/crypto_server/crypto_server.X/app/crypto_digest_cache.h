@@ -0,0 +1,190 @@
+/*******************************************************************************
+  Crypto Digest Cache Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digest_cache.h
+
+  Summary:
+    This header file provides cached attestation digests of flash regions
+    that are rarely written, such as the bootloader and configuration pages.
+
+  Description:
+    A region is split into pages of CRYPTO_DIGEST_CACHE_PAGE_SIZE bytes, each
+    with its own digest, and the attestation digest of the region is the hash
+    of its page digests in order. Every write to flash bumps a generation
+    counter: the flash-write path of the application calls
+    CRYPTO_DIGEST_CACHE_FlashWritten(), which stamps the new generation on
+    each registered region and page the write touched.
+
+    CRYPTO_DIGEST_CACHE_Attest() keys the cached region digest on the region,
+    the hash algorithm and the generation of the region, so attesting a
+    region that was not written since returns the cached digest without
+    hashing. Otherwise only the pages whose generation moved are hashed
+    again, and the page digests are hashed into a new region digest.
+
+    A page is read through CRYPTO_DIGEST_CACHE_PORT_Flash() and hashed with
+    one Crypto_Hash_Sha_Digest() call, without a copy in RAM. The page table
+    is given by the caller: a region of length bytes needs
+    CRYPTO_DIGEST_CACHE_PAGE_COUNT(length) page entries and as many times
+    CRYPTO_DIGEST_CACHE_DIGEST_MAX bytes of page digests.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_DIGEST_CACHE_H
+#define CRYPTO_DIGEST_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Bytes of flash under one page digest; a power of two.
+#ifndef CRYPTO_DIGEST_CACHE_PAGE_SIZE
+#define CRYPTO_DIGEST_CACHE_PAGE_SIZE   (4096UL)
+#endif
+
+// Longest digest kept per page; 48 covers SHA-384, 64 is needed for SHA-512.
+#ifndef CRYPTO_DIGEST_CACHE_DIGEST_MAX
+#define CRYPTO_DIGEST_CACHE_DIGEST_MAX  (48UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_DIGEST_CACHE_PAGE_COUNT(length)  \
+    (((uint32_t)(length) + CRYPTO_DIGEST_CACHE_PAGE_SIZE - 1UL) / CRYPTO_DIGEST_CACHE_PAGE_SIZE)
+
+typedef enum
+{
+    CRYPTO_DIGEST_CACHE_ERROR_FLASH = -3,       // The port returned no flash for a page
+    CRYPTO_DIGEST_CACHE_ERROR_HASH = -2,        // A Crypto_Hash_Sha_* call failed
+    CRYPTO_DIGEST_CACHE_ERROR_ARG = -1,
+    CRYPTO_DIGEST_CACHE_SUCCESS = 0
+} CRYPTO_DIGEST_CACHE_STATUS;
+
+typedef struct
+{
+    uint32_t written;           // Generation of the last write to the page
+    uint32_t hashed;            // Generation the page digest was taken at
+} CRYPTO_DIGEST_CACHE_PAGE;
+
+// Filled in by CRYPTO_DIGEST_CACHE_Register(); not to be changed by the caller.
+typedef struct CRYPTO_DIGEST_CACHE_REGION_S
+{
+    uint32_t address;                   // Flash address of the first byte
+    uint32_t length;                    // Bytes
+    uint32_t pageCount;
+    CRYPTO_DIGEST_CACHE_PAGE *pages;    // pageCount entries
+    uint8_t *pageDigests;               // pageCount * CRYPTO_DIGEST_CACHE_DIGEST_MAX bytes
+    uint32_t generation;                // Generation of the last write to the region
+    uint32_t digestGeneration;          // Generation the region digest was taken at
+    crypto_Hash_Algo_E algorithm;       // Algorithm of the page and region digests
+    uint8_t digest[CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+    struct CRYPTO_DIGEST_CACHE_REGION_S *next;
+} CRYPTO_DIGEST_CACHE_REGION;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Add a region to the cache, with every page still to be hashed.
+ * @param region The region, which must stay valid while registered.
+ * @param address Flash address of the first byte.
+ * @param length Bytes.
+ * @param pages CRYPTO_DIGEST_CACHE_PAGE_COUNT(length) page entries.
+ * @param pageDigests CRYPTO_DIGEST_CACHE_PAGE_COUNT(length) *
+ *        CRYPTO_DIGEST_CACHE_DIGEST_MAX bytes.
+ * @return CRYPTO_DIGEST_CACHE_SUCCESS or CRYPTO_DIGEST_CACHE_ERROR_ARG.
+ */
+CRYPTO_DIGEST_CACHE_STATUS CRYPTO_DIGEST_CACHE_Register(CRYPTO_DIGEST_CACHE_REGION *region, uint32_t address,
+                                                        uint32_t length, CRYPTO_DIGEST_CACHE_PAGE *pages,
+                                                        uint8_t *pageDigests);
+
+/**
+ * @brief Remove a region from the cache.
+ * @param region The region.
+ */
+void CRYPTO_DIGEST_CACHE_Unregister(CRYPTO_DIGEST_CACHE_REGION *region);
+
+/**
+ * @brief Record a write to flash. Called by the flash-write path of the
+ *        application after each erase or program operation.
+ * @param address Flash address of the first byte written.
+ * @param length Bytes written.
+ */
+void CRYPTO_DIGEST_CACHE_FlashWritten(uint32_t address, uint32_t length);
+
+/**
+ * @brief Get the attestation digest of a region: the hash of its page
+ *        digests, hashing only the pages written since they were last hashed.
+ * @param region The region.
+ * @param algorithm The hash algorithm; changing it hashes every page again.
+ * @param digest Receives the digest, at most CRYPTO_DIGEST_CACHE_DIGEST_MAX
+ *        bytes.
+ * @param pagesHashed Receives the number of pages hashed, 0 when the cached
+ *        region digest was returned, or NULL.
+ * @return CRYPTO_DIGEST_CACHE_SUCCESS, CRYPTO_DIGEST_CACHE_ERROR_FLASH,
+ *         CRYPTO_DIGEST_CACHE_ERROR_HASH or CRYPTO_DIGEST_CACHE_ERROR_ARG.
+ */
+CRYPTO_DIGEST_CACHE_STATUS CRYPTO_DIGEST_CACHE_Attest(CRYPTO_DIGEST_CACHE_REGION *region,
+                                                      crypto_Hash_Algo_E algorithm, uint8_t *digest,
+                                                      uint32_t *pagesHashed);
+
+/**
+ * @brief Give the bytes of flash at an address. Provided by the application.
+ *        The SHA engine reads them where they are, so the pointer must stay
+ *        valid until the next call.
+ * @param address Flash address.
+ * @param length Bytes, at most CRYPTO_DIGEST_CACHE_PAGE_SIZE.
+ * @return The bytes, or NULL when the range is not in flash.
+ */
+uint8_t *CRYPTO_DIGEST_CACHE_PORT_Flash(uint32_t address, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_DIGEST_CACHE_H */
@@ -0,0 +1,228 @@
+/* Generated by host/crypto_ecies_vectors.c with OpenSSL; do not edit. ECIES
+ * interop vectors of crypto_ecies.h: recipient key pair, additional data,
+ * message and the message sealed with a fixed ephemeral key. */
+
+#ifndef CRYPTO_ECIES_VECTORS_H
+#define CRYPTO_ECIES_VECTORS_H
+
+#include "crypto/common_crypto/crypto_common.h"
+
+typedef struct{
+    crypto_EccCurveType_E curve_en;
+    const uint8_t *ptr_privKey;
+    uint32_t privKeyLen;
+    const uint8_t *ptr_pubKey;                  // 0x04 || X || Y
+    uint32_t pubKeyLen;
+    const uint8_t *ptr_aad;
+    uint32_t aadLen;
+    const uint8_t *ptr_msg;
+    uint32_t msgLen;
+    const uint8_t *ptr_sealed;
+    uint32_t sealedLen;
+}st_Crypto_Ecies_Vector;
+
+static const uint8_t eciesVector_p256_priv[32] = {
+    0x9D, 0x9C, 0x5A, 0xA4, 0xEA, 0x47, 0x91, 0xEE, 0x3A, 0x16, 0x35, 0x94, 0xAC, 0x6B, 0x98, 0x80,
+    0x14, 0xDB, 0xB1, 0xE9, 0x93, 0x09, 0xA5, 0x3C, 0xF9, 0x92, 0x12, 0x24, 0x6F, 0x03, 0x8F, 0x31
+};
+static const uint8_t eciesVector_p256_pub[65] = {
+    0x04, 0x03, 0xD8, 0x39, 0x06, 0x5C, 0x4C, 0x52, 0x1B, 0xB4, 0x05, 0xD6, 0x8D, 0x1A, 0x90, 0x99,
+    0x4D, 0x97, 0x55, 0x32, 0x0B, 0xBB, 0x82, 0x28, 0xAA, 0x5E, 0x5B, 0x5A, 0x92, 0x98, 0xF4, 0xCA,
+    0x36, 0x4D, 0x77, 0xC7, 0x9A, 0x14, 0x09, 0x1F, 0xFA, 0x72, 0x40, 0xF3, 0x5C, 0x01, 0x77, 0x34,
+    0xB1, 0xE6, 0xDA, 0x66, 0xC4, 0xB2, 0x7E, 0xE3, 0x7B, 0x8B, 0x26, 0xF3, 0x4B, 0x3C, 0x0E, 0xAD,
+    0xF2
+};
+static const uint8_t eciesVector_p256_0_sealed[81] = {
+    0x04, 0x2A, 0xF7, 0x25, 0x49, 0xAF, 0xAB, 0xB3, 0x66, 0x49, 0x52, 0x67, 0x70, 0xE7, 0x28, 0x7A,
+    0x32, 0xD4, 0x20, 0x35, 0x99, 0x9E, 0xFB, 0x3A, 0x8B, 0x8D, 0x1E, 0x38, 0x54, 0x6D, 0x33, 0xDF,
+    0xAE, 0xEF, 0xB8, 0xE6, 0x46, 0xD3, 0x1B, 0x01, 0xEE, 0xC8, 0x39, 0x14, 0xC2, 0x8C, 0x3F, 0x6E,
+    0xB2, 0x0C, 0xCE, 0xC4, 0xBC, 0x4F, 0x5A, 0x63, 0x8D, 0x74, 0x6A, 0x0C, 0x7E, 0xB8, 0x45, 0x8D,
+    0xA4, 0x29, 0x20, 0x17, 0xD9, 0xBA, 0xC2, 0xC9, 0x80, 0x89, 0x33, 0x9B, 0xE8, 0x27, 0x95, 0xD8,
+    0x21
+};
+static const uint8_t eciesVector_p256_1_msg[16] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30
+};
+static const uint8_t eciesVector_p256_1_sealed[97] = {
+    0x04, 0x8E, 0x7E, 0x3F, 0x92, 0xB3, 0xA9, 0x3B, 0x05, 0x6E, 0xFE, 0x17, 0xA5, 0x93, 0xD8, 0x29,
+    0x90, 0xF2, 0xAC, 0x22, 0x57, 0x82, 0xEE, 0xF3, 0x7A, 0x5F, 0xBC, 0x45, 0x09, 0xC4, 0x55, 0x23,
+    0xD5, 0x92, 0x51, 0x39, 0x5F, 0x6B, 0x4C, 0x30, 0x78, 0xC2, 0x64, 0x9E, 0x60, 0xC2, 0xE9, 0xBB,
+    0xBE, 0x90, 0x69, 0x92, 0xB5, 0xC9, 0xA5, 0xC7, 0x53, 0xB3, 0x21, 0xE8, 0xC8, 0x0F, 0x30, 0xB0,
+    0x53, 0x5F, 0xE7, 0xC2, 0xED, 0x9A, 0x69, 0x57, 0x9A, 0xD0, 0x9A, 0x40, 0xC0, 0x48, 0x70, 0x0F,
+    0xC6, 0xBB, 0x98, 0x96, 0x76, 0xF3, 0xF6, 0x43, 0xCB, 0xA9, 0x95, 0x99, 0xB3, 0x77, 0x54, 0xFD,
+    0x16
+};
+static const uint8_t eciesVector_p256_2_msg[200] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30,
+    0x34, 0x32, 0x2C, 0x22, 0x74, 0x22, 0x3A, 0x32, 0x31, 0x2E, 0x35, 0x2C, 0x22, 0x72, 0x68, 0x22,
+    0x3A, 0x34, 0x30, 0x2E, 0x32, 0x2C, 0x22, 0x70, 0x22, 0x3A, 0x31, 0x30, 0x31, 0x33, 0x2E, 0x32,
+    0x2C, 0x22, 0x62, 0x61, 0x74, 0x22, 0x3A, 0x33, 0x2E, 0x36, 0x31, 0x7D, 0x5E, 0x5F, 0x60, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B
+};
+static const uint8_t eciesVector_p256_2_sealed[281] = {
+    0x04, 0x00, 0x87, 0x56, 0xCC, 0x46, 0x27, 0x11, 0x39, 0xF8, 0x30, 0x23, 0xAA, 0x37, 0x83, 0xC9,
+    0xBC, 0x5A, 0xE6, 0x03, 0x18, 0xC2, 0x7E, 0x37, 0x12, 0x57, 0xAE, 0xBA, 0xB0, 0xB1, 0xA3, 0x88,
+    0x5A, 0x24, 0x4B, 0xAF, 0x5D, 0x87, 0xAA, 0x37, 0x1D, 0x2E, 0x39, 0x72, 0xC7, 0xDD, 0x37, 0x35,
+    0x83, 0xE7, 0xBA, 0x3B, 0x5C, 0xAD, 0x56, 0x46, 0x5A, 0x4E, 0xB8, 0x70, 0x98, 0x32, 0x26, 0x87,
+    0x35, 0xF0, 0xD9, 0x09, 0x49, 0x82, 0xE1, 0xC1, 0xB4, 0x8D, 0x93, 0x21, 0x45, 0x31, 0xC6, 0xBE,
+    0x10, 0xA2, 0xEB, 0xE4, 0x1A, 0x06, 0x20, 0xD5, 0xA1, 0xD3, 0xB3, 0x34, 0xCA, 0x61, 0x56, 0x8B,
+    0x65, 0x3B, 0xB1, 0xEB, 0x5B, 0x5F, 0xAC, 0x83, 0xBD, 0x53, 0xA0, 0xAA, 0x1E, 0x39, 0x0B, 0xFD,
+    0x26, 0x3C, 0x95, 0xFC, 0x26, 0xD9, 0x09, 0xB6, 0x8B, 0x0D, 0x51, 0x5A, 0x1D, 0xAE, 0x27, 0xED,
+    0x6E, 0xF6, 0x9F, 0x47, 0x54, 0xB6, 0x63, 0x1C, 0x08, 0xA2, 0xB0, 0x5B, 0x98, 0x63, 0x48, 0xE2,
+    0xF7, 0x89, 0x24, 0xED, 0x82, 0x73, 0xDC, 0x0E, 0x9B, 0x13, 0x1A, 0x7E, 0x38, 0xE0, 0x66, 0xBD,
+    0xCA, 0xB5, 0x9D, 0x7E, 0x14, 0xD1, 0xC4, 0xC3, 0x16, 0x07, 0x71, 0x68, 0x35, 0x3A, 0x86, 0x33,
+    0xDB, 0x94, 0xF4, 0xD5, 0x1C, 0xA3, 0x49, 0xD0, 0x5B, 0xC0, 0x4F, 0xE8, 0x9E, 0x8B, 0xB1, 0x5E,
+    0x0F, 0xF8, 0xEA, 0x76, 0x48, 0xD6, 0x7E, 0x1C, 0xFF, 0x02, 0xC3, 0x60, 0xE4, 0x36, 0x85, 0x3F,
+    0x80, 0x16, 0x33, 0x49, 0x82, 0x5E, 0x10, 0x16, 0x63, 0x6D, 0xE8, 0x96, 0xCC, 0x40, 0x5D, 0x2C,
+    0x7A, 0x02, 0x6C, 0x58, 0x9C, 0x54, 0xC5, 0x2C, 0x48, 0x66, 0x93, 0xB0, 0x1A, 0x1F, 0x79, 0x6B,
+    0xD0, 0x80, 0x12, 0x59, 0x80, 0x70, 0xEE, 0x59, 0x1A, 0x84, 0x8C, 0x36, 0x1D, 0xA6, 0x38, 0x0E,
+    0xEC, 0x04, 0x77, 0xC9, 0x24, 0x07, 0xE9, 0x0B, 0xD5, 0xDC, 0x55, 0x81, 0xE7, 0xF9, 0xA6, 0x44,
+    0x2B, 0xCA, 0x6A, 0x3E, 0x9E, 0xB1, 0xEA, 0x62, 0xFF
+};
+static const uint8_t eciesVector_p256_3_msg[61] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30,
+    0x34, 0x32, 0x2C, 0x22, 0x74, 0x22, 0x3A, 0x32, 0x31, 0x2E, 0x35, 0x2C, 0x22, 0x72, 0x68, 0x22,
+    0x3A, 0x34, 0x30, 0x2E, 0x32, 0x2C, 0x22, 0x70, 0x22, 0x3A, 0x31, 0x30, 0x31, 0x33, 0x2E, 0x32,
+    0x2C, 0x22, 0x62, 0x61, 0x74, 0x22, 0x3A, 0x33, 0x2E, 0x36, 0x31, 0x7D, 0x5F
+};
+static const uint8_t eciesVector_p256_3_sealed[142] = {
+    0x04, 0x05, 0x6A, 0x00, 0x49, 0xE4, 0x8D, 0x55, 0xAD, 0x4E, 0x00, 0xF3, 0xCB, 0xF2, 0x46, 0xA5,
+    0xAC, 0x93, 0x37, 0xCE, 0x9A, 0x4F, 0xAC, 0x86, 0xDB, 0x6C, 0xBF, 0x14, 0xE5, 0x3B, 0xAF, 0x31,
+    0xBF, 0x35, 0xE7, 0xC1, 0x21, 0xCD, 0xCD, 0x9B, 0x2A, 0xC5, 0xEA, 0xA2, 0x81, 0xFE, 0xAE, 0xF6,
+    0x8C, 0x92, 0xAC, 0x0A, 0xFD, 0xE7, 0x08, 0x1D, 0xC9, 0xDE, 0xFA, 0x8F, 0x54, 0x29, 0x04, 0x21,
+    0xAA, 0x2C, 0xFA, 0x90, 0x18, 0xFD, 0xAF, 0x64, 0x87, 0x98, 0x19, 0xCF, 0x02, 0x2F, 0x79, 0xA1,
+    0xD2, 0x93, 0x63, 0x4E, 0x7B, 0xBE, 0x20, 0x21, 0xB1, 0x8F, 0xA1, 0xA2, 0xE9, 0xCD, 0x94, 0xB9,
+    0x8F, 0x96, 0x4A, 0x77, 0xB6, 0x57, 0xFE, 0x09, 0xDC, 0x66, 0xF3, 0x34, 0xFB, 0x98, 0xFC, 0x09,
+    0x17, 0x4D, 0xE2, 0xBF, 0x13, 0xDE, 0x86, 0xCE, 0x30, 0x30, 0xAD, 0xD6, 0xB8, 0xB1, 0xA1, 0xF8,
+    0xAC, 0x3C, 0xE6, 0x81, 0x64, 0xFE, 0xEF, 0x70, 0x9B, 0x0E, 0x6F, 0xDC, 0x65, 0x9B
+};
+static const uint8_t eciesVector_p256_3_aad[8] = {
+    0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x2D, 0x37
+};
+
+static const uint8_t eciesVector_p384_priv[48] = {
+    0x5C, 0xDE, 0x58, 0x94, 0x0F, 0x3B, 0x07, 0x01, 0xB8, 0x5B, 0xFB, 0x4F, 0xAF, 0xD3, 0xE5, 0x8C,
+    0x33, 0x6E, 0xB6, 0xB3, 0xF2, 0x32, 0xE8, 0x4E, 0x36, 0x30, 0x9E, 0xB4, 0xF5, 0x64, 0x91, 0xE2,
+    0x51, 0x33, 0x58, 0xB4, 0xEA, 0x79, 0x82, 0x9B, 0xD4, 0x56, 0x98, 0x0F, 0xE6, 0x60, 0xC9, 0x30
+};
+static const uint8_t eciesVector_p384_pub[97] = {
+    0x04, 0xEC, 0xFB, 0xED, 0x3B, 0x2D, 0xF9, 0x9A, 0x15, 0x42, 0xA0, 0x19, 0x05, 0xED, 0xD2, 0x6F,
+    0x7C, 0xE1, 0x47, 0x43, 0xAC, 0x61, 0x98, 0x8F, 0x82, 0x66, 0x8B, 0x65, 0x78, 0x3F, 0x00, 0x21,
+    0xFB, 0x2E, 0x16, 0xA6, 0xA3, 0xD2, 0xC8, 0x39, 0xDD, 0x63, 0x3E, 0xEE, 0x72, 0x50, 0xDF, 0xBB,
+    0xCB, 0x39, 0x39, 0xDC, 0x33, 0xAB, 0x1B, 0xDE, 0x5C, 0x88, 0xBB, 0x28, 0xE0, 0x4B, 0x6F, 0x53,
+    0xC5, 0xF6, 0x9B, 0x7E, 0x13, 0x5C, 0x5A, 0x6D, 0x99, 0xE3, 0x50, 0xAD, 0x62, 0x0B, 0x69, 0x74,
+    0x67, 0x73, 0xB2, 0xF3, 0xB7, 0x78, 0x2C, 0x52, 0x39, 0xC5, 0x57, 0x2C, 0x9D, 0x4D, 0xF5, 0xF0,
+    0x35
+};
+static const uint8_t eciesVector_p384_0_sealed[113] = {
+    0x04, 0x32, 0xA7, 0x09, 0x2E, 0x51, 0x38, 0xA2, 0x6A, 0xD1, 0x27, 0x00, 0xBC, 0x25, 0x20, 0xF2,
+    0xA9, 0x8B, 0xFB, 0x20, 0x55, 0x5E, 0xFE, 0x6B, 0x94, 0x1D, 0x00, 0x45, 0xFD, 0x86, 0xBD, 0x79,
+    0x44, 0xEB, 0x0C, 0xE0, 0x11, 0x9C, 0x7F, 0xB4, 0x3B, 0x3D, 0x88, 0x7D, 0xDB, 0xAD, 0x0A, 0x8B,
+    0x70, 0x4E, 0x48, 0x73, 0x49, 0x35, 0xE3, 0x47, 0xCF, 0xB4, 0x26, 0xA9, 0xDF, 0x36, 0x44, 0x18,
+    0xE9, 0xA7, 0xA2, 0xE1, 0x1D, 0x64, 0x5E, 0x7C, 0xDD, 0x13, 0x77, 0x80, 0xEE, 0x02, 0xC5, 0x97,
+    0x5D, 0x7A, 0x16, 0xD8, 0xE2, 0x99, 0xEF, 0x77, 0xCA, 0x26, 0x6E, 0xEF, 0xD9, 0x85, 0xC4, 0x2F,
+    0x1D, 0xD5, 0x02, 0x16, 0xE2, 0x52, 0x2E, 0x13, 0x0D, 0xC4, 0x62, 0x92, 0xB1, 0x2E, 0xBE, 0xC6,
+    0xBC
+};
+static const uint8_t eciesVector_p384_1_msg[16] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30
+};
+static const uint8_t eciesVector_p384_1_sealed[129] = {
+    0x04, 0xF1, 0xF8, 0xEB, 0x31, 0xDA, 0x09, 0xF5, 0x5B, 0xDE, 0x2C, 0x5B, 0xAA, 0x91, 0x06, 0xF5,
+    0x57, 0x38, 0x94, 0x72, 0x2D, 0x88, 0x22, 0x6F, 0xEB, 0x68, 0xDE, 0x82, 0x9A, 0xBD, 0x4C, 0x40,
+    0x1D, 0xD3, 0xA2, 0x28, 0xD7, 0x18, 0x9F, 0x0C, 0x30, 0x89, 0x5C, 0xE3, 0xF3, 0x6C, 0x9B, 0x1B,
+    0xB2, 0x24, 0x32, 0xEE, 0xD7, 0xDD, 0xB5, 0xF8, 0xA5, 0x02, 0x84, 0x05, 0x88, 0xBA, 0xCF, 0xF6,
+    0xA5, 0x70, 0x39, 0x94, 0x21, 0x70, 0x64, 0x3A, 0xF9, 0xE4, 0x22, 0xD3, 0xCE, 0x8F, 0xAD, 0x3E,
+    0x59, 0xBD, 0x26, 0xB8, 0x58, 0x13, 0x47, 0x60, 0x03, 0xF7, 0x3D, 0x78, 0xD7, 0x6C, 0x84, 0x9E,
+    0xE2, 0xFC, 0x01, 0x99, 0xA5, 0x23, 0xF4, 0x01, 0x19, 0x9F, 0x18, 0x1D, 0x28, 0xD1, 0x82, 0xC5,
+    0xFB, 0x42, 0x87, 0xAA, 0x8F, 0xA0, 0x12, 0xC7, 0x44, 0x9B, 0x64, 0x82, 0x2E, 0x7A, 0xAE, 0x90,
+    0x77
+};
+static const uint8_t eciesVector_p384_2_msg[200] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30,
+    0x34, 0x32, 0x2C, 0x22, 0x74, 0x22, 0x3A, 0x32, 0x31, 0x2E, 0x35, 0x2C, 0x22, 0x72, 0x68, 0x22,
+    0x3A, 0x34, 0x30, 0x2E, 0x32, 0x2C, 0x22, 0x70, 0x22, 0x3A, 0x31, 0x30, 0x31, 0x33, 0x2E, 0x32,
+    0x2C, 0x22, 0x62, 0x61, 0x74, 0x22, 0x3A, 0x33, 0x2E, 0x36, 0x31, 0x7D, 0x5E, 0x5F, 0x60, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x20, 0x21, 0x22,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x20, 0x21, 0x22, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B
+};
+static const uint8_t eciesVector_p384_2_sealed[313] = {
+    0x04, 0x4B, 0x9E, 0x29, 0xAA, 0x08, 0x07, 0xD2, 0x89, 0x06, 0x65, 0x31, 0x2C, 0x01, 0xEC, 0xEB,
+    0x41, 0x38, 0x22, 0x3B, 0x32, 0x0E, 0xDB, 0xA4, 0x79, 0xAB, 0x7E, 0x3E, 0xC8, 0xD4, 0x86, 0x5A,
+    0x88, 0x50, 0x88, 0x64, 0xB6, 0x56, 0x43, 0xA9, 0x04, 0xFF, 0xEB, 0x1F, 0x41, 0x3D, 0xB7, 0xBE,
+    0x3E, 0x31, 0x85, 0x8A, 0xA9, 0x1A, 0x0A, 0x8E, 0xA6, 0xAC, 0x46, 0x2F, 0x81, 0x62, 0x7B, 0x36,
+    0xD6, 0x0D, 0x1B, 0x13, 0x6B, 0xE2, 0x65, 0x72, 0x7B, 0x25, 0x04, 0x1B, 0x71, 0x30, 0xFA, 0x71,
+    0xEC, 0xF7, 0x57, 0x2B, 0x43, 0x26, 0xD4, 0xA7, 0x30, 0xF6, 0x4A, 0xFE, 0xE4, 0x2C, 0x13, 0x83,
+    0x76, 0xD7, 0xE6, 0x0F, 0xB2, 0xF6, 0xEC, 0xD8, 0xAB, 0x2B, 0xE1, 0x10, 0xC3, 0x76, 0xC7, 0xD0,
+    0xF5, 0x22, 0x3C, 0xBA, 0xF0, 0x69, 0x0D, 0xC4, 0x4A, 0x25, 0xE1, 0xD9, 0x2B, 0x4D, 0xE8, 0x9D,
+    0x74, 0x10, 0x20, 0x7D, 0x4E, 0xC1, 0x28, 0x95, 0x61, 0x89, 0x43, 0x23, 0x64, 0xD0, 0xB5, 0xEC,
+    0x49, 0x65, 0x94, 0x8C, 0xF8, 0xDA, 0x04, 0x27, 0x0B, 0xAA, 0x5E, 0x05, 0xAD, 0xBF, 0x43, 0x80,
+    0x3F, 0x68, 0x99, 0x1E, 0x3E, 0x34, 0xCB, 0xED, 0x9E, 0xA6, 0xC2, 0xB9, 0xF8, 0x6F, 0x6D, 0x90,
+    0x37, 0xDE, 0x73, 0x42, 0x79, 0xBC, 0x31, 0x64, 0x47, 0x97, 0x57, 0x8B, 0x10, 0x52, 0xBC, 0x25,
+    0x72, 0x3E, 0xB2, 0xA7, 0xE6, 0xC1, 0xC1, 0x30, 0x38, 0xD8, 0x95, 0x19, 0xBE, 0xE3, 0x4C, 0x15,
+    0x65, 0x36, 0x58, 0x8C, 0x47, 0xB4, 0xBF, 0x1F, 0x35, 0x13, 0xEE, 0x2A, 0x81, 0x4F, 0x54, 0x37,
+    0x5A, 0x73, 0x75, 0xA3, 0x29, 0x57, 0xB1, 0xAD, 0xFF, 0x28, 0x57, 0xCB, 0xDE, 0x07, 0xD7, 0x61,
+    0xC3, 0x79, 0x82, 0x2E, 0x76, 0x28, 0x3D, 0x65, 0xD8, 0x14, 0xA5, 0xC5, 0x99, 0xB6, 0x69, 0x9B,
+    0xC9, 0x1C, 0x61, 0xBC, 0xA6, 0xD2, 0x26, 0x72, 0x9F, 0x03, 0x9A, 0xD3, 0x04, 0x52, 0xCE, 0xD3,
+    0x8D, 0x00, 0x25, 0xE4, 0xE6, 0xC6, 0x37, 0x92, 0xA5, 0xD9, 0xE0, 0xFA, 0x75, 0x36, 0x66, 0xD2,
+    0xA3, 0x51, 0x4C, 0x5E, 0x16, 0x9F, 0xB1, 0x67, 0x86, 0x1F, 0x24, 0x1F, 0x9C, 0x09, 0xA8, 0x9B,
+    0xA3, 0xF8, 0x6E, 0x7A, 0xBA, 0x02, 0x5B, 0x5E, 0xD6
+};
+static const uint8_t eciesVector_p384_3_msg[61] = {
+    0x7B, 0x22, 0x69, 0x64, 0x22, 0x3A, 0x37, 0x2C, 0x22, 0x73, 0x65, 0x71, 0x22, 0x3A, 0x31, 0x30,
+    0x34, 0x32, 0x2C, 0x22, 0x74, 0x22, 0x3A, 0x32, 0x31, 0x2E, 0x35, 0x2C, 0x22, 0x72, 0x68, 0x22,
+    0x3A, 0x34, 0x30, 0x2E, 0x32, 0x2C, 0x22, 0x70, 0x22, 0x3A, 0x31, 0x30, 0x31, 0x33, 0x2E, 0x32,
+    0x2C, 0x22, 0x62, 0x61, 0x74, 0x22, 0x3A, 0x33, 0x2E, 0x36, 0x31, 0x7D, 0x5F
+};
+static const uint8_t eciesVector_p384_3_sealed[174] = {
+    0x04, 0x93, 0xA3, 0xE9, 0x39, 0xFE, 0x09, 0xAF, 0x24, 0xC4, 0x6C, 0x73, 0x27, 0xF4, 0x60, 0x1E,
+    0x6D, 0x76, 0x12, 0xEF, 0xD9, 0x1A, 0xFA, 0x86, 0x11, 0x56, 0x60, 0xDF, 0xC1, 0x4A, 0x02, 0xA2,
+    0xBB, 0xEC, 0xDB, 0xDB, 0x8D, 0x17, 0x69, 0x5F, 0x9F, 0xD6, 0x4E, 0x05, 0x60, 0x4D, 0x9D, 0xD6,
+    0x06, 0xFD, 0xDE, 0x1B, 0xF6, 0xB1, 0xC3, 0x17, 0xCA, 0xC3, 0x36, 0xB9, 0x4D, 0x35, 0x17, 0xC4,
+    0xBA, 0xDC, 0xA8, 0x9B, 0xB8, 0xD9, 0x6D, 0x7E, 0x68, 0x28, 0xA2, 0x25, 0xED, 0xB3, 0x95, 0x8A,
+    0xB9, 0xA9, 0x55, 0xB6, 0x52, 0x55, 0x0B, 0x0C, 0xE1, 0xF2, 0x9C, 0xDB, 0xA0, 0x87, 0xBB, 0x9A,
+    0x91, 0x24, 0x3F, 0xC3, 0xA4, 0x92, 0x9B, 0x02, 0x38, 0x4D, 0xBF, 0xD3, 0xB5, 0xD1, 0x34, 0x2E,
+    0xB3, 0xBE, 0x59, 0x37, 0xC4, 0xB8, 0x86, 0x13, 0x23, 0x36, 0x73, 0x0A, 0x01, 0x1C, 0x32, 0xAD,
+    0xDD, 0xE2, 0x43, 0x8A, 0x69, 0x48, 0x1E, 0xAA, 0x34, 0xCE, 0x29, 0x34, 0x05, 0x49, 0x68, 0xF3,
+    0x43, 0x71, 0x79, 0x04, 0xEB, 0xB0, 0xF7, 0x71, 0x25, 0xA4, 0x5E, 0x74, 0x04, 0xAA, 0x85, 0x5E,
+    0x44, 0x61, 0x91, 0x9E, 0x1F, 0x71, 0x21, 0xA4, 0x56, 0xB1, 0x73, 0x98, 0x91, 0xF5
+};
+static const uint8_t eciesVector_p384_3_aad[8] = {
+    0x73, 0x65, 0x6E, 0x73, 0x6F, 0x72, 0x2D, 0x37
+};
+
+static const st_Crypto_Ecies_Vector eciesVectors[] = {
+    { CRYPTO_ECC_CURVE_P256, eciesVector_p256_priv, 32UL, eciesVector_p256_pub, 65UL,
+      NULL, 0UL, NULL, 0UL, eciesVector_p256_0_sealed, 81UL },
+    { CRYPTO_ECC_CURVE_P256, eciesVector_p256_priv, 32UL, eciesVector_p256_pub, 65UL,
+      NULL, 0UL, eciesVector_p256_1_msg, 16UL, eciesVector_p256_1_sealed, 97UL },
+    { CRYPTO_ECC_CURVE_P256, eciesVector_p256_priv, 32UL, eciesVector_p256_pub, 65UL,
+      NULL, 0UL, eciesVector_p256_2_msg, 200UL, eciesVector_p256_2_sealed, 281UL },
+    { CRYPTO_ECC_CURVE_P256, eciesVector_p256_priv, 32UL, eciesVector_p256_pub, 65UL,
+      eciesVector_p256_3_aad, 8UL, eciesVector_p256_3_msg, 61UL, eciesVector_p256_3_sealed, 142UL },
+    { CRYPTO_ECC_CURVE_P384, eciesVector_p384_priv, 48UL, eciesVector_p384_pub, 97UL,
+      NULL, 0UL, NULL, 0UL, eciesVector_p384_0_sealed, 113UL },
+    { CRYPTO_ECC_CURVE_P384, eciesVector_p384_priv, 48UL, eciesVector_p384_pub, 97UL,
+      NULL, 0UL, eciesVector_p384_1_msg, 16UL, eciesVector_p384_1_sealed, 129UL },
+    { CRYPTO_ECC_CURVE_P384, eciesVector_p384_priv, 48UL, eciesVector_p384_pub, 97UL,
+      NULL, 0UL, eciesVector_p384_2_msg, 200UL, eciesVector_p384_2_sealed, 313UL },
+    { CRYPTO_ECC_CURVE_P384, eciesVector_p384_priv, 48UL, eciesVector_p384_pub, 97UL,
+      eciesVector_p384_3_aad, 8UL, eciesVector_p384_3_msg, 61UL, eciesVector_p384_3_sealed, 174UL },
+};
+
+#endif /* CRYPTO_ECIES_VECTORS_H */
@@ -0,0 +1,213 @@
+/*******************************************************************************
+  Crypto Hash Tree Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_tree.h
+
+  Summary:
+    This header file provides the building and the chunk-by-chunk verification
+    of binary hash (Merkle) trees over an image, for firmware received in
+    chunks.
+
+  Description:
+    The image is split into chunks of chunkSize bytes, the last one possibly
+    shorter. Each chunk is a leaf of the tree, hashed as H(0x00 || chunk);
+    two nodes are joined as H(0x01 || left || right), and the last node of a
+    level without a right neighbour moves up unchanged. This is the tree of
+    RFC 6962 (Certificate Transparency), with H the SHA algorithm given at
+    init, SHA-256 or SHA-384 in practice.
+
+    CRYPTO_HASH_TREE_BuilderUpdate() takes the image in pieces of any size
+    and keeps one pending node per level, so the root of n chunks needs
+    log2(n) nodes of RAM. Whole chunks are hashed straight from the caller's
+    buffer, one Crypto_Hash_Sha_Update() per chunk, with no copy.
+
+    CRYPTO_HASH_TREE_VerifyChunk() checks one chunk against a trusted root
+    with the proof sent along with it: the sibling of each node on the path
+    from the leaf to the root. The verifier keeps the siblings it has
+    authenticated, one per level, and stops hashing as soon as the path
+    reaches one of them; when the chunks arrive in order this takes on
+    average one node hash per chunk besides the leaf hash, as many as the
+    builder.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_HASH_TREE_H
+#define CRYPTO_HASH_TREE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Levels above the leaves; a tree has at most 2^CRYPTO_HASH_TREE_DEPTH_MAX chunks.
+#ifndef CRYPTO_HASH_TREE_DEPTH_MAX
+#define CRYPTO_HASH_TREE_DEPTH_MAX      (16UL)
+#endif
+
+// Longest node; 48 covers SHA-384, 64 is needed for SHA-512.
+#ifndef CRYPTO_HASH_TREE_DIGEST_MAX
+#define CRYPTO_HASH_TREE_DIGEST_MAX     (48UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum
+{
+    CRYPTO_HASH_TREE_ERROR_MISMATCH = -3,   // The chunk and its proof do not lead to the root
+    CRYPTO_HASH_TREE_ERROR_HASH = -2,       // A Crypto_Hash_Sha_* call failed
+    CRYPTO_HASH_TREE_ERROR_ARG = -1,
+    CRYPTO_HASH_TREE_SUCCESS = 0
+} CRYPTO_HASH_TREE_STATUS;
+
+typedef struct
+{
+    crypto_Hash_Algo_E algorithm;
+    uint32_t digestLen;
+    uint32_t chunkSize;
+    st_Crypto_Hash_Sha_Ctx leafCtx;     // Hash of the chunk being received
+    uint32_t leafBytes;                 // Bytes of it received
+    uint32_t leafCount;                 // Chunks completed
+    uint32_t pendingMask;               // Bit n set when pending[n] holds a node
+    uint8_t pending[CRYPTO_HASH_TREE_DEPTH_MAX + 1UL][CRYPTO_HASH_TREE_DIGEST_MAX];
+    uint8_t pair[1UL + (2UL * CRYPTO_HASH_TREE_DIGEST_MAX)];
+} CRYPTO_HASH_TREE_BUILDER;
+
+typedef struct
+{
+    crypto_Hash_Algo_E algorithm;
+    uint32_t digestLen;
+    uint32_t chunkSize;
+    uint32_t leafCount;
+    uint8_t root[CRYPTO_HASH_TREE_DIGEST_MAX];
+    st_Crypto_Hash_Sha_Ctx leafCtx;
+    uint32_t known[CRYPTO_HASH_TREE_DEPTH_MAX];    // Index + 1 of the authenticated node per level, 0 for none
+    uint8_t knownNode[CRYPTO_HASH_TREE_DEPTH_MAX][CRYPTO_HASH_TREE_DIGEST_MAX];
+    uint8_t pair[1UL + (2UL * CRYPTO_HASH_TREE_DIGEST_MAX)];
+} CRYPTO_HASH_TREE_VERIFIER;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Start building the tree of an image.
+ * @param builder The builder.
+ * @param algorithm The hash algorithm.
+ * @param chunkSize Bytes per chunk.
+ * @return CRYPTO_HASH_TREE_SUCCESS or CRYPTO_HASH_TREE_ERROR_ARG.
+ */
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderInit(CRYPTO_HASH_TREE_BUILDER *builder, crypto_Hash_Algo_E algorithm,
+                                                     uint32_t chunkSize);
+
+/**
+ * @brief Add the next bytes of the image.
+ * @param builder The builder.
+ * @param data The bytes; whole chunks are hashed where they are.
+ * @param dataLen Bytes, any number.
+ * @return CRYPTO_HASH_TREE_SUCCESS, CRYPTO_HASH_TREE_ERROR_HASH or
+ *         CRYPTO_HASH_TREE_ERROR_ARG, also when the image has more than
+ *         2^CRYPTO_HASH_TREE_DEPTH_MAX chunks.
+ */
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderUpdate(CRYPTO_HASH_TREE_BUILDER *builder, uint8_t *data,
+                                                       uint32_t dataLen);
+
+/**
+ * @brief End the image and get the root of its tree.
+ * @param builder The builder.
+ * @param root Receives the root, digestLen bytes.
+ * @param leafCount Receives the number of chunks, or NULL.
+ * @return CRYPTO_HASH_TREE_SUCCESS, CRYPTO_HASH_TREE_ERROR_HASH or
+ *         CRYPTO_HASH_TREE_ERROR_ARG, also for an empty image.
+ */
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderFinal(CRYPTO_HASH_TREE_BUILDER *builder, uint8_t *root,
+                                                      uint32_t *leafCount);
+
+/**
+ * @brief Start verifying the chunks of an image against its trusted root,
+ *        for example one taken from a signed manifest.
+ * @param verifier The verifier.
+ * @param algorithm The hash algorithm.
+ * @param chunkSize Bytes per chunk.
+ * @param leafCount Number of chunks.
+ * @param root The root.
+ * @return CRYPTO_HASH_TREE_SUCCESS or CRYPTO_HASH_TREE_ERROR_ARG.
+ */
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_VerifierInit(CRYPTO_HASH_TREE_VERIFIER *verifier,
+                                                      crypto_Hash_Algo_E algorithm, uint32_t chunkSize,
+                                                      uint32_t leafCount, const uint8_t *root);
+
+/**
+ * @brief Get the number of nodes in the proof of a chunk.
+ * @param leafCount Number of chunks.
+ * @param index Index of the chunk.
+ * @return The number of siblings on the path from the chunk to the root.
+ */
+uint32_t CRYPTO_HASH_TREE_ProofCount(uint32_t leafCount, uint32_t index);
+
+/**
+ * @brief Check a chunk against the root, in any order.
+ * @param verifier The verifier.
+ * @param index Index of the chunk.
+ * @param chunk The chunk.
+ * @param chunkLen Bytes; chunkSize except for the last chunk.
+ * @param proof The siblings from the leaf up, digestLen bytes each,
+ *        CRYPTO_HASH_TREE_ProofCount() of them. The verifier reads only those
+ *        below the first node it has already authenticated.
+ * @param proofCount Number of siblings in proof.
+ * @return CRYPTO_HASH_TREE_SUCCESS when the chunk belongs to the image,
+ *         CRYPTO_HASH_TREE_ERROR_MISMATCH when it or the proof does not,
+ *         CRYPTO_HASH_TREE_ERROR_HASH or CRYPTO_HASH_TREE_ERROR_ARG.
+ */
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_VerifyChunk(CRYPTO_HASH_TREE_VERIFIER *verifier, uint32_t index,
+                                                     uint8_t *chunk, uint32_t chunkLen, const uint8_t *proof,
+                                                     uint32_t proofCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_HASH_TREE_H */
@@ -0,0 +1,197 @@
+/*******************************************************************************
+  Crypto Latency Benchmark Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_latency_bench.h
+
+  Summary:
+    This header file provides the tail-latency benchmark of the Crypto_* APIs.
+
+  Description:
+    CRYPTO_LATENCY_BENCH_Run() times each operation of the offload server
+    (app/crypto_server_protocol.h) many times while a background interrupt
+    load fires at a chosen rate, and writes one CSV row per operation with
+    the minimum, median, 99th and 99.9th percentile and maximum latency.
+    Every sample is kept in a log-linear histogram of
+    CRYPTO_LATENCY_BENCH_BUCKETS counters, so memory does not grow with the
+    number of iterations; percentiles are reported as the upper edge of
+    their bucket, at most 1/CRYPTO_LATENCY_BENCH_SUB_BUCKETS above the
+    exact value, and never above the exact maximum.
+
+    The timestamp, the interrupt load and the CSV output are provided by the
+    application through the CRYPTO_LATENCY_BENCH_PORT_* functions, so the
+    same file runs on the board and on Linux with the host stand-in, and
+    both write the same CSV schema.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_LATENCY_BENCH_H
+#define CRYPTO_LATENCY_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Timed calls per operation when CRYPTO_LATENCY_BENCH_Run() is given 0.
+#ifndef CRYPTO_LATENCY_BENCH_ITERATIONS
+#define CRYPTO_LATENCY_BENCH_ITERATIONS         (10000UL)
+#endif
+
+// Timed calls per ECDSA/ECDH operation when CRYPTO_LATENCY_BENCH_Run() is given 0.
+#ifndef CRYPTO_LATENCY_BENCH_PKE_ITERATIONS
+#define CRYPTO_LATENCY_BENCH_PKE_ITERATIONS     (500UL)
+#endif
+
+// Untimed calls made before the timed calls of each operation.
+#ifndef CRYPTO_LATENCY_BENCH_WARMUP
+#define CRYPTO_LATENCY_BENCH_WARMUP             (4UL)
+#endif
+
+/* Background interrupt rates, in Hz, swept by the applications. 0 runs
+ * without background interrupts. */
+#ifndef CRYPTO_LATENCY_BENCH_LOAD_RATES
+#define CRYPTO_LATENCY_BENCH_LOAD_RATES         { 0UL, 1000UL, 10000UL, 50000UL }
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_LATENCY_BENCH_CSV_HEADER \
+    "op,payload_bytes,load_hz,samples,errors,min_ns,p50_ns,p99_ns,p999_ns,max_ns"
+
+/* Values below CRYPTO_LATENCY_BENCH_SUB_BUCKETS ticks have a bucket each;
+ * every higher power of two is split into CRYPTO_LATENCY_BENCH_SUB_BUCKETS
+ * buckets, up to the full 32-bit range. */
+#define CRYPTO_LATENCY_BENCH_SUB_BITS           (4UL)
+#define CRYPTO_LATENCY_BENCH_SUB_BUCKETS        (1UL << CRYPTO_LATENCY_BENCH_SUB_BITS)
+#define CRYPTO_LATENCY_BENCH_BUCKETS \
+    ((33UL - CRYPTO_LATENCY_BENCH_SUB_BITS) * CRYPTO_LATENCY_BENCH_SUB_BUCKETS)
+
+// Percentiles, in hundredths of a percent, for CRYPTO_LATENCY_BENCH_Percentile().
+#define CRYPTO_LATENCY_BENCH_P50                (5000UL)
+#define CRYPTO_LATENCY_BENCH_P99                (9900UL)
+#define CRYPTO_LATENCY_BENCH_P999               (9990UL)
+
+typedef struct
+{
+    uint32_t count;                             // Samples added
+    uint32_t min;                               // Smallest sample, in ticks
+    uint32_t max;                               // Largest sample, in ticks
+    uint32_t bins[CRYPTO_LATENCY_BENCH_BUCKETS];
+} CRYPTO_LATENCY_BENCH_HISTOGRAM;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Empty a histogram.
+ * @param histogram The histogram.
+ */
+void CRYPTO_LATENCY_BENCH_HistogramClear(CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram);
+
+/**
+ * @brief Add one sample to a histogram.
+ * @param histogram The histogram.
+ * @param ticks The sample, in timestamp ticks.
+ */
+void CRYPTO_LATENCY_BENCH_HistogramAdd(CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram, uint32_t ticks);
+
+/**
+ * @brief Get a percentile of the samples in a histogram.
+ * @param histogram The histogram.
+ * @param hundredths The percentile in hundredths of a percent, for example
+ *        CRYPTO_LATENCY_BENCH_P99.
+ * @return The upper edge of the bucket holding the percentile, limited to
+ *         the maximum sample, in ticks; 0 for an empty histogram.
+ */
+uint32_t CRYPTO_LATENCY_BENCH_Percentile(const CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram, uint32_t hundredths);
+
+/**
+ * @brief Time the benchmark operations under one background interrupt load
+ *        and write one CSV row per operation (CRYPTO_LATENCY_BENCH_CSV_HEADER)
+ *        through CRYPTO_LATENCY_BENCH_PORT_WriteLine(). The load runs only
+ *        while calls are timed, never while rows are written.
+ * @param op Name of the only operation to run, or NULL for all of them.
+ * @param loadRateHz Rate passed to CRYPTO_LATENCY_BENCH_PORT_LoadStart().
+ * @param iterations Timed calls per operation, or 0 for the defaults.
+ * @return The number of rows written.
+ */
+uint32_t CRYPTO_LATENCY_BENCH_Run(const char *op, uint32_t loadRateHz, uint32_t iterations);
+
+/**
+ * @brief Free-running timestamp. Provided by the application.
+ * @return The current tick count.
+ */
+uint32_t CRYPTO_LATENCY_BENCH_PORT_Timestamp(void);
+
+/**
+ * @brief Tick rate of CRYPTO_LATENCY_BENCH_PORT_Timestamp(). Provided by the application.
+ * @return Ticks per second.
+ */
+uint32_t CRYPTO_LATENCY_BENCH_PORT_TickRate(void);
+
+/**
+ * @brief Start the background interrupt load. Provided by the application.
+ * @param rateHz Interrupts per second; 0 starts nothing.
+ */
+void CRYPTO_LATENCY_BENCH_PORT_LoadStart(uint32_t rateHz);
+
+/**
+ * @brief Stop the background interrupt load. Provided by the application.
+ */
+void CRYPTO_LATENCY_BENCH_PORT_LoadStop(void);
+
+/**
+ * @brief Write one line of output. Provided by the application, which
+ *        appends its own line ending.
+ * @param line NUL-terminated text without a line ending.
+ */
+void CRYPTO_LATENCY_BENCH_PORT_WriteLine(const char *line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_LATENCY_BENCH_H */
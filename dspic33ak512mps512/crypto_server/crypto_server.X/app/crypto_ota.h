@@ -0,0 +1,186 @@
+/*******************************************************************************
+  Crypto OTA Receiver Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ota.h
+
+  Summary:
+    This header file provides the reception of an AES-GCM encrypted firmware
+    image over a UART into a flash slot, with reception, decryption and
+    flash programming overlapped.
+
+  Description:
+    The image arrives as a header, the ciphertext and the GCM tag:
+      magic "OTA1" | image length, 32-bit little endian | 12-byte IV
+      ciphertext, image length bytes
+      16-byte tag
+    The header is the additional authenticated data. The UART receive
+    interrupt passes each byte to CRYPTO_OTA_RxByte(), which fills one of two
+    ciphertext blocks of CRYPTO_OTA_BLOCK_SIZE bytes while
+    CRYPTO_OTA_Task(), called from the main loop, decrypts the other with
+    Crypto_Aead_AesGcm_Cipher() into one of two plaintext blocks and starts
+    programming the previous plaintext block into the slot. The flash port
+    programs in the background where the NVM controller allows it, so the
+    three stages run at the same time and the image arrives at the UART rate.
+
+    Plaintext reaches the slot before the tag is known, so the slot must not
+    be executable until activation: once the tag received matches the one
+    from Crypto_Aead_AesGcm_Final(), CRYPTO_OTA_Task() calls
+    CRYPTO_OTA_PORT_Activate(). A receive interrupt that finds both
+    ciphertext blocks still full fails the transfer with
+    CRYPTO_OTA_ERROR_OVERRUN; one block of time at the UART rate is the
+    budget for decrypting and programming one block.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_OTA_H
+#define CRYPTO_OTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Bytes per ciphertext and plaintext block; four blocks are kept in RAM.
+#ifndef CRYPTO_OTA_BLOCK_SIZE
+#define CRYPTO_OTA_BLOCK_SIZE           (4096UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_OTA_MAGIC                "OTA1"
+#define CRYPTO_OTA_IV_SIZE              (12UL)
+#define CRYPTO_OTA_HEADER_SIZE          (8UL + CRYPTO_OTA_IV_SIZE)
+#define CRYPTO_OTA_TAG_SIZE             (16UL)
+
+typedef enum
+{
+    CRYPTO_OTA_ERROR_FLASH = -6,        // The flash port failed or the image does not fit the slot
+    CRYPTO_OTA_ERROR_OVERRUN = -5,      // A byte arrived with both ciphertext blocks full
+    CRYPTO_OTA_ERROR_HEADER = -4,       // Bad magic or image length
+    CRYPTO_OTA_ERROR_AUTH = -3,         // The tag does not match; the image is not activated
+    CRYPTO_OTA_ERROR_CIPHER = -2,       // A Crypto_Aead_AesGcm_* call failed
+    CRYPTO_OTA_ERROR_ARG = -1,
+    CRYPTO_OTA_SUCCESS = 0,             // The image is in the slot and activated
+    CRYPTO_OTA_PENDING = 1              // Still receiving
+} CRYPTO_OTA_STATUS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get ready to receive an image, dropping any transfer in progress.
+ * @param key The AES key, copied.
+ * @param keyLen 16, 24 or 32.
+ * @param slotAddress Flash address the image is programmed at.
+ * @param slotSize Bytes of the slot.
+ * @return CRYPTO_OTA_PENDING, or CRYPTO_OTA_ERROR_ARG.
+ */
+CRYPTO_OTA_STATUS CRYPTO_OTA_Start(const uint8_t *key, uint32_t keyLen, uint32_t slotAddress, uint32_t slotSize);
+
+/**
+ * @brief Take one received byte. Called by the UART receive interrupt.
+ * @param byte The byte.
+ */
+void CRYPTO_OTA_RxByte(uint8_t byte);
+
+/**
+ * @brief Run the decryption and programming stages. Called from the main
+ *        loop until it returns something other than CRYPTO_OTA_PENDING.
+ * @return CRYPTO_OTA_PENDING while the transfer goes on, CRYPTO_OTA_SUCCESS
+ *         once the image is activated, or the error that ended it.
+ */
+CRYPTO_OTA_STATUS CRYPTO_OTA_Task(void);
+
+/**
+ * @brief Get the progress of the transfer.
+ * @param received Receives the ciphertext bytes received, or NULL.
+ * @param committed Receives the plaintext bytes programmed, or NULL.
+ * @param imageLength Receives the image length, 0 until the header is in,
+ *        or NULL.
+ */
+void CRYPTO_OTA_GetProgress(uint32_t *received, uint32_t *committed, uint32_t *imageLength);
+
+/**
+ * @brief Mask or unmask the UART receive interrupt, so that the main loop
+ *        sees a consistent state. Provided by the application.
+ */
+void CRYPTO_OTA_PORT_RxLock(void);
+void CRYPTO_OTA_PORT_RxUnlock(void);
+
+/**
+ * @brief Start programming bytes into the slot, erasing the pages they
+ *        reach first. Provided by the application. The data stays valid
+ *        until CRYPTO_OTA_PORT_FlashBusy() returns false.
+ * @param address Flash address.
+ * @param data The bytes.
+ * @param length Bytes, at most CRYPTO_OTA_BLOCK_SIZE.
+ * @return true when programming started.
+ */
+bool CRYPTO_OTA_PORT_FlashWrite(uint32_t address, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Tell whether the last programming is still going on. Provided by
+ *        the application; a port that programs before returning from
+ *        CRYPTO_OTA_PORT_FlashWrite() returns false.
+ * @param failed Set to true when the last programming failed.
+ * @return true while programming.
+ */
+bool CRYPTO_OTA_PORT_FlashBusy(bool *failed);
+
+/**
+ * @brief Make the authenticated image in the slot the one to boot. Provided
+ *        by the application.
+ * @param address Flash address of the slot.
+ * @param length Image bytes.
+ * @return true when the image was activated.
+ */
+bool CRYPTO_OTA_PORT_Activate(uint32_t address, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_OTA_H */
@@ -0,0 +1,198 @@
+/* RFC 6979 ECDSA test vectors of appendix A.2.5 (P-256, SHA-256), A.2.6
+ * (P-384, SHA-384) and A.2.7 (P-521, SHA-512), messages "sample" and "test":
+ * private key, public key, hash of the message, nonce k and signature r || s. */
+
+#ifndef CRYPTO_RFC6979_VECTORS_H
+#define CRYPTO_RFC6979_VECTORS_H
+
+#include "crypto/common_crypto/crypto_common.h"
+
+typedef struct{
+    crypto_EccCurveType_E curve_en;
+    const char *ptr_msg;
+    const uint8_t *ptr_privKey;
+    uint32_t privKeyLen;
+    const uint8_t *ptr_pubKey;                  // 0x04 || X || Y
+    const uint8_t *ptr_hash;
+    uint32_t hashLen;
+    const uint8_t *ptr_nonce;
+    const uint8_t *ptr_sig;                     // r || s
+}st_Crypto_Rfc6979_Vector;
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+static const uint8_t rfc6979Vector_p256_priv[32] = {
+    0xC9, 0xAF, 0xA9, 0xD8, 0x45, 0xBA, 0x75, 0x16, 0x6B, 0x5C, 0x21, 0x57, 0x67, 0xB1, 0xD6, 0x93,
+    0x4E, 0x50, 0xC3, 0xDB, 0x36, 0xE8, 0x9B, 0x12, 0x7B, 0x8A, 0x62, 0x2B, 0x12, 0x0F, 0x67, 0x21
+};
+static const uint8_t rfc6979Vector_p256_pub[65] = {
+    0x04, 0x60, 0xFE, 0xD4, 0xBA, 0x25, 0x5A, 0x9D, 0x31, 0xC9, 0x61, 0xEB, 0x74, 0xC6, 0x35, 0x6D,
+    0x68, 0xC0, 0x49, 0xB8, 0x92, 0x3B, 0x61, 0xFA, 0x6C, 0xE6, 0x69, 0x62, 0x2E, 0x60, 0xF2, 0x9F,
+    0xB6, 0x79, 0x03, 0xFE, 0x10, 0x08, 0xB8, 0xBC, 0x99, 0xA4, 0x1A, 0xE9, 0xE9, 0x56, 0x28, 0xBC,
+    0x64, 0xF2, 0xF1, 0xB2, 0x0C, 0x2D, 0x7E, 0x9F, 0x51, 0x77, 0xA3, 0xC2, 0x94, 0xD4, 0x46, 0x22,
+    0x99
+};
+static const uint8_t rfc6979Vector_p256_sample_hash[32] = {
+    0xAF, 0x2B, 0xDB, 0xE1, 0xAA, 0x9B, 0x6E, 0xC1, 0xE2, 0xAD, 0xE1, 0xD6, 0x94, 0xF4, 0x1F, 0xC7,
+    0x1A, 0x83, 0x1D, 0x02, 0x68, 0xE9, 0x89, 0x15, 0x62, 0x11, 0x3D, 0x8A, 0x62, 0xAD, 0xD1, 0xBF
+};
+static const uint8_t rfc6979Vector_p256_sample_k[32] = {
+    0xA6, 0xE3, 0xC5, 0x7D, 0xD0, 0x1A, 0xBE, 0x90, 0x08, 0x65, 0x38, 0x39, 0x83, 0x55, 0xDD, 0x4C,
+    0x3B, 0x17, 0xAA, 0x87, 0x33, 0x82, 0xB0, 0xF2, 0x4D, 0x61, 0x29, 0x49, 0x3D, 0x8A, 0xAD, 0x60
+};
+static const uint8_t rfc6979Vector_p256_sample_sig[64] = {
+    0xEF, 0xD4, 0x8B, 0x2A, 0xAC, 0xB6, 0xA8, 0xFD, 0x11, 0x40, 0xDD, 0x9C, 0xD4, 0x5E, 0x81, 0xD6,
+    0x9D, 0x2C, 0x87, 0x7B, 0x56, 0xAA, 0xF9, 0x91, 0xC3, 0x4D, 0x0E, 0xA8, 0x4E, 0xAF, 0x37, 0x16,
+    0xF7, 0xCB, 0x1C, 0x94, 0x2D, 0x65, 0x7C, 0x41, 0xD4, 0x36, 0xC7, 0xA1, 0xB6, 0xE2, 0x9F, 0x65,
+    0xF3, 0xE9, 0x00, 0xDB, 0xB9, 0xAF, 0xF4, 0x06, 0x4D, 0xC4, 0xAB, 0x2F, 0x84, 0x3A, 0xCD, 0xA8
+};
+static const uint8_t rfc6979Vector_p256_test_hash[32] = {
+    0x9F, 0x86, 0xD0, 0x81, 0x88, 0x4C, 0x7D, 0x65, 0x9A, 0x2F, 0xEA, 0xA0, 0xC5, 0x5A, 0xD0, 0x15,
+    0xA3, 0xBF, 0x4F, 0x1B, 0x2B, 0x0B, 0x82, 0x2C, 0xD1, 0x5D, 0x6C, 0x15, 0xB0, 0xF0, 0x0A, 0x08
+};
+static const uint8_t rfc6979Vector_p256_test_k[32] = {
+    0xD1, 0x6B, 0x6A, 0xE8, 0x27, 0xF1, 0x71, 0x75, 0xE0, 0x40, 0x87, 0x1A, 0x1C, 0x7E, 0xC3, 0x50,
+    0x01, 0x92, 0xC4, 0xC9, 0x26, 0x77, 0x33, 0x6E, 0xC2, 0x53, 0x7A, 0xCA, 0xEE, 0x00, 0x08, 0xE0
+};
+static const uint8_t rfc6979Vector_p256_test_sig[64] = {
+    0xF1, 0xAB, 0xB0, 0x23, 0x51, 0x83, 0x51, 0xCD, 0x71, 0xD8, 0x81, 0x56, 0x7B, 0x1E, 0xA6, 0x63,
+    0xED, 0x3E, 0xFC, 0xF6, 0xC5, 0x13, 0x2B, 0x35, 0x4F, 0x28, 0xD3, 0xB0, 0xB7, 0xD3, 0x83, 0x67,
+    0x01, 0x9F, 0x41, 0x13, 0x74, 0x2A, 0x2B, 0x14, 0xBD, 0x25, 0x92, 0x6B, 0x49, 0xC6, 0x49, 0x15,
+    0x5F, 0x26, 0x7E, 0x60, 0xD3, 0x81, 0x4B, 0x4C, 0x0C, 0xC8, 0x42, 0x50, 0xE4, 0x6F, 0x00, 0x83
+};
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+static const uint8_t rfc6979Vector_p384_priv[48] = {
+    0x6B, 0x9D, 0x3D, 0xAD, 0x2E, 0x1B, 0x8C, 0x1C, 0x05, 0xB1, 0x98, 0x75, 0xB6, 0x65, 0x9F, 0x4D,
+    0xE2, 0x3C, 0x3B, 0x66, 0x7B, 0xF2, 0x97, 0xBA, 0x9A, 0xA4, 0x77, 0x40, 0x78, 0x71, 0x37, 0xD8,
+    0x96, 0xD5, 0x72, 0x4E, 0x4C, 0x70, 0xA8, 0x25, 0xF8, 0x72, 0xC9, 0xEA, 0x60, 0xD2, 0xED, 0xF5
+};
+static const uint8_t rfc6979Vector_p384_pub[97] = {
+    0x04, 0xEC, 0x3A, 0x4E, 0x41, 0x5B, 0x4E, 0x19, 0xA4, 0x56, 0x86, 0x18, 0x02, 0x9F, 0x42, 0x7F,
+    0xA5, 0xDA, 0x9A, 0x8B, 0xC4, 0xAE, 0x92, 0xE0, 0x2E, 0x06, 0xAA, 0xE5, 0x28, 0x6B, 0x30, 0x0C,
+    0x64, 0xDE, 0xF8, 0xF0, 0xEA, 0x90, 0x55, 0x86, 0x60, 0x64, 0xA2, 0x54, 0x51, 0x54, 0x80, 0xBC,
+    0x13, 0x80, 0x15, 0xD9, 0xB7, 0x2D, 0x7D, 0x57, 0x24, 0x4E, 0xA8, 0xEF, 0x9A, 0xC0, 0xC6, 0x21,
+    0x89, 0x67, 0x08, 0xA5, 0x93, 0x67, 0xF9, 0xDF, 0xB9, 0xF5, 0x4C, 0xA8, 0x4B, 0x3F, 0x1C, 0x9D,
+    0xB1, 0x28, 0x8B, 0x23, 0x1C, 0x3A, 0xE0, 0xD4, 0xFE, 0x73, 0x44, 0xFD, 0x25, 0x33, 0x26, 0x47,
+    0x20
+};
+static const uint8_t rfc6979Vector_p384_sample_hash[48] = {
+    0x9A, 0x90, 0x83, 0x50, 0x5B, 0xC9, 0x22, 0x76, 0xAE, 0xC4, 0xBE, 0x31, 0x26, 0x96, 0xEF, 0x7B,
+    0xF3, 0xBF, 0x60, 0x3F, 0x4B, 0xBD, 0x38, 0x11, 0x96, 0xA0, 0x29, 0xF3, 0x40, 0x58, 0x53, 0x12,
+    0x31, 0x3B, 0xCA, 0x4A, 0x9B, 0x5B, 0x89, 0x0E, 0xFE, 0xE4, 0x2C, 0x77, 0xB1, 0xEE, 0x25, 0xFE
+};
+static const uint8_t rfc6979Vector_p384_sample_k[48] = {
+    0x94, 0xED, 0x91, 0x0D, 0x1A, 0x09, 0x9D, 0xAD, 0x32, 0x54, 0xE9, 0x24, 0x2A, 0xE8, 0x5A, 0xBD,
+    0xE4, 0xBA, 0x15, 0x16, 0x8E, 0xAF, 0x0C, 0xA8, 0x7A, 0x55, 0x5F, 0xD5, 0x6D, 0x10, 0xFB, 0xCA,
+    0x29, 0x07, 0xE3, 0xE8, 0x3B, 0xA9, 0x53, 0x68, 0x62, 0x3B, 0x8C, 0x46, 0x86, 0x91, 0x5C, 0xF9
+};
+static const uint8_t rfc6979Vector_p384_sample_sig[96] = {
+    0x94, 0xED, 0xBB, 0x92, 0xA5, 0xEC, 0xB8, 0xAA, 0xD4, 0x73, 0x6E, 0x56, 0xC6, 0x91, 0x91, 0x6B,
+    0x3F, 0x88, 0x14, 0x06, 0x66, 0xCE, 0x9F, 0xA7, 0x3D, 0x64, 0xC4, 0xEA, 0x95, 0xAD, 0x13, 0x3C,
+    0x81, 0xA6, 0x48, 0x15, 0x2E, 0x44, 0xAC, 0xF9, 0x6E, 0x36, 0xDD, 0x1E, 0x80, 0xFA, 0xBE, 0x46,
+    0x99, 0xEF, 0x4A, 0xEB, 0x15, 0xF1, 0x78, 0xCE, 0xA1, 0xFE, 0x40, 0xDB, 0x26, 0x03, 0x13, 0x8F,
+    0x13, 0x0E, 0x74, 0x0A, 0x19, 0x62, 0x45, 0x26, 0x20, 0x3B, 0x63, 0x51, 0xD0, 0xA3, 0xA9, 0x4F,
+    0xA3, 0x29, 0xC1, 0x45, 0x78, 0x6E, 0x67, 0x9E, 0x7B, 0x82, 0xC7, 0x1A, 0x38, 0x62, 0x8A, 0xC8
+};
+static const uint8_t rfc6979Vector_p384_test_hash[48] = {
+    0x76, 0x84, 0x12, 0x32, 0x0F, 0x7B, 0x0A, 0xA5, 0x81, 0x2F, 0xCE, 0x42, 0x8D, 0xC4, 0x70, 0x6B,
+    0x3C, 0xAE, 0x50, 0xE0, 0x2A, 0x64, 0xCA, 0xA1, 0x6A, 0x78, 0x22, 0x49, 0xBF, 0xE8, 0xEF, 0xC4,
+    0xB7, 0xEF, 0x1C, 0xCB, 0x12, 0x62, 0x55, 0xD1, 0x96, 0x04, 0x7D, 0xFE, 0xDF, 0x17, 0xA0, 0xA9
+};
+static const uint8_t rfc6979Vector_p384_test_k[48] = {
+    0x01, 0x5E, 0xE4, 0x6A, 0x5B, 0xF8, 0x87, 0x73, 0xED, 0x91, 0x23, 0xA5, 0xAB, 0x08, 0x07, 0x96,
+    0x2D, 0x19, 0x37, 0x19, 0x50, 0x3C, 0x52, 0x7B, 0x03, 0x1B, 0x4C, 0x2D, 0x22, 0x50, 0x92, 0xAD,
+    0xA7, 0x1F, 0x4A, 0x45, 0x9B, 0xC0, 0xDA, 0x98, 0xAD, 0xB9, 0x58, 0x37, 0xDB, 0x83, 0x12, 0xEA
+};
+static const uint8_t rfc6979Vector_p384_test_sig[96] = {
+    0x82, 0x03, 0xB6, 0x3D, 0x3C, 0x85, 0x3E, 0x8D, 0x77, 0x22, 0x7F, 0xB3, 0x77, 0xBC, 0xF7, 0xB7,
+    0xB7, 0x72, 0xE9, 0x78, 0x92, 0xA8, 0x0F, 0x36, 0xAB, 0x77, 0x5D, 0x50, 0x9D, 0x7A, 0x5F, 0xEB,
+    0x05, 0x42, 0xA7, 0xF0, 0x81, 0x29, 0x98, 0xDA, 0x8F, 0x1D, 0xD3, 0xCA, 0x3C, 0xF0, 0x23, 0xDB,
+    0xDD, 0xD0, 0x76, 0x04, 0x48, 0xD4, 0x2D, 0x8A, 0x43, 0xAF, 0x45, 0xAF, 0x83, 0x6F, 0xCE, 0x4D,
+    0xE8, 0xBE, 0x06, 0xB4, 0x85, 0xE9, 0xB6, 0x1B, 0x82, 0x7C, 0x2F, 0x13, 0x17, 0x39, 0x23, 0xE0,
+    0x6A, 0x73, 0x9F, 0x04, 0x06, 0x49, 0xA6, 0x67, 0xBF, 0x3B, 0x82, 0x82, 0x46, 0xBA, 0xA5, 0xA5
+};
+#endif
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+static const uint8_t rfc6979Vector_p521_priv[66] = {
+    0x00, 0xFA, 0xD0, 0x6D, 0xAA, 0x62, 0xBA, 0x3B, 0x25, 0xD2, 0xFB, 0x40, 0x13, 0x3D, 0xA7, 0x57,
+    0x20, 0x5D, 0xE6, 0x7F, 0x5B, 0xB0, 0x01, 0x8F, 0xEE, 0x8C, 0x86, 0xE1, 0xB6, 0x8C, 0x7E, 0x75,
+    0xCA, 0xA8, 0x96, 0xEB, 0x32, 0xF1, 0xF4, 0x7C, 0x70, 0x85, 0x58, 0x36, 0xA6, 0xD1, 0x6F, 0xCC,
+    0x14, 0x66, 0xF6, 0xD8, 0xFB, 0xEC, 0x67, 0xDB, 0x89, 0xEC, 0x0C, 0x08, 0xB0, 0xE9, 0x96, 0xB8,
+    0x35, 0x38
+};
+static const uint8_t rfc6979Vector_p521_pub[133] = {
+    0x04, 0x01, 0x89, 0x45, 0x50, 0xD0, 0x78, 0x59, 0x32, 0xE0, 0x0E, 0xAA, 0x23, 0xB6, 0x94, 0xF2,
+    0x13, 0xF8, 0xC3, 0x12, 0x1F, 0x86, 0xDC, 0x97, 0xA0, 0x4E, 0x5A, 0x71, 0x67, 0xDB, 0x4E, 0x5B,
+    0xCD, 0x37, 0x11, 0x23, 0xD4, 0x6E, 0x45, 0xDB, 0x6B, 0x5D, 0x53, 0x70, 0xA7, 0xF2, 0x0F, 0xB6,
+    0x33, 0x15, 0x5D, 0x38, 0xFF, 0xA1, 0x6D, 0x2B, 0xD7, 0x61, 0xDC, 0xAC, 0x47, 0x4B, 0x9A, 0x2F,
+    0x50, 0x23, 0xA4, 0x00, 0x49, 0x31, 0x01, 0xC9, 0x62, 0xCD, 0x4D, 0x2F, 0xDD, 0xF7, 0x82, 0x28,
+    0x5E, 0x64, 0x58, 0x41, 0x39, 0xC2, 0xF9, 0x1B, 0x47, 0xF8, 0x7F, 0xF8, 0x23, 0x54, 0xD6, 0x63,
+    0x0F, 0x74, 0x6A, 0x28, 0xA0, 0xDB, 0x25, 0x74, 0x1B, 0x5B, 0x34, 0xA8, 0x28, 0x00, 0x8B, 0x22,
+    0xAC, 0xC2, 0x3F, 0x92, 0x4F, 0xAA, 0xFB, 0xD4, 0xD3, 0x3F, 0x81, 0xEA, 0x66, 0x95, 0x6D, 0xFE,
+    0xAA, 0x2B, 0xFD, 0xFC, 0xF5
+};
+static const uint8_t rfc6979Vector_p521_sample_hash[64] = {
+    0x39, 0xA5, 0xE0, 0x4A, 0xAF, 0xF7, 0x45, 0x5D, 0x98, 0x50, 0xC6, 0x05, 0x36, 0x4F, 0x51, 0x4C,
+    0x11, 0x32, 0x4C, 0xE6, 0x40, 0x16, 0x96, 0x0D, 0x23, 0xD5, 0xDC, 0x57, 0xD3, 0xFF, 0xD8, 0xF4,
+    0x9A, 0x73, 0x94, 0x68, 0xAB, 0x80, 0x49, 0xBF, 0x18, 0xEE, 0xF8, 0x20, 0xCD, 0xB1, 0xAD, 0x6C,
+    0x90, 0x15, 0xF8, 0x38, 0x55, 0x6B, 0xC7, 0xFA, 0xD4, 0x13, 0x8B, 0x23, 0xFD, 0xF9, 0x86, 0xC7
+};
+static const uint8_t rfc6979Vector_p521_sample_k[66] = {
+    0x01, 0xDA, 0xE2, 0xEA, 0x07, 0x1F, 0x81, 0x10, 0xDC, 0x26, 0x88, 0x2D, 0x4D, 0x5E, 0xAE, 0x06,
+    0x21, 0xA3, 0x25, 0x6F, 0xC8, 0x84, 0x7F, 0xB9, 0x02, 0x2E, 0x2B, 0x7D, 0x28, 0xE6, 0xF1, 0x01,
+    0x98, 0xB1, 0x57, 0x4F, 0xDD, 0x03, 0xA9, 0x05, 0x3C, 0x08, 0xA1, 0x85, 0x4A, 0x16, 0x8A, 0xA5,
+    0xA5, 0x74, 0x70, 0xEC, 0x97, 0xDD, 0x5C, 0xE0, 0x90, 0x12, 0x4E, 0xF5, 0x2A, 0x2F, 0x7E, 0xCB,
+    0xFF, 0xD3
+};
+static const uint8_t rfc6979Vector_p521_sample_sig[132] = {
+    0x00, 0xC3, 0x28, 0xFA, 0xFC, 0xBD, 0x79, 0xDD, 0x77, 0x85, 0x03, 0x70, 0xC4, 0x63, 0x25, 0xD9,
+    0x87, 0xCB, 0x52, 0x55, 0x69, 0xFB, 0x63, 0xC5, 0xD3, 0xBC, 0x53, 0x95, 0x0E, 0x6D, 0x4C, 0x5F,
+    0x17, 0x4E, 0x25, 0xA1, 0xEE, 0x90, 0x17, 0xB5, 0xD4, 0x50, 0x60, 0x6A, 0xDD, 0x15, 0x2B, 0x53,
+    0x49, 0x31, 0xD7, 0xD4, 0xE8, 0x45, 0x5C, 0xC9, 0x1F, 0x9B, 0x15, 0xBF, 0x05, 0xEC, 0x36, 0xE3,
+    0x77, 0xFA, 0x00, 0x61, 0x7C, 0xCE, 0x7C, 0xF5, 0x06, 0x48, 0x06, 0xC4, 0x67, 0xF6, 0x78, 0xD3,
+    0xB4, 0x08, 0x0D, 0x6F, 0x1C, 0xC5, 0x0A, 0xF2, 0x6C, 0xA2, 0x09, 0x41, 0x73, 0x08, 0x28, 0x1B,
+    0x68, 0xAF, 0x28, 0x26, 0x23, 0xEA, 0xA6, 0x3E, 0x5B, 0x5C, 0x07, 0x23, 0xD8, 0xB8, 0xC3, 0x7F,
+    0xF0, 0x77, 0x7B, 0x1A, 0x20, 0xF8, 0xCC, 0xB1, 0xDC, 0xCC, 0x43, 0x99, 0x7F, 0x1E, 0xE0, 0xE4,
+    0x4D, 0xA4, 0xA6, 0x7A
+};
+static const uint8_t rfc6979Vector_p521_test_hash[64] = {
+    0xEE, 0x26, 0xB0, 0xDD, 0x4A, 0xF7, 0xE7, 0x49, 0xAA, 0x1A, 0x8E, 0xE3, 0xC1, 0x0A, 0xE9, 0x92,
+    0x3F, 0x61, 0x89, 0x80, 0x77, 0x2E, 0x47, 0x3F, 0x88, 0x19, 0xA5, 0xD4, 0x94, 0x0E, 0x0D, 0xB2,
+    0x7A, 0xC1, 0x85, 0xF8, 0xA0, 0xE1, 0xD5, 0xF8, 0x4F, 0x88, 0xBC, 0x88, 0x7F, 0xD6, 0x7B, 0x14,
+    0x37, 0x32, 0xC3, 0x04, 0xCC, 0x5F, 0xA9, 0xAD, 0x8E, 0x6F, 0x57, 0xF5, 0x00, 0x28, 0xA8, 0xFF
+};
+static const uint8_t rfc6979Vector_p521_test_k[66] = {
+    0x01, 0x62, 0x00, 0x81, 0x30, 0x20, 0xEC, 0x98, 0x68, 0x63, 0xBE, 0xDF, 0xC1, 0xB1, 0x21, 0xF6,
+    0x05, 0xC1, 0x21, 0x56, 0x45, 0x01, 0x8A, 0xEA, 0x1A, 0x7B, 0x21, 0x5A, 0x56, 0x4D, 0xE9, 0xEB,
+    0x1B, 0x38, 0xA6, 0x7A, 0xA1, 0x12, 0x8B, 0x80, 0xCE, 0x39, 0x1C, 0x4F, 0xB7, 0x11, 0x87, 0x65,
+    0x4A, 0xAA, 0x34, 0x31, 0x02, 0x7B, 0xFC, 0x7F, 0x39, 0x57, 0x66, 0xCA, 0x98, 0x8C, 0x96, 0x4D,
+    0xC5, 0x6D
+};
+static const uint8_t rfc6979Vector_p521_test_sig[132] = {
+    0x01, 0x3E, 0x99, 0x02, 0x0A, 0xBF, 0x5C, 0xEE, 0x75, 0x25, 0xD1, 0x6B, 0x69, 0xB2, 0x29, 0x65,
+    0x2A, 0xB6, 0xBD, 0xF2, 0xAF, 0xFC, 0xAE, 0xF3, 0x87, 0x73, 0xB4, 0xB7, 0xD0, 0x87, 0x25, 0xF1,
+    0x0C, 0xDB, 0x93, 0x48, 0x2F, 0xDC, 0xC5, 0x4E, 0xDC, 0xEE, 0x91, 0xEC, 0xA4, 0x16, 0x6B, 0x2A,
+    0x7C, 0x62, 0x65, 0xEF, 0x0C, 0xE2, 0xBD, 0x70, 0x51, 0xB7, 0xCE, 0xF9, 0x45, 0xBA, 0xBD, 0x47,
+    0xEE, 0x6D, 0x01, 0xFB, 0xD0, 0x01, 0x3C, 0x67, 0x4A, 0xA7, 0x9C, 0xB3, 0x98, 0x49, 0x52, 0x79,
+    0x16, 0xCE, 0x30, 0x1C, 0x66, 0xEA, 0x7C, 0xE8, 0xB8, 0x06, 0x82, 0x78, 0x6A, 0xD6, 0x0F, 0x98,
+    0xF7, 0xE7, 0x8A, 0x19, 0xCA, 0x69, 0xEF, 0xF5, 0xC5, 0x74, 0x00, 0xE3, 0xB3, 0xA0, 0xAD, 0x66,
+    0xCE, 0x09, 0x78, 0x21, 0x4D, 0x13, 0xBA, 0xF4, 0xE9, 0xAC, 0x60, 0x75, 0x2F, 0x7B, 0x15, 0x5E,
+    0x2D, 0xE4, 0xDC, 0xE3
+};
+#endif
+
+static const st_Crypto_Rfc6979_Vector rfc6979Vectors[] = {
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+    { CRYPTO_ECC_CURVE_P256, "sample", rfc6979Vector_p256_priv, 32UL, rfc6979Vector_p256_pub, rfc6979Vector_p256_sample_hash, 32UL, rfc6979Vector_p256_sample_k, rfc6979Vector_p256_sample_sig },
+    { CRYPTO_ECC_CURVE_P256, "test", rfc6979Vector_p256_priv, 32UL, rfc6979Vector_p256_pub, rfc6979Vector_p256_test_hash, 32UL, rfc6979Vector_p256_test_k, rfc6979Vector_p256_test_sig },
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+    { CRYPTO_ECC_CURVE_P384, "sample", rfc6979Vector_p384_priv, 48UL, rfc6979Vector_p384_pub, rfc6979Vector_p384_sample_hash, 48UL, rfc6979Vector_p384_sample_k, rfc6979Vector_p384_sample_sig },
+    { CRYPTO_ECC_CURVE_P384, "test", rfc6979Vector_p384_priv, 48UL, rfc6979Vector_p384_pub, rfc6979Vector_p384_test_hash, 48UL, rfc6979Vector_p384_test_k, rfc6979Vector_p384_test_sig },
+#endif
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+    { CRYPTO_ECC_CURVE_P521, "sample", rfc6979Vector_p521_priv, 66UL, rfc6979Vector_p521_pub, rfc6979Vector_p521_sample_hash, 64UL, rfc6979Vector_p521_sample_k, rfc6979Vector_p521_sample_sig },
+    { CRYPTO_ECC_CURVE_P521, "test", rfc6979Vector_p521_priv, 66UL, rfc6979Vector_p521_pub, rfc6979Vector_p521_test_hash, 64UL, rfc6979Vector_p521_test_k, rfc6979Vector_p521_test_sig },
+#endif
+};
+
+#endif /* CRYPTO_RFC6979_VECTORS_H */
@@ -0,0 +1,135 @@
+/*******************************************************************************
+  Crypto Server Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server.h
+
+  Summary:
+    This header file provides the transport-independent crypto offload server.
+
+  Description:
+    Received bytes are handed to CRYPTO_SERVER_RxByte(), normally from the
+    UART receive interrupt. Complete, CRC-checked request frames are queued in
+    a ring of CRYPTO_SERVER_SLOT_COUNT receive slots. CRYPTO_SERVER_Task(),
+    called from the main loop, executes the oldest queued request through the
+    Crypto_* APIs, releases its slot and passes the response frame to
+    CRYPTO_SERVER_PORT_Write(). With an interrupt-driven transmit queue the
+    next request is received and computed while the previous response is
+    still being sent.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SERVER_H
+#define CRYPTO_SERVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app/crypto_server_protocol.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+/* Number of request frames that can be queued. Clients must not have more
+ * requests than this in flight; CRYPTO_SERVER_OP_INFO reports the value. */
+#ifndef CRYPTO_SERVER_SLOT_COUNT
+#define CRYPTO_SERVER_SLOT_COUNT    (4U)
+#endif
+
+// Session ID used for every Crypto_* call made by the server.
+#define CRYPTO_SERVER_SESSION_ID    (1U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Server frame counters.
+ */
+typedef struct
+{
+    uint32_t rxFrames;      // Request frames accepted into a slot.
+    uint32_t txFrames;      // Response frames sent.
+    uint32_t crcErrors;     // Request frames dropped due to a CRC mismatch.
+    uint32_t overruns;      // Request frames dropped because all slots were full.
+} CRYPTO_SERVER_STATS;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Reset the receive slots, parser state and counters.
+ */
+void CRYPTO_SERVER_Initialize(void);
+
+/**
+ * @brief Feed one received byte into the frame parser.
+ * @param byte The received byte.
+ * @note Safe to call from the receive interrupt while CRYPTO_SERVER_Task()
+ *       runs in the main loop (single producer, single consumer).
+ */
+void CRYPTO_SERVER_RxByte(uint8_t byte);
+
+/**
+ * @brief Execute the oldest queued request and send its response.
+ * @return TRUE if a request was processed, FALSE if none was queued.
+ */
+bool CRYPTO_SERVER_Task(void);
+
+/**
+ * @brief Get a copy of the server frame counters.
+ * @param stats Pointer to the structure to fill.
+ */
+void CRYPTO_SERVER_StatsGet(CRYPTO_SERVER_STATS *stats);
+
+/**
+ * @brief Send a complete response frame. Provided by the transport port.
+ * @param data Pointer to the frame.
+ * @param size Length of the frame in bytes.
+ */
+void CRYPTO_SERVER_PORT_Write(const uint8_t *data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_SERVER_H */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+  Crypto Server Protocol Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_protocol.h
+
+  Summary:
+    Wire format shared by the crypto offload server firmware and the host
+    client library.
+
+  Description:
+    Requests and responses use the same frame layout:
+
+        +------+----+--------+----------+----------+-----------+----------+
+        | SOF  | OP | STATUS | TAG      | LENGTH   | PAYLOAD   | CRC16    |
+        | 0xA5 | 1B | 1B     | 2B (LE)  | 2B (LE)  | LENGTH B  | 2B (LE)  |
+        +------+----+--------+----------+----------+-----------+----------+
+
+    The CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) over every byte
+    after the SOF up to the end of the payload. STATUS is zero in requests.
+    The TAG is chosen by the client and echoed in the response, so responses
+    can be matched to requests when several are in flight. Responses are
+    returned in request order.
+
+    Request payloads (multi-byte fields little-endian):
+      INFO          : (empty)
+      HASH          : algorithm(1, crypto_Hash_Algo_E) data[...]
+      GCM_SEAL      : keyLen(1) ivLen(1) tagLen(1) aadLen(2)
+                      key iv aad plaintext[...]
+      GCM_OPEN      : keyLen(1) ivLen(1) tagLen(1) aadLen(2)
+                      key iv aad ciphertext[...] tag[tagLen]
+      CMAC          : keyLen(1) macLen(1) key message[...]
+      ECDSA_SIGN    : curve(1, crypto_EccCurveType_E) privLen(1) hashLen(1)
+                      privateKey hash
+      ECDSA_VERIFY  : curve(1) pubLen(1) hashLen(1) sigLen(1)
+                      publicKey hash signature
+      ECDH          : curve(1) privLen(1) pubLen(1) privateKey publicKey
+      TRNG          : length(2)
+      TRACE         : (empty)
+
+    Response payloads on CRYPTO_SERVER_STATUS_OK:
+      INFO          : version(1) slots(1) maxPayload(2) rxFrames(4)
+                      crcErrors(4) overruns(4)
+      HASH          : digest
+      GCM_SEAL      : ciphertext tag
+      GCM_OPEN      : plaintext
+      CMAC          : mac
+      ECDSA_SIGN    : signature (r || s)
+      ECDSA_VERIFY  : (empty)
+      ECDH          : shared secret
+      TRNG          : random data
+      TRACE         : tickRate(4) dropped(4) then 10-byte events
+                      timestamp(4) value(4) id(2), oldest first, as written
+                      by CRYPTO_TRACE_Serialize(). Events are removed once
+                      returned; repeat until only the header comes back.
+                      CRYPTO_SERVER_STATUS_BAD_OP if the firmware is built
+                      without CRYPTO_TRACE_ENABLE.
+
+    On CRYPTO_SERVER_STATUS_CRYPTO_FAIL, CRYPTO_SERVER_STATUS_AUTH_FAIL and
+    CRYPTO_SERVER_STATUS_VERIFY_FAIL the payload holds the single-byte status
+    returned by the Crypto_* API.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SERVER_PROTOCOL_H
+#define CRYPTO_SERVER_PROTOCOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_SERVER_SOF                   (0xA5U)
+#define CRYPTO_SERVER_PROTOCOL_VERSION      (1U)
+
+// OP, STATUS, TAG and LENGTH following the SOF.
+#define CRYPTO_SERVER_HEADER_SIZE           (6U)
+#define CRYPTO_SERVER_CRC_SIZE              (2U)
+#define CRYPTO_SERVER_FRAME_OVERHEAD        (1U + CRYPTO_SERVER_HEADER_SIZE + CRYPTO_SERVER_CRC_SIZE)
+
+// Largest request or response payload.
+#define CRYPTO_SERVER_MAX_PAYLOAD           (2048U)
+
+#define CRYPTO_SERVER_CRC_INIT              (0xFFFFU)
+#define CRYPTO_SERVER_CRC_POLY              (0x1021U)
+
+typedef enum
+{
+    CRYPTO_SERVER_OP_INFO = 0x00,
+    CRYPTO_SERVER_OP_HASH = 0x01,
+    CRYPTO_SERVER_OP_GCM_SEAL = 0x02,
+    CRYPTO_SERVER_OP_GCM_OPEN = 0x03,
+    CRYPTO_SERVER_OP_CMAC = 0x04,
+    CRYPTO_SERVER_OP_ECDSA_SIGN = 0x05,
+    CRYPTO_SERVER_OP_ECDSA_VERIFY = 0x06,
+    CRYPTO_SERVER_OP_ECDH = 0x07,
+    CRYPTO_SERVER_OP_TRNG = 0x08,
+    CRYPTO_SERVER_OP_TRACE = 0x09,
+    CRYPTO_SERVER_OP_MAX
+}crypto_Server_Op_E;
+
+typedef enum
+{
+    CRYPTO_SERVER_STATUS_BAD_OP = -1,
+    CRYPTO_SERVER_STATUS_BAD_LENGTH = -2,
+    CRYPTO_SERVER_STATUS_BAD_PARAM = -3,
+    CRYPTO_SERVER_STATUS_CRYPTO_FAIL = -4,
+    CRYPTO_SERVER_STATUS_AUTH_FAIL = -5,
+    CRYPTO_SERVER_STATUS_VERIFY_FAIL = -6,
+    CRYPTO_SERVER_STATUS_OK = 0
+}crypto_Server_Status_E;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Update a CRC-16/CCITT-FALSE value with one byte.
+ * @param crc The running CRC (CRYPTO_SERVER_CRC_INIT for a new frame).
+ * @param byte The byte to add.
+ * @return The updated CRC.
+ */
+static inline uint16_t CRYPTO_SERVER_CrcUpdate(uint16_t crc, uint8_t byte)
+{
+    uint16_t lcrc = crc ^ (uint16_t)((uint16_t)byte << 8);
+
+    for (uint8_t bit = 0U; bit < 8U; bit++)
+    {
+        if ((lcrc & 0x8000U) != 0U)
+        {
+            lcrc = (uint16_t)((uint16_t)(lcrc << 1) ^ CRYPTO_SERVER_CRC_POLY);
+        }
+        else
+        {
+            lcrc = (uint16_t)(lcrc << 1);
+        }
+    }
+
+    return lcrc;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_SERVER_PROTOCOL_H */
@@ -0,0 +1,73 @@
+/*******************************************************************************
+  Crypto Server UART Port Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_uart.h
+
+  Summary:
+    This header file provides the UART1 transport for the crypto offload server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SERVER_UART_H
+#define CRYPTO_SERVER_UART_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// UART1 baud rate used by the server. The host must open the port at this rate.
+#ifndef CRYPTO_SERVER_UART_BAUD_RATE
+#define CRYPTO_SERVER_UART_BAUD_RATE    (921600UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Initialize the server and attach it to UART1.
+ * @note SYSTEM_Initialize() must have been called first.
+ */
+void CRYPTO_SERVER_UART_Initialize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_SERVER_UART_H */
@@ -0,0 +1,66 @@
+/*******************************************************************************
+  Benchmark Output Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_bench.c
+
+  Summary:
+    This source file implements the COM port output shared by the benchmarks
+    of the crypto server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "app/app_bench.h"
+#include "mcc_generated_files/uart/uart1.h"
+
+#if defined(CRYPTO_LATENCY_BENCH_ENABLE) || defined(CRYPTO_SELFTEST_BENCH_ENABLE) || defined(CRYPTO_HANDSHAKE_BENCH_ENABLE) || \
+    defined(CRYPTO_ECIES_BENCH_ENABLE) || defined(CRYPTO_RFC6979_BENCH_ENABLE) || defined(CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE) || \
+    defined(CRYPTO_VERIFY_CACHE_BENCH_ENABLE)
+
+void APP_BENCH_WriteLine(const char *line)
+{
+    while (*line != '\0')
+    {
+        UART1_Write((uint8_t)*line);
+        line++;
+    }
+    UART1_Write((uint8_t)'\r');
+    UART1_Write((uint8_t)'\n');
+
+    // Let the row leave before the next operation is timed.
+    while (UART1_IsTxDone() == false)
+    {
+    }
+}
+
+#endif
@@ -0,0 +1,238 @@
+/*******************************************************************************
+  Streaming ECDSA Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_digisign_stream_bench.c
+
+  Summary:
+    This source file implements the streaming ECDSA sign and verify benchmark
+    of the crypto server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app/app_digisign_stream_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_digsign_stream.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+#if defined(CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE)
+
+#include "app/crypto_rfc6979_vectors.h"
+
+// The message is fed in chunks of this size, as from a receive buffer.
+#define CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK  (1024UL)
+
+static uint8_t streamChunk[CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK];
+static uint8_t streamDigest[CRYPTO_DIGISIGN_STREAM_MAX_DIGEST_SIZE];
+static uint8_t streamSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+static st_Crypto_Hash_Sha_Ctx streamShaCtx;
+static st_Crypto_DigiSign_Ecdsa_Ctx streamEcdsaCtx;
+
+/**
+ * @brief Sign msgLen bytes of streamChunk, repeated, as the caller of
+ *        Crypto_DigiSign_Ecdsa_Sign() does: the SHA-2 of the curve into a
+ *        digest buffer, then the sign of the buffer.
+ */
+static int32_t benchStreamHashThenSign(const st_Crypto_Rfc6979_Vector *ptr_vector, uint32_t msgLen)
+{
+    crypto_Hash_Algo_E shaAlgo;
+    uint32_t offset;
+    int32_t status;
+
+    shaAlgo = (ptr_vector->hashLen == 32UL) ? CRYPTO_HASH_SHA2_256 :
+              ((ptr_vector->hashLen == 48UL) ? CRYPTO_HASH_SHA2_384 : CRYPTO_HASH_SHA2_512);
+
+    status = (int32_t)Crypto_Hash_Sha_Init(&streamShaCtx, shaAlgo, CRYPTO_HANDLER_HW_INTERNAL, 1UL);
+    for (offset = 0UL; (offset < msgLen) && (status == 0L); offset += CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK)
+    {
+        status = (int32_t)Crypto_Hash_Sha_Update(&streamShaCtx, streamChunk, CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK);
+    }
+    if (status == 0L)
+    {
+        status = (int32_t)Crypto_Hash_Sha_Final(&streamShaCtx, streamDigest);
+    }
+    if (status == 0L)
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, streamDigest, ptr_vector->hashLen,
+                                                     streamSig, 2UL * ptr_vector->privKeyLen,
+                                                     (uint8_t *)ptr_vector->ptr_privKey, ptr_vector->privKeyLen,
+                                                     ptr_vector->curve_en, 1UL);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Sign msgLen bytes of streamChunk, repeated, with
+ *        Crypto_DigiSign_Ecdsa_SignInit(), _SignUpdate() and _SignFinal().
+ */
+static int32_t benchStreamSign(const st_Crypto_Rfc6979_Vector *ptr_vector, uint32_t msgLen)
+{
+    uint32_t offset;
+    int32_t status;
+
+    status = (int32_t)Crypto_DigiSign_Ecdsa_SignInit(&streamEcdsaCtx, CRYPTO_HANDLER_HW_INTERNAL,
+                                                     ptr_vector->curve_en, 1UL);
+    for (offset = 0UL; (offset < msgLen) && (status == 0L); offset += CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK)
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_SignUpdate(&streamEcdsaCtx, streamChunk,
+                                                           CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK);
+    }
+    if (status == 0L)
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_SignFinal(&streamEcdsaCtx, streamSig, 2UL * ptr_vector->privKeyLen,
+                                                          (uint8_t *)ptr_vector->ptr_privKey, ptr_vector->privKeyLen);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Verify streamSig over msgLen bytes of streamChunk, repeated, with
+ *        Crypto_DigiSign_Ecdsa_VerifyInit(), _VerifyUpdate() and
+ *        _VerifyFinal(); -1 when the signature does not verify.
+ */
+static int32_t benchStreamVerify(const st_Crypto_Rfc6979_Vector *ptr_vector, uint32_t msgLen)
+{
+    uint32_t offset;
+    int8_t verifyStat = 0;
+    int32_t status;
+
+    status = (int32_t)Crypto_DigiSign_Ecdsa_VerifyInit(&streamEcdsaCtx, CRYPTO_HANDLER_HW_INTERNAL,
+                                                       ptr_vector->curve_en, 1UL);
+    for (offset = 0UL; (offset < msgLen) && (status == 0L); offset += CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK)
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_VerifyUpdate(&streamEcdsaCtx, streamChunk,
+                                                             CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK);
+    }
+    if (status == 0L)
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_VerifyFinal(&streamEcdsaCtx, streamSig, 2UL * ptr_vector->privKeyLen,
+                                                            (uint8_t *)ptr_vector->ptr_pubKey,
+                                                            (2UL * ptr_vector->privKeyLen) + 1UL, &verifyStat);
+    }
+    if ((status == 0L) && (verifyStat != 1))
+    {
+        status = -1L;
+    }
+
+    return status;
+}
+
+void APP_DIGISIGN_STREAM_BENCH_Run(void)
+{
+    static const char * const pathNames[] = { "hash+sign", "stream" };
+    static const uint32_t msgLens[] = { 1024UL, 65536UL };
+    const st_Crypto_Rfc6979_Vector *ptr_vector;
+    uint32_t start;
+    uint32_t us;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t verifyUs;
+    uint64_t sum;
+    int32_t status;
+    uint32_t path;
+    uint32_t size;
+    uint32_t count;
+    uint32_t i;
+    char line[120];
+
+    for (i = 0UL; i < CRYPTO_DIGISIGN_STREAM_BENCH_CHUNK; i++)
+    {
+        streamChunk[i] = (uint8_t)i;
+    }
+
+    APP_BENCH_WriteLine("curve_bytes,msg_bytes,path,count,min_us,mean_us,max_us,verify_us,status");
+
+    // The "sample" vectors, one per curve.
+    for (i = 0UL; i < (sizeof(rfc6979Vectors) / sizeof(rfc6979Vectors[0])); i += 2UL)
+    {
+        ptr_vector = &rfc6979Vectors[i];
+
+        for (size = 0UL; size < (sizeof(msgLens) / sizeof(msgLens[0])); size++)
+        {
+            for (path = 0UL; path < (sizeof(pathNames) / sizeof(pathNames[0])); path++)
+            {
+                minUs = UINT32_MAX;
+                maxUs = 0UL;
+                verifyUs = 0UL;
+                sum = 0ULL;
+                status = 0L;
+
+                for (count = 0UL; (count < CRYPTO_DIGISIGN_STREAM_BENCH_COUNT) && (status == 0L); count++)
+                {
+                    start = APP_TIMER_Get();
+                    if (path == 0UL)
+                    {
+                        status = benchStreamHashThenSign(ptr_vector, msgLens[size]);
+                    }
+                    else
+                    {
+                        status = benchStreamSign(ptr_vector, msgLens[size]);
+                    }
+                    us = APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start));
+
+                    minUs = (us < minUs) ? us : minUs;
+                    maxUs = (us > maxUs) ? us : maxUs;
+                    sum += us;
+
+                    if (status == 0L)
+                    {
+                        start = APP_TIMER_Get();
+                        status = benchStreamVerify(ptr_vector, msgLens[size]);
+                        verifyUs = APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start));
+                    }
+                }
+
+                (void)snprintf(line, sizeof(line), "%lu,%lu,%s,%lu,%lu,%lu,%lu,%lu,%ld",
+                               (unsigned long)ptr_vector->privKeyLen, (unsigned long)msgLens[size], pathNames[path],
+                               (unsigned long)count, (unsigned long)minUs, (unsigned long)(sum / count),
+                               (unsigned long)maxUs, (unsigned long)verifyUs, (long)status);
+                APP_BENCH_WriteLine(line);
+            }
+        }
+    }
+
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE) */
@@ -0,0 +1,207 @@
+/*******************************************************************************
+  ECIES Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_ecies_bench.c
+
+  Summary:
+    This source file implements the ECIES seal and open benchmark of the crypto
+    server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app/app_ecies_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_ecies.h"
+#include "crypto/common_crypto/crypto_handshake.h"
+
+#if defined(CRYPTO_ECIES_BENCH_ENABLE)
+
+#include "app/crypto_ecies_vectors.h"
+
+// Largest sealed vector (200 bytes of message on P-384), rounded up.
+#define CRYPTO_ECIES_BENCH_SEALED_SIZE  (320UL)
+
+static uint8_t benchSealed[CRYPTO_ECIES_BENCH_SEALED_SIZE];
+
+void APP_ECIES_BENCH_Run(void)
+{
+    static const crypto_EccCurveType_E curves[] = { CRYPTO_ECC_CURVE_P256, CRYPTO_ECC_CURVE_P384 };
+    static const char * const curveNames[] = { "p256", "p384" };
+    static const char * const poolNames[] = { "cold", "warm" };
+    static const uint32_t poolCounts[] = { CRYPTO_HANDSHAKE_POOL_P256_COUNT, CRYPTO_HANDSHAKE_POOL_P384_COUNT };
+    const st_Crypto_Ecies_Vector *ptr_vector = NULL;
+    uint32_t pointSize;
+    uint32_t msgLen;
+    uint32_t start;
+    uint32_t sealTicks;
+    uint32_t openTicks;
+    int32_t status;
+    uint32_t curve;
+    uint32_t warm;
+    uint32_t count;
+    uint32_t i;
+    char line[400];
+
+    APP_BENCH_WriteLine("curve,vector,msg_bytes,status");
+
+    for (i = 0UL; i < (sizeof(eciesVectors) / sizeof(eciesVectors[0])); i++)
+    {
+        ptr_vector = &eciesVectors[i];
+        pointSize = Crypto_Ecies_PointSize(ptr_vector->curve_en);
+        (void)memcpy(benchSealed, ptr_vector->ptr_sealed, ptr_vector->sealedLen);
+
+        status = (int32_t)Crypto_Ecies_Open(CRYPTO_HANDLER_HW_INTERNAL, ptr_vector->curve_en,
+                                            (uint8_t *)ptr_vector->ptr_privKey, ptr_vector->privKeyLen,
+                                            (uint8_t *)ptr_vector->ptr_aad, ptr_vector->aadLen,
+                                            benchSealed, ptr_vector->sealedLen, &msgLen, 1UL);
+        if ((status == 0L) && ((msgLen != ptr_vector->msgLen) ||
+            ((msgLen != 0UL) && (memcmp(&benchSealed[pointSize], ptr_vector->ptr_msg, msgLen) != 0))))
+        {
+            status = -1L;
+        }
+
+        (void)snprintf(line, sizeof(line), "%s,%lu,%lu,%ld",
+                       curveNames[(ptr_vector->curve_en == CRYPTO_ECC_CURVE_P256) ? 0 : 1], (unsigned long)i,
+                       (unsigned long)ptr_vector->msgLen, (long)status);
+        APP_BENCH_WriteLine(line);
+    }
+
+    APP_BENCH_WriteLine("curve,pool,msg_bytes,count,seal_us,open_us,seals_per_s,status");
+
+    for (curve = 0UL; curve < (sizeof(curves) / sizeof(curves[0])); curve++)
+    {
+        pointSize = Crypto_Ecies_PointSize(curves[curve]);
+
+        // The report: the message of the last vector of the curve.
+        for (i = 0UL; i < (sizeof(eciesVectors) / sizeof(eciesVectors[0])); i++)
+        {
+            if (eciesVectors[i].curve_en == curves[curve])
+            {
+                ptr_vector = &eciesVectors[i];
+            }
+        }
+
+        // Without a pool for the curve, a warm seal is a cold one.
+        for (warm = 0UL; warm < ((poolCounts[curve] > 0UL) ? 2UL : 1UL); warm++)
+        {
+            sealTicks = 0UL;
+            openTicks = 0UL;
+            status = 0L;
+
+            for (count = 0UL; (count < CRYPTO_ECIES_BENCH_COUNT) && (status == 0L); count++)
+            {
+                // Stands for the idle time between two reports, untimed.
+                Crypto_Handshake_Pool_Flush();
+                if (warm == 1UL)
+                {
+                    while (Crypto_Handshake_Pool_Task(CRYPTO_HANDLER_HW_INTERNAL, 1UL))
+                    {
+                    }
+                }
+
+                (void)memcpy(&benchSealed[pointSize], ptr_vector->ptr_msg, ptr_vector->msgLen);
+                start = APP_TIMER_Get();
+                status = (int32_t)Crypto_Ecies_Seal(CRYPTO_HANDLER_HW_INTERNAL, curves[curve],
+                                                    (uint8_t *)ptr_vector->ptr_pubKey, ptr_vector->pubKeyLen,
+                                                    (uint8_t *)ptr_vector->ptr_aad, ptr_vector->aadLen,
+                                                    benchSealed, ptr_vector->msgLen, sizeof(benchSealed), 1UL);
+                sealTicks += APP_TIMER_Elapsed(start);
+
+                if (status == 0L)
+                {
+                    start = APP_TIMER_Get();
+                    status = (int32_t)Crypto_Ecies_Open(CRYPTO_HANDLER_HW_INTERNAL, curves[curve],
+                                                        (uint8_t *)ptr_vector->ptr_privKey, ptr_vector->privKeyLen,
+                                                        (uint8_t *)ptr_vector->ptr_aad, ptr_vector->aadLen,
+                                                        benchSealed, ptr_vector->sealedLen, &msgLen, 1UL);
+                    openTicks += APP_TIMER_Elapsed(start);
+                }
+
+                if ((status == 0L) && ((msgLen != ptr_vector->msgLen) ||
+                    (memcmp(&benchSealed[pointSize], ptr_vector->ptr_msg, msgLen) != 0)))
+                {
+                    status = -1L;
+                }
+            }
+
+            sealTicks = APP_TIMER_TicksToUs(sealTicks);
+            (void)snprintf(line, sizeof(line), "%s,%s,%lu,%lu,%lu,%lu,%lu,%ld", curveNames[curve], poolNames[warm],
+                           (unsigned long)ptr_vector->msgLen, (unsigned long)count,
+                           (unsigned long)(sealTicks / count),
+                           (unsigned long)(APP_TIMER_TicksToUs(openTicks) / count),
+                           (unsigned long)((sealTicks != 0UL) ? (((uint64_t)count * 1000000ULL) / sealTicks) : 0UL),
+                           (long)status);
+            APP_BENCH_WriteLine(line);
+        }
+    }
+
+    // A fresh ephemeral key per curve for the host to open.
+    for (curve = 0UL; curve < (sizeof(curves) / sizeof(curves[0])); curve++)
+    {
+        pointSize = Crypto_Ecies_PointSize(curves[curve]);
+        for (i = 0UL; i < (sizeof(eciesVectors) / sizeof(eciesVectors[0])); i++)
+        {
+            if (eciesVectors[i].curve_en == curves[curve])
+            {
+                ptr_vector = &eciesVectors[i];
+            }
+        }
+
+        (void)memcpy(&benchSealed[pointSize], ptr_vector->ptr_msg, ptr_vector->msgLen);
+        if (Crypto_Ecies_Seal(CRYPTO_HANDLER_HW_INTERNAL, curves[curve], (uint8_t *)ptr_vector->ptr_pubKey,
+                              ptr_vector->pubKeyLen, (uint8_t *)ptr_vector->ptr_aad, ptr_vector->aadLen,
+                              benchSealed, ptr_vector->msgLen, sizeof(benchSealed), 1UL) == CRYPTO_ECIES_SUCCESS)
+        {
+            int pos = snprintf(line, sizeof(line), "sealed,%s,", curveNames[curve]);
+
+            for (i = 0UL; i < ptr_vector->sealedLen; i++)
+            {
+                pos += snprintf(&line[pos], sizeof(line) - (size_t)pos, "%02X", benchSealed[i]);
+            }
+            APP_BENCH_WriteLine(line);
+        }
+    }
+
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_ECIES_BENCH_ENABLE) */
@@ -0,0 +1,154 @@
+/*******************************************************************************
+  ECDHE Handshake Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_handshake_bench.c
+
+  Summary:
+    This source file implements the ECDHE handshake benchmark of the crypto
+    server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app/app_handshake_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_handshake.h"
+
+#if defined(CRYPTO_HANDSHAKE_BENCH_ENABLE)
+
+static st_Crypto_Handshake_Ecdhe_Ctx benchInitiator;
+static st_Crypto_Handshake_Ecdhe_Ctx benchResponder;
+static st_Crypto_Handshake_Session benchInitiatorSession;
+static st_Crypto_Handshake_Session benchResponderSession;
+
+void APP_HANDSHAKE_BENCH_Run(void)
+{
+    static const crypto_EccCurveType_E curves[] = { CRYPTO_ECC_CURVE_P256, CRYPTO_ECC_CURVE_P384 };
+    static const char * const curveNames[] = { "p256", "p384" };
+    static const char * const poolNames[] = { "cold", "warm" };
+    static const uint32_t poolCounts[] = { CRYPTO_HANDSHAKE_POOL_P256_COUNT, CRYPTO_HANDSHAKE_POOL_P384_COUNT };
+    uint8_t initiatorKey[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE];
+    uint8_t responderKey[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE];
+    uint32_t pubKeyLen;
+    uint32_t start;
+    uint32_t startTicks;
+    uint32_t responderTicks;
+    uint32_t finishTicks;
+    int32_t status;
+    uint32_t curve;
+    uint32_t warm;
+    uint32_t count;
+    char line[96];
+
+    APP_BENCH_WriteLine("curve,pool,count,start_us,finish_us,initiator_us,responder_us,status");
+
+    for (curve = 0UL; curve < (sizeof(curves) / sizeof(curves[0])); curve++)
+    {
+        pubKeyLen = (curves[curve] == CRYPTO_ECC_CURVE_P256) ? 64UL : 96UL;
+
+        // Without a pool for the curve, a warm handshake is a cold one.
+        for (warm = 0UL; warm < ((poolCounts[curve] > 0UL) ? 2UL : 1UL); warm++)
+        {
+            startTicks = 0UL;
+            responderTicks = 0UL;
+            finishTicks = 0UL;
+            status = 0L;
+
+            for (count = 0UL; (count < CRYPTO_HANDSHAKE_BENCH_COUNT) && (status == 0L); count++)
+            {
+                // Stands for the idle time between two handshakes, untimed.
+                Crypto_Handshake_Pool_Flush();
+                if (warm == 1UL)
+                {
+                    while (Crypto_Handshake_Pool_Task(CRYPTO_HANDLER_HW_INTERNAL, 1UL))
+                    {
+                    }
+                }
+
+                start = APP_TIMER_Get();
+                status = (int32_t)Crypto_Handshake_Ecdhe_Start(&benchInitiator, CRYPTO_HANDLER_HW_INTERNAL,
+                                                               CRYPTO_HANDSHAKE_ROLE_INITIATOR, curves[curve],
+                                                               initiatorKey, sizeof(initiatorKey), 1UL);
+                startTicks += APP_TIMER_Elapsed(start);
+
+                if (status == 0L)
+                {
+                    start = APP_TIMER_Get();
+                    status = (int32_t)Crypto_Handshake_Ecdhe(&benchResponder, CRYPTO_HANDLER_HW_INTERNAL,
+                                                             CRYPTO_HANDSHAKE_ROLE_RESPONDER, curves[curve],
+                                                             initiatorKey, pubKeyLen, responderKey,
+                                                             sizeof(responderKey), NULL, 0UL, 16UL,
+                                                             &benchResponderSession, 1UL);
+                    responderTicks += APP_TIMER_Elapsed(start);
+                }
+
+                if (status == 0L)
+                {
+                    start = APP_TIMER_Get();
+                    status = (int32_t)Crypto_Handshake_Ecdhe_Finish(&benchInitiator, responderKey, pubKeyLen,
+                                                                    NULL, 0UL, 16UL, &benchInitiatorSession);
+                    finishTicks += APP_TIMER_Elapsed(start);
+                }
+
+                if ((status == 0L) &&
+                    ((memcmp(benchInitiatorSession.txKey, benchResponderSession.rxKey, 16UL) != 0) ||
+                     (memcmp(benchInitiatorSession.rxKey, benchResponderSession.txKey, 16UL) != 0)))
+                {
+                    status = -1L;
+                }
+            }
+
+            (void)snprintf(line, sizeof(line), "%s,%s,%lu,%lu,%lu,%lu,%lu,%ld", curveNames[curve], poolNames[warm],
+                           (unsigned long)count,
+                           (unsigned long)(APP_TIMER_TicksToUs(startTicks) / count),
+                           (unsigned long)(APP_TIMER_TicksToUs(finishTicks) / count),
+                           (unsigned long)(APP_TIMER_TicksToUs(startTicks + finishTicks) / count),
+                           (unsigned long)(APP_TIMER_TicksToUs(responderTicks) / count), (long)status);
+            APP_BENCH_WriteLine(line);
+        }
+    }
+
+    Crypto_Handshake_Session_Close(&benchInitiatorSession);
+    Crypto_Handshake_Session_Close(&benchResponderSession);
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_HANDSHAKE_BENCH_ENABLE) */
@@ -0,0 +1,113 @@
+/*******************************************************************************
+  Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_load.c
+
+  Summary:
+    This source file generates a periodic background interrupt load with SCCP1.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <xc.h>
+#include <stdint.h>
+
+#include "app/app_load.h"
+#include "app/app_timer.h"
+
+// SCCP1 MOD encoding for the timer mode (CCSEL = 0).
+#define APP_LOAD_MOD_TIMER      (0U)
+
+static volatile uint32_t loadCount;
+
+void __attribute__((interrupt)) _CCT1Interrupt(void);
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+void __attribute__((interrupt)) _CCT1Interrupt(void)
+{
+    uint32_t start = APP_TIMER_Get();
+
+    while (APP_TIMER_Elapsed(start) < APP_LOAD_WORK_TICKS)
+    {
+    }
+
+    loadCount++;
+    _CCT1IF = 0U;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void APP_LOAD_Start(uint32_t rateHz)
+{
+    APP_LOAD_Stop();
+    loadCount = 0UL;
+
+    if (rateHz > 0UL)
+    {
+        CCP1CON1bits.CCSEL = 0U;
+        CCP1CON1bits.MOD = APP_LOAD_MOD_TIMER;
+        CCP1CON1bits.T32 = 1U;              // One 32-bit period timer
+        CCP1CON1bits.CLKSEL = 0U;           // Standard peripheral clock
+        CCP1CON1bits.TMRPS = 0U;            // 1:1 prescaler
+        CCP1TMR = 0UL;
+        CCP1PR = (APP_LOAD_CLOCK_HZ / rateHz) - 1UL;
+        _CCT1IP = 1U;
+        _CCT1IF = 0U;
+        _CCT1IE = 1U;
+        CCP1CON1bits.ON = 1U;
+    }
+}
+
+void APP_LOAD_Stop(void)
+{
+    CCP1CON1bits.ON = 0U;
+    _CCT1IE = 0U;
+    _CCT1IF = 0U;
+}
+
+uint32_t APP_LOAD_Count(void)
+{
+    return loadCount;
+}
@@ -0,0 +1,193 @@
+/*******************************************************************************
+  Deterministic ECDSA Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_rfc6979_bench.c
+
+  Summary:
+    This source file implements the RFC 6979 deterministic ECDSA benchmark of
+    the crypto server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app/app_rfc6979_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_rfc6979.h"
+
+#if defined(CRYPTO_RFC6979_BENCH_ENABLE)
+
+#include "app/crypto_rfc6979_vectors.h"
+
+static uint8_t benchNonce[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t benchSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+
+/**
+ * @brief Integer square root, for the standard deviation.
+ */
+static uint32_t benchSqrt(uint64_t value)
+{
+    uint64_t root = 0ULL;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0ULL)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
+
+void APP_RFC6979_BENCH_Run(void)
+{
+    static const char * const modeNames[] = { "trng", "rfc6979" };
+    const st_Crypto_Rfc6979_Vector *ptr_vector;
+    uint32_t keyLen;
+    uint32_t start;
+    uint32_t us;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint64_t sum;
+    uint64_t sumSq;
+    uint32_t mean;
+    int32_t status;
+    uint32_t mode;
+    uint32_t count;
+    uint32_t i;
+    char line[120];
+
+    APP_BENCH_WriteLine("curve_bytes,msg,nonce_ok,sig_ok,status");
+
+    for (i = 0UL; i < (sizeof(rfc6979Vectors) / sizeof(rfc6979Vectors[0])); i++)
+    {
+        ptr_vector = &rfc6979Vectors[i];
+        keyLen = ptr_vector->privKeyLen;
+
+        status = (int32_t)Crypto_Rfc6979_Ecdsa_Nonce(CRYPTO_HANDLER_HW_INTERNAL, (uint8_t *)ptr_vector->ptr_hash,
+                                                     ptr_vector->hashLen, (uint8_t *)ptr_vector->ptr_privKey, keyLen,
+                                                     ptr_vector->curve_en, benchNonce, sizeof(benchNonce), 1UL);
+        if (status == 0L)
+        {
+            status = (int32_t)Crypto_Rfc6979_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, (uint8_t *)ptr_vector->ptr_hash,
+                                                        ptr_vector->hashLen, benchSig, sizeof(benchSig),
+                                                        (uint8_t *)ptr_vector->ptr_privKey, keyLen,
+                                                        ptr_vector->curve_en, 1UL);
+        }
+
+        (void)snprintf(line, sizeof(line), "%lu,%s,%d,%d,%ld", (unsigned long)keyLen, ptr_vector->ptr_msg,
+                       (memcmp(benchNonce, ptr_vector->ptr_nonce, keyLen) == 0) ? 1 : 0,
+                       (memcmp(benchSig, ptr_vector->ptr_sig, 2UL * keyLen) == 0) ? 1 : 0, (long)status);
+        APP_BENCH_WriteLine(line);
+    }
+
+    APP_BENCH_WriteLine("curve_bytes,nonce,count,min_us,mean_us,max_us,stddev_us,status");
+
+    // The "sample" vectors, one per curve.
+    for (i = 0UL; i < (sizeof(rfc6979Vectors) / sizeof(rfc6979Vectors[0])); i += 2UL)
+    {
+        ptr_vector = &rfc6979Vectors[i];
+        keyLen = ptr_vector->privKeyLen;
+
+        for (mode = 0UL; mode < (sizeof(modeNames) / sizeof(modeNames[0])); mode++)
+        {
+            minUs = UINT32_MAX;
+            maxUs = 0UL;
+            sum = 0ULL;
+            sumSq = 0ULL;
+            status = 0L;
+
+            for (count = 0UL; (count < CRYPTO_RFC6979_BENCH_COUNT) && (status == 0L); count++)
+            {
+                start = APP_TIMER_Get();
+                if (mode == 0UL)
+                {
+                    status = (int32_t)Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL,
+                                                                 (uint8_t *)ptr_vector->ptr_hash, ptr_vector->hashLen,
+                                                                 benchSig, 2UL * keyLen,
+                                                                 (uint8_t *)ptr_vector->ptr_privKey, keyLen,
+                                                                 ptr_vector->curve_en, 1UL);
+                }
+                else
+                {
+                    status = (int32_t)Crypto_Rfc6979_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL,
+                                                                (uint8_t *)ptr_vector->ptr_hash, ptr_vector->hashLen,
+                                                                benchSig, 2UL * keyLen,
+                                                                (uint8_t *)ptr_vector->ptr_privKey, keyLen,
+                                                                ptr_vector->curve_en, 1UL);
+                    if ((status == 0L) && (memcmp(benchSig, ptr_vector->ptr_sig, 2UL * keyLen) != 0))
+                    {
+                        status = -1L;
+                    }
+                }
+                us = APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start));
+
+                minUs = (us < minUs) ? us : minUs;
+                maxUs = (us > maxUs) ? us : maxUs;
+                sum += us;
+                sumSq += (uint64_t)us * us;
+            }
+
+            mean = (uint32_t)(sum / count);
+            (void)snprintf(line, sizeof(line), "%lu,%s,%lu,%lu,%lu,%lu,%lu,%ld", (unsigned long)keyLen,
+                           modeNames[mode], (unsigned long)count, (unsigned long)minUs, (unsigned long)mean,
+                           (unsigned long)maxUs,
+                           (unsigned long)benchSqrt((sumSq / count) - ((uint64_t)mean * mean)), (long)status);
+            APP_BENCH_WriteLine(line);
+        }
+    }
+
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_RFC6979_BENCH_ENABLE) */
@@ -0,0 +1,117 @@
+/*******************************************************************************
+  Self-Test Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_selftest_bench.c
+
+  Summary:
+    This source file implements the power-on self-test benchmark of the crypto
+    server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+
+#include "app/app_selftest_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if defined(CRYPTO_SELFTEST_ENABLE) && defined(CRYPTO_SELFTEST_BENCH_ENABLE)
+
+static const char * const selfTestAlgoNames[CRYPTO_SELFTEST_ALGO_MAX] = {
+    "aes_gcm", "aes_cmac", "sha", "ecdsa_p256", "ecdh_p256", "hkdf_sha256"
+};
+
+static void writeSelfTestRow(const char *phase, const char *name, uint32_t ticks, int32_t status)
+{
+    char line[64];
+
+    (void)snprintf(line, sizeof(line), "%s,%s,%lu,%ld", phase, name,
+                   (unsigned long)APP_TIMER_TicksToUs(ticks), (long)status);
+    APP_BENCH_WriteLine(line);
+}
+
+void APP_SELFTEST_BENCH_Run(crypto_SelfTest_Mode_E bootMode, uint32_t bootTicks, crypto_SelfTest_Status_E bootStatus)
+{
+    uint32_t start;
+    uint32_t ticks;
+    uint32_t lazyTicks;
+    uint32_t deferredTicks = 0UL;
+    int32_t status;
+    uint32_t algo;
+
+    APP_BENCH_WriteLine("phase,algo,us,status");
+    writeSelfTestRow("boot", (bootMode == CRYPTO_SELFTEST_MODE_FULL) ? "full" : "lazy",
+                     bootTicks, (int32_t)bootStatus);
+
+    for (algo = 0UL; algo < (uint32_t)CRYPTO_SELFTEST_ALGO_MAX; algo++)
+    {
+        Crypto_SelfTest_Reset();
+        start = APP_TIMER_Get();
+        status = (int32_t)Crypto_SelfTest_Require((crypto_SelfTest_Algo_E)algo);
+        writeSelfTestRow("kat", selfTestAlgoNames[algo], APP_TIMER_Elapsed(start), status);
+    }
+
+    start = APP_TIMER_Get();
+    status = (int32_t)Crypto_SelfTest_Run(CRYPTO_SELFTEST_MODE_FULL);
+    writeSelfTestRow("run", "full", APP_TIMER_Elapsed(start), status);
+
+    start = APP_TIMER_Get();
+    status = (int32_t)Crypto_SelfTest_Run(CRYPTO_SELFTEST_MODE_LAZY);
+    lazyTicks = APP_TIMER_Elapsed(start);
+    writeSelfTestRow("run", "lazy", lazyTicks, status);
+
+    for (algo = 0UL; algo < (uint32_t)CRYPTO_SELFTEST_ALGO_MAX; algo++)
+    {
+        if (Crypto_SelfTest_GetState((crypto_SelfTest_Algo_E)algo) == CRYPTO_SELFTEST_STATE_PENDING)
+        {
+            start = APP_TIMER_Get();
+            status = (int32_t)Crypto_SelfTest_Require((crypto_SelfTest_Algo_E)algo);
+            ticks = APP_TIMER_Elapsed(start);
+            deferredTicks += ticks;
+            writeSelfTestRow("first_use", selfTestAlgoNames[algo], ticks, status);
+        }
+    }
+    writeSelfTestRow("run", "lazy_plus_first_use", lazyTicks + deferredTicks, 0L);
+
+    // Leave the states as the reset self-test set them.
+    (void)Crypto_SelfTest_Run(bootMode);
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_SELFTEST_ENABLE) && defined(CRYPTO_SELFTEST_BENCH_ENABLE) */
@@ -0,0 +1,84 @@
+/*******************************************************************************
+  Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_timer.c
+
+  Summary:
+    This source file provides a free-running Timer1 timestamp for measuring
+    application run time.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <xc.h>
+#include <stdint.h>
+
+#include "app/app_timer.h"
+
+// Timer1 TCKPS encoding for the 1:8 prescaler.
+#define APP_TIMER_TCKPS_1_8     (1U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void APP_TIMER_Initialize(void)
+{
+    T1CONbits.ON = 0U;
+    T1CONbits.TCS = 0U;                     // Standard peripheral clock
+    T1CONbits.TCKPS = APP_TIMER_TCKPS_1_8;
+    TMR1 = 0UL;
+    PR1 = 0xFFFFFFFFUL;                     // Free-running, full 32-bit period
+    _T1IE = 0U;                             // Polled only, no interrupt
+    T1CONbits.ON = 1U;
+}
+
+uint32_t APP_TIMER_Get(void)
+{
+    return (uint32_t)TMR1;
+}
+
+uint32_t APP_TIMER_Elapsed(uint32_t start)
+{
+    return (uint32_t)TMR1 - start;
+}
+
+uint32_t APP_TIMER_TicksToUs(uint32_t ticks)
+{
+    return ticks / APP_TIMER_TICKS_PER_US;
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+  Verified-Signature Cache Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_verify_cache_bench.c
+
+  Summary:
+    This source file implements the verified-signature cache benchmark of the
+    crypto server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+/*
+*  MISRA C-2012 Deviation
+*
+*  (Rule 21.6) REQUIRED: The standard library input/output functions shall not be used
+*
+*  Reasoning: snprintf formats the CSV rows of the benchmark
+*/
+#include <stdio.h>
+#include <string.h>
+
+#include "app/app_verify_cache_bench.h"
+#include "app/app_bench.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_verify_cache.h"
+
+#if defined(CRYPTO_VERIFY_CACHE_BENCH_ENABLE)
+
+#include "app/crypto_rfc6979_vectors.h"
+
+static uint8_t cacheBenchSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+
+/**
+ * @brief Verify the signature of a vector, with one bit of s flipped when
+ *        tampered, through the cache or Crypto_DigiSign_Ecdsa_Verify().
+ * @return The status of the call, or -1 when the result is not the
+ *         expected one: valid for the vector, invalid when tampered.
+ */
+static int32_t benchVerifyCacheOne(const st_Crypto_Rfc6979_Vector *ptr_vector, bool cached, bool tampered)
+{
+    uint32_t keyLen = ptr_vector->privKeyLen;
+    int8_t verifyStat = 0;
+    int32_t status;
+
+    (void)memcpy(cacheBenchSig, ptr_vector->ptr_sig, 2UL * keyLen);
+    if (tampered)
+    {
+        cacheBenchSig[(2UL * keyLen) - 1UL] ^= 0x01U;
+    }
+
+    if (cached)
+    {
+        status = (int32_t)Crypto_VerifyCache_Ecdsa_Verify(CRYPTO_HANDLER_HW_INTERNAL, (uint8_t *)ptr_vector->ptr_hash,
+                                                          ptr_vector->hashLen, cacheBenchSig, 2UL * keyLen,
+                                                          (uint8_t *)ptr_vector->ptr_pubKey, (2UL * keyLen) + 1UL,
+                                                          &verifyStat, ptr_vector->curve_en, 1UL);
+    }
+    else
+    {
+        status = (int32_t)Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_HW_INTERNAL, (uint8_t *)ptr_vector->ptr_hash,
+                                                       ptr_vector->hashLen, cacheBenchSig, 2UL * keyLen,
+                                                       (uint8_t *)ptr_vector->ptr_pubKey, (2UL * keyLen) + 1UL,
+                                                       &verifyStat, ptr_vector->curve_en, 1UL);
+    }
+
+    if (tampered)
+    {
+        status = (verifyStat == 0) ? 0L : -1L;
+    }
+    else if ((status == 0L) && (verifyStat != 1))
+    {
+        status = -1L;
+    }
+
+    return status;
+}
+
+void APP_VERIFY_CACHE_BENCH_Run(void)
+{
+    static const char * const caseNames[] = { "verify", "miss", "hit", "tampered" };
+    const uint32_t vectorCount = sizeof(rfc6979Vectors) / sizeof(rfc6979Vectors[0]);
+    const st_Crypto_Rfc6979_Vector *ptr_vector;
+    st_Crypto_VerifyCache_Stats before;
+    st_Crypto_VerifyCache_Stats after;
+    uint32_t start;
+    uint32_t us;
+    uint32_t minUs[4];
+    uint32_t maxUs[4];
+    uint64_t sum[4];
+    int32_t status[4];
+    int32_t result;
+    uint32_t reconnect;
+    uint32_t path;
+    uint32_t count;
+    uint32_t c;
+    uint32_t i;
+    char line[120];
+
+    APP_BENCH_WriteLine("curve_bytes,case,count,min_us,mean_us,max_us,status");
+
+    // The "sample" vectors, one per curve; the "test" one keys the cache.
+    for (i = 0UL; i < vectorCount; i += 2UL)
+    {
+        ptr_vector = &rfc6979Vectors[i];
+
+        for (c = 0UL; c < 4UL; c++)
+        {
+            minUs[c] = UINT32_MAX;
+            maxUs[c] = 0UL;
+            sum[c] = 0ULL;
+            status[c] = 0L;
+        }
+
+        for (count = 0UL; count < CRYPTO_VERIFY_CACHE_BENCH_COUNT; count++)
+        {
+            Crypto_VerifyCache_Flush();
+            (void)benchVerifyCacheOne(&rfc6979Vectors[i + 1UL], true, false);
+
+            for (c = 0UL; c < 4UL; c++)
+            {
+                start = APP_TIMER_Get();
+                result = benchVerifyCacheOne(ptr_vector, (c != 0UL), (c == 3UL));
+                us = APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start));
+                status[c] = (status[c] == 0L) ? result : status[c];
+
+                minUs[c] = (us < minUs[c]) ? us : minUs[c];
+                maxUs[c] = (us > maxUs[c]) ? us : maxUs[c];
+                sum[c] += us;
+            }
+        }
+
+        for (c = 0UL; c < 4UL; c++)
+        {
+            (void)snprintf(line, sizeof(line), "%lu,%s,%lu,%lu,%lu,%lu,%ld", (unsigned long)ptr_vector->privKeyLen,
+                           caseNames[c], (unsigned long)CRYPTO_VERIFY_CACHE_BENCH_COUNT, (unsigned long)minUs[c],
+                           (unsigned long)(sum[c] / CRYPTO_VERIFY_CACHE_BENCH_COUNT), (unsigned long)maxUs[c],
+                           (long)status[c]);
+            APP_BENCH_WriteLine(line);
+        }
+    }
+
+    APP_BENCH_WriteLine("reconnects,objects,path,total_us,per_reconnect_us,hits,misses,status");
+
+    for (path = 0UL; path < 2UL; path++)
+    {
+        Crypto_VerifyCache_Flush();
+        Crypto_VerifyCache_GetStats(&before);
+        status[0] = 0L;
+
+        start = APP_TIMER_Get();
+        for (reconnect = 0UL; reconnect < CRYPTO_VERIFY_CACHE_BENCH_RECONNECTS; reconnect++)
+        {
+            for (i = 0UL; i < vectorCount; i++)
+            {
+                result = benchVerifyCacheOne(&rfc6979Vectors[i], (path != 0UL), false);
+                status[0] = (status[0] == 0L) ? result : status[0];
+            }
+        }
+        us = APP_TIMER_TicksToUs(APP_TIMER_Elapsed(start));
+        Crypto_VerifyCache_GetStats(&after);
+
+        (void)snprintf(line, sizeof(line), "%lu,%lu,%s,%lu,%lu,%lu,%lu,%ld",
+                       (unsigned long)CRYPTO_VERIFY_CACHE_BENCH_RECONNECTS, (unsigned long)vectorCount,
+                       (path == 0UL) ? "uncached" : "cached", (unsigned long)us,
+                       (unsigned long)(us / CRYPTO_VERIFY_CACHE_BENCH_RECONNECTS),
+                       (unsigned long)(after.hits - before.hits), (unsigned long)(after.misses - before.misses),
+                       (long)status[0]);
+        APP_BENCH_WriteLine(line);
+    }
+
+    APP_BENCH_WriteLine("# end");
+}
+
+#endif /* defined(CRYPTO_VERIFY_CACHE_BENCH_ENABLE) */
@@ -0,0 +1,245 @@
+/*******************************************************************************
+  Crypto Boot Verifier Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_boot_verify.c
+
+  Summary:
+    This source file implements the secure-boot verification of signed
+    images in program flash.
+
+  Description:
+    The pipelined mode keeps two jobs: while the verification task works on
+    the digest of one image, the caller hashes the next image into the
+    other job, then waits for the task before starting it on the new digest.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include "app/crypto_boot_verify.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_BOOT_VERIFY_SESSION_ID   (1U)
+
+typedef struct
+{
+    const CRYPTO_BOOT_VERIFY_IMAGE *image;
+    uint32_t index;
+    uint8_t digest[CRYPTO_BOOT_VERIFY_DIGEST_MAX];
+    CRYPTO_BOOT_VERIFY_STATUS status;
+} CRYPTO_BOOT_VERIFY_JOB;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+static st_Crypto_Hash_Sha_Ctx verifyShaCtx;
+static CRYPTO_BOOT_VERIFY_JOB verifyJobs[2];
+static CRYPTO_OSAL_TASK verifyTask;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCRYPTO_BOOT_VERIFY_DigestLen(void)
+{
+    uint32_t digestLen;
+
+    switch (CRYPTO_BOOT_VERIFY_HASH)
+    {
+        case CRYPTO_HASH_SHA1:
+            digestLen = 20UL;
+            break;
+        case CRYPTO_HASH_SHA2_224:
+            digestLen = 28UL;
+            break;
+        case CRYPTO_HASH_SHA2_256:
+            digestLen = 32UL;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            digestLen = 48UL;
+            break;
+        default:
+            digestLen = 64UL;
+            break;
+    }
+
+    return digestLen;
+}
+
+static void lCRYPTO_BOOT_VERIFY_Verify(CRYPTO_BOOT_VERIFY_JOB *job)
+{
+    int8_t verifyStatus = 0;
+    crypto_DigiSign_Status_E status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_HW_INTERNAL, job->digest,
+        lCRYPTO_BOOT_VERIFY_DigestLen(), job->image->signature, job->image->signatureLen, job->image->pubKey,
+        job->image->pubKeyLen, &verifyStatus, CRYPTO_BOOT_VERIFY_CURVE, CRYPTO_BOOT_VERIFY_SESSION_ID);
+
+    job->status = ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStatus == 1)) ?
+                  CRYPTO_BOOT_VERIFY_SUCCESS : CRYPTO_BOOT_VERIFY_ERROR_SIGNATURE;
+}
+
+static void lCRYPTO_BOOT_VERIFY_VerifyTask(void *arg)
+{
+    lCRYPTO_BOOT_VERIFY_Verify((CRYPTO_BOOT_VERIFY_JOB *)arg);
+}
+
+static void lCRYPTO_BOOT_VERIFY_Result(const CRYPTO_BOOT_VERIFY_JOB *job, CRYPTO_BOOT_VERIFY_STATUS *results,
+                                       CRYPTO_BOOT_VERIFY_STATUS *ptr_first)
+{
+    if (results != NULL)
+    {
+        results[job->index] = job->status;
+    }
+    if (*ptr_first == CRYPTO_BOOT_VERIFY_SUCCESS)
+    {
+        *ptr_first = job->status;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Boot Verifier Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_BOOT_VERIFY_STATUS CRYPTO_BOOT_VERIFY_Digest(const CRYPTO_BOOT_VERIFY_IMAGE *image, uint8_t *digest)
+{
+    CRYPTO_BOOT_VERIFY_STATUS status = CRYPTO_BOOT_VERIFY_ERROR_HASH;
+    uint32_t offset = 0UL;
+    uint32_t chunkLen;
+    uint8_t *ptr_chunk;
+
+    if ((image == NULL) || (digest == NULL))
+    {
+        return CRYPTO_BOOT_VERIFY_ERROR_ARG;
+    }
+
+    if (Crypto_Hash_Sha_Init(&verifyShaCtx, CRYPTO_BOOT_VERIFY_HASH, CRYPTO_HANDLER_HW_INTERNAL,
+                             CRYPTO_BOOT_VERIFY_SESSION_ID) == CRYPTO_HASH_SUCCESS)
+    {
+        status = CRYPTO_BOOT_VERIFY_SUCCESS;
+    }
+
+    while ((status == CRYPTO_BOOT_VERIFY_SUCCESS) && (offset < image->length))
+    {
+        chunkLen = image->length - offset;
+        if (chunkLen > CRYPTO_BOOT_VERIFY_CHUNK_SIZE)
+        {
+            chunkLen = CRYPTO_BOOT_VERIFY_CHUNK_SIZE;
+        }
+
+        ptr_chunk = CRYPTO_BOOT_VERIFY_PORT_Flash(image->address + offset, chunkLen);
+        if (ptr_chunk == NULL)
+        {
+            status = CRYPTO_BOOT_VERIFY_ERROR_FLASH;
+        }
+        else if (Crypto_Hash_Sha_Update(&verifyShaCtx, ptr_chunk, chunkLen) != CRYPTO_HASH_SUCCESS)
+        {
+            status = CRYPTO_BOOT_VERIFY_ERROR_HASH;
+        }
+        else
+        {
+            offset += chunkLen;
+        }
+    }
+
+    if ((status == CRYPTO_BOOT_VERIFY_SUCCESS) &&
+        (Crypto_Hash_Sha_Final(&verifyShaCtx, digest) != CRYPTO_HASH_SUCCESS))
+    {
+        status = CRYPTO_BOOT_VERIFY_ERROR_HASH;
+    }
+
+    return status;
+}
+
+CRYPTO_BOOT_VERIFY_STATUS CRYPTO_BOOT_VERIFY_Run(const CRYPTO_BOOT_VERIFY_IMAGE *images, uint32_t count,
+                                                 bool pipelined, CRYPTO_BOOT_VERIFY_STATUS *results)
+{
+    CRYPTO_BOOT_VERIFY_STATUS first = CRYPTO_BOOT_VERIFY_SUCCESS;
+    CRYPTO_BOOT_VERIFY_JOB *pending = NULL;
+    CRYPTO_BOOT_VERIFY_JOB *job;
+    uint32_t index;
+
+    if ((images == NULL) || (count == 0UL))
+    {
+        return CRYPTO_BOOT_VERIFY_ERROR_ARG;
+    }
+
+    for (index = 0UL; index < count; index++)
+    {
+        job = &verifyJobs[index & 1UL];
+        job->image = &images[index];
+        job->index = index;
+        job->status = CRYPTO_BOOT_VERIFY_Digest(job->image, job->digest);
+
+        // The task is free again once the previous signature is checked.
+        if (pending != NULL)
+        {
+            (void)Crypto_Osal_TaskJoin(&verifyTask, CRYPTO_OSAL_WAIT_FOREVER);
+            lCRYPTO_BOOT_VERIFY_Result(pending, results, &first);
+            pending = NULL;
+        }
+
+        if (job->status != CRYPTO_BOOT_VERIFY_SUCCESS)
+        {
+            lCRYPTO_BOOT_VERIFY_Result(job, results, &first);
+        }
+        else if (pipelined && (index + 1UL < count) &&
+                 (Crypto_Osal_TaskStart(&verifyTask, lCRYPTO_BOOT_VERIFY_VerifyTask, job) == CRYPTO_OSAL_SUCCESS))
+        {
+            pending = job;
+        }
+        else
+        {
+            // Sequential mode, the last image or no task to start: nothing left to overlap with.
+            lCRYPTO_BOOT_VERIFY_Verify(job);
+            lCRYPTO_BOOT_VERIFY_Result(job, results, &first);
+        }
+    }
+
+    return first;
+}
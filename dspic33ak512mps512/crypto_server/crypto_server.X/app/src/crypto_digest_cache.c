@@ -0,0 +1,298 @@
+/*******************************************************************************
+  Crypto Digest Cache Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digest_cache.c
+
+  Summary:
+    This source file implements the cached attestation digests of flash
+    regions.
+
+  Description:
+    A page or region is up to date when the generation its digest was taken
+    at equals the generation of its last write. Generations only move
+    forward, and a page takes the generation it had when its hashing began,
+    so a write that lands while the page is hashed leaves it stale for the
+    next attestation. The equality test only breaks after 2^32 flash writes,
+    well past the endurance of the flash.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <string.h>
+#include "app/crypto_digest_cache.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_DIGEST_CACHE_SESSION_ID  (1U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_DIGEST_CACHE_REGION *cacheRegions = NULL;
+static uint32_t cacheGeneration = 1UL;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCRYPTO_DIGEST_CACHE_DigestLen(crypto_Hash_Algo_E algorithm)
+{
+    uint32_t digestLen;
+
+    switch (algorithm)
+    {
+        case CRYPTO_HASH_SHA1:
+            digestLen = 20UL;
+            break;
+        case CRYPTO_HASH_SHA2_224:
+            digestLen = 28UL;
+            break;
+        case CRYPTO_HASH_SHA2_256:
+            digestLen = 32UL;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            digestLen = 48UL;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            digestLen = 64UL;
+            break;
+        default:
+            digestLen = 0UL;
+            break;
+    }
+
+    return (digestLen <= CRYPTO_DIGEST_CACHE_DIGEST_MAX) ? digestLen : 0UL;
+}
+
+static CRYPTO_DIGEST_CACHE_STATUS lCRYPTO_DIGEST_CACHE_HashPage(CRYPTO_DIGEST_CACHE_REGION *region, uint32_t page,
+                                                                crypto_Hash_Algo_E algorithm, uint32_t digestLen)
+{
+    CRYPTO_DIGEST_CACHE_STATUS status = CRYPTO_DIGEST_CACHE_SUCCESS;
+    uint32_t offset = page * CRYPTO_DIGEST_CACHE_PAGE_SIZE;
+    uint32_t pageLen = region->length - offset;
+    uint32_t generation = region->pages[page].written;
+    uint8_t *ptr_page;
+
+    if (pageLen > CRYPTO_DIGEST_CACHE_PAGE_SIZE)
+    {
+        pageLen = CRYPTO_DIGEST_CACHE_PAGE_SIZE;
+    }
+
+    ptr_page = CRYPTO_DIGEST_CACHE_PORT_Flash(region->address + offset, pageLen);
+    if (ptr_page == NULL)
+    {
+        status = CRYPTO_DIGEST_CACHE_ERROR_FLASH;
+    }
+    else if (Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, ptr_page, pageLen,
+                                    &region->pageDigests[page * digestLen], algorithm,
+                                    CRYPTO_DIGEST_CACHE_SESSION_ID) != CRYPTO_HASH_SUCCESS)
+    {
+        status = CRYPTO_DIGEST_CACHE_ERROR_HASH;
+    }
+    else
+    {
+        region->pages[page].hashed = generation;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Digest Cache Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_DIGEST_CACHE_STATUS CRYPTO_DIGEST_CACHE_Register(CRYPTO_DIGEST_CACHE_REGION *region, uint32_t address,
+                                                        uint32_t length, CRYPTO_DIGEST_CACHE_PAGE *pages,
+                                                        uint8_t *pageDigests)
+{
+    uint32_t page;
+
+    if ((region == NULL) || (length == 0UL) || (pages == NULL) || (pageDigests == NULL) ||
+        (length > (0xFFFFFFFFUL - address)))
+    {
+        return CRYPTO_DIGEST_CACHE_ERROR_ARG;
+    }
+
+    CRYPTO_DIGEST_CACHE_Unregister(region);
+
+    region->address = address;
+    region->length = length;
+    region->pageCount = CRYPTO_DIGEST_CACHE_PAGE_COUNT(length);
+    region->pages = pages;
+    region->pageDigests = pageDigests;
+    region->algorithm = CRYPTO_HASH_INVALID;
+
+    // Stale until first hashed.
+    for (page = 0UL; page < region->pageCount; page++)
+    {
+        pages[page].written = cacheGeneration;
+        pages[page].hashed = cacheGeneration - 1UL;
+    }
+    region->generation = cacheGeneration;
+    region->digestGeneration = cacheGeneration - 1UL;
+
+    region->next = cacheRegions;
+    cacheRegions = region;
+
+    return CRYPTO_DIGEST_CACHE_SUCCESS;
+}
+
+void CRYPTO_DIGEST_CACHE_Unregister(CRYPTO_DIGEST_CACHE_REGION *region)
+{
+    CRYPTO_DIGEST_CACHE_REGION **ptr_link = &cacheRegions;
+
+    while ((*ptr_link != NULL) && (*ptr_link != region))
+    {
+        ptr_link = &(*ptr_link)->next;
+    }
+    if (*ptr_link != NULL)
+    {
+        *ptr_link = region->next;
+        region->next = NULL;
+    }
+}
+
+void CRYPTO_DIGEST_CACHE_FlashWritten(uint32_t address, uint32_t length)
+{
+    CRYPTO_DIGEST_CACHE_REGION *region;
+    uint32_t first;
+    uint32_t last;
+    uint32_t end;
+
+    if (length == 0UL)
+    {
+        return;
+    }
+
+    cacheGeneration++;
+    end = ((0xFFFFFFFFUL - address) < (length - 1UL)) ? 0xFFFFFFFFUL : (address + (length - 1UL));
+
+    for (region = cacheRegions; region != NULL; region = region->next)
+    {
+        // Skip regions the write does not overlap.
+        if ((end < region->address) || (address > (region->address + (region->length - 1UL))))
+        {
+            continue;
+        }
+
+        first = (address > region->address) ? ((address - region->address) / CRYPTO_DIGEST_CACHE_PAGE_SIZE) : 0UL;
+        last = (end - region->address) / CRYPTO_DIGEST_CACHE_PAGE_SIZE;
+        if (last >= region->pageCount)
+        {
+            last = region->pageCount - 1UL;
+        }
+
+        for (; first <= last; first++)
+        {
+            region->pages[first].written = cacheGeneration;
+        }
+        region->generation = cacheGeneration;
+    }
+}
+
+CRYPTO_DIGEST_CACHE_STATUS CRYPTO_DIGEST_CACHE_Attest(CRYPTO_DIGEST_CACHE_REGION *region,
+                                                      crypto_Hash_Algo_E algorithm, uint8_t *digest,
+                                                      uint32_t *pagesHashed)
+{
+    CRYPTO_DIGEST_CACHE_STATUS status = CRYPTO_DIGEST_CACHE_SUCCESS;
+    uint32_t digestLen = lCRYPTO_DIGEST_CACHE_DigestLen(algorithm);
+    uint32_t generation;
+    uint32_t hashed = 0UL;
+    uint32_t page;
+    bool rehashAll;
+
+    if ((region == NULL) || (region->pages == NULL) || (digest == NULL) || (digestLen == 0UL))
+    {
+        return CRYPTO_DIGEST_CACHE_ERROR_ARG;
+    }
+
+    generation = region->generation;
+    rehashAll = (region->algorithm != algorithm);
+
+    if (!rehashAll && (region->digestGeneration == generation))
+    {
+        (void)memcpy(digest, region->digest, digestLen);
+    }
+    else
+    {
+        // The page digests of another algorithm are no use; stale until hashed again.
+        region->algorithm = rehashAll ? CRYPTO_HASH_INVALID : algorithm;
+
+        for (page = 0UL; (status == CRYPTO_DIGEST_CACHE_SUCCESS) && (page < region->pageCount); page++)
+        {
+            if (rehashAll || (region->pages[page].hashed != region->pages[page].written))
+            {
+                status = lCRYPTO_DIGEST_CACHE_HashPage(region, page, algorithm, digestLen);
+                hashed++;
+            }
+        }
+
+        if (status == CRYPTO_DIGEST_CACHE_SUCCESS)
+        {
+            region->algorithm = algorithm;
+            if (Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, region->pageDigests, region->pageCount * digestLen,
+                                       region->digest, algorithm, CRYPTO_DIGEST_CACHE_SESSION_ID) == CRYPTO_HASH_SUCCESS)
+            {
+                region->digestGeneration = generation;
+                (void)memcpy(digest, region->digest, digestLen);
+            }
+            else
+            {
+                region->digestGeneration = generation - 1UL;
+                status = CRYPTO_DIGEST_CACHE_ERROR_HASH;
+            }
+        }
+    }
+
+    if (pagesHashed != NULL)
+    {
+        *pagesHashed = hashed;
+    }
+
+    return status;
+}
@@ -0,0 +1,427 @@
+/*******************************************************************************
+  Crypto Hash Tree Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_tree.c
+
+  Summary:
+    This source file implements the building and the chunk-by-chunk
+    verification of binary hash trees.
+
+  Description:
+    The builder works like a binary counter: a completed leaf is carried up
+    through the levels holding a pending node, each carry joining the two
+    nodes, and the final root joins the pending nodes from the lowest level
+    up. Node j of level L covers the chunks j * 2^L to (j + 1) * 2^L - 1, and
+    a level of w nodes has (w + 1) / 2 parents.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <string.h>
+#include "app/crypto_hash_tree.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_HASH_TREE_SESSION_ID     (1U)
+#define CRYPTO_HASH_TREE_LEAF_PREFIX    (0x00U)
+#define CRYPTO_HASH_TREE_NODE_PREFIX    (0x01U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCRYPTO_HASH_TREE_DigestLen(crypto_Hash_Algo_E algorithm)
+{
+    uint32_t digestLen;
+
+    switch (algorithm)
+    {
+        case CRYPTO_HASH_SHA1:
+            digestLen = 20UL;
+            break;
+        case CRYPTO_HASH_SHA2_224:
+            digestLen = 28UL;
+            break;
+        case CRYPTO_HASH_SHA2_256:
+            digestLen = 32UL;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            digestLen = 48UL;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            digestLen = 64UL;
+            break;
+        default:
+            digestLen = 0UL;
+            break;
+    }
+
+    return (digestLen <= CRYPTO_HASH_TREE_DIGEST_MAX) ? digestLen : 0UL;
+}
+
+static CRYPTO_HASH_TREE_STATUS lCRYPTO_HASH_TREE_LeafStart(st_Crypto_Hash_Sha_Ctx *ptr_ctx,
+                                                           crypto_Hash_Algo_E algorithm)
+{
+    uint8_t prefix = CRYPTO_HASH_TREE_LEAF_PREFIX;
+
+    if ((Crypto_Hash_Sha_Init(ptr_ctx, algorithm, CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_HASH_TREE_SESSION_ID) !=
+         CRYPTO_HASH_SUCCESS) ||
+        (Crypto_Hash_Sha_Update(ptr_ctx, &prefix, 1UL) != CRYPTO_HASH_SUCCESS))
+    {
+        return CRYPTO_HASH_TREE_ERROR_HASH;
+    }
+
+    return CRYPTO_HASH_TREE_SUCCESS;
+}
+
+// node = H(0x01 || left || right); node may be left or right.
+static CRYPTO_HASH_TREE_STATUS lCRYPTO_HASH_TREE_Join(uint8_t *pair, crypto_Hash_Algo_E algorithm,
+                                                      uint32_t digestLen, const uint8_t *left,
+                                                      const uint8_t *right, uint8_t *node)
+{
+    pair[0] = CRYPTO_HASH_TREE_NODE_PREFIX;
+    (void)memmove(&pair[1], left, digestLen);
+    (void)memmove(&pair[1UL + digestLen], right, digestLen);
+
+    if (Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, pair, 1UL + (2UL * digestLen), node, algorithm,
+                               CRYPTO_HASH_TREE_SESSION_ID) != CRYPTO_HASH_SUCCESS)
+    {
+        return CRYPTO_HASH_TREE_ERROR_HASH;
+    }
+
+    return CRYPTO_HASH_TREE_SUCCESS;
+}
+
+// Carry a completed leaf up through the levels holding a pending node.
+static CRYPTO_HASH_TREE_STATUS lCRYPTO_HASH_TREE_Push(CRYPTO_HASH_TREE_BUILDER *builder)
+{
+    CRYPTO_HASH_TREE_STATUS status = CRYPTO_HASH_TREE_SUCCESS;
+    uint8_t node[CRYPTO_HASH_TREE_DIGEST_MAX];
+    uint32_t level = 0UL;
+
+    if (Crypto_Hash_Sha_Final(&builder->leafCtx, node) != CRYPTO_HASH_SUCCESS)
+    {
+        status = CRYPTO_HASH_TREE_ERROR_HASH;
+    }
+
+    while ((status == CRYPTO_HASH_TREE_SUCCESS) && ((builder->pendingMask & (1UL << level)) != 0UL))
+    {
+        status = lCRYPTO_HASH_TREE_Join(builder->pair, builder->algorithm, builder->digestLen,
+                                        builder->pending[level], node, node);
+        builder->pendingMask &= ~(1UL << level);
+        level++;
+    }
+
+    if (status == CRYPTO_HASH_TREE_SUCCESS)
+    {
+        (void)memcpy(builder->pending[level], node, builder->digestLen);
+        builder->pendingMask |= (1UL << level);
+        builder->leafCount++;
+        builder->leafBytes = 0UL;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Hash Tree Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderInit(CRYPTO_HASH_TREE_BUILDER *builder, crypto_Hash_Algo_E algorithm,
+                                                     uint32_t chunkSize)
+{
+    uint32_t digestLen = lCRYPTO_HASH_TREE_DigestLen(algorithm);
+
+    if ((builder == NULL) || (digestLen == 0UL) || (chunkSize == 0UL))
+    {
+        return CRYPTO_HASH_TREE_ERROR_ARG;
+    }
+
+    builder->algorithm = algorithm;
+    builder->digestLen = digestLen;
+    builder->chunkSize = chunkSize;
+    builder->leafBytes = 0UL;
+    builder->leafCount = 0UL;
+    builder->pendingMask = 0UL;
+
+    return CRYPTO_HASH_TREE_SUCCESS;
+}
+
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderUpdate(CRYPTO_HASH_TREE_BUILDER *builder, uint8_t *data,
+                                                       uint32_t dataLen)
+{
+    CRYPTO_HASH_TREE_STATUS status = CRYPTO_HASH_TREE_SUCCESS;
+    uint32_t len;
+
+    if ((builder == NULL) || (builder->digestLen == 0UL) || ((data == NULL) && (dataLen > 0UL)))
+    {
+        return CRYPTO_HASH_TREE_ERROR_ARG;
+    }
+
+    while ((status == CRYPTO_HASH_TREE_SUCCESS) && (dataLen > 0UL))
+    {
+        if (builder->leafBytes == 0UL)
+        {
+            if (builder->leafCount >= (1UL << CRYPTO_HASH_TREE_DEPTH_MAX))
+            {
+                status = CRYPTO_HASH_TREE_ERROR_ARG;
+                break;
+            }
+            status = lCRYPTO_HASH_TREE_LeafStart(&builder->leafCtx, builder->algorithm);
+        }
+
+        len = builder->chunkSize - builder->leafBytes;
+        if (len > dataLen)
+        {
+            len = dataLen;
+        }
+
+        if ((status == CRYPTO_HASH_TREE_SUCCESS) &&
+            (Crypto_Hash_Sha_Update(&builder->leafCtx, data, len) != CRYPTO_HASH_SUCCESS))
+        {
+            status = CRYPTO_HASH_TREE_ERROR_HASH;
+        }
+
+        if (status == CRYPTO_HASH_TREE_SUCCESS)
+        {
+            builder->leafBytes += len;
+            data = &data[len];
+            dataLen -= len;
+            if (builder->leafBytes == builder->chunkSize)
+            {
+                status = lCRYPTO_HASH_TREE_Push(builder);
+            }
+        }
+    }
+
+    if (status != CRYPTO_HASH_TREE_SUCCESS)
+    {
+        // The tree is lost with a leaf; start again with CRYPTO_HASH_TREE_BuilderInit().
+        builder->digestLen = 0UL;
+    }
+
+    return status;
+}
+
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_BuilderFinal(CRYPTO_HASH_TREE_BUILDER *builder, uint8_t *root,
+                                                      uint32_t *leafCount)
+{
+    CRYPTO_HASH_TREE_STATUS status = CRYPTO_HASH_TREE_SUCCESS;
+    bool haveNode = false;
+    uint32_t level;
+
+    if ((builder == NULL) || (builder->digestLen == 0UL) || (root == NULL) ||
+        ((builder->leafCount == 0UL) && (builder->leafBytes == 0UL)))
+    {
+        return CRYPTO_HASH_TREE_ERROR_ARG;
+    }
+
+    // The last chunk may be short.
+    if (builder->leafBytes > 0UL)
+    {
+        status = lCRYPTO_HASH_TREE_Push(builder);
+    }
+
+    for (level = 0UL; (status == CRYPTO_HASH_TREE_SUCCESS) && (level <= CRYPTO_HASH_TREE_DEPTH_MAX); level++)
+    {
+        if ((builder->pendingMask & (1UL << level)) == 0UL)
+        {
+            continue;
+        }
+        if (haveNode)
+        {
+            status = lCRYPTO_HASH_TREE_Join(builder->pair, builder->algorithm, builder->digestLen,
+                                            builder->pending[level], root, root);
+        }
+        else
+        {
+            (void)memcpy(root, builder->pending[level], builder->digestLen);
+            haveNode = true;
+        }
+    }
+
+    if ((status == CRYPTO_HASH_TREE_SUCCESS) && (leafCount != NULL))
+    {
+        *leafCount = builder->leafCount;
+    }
+    builder->digestLen = 0UL;
+
+    return status;
+}
+
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_VerifierInit(CRYPTO_HASH_TREE_VERIFIER *verifier,
+                                                      crypto_Hash_Algo_E algorithm, uint32_t chunkSize,
+                                                      uint32_t leafCount, const uint8_t *root)
+{
+    uint32_t digestLen = lCRYPTO_HASH_TREE_DigestLen(algorithm);
+
+    if ((verifier == NULL) || (digestLen == 0UL) || (chunkSize == 0UL) || (leafCount == 0UL) ||
+        (leafCount > (1UL << CRYPTO_HASH_TREE_DEPTH_MAX)) || (root == NULL))
+    {
+        return CRYPTO_HASH_TREE_ERROR_ARG;
+    }
+
+    verifier->algorithm = algorithm;
+    verifier->digestLen = digestLen;
+    verifier->chunkSize = chunkSize;
+    verifier->leafCount = leafCount;
+    (void)memcpy(verifier->root, root, digestLen);
+    (void)memset(verifier->known, 0, sizeof(verifier->known));
+
+    return CRYPTO_HASH_TREE_SUCCESS;
+}
+
+uint32_t CRYPTO_HASH_TREE_ProofCount(uint32_t leafCount, uint32_t index)
+{
+    uint32_t count = 0UL;
+    uint32_t width = leafCount;
+
+    while (width > 1UL)
+    {
+        // A last node without a right neighbour has no sibling and moves up.
+        if (((index & 1UL) != 0UL) || ((index + 1UL) < width))
+        {
+            count++;
+        }
+        index >>= 1;
+        width = (width + 1UL) >> 1;
+    }
+
+    return count;
+}
+
+CRYPTO_HASH_TREE_STATUS CRYPTO_HASH_TREE_VerifyChunk(CRYPTO_HASH_TREE_VERIFIER *verifier, uint32_t index,
+                                                     uint8_t *chunk, uint32_t chunkLen, const uint8_t *proof,
+                                                     uint32_t proofCount)
+{
+    CRYPTO_HASH_TREE_STATUS status;
+    uint8_t node[CRYPTO_HASH_TREE_DIGEST_MAX];
+    const uint8_t *siblings[CRYPTO_HASH_TREE_DEPTH_MAX];
+    uint32_t used = 0UL;
+    uint32_t width;
+    uint32_t level;
+    uint32_t j = index;
+    bool authenticated = false;
+
+    if ((verifier == NULL) || (verifier->digestLen == 0UL) || (index >= verifier->leafCount) ||
+        (chunk == NULL) || (chunkLen == 0UL) || (chunkLen > verifier->chunkSize) ||
+        ((chunkLen < verifier->chunkSize) && ((index + 1UL) < verifier->leafCount)) ||
+        ((proof == NULL) && (proofCount > 0UL)))
+    {
+        return CRYPTO_HASH_TREE_ERROR_ARG;
+    }
+
+    status = lCRYPTO_HASH_TREE_LeafStart(&verifier->leafCtx, verifier->algorithm);
+    if ((status == CRYPTO_HASH_TREE_SUCCESS) &&
+        ((Crypto_Hash_Sha_Update(&verifier->leafCtx, chunk, chunkLen) != CRYPTO_HASH_SUCCESS) ||
+         (Crypto_Hash_Sha_Final(&verifier->leafCtx, node) != CRYPTO_HASH_SUCCESS)))
+    {
+        status = CRYPTO_HASH_TREE_ERROR_HASH;
+    }
+
+    width = verifier->leafCount;
+    for (level = 0UL; (status == CRYPTO_HASH_TREE_SUCCESS) && (width > 1UL); level++)
+    {
+        siblings[level] = NULL;
+
+        // Reached a node authenticated by an earlier chunk: no need to go further up.
+        if (verifier->known[level] == (j + 1UL))
+        {
+            authenticated = true;
+            break;
+        }
+
+        if (((j & 1UL) != 0UL) || ((j + 1UL) < width))
+        {
+            if (used >= proofCount)
+            {
+                status = CRYPTO_HASH_TREE_ERROR_MISMATCH;
+                break;
+            }
+            siblings[level] = &proof[used * verifier->digestLen];
+            used++;
+
+            if ((j & 1UL) != 0UL)
+            {
+                status = lCRYPTO_HASH_TREE_Join(verifier->pair, verifier->algorithm, verifier->digestLen,
+                                                siblings[level], node, node);
+            }
+            else
+            {
+                status = lCRYPTO_HASH_TREE_Join(verifier->pair, verifier->algorithm, verifier->digestLen,
+                                                node, siblings[level], node);
+            }
+        }
+
+        j >>= 1;
+        width = (width + 1UL) >> 1;
+    }
+
+    if (status == CRYPTO_HASH_TREE_SUCCESS)
+    {
+        if ((authenticated && (memcmp(node, verifier->knownNode[level], verifier->digestLen) != 0)) ||
+            (!authenticated && (memcmp(node, verifier->root, verifier->digestLen) != 0)))
+        {
+            status = CRYPTO_HASH_TREE_ERROR_MISMATCH;
+        }
+    }
+
+    // The siblings used are now authenticated; keep them for the next chunks.
+    if (status == CRYPTO_HASH_TREE_SUCCESS)
+    {
+        j = index;
+        while (level > 0UL)
+        {
+            level--;
+            if (siblings[level] != NULL)
+            {
+                verifier->known[level] = ((j >> level) ^ 1UL) + 1UL;
+                (void)memcpy(verifier->knownNode[level], siblings[level], verifier->digestLen);
+            }
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,398 @@
+/*******************************************************************************
+  Crypto Latency Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_latency_bench.c
+
+  Summary:
+    This source file implements the tail-latency benchmark of the Crypto_* APIs.
+
+  Description:
+    Each operation is a case with fixed inputs: the P-256 key pair is the
+    NIST test key of the ECDSA example, and the inputs of the verify and
+    open cases are produced by one untimed sign or seal call first. Only the
+    Crypto_* call itself lies between the two timestamps of a sample.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "app/crypto_latency_bench.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_rng.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Session ID used for every Crypto_* call made by the benchmark.
+#define CRYPTO_LATENCY_BENCH_SESSION_ID     (1U)
+
+#define CRYPTO_LATENCY_BENCH_MAX_DATA       (1024UL)
+#define CRYPTO_LATENCY_BENCH_TAG_LEN        (16U)
+#define CRYPTO_LATENCY_BENCH_P256_LEN       (32UL)
+#define CRYPTO_LATENCY_BENCH_LINE_SIZE      (128U)
+
+typedef struct
+{
+    const char *name;                   // Operation name, as used by crypto_server_bench
+    uint32_t payloadBytes;              // Message, hash, public key or output length
+    bool pke;                           // Uses CRYPTO_LATENCY_BENCH_PKE_ITERATIONS
+    int32_t (*prepare)(uint32_t payloadBytes);
+    int32_t (*run)(uint32_t payloadBytes);
+} CRYPTO_LATENCY_BENCH_CASE;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+static uint8_t benchKey[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static uint8_t benchIv[12] = {
+    0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+
+static uint8_t benchPrivateKey[CRYPTO_LATENCY_BENCH_P256_LEN] = {
+    0xc9, 0x80, 0x68, 0x98, 0xa0, 0x33, 0x49, 0x16, 0xc8, 0x60, 0x74, 0x88,
+    0x80, 0xa5, 0x41, 0xf0, 0x93, 0xb5, 0x79, 0xa9, 0xb1, 0xf3, 0x29, 0x34,
+    0xd8, 0x6c, 0x36, 0x3c, 0x39, 0x80, 0x03, 0x57
+};
+
+static uint8_t benchPublicKey[1UL + (2UL * CRYPTO_LATENCY_BENCH_P256_LEN)] = {
+    0x04, 0xd0, 0x72, 0x0d, 0xc6, 0x91, 0xaa, 0x80, 0x09, 0x6b, 0xa3, 0x2f,
+    0xed, 0x1c, 0xb9, 0x7c, 0x2b, 0x62, 0x06, 0x90, 0xd0, 0x6d, 0xe0, 0x31,
+    0x7b, 0x86, 0x18, 0xd5, 0xce, 0x65, 0xeb, 0x72, 0x8f, 0x96, 0x81, 0xb5,
+    0x17, 0xb1, 0xcd, 0xa1, 0x7d, 0x0d, 0x83, 0xd3, 0x35, 0xd9, 0xc4, 0xa8,
+    0xa9, 0xa9, 0xb0, 0xb1, 0xb3, 0xc7, 0x10, 0x6d, 0x8f, 0x3c, 0x72, 0xbc,
+    0x50, 0x93, 0xdc, 0x27, 0x5f
+};
+
+static uint8_t benchData[CRYPTO_LATENCY_BENCH_MAX_DATA] __attribute__((aligned(4)));
+static uint8_t benchCipher[CRYPTO_LATENCY_BENCH_MAX_DATA] __attribute__((aligned(4)));
+static uint8_t benchOutput[CRYPTO_LATENCY_BENCH_MAX_DATA] __attribute__((aligned(4)));
+static uint8_t benchTag[CRYPTO_LATENCY_BENCH_TAG_LEN];
+static uint8_t benchSignature[2UL * CRYPTO_LATENCY_BENCH_P256_LEN];
+
+static CRYPTO_LATENCY_BENCH_HISTOGRAM benchHistogram;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static int32_t lCRYPTO_LATENCY_BENCH_Hash(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, benchData, payloadBytes, benchOutput,
+        CRYPTO_HASH_SHA2_256, CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_GcmSeal(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Aead_AesGcm_EncryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, benchData, payloadBytes,
+        benchCipher, benchKey, sizeof(benchKey), benchIv, sizeof(benchIv), NULL, 0UL, benchTag,
+        CRYPTO_LATENCY_BENCH_TAG_LEN, CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_GcmOpen(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Aead_AesGcm_DecryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, benchCipher, payloadBytes,
+        benchOutput, benchKey, sizeof(benchKey), benchIv, sizeof(benchIv), NULL, 0UL, benchTag,
+        CRYPTO_LATENCY_BENCH_TAG_LEN, CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_Cmac(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Mac_AesCmac_Direct(CRYPTO_HANDLER_HW_INTERNAL, benchData, payloadBytes, benchOutput,
+        CRYPTO_LATENCY_BENCH_TAG_LEN, benchKey, sizeof(benchKey), CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_EcdsaSign(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, benchData, payloadBytes,
+        benchSignature, sizeof(benchSignature), benchPrivateKey, sizeof(benchPrivateKey),
+        CRYPTO_ECC_CURVE_P256, CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_EcdsaVerify(uint32_t payloadBytes)
+{
+    int8_t verifyStatus = 0;
+    int32_t status = (int32_t)Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_HW_INTERNAL, benchData, payloadBytes,
+        benchSignature, sizeof(benchSignature), benchPublicKey, sizeof(benchPublicKey), &verifyStatus,
+        CRYPTO_ECC_CURVE_P256, CRYPTO_LATENCY_BENCH_SESSION_ID);
+
+    if ((status == (int32_t)CRYPTO_DIGISIGN_SUCCESS) && (verifyStatus != 1))
+    {
+        status = (int32_t)CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+
+    return status;
+}
+
+/* The benchmark key pair is used on both sides; the engine time does not
+ * depend on whose public key it is. */
+static int32_t lCRYPTO_LATENCY_BENCH_Ecdh(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Kas_Ecdh_SharedSecret(CRYPTO_HANDLER_HW_INTERNAL, benchPrivateKey,
+        sizeof(benchPrivateKey), benchPublicKey, payloadBytes, benchOutput, 2UL * CRYPTO_LATENCY_BENCH_P256_LEN,
+        CRYPTO_ECC_CURVE_P256, CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static int32_t lCRYPTO_LATENCY_BENCH_Trng(uint32_t payloadBytes)
+{
+    return (int32_t)Crypto_Rng_Generate(CRYPTO_HANDLER_HW_INTERNAL, benchOutput, payloadBytes, NULL, 0UL,
+        CRYPTO_LATENCY_BENCH_SESSION_ID);
+}
+
+static const CRYPTO_LATENCY_BENCH_CASE benchCases[] = {
+    { "hash", 64UL, false, NULL, &lCRYPTO_LATENCY_BENCH_Hash },
+    { "hash", 1024UL, false, NULL, &lCRYPTO_LATENCY_BENCH_Hash },
+    { "gcm_seal", 64UL, false, NULL, &lCRYPTO_LATENCY_BENCH_GcmSeal },
+    { "gcm_seal", 1024UL, false, NULL, &lCRYPTO_LATENCY_BENCH_GcmSeal },
+    { "gcm_open", 64UL, false, &lCRYPTO_LATENCY_BENCH_GcmSeal, &lCRYPTO_LATENCY_BENCH_GcmOpen },
+    { "cmac", 64UL, false, NULL, &lCRYPTO_LATENCY_BENCH_Cmac },
+    { "ecdsa_sign", CRYPTO_LATENCY_BENCH_P256_LEN, true, NULL, &lCRYPTO_LATENCY_BENCH_EcdsaSign },
+    { "ecdsa_verify", CRYPTO_LATENCY_BENCH_P256_LEN, true, &lCRYPTO_LATENCY_BENCH_EcdsaSign,
+        &lCRYPTO_LATENCY_BENCH_EcdsaVerify },
+    { "ecdh", sizeof(benchPublicKey), true, NULL, &lCRYPTO_LATENCY_BENCH_Ecdh },
+    { "trng", 32UL, false, NULL, &lCRYPTO_LATENCY_BENCH_Trng },
+};
+
+/**
+ * @brief Get the histogram bucket of a sample.
+ */
+static uint32_t lCRYPTO_LATENCY_BENCH_Bucket(uint32_t ticks)
+{
+    uint32_t shift = 0UL;
+
+    while ((ticks >> shift) >= (2UL * CRYPTO_LATENCY_BENCH_SUB_BUCKETS))
+    {
+        shift++;
+    }
+
+    return (ticks < CRYPTO_LATENCY_BENCH_SUB_BUCKETS) ? ticks :
+        (((shift + 1UL) * CRYPTO_LATENCY_BENCH_SUB_BUCKETS) + ((ticks >> shift) - CRYPTO_LATENCY_BENCH_SUB_BUCKETS));
+}
+
+/**
+ * @brief Get the largest sample that falls into a bucket.
+ */
+static uint32_t lCRYPTO_LATENCY_BENCH_BucketTop(uint32_t bucket)
+{
+    uint32_t top = bucket;
+
+    if (bucket >= CRYPTO_LATENCY_BENCH_SUB_BUCKETS)
+    {
+        uint32_t shift = (bucket / CRYPTO_LATENCY_BENCH_SUB_BUCKETS) - 1UL;
+        uint64_t next = (uint64_t)((bucket % CRYPTO_LATENCY_BENCH_SUB_BUCKETS) + CRYPTO_LATENCY_BENCH_SUB_BUCKETS + 1UL);
+
+        top = (uint32_t)((next << shift) - 1ULL);
+    }
+
+    return top;
+}
+
+static unsigned long lCRYPTO_LATENCY_BENCH_TicksToNs(uint32_t ticks, uint32_t tickRate)
+{
+    uint64_t ns = ((uint64_t)ticks * 1000000000ULL) / tickRate;
+
+    return (ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (unsigned long)ns;
+}
+
+static void lCRYPTO_LATENCY_BENCH_WriteRow(const CRYPTO_LATENCY_BENCH_CASE *benchCase, uint32_t loadRateHz,
+    uint32_t errors)
+{
+    char line[CRYPTO_LATENCY_BENCH_LINE_SIZE];
+    uint32_t tickRate = CRYPTO_LATENCY_BENCH_PORT_TickRate();
+
+    (void)snprintf(line, sizeof(line), "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", benchCase->name,
+        (unsigned long)benchCase->payloadBytes, (unsigned long)loadRateHz, (unsigned long)benchHistogram.count,
+        (unsigned long)errors,
+        lCRYPTO_LATENCY_BENCH_TicksToNs(benchHistogram.min, tickRate),
+        lCRYPTO_LATENCY_BENCH_TicksToNs(CRYPTO_LATENCY_BENCH_Percentile(&benchHistogram, CRYPTO_LATENCY_BENCH_P50), tickRate),
+        lCRYPTO_LATENCY_BENCH_TicksToNs(CRYPTO_LATENCY_BENCH_Percentile(&benchHistogram, CRYPTO_LATENCY_BENCH_P99), tickRate),
+        lCRYPTO_LATENCY_BENCH_TicksToNs(CRYPTO_LATENCY_BENCH_Percentile(&benchHistogram, CRYPTO_LATENCY_BENCH_P999), tickRate),
+        lCRYPTO_LATENCY_BENCH_TicksToNs(benchHistogram.max, tickRate));
+
+    CRYPTO_LATENCY_BENCH_PORT_WriteLine(line);
+}
+
+static void lCRYPTO_LATENCY_BENCH_RunCase(const CRYPTO_LATENCY_BENCH_CASE *benchCase, uint32_t loadRateHz,
+    uint32_t iterations)
+{
+    uint32_t count = iterations;
+    uint32_t errors = 0UL;
+    uint32_t index;
+
+    if (count == 0UL)
+    {
+        count = (benchCase->pke == true) ? CRYPTO_LATENCY_BENCH_PKE_ITERATIONS : CRYPTO_LATENCY_BENCH_ITERATIONS;
+    }
+
+    for (index = 0UL; index < benchCase->payloadBytes; index++)
+    {
+        benchData[index] = (uint8_t)index;
+    }
+
+    CRYPTO_LATENCY_BENCH_HistogramClear(&benchHistogram);
+
+    if ((benchCase->prepare != NULL) && (benchCase->prepare(benchCase->payloadBytes) < 0))
+    {
+        // Every timed call would fail the same way; report the row as errors only.
+        errors = count;
+    }
+    else
+    {
+        CRYPTO_LATENCY_BENCH_PORT_LoadStart(loadRateHz);
+
+        for (index = 0UL; index < (CRYPTO_LATENCY_BENCH_WARMUP + count); index++)
+        {
+            uint32_t start = CRYPTO_LATENCY_BENCH_PORT_Timestamp();
+            int32_t status = benchCase->run(benchCase->payloadBytes);
+            uint32_t ticks = CRYPTO_LATENCY_BENCH_PORT_Timestamp() - start;
+
+            if (index >= CRYPTO_LATENCY_BENCH_WARMUP)
+            {
+                if (status < 0)
+                {
+                    errors++;
+                }
+                else
+                {
+                    CRYPTO_LATENCY_BENCH_HistogramAdd(&benchHistogram, ticks);
+                }
+            }
+        }
+
+        CRYPTO_LATENCY_BENCH_PORT_LoadStop();
+    }
+
+    lCRYPTO_LATENCY_BENCH_WriteRow(benchCase, loadRateHz, errors);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_LATENCY_BENCH_HistogramClear(CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram)
+{
+    (void)memset(histogram, 0, sizeof(*histogram));
+    histogram->min = 0xFFFFFFFFUL;
+}
+
+void CRYPTO_LATENCY_BENCH_HistogramAdd(CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram, uint32_t ticks)
+{
+    histogram->bins[lCRYPTO_LATENCY_BENCH_Bucket(ticks)]++;
+    histogram->count++;
+
+    if (ticks < histogram->min)
+    {
+        histogram->min = ticks;
+    }
+    if (ticks > histogram->max)
+    {
+        histogram->max = ticks;
+    }
+}
+
+uint32_t CRYPTO_LATENCY_BENCH_Percentile(const CRYPTO_LATENCY_BENCH_HISTOGRAM *histogram, uint32_t hundredths)
+{
+    uint32_t value = 0UL;
+
+    if (histogram->count > 0UL)
+    {
+        // Rank of the sample at the percentile, rounded up and at least 1.
+        uint64_t rank = (((uint64_t)histogram->count * hundredths) + 9999ULL) / 10000ULL;
+        uint64_t seen = 0ULL;
+        uint32_t bucket = 0UL;
+
+        if (rank == 0ULL)
+        {
+            rank = 1ULL;
+        }
+
+        while ((bucket < (CRYPTO_LATENCY_BENCH_BUCKETS - 1UL)) && ((seen + histogram->bins[bucket]) < rank))
+        {
+            seen += histogram->bins[bucket];
+            bucket++;
+        }
+
+        value = lCRYPTO_LATENCY_BENCH_BucketTop(bucket);
+        if (value > histogram->max)
+        {
+            value = histogram->max;
+        }
+        if (value < histogram->min)
+        {
+            value = histogram->min;
+        }
+    }
+
+    return value;
+}
+
+uint32_t CRYPTO_LATENCY_BENCH_Run(const char *op, uint32_t loadRateHz, uint32_t iterations)
+{
+    uint32_t rows = 0UL;
+    uint32_t index;
+
+    for (index = 0UL; index < (sizeof(benchCases) / sizeof(benchCases[0])); index++)
+    {
+        if ((op == NULL) || (strcmp(op, benchCases[index].name) == 0))
+        {
+            lCRYPTO_LATENCY_BENCH_RunCase(&benchCases[index], loadRateHz, iterations);
+            rows++;
+        }
+    }
+
+    return rows;
+}
@@ -0,0 +1,388 @@
+/*******************************************************************************
+  Crypto OTA Receiver Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ota.c
+
+  Summary:
+    This source file implements the overlapped reception, decryption and
+    programming of an AES-GCM encrypted firmware image.
+
+  Description:
+    A ciphertext block belongs to the receive interrupt while its length is
+    0 and to CRYPTO_OTA_Task() once the interrupt has set the length, until
+    the task clears it again. The task reads and clears the lengths, and
+    reads the byte count, with the receive interrupt masked; it decrypts and
+    programs with the interrupt enabled. The plaintext blocks are only used
+    by the task: one is decrypted into while the other is programmed.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include <string.h>
+#include "app/crypto_ota.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_OTA_SESSION_ID           (1U)
+#define CRYPTO_OTA_KEY_MAX              (32UL)
+#define CRYPTO_OTA_LENGTH_OFFSET        (4UL)
+#define CRYPTO_OTA_IV_OFFSET            (8UL)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+// Shared with the receive interrupt.
+static volatile CRYPTO_OTA_STATUS otaStatus = CRYPTO_OTA_ERROR_ARG;
+static volatile CRYPTO_OTA_STATUS otaRxError;
+static volatile uint32_t otaRxCount;
+static volatile uint32_t otaImageLength;
+static volatile uint32_t otaCipherLen[2];
+static uint8_t otaHeader[CRYPTO_OTA_HEADER_SIZE];
+static uint8_t otaTag[CRYPTO_OTA_TAG_SIZE];
+static uint8_t otaCipher[2][CRYPTO_OTA_BLOCK_SIZE];
+static uint32_t otaRxBlock;
+static uint32_t otaRxPos;
+
+// Used by CRYPTO_OTA_Task() only.
+static st_Crypto_Aead_AesGcm_ctx otaGcmCtx;
+static bool otaGcmStarted;
+static uint8_t otaKey[CRYPTO_OTA_KEY_MAX];
+static uint32_t otaKeyLen;
+static uint32_t otaSlotAddress;
+static uint32_t otaSlotSize;
+static uint8_t otaPlain[2][CRYPTO_OTA_BLOCK_SIZE];
+static uint32_t otaPlainLen[2];
+static uint32_t otaDecryptBlock;
+static uint32_t otaPlainHead;
+static uint32_t otaPlainTail;
+static bool otaWriting;
+static volatile uint32_t otaCommitted;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_OTA_STATUS lCRYPTO_OTA_Begin(uint32_t imageLength)
+{
+    CRYPTO_OTA_STATUS status = CRYPTO_OTA_PENDING;
+
+    if (memcmp(otaHeader, CRYPTO_OTA_MAGIC, CRYPTO_OTA_LENGTH_OFFSET) != 0)
+    {
+        status = CRYPTO_OTA_ERROR_HEADER;
+    }
+    else if (imageLength > otaSlotSize)
+    {
+        status = CRYPTO_OTA_ERROR_FLASH;
+    }
+    else if ((Crypto_Aead_AesGcm_Init(&otaGcmCtx, CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_CIOP_DECRYPT, otaKey, otaKeyLen,
+                                      &otaHeader[CRYPTO_OTA_IV_OFFSET], CRYPTO_OTA_IV_SIZE, CRYPTO_OTA_SESSION_ID) !=
+              CRYPTO_AEAD_CIPHER_SUCCESS) ||
+             (Crypto_Aead_AesGcm_AddAadData(&otaGcmCtx, otaHeader, CRYPTO_OTA_HEADER_SIZE) !=
+              CRYPTO_AEAD_CIPHER_SUCCESS))
+    {
+        status = CRYPTO_OTA_ERROR_CIPHER;
+    }
+    else
+    {
+        otaGcmStarted = true;
+    }
+
+    return status;
+}
+
+// Retire the programming in progress and start the next one.
+static CRYPTO_OTA_STATUS lCRYPTO_OTA_Commit(void)
+{
+    CRYPTO_OTA_STATUS status = CRYPTO_OTA_PENDING;
+    bool failed = false;
+
+    if (otaWriting && !CRYPTO_OTA_PORT_FlashBusy(&failed))
+    {
+        otaWriting = false;
+        if (failed)
+        {
+            status = CRYPTO_OTA_ERROR_FLASH;
+        }
+        else
+        {
+            otaCommitted += otaPlainLen[otaPlainTail];
+            otaPlainLen[otaPlainTail] = 0UL;
+            otaPlainTail ^= 1UL;
+        }
+    }
+
+    if ((status == CRYPTO_OTA_PENDING) && !otaWriting && (otaPlainLen[otaPlainTail] > 0UL))
+    {
+        if (CRYPTO_OTA_PORT_FlashWrite(otaSlotAddress + otaCommitted, otaPlain[otaPlainTail],
+                                       otaPlainLen[otaPlainTail]))
+        {
+            otaWriting = true;
+        }
+        else
+        {
+            status = CRYPTO_OTA_ERROR_FLASH;
+        }
+    }
+
+    return status;
+}
+
+static CRYPTO_OTA_STATUS lCRYPTO_OTA_Finish(void)
+{
+    CRYPTO_OTA_STATUS status = CRYPTO_OTA_ERROR_CIPHER;
+    uint8_t computed[CRYPTO_OTA_TAG_SIZE];
+    uint8_t diff = 0U;
+    uint32_t index;
+
+    if (Crypto_Aead_AesGcm_Final(&otaGcmCtx, computed, (uint8_t)CRYPTO_OTA_TAG_SIZE) == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        for (index = 0UL; index < CRYPTO_OTA_TAG_SIZE; index++)
+        {
+            diff |= (uint8_t)(computed[index] ^ otaTag[index]);
+        }
+
+        if (diff != 0U)
+        {
+            status = CRYPTO_OTA_ERROR_AUTH;
+        }
+        else if (CRYPTO_OTA_PORT_Activate(otaSlotAddress, otaImageLength))
+        {
+            status = CRYPTO_OTA_SUCCESS;
+        }
+        else
+        {
+            status = CRYPTO_OTA_ERROR_FLASH;
+        }
+    }
+    (void)memset(computed, 0, sizeof(computed));
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: OTA Receiver Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_OTA_STATUS CRYPTO_OTA_Start(const uint8_t *key, uint32_t keyLen, uint32_t slotAddress, uint32_t slotSize)
+{
+    if ((key == NULL) || ((keyLen != 16UL) && (keyLen != 24UL) && (keyLen != 32UL)))
+    {
+        return CRYPTO_OTA_ERROR_ARG;
+    }
+
+    CRYPTO_OTA_PORT_RxLock();
+    otaRxError = CRYPTO_OTA_PENDING;
+    otaRxCount = 0UL;
+    otaImageLength = 0UL;
+    otaCipherLen[0] = 0UL;
+    otaCipherLen[1] = 0UL;
+    otaRxBlock = 0UL;
+    otaRxPos = 0UL;
+
+    (void)memcpy(otaKey, key, keyLen);
+    otaKeyLen = keyLen;
+    otaSlotAddress = slotAddress;
+    otaSlotSize = slotSize;
+    otaGcmStarted = false;
+    otaPlainLen[0] = 0UL;
+    otaPlainLen[1] = 0UL;
+    otaDecryptBlock = 0UL;
+    otaPlainHead = 0UL;
+    otaPlainTail = 0UL;
+    otaWriting = false;
+    otaCommitted = 0UL;
+    otaStatus = CRYPTO_OTA_PENDING;
+    CRYPTO_OTA_PORT_RxUnlock();
+
+    return CRYPTO_OTA_PENDING;
+}
+
+void CRYPTO_OTA_RxByte(uint8_t byte)
+{
+    uint32_t position = otaRxCount;
+    uint32_t cipherEnd = CRYPTO_OTA_HEADER_SIZE + otaImageLength;
+
+    if ((otaStatus != CRYPTO_OTA_PENDING) || (otaRxError != CRYPTO_OTA_PENDING))
+    {
+        return;
+    }
+
+    if (position < CRYPTO_OTA_HEADER_SIZE)
+    {
+        otaHeader[position] = byte;
+        if (position == (CRYPTO_OTA_HEADER_SIZE - 1UL))
+        {
+            otaImageLength = (uint32_t)otaHeader[CRYPTO_OTA_LENGTH_OFFSET] |
+                             ((uint32_t)otaHeader[CRYPTO_OTA_LENGTH_OFFSET + 1UL] << 8) |
+                             ((uint32_t)otaHeader[CRYPTO_OTA_LENGTH_OFFSET + 2UL] << 16) |
+                             ((uint32_t)otaHeader[CRYPTO_OTA_LENGTH_OFFSET + 3UL] << 24);
+        }
+    }
+    else if (position < cipherEnd)
+    {
+        if ((otaRxPos == 0UL) && (otaCipherLen[otaRxBlock] != 0UL))
+        {
+            // The task still holds both blocks.
+            otaRxError = CRYPTO_OTA_ERROR_OVERRUN;
+            return;
+        }
+
+        otaCipher[otaRxBlock][otaRxPos] = byte;
+        otaRxPos++;
+        if ((otaRxPos == CRYPTO_OTA_BLOCK_SIZE) || ((position + 1UL) == cipherEnd))
+        {
+            otaCipherLen[otaRxBlock] = otaRxPos;
+            otaRxBlock ^= 1UL;
+            otaRxPos = 0UL;
+        }
+    }
+    else if (position < (cipherEnd + CRYPTO_OTA_TAG_SIZE))
+    {
+        otaTag[position - cipherEnd] = byte;
+    }
+    else
+    {
+        // Bytes after the tag are not part of the image.
+        return;
+    }
+
+    otaRxCount = position + 1UL;
+}
+
+CRYPTO_OTA_STATUS CRYPTO_OTA_Task(void)
+{
+    CRYPTO_OTA_STATUS status = otaStatus;
+    uint32_t rxCount;
+    uint32_t cipherLen;
+    uint32_t imageLength;
+
+    if (status != CRYPTO_OTA_PENDING)
+    {
+        return status;
+    }
+
+    CRYPTO_OTA_PORT_RxLock();
+    rxCount = otaRxCount;
+    cipherLen = otaCipherLen[otaDecryptBlock];
+    imageLength = otaImageLength;
+    status = otaRxError;
+    CRYPTO_OTA_PORT_RxUnlock();
+
+    if ((status == CRYPTO_OTA_PENDING) && !otaGcmStarted && (rxCount >= CRYPTO_OTA_HEADER_SIZE))
+    {
+        status = lCRYPTO_OTA_Begin(imageLength);
+    }
+
+    if ((status == CRYPTO_OTA_PENDING) && otaGcmStarted)
+    {
+        status = lCRYPTO_OTA_Commit();
+
+        // Decrypt the next block while the previous one is programmed.
+        if ((status == CRYPTO_OTA_PENDING) && (cipherLen > 0UL) && (otaPlainLen[otaPlainHead] == 0UL))
+        {
+            if (Crypto_Aead_AesGcm_Cipher(&otaGcmCtx, otaCipher[otaDecryptBlock], cipherLen,
+                                          otaPlain[otaPlainHead]) == CRYPTO_AEAD_CIPHER_SUCCESS)
+            {
+                otaPlainLen[otaPlainHead] = cipherLen;
+                otaPlainHead ^= 1UL;
+
+                CRYPTO_OTA_PORT_RxLock();
+                otaCipherLen[otaDecryptBlock] = 0UL;
+                CRYPTO_OTA_PORT_RxUnlock();
+                otaDecryptBlock ^= 1UL;
+
+                status = lCRYPTO_OTA_Commit();
+            }
+            else
+            {
+                status = CRYPTO_OTA_ERROR_CIPHER;
+            }
+        }
+
+        if ((status == CRYPTO_OTA_PENDING) && (otaCommitted == imageLength) &&
+            (rxCount == (CRYPTO_OTA_HEADER_SIZE + imageLength + CRYPTO_OTA_TAG_SIZE)))
+        {
+            status = lCRYPTO_OTA_Finish();
+        }
+    }
+
+    if (status != CRYPTO_OTA_PENDING)
+    {
+        (void)memset(otaKey, 0, sizeof(otaKey));
+        otaStatus = status;
+    }
+
+    return status;
+}
+
+void CRYPTO_OTA_GetProgress(uint32_t *received, uint32_t *committed, uint32_t *imageLength)
+{
+    uint32_t rxCount;
+    uint32_t length;
+
+    CRYPTO_OTA_PORT_RxLock();
+    rxCount = otaRxCount;
+    length = (rxCount >= CRYPTO_OTA_HEADER_SIZE) ? otaImageLength : 0UL;
+    CRYPTO_OTA_PORT_RxUnlock();
+
+    if (received != NULL)
+    {
+        rxCount = (rxCount > CRYPTO_OTA_HEADER_SIZE) ? (rxCount - CRYPTO_OTA_HEADER_SIZE) : 0UL;
+        *received = (rxCount < length) ? rxCount : length;
+    }
+    if (committed != NULL)
+    {
+        *committed = otaCommitted;
+    }
+    if (imageLength != NULL)
+    {
+        *imageLength = length;
+    }
+}
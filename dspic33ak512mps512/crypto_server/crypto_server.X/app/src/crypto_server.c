@@ -0,0 +1,773 @@
+/*******************************************************************************
+  Crypto Server Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server.c
+
+  Summary:
+    This source file implements the request parser, request queue and
+    Crypto_* dispatch of the crypto offload server.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "app/crypto_server.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_rng.h"
+#include "crypto/common_crypto/crypto_trace.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Fixed-size request field prefixes (see crypto_server_protocol.h).
+#define CRYPTO_SERVER_HASH_PREFIX       (1U)
+#define CRYPTO_SERVER_GCM_PREFIX        (5U)
+#define CRYPTO_SERVER_CMAC_PREFIX       (2U)
+#define CRYPTO_SERVER_SIGN_PREFIX       (3U)
+#define CRYPTO_SERVER_VERIFY_PREFIX     (4U)
+#define CRYPTO_SERVER_ECDH_PREFIX       (3U)
+#define CRYPTO_SERVER_TRNG_PREFIX       (2U)
+#define CRYPTO_SERVER_INFO_SIZE         (16U)
+
+typedef enum
+{
+    CRYPTO_SERVER_RX_SOF = 0,
+    CRYPTO_SERVER_RX_HEADER,
+    CRYPTO_SERVER_RX_PAYLOAD,
+    CRYPTO_SERVER_RX_CRC
+} CRYPTO_SERVER_RX_STATE;
+
+/**
+ * @brief One queued request.
+ */
+typedef struct
+{
+    uint8_t op;
+    uint16_t tag;
+    uint16_t length;
+    uint8_t payload[CRYPTO_SERVER_MAX_PAYLOAD] __attribute__((aligned(4)));
+} CRYPTO_SERVER_SLOT;
+
+/**
+ * @brief Receive parser state. Only touched by CRYPTO_SERVER_RxByte().
+ */
+typedef struct
+{
+    CRYPTO_SERVER_RX_STATE state;
+    uint8_t header[CRYPTO_SERVER_HEADER_SIZE];
+    uint16_t count;
+    uint16_t length;
+    uint16_t crc;
+    uint16_t rxCrc;
+    bool drop;
+} CRYPTO_SERVER_PARSER;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_SERVER_SLOT serverSlots[CRYPTO_SERVER_SLOT_COUNT];
+
+/* Free-running slot counters. slotHead is only written by the parser and
+ * slotTail only by the task, so no locking is needed between them. */
+static volatile uint8_t slotHead;
+static volatile uint8_t slotTail;
+
+static CRYPTO_SERVER_PARSER serverParser;
+static volatile CRYPTO_SERVER_STATS serverStats;
+
+static uint8_t serverTxFrame[CRYPTO_SERVER_FRAME_OVERHEAD + CRYPTO_SERVER_MAX_PAYLOAD] __attribute__((aligned(4)));
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint16_t lCRYPTO_SERVER_GetU16(const uint8_t *data)
+{
+    return (uint16_t)((uint16_t)data[0] | (uint16_t)((uint16_t)data[1] << 8));
+}
+
+static void lCRYPTO_SERVER_PutU16(uint8_t *data, uint16_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+}
+
+static void lCRYPTO_SERVER_PutU32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)value;
+    data[1] = (uint8_t)(value >> 8);
+    data[2] = (uint8_t)(value >> 16);
+    data[3] = (uint8_t)(value >> 24);
+}
+
+static uint8_t lCRYPTO_SERVER_SlotsUsed(void)
+{
+    return (uint8_t)(slotHead - slotTail);
+}
+
+/**
+ * @brief Get the private key (and shared secret) length for a curve.
+ * @param curve The curve type.
+ * @return The key length in bytes, or 0 for an unsupported curve.
+ */
+static uint32_t lCRYPTO_SERVER_CurveKeyLen(crypto_EccCurveType_E curve)
+{
+    uint32_t keyLen = 0UL;
+
+    switch (curve)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            keyLen = 24UL;
+            break;
+        case CRYPTO_ECC_CURVE_P256:
+            keyLen = 32UL;
+            break;
+        case CRYPTO_ECC_CURVE_P384:
+            keyLen = 48UL;
+            break;
+        case CRYPTO_ECC_CURVE_P521:
+            keyLen = 66UL;
+            break;
+        default:
+            keyLen = 0UL;
+            break;
+    }
+
+    return keyLen;
+}
+
+/**
+ * @brief Get the digest length for a hash algorithm.
+ * @param algorithm The hash algorithm.
+ * @return The digest length in bytes, or 0 for an unsupported algorithm.
+ */
+static uint16_t lCRYPTO_SERVER_DigestLen(crypto_Hash_Algo_E algorithm)
+{
+    uint16_t digestLen = 0U;
+
+    switch (algorithm)
+    {
+        case CRYPTO_HASH_SHA1:
+            digestLen = 20U;
+            break;
+        case CRYPTO_HASH_SHA2_224:
+            digestLen = 28U;
+            break;
+        case CRYPTO_HASH_SHA2_256:
+            digestLen = 32U;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            digestLen = 48U;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            digestLen = 64U;
+            break;
+        default:
+            digestLen = 0U;
+            break;
+    }
+
+    return digestLen;
+}
+
+/**
+ * @brief Report a Crypto_* failure: the library status is the only payload byte.
+ */
+static crypto_Server_Status_E lCRYPTO_SERVER_Fail(crypto_Server_Status_E status, int32_t cryptoStatus,
+    uint8_t *resp, uint16_t *respLen)
+{
+    resp[0] = (uint8_t)(int8_t)cryptoStatus;
+    *respLen = 1U;
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Info(uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen == 0U)
+    {
+        resp[0] = (uint8_t)CRYPTO_SERVER_PROTOCOL_VERSION;
+        resp[1] = (uint8_t)CRYPTO_SERVER_SLOT_COUNT;
+        lCRYPTO_SERVER_PutU16(&resp[2], (uint16_t)CRYPTO_SERVER_MAX_PAYLOAD);
+        lCRYPTO_SERVER_PutU32(&resp[4], serverStats.rxFrames);
+        lCRYPTO_SERVER_PutU32(&resp[8], serverStats.crcErrors);
+        lCRYPTO_SERVER_PutU32(&resp[12], serverStats.overruns);
+        *respLen = CRYPTO_SERVER_INFO_SIZE;
+        status = CRYPTO_SERVER_STATUS_OK;
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Hash(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_HASH_PREFIX)
+    {
+        crypto_Hash_Algo_E algorithm = (crypto_Hash_Algo_E)req[0];
+        uint16_t digestLen = lCRYPTO_SERVER_DigestLen(algorithm);
+        crypto_Hash_Status_E hashStatus;
+
+        if (digestLen == 0U)
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_PARAM;
+        }
+        else
+        {
+            hashStatus = Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, &req[CRYPTO_SERVER_HASH_PREFIX],
+                (uint32_t)reqLen - CRYPTO_SERVER_HASH_PREFIX, resp, algorithm, CRYPTO_SERVER_SESSION_ID);
+
+            if (hashStatus == CRYPTO_HASH_SUCCESS)
+            {
+                *respLen = digestLen;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)hashStatus, resp, respLen);
+            }
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Gcm(bool seal, uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_GCM_PREFIX)
+    {
+        uint32_t keyLen = req[0];
+        uint32_t ivLen = req[1];
+        uint32_t tagLen = req[2];
+        uint32_t aadLen = lCRYPTO_SERVER_GetU16(&req[3]);
+        uint32_t fixedLen = CRYPTO_SERVER_GCM_PREFIX + keyLen + ivLen + aadLen;
+        uint8_t *key = &req[CRYPTO_SERVER_GCM_PREFIX];
+        uint8_t *iv = &key[keyLen];
+        uint8_t *aad = &iv[ivLen];
+        uint8_t *data = &aad[aadLen];
+        crypto_Aead_Status_E aeadStatus;
+
+        if (seal == true)
+        {
+            uint32_t dataLen = (uint32_t)reqLen - fixedLen;
+
+            if ((fixedLen <= reqLen) && ((dataLen + tagLen) <= CRYPTO_SERVER_MAX_PAYLOAD))
+            {
+                aeadStatus = Crypto_Aead_AesGcm_EncryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, data, dataLen,
+                    resp, key, keyLen, iv, ivLen, (aadLen > 0UL) ? aad : NULL, aadLen, &resp[dataLen],
+                    (uint8_t)tagLen, CRYPTO_SERVER_SESSION_ID);
+
+                if (aeadStatus == CRYPTO_AEAD_CIPHER_SUCCESS)
+                {
+                    *respLen = (uint16_t)(dataLen + tagLen);
+                    status = CRYPTO_SERVER_STATUS_OK;
+                }
+                else
+                {
+                    status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)aeadStatus, resp, respLen);
+                }
+            }
+        }
+        else if ((fixedLen + tagLen) <= reqLen)
+        {
+            uint32_t dataLen = (uint32_t)reqLen - fixedLen - tagLen;
+
+            aeadStatus = Crypto_Aead_AesGcm_DecryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, data, dataLen,
+                resp, key, keyLen, iv, ivLen, (aadLen > 0UL) ? aad : NULL, aadLen, &data[dataLen],
+                (uint8_t)tagLen, CRYPTO_SERVER_SESSION_ID);
+
+            if (aeadStatus == CRYPTO_AEAD_CIPHER_SUCCESS)
+            {
+                *respLen = (uint16_t)dataLen;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                // Never return unauthenticated plaintext.
+                (void)memset(resp, 0, dataLen);
+                status = lCRYPTO_SERVER_Fail((aeadStatus == CRYPTO_AEAD_ERROR_AUTHFAIL) ?
+                    CRYPTO_SERVER_STATUS_AUTH_FAIL : CRYPTO_SERVER_STATUS_CRYPTO_FAIL,
+                    (int32_t)aeadStatus, resp, respLen);
+            }
+        }
+        else
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Cmac(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_CMAC_PREFIX)
+    {
+        uint32_t keyLen = req[0];
+        uint32_t macLen = req[1];
+        uint8_t *key = &req[CRYPTO_SERVER_CMAC_PREFIX];
+        crypto_Mac_Status_E macStatus;
+
+        if ((CRYPTO_SERVER_CMAC_PREFIX + keyLen) <= reqLen)
+        {
+            macStatus = Crypto_Mac_AesCmac_Direct(CRYPTO_HANDLER_HW_INTERNAL, &key[keyLen],
+                (uint32_t)reqLen - CRYPTO_SERVER_CMAC_PREFIX - keyLen, resp, macLen, key, keyLen,
+                CRYPTO_SERVER_SESSION_ID);
+
+            if (macStatus == CRYPTO_MAC_CIPHER_SUCCESS)
+            {
+                *respLen = (uint16_t)macLen;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)macStatus, resp, respLen);
+            }
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_EcdsaSign(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_SIGN_PREFIX)
+    {
+        crypto_EccCurveType_E curve = (crypto_EccCurveType_E)req[0];
+        uint32_t privLen = req[1];
+        uint32_t hashLen = req[2];
+        uint32_t sigLen = 2UL * lCRYPTO_SERVER_CurveKeyLen(curve);
+        uint8_t *privKey = &req[CRYPTO_SERVER_SIGN_PREFIX];
+        crypto_DigiSign_Status_E signStatus;
+
+        if (sigLen == 0UL)
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_PARAM;
+        }
+        else if ((CRYPTO_SERVER_SIGN_PREFIX + privLen + hashLen) == reqLen)
+        {
+            signStatus = Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, &privKey[privLen], hashLen,
+                resp, sigLen, privKey, privLen, curve, CRYPTO_SERVER_SESSION_ID);
+
+            if (signStatus == CRYPTO_DIGISIGN_SUCCESS)
+            {
+                *respLen = (uint16_t)sigLen;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)signStatus, resp, respLen);
+            }
+        }
+        else
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_EcdsaVerify(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_VERIFY_PREFIX)
+    {
+        crypto_EccCurveType_E curve = (crypto_EccCurveType_E)req[0];
+        uint32_t pubLen = req[1];
+        uint32_t hashLen = req[2];
+        uint32_t sigLen = req[3];
+        uint8_t *pubKey = &req[CRYPTO_SERVER_VERIFY_PREFIX];
+        uint8_t *hash = &pubKey[pubLen];
+        int8_t verifyStatus = 0;
+        crypto_DigiSign_Status_E signStatus;
+
+        if ((CRYPTO_SERVER_VERIFY_PREFIX + pubLen + hashLen + sigLen) == reqLen)
+        {
+            signStatus = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_HW_INTERNAL, hash, hashLen,
+                &hash[hashLen], sigLen, pubKey, pubLen, &verifyStatus, curve, CRYPTO_SERVER_SESSION_ID);
+
+            if ((signStatus == CRYPTO_DIGISIGN_SUCCESS) && (verifyStatus == 1))
+            {
+                *respLen = 0U;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_VERIFY_FAIL, (int32_t)signStatus, resp, respLen);
+            }
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Ecdh(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen >= CRYPTO_SERVER_ECDH_PREFIX)
+    {
+        crypto_EccCurveType_E curve = (crypto_EccCurveType_E)req[0];
+        uint32_t privLen = req[1];
+        uint32_t pubLen = req[2];
+        uint32_t keyLen = lCRYPTO_SERVER_CurveKeyLen(curve);
+        uint8_t *privKey = &req[CRYPTO_SERVER_ECDH_PREFIX];
+        crypto_Kas_Status_E kasStatus;
+
+        if (keyLen == 0UL)
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_PARAM;
+        }
+        else if ((CRYPTO_SERVER_ECDH_PREFIX + privLen + pubLen) == reqLen)
+        {
+            /* The engine returns the shared point (X || Y); the X coordinate
+             * is the shared secret. */
+            kasStatus = Crypto_Kas_Ecdh_SharedSecret(CRYPTO_HANDLER_HW_INTERNAL, privKey, privLen,
+                &privKey[privLen], pubLen, resp, 2UL * keyLen, curve, CRYPTO_SERVER_SESSION_ID);
+
+            if (kasStatus == CRYPTO_KAS_SUCCESS)
+            {
+                (void)memset(&resp[keyLen], 0, keyLen);
+                *respLen = (uint16_t)keyLen;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)kasStatus, resp, respLen);
+            }
+        }
+        else
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Trng(uint8_t *req, uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+
+    if (reqLen == CRYPTO_SERVER_TRNG_PREFIX)
+    {
+        uint16_t length = lCRYPTO_SERVER_GetU16(req);
+        crypto_Rng_Status_E rngStatus;
+
+        if ((length == 0U) || (length > CRYPTO_SERVER_MAX_PAYLOAD))
+        {
+            status = CRYPTO_SERVER_STATUS_BAD_PARAM;
+        }
+        else
+        {
+            rngStatus = Crypto_Rng_Generate(CRYPTO_HANDLER_HW_INTERNAL, resp, length, NULL, 0UL,
+                CRYPTO_SERVER_SESSION_ID);
+
+            if (rngStatus == CRYPTO_RNG_SUCCESS)
+            {
+                *respLen = length;
+                status = CRYPTO_SERVER_STATUS_OK;
+            }
+            else
+            {
+                status = lCRYPTO_SERVER_Fail(CRYPTO_SERVER_STATUS_CRYPTO_FAIL, (int32_t)rngStatus, resp, respLen);
+            }
+        }
+    }
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Trace(uint16_t reqLen, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status = CRYPTO_SERVER_STATUS_BAD_OP;
+
+#ifdef CRYPTO_TRACE_ENABLE
+    if (reqLen == 0U)
+    {
+        *respLen = (uint16_t)CRYPTO_TRACE_Serialize(resp, CRYPTO_SERVER_MAX_PAYLOAD);
+        status = CRYPTO_SERVER_STATUS_OK;
+    }
+    else
+    {
+        status = CRYPTO_SERVER_STATUS_BAD_LENGTH;
+    }
+#else
+    (void)reqLen;
+    (void)resp;
+    (void)respLen;
+#endif
+
+    return status;
+}
+
+static crypto_Server_Status_E lCRYPTO_SERVER_Dispatch(CRYPTO_SERVER_SLOT *slot, uint8_t *resp, uint16_t *respLen)
+{
+    crypto_Server_Status_E status;
+
+    *respLen = 0U;
+
+    switch ((crypto_Server_Op_E)slot->op)
+    {
+        case CRYPTO_SERVER_OP_INFO:
+            status = lCRYPTO_SERVER_Info(slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_HASH:
+            status = lCRYPTO_SERVER_Hash(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_GCM_SEAL:
+            status = lCRYPTO_SERVER_Gcm(true, slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_GCM_OPEN:
+            status = lCRYPTO_SERVER_Gcm(false, slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_CMAC:
+            status = lCRYPTO_SERVER_Cmac(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_ECDSA_SIGN:
+            status = lCRYPTO_SERVER_EcdsaSign(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_ECDSA_VERIFY:
+            status = lCRYPTO_SERVER_EcdsaVerify(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_ECDH:
+            status = lCRYPTO_SERVER_Ecdh(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_TRNG:
+            status = lCRYPTO_SERVER_Trng(slot->payload, slot->length, resp, respLen);
+            break;
+        case CRYPTO_SERVER_OP_TRACE:
+            status = lCRYPTO_SERVER_Trace(slot->length, resp, respLen);
+            break;
+        default:
+            status = CRYPTO_SERVER_STATUS_BAD_OP;
+            break;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Server Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_SERVER_Initialize(void)
+{
+    slotHead = 0U;
+    slotTail = 0U;
+    (void)memset(&serverParser, 0, sizeof(serverParser));
+    serverParser.state = CRYPTO_SERVER_RX_SOF;
+    serverStats.rxFrames = 0UL;
+    serverStats.txFrames = 0UL;
+    serverStats.crcErrors = 0UL;
+    serverStats.overruns = 0UL;
+}
+
+void CRYPTO_SERVER_RxByte(uint8_t byte)
+{
+    CRYPTO_SERVER_PARSER *parser = &serverParser;
+    CRYPTO_SERVER_SLOT *slot = &serverSlots[slotHead % CRYPTO_SERVER_SLOT_COUNT];
+
+    switch (parser->state)
+    {
+        case CRYPTO_SERVER_RX_SOF:
+            if (byte == CRYPTO_SERVER_SOF)
+            {
+                // With every slot in use the frame is parsed but discarded.
+                parser->drop = (lCRYPTO_SERVER_SlotsUsed() >= CRYPTO_SERVER_SLOT_COUNT);
+                parser->crc = CRYPTO_SERVER_CRC_INIT;
+                parser->count = 0U;
+                parser->state = CRYPTO_SERVER_RX_HEADER;
+            }
+            break;
+
+        case CRYPTO_SERVER_RX_HEADER:
+            parser->crc = CRYPTO_SERVER_CrcUpdate(parser->crc, byte);
+            parser->header[parser->count] = byte;
+            parser->count++;
+
+            if (parser->count == CRYPTO_SERVER_HEADER_SIZE)
+            {
+                parser->length = lCRYPTO_SERVER_GetU16(&parser->header[4]);
+                parser->count = 0U;
+
+                if (parser->length > CRYPTO_SERVER_MAX_PAYLOAD)
+                {
+                    // Not a valid frame: resynchronize on the next SOF.
+                    serverStats.crcErrors++;
+                    parser->state = CRYPTO_SERVER_RX_SOF;
+                }
+                else if (parser->length == 0U)
+                {
+                    parser->state = CRYPTO_SERVER_RX_CRC;
+                }
+                else
+                {
+                    parser->state = CRYPTO_SERVER_RX_PAYLOAD;
+                }
+            }
+            break;
+
+        case CRYPTO_SERVER_RX_PAYLOAD:
+            parser->crc = CRYPTO_SERVER_CrcUpdate(parser->crc, byte);
+            if (parser->drop == false)
+            {
+                slot->payload[parser->count] = byte;
+            }
+            parser->count++;
+
+            if (parser->count == parser->length)
+            {
+                parser->count = 0U;
+                parser->state = CRYPTO_SERVER_RX_CRC;
+            }
+            break;
+
+        case CRYPTO_SERVER_RX_CRC:
+        default:
+            if (parser->count == 0U)
+            {
+                parser->rxCrc = byte;
+                parser->count++;
+                break;
+            }
+
+            parser->rxCrc |= (uint16_t)((uint16_t)byte << 8);
+            parser->state = CRYPTO_SERVER_RX_SOF;
+
+            if (parser->rxCrc != parser->crc)
+            {
+                serverStats.crcErrors++;
+            }
+            else if (parser->drop == true)
+            {
+                serverStats.overruns++;
+            }
+            else
+            {
+                slot->op = parser->header[0];
+                slot->tag = lCRYPTO_SERVER_GetU16(&parser->header[2]);
+                slot->length = parser->length;
+                serverStats.rxFrames++;
+
+                // Publish the slot to CRYPTO_SERVER_Task().
+                slotHead++;
+            }
+            break;
+    }
+}
+
+bool CRYPTO_SERVER_Task(void)
+{
+    bool processed = false;
+
+    if (lCRYPTO_SERVER_SlotsUsed() != 0U)
+    {
+        CRYPTO_SERVER_SLOT *slot = &serverSlots[slotTail % CRYPTO_SERVER_SLOT_COUNT];
+        uint8_t *frame = serverTxFrame;
+        uint8_t *resp = &frame[1U + CRYPTO_SERVER_HEADER_SIZE];
+        uint16_t respLen = 0U;
+        uint16_t crc = CRYPTO_SERVER_CRC_INIT;
+        crypto_Server_Status_E status;
+        uint32_t index;
+
+        status = lCRYPTO_SERVER_Dispatch(slot, resp, &respLen);
+
+        frame[0] = (uint8_t)CRYPTO_SERVER_SOF;
+        frame[1] = slot->op;
+        frame[2] = (uint8_t)(int8_t)status;
+        lCRYPTO_SERVER_PutU16(&frame[3], slot->tag);
+        lCRYPTO_SERVER_PutU16(&frame[5], respLen);
+
+        /* Requests may carry keys: wipe the slot before handing it back to the
+         * receiver. The response has already been built in serverTxFrame. */
+        (void)memset(slot->payload, 0, slot->length);
+        slotTail++;
+
+        for (index = 1UL; index < (1UL + CRYPTO_SERVER_HEADER_SIZE + respLen); index++)
+        {
+            crc = CRYPTO_SERVER_CrcUpdate(crc, frame[index]);
+        }
+        lCRYPTO_SERVER_PutU16(&frame[index], crc);
+
+        CRYPTO_SERVER_PORT_Write(frame, index + CRYPTO_SERVER_CRC_SIZE);
+
+        // Response payloads may hold secrets (ECDH, TRNG, plaintext).
+        (void)memset(resp, 0, respLen);
+        serverStats.txFrames++;
+        processed = true;
+    }
+
+    return processed;
+}
+
+void CRYPTO_SERVER_StatsGet(CRYPTO_SERVER_STATS *stats)
+{
+    stats->rxFrames = serverStats.rxFrames;
+    stats->txFrames = serverStats.txFrames;
+    stats->crcErrors = serverStats.crcErrors;
+    stats->overruns = serverStats.overruns;
+}
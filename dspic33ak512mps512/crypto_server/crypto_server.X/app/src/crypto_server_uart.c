@@ -0,0 +1,96 @@
+/*******************************************************************************
+  Crypto Server UART Port Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_uart.c
+
+  Summary:
+    This source file connects the crypto offload server to UART1.
+
+  Description:
+    Received bytes are drained from the MCC UART1 receive queue inside the
+    UART1 receive interrupt and parsed into request slots there, so requests
+    keep arriving while the main loop is blocked in a Crypto_* call.
+    Responses are written to the MCC transmit queue, which is drained by the
+    UART1 transmit interrupt while the next request is computed. The transmit
+    queue is sized in uart1.c to hold a complete maximum-size response.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+
+#include "app/crypto_server.h"
+#include "app/crypto_server_uart.h"
+#include "mcc_generated_files/uart/uart1.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief UART1 receive callback, called from _U1RXInterrupt.
+ */
+static void lCRYPTO_SERVER_UART_RxHandler(void)
+{
+    while (UART1_IsRxReady() == true)
+    {
+        CRYPTO_SERVER_RxByte(UART1_Read());
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Server UART Port Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_SERVER_UART_Initialize(void)
+{
+    CRYPTO_SERVER_Initialize();
+
+    UART1_BaudRateSet(CRYPTO_SERVER_UART_BAUD_RATE);
+    UART1_RxCompleteCallbackRegister(&lCRYPTO_SERVER_UART_RxHandler);
+}
+
+void CRYPTO_SERVER_PORT_Write(const uint8_t *data, uint32_t size)
+{
+    for (uint32_t index = 0UL; index < size; index++)
+    {
+        UART1_Write(data[index]);
+    }
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+  Crypto Streaming ECDSA Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digsign_stream.h
+
+  Summary:
+    This header file provides ECDSA sign and verify of a message fed in
+    parts, hashed on the SHA engine with the SHA-2 that matches the curve.
+
+  Description:
+    Crypto_DigiSign_Ecdsa_Sign() and Crypto_DigiSign_Ecdsa_Verify() take the
+    hash of the message, so a caller of either runs Crypto_Hash_Sha_Init(),
+    _Update() and _Final() into a buffer of its own first. The
+    Crypto_DigiSign_Ecdsa_Sign*() and _Verify*() functions here take the
+    message instead: Init() picks the hash of the curve, SHA-256 for P-192
+    and P-256, SHA-384 for P-384 and SHA-512 for P-521, and starts it,
+    Update() hashes a part, and Final() signs or verifies.
+
+    Final() holds the PKE and has the curve and the PKE_CONFIG set up before
+    it hashes the last block into the context
+    (Crypto_DigiSign_Ecdsa_Hw_SignStream()), and the PKE reads the digest
+    from there. The CAM drivers keep the CPU until each operation ends, so
+    the two engines do not run at the same time; what the caller saves is
+    the digest buffer and copy, a second pass over the arguments and, with
+    an RTOS, a wait for the PKE between the hash and the sign.
+
+    Final() wipes the context, whatever its result, and a context is
+    started again with Init(). The context is about 620 bytes, most of it
+    the SHA context.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_DIGSIGN_STREAM_H
+#define CRYPTO_DIGSIGN_STREAM_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// Longest digest, SHA-512 for P-521.
+#define CRYPTO_DIGISIGN_STREAM_MAX_DIGEST_SIZE  (64)
+
+typedef enum
+{
+    CRYPTO_DIGISIGN_STREAM_IDLE = 0,
+    CRYPTO_DIGISIGN_STREAM_SIGN,
+    CRYPTO_DIGISIGN_STREAM_VERIFY,
+}crypto_DigiSign_Stream_State_E;
+
+typedef struct{
+    st_Crypto_Hash_Sha_Ctx shaCtx_st;
+    uint8_t digest[CRYPTO_DIGISIGN_STREAM_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    crypto_HandlerType_E ecdsaHandler_en;
+    crypto_EccCurveType_E eccCurveType_en;
+    crypto_DigiSign_Stream_State_E state_en;
+    uint32_t hashLen;
+}st_Crypto_DigiSign_Ecdsa_Ctx;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Start the hash of a message to sign.
+ * @param ptr_ecdsaCtx_st The context.
+ * @param ecdsaHandlerType_en The handler of the SHA and PKE calls.
+ * @param eccCurveType_En The curve of the key, which selects the hash.
+ * @param ecdsaSessionId Session ID (maximum of 1).
+ * @return CRYPTO_DIGISIGN_SUCCESS; CRYPTO_DIGISIGN_ERROR_CURVE for a curve
+ *         that is not built or whose hash is not;
+ *         CRYPTO_DIGISIGN_ERROR_FAIL when the hash does not start; or the
+ *         error of the failed argument check.
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignInit(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                        crypto_HandlerType_E ecdsaHandlerType_en,
+                                                        crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
+/**
+ * @brief Hash the next part of the message to sign.
+ * @return CRYPTO_DIGISIGN_SUCCESS; CRYPTO_DIGISIGN_ERROR_ARG for a context
+ *         not started with SignInit(); CRYPTO_DIGISIGN_ERROR_INPUTDATA for
+ *         NULL data of nonzero length; CRYPTO_DIGISIGN_ERROR_FAIL when the
+ *         hash fails.
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignUpdate(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                          uint8_t *ptr_data, uint32_t dataLen);
+
+/**
+ * @brief Finish the hash and sign it, as Crypto_DigiSign_Ecdsa_Sign().
+ * @param ptr_outSig Receives r || s.
+ * @param sigLen Bytes of signature buffer.
+ * @param ptr_privKey The private key.
+ * @param privKeyLen Bytes of private key.
+ * @return The result of Crypto_DigiSign_Ecdsa_Sign(), or
+ *         CRYPTO_DIGISIGN_ERROR_INPUTHASH when the hash fails. The context
+ *         is wiped.
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignFinal(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                         uint8_t *ptr_outSig, uint32_t sigLen,
+                                                         uint8_t *ptr_privKey, uint32_t privKeyLen);
+
+/**
+ * @brief Start the hash of a message to verify; as SignInit().
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyInit(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                          crypto_HandlerType_E ecdsaHandlerType_en,
+                                                          crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
+/**
+ * @brief Hash the next part of the message to verify; as SignUpdate().
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyUpdate(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                            uint8_t *ptr_data, uint32_t dataLen);
+
+/**
+ * @brief Finish the hash and verify the signature of it, as
+ *        Crypto_DigiSign_Ecdsa_Verify().
+ * @param ptr_inputSig The signature, r || s.
+ * @param sigLen Bytes of signature.
+ * @param ptr_pubKey The public key, 0x04 || X || Y or compressed.
+ * @param pubKeyLen Bytes of public key.
+ * @param ptr_sigVerifyStat Receives 1 for a valid signature, else 0.
+ * @return The result of Crypto_DigiSign_Ecdsa_Verify(), or
+ *         CRYPTO_DIGISIGN_ERROR_INPUTHASH when the hash fails. The context
+ *         is wiped.
+ */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyFinal(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                           uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                           uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                           int8_t *ptr_sigVerifyStat);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_DIGSIGN_STREAM_H */
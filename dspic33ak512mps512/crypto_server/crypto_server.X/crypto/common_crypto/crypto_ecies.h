@@ -0,0 +1,198 @@
+/*******************************************************************************
+  Crypto ECIES Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecies.h
+
+  Summary:
+    This header file provides ECIES hybrid encryption to a P-256 or P-384
+    public key: an ephemeral ECDH on the PKE, the ANSI X9.63 KDF on the SHA
+    engine and AES-GCM, in one call each way.
+
+  Description:
+    Crypto_Ecies_Seal() encrypts a message to the public key of a recipient
+    and Crypto_Ecies_Open() decrypts it with the private key. The sealed
+    message is
+
+        R || C || T
+
+    with R the ephemeral public key, uncompressed (0x04 || X || Y, SEC 1),
+    C the ciphertext, as long as the message, and T the 16-byte GCM tag. The
+    AES key and a 16-byte GCM IV are derived with the X9.63 KDF from the X
+    coordinate of the shared point, with R as shared information:
+
+        P-256: SHA-256, AES-128 key    P-384: SHA-384, AES-256 key
+
+    This is the format of the "standard variable IV X9.63 AES-GCM" ECIES of
+    Apple's Security framework, and the same as Bouncy Castle or OpenSSL
+    callers build from X9.63 and GCM, so either side can be a host. The
+    additional data of GCM is empty for that format; a non-empty one binds
+    the message to a context both sides agree on.
+
+    Both calls work in place: the message sits in the sealed buffer after
+    the room for R, Seal writes R before it, encrypts it where it is and
+    appends T, and Open decrypts it back where it is. The ephemeral private
+    key, the shared point and the derived key and IV live on the stack of
+    the call and are wiped before it returns; none of them passes through
+    a buffer of the caller. Seal takes the ephemeral key pair from the pool
+    of crypto_handshake.h when it has one, so an application that calls
+    Crypto_Handshake_Pool_Task() when idle seals with one scalar
+    multiplication instead of two. Open checks that R is a point of the
+    curve before it uses the private key, and wipes the message when the
+    tag does not match.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECIES_H
+#define CRYPTO_ECIES_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// GCM tag at the end of a sealed message.
+#define CRYPTO_ECIES_TAG_SIZE           (16)
+
+// GCM IV derived with the key.
+#define CRYPTO_ECIES_IV_SIZE            (16)
+
+// Ephemeral public key at the start of a sealed message, 0x04 || X || Y.
+#define CRYPTO_ECIES_P256_POINT_SIZE    (65)
+#define CRYPTO_ECIES_P384_POINT_SIZE    (97)
+
+// Bytes a sealed message adds to the message.
+#define CRYPTO_ECIES_P256_OVERHEAD      (CRYPTO_ECIES_P256_POINT_SIZE + CRYPTO_ECIES_TAG_SIZE)
+#define CRYPTO_ECIES_P384_OVERHEAD      (CRYPTO_ECIES_P384_POINT_SIZE + CRYPTO_ECIES_TAG_SIZE)
+
+typedef enum {
+    CRYPTO_ECIES_ERROR_NOTSUPPTED = -127,
+    CRYPTO_ECIES_ERROR_CURVE = -126,
+    CRYPTO_ECIES_ERROR_PUBKEY = -125,       // Not a point of the curve
+    CRYPTO_ECIES_ERROR_PRIVKEY = -124,
+    CRYPTO_ECIES_ERROR_INPUTDATA = -123,
+    CRYPTO_ECIES_ERROR_OUTPUTDATA = -122,   // Sealed buffer too small
+    CRYPTO_ECIES_ERROR_ARG = -121,
+    CRYPTO_ECIES_ERROR_SID = -120,
+    CRYPTO_ECIES_ERROR_HDLR = -119,
+    CRYPTO_ECIES_ERROR_RNG = -118,
+    CRYPTO_ECIES_ERROR_PKE = -117,
+    CRYPTO_ECIES_ERROR_KDF = -116,
+    CRYPTO_ECIES_ERROR_AEAD = -115,
+    CRYPTO_ECIES_ERROR_AUTH = -114,         // The tag does not match
+    CRYPTO_ECIES_SUCCESS = 0
+}crypto_Ecies_Status_E;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the size of the ephemeral public key at the start of a sealed
+ *        message, which is where Seal expects the message.
+ * @param eciesCurve_en The curve.
+ * @return CRYPTO_ECIES_P256_POINT_SIZE or CRYPTO_ECIES_P384_POINT_SIZE, 0
+ *         for a curve that is not supported.
+ */
+uint32_t Crypto_Ecies_PointSize(crypto_EccCurveType_E eciesCurve_en);
+
+/**
+ * @brief Seal a message to a public key, in place.
+ * @param eciesHandler_en The handler of the TRNG, PKE, SHA and AES calls.
+ * @param eciesCurve_en CRYPTO_ECC_CURVE_P256 or CRYPTO_ECC_CURVE_P384.
+ * @param ptr_recipientPubKey The public key of the recipient, X || Y or
+ *        0x04 || X || Y.
+ * @param recipientPubKeyLen Bytes of public key.
+ * @param ptr_aad Additional data, or NULL for none.
+ * @param aadLen Bytes of additional data.
+ * @param ptr_sealed The sealed buffer, with the message at offset
+ *        Crypto_Ecies_PointSize(); receives R || C || T.
+ * @param msgLen Bytes of message.
+ * @param sealedSize Size of the sealed buffer, at least the message plus
+ *        the overhead of the curve.
+ * @param eciesSessionId Session ID (maximum of 1).
+ * @return CRYPTO_ECIES_SUCCESS with msgLen plus the overhead of the curve
+ *         bytes sealed, or the CRYPTO_ECIES_ERROR_* of the failed check or
+ *         call; the message is wiped when the encryption fails.
+ */
+crypto_Ecies_Status_E Crypto_Ecies_Seal(crypto_HandlerType_E eciesHandler_en, crypto_EccCurveType_E eciesCurve_en,
+                                        uint8_t *ptr_recipientPubKey, uint32_t recipientPubKeyLen,
+                                        uint8_t *ptr_aad, uint32_t aadLen,
+                                        uint8_t *ptr_sealed, uint32_t msgLen, uint32_t sealedSize,
+                                        uint32_t eciesSessionId);
+
+/**
+ * @brief Open a sealed message with the private key, in place.
+ * @param eciesHandler_en The handler of the PKE, SHA and AES calls.
+ * @param eciesCurve_en CRYPTO_ECC_CURVE_P256 or CRYPTO_ECC_CURVE_P384.
+ * @param ptr_privKey The private key of the recipient, one coordinate long.
+ * @param privKeyLen Bytes of private key.
+ * @param ptr_aad Additional data given to Seal, or NULL for none.
+ * @param aadLen Bytes of additional data.
+ * @param ptr_sealed The sealed message, R || C || T; receives the message
+ *        at offset Crypto_Ecies_PointSize().
+ * @param sealedLen Bytes of sealed message.
+ * @param ptr_msgLen Receives the bytes of message.
+ * @param eciesSessionId Session ID (maximum of 1).
+ * @return CRYPTO_ECIES_SUCCESS, CRYPTO_ECIES_ERROR_AUTH when the tag does
+ *         not match, or the CRYPTO_ECIES_ERROR_* of the failed check or
+ *         call; the message is only left in the buffer on success.
+ */
+crypto_Ecies_Status_E Crypto_Ecies_Open(crypto_HandlerType_E eciesHandler_en, crypto_EccCurveType_E eciesCurve_en,
+                                        uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                        uint8_t *ptr_aad, uint32_t aadLen,
+                                        uint8_t *ptr_sealed, uint32_t sealedLen, uint32_t *ptr_msgLen,
+                                        uint32_t eciesSessionId);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_ECIES_H */
@@ -0,0 +1,341 @@
+/*******************************************************************************
+  Crypto Handshake Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_handshake.h
+
+  Summary:
+    This header file provides an ephemeral ECDH (ECDHE) handshake that chains
+    the TRNG, the PKE, the SHA engine and AES-GCM, and returns the session as
+    AES-GCM contexts ready to use.
+
+  Description:
+    Crypto_Handshake_Ecdhe_Start() draws the ephemeral private key from the
+    TRNG and computes its public key, X || Y without a prefix byte, to send to
+    the peer. Crypto_Handshake_Ecdhe_Finish() takes the public key of the
+    peer, computes the shared secret, derives the keys with HKDF (SHA-256 for
+    P-256, SHA-384 for P-384) and initializes the session: one GCM context
+    that encrypts the records sent and one that decrypts the records received.
+    Crypto_Handshake_Ecdhe() does both for a side that already has the public
+    key of the peer, typically the responder.
+
+    The private key, the shared secret and the HKDF state stay in the
+    handshake context, and the derived keys and IVs are written straight into
+    the session; none of them goes through a buffer of the application.
+    Finish wipes the private key and the secret as soon as the PRK is
+    extracted, and the HKDF state once the keys are derived, so an ephemeral
+    key serves one handshake.
+
+    The CAM library has no key generation; the public key is the ECDH product
+    of the private key and the generator. The engine returns the X coordinate;
+    when it does not also return a valid Y, Y is recovered in software as the
+    square root of X^3 - 3X + b, which takes about one modular
+    exponentiation. Either root gives the same shared secret. The public key
+    of the peer is checked to be a point of the curve before it is used.
+
+    The keys of each direction are labelled by the role, so the initiator
+    encrypts with the key the responder decrypts with. The nonce of record n
+    of a direction is its IV with n, 32-bit big endian, XORed into the last
+    four bytes; Crypto_Handshake_Session_Next() moves a context to the next
+    record once the previous one is finished. The GCM contexts point to the
+    keys and nonces of the session, so the session must not be moved or
+    copied once it is set up.
+
+    Generating the key pair takes a scalar multiplication, about as long as
+    the shared secret. Crypto_Handshake_Pool_Task(), called while the
+    application is idle, generates key pairs ahead into a pool of
+    CRYPTO_HANDSHAKE_POOL_<CURVE>_COUNT entries per curve, one per call.
+    Start then takes the oldest one in constant time and wipes its entry,
+    and only generates a key pair itself when the pool of its curve is
+    empty. Each pooled key pair serves one handshake.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_HANDSHAKE_H
+#define CRYPTO_HANDSHAKE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Key pairs kept ready for P-256 handshakes; 0 takes no memory.
+#ifndef CRYPTO_HANDSHAKE_POOL_P256_COUNT
+#define CRYPTO_HANDSHAKE_POOL_P256_COUNT    (2U)
+#endif
+
+// Key pairs kept ready for P-384 handshakes; 0 takes no memory.
+#ifndef CRYPTO_HANDSHAKE_POOL_P384_COUNT
+#define CRYPTO_HANDSHAKE_POOL_P384_COUNT    (2U)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Longest coordinate and private key, of P-384 when its handshake is built.
+#if (CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+#define CRYPTO_HANDSHAKE_MAX_KEY_SIZE   (48)
+#else
+#define CRYPTO_HANDSHAKE_MAX_KEY_SIZE   (32)
+#endif
+
+// Longest AES key of the session.
+#define CRYPTO_HANDSHAKE_MAX_AES_KEY_SIZE (32)
+
+// GCM IV and nonce of the session.
+#define CRYPTO_HANDSHAKE_IV_SIZE        (12)
+
+typedef enum {
+    CRYPTO_HANDSHAKE_ERROR_NOTSUPPTED = -127,
+    CRYPTO_HANDSHAKE_ERROR_CTX = -126,
+    CRYPTO_HANDSHAKE_ERROR_STATE = -125,    // Finish without a Start
+    CRYPTO_HANDSHAKE_ERROR_CURVE = -124,
+    CRYPTO_HANDSHAKE_ERROR_PUBKEY = -123,   // The peer key is not a point of the curve
+    CRYPTO_HANDSHAKE_ERROR_KEY = -122,      // AES key length
+    CRYPTO_HANDSHAKE_ERROR_ARG = -121,
+    CRYPTO_HANDSHAKE_ERROR_SID = -120,
+    CRYPTO_HANDSHAKE_ERROR_HDLR = -119,
+    CRYPTO_HANDSHAKE_ERROR_RNG = -118,
+    CRYPTO_HANDSHAKE_ERROR_PKE = -117,
+    CRYPTO_HANDSHAKE_ERROR_KDF = -116,
+    CRYPTO_HANDSHAKE_ERROR_AEAD = -115,
+    CRYPTO_HANDSHAKE_ERROR_LIMIT = -114,    // Last record number of a direction used
+    CRYPTO_HANDSHAKE_SUCCESS = 0
+}crypto_Handshake_Status_E;
+
+typedef enum {
+    CRYPTO_HANDSHAKE_ROLE_INVALID = 0,
+    CRYPTO_HANDSHAKE_ROLE_INITIATOR = 1,    // Sends its public key first
+    CRYPTO_HANDSHAKE_ROLE_RESPONDER = 2,
+    CRYPTO_HANDSHAKE_ROLE_MAX
+}crypto_Handshake_Role_E;
+
+typedef struct{
+    uint32_t hsSessionId;
+    crypto_HandlerType_E hsHandler_en;
+    crypto_EccCurveType_E hsCurve_en;
+    crypto_Handshake_Role_E hsRole_en;
+    uint32_t keyLen;                            // Bytes of the private key and of a coordinate
+    bool started;                               // The ephemeral key pair is set
+    uint8_t privKey[CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t pubKey[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t secret[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    st_Crypto_Kdf_Hkdf_Ctx kdfCtx_st;
+}st_Crypto_Handshake_Ecdhe_Ctx;
+
+typedef struct{
+    uint32_t hsSessionId;
+    crypto_HandlerType_E hsHandler_en;
+    uint32_t keyLen;
+    st_Crypto_Aead_AesGcm_ctx txCtx_st;         // Encrypts the record being sent
+    st_Crypto_Aead_AesGcm_ctx rxCtx_st;         // Decrypts the record being received
+    uint32_t txSeq;                             // Number of the record of txCtx_st
+    uint32_t rxSeq;                             // Number of the record of rxCtx_st
+    uint8_t txKey[CRYPTO_HANDSHAKE_MAX_AES_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t rxKey[CRYPTO_HANDSHAKE_MAX_AES_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t txIv[CRYPTO_HANDSHAKE_IV_SIZE];
+    uint8_t rxIv[CRYPTO_HANDSHAKE_IV_SIZE];
+    uint8_t txNonce[CRYPTO_HANDSHAKE_IV_SIZE];
+    uint8_t rxNonce[CRYPTO_HANDSHAKE_IV_SIZE];
+}st_Crypto_Handshake_Session;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Generate the ephemeral key pair of a handshake.
+ * @param ptr_hsCtx_st The handshake context.
+ * @param hsHandler_en The handler of the TRNG, PKE, hash and GCM calls,
+ *        CRYPTO_HANDLER_HW_INTERNAL.
+ * @param hsRole_en CRYPTO_HANDSHAKE_ROLE_INITIATOR or
+ *        CRYPTO_HANDSHAKE_ROLE_RESPONDER.
+ * @param hsCurve_en CRYPTO_ECC_CURVE_P256 or CRYPTO_ECC_CURVE_P384.
+ * @param ptr_pubKey Receives the public key to send, X || Y.
+ * @param pubKeyLen Bytes of ptr_pubKey, at least twice the key size.
+ * @param hsSessionId Session ID (maximum of 1).
+ * @return CRYPTO_HANDSHAKE_SUCCESS, or the CRYPTO_HANDSHAKE_ERROR_* of the
+ *         failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe_Start(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st,
+                                                       crypto_HandlerType_E hsHandler_en, crypto_Handshake_Role_E hsRole_en,
+                                                       crypto_EccCurveType_E hsCurve_en, uint8_t *ptr_pubKey,
+                                                       uint32_t pubKeyLen, uint32_t hsSessionId);
+
+/**
+ * @brief Compute the shared secret with the public key of the peer and set
+ *        up the session. The handshake context is wiped, whatever the result.
+ * @param ptr_hsCtx_st The handshake context, started.
+ * @param ptr_peerPubKey The public key of the peer, X || Y.
+ * @param peerPubKeyLen Bytes of the public key, twice the key size.
+ * @param ptr_salt The HKDF salt, for example a hash of the messages of the
+ *        handshake, or NULL for none.
+ * @param saltLen Bytes of salt.
+ * @param aesKeyLen Bytes of the session keys, 16, 24 or 32.
+ * @param ptr_session_st Receives the session, with txCtx_st initialized to
+ *        encrypt record 0 and rxCtx_st to decrypt record 0.
+ * @return CRYPTO_HANDSHAKE_SUCCESS, or the CRYPTO_HANDSHAKE_ERROR_* of the
+ *         failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe_Finish(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st,
+                                                        uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                        uint8_t *ptr_salt, uint32_t saltLen, uint32_t aesKeyLen,
+                                                        st_Crypto_Handshake_Session *ptr_session_st);
+
+/**
+ * @brief Run a whole handshake with the public key of the peer at hand:
+ *        Crypto_Handshake_Ecdhe_Start() then Crypto_Handshake_Ecdhe_Finish().
+ * @param ptr_pubKey Receives the public key to send back to the peer.
+ * @return CRYPTO_HANDSHAKE_SUCCESS, or the CRYPTO_HANDSHAKE_ERROR_* of the
+ *         failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st, crypto_HandlerType_E hsHandler_en,
+                                                 crypto_Handshake_Role_E hsRole_en, crypto_EccCurveType_E hsCurve_en,
+                                                 uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                 uint8_t *ptr_salt, uint32_t saltLen, uint32_t aesKeyLen,
+                                                 st_Crypto_Handshake_Session *ptr_session_st, uint32_t hsSessionId);
+
+/**
+ * @brief Initialize the context of one direction for its next record, once
+ *        the current record is finished.
+ * @param ptr_session_st The session.
+ * @param cipherOper_en CRYPTO_CIOP_ENCRYPT for txCtx_st, CRYPTO_CIOP_DECRYPT
+ *        for rxCtx_st.
+ * @return CRYPTO_HANDSHAKE_SUCCESS, CRYPTO_HANDSHAKE_ERROR_LIMIT once the
+ *         2^32 records of the direction are used, or the
+ *         CRYPTO_HANDSHAKE_ERROR_* of the failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_Session_Next(st_Crypto_Handshake_Session *ptr_session_st,
+                                                        crypto_CipherOper_E cipherOper_en);
+
+/**
+ * @brief Get an ephemeral key pair for a protocol built on the handshake
+ *        primitives, such as ECIES: from the pool of the curve when it has
+ *        one ready, else generated now. The caller wipes the private key
+ *        once it is used.
+ * @param hsHandler_en The handler of the TRNG and PKE calls.
+ * @param hsCurve_en CRYPTO_ECC_CURVE_P256 or CRYPTO_ECC_CURVE_P384.
+ * @param ptr_privKey Receives the private key, one coordinate long.
+ * @param privKeyLen Size of the private key buffer.
+ * @param ptr_pubKey Receives the public key, X || Y.
+ * @param pubKeyLen Size of the public key buffer, at least two coordinates.
+ * @param hsSessionId Session ID (maximum of 1).
+ * @return CRYPTO_HANDSHAKE_SUCCESS, or the CRYPTO_HANDSHAKE_ERROR_* of the
+ *         failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_KeyPair(crypto_HandlerType_E hsHandler_en, crypto_EccCurveType_E hsCurve_en,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                   uint8_t *ptr_pubKey, uint32_t pubKeyLen, uint32_t hsSessionId);
+
+/**
+ * @brief Check that a public key is a point of the curve and compute the
+ *        ECDH secret with a private key, ephemeral or static.
+ * @param hsHandler_en The handler of the PKE call.
+ * @param hsCurve_en CRYPTO_ECC_CURVE_P256 or CRYPTO_ECC_CURVE_P384.
+ * @param ptr_privKey The private key, one coordinate long.
+ * @param privKeyLen Bytes of private key.
+ * @param ptr_peerPubKey The public key, X || Y.
+ * @param peerPubKeyLen Bytes of public key, two coordinates.
+ * @param ptr_secret Receives the secret, the X coordinate of the product.
+ * @param secretLen Size of the secret buffer, at least one coordinate.
+ * @param hsSessionId Session ID (maximum of 1).
+ * @return CRYPTO_HANDSHAKE_SUCCESS, CRYPTO_HANDSHAKE_ERROR_PUBKEY for a key
+ *         that is not a point of the curve, or the CRYPTO_HANDSHAKE_ERROR_*
+ *         of the failed check or call.
+ */
+crypto_Handshake_Status_E Crypto_Handshake_Agree(crypto_HandlerType_E hsHandler_en, crypto_EccCurveType_E hsCurve_en,
+                                                 uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                 uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                 uint8_t *ptr_secret, uint32_t secretLen, uint32_t hsSessionId);
+
+/**
+ * @brief Add one key pair to the pool of the curve with the fewest ready,
+ *        for the application to call when it is idle. Each call takes one
+ *        scalar multiplication on the PKE, with the TRNG draw before it.
+ *        Start may run meanwhile from another task or an interrupt.
+ * @param hsHandler_en The handler of the TRNG and PKE calls,
+ *        CRYPTO_HANDLER_HW_INTERNAL.
+ * @param hsSessionId Session ID (maximum of 1).
+ * @return true when a key pair was added, false when the pools are full or
+ *         the generation failed.
+ */
+bool Crypto_Handshake_Pool_Task(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId);
+
+/**
+ * @brief Get the number of key pairs ready for a curve.
+ * @param hsCurve_en The curve.
+ * @return The key pairs in its pool, 0 for a curve without one.
+ */
+uint32_t Crypto_Handshake_Pool_Count(crypto_EccCurveType_E hsCurve_en);
+
+/**
+ * @brief Wipe the key pairs of all the pools, for example before a sleep
+ *        that does not keep the RAM or to measure a handshake with the pool
+ *        empty.
+ */
+void Crypto_Handshake_Pool_Flush(void);
+
+/**
+ * @brief Wipe the keys of a session.
+ * @param ptr_session_st The session.
+ */
+void Crypto_Handshake_Session_Close(st_Crypto_Handshake_Session *ptr_session_st);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_HANDSHAKE_H */
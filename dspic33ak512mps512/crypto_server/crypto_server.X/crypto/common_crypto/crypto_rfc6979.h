@@ -0,0 +1,135 @@
+/*******************************************************************************
+  Crypto RFC 6979 ECDSA Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rfc6979.h
+
+  Summary:
+    This header file provides deterministic ECDSA signing (RFC 6979) on
+    P-256, P-384 and P-521, with the nonce derived by HMAC-DRBG on the SHA
+    engine instead of drawn from the TRNG.
+
+  Description:
+    Crypto_DigiSign_Ecdsa_Sign() signs on the PKE with a nonce the CAM
+    library draws from the TRNG inside the call, so a slow or failing TRNG
+    shows up as a longer sign or CRYPTO_DIGISIGN_ERROR_RNG.
+    Crypto_Rfc6979_Ecdsa_Sign() derives the nonce k from the private key
+    and the hash as RFC 6979 section 3.2 specifies, with HMAC-DRBG keyed
+    through the HKDF context of crypto_kdf.h: the pad blocks are hashed
+    once per DRBG key, and each HMAC with that key starts from the cached
+    pad states. The same key and hash always give
+    the same signature, which verifies as any ECDSA signature does.
+
+    The CAM library takes no nonce from the caller, so the signature is
+    built around the engine: R = k * G is an ECDH product of k and the
+    generator on the PKE, r is its X coordinate reduced mod n, and
+    s = k^-1 * (z + r * d) mod n runs on the CPU with Montgomery arithmetic,
+    the inverse as k^(n - 2). The TRNG is not used at all. The HMAC hash is
+    the one the hash length implies, SHA-256 for 32 bytes, SHA-384 for 48
+    and SHA-512 for 64, which is the hash of the message as the RFC
+    requires; hashing with the curve-matched SHA-2 gives its test vectors.
+
+    k, its inverse and the HMAC-DRBG state live on the stack of the call and
+    are wiped before it returns. The signature is r || s, each a coordinate
+    long, as Crypto_DigiSign_Ecdsa_Sign() writes it.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_RFC6979_H
+#define CRYPTO_RFC6979_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Derive the nonce RFC 6979 gives for a private key and a hash.
+ * @param ecdsaHandlerType_en The handler of the SHA calls.
+ * @param ptr_inputHash The hash of the message.
+ * @param hashLen Bytes of hash: 32, 48 or 64, which selects the HMAC hash.
+ * @param ptr_privKey The private key, a coordinate long.
+ * @param privKeyLen Bytes of private key.
+ * @param eccCurveType_En CRYPTO_ECC_CURVE_P256, _P384 or _P521.
+ * @param ptr_nonce Receives k, a coordinate long.
+ * @param nonceLen Bytes of nonce buffer.
+ * @param ecdsaSessionId Session ID (maximum of 1).
+ * @return CRYPTO_DIGISIGN_SUCCESS, or the CRYPTO_DIGISIGN_ERROR_* of the
+ *         failed check or call; the nonce is wiped on failure.
+ * @note For the test vectors of the RFC; signing needs no call to it.
+ */
+crypto_DigiSign_Status_E Crypto_Rfc6979_Ecdsa_Nonce(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                    uint32_t hashLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                    crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_nonce,
+                                                    uint32_t nonceLen, uint32_t ecdsaSessionId);
+
+/**
+ * @brief Sign a hash with a deterministic nonce (RFC 6979).
+ * @param ecdsaHandlerType_en The handler of the SHA and PKE calls.
+ * @param ptr_inputHash The hash of the message.
+ * @param hashLen Bytes of hash: 32, 48 or 64, which selects the HMAC hash.
+ * @param ptr_outSig Receives r || s.
+ * @param sigLen Bytes of signature buffer, at least two coordinates.
+ * @param ptr_privKey The private key, a coordinate long.
+ * @param privKeyLen Bytes of private key.
+ * @param eccCurveType_En CRYPTO_ECC_CURVE_P256, _P384 or _P521.
+ * @param ecdsaSessionId Session ID (maximum of 1).
+ * @return CRYPTO_DIGISIGN_SUCCESS, or the CRYPTO_DIGISIGN_ERROR_* of the
+ *         failed check or call; never CRYPTO_DIGISIGN_ERROR_RNG.
+ */
+crypto_DigiSign_Status_E Crypto_Rfc6979_Ecdsa_Sign(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                   uint32_t hashLen, uint8_t *ptr_outSig, uint32_t sigLen,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                   crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_RFC6979_H */
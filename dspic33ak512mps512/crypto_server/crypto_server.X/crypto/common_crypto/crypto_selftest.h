@@ -0,0 +1,192 @@
+/*******************************************************************************
+  Crypto Self-Test Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_selftest.h
+
+  Summary:
+    This header file provides the power-on and first-use known-answer tests
+    of the Crypto Library.
+
+  Description:
+    With CRYPTO_SELFTEST_ENABLE defined, every algorithm with a known-answer
+    test (KAT) runs it on the CAM before its first use, and its API calls
+    fail with the module's generic error once the test has failed.
+    Crypto_SelfTest_Run() tests all algorithms at boot
+    (CRYPTO_SELFTEST_MODE_FULL) or only those of
+    CRYPTO_SELFTEST_LAZY_BOOT_MASK (CRYPTO_SELFTEST_MODE_LAZY), leaving the
+    rest to be tested on first use. The tests of each engine form one lane:
+    Crypto_SelfTest_Run() runs the PKE lane (ECDSA, ECDH) on a task of its
+    own (Crypto_Osal_TaskStart()) and the AES and SHA lane on the caller, so
+    with the FreeRTOS and POSIX ports of crypto_osal.h the long PKE tests
+    overlap the others. The bare-metal port runs the lanes one after the
+    other.
+
+    The tests call the Crypto_*_Hw_* wrappers, so they check the CAM and not
+    the software handler. Each test uses one short vector per algorithm:
+    AES-128-GCM encryption and decryption, AES-128-CMAC, SHA-1 and SHA-2
+    digests of "abc", a P-256 ECDSA verification, a P-256 ECDH shared
+    secret and an HKDF-SHA-256 derivation. The HKDF test first clears the
+    pad state copy checks of crypto_kdf.h, so that it also checks that the
+    CAM hash contexts can be copied. The tests are built from
+    crypto_selftest.c for the modules of the project, following the
+    CRYPTO_CONFIG_* options of crypto_config.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_SELFTEST_H
+#define CRYPTO_SELFTEST_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum {
+    CRYPTO_SELFTEST_ERROR_KAT = -127,       // A known-answer test failed
+    CRYPTO_SELFTEST_ERROR_ARG = -126,       // Bad mode or algorithm
+    CRYPTO_SELFTEST_ERROR_NOTSUPPTD = -125, // The algorithm is not built
+    CRYPTO_SELFTEST_SUCCESS = 0
+}crypto_SelfTest_Status_E;
+
+typedef enum {
+    CRYPTO_SELFTEST_AEAD_AESGCM = 0,        // AES engine
+    CRYPTO_SELFTEST_MAC_AESCMAC,            // AES engine
+    CRYPTO_SELFTEST_HASH_SHA,               // SHA engine, every enabled algorithm
+    CRYPTO_SELFTEST_DIGISIGN_ECDSA,         // PKE
+    CRYPTO_SELFTEST_KAS_ECDH,               // PKE
+    CRYPTO_SELFTEST_KDF_HKDF,               // SHA engine, with the HMAC pad state copy check
+    CRYPTO_SELFTEST_ALGO_MAX
+}crypto_SelfTest_Algo_E;
+
+typedef enum {
+    CRYPTO_SELFTEST_MODE_FULL = 0,          // Test every algorithm now
+    CRYPTO_SELFTEST_MODE_LAZY = 1,          // Test CRYPTO_SELFTEST_LAZY_BOOT_MASK now, the rest on first use
+}crypto_SelfTest_Mode_E;
+
+typedef enum {
+    CRYPTO_SELFTEST_STATE_PENDING = 0,      // Not tested yet
+    CRYPTO_SELFTEST_STATE_PASSED = 1,
+    CRYPTO_SELFTEST_STATE_FAILED = 2,
+}crypto_SelfTest_State_E;
+
+#define CRYPTO_SELFTEST_MASK(algo)      (1UL << (uint32_t)(algo))
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+/* Define CRYPTO_SELFTEST_ENABLE in a project that builds crypto_selftest.c
+ * to gate each algorithm on its known-answer test. */
+
+// Algorithms tested at boot by CRYPTO_SELFTEST_MODE_LAZY; by default the fast AES and SHA tests.
+#ifndef CRYPTO_SELFTEST_LAZY_BOOT_MASK
+#define CRYPTO_SELFTEST_LAZY_BOOT_MASK  (CRYPTO_SELFTEST_MASK(CRYPTO_SELFTEST_AEAD_AESGCM) | \
+                                         CRYPTO_SELFTEST_MASK(CRYPTO_SELFTEST_MAC_AESCMAC) | \
+                                         CRYPTO_SELFTEST_MASK(CRYPTO_SELFTEST_HASH_SHA) | \
+                                         CRYPTO_SELFTEST_MASK(CRYPTO_SELFTEST_KDF_HKDF))
+#endif
+
+// Longest time Crypto_SelfTest_Run() waits for the PKE lane.
+#ifndef CRYPTO_SELFTEST_LANE_TIMEOUT_MS
+#define CRYPTO_SELFTEST_LANE_TIMEOUT_MS (1000UL)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Mark every algorithm untested and run the tests of the mode, the
+ *        PKE lane overlapping the AES and SHA lane where the OSAL port has
+ *        tasks. Also the on-demand self-test.
+ * @param mode CRYPTO_SELFTEST_MODE_FULL or CRYPTO_SELFTEST_MODE_LAZY.
+ * @return CRYPTO_SELFTEST_SUCCESS when every test run passed,
+ *         CRYPTO_SELFTEST_ERROR_KAT when one failed or the PKE lane did not
+ *         finish within CRYPTO_SELFTEST_LANE_TIMEOUT_MS, or
+ *         CRYPTO_SELFTEST_ERROR_ARG.
+ */
+crypto_SelfTest_Status_E Crypto_SelfTest_Run(crypto_SelfTest_Mode_E mode);
+
+/**
+ * @brief Make sure an algorithm has passed its test, running the test on the
+ *        calling task when it is still pending. Called by the Crypto_* APIs.
+ * @param algo The algorithm.
+ * @return CRYPTO_SELFTEST_SUCCESS when the algorithm may be used,
+ *         CRYPTO_SELFTEST_ERROR_KAT when its test failed, which holds until
+ *         the next Crypto_SelfTest_Run(), CRYPTO_SELFTEST_ERROR_NOTSUPPTD or
+ *         CRYPTO_SELFTEST_ERROR_ARG.
+ */
+crypto_SelfTest_Status_E Crypto_SelfTest_Require(crypto_SelfTest_Algo_E algo);
+
+/**
+ * @brief Get the test state of an algorithm.
+ * @param algo The algorithm.
+ * @return The state; CRYPTO_SELFTEST_STATE_FAILED for a bad algorithm.
+ */
+crypto_SelfTest_State_E Crypto_SelfTest_GetState(crypto_SelfTest_Algo_E algo);
+
+/**
+ * @brief Mark every algorithm untested, so each is tested again on its next use.
+ */
+void Crypto_SelfTest_Reset(void);
+
+#ifdef CRYPTO_SELFTEST_ENABLE
+#define CRYPTO_SELFTEST_REQUIRE(algo)   (Crypto_SelfTest_Require(CRYPTO_SELFTEST_##algo) == CRYPTO_SELFTEST_SUCCESS)
+#else
+#define CRYPTO_SELFTEST_REQUIRE(algo)   (true)
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_SELFTEST_H */
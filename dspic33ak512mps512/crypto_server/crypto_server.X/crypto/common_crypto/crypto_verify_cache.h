@@ -0,0 +1,156 @@
+/*******************************************************************************
+  Crypto Verified-Signature Cache Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_verify_cache.h
+
+  Summary:
+    This header file provides a cache of successful ECDSA verifications, so
+    that verifying the same signature again takes a lookup instead of the
+    PKE.
+
+  Description:
+    Crypto_VerifyCache_Ecdsa_Verify() takes the arguments of
+    Crypto_DigiSign_Ecdsa_Verify() and returns the same results. It hashes
+    the curve, the public key, the hash and the signature with SHA-256 on
+    the hash engine, and looks the digest up in a table of
+    CRYPTO_VERIFY_CACHE_ENTRIES entries. A hit returns a valid signature
+    without a PKE call; a miss verifies on the PKE and, when the signature
+    is valid, stores the digest in the free entry or the least recently
+    used one. Failed verifications are never stored.
+
+    The table does not hold the digests but their HMAC-SHA-256 under a key
+    drawn from the TRNG by the first call, so a value written into the table
+    by RAM corruption or by an attacker without the key does not match the
+    digest of any signature, and cannot make an invalid one pass. Each entry
+    also holds a check word over its tag and its use stamp, keyed by the
+    TRNG as well; every lookup checks the words of all entries and drops,
+    and counts in the statistics, any entry that fails. Flush() wipes the
+    table and the key; the next call draws a new key.
+
+    A hit costs one SHA-256 of about 100 to 350 bytes, one HMAC of 32 bytes
+    from cached pad states and a scan of the table, against 5 to 58 ms for
+    a verification on the PKE. The HMAC context and the table are shared by
+    the tasks that call the cache, behind the CRYPTO_OSAL_STATE_VERIFY_CACHE
+    mutex of crypto_osal.h: a call holds it for the key, the tag and the
+    lookup, then again to store the tag, but not while the PKE verifies.
+    A call that cannot take it within CRYPTO_OSAL_ENGINE_TIMEOUT_MS verifies
+    on the PKE uncached. With the FreeRTOS and POSIX ports,
+    Crypto_Osal_Initialize() creates the mutex and must run first.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+#ifndef CRYPTO_VERIFY_CACHE_H
+#define CRYPTO_VERIFY_CACHE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// Verifications kept; each entry takes 40 bytes.
+#ifndef CRYPTO_VERIFY_CACHE_ENTRIES
+#define CRYPTO_VERIFY_CACHE_ENTRIES     (16U)
+#endif
+
+typedef struct{
+    uint32_t hits;                  // Valid signatures found in the table
+    uint32_t misses;                // Verifications run on the PKE
+    uint32_t inserts;               // Valid signatures stored
+    uint32_t evictions;             // Entries replaced while in use
+    uint32_t corrupt;               // Entries dropped by their check word
+}st_Crypto_VerifyCache_Stats;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Verify a signature as Crypto_DigiSign_Ecdsa_Verify(), from the
+ *        cache when the same curve, public key, hash and signature were
+ *        verified valid before.
+ * @param ecdsaHandlerType_en The handler of the SHA and PKE calls.
+ * @param ptr_inputHash The hash that was signed.
+ * @param hashLen Bytes of hash.
+ * @param ptr_inputSig The signature, r || s.
+ * @param sigLen Bytes of signature.
+ * @param ptr_pubKey The public key, 0x04 || X || Y or compressed.
+ * @param pubKeyLen Bytes of public key.
+ * @param ptr_sigVerifyStat Receives 1 for a valid signature, else 0.
+ * @param eccCurveType_En The curve of the key.
+ * @param ecdsaSessionId Session ID (maximum of 1).
+ * @return CRYPTO_DIGISIGN_SUCCESS on a hit, else the result of
+ *         Crypto_DigiSign_Ecdsa_Verify(). Arguments the cache cannot take,
+ *         and calls while the key cannot be drawn, go to
+ *         Crypto_DigiSign_Ecdsa_Verify() uncached.
+ */
+crypto_DigiSign_Status_E Crypto_VerifyCache_Ecdsa_Verify(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                         uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                         uint8_t *ptr_pubKey, uint32_t pubKeyLen, int8_t *ptr_sigVerifyStat,
+                                                         crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
+/**
+ * @brief Wipe the table and the HMAC key; the statistics are kept. When the
+ *        mutex is held by the context this call preempted, the next call
+ *        that takes it wipes them before its lookup.
+ */
+void Crypto_VerifyCache_Flush(void);
+
+/**
+ * @brief Copy the statistics since reset.
+ * @param ptr_stats Receives the statistics.
+ */
+void Crypto_VerifyCache_GetStats(st_Crypto_VerifyCache_Stats *ptr_stats);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_VERIFY_CACHE_H */
@@ -0,0 +1,402 @@
+/*******************************************************************************
+  Crypto Big Number Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_bn.c
+
+  Summary:
+    This file contains the modular arithmetic on 32-bit limbs and the curve
+    domain parameters shared by the ECDHE handshake and RFC 6979 ECDSA.
+
+  Description:
+    A reduction never branches on the value it reduces: it subtracts the
+    modulus into a scratch number and copies the result back under a mask
+    built from the carry and the borrow. The comparison runs over every limb
+    the same way. The loops only depend on the number of limbs, which follows
+    the curve and not the secret. See crypto_bn.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/src/crypto_bn.h"
+
+#if (CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1) || (CRYPTO_CONFIG_DIGISIGN_RFC6979 == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+static const uint8_t bnP256_p[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t bnP256_b[32] = {
+    0x5A, 0xC6, 0x35, 0xD8, 0xAA, 0x3A, 0x93, 0xE7, 0xB3, 0xEB, 0xBD, 0x55, 0x76, 0x98, 0x86, 0xBC,
+    0x65, 0x1D, 0x06, 0xB0, 0xCC, 0x53, 0xB0, 0xF6, 0x3B, 0xCE, 0x3C, 0x3E, 0x27, 0xD2, 0x60, 0x4B
+};
+static const uint8_t bnP256_n[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xBC, 0xE6, 0xFA, 0xAD, 0xA7, 0x17, 0x9E, 0x84, 0xF3, 0xB9, 0xCA, 0xC2, 0xFC, 0x63, 0x25, 0x51
+};
+static const uint8_t bnP256_gx[32] = {
+    0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2,
+    0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96
+};
+static const uint8_t bnP256_gy[32] = {
+    0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16,
+    0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5
+};
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+static const uint8_t bnP384_p[48] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+static const uint8_t bnP384_b[48] = {
+    0xB3, 0x31, 0x2F, 0xA7, 0xE2, 0x3E, 0xE7, 0xE4, 0x98, 0x8E, 0x05, 0x6B, 0xE3, 0xF8, 0x2D, 0x19,
+    0x18, 0x1D, 0x9C, 0x6E, 0xFE, 0x81, 0x41, 0x12, 0x03, 0x14, 0x08, 0x8F, 0x50, 0x13, 0x87, 0x5A,
+    0xC6, 0x56, 0x39, 0x8D, 0x8A, 0x2E, 0xD1, 0x9D, 0x2A, 0x85, 0xC8, 0xED, 0xD3, 0xEC, 0x2A, 0xEF
+};
+static const uint8_t bnP384_n[48] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x63, 0x4D, 0x81, 0xF4, 0x37, 0x2D, 0xDF,
+    0x58, 0x1A, 0x0D, 0xB2, 0x48, 0xB0, 0xA7, 0x7A, 0xEC, 0xEC, 0x19, 0x6A, 0xCC, 0xC5, 0x29, 0x73
+};
+static const uint8_t bnP384_gx[48] = {
+    0xAA, 0x87, 0xCA, 0x22, 0xBE, 0x8B, 0x05, 0x37, 0x8E, 0xB1, 0xC7, 0x1E, 0xF3, 0x20, 0xAD, 0x74,
+    0x6E, 0x1D, 0x3B, 0x62, 0x8B, 0xA7, 0x9B, 0x98, 0x59, 0xF7, 0x41, 0xE0, 0x82, 0x54, 0x2A, 0x38,
+    0x55, 0x02, 0xF2, 0x5D, 0xBF, 0x55, 0x29, 0x6C, 0x3A, 0x54, 0x5E, 0x38, 0x72, 0x76, 0x0A, 0xB7
+};
+static const uint8_t bnP384_gy[48] = {
+    0x36, 0x17, 0xDE, 0x4A, 0x96, 0x26, 0x2C, 0x6F, 0x5D, 0x9E, 0x98, 0xBF, 0x92, 0x92, 0xDC, 0x29,
+    0xF8, 0xF4, 0x1D, 0xBD, 0x28, 0x9A, 0x14, 0x7C, 0xE9, 0xDA, 0x31, 0x13, 0xB5, 0xF0, 0xB8, 0xC0,
+    0x0A, 0x60, 0xB1, 0xCE, 0x1D, 0x7E, 0x81, 0x9D, 0x7A, 0x43, 0x1D, 0x7C, 0x90, 0xEA, 0x0E, 0x5F
+};
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+static const uint8_t bnP521_p[66] = {
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF
+};
+static const uint8_t bnP521_b[66] = {
+    0x00, 0x51, 0x95, 0x3E, 0xB9, 0x61, 0x8E, 0x1C, 0x9A, 0x1F, 0x92, 0x9A, 0x21, 0xA0, 0xB6, 0x85,
+    0x40, 0xEE, 0xA2, 0xDA, 0x72, 0x5B, 0x99, 0xB3, 0x15, 0xF3, 0xB8, 0xB4, 0x89, 0x91, 0x8E, 0xF1,
+    0x09, 0xE1, 0x56, 0x19, 0x39, 0x51, 0xEC, 0x7E, 0x93, 0x7B, 0x16, 0x52, 0xC0, 0xBD, 0x3B, 0xB1,
+    0xBF, 0x07, 0x35, 0x73, 0xDF, 0x88, 0x3D, 0x2C, 0x34, 0xF1, 0xEF, 0x45, 0x1F, 0xD4, 0x6B, 0x50,
+    0x3F, 0x00
+};
+static const uint8_t bnP521_n[66] = {
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFA, 0x51, 0x86, 0x87, 0x83, 0xBF, 0x2F, 0x96, 0x6B, 0x7F, 0xCC, 0x01, 0x48, 0xF7, 0x09,
+    0xA5, 0xD0, 0x3B, 0xB5, 0xC9, 0xB8, 0x89, 0x9C, 0x47, 0xAE, 0xBB, 0x6F, 0xB7, 0x1E, 0x91, 0x38,
+    0x64, 0x09
+};
+static const uint8_t bnP521_gx[66] = {
+    0x00, 0xC6, 0x85, 0x8E, 0x06, 0xB7, 0x04, 0x04, 0xE9, 0xCD, 0x9E, 0x3E, 0xCB, 0x66, 0x23, 0x95,
+    0xB4, 0x42, 0x9C, 0x64, 0x81, 0x39, 0x05, 0x3F, 0xB5, 0x21, 0xF8, 0x28, 0xAF, 0x60, 0x6B, 0x4D,
+    0x3D, 0xBA, 0xA1, 0x4B, 0x5E, 0x77, 0xEF, 0xE7, 0x59, 0x28, 0xFE, 0x1D, 0xC1, 0x27, 0xA2, 0xFF,
+    0xA8, 0xDE, 0x33, 0x48, 0xB3, 0xC1, 0x85, 0x6A, 0x42, 0x9B, 0xF9, 0x7E, 0x7E, 0x31, 0xC2, 0xE5,
+    0xBD, 0x66
+};
+static const uint8_t bnP521_gy[66] = {
+    0x01, 0x18, 0x39, 0x29, 0x6A, 0x78, 0x9A, 0x3B, 0xC0, 0x04, 0x5C, 0x8A, 0x5F, 0xB4, 0x2C, 0x7D,
+    0x1B, 0xD9, 0x98, 0xF5, 0x44, 0x49, 0x57, 0x9B, 0x44, 0x68, 0x17, 0xAF, 0xBD, 0x17, 0x27, 0x3E,
+    0x66, 0x2C, 0x97, 0xEE, 0x72, 0x99, 0x5E, 0xF4, 0x26, 0x40, 0xC5, 0x50, 0xB9, 0x01, 0x3F, 0xAD,
+    0x07, 0x61, 0x35, 0x3C, 0x70, 0x86, 0xA2, 0x72, 0xC2, 0x40, 0x88, 0xBE, 0x94, 0x76, 0x9F, 0xD1,
+    0x66, 0x50
+};
+#endif
+
+static const st_Crypto_Bn_Curve bnCurves[] = {
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+    { CRYPTO_ECC_CURVE_P256, 32UL, 256UL, bnP256_p, bnP256_b, bnP256_n, bnP256_gx, bnP256_gy },
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+    { CRYPTO_ECC_CURVE_P384, 48UL, 384UL, bnP384_p, bnP384_b, bnP384_n, bnP384_gx, bnP384_gy },
+#endif
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+    { CRYPTO_ECC_CURVE_P521, 66UL, 521UL, bnP521_p, bnP521_b, bnP521_n, bnP521_gx, bnP521_gy },
+#endif
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief r = r - m when carry is set or r >= m, else r unchanged, for
+ *        carry:r below 2m. Both results are computed and one is kept under
+ *        a mask.
+ * @param carry The limb above r, 0 or 1.
+ */
+static void lCrypto_Bn_CondSub(uint32_t *ptr_r, uint32_t carry, const st_Crypto_Bn_Mod *ptr_mod)
+{
+    uint32_t t[CRYPTO_BN_MAX_LIMBS];
+    uint32_t borrow;
+    uint32_t keep;
+    uint32_t i;
+
+    borrow = Crypto_Bn_Sub(t, ptr_r, ptr_mod->m, ptr_mod->limbs);
+
+    // All ones to take r - m: carry:r >= m, which is a carry or no borrow.
+    keep = 0UL - ((carry | (borrow ^ 1UL)) & 1UL);
+    for (i = 0UL; i < ptr_mod->limbs; i++)
+    {
+        ptr_r[i] = (t[i] & keep) | (ptr_r[i] & ~keep);
+    }
+    (void)memset(t, 0, sizeof(t));
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+const st_Crypto_Bn_Curve *Crypto_Bn_Curve(crypto_EccCurveType_E curve_en)
+{
+    const st_Crypto_Bn_Curve *ptr_curve = NULL;
+    uint32_t i;
+
+    for (i = 0UL; i < (sizeof(bnCurves) / sizeof(bnCurves[0])); i++)
+    {
+        if (bnCurves[i].curve_en == curve_en)
+        {
+            ptr_curve = &bnCurves[i];
+        }
+    }
+
+    return ptr_curve;
+}
+
+void Crypto_Bn_FromBytes(uint32_t *ptr_a, const uint8_t *ptr_bytes, uint32_t len, uint32_t limbs)
+{
+    uint32_t i;
+
+    (void)memset(ptr_a, 0, limbs * sizeof(uint32_t));
+    for (i = 0UL; i < len; i++)
+    {
+        ptr_a[i / 4UL] |= (uint32_t)ptr_bytes[len - 1UL - i] << (8UL * (i % 4UL));
+    }
+}
+
+void Crypto_Bn_ToBytes(uint8_t *ptr_bytes, const uint32_t *ptr_a, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < len; i++)
+    {
+        ptr_bytes[len - 1UL - i] = (uint8_t)(ptr_a[i / 4UL] >> (8UL * (i % 4UL)));
+    }
+}
+
+int32_t Crypto_Bn_Compare(const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs)
+{
+    uint64_t diff;
+    uint32_t borrow = 0UL;
+    uint32_t bits = 0UL;
+    uint32_t i;
+
+    // a - b over all the limbs: the borrow out tells a < b, and any bit left tells a != b.
+    for (i = 0UL; i < limbs; i++)
+    {
+        diff = (uint64_t)ptr_a[i] - ptr_b[i] - borrow;
+        bits |= (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+
+    // 1 when a != b, less 2 when a < b.
+    bits = (bits | (uint32_t)(0UL - bits)) >> 31;
+
+    return (int32_t)bits - (int32_t)(borrow << 1);
+}
+
+bool Crypto_Bn_IsZero(const uint32_t *ptr_a, uint32_t limbs)
+{
+    uint32_t bits = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < limbs; i++)
+    {
+        bits |= ptr_a[i];
+    }
+
+    return (bits == 0UL);
+}
+
+uint32_t Crypto_Bn_Add(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs)
+{
+    uint64_t sum = 0ULL;
+    uint32_t i;
+
+    for (i = 0UL; i < limbs; i++)
+    {
+        sum += (uint64_t)ptr_a[i] + ptr_b[i];
+        ptr_r[i] = (uint32_t)sum;
+        sum >>= 32;
+    }
+
+    return (uint32_t)sum;
+}
+
+uint32_t Crypto_Bn_Sub(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs)
+{
+    uint64_t diff;
+    uint32_t borrow = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < limbs; i++)
+    {
+        diff = (uint64_t)ptr_a[i] - ptr_b[i] - borrow;
+        ptr_r[i] = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+
+    return borrow;
+}
+
+void Crypto_Bn_ModInit(st_Crypto_Bn_Mod *ptr_mod, const uint8_t *ptr_m, uint32_t len)
+{
+    uint32_t inv;
+    uint32_t i;
+
+    ptr_mod->limbs = (len + 3UL) / 4UL;
+    Crypto_Bn_FromBytes(ptr_mod->m, ptr_m, len, ptr_mod->limbs);
+
+    // Newton iteration for m^-1 mod 2^32; each step doubles the correct bits.
+    inv = ptr_mod->m[0];
+    for (i = 0UL; i < 5UL; i++)
+    {
+        inv *= 2UL - (ptr_mod->m[0] * inv);
+    }
+    ptr_mod->mInv = 0UL - inv;
+
+    // R^2 mod m by doubling 1 modulo m, 2 * 32 * limbs times.
+    (void)memset(ptr_mod->rr, 0, sizeof(ptr_mod->rr));
+    ptr_mod->rr[0] = 1UL;
+    for (i = 0UL; i < (64UL * ptr_mod->limbs); i++)
+    {
+        Crypto_Bn_ModAdd(ptr_mod->rr, ptr_mod->rr, ptr_mod->rr, ptr_mod);
+    }
+}
+
+void Crypto_Bn_Reduce(uint32_t *ptr_a, const st_Crypto_Bn_Mod *ptr_mod)
+{
+    lCrypto_Bn_CondSub(ptr_a, 0UL, ptr_mod);
+}
+
+void Crypto_Bn_ModAdd(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod)
+{
+    /* A modulus that fills its top limb, as the P-256 and P-384 ones do, can
+     * make the sum carry out; the carry is folded into the reduction. */
+    uint32_t carry = Crypto_Bn_Add(ptr_r, ptr_a, ptr_b, ptr_mod->limbs);
+
+    lCrypto_Bn_CondSub(ptr_r, carry, ptr_mod);
+}
+
+void Crypto_Bn_ModSub(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod)
+{
+    uint32_t t[CRYPTO_BN_MAX_LIMBS];
+    uint32_t borrow = Crypto_Bn_Sub(ptr_r, ptr_a, ptr_b, ptr_mod->limbs);
+    uint32_t mask = 0UL - borrow;
+    uint32_t i;
+
+    // Add back m, or 0 when there was no borrow.
+    for (i = 0UL; i < ptr_mod->limbs; i++)
+    {
+        t[i] = ptr_mod->m[i] & mask;
+    }
+    (void)Crypto_Bn_Add(ptr_r, ptr_r, t, ptr_mod->limbs);
+}
+
+void Crypto_Bn_MontMul(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod)
+{
+    uint32_t t[CRYPTO_BN_MAX_LIMBS + 2UL];
+    uint32_t limbs = ptr_mod->limbs;
+    uint64_t acc;
+    uint32_t m;
+    uint32_t i;
+    uint32_t j;
+
+    (void)memset(t, 0, sizeof(t));
+
+    for (i = 0UL; i < limbs; i++)
+    {
+        // t += a * b[i]
+        acc = 0ULL;
+        for (j = 0UL; j < limbs; j++)
+        {
+            acc += (uint64_t)t[j] + ((uint64_t)ptr_a[j] * ptr_b[i]);
+            t[j] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[limbs];
+        t[limbs] = (uint32_t)acc;
+        t[limbs + 1UL] = (uint32_t)(acc >> 32);
+
+        // t = (t + m * modulus) / 2^32, with m making the low limb 0
+        m = t[0] * ptr_mod->mInv;
+        acc = (uint64_t)t[0] + ((uint64_t)m * ptr_mod->m[0]);
+        acc >>= 32;
+        for (j = 1UL; j < limbs; j++)
+        {
+            acc += (uint64_t)t[j] + ((uint64_t)m * ptr_mod->m[j]);
+            t[j - 1UL] = (uint32_t)acc;
+            acc >>= 32;
+        }
+        acc += t[limbs];
+        t[limbs - 1UL] = (uint32_t)acc;
+        t[limbs] = t[limbs + 1UL] + (uint32_t)(acc >> 32);
+    }
+
+    // t < 2m, with t[limbs] the limb above.
+    lCrypto_Bn_CondSub(t, t[limbs], ptr_mod);
+    (void)memcpy(ptr_r, t, limbs * sizeof(uint32_t));
+    (void)memset(t, 0, sizeof(t));
+}
+
+#endif /* (CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1) || (CRYPTO_CONFIG_DIGISIGN_RFC6979 == 1) */
@@ -0,0 +1,177 @@
+/*******************************************************************************
+  Crypto Big Number Internal Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_bn.h
+
+  Summary:
+    This private header declares the modular arithmetic on 32-bit limbs and
+    the domain parameters of the NIST prime curves that the ECDHE handshake
+    and RFC 6979 ECDSA compute with on the CPU.
+
+  Description:
+    Numbers are arrays of 32-bit limbs, least significant first, and are
+    loaded from and stored to big endian byte strings. A modulus is set up
+    once with Crypto_Bn_ModInit(), which computes its Montgomery constant and
+    R^2 mod m; Crypto_Bn_MontMul() then multiplies in Montgomery form.
+
+    The functions run in a time that only depends on the number of limbs, not
+    on the values: comparisons accumulate borrow and equality masks over all
+    the limbs, and every modular reduction computes the subtraction and keeps
+    its result under a mask. RFC 6979 passes the secret nonce and private key
+    through them. This header is not part of the API of the library.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_BN_H
+#define CRYPTO_BN_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// Limbs of the longest coordinate and order of the curves built.
+#define CRYPTO_BN_MAX_LIMBS             ((CRYPTO_ECC_MAX_KEY_LENGTH + 3) / 4)
+
+// Domain parameters, big endian, a coordinate long; the curves have a = -3.
+typedef struct{
+    crypto_EccCurveType_E curve_en;
+    uint32_t keyLen;                            // Bytes of a coordinate and of the private key
+    uint32_t orderBits;                         // Bits of n
+    const uint8_t *ptr_p;
+    const uint8_t *ptr_b;
+    const uint8_t *ptr_n;
+    const uint8_t *ptr_gx;
+    const uint8_t *ptr_gy;
+}st_Crypto_Bn_Curve;
+
+// Odd modulus, for the Montgomery multiplication.
+typedef struct{
+    uint32_t limbs;
+    uint32_t m[CRYPTO_BN_MAX_LIMBS];
+    uint32_t mInv;                              // -m^-1 mod 2^32
+    uint32_t rr[CRYPTO_BN_MAX_LIMBS];           // R^2 mod m, R = 2^(32 * limbs)
+}st_Crypto_Bn_Mod;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the domain parameters of a curve.
+ * @return The parameters, NULL for a curve below P-256 or one not built.
+ */
+const st_Crypto_Bn_Curve *Crypto_Bn_Curve(crypto_EccCurveType_E curve_en);
+
+/**
+ * @brief Load a big endian number of len bytes into limbs, zero extended.
+ */
+void Crypto_Bn_FromBytes(uint32_t *ptr_a, const uint8_t *ptr_bytes, uint32_t len, uint32_t limbs);
+
+/**
+ * @brief Store the low len bytes of limbs as a big endian number.
+ */
+void Crypto_Bn_ToBytes(uint8_t *ptr_bytes, const uint32_t *ptr_a, uint32_t len);
+
+/**
+ * @brief Compare two numbers, in constant time.
+ * @return -1, 0 or 1 as a is below, equal to or above b.
+ */
+int32_t Crypto_Bn_Compare(const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs);
+
+/**
+ * @brief Tell whether a number is zero, in constant time.
+ */
+bool Crypto_Bn_IsZero(const uint32_t *ptr_a, uint32_t limbs);
+
+/**
+ * @brief r = a + b; r may be a or b.
+ * @return The carry out.
+ */
+uint32_t Crypto_Bn_Add(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs);
+
+/**
+ * @brief r = a - b; r may be a or b.
+ * @return The borrow out.
+ */
+uint32_t Crypto_Bn_Sub(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, uint32_t limbs);
+
+/**
+ * @brief Set up a modulus of len bytes: its Montgomery constant and R^2 mod m.
+ */
+void Crypto_Bn_ModInit(st_Crypto_Bn_Mod *ptr_mod, const uint8_t *ptr_m, uint32_t len);
+
+/**
+ * @brief Reduce a number below 2m into [0, m).
+ */
+void Crypto_Bn_Reduce(uint32_t *ptr_a, const st_Crypto_Bn_Mod *ptr_mod);
+
+/**
+ * @brief r = a + b mod m, for a and b below m; r may be a or b.
+ */
+void Crypto_Bn_ModAdd(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod);
+
+/**
+ * @brief r = a - b mod m, for a and b below m; r may be a or b.
+ */
+void Crypto_Bn_ModSub(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod);
+
+/**
+ * @brief Montgomery product r = a * b / R mod m, for a and b below m; r may
+ *        be a or b.
+ */
+void Crypto_Bn_MontMul(uint32_t *ptr_r, const uint32_t *ptr_a, const uint32_t *ptr_b, const st_Crypto_Bn_Mod *ptr_mod);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_BN_H */
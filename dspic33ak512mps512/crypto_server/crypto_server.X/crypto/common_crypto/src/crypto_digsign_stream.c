@@ -0,0 +1,381 @@
+/*******************************************************************************
+  Crypto Streaming ECDSA Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digsign_stream.c
+
+  Summary:
+    This file contains ECDSA sign and verify of a message fed in parts.
+
+  Description:
+    The message is hashed with Crypto_Hash_Sha_Update() into the context,
+    and Final() hands the hash of the last block to the CAM wrapper as a
+    digest function, called once the PKE is set up. See
+    crypto_digsign_stream.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_digsign_stream.h"
+#include "crypto/drivers/wrapper/crypto_digisign_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if (CRYPTO_CONFIG_DIGISIGN_STREAM == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_DIGISIGN_STREAM_SESSION_MAX  (1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the SHA-2 of a curve and its digest length.
+ * @return The algorithm, CRYPTO_HASH_INVALID for a curve without one built.
+ */
+static crypto_Hash_Algo_E lCrypto_DigiSign_Stream_CurveHash(crypto_EccCurveType_E eccCurveType_En, uint32_t *ptr_hashLen)
+{
+    crypto_Hash_Algo_E algo_en = CRYPTO_HASH_INVALID;
+
+    switch(eccCurveType_En)
+    {
+#if (CRYPTO_CONFIG_ECC_P192 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_ECC_CURVE_P192:
+#endif
+#if (CRYPTO_CONFIG_ECC_P256 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_ECC_CURVE_P256:
+#endif
+#if (((CRYPTO_CONFIG_ECC_P192 == 1) || (CRYPTO_CONFIG_ECC_P256 == 1)) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1))
+            algo_en = CRYPTO_HASH_SHA2_256;
+            *ptr_hashLen = 32UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_ECC_CURVE_P384:
+            algo_en = CRYPTO_HASH_SHA2_384;
+            *ptr_hashLen = 48UL;
+            break;
+#endif
+#if (CRYPTO_CONFIG_ECC_P521 == 1) && (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_ECC_CURVE_P521:
+            algo_en = CRYPTO_HASH_SHA2_512;
+            *ptr_hashLen = 64UL;
+            break;
+#endif
+        default:
+            *ptr_hashLen = 0UL;
+            break;
+    }
+
+    return algo_en;
+}
+
+/**
+ * @brief Check the arguments of Init() and start the hash.
+ */
+static crypto_DigiSign_Status_E lCrypto_DigiSign_Stream_Init(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                             crypto_HandlerType_E ecdsaHandlerType_en,
+                                                             crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId,
+                                                             crypto_DigiSign_Stream_State_E state_en)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    crypto_Hash_Algo_E algo_en;
+    uint32_t hashLen = 0UL;
+
+    if(CRYPTO_API_CHECK(ptr_ecdsaCtx_st == NULL))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK((ecdsaSessionId == 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_STREAM_SESSION_MAX) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ecdsaHandlerType_en))
+        {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software ECDSA; the hash may still run in software.
+#endif
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+                break;
+        }
+    }
+
+    if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        (void)memset(ptr_ecdsaCtx_st, 0, sizeof(st_Crypto_DigiSign_Ecdsa_Ctx));
+
+        algo_en = lCrypto_DigiSign_Stream_CurveHash(eccCurveType_En, &hashLen);
+        if (algo_en == CRYPTO_HASH_INVALID)
+        {
+            ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+        }
+        else if (Crypto_Hash_Sha_Init(&ptr_ecdsaCtx_st->shaCtx_st, algo_en, ecdsaHandlerType_en,
+                                      ecdsaSessionId) != CRYPTO_HASH_SUCCESS)
+        {
+            ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+        else
+        {
+            ptr_ecdsaCtx_st->ecdsaHandler_en = ecdsaHandlerType_en;
+            ptr_ecdsaCtx_st->eccCurveType_en = eccCurveType_En;
+            ptr_ecdsaCtx_st->hashLen = hashLen;
+            ptr_ecdsaCtx_st->state_en = state_en;
+        }
+    }
+
+    return ret_ecdsaStat_en;
+}
+
+/**
+ * @brief Hash a part of the message, for a context started in a state.
+ */
+static crypto_DigiSign_Status_E lCrypto_DigiSign_Stream_Update(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                               uint8_t *ptr_data, uint32_t dataLen,
+                                                               crypto_DigiSign_Stream_State_E state_en)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+
+    if(CRYPTO_API_CHECK( (ptr_ecdsaCtx_st == NULL) || (ptr_ecdsaCtx_st->state_en != state_en) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_data == NULL) && (dataLen != 0u) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_INPUTDATA;
+    }
+    else if ((dataLen != 0u) &&
+             (Crypto_Hash_Sha_Update(&ptr_ecdsaCtx_st->shaCtx_st, ptr_data, dataLen) != CRYPTO_HASH_SUCCESS))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    else
+    {
+        // Hashed.
+    }
+
+    return ret_ecdsaStat_en;
+}
+
+/**
+ * @brief Digest function of the wrapper: the hash of the last block, into
+ *        the digest of the context.
+ */
+static bool lCrypto_DigiSign_Stream_Digest(void *ptr_arg, uint8_t *ptr_digest)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st = (st_Crypto_DigiSign_Ecdsa_Ctx *)ptr_arg;
+
+    return (Crypto_Hash_Sha_Final(&ptr_ecdsaCtx_st->shaCtx_st, ptr_digest) == CRYPTO_HASH_SUCCESS);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignInit(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                        crypto_HandlerType_E ecdsaHandlerType_en,
+                                                        crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_SIGNINIT, (uint32_t)eccCurveType_En);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_SIGNINIT, crypto_DigiSign_Status_E,
+        lCrypto_DigiSign_Stream_Init(ptr_ecdsaCtx_st, ecdsaHandlerType_en, eccCurveType_En, ecdsaSessionId,
+                                     CRYPTO_DIGISIGN_STREAM_SIGN));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignUpdate(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                          uint8_t *ptr_data, uint32_t dataLen)
+{
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_SIGNUPDATE, dataLen);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_SIGNUPDATE, crypto_DigiSign_Status_E,
+        lCrypto_DigiSign_Stream_Update(ptr_ecdsaCtx_st, ptr_data, dataLen, CRYPTO_DIGISIGN_STREAM_SIGN));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignFinal(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                         uint8_t *ptr_outSig, uint32_t sigLen,
+                                                         uint8_t *ptr_privKey, uint32_t privKeyLen)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_SIGNFINAL, sigLen);
+
+    if(CRYPTO_API_CHECK( (ptr_ecdsaCtx_st == NULL) || (ptr_ecdsaCtx_st->state_en != CRYPTO_DIGISIGN_STREAM_SIGN) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_outSig == NULL) || (sigLen == 0u) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen == 0u)))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(DIGISIGN_ECDSA))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ptr_ecdsaCtx_st->ecdsaHandler_en))
+        {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software handler; always the CAM.
+#endif
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_SignStream(lCrypto_DigiSign_Stream_Digest, ptr_ecdsaCtx_st,
+                                                                       ptr_ecdsaCtx_st->digest, ptr_ecdsaCtx_st->hashLen,
+                                                                       ptr_outSig, sigLen, ptr_privKey, privKeyLen,
+                                                                       ptr_ecdsaCtx_st->eccCurveType_en);
+                break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+                break;
+        }
+    }
+
+    if (ptr_ecdsaCtx_st != NULL)
+    {
+        (void)memset(ptr_ecdsaCtx_st, 0, sizeof(st_Crypto_DigiSign_Ecdsa_Ctx));
+    }
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_SIGNFINAL, crypto_DigiSign_Status_E, ret_ecdsaStat_en);
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyInit(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                          crypto_HandlerType_E ecdsaHandlerType_en,
+                                                          crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_VERIFYINIT, (uint32_t)eccCurveType_En);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_VERIFYINIT, crypto_DigiSign_Status_E,
+        lCrypto_DigiSign_Stream_Init(ptr_ecdsaCtx_st, ecdsaHandlerType_en, eccCurveType_En, ecdsaSessionId,
+                                     CRYPTO_DIGISIGN_STREAM_VERIFY));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyUpdate(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                            uint8_t *ptr_data, uint32_t dataLen)
+{
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_VERIFYUPDATE, dataLen);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_VERIFYUPDATE, crypto_DigiSign_Status_E,
+        lCrypto_DigiSign_Stream_Update(ptr_ecdsaCtx_st, ptr_data, dataLen, CRYPTO_DIGISIGN_STREAM_VERIFY));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyFinal(st_Crypto_DigiSign_Ecdsa_Ctx *ptr_ecdsaCtx_st,
+                                                           uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                           uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                           int8_t *ptr_sigVerifyStat)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_VERIFYFINAL, sigLen);
+
+    if (ptr_sigVerifyStat != NULL)
+    {
+        *ptr_sigVerifyStat = 0;
+    }
+
+    if(CRYPTO_API_CHECK(ptr_sigVerifyStat == NULL))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_ecdsaCtx_st == NULL) || (ptr_ecdsaCtx_st->state_en != CRYPTO_DIGISIGN_STREAM_VERIFY) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_inputSig == NULL) || (sigLen == 0u) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_pubKey == NULL) || (pubKeyLen == 0u) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEY;
+    }
+    //Check the Key compression Type, 0x04 for uncompressed, 0x02 for Even compressed and 0x03 for Odd compressed
+    else if(CRYPTO_API_CHECK( !( (ptr_pubKey[0] == 0x04u) || ((ptr_pubKey[0] == 0x02u) || (ptr_pubKey[0] == 0x03u)) ) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEYCOMPRESS;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(DIGISIGN_ECDSA))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ptr_ecdsaCtx_st->ecdsaHandler_en))
+        {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software handler; always the CAM.
+#endif
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_VerifyStream(lCrypto_DigiSign_Stream_Digest, ptr_ecdsaCtx_st,
+                                                                         ptr_ecdsaCtx_st->digest, ptr_ecdsaCtx_st->hashLen,
+                                                                         ptr_inputSig, sigLen, ptr_pubKey, pubKeyLen,
+                                                                         ptr_sigVerifyStat, ptr_ecdsaCtx_st->eccCurveType_en);
+                break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+                break;
+        }
+    }
+
+    if (ptr_ecdsaCtx_st != NULL)
+    {
+        (void)memset(ptr_ecdsaCtx_st, 0, sizeof(st_Crypto_DigiSign_Ecdsa_Ctx));
+    }
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_VERIFYFINAL, crypto_DigiSign_Status_E, ret_ecdsaStat_en);
+}
+
+#endif /* CRYPTO_CONFIG_DIGISIGN_STREAM == 1 */
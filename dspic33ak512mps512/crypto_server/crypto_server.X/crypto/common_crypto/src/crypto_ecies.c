@@ -0,0 +1,399 @@
+/*******************************************************************************
+  Crypto ECIES Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecies.c
+
+  Summary:
+    This file contains ECIES on the Crypto_Handshake, Crypto_Kdf and
+    Crypto_Aead APIs.
+
+  Description:
+    The key pair, the curve check and the ECDH come from crypto_handshake.c,
+    which has the field arithmetic and the key pair pool. Each call keeps
+    its secrets in one stack frame: the ephemeral private key (Seal), the
+    shared X coordinate and the derived key and IV, 144 bytes at most,
+    wiped on every path out. See crypto_ecies.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+#include "crypto/common_crypto/crypto_handshake.h"
+#include "crypto/common_crypto/crypto_ecies.h"
+#include "crypto/common_crypto/crypto_trace.h"
+
+#if (CRYPTO_CONFIG_ECIES == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECIES_SESSION_MAX        (1)
+
+// First byte of an uncompressed point (SEC 1).
+#define CRYPTO_ECIES_POINT_UNCOMPRESSED (0x04U)
+
+// Parameters of a curve.
+typedef struct{
+    crypto_EccCurveType_E curve_en;
+    crypto_Hash_Algo_E kdfAlgo_en;
+    uint32_t keyLen;                            // Bytes of a coordinate and of the private key
+    uint32_t aesKeyLen;
+}st_Crypto_Ecies_Curve;
+
+static const st_Crypto_Ecies_Curve eciesCurves[] = {
+#if (CRYPTO_CONFIG_ECC_P256 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+    { CRYPTO_ECC_CURVE_P256, CRYPTO_HASH_SHA2_256, 32UL, (uint32_t)CRYPTO_AESKEYSIZE_128 },
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+    { CRYPTO_ECC_CURVE_P384, CRYPTO_HASH_SHA2_384, 48UL, (uint32_t)CRYPTO_AESKEYSIZE_256 },
+#endif
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the parameters of a curve.
+ * @return The parameters, NULL for a curve that is not supported.
+ */
+static const st_Crypto_Ecies_Curve *lCrypto_Ecies_Curve(crypto_EccCurveType_E eciesCurve_en)
+{
+    const st_Crypto_Ecies_Curve *ptr_curve = NULL;
+    uint32_t i;
+
+    for (i = 0UL; i < (sizeof(eciesCurves) / sizeof(eciesCurves[0])); i++)
+    {
+        if (eciesCurves[i].curve_en == eciesCurve_en)
+        {
+            ptr_curve = &eciesCurves[i];
+        }
+    }
+
+    return ptr_curve;
+}
+
+/**
+ * @brief Map the status of a Crypto_Handshake_* call to an ECIES status.
+ */
+static crypto_Ecies_Status_E lCrypto_Ecies_HandshakeStatus(crypto_Handshake_Status_E hsStatus)
+{
+    crypto_Ecies_Status_E status;
+
+    switch(hsStatus)
+    {
+        case CRYPTO_HANDSHAKE_SUCCESS:
+            status = CRYPTO_ECIES_SUCCESS;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_CURVE:
+            status = CRYPTO_ECIES_ERROR_CURVE;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_PUBKEY:
+            status = CRYPTO_ECIES_ERROR_PUBKEY;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_SID:
+            status = CRYPTO_ECIES_ERROR_SID;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_HDLR:
+            status = CRYPTO_ECIES_ERROR_HDLR;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_RNG:
+            status = CRYPTO_ECIES_ERROR_RNG;
+            break;
+        case CRYPTO_HANDSHAKE_ERROR_PKE:
+            status = CRYPTO_ECIES_ERROR_PKE;
+            break;
+        default:
+            status = CRYPTO_ECIES_ERROR_ARG;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check the arguments shared by Crypto_Ecies_Seal() and
+ *        Crypto_Ecies_Open().
+ */
+static crypto_Ecies_Status_E lCrypto_Ecies_Check(const st_Crypto_Ecies_Curve *ptr_curve, uint8_t *ptr_aad, uint32_t aadLen,
+                                                 uint8_t *ptr_sealed, uint32_t eciesSessionId)
+{
+    crypto_Ecies_Status_E status = CRYPTO_ECIES_SUCCESS;
+
+    if(ptr_curve == NULL)
+    {
+        status = CRYPTO_ECIES_ERROR_CURVE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_aad == NULL) && (aadLen != 0u) ))
+    {
+        status = CRYPTO_ECIES_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK(ptr_sealed == NULL))
+    {
+        status = CRYPTO_ECIES_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (eciesSessionId == 0u) || (eciesSessionId > (uint32_t)CRYPTO_ECIES_SESSION_MAX) ))
+    {
+        status = CRYPTO_ECIES_ERROR_SID;
+    }
+    else
+    {
+        // The handler is checked by the first call that uses it.
+    }
+
+    return status;
+}
+
+/**
+ * @brief Derive the AES key and the GCM IV from the shared X coordinate,
+ *        with the ephemeral public key as shared information.
+ * @param ptr_keyIv Receives the key, then the IV.
+ */
+static crypto_Ecies_Status_E lCrypto_Ecies_Derive(crypto_HandlerType_E eciesHandler_en, const st_Crypto_Ecies_Curve *ptr_curve,
+                                                  uint8_t *ptr_z, uint8_t *ptr_point, uint8_t *ptr_keyIv,
+                                                  uint32_t eciesSessionId)
+{
+    crypto_Kdf_Status_E kdfStatus;
+
+    kdfStatus = Crypto_Kdf_X963_Derive(eciesHandler_en, ptr_curve->kdfAlgo_en, ptr_z, ptr_curve->keyLen, ptr_point,
+                                       1UL + (2UL * ptr_curve->keyLen), ptr_keyIv,
+                                       ptr_curve->aesKeyLen + (uint32_t)CRYPTO_ECIES_IV_SIZE, eciesSessionId);
+
+    return (kdfStatus == CRYPTO_KDF_SUCCESS) ? CRYPTO_ECIES_SUCCESS : CRYPTO_ECIES_ERROR_KDF;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t Crypto_Ecies_PointSize(crypto_EccCurveType_E eciesCurve_en)
+{
+    const st_Crypto_Ecies_Curve *ptr_curve = lCrypto_Ecies_Curve(eciesCurve_en);
+
+    return (ptr_curve != NULL) ? (1UL + (2UL * ptr_curve->keyLen)) : 0UL;
+}
+
+crypto_Ecies_Status_E Crypto_Ecies_Seal(crypto_HandlerType_E eciesHandler_en, crypto_EccCurveType_E eciesCurve_en,
+                                        uint8_t *ptr_recipientPubKey, uint32_t recipientPubKeyLen,
+                                        uint8_t *ptr_aad, uint32_t aadLen,
+                                        uint8_t *ptr_sealed, uint32_t msgLen, uint32_t sealedSize,
+                                        uint32_t eciesSessionId)
+{
+    crypto_Ecies_Status_E ret_eciesStat_en = CRYPTO_ECIES_ERROR_NOTSUPPTED;
+    const st_Crypto_Ecies_Curve *ptr_curve = lCrypto_Ecies_Curve(eciesCurve_en);
+    uint8_t privKey[CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t z[CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t keyIv[CRYPTO_HANDSHAKE_MAX_AES_KEY_SIZE + CRYPTO_ECIES_IV_SIZE] __attribute__((aligned (4)));
+    uint8_t *ptr_peer = ptr_recipientPubKey;
+    uint8_t *ptr_msg = NULL;
+    uint32_t keyLen = 0UL;
+    uint32_t pointLen = 0UL;
+
+    CRYPTO_TRACE_ENTER(ECIES_SEAL, msgLen);
+
+    ret_eciesStat_en = lCrypto_Ecies_Check(ptr_curve, ptr_aad, aadLen, ptr_sealed, eciesSessionId);
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        keyLen = ptr_curve->keyLen;
+        pointLen = 1UL + (2UL * keyLen);
+        ptr_msg = &ptr_sealed[pointLen];
+
+        if(CRYPTO_API_CHECK(ptr_recipientPubKey == NULL))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_PUBKEY;
+        }
+        else if((recipientPubKeyLen == pointLen) && (ptr_recipientPubKey[0] == CRYPTO_ECIES_POINT_UNCOMPRESSED))
+        {
+            ptr_peer = &ptr_recipientPubKey[1];
+        }
+        else if(recipientPubKeyLen != (2UL * keyLen))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_PUBKEY;
+        }
+        else
+        {
+            // X || Y as it is.
+        }
+
+        if((ret_eciesStat_en == CRYPTO_ECIES_SUCCESS) &&
+           CRYPTO_API_CHECK( (sealedSize < pointLen) || ((sealedSize - pointLen) < (uint32_t)CRYPTO_ECIES_TAG_SIZE) ||
+                             (msgLen > (sealedSize - pointLen - (uint32_t)CRYPTO_ECIES_TAG_SIZE)) ))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_OUTPUTDATA;
+        }
+    }
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        // R goes straight to the front of the sealed message.
+        ptr_sealed[0] = CRYPTO_ECIES_POINT_UNCOMPRESSED;
+        ret_eciesStat_en = lCrypto_Ecies_HandshakeStatus(
+            Crypto_Handshake_KeyPair(eciesHandler_en, eciesCurve_en, privKey, sizeof(privKey), &ptr_sealed[1],
+                                     2UL * keyLen, eciesSessionId));
+    }
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        ret_eciesStat_en = lCrypto_Ecies_HandshakeStatus(
+            Crypto_Handshake_Agree(eciesHandler_en, eciesCurve_en, privKey, keyLen, ptr_peer, 2UL * keyLen,
+                                   z, sizeof(z), eciesSessionId));
+    }
+
+    (void)memset(privKey, 0, sizeof(privKey));
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        ret_eciesStat_en = lCrypto_Ecies_Derive(eciesHandler_en, ptr_curve, z, ptr_sealed, keyIv, eciesSessionId);
+    }
+
+    (void)memset(z, 0, sizeof(z));
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        if (Crypto_Aead_AesGcm_EncryptAuthDirect(eciesHandler_en, (msgLen != 0UL) ? ptr_msg : NULL, msgLen,
+                                                 (msgLen != 0UL) ? ptr_msg : NULL, keyIv, ptr_curve->aesKeyLen,
+                                                 &keyIv[ptr_curve->aesKeyLen], (uint32_t)CRYPTO_ECIES_IV_SIZE,
+                                                 (aadLen != 0UL) ? ptr_aad : NULL, aadLen, &ptr_msg[msgLen],
+                                                 (uint8_t)CRYPTO_ECIES_TAG_SIZE, eciesSessionId) != CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            // Part of the message may be encrypted already; leave none of it.
+            (void)memset(ptr_sealed, 0, pointLen + msgLen + (uint32_t)CRYPTO_ECIES_TAG_SIZE);
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_AEAD;
+        }
+    }
+
+    (void)memset(keyIv, 0, sizeof(keyIv));
+
+    return CRYPTO_TRACE_EXIT(ECIES_SEAL, crypto_Ecies_Status_E, ret_eciesStat_en);
+}
+
+crypto_Ecies_Status_E Crypto_Ecies_Open(crypto_HandlerType_E eciesHandler_en, crypto_EccCurveType_E eciesCurve_en,
+                                        uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                        uint8_t *ptr_aad, uint32_t aadLen,
+                                        uint8_t *ptr_sealed, uint32_t sealedLen, uint32_t *ptr_msgLen,
+                                        uint32_t eciesSessionId)
+{
+    crypto_Ecies_Status_E ret_eciesStat_en = CRYPTO_ECIES_ERROR_NOTSUPPTED;
+    const st_Crypto_Ecies_Curve *ptr_curve = lCrypto_Ecies_Curve(eciesCurve_en);
+    uint8_t z[CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t keyIv[CRYPTO_HANDSHAKE_MAX_AES_KEY_SIZE + CRYPTO_ECIES_IV_SIZE] __attribute__((aligned (4)));
+    crypto_Aead_Status_E aeadStatus;
+    uint8_t *ptr_msg = NULL;
+    uint32_t keyLen = 0UL;
+    uint32_t pointLen = 0UL;
+    uint32_t msgLen = 0UL;
+
+    CRYPTO_TRACE_ENTER(ECIES_OPEN, sealedLen);
+
+    ret_eciesStat_en = lCrypto_Ecies_Check(ptr_curve, ptr_aad, aadLen, ptr_sealed, eciesSessionId);
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        keyLen = ptr_curve->keyLen;
+        pointLen = 1UL + (2UL * keyLen);
+
+        if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen != keyLen) ))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_PRIVKEY;
+        }
+        else if(CRYPTO_API_CHECK(ptr_msgLen == NULL))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_ARG;
+        }
+        else if((sealedLen < (pointLen + (uint32_t)CRYPTO_ECIES_TAG_SIZE)) ||
+                (ptr_sealed[0] != CRYPTO_ECIES_POINT_UNCOMPRESSED))
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_INPUTDATA;
+        }
+        else
+        {
+            ptr_msg = &ptr_sealed[pointLen];
+            msgLen = sealedLen - pointLen - (uint32_t)CRYPTO_ECIES_TAG_SIZE;
+        }
+    }
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        // Agree checks that R is a point of the curve before the private key meets it.
+        ret_eciesStat_en = lCrypto_Ecies_HandshakeStatus(
+            Crypto_Handshake_Agree(eciesHandler_en, eciesCurve_en, ptr_privKey, keyLen, &ptr_sealed[1], 2UL * keyLen,
+                                   z, sizeof(z), eciesSessionId));
+    }
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        ret_eciesStat_en = lCrypto_Ecies_Derive(eciesHandler_en, ptr_curve, z, ptr_sealed, keyIv, eciesSessionId);
+    }
+
+    (void)memset(z, 0, sizeof(z));
+
+    if (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        aeadStatus = Crypto_Aead_AesGcm_DecryptAuthDirect(eciesHandler_en, (msgLen != 0UL) ? ptr_msg : NULL, msgLen,
+                                                          (msgLen != 0UL) ? ptr_msg : NULL, keyIv, ptr_curve->aesKeyLen,
+                                                          &keyIv[ptr_curve->aesKeyLen], (uint32_t)CRYPTO_ECIES_IV_SIZE,
+                                                          (aadLen != 0UL) ? ptr_aad : NULL, aadLen, &ptr_msg[msgLen],
+                                                          (uint8_t)CRYPTO_ECIES_TAG_SIZE, eciesSessionId);
+        if (aeadStatus != CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            // The message is written before the tag is checked; wipe it.
+            (void)memset(ptr_msg, 0, msgLen);
+            ret_eciesStat_en = (aeadStatus == CRYPTO_AEAD_ERROR_AUTHFAIL) ? CRYPTO_ECIES_ERROR_AUTH
+                                                                          : CRYPTO_ECIES_ERROR_AEAD;
+        }
+    }
+
+    (void)memset(keyIv, 0, sizeof(keyIv));
+
+    if (ptr_msgLen != NULL)
+    {
+        *ptr_msgLen = (ret_eciesStat_en == CRYPTO_ECIES_SUCCESS) ? msgLen : 0UL;
+    }
+
+    return CRYPTO_TRACE_EXIT(ECIES_OPEN, crypto_Ecies_Status_E, ret_eciesStat_en);
+}
+
+#endif /* CRYPTO_CONFIG_ECIES == 1 */
@@ -0,0 +1,1032 @@
+/*******************************************************************************
+  Crypto Handshake Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_handshake.c
+
+  Summary:
+    This file contains the ECDHE handshake on the Crypto_Rng, Crypto_Kas,
+    Crypto_Kdf and Crypto_Aead APIs.
+
+  Description:
+    The field arithmetic here only serves the public values: the recovery of
+    the Y coordinate of the ephemeral public key and the curve check of the
+    public key of the peer. It is the Montgomery multiplication on 32-bit
+    limbs of crypto_bn.c, which also holds the domain parameters. The private
+    key and the shared secret only go through the PKE and the SHA engine.
+    See crypto_handshake.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+#include "crypto/common_crypto/crypto_rng.h"
+#include "crypto/common_crypto/crypto_handshake.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/src/crypto_bn.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+
+#if (CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1)
+
+#if !(((CRYPTO_CONFIG_ECC_P256 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1)) || \
+      ((CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1)))
+#error "CRYPTO_CONFIG_HANDSHAKE_ECDHE needs P-256 with SHA-256 or P-384 with SHA-384"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_HANDSHAKE_SESSION_MAX    (1)
+
+// Limbs of the longest field element.
+#define CRYPTO_HANDSHAKE_MAX_LIMBS      (CRYPTO_HANDSHAKE_MAX_KEY_SIZE / 4)
+
+/* Private keys drawn before giving up on one below the order; a draw of the
+ * curves here is out of range with a probability below 2^-32. */
+#define CRYPTO_HANDSHAKE_RNG_TRIES      (4UL)
+
+// Labels of the keys and IVs of each direction; each fits one HMAC block pair.
+#define CRYPTO_HANDSHAKE_LABEL_I2R_KEY  "ecdhe i2r key"
+#define CRYPTO_HANDSHAKE_LABEL_I2R_IV   "ecdhe i2r iv"
+#define CRYPTO_HANDSHAKE_LABEL_R2I_KEY  "ecdhe r2i key"
+#define CRYPTO_HANDSHAKE_LABEL_R2I_IV   "ecdhe r2i iv"
+
+// Key pairs of all the pools.
+#define CRYPTO_HANDSHAKE_POOL_TOTAL     (CRYPTO_HANDSHAKE_POOL_P256_COUNT + CRYPTO_HANDSHAKE_POOL_P384_COUNT)
+
+// Pooled key pair; entries outside the ready ones are wiped.
+typedef struct{
+    uint8_t privKey[CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t pubKey[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    bool taken;                                 // Being copied out by a Start
+}st_Crypto_Handshake_PoolEntry;
+
+/* Ring of the key pairs of a curve: ready entries run from head, and
+ * Crypto_Handshake_Pool_Task() fills the entry after the last ready one,
+ * which a take does not move. The fields are changed with interrupts
+ * disabled; the entries are copied and generated outside. */
+typedef struct{
+    st_Crypto_Handshake_PoolEntry *ptr_entries;
+    uint32_t count;
+    uint32_t head;                              // Next key pair handed out
+    uint32_t ready;                             // Key pairs from head on
+    uint32_t generation;                        // Bumped by a flush, which drops a key pair being generated
+    bool filling;                               // An entry is being generated
+}st_Crypto_Handshake_Pool;
+
+/* Curve of the handshake; its domain parameters are those of crypto_bn.c.
+ * The curves have a = -3 and p = 3 mod 4. */
+typedef struct{
+    crypto_EccCurveType_E curve_en;
+    crypto_Hash_Algo_E kdfAlgo_en;
+    uint32_t keyLen;
+    st_Crypto_Handshake_Pool *ptr_pool;         // NULL for a curve with no pool
+}st_Crypto_Handshake_Curve;
+
+// Field of a curve, for the Montgomery multiplication.
+typedef struct{
+    st_Crypto_Bn_Mod p_st;
+    uint32_t bm[CRYPTO_HANDSHAKE_MAX_LIMBS];        // b * R mod p
+}st_Crypto_Handshake_Field;
+
+#if (CRYPTO_CONFIG_ECC_P256 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1) && (CRYPTO_HANDSHAKE_POOL_P256_COUNT > 0U)
+static st_Crypto_Handshake_PoolEntry handshakePoolEntriesP256[CRYPTO_HANDSHAKE_POOL_P256_COUNT];
+static st_Crypto_Handshake_Pool handshakePoolP256 = { handshakePoolEntriesP256, CRYPTO_HANDSHAKE_POOL_P256_COUNT, 0UL, 0UL, 0UL, false };
+#define CRYPTO_HANDSHAKE_POOL_P256      (&handshakePoolP256)
+#else
+#define CRYPTO_HANDSHAKE_POOL_P256      (NULL)
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1) && (CRYPTO_HANDSHAKE_POOL_P384_COUNT > 0U)
+static st_Crypto_Handshake_PoolEntry handshakePoolEntriesP384[CRYPTO_HANDSHAKE_POOL_P384_COUNT];
+static st_Crypto_Handshake_Pool handshakePoolP384 = { handshakePoolEntriesP384, CRYPTO_HANDSHAKE_POOL_P384_COUNT, 0UL, 0UL, 0UL, false };
+#define CRYPTO_HANDSHAKE_POOL_P384      (&handshakePoolP384)
+#else
+#define CRYPTO_HANDSHAKE_POOL_P384      (NULL)
+#endif
+
+static const st_Crypto_Handshake_Curve handshakeCurves[] = {
+#if (CRYPTO_CONFIG_ECC_P256 == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+    { CRYPTO_ECC_CURVE_P256, CRYPTO_HASH_SHA2_256, 32UL, CRYPTO_HANDSHAKE_POOL_P256 },
+#endif
+#if (CRYPTO_CONFIG_ECC_P384 == 1) && (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+    { CRYPTO_ECC_CURVE_P384, CRYPTO_HASH_SHA2_384, 48UL, CRYPTO_HANDSHAKE_POOL_P384 },
+#endif
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the domain parameters of a curve.
+ * @return The parameters, NULL for a curve that is not supported.
+ */
+static const st_Crypto_Handshake_Curve *lCrypto_Handshake_Curve(crypto_EccCurveType_E hsCurve_en)
+{
+    const st_Crypto_Handshake_Curve *ptr_curve = NULL;
+    uint32_t i;
+
+    for (i = 0UL; i < (sizeof(handshakeCurves) / sizeof(handshakeCurves[0])); i++)
+    {
+        if (handshakeCurves[i].curve_en == hsCurve_en)
+        {
+            ptr_curve = &handshakeCurves[i];
+        }
+    }
+
+    return ptr_curve;
+}
+
+/**
+ * @brief Set up the field of a curve: its Montgomery constant, R^2 mod p and
+ *        b in Montgomery form.
+ */
+static void lCrypto_Handshake_FieldInit(st_Crypto_Handshake_Field *ptr_field, const st_Crypto_Handshake_Curve *ptr_curve)
+{
+    const st_Crypto_Bn_Curve *ptr_params = Crypto_Bn_Curve(ptr_curve->curve_en);
+    uint32_t b[CRYPTO_HANDSHAKE_MAX_LIMBS];
+
+    Crypto_Bn_ModInit(&ptr_field->p_st, ptr_params->ptr_p, ptr_curve->keyLen);
+    Crypto_Bn_FromBytes(b, ptr_params->ptr_b, ptr_curve->keyLen, ptr_field->p_st.limbs);
+    Crypto_Bn_MontMul(ptr_field->bm, b, ptr_field->p_st.rr, &ptr_field->p_st);
+}
+
+/**
+ * @brief Compute X^3 - 3X + b, all in Montgomery form.
+ * @param ptr_rhs Receives the result.
+ * @param ptr_xm X in Montgomery form.
+ */
+static void lCrypto_Handshake_CurveRhs(uint32_t *ptr_rhs, const uint32_t *ptr_xm, const st_Crypto_Handshake_Field *ptr_field)
+{
+    uint32_t t[CRYPTO_HANDSHAKE_MAX_LIMBS];
+
+    Crypto_Bn_MontMul(t, ptr_xm, ptr_xm, &ptr_field->p_st);
+    Crypto_Bn_MontMul(t, t, ptr_xm, &ptr_field->p_st);
+    Crypto_Bn_ModSub(t, t, ptr_xm, &ptr_field->p_st);
+    Crypto_Bn_ModSub(t, t, ptr_xm, &ptr_field->p_st);
+    Crypto_Bn_ModSub(t, t, ptr_xm, &ptr_field->p_st);
+    Crypto_Bn_ModAdd(ptr_rhs, t, ptr_field->bm, &ptr_field->p_st);
+}
+
+/**
+ * @brief Tell whether X || Y is a point of the curve.
+ * @param ptr_point X || Y, big endian, each a coordinate long.
+ */
+static bool lCrypto_Handshake_OnCurve(const uint8_t *ptr_point, const st_Crypto_Handshake_Field *ptr_field)
+{
+    uint32_t x[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t y[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t limbs = ptr_field->p_st.limbs;
+    bool onCurve = false;
+
+    Crypto_Bn_FromBytes(x, ptr_point, limbs * 4UL, limbs);
+    Crypto_Bn_FromBytes(y, &ptr_point[limbs * 4UL], limbs * 4UL, limbs);
+
+    if ((Crypto_Bn_Compare(x, ptr_field->p_st.m, limbs) < 0L) &&
+        (Crypto_Bn_Compare(y, ptr_field->p_st.m, limbs) < 0L))
+    {
+        Crypto_Bn_MontMul(x, x, ptr_field->p_st.rr, &ptr_field->p_st);
+        lCrypto_Handshake_CurveRhs(x, x, ptr_field);
+        Crypto_Bn_MontMul(y, y, ptr_field->p_st.rr, &ptr_field->p_st);
+        Crypto_Bn_MontMul(y, y, y, &ptr_field->p_st);
+        onCurve = (Crypto_Bn_Compare(x, y, limbs) == 0L);
+    }
+
+    return onCurve;
+}
+
+/**
+ * @brief Recover the Y coordinate of a point from its X coordinate, as
+ *        (X^3 - 3X + b)^((p + 1) / 4), the square root for p = 3 mod 4.
+ * @param ptr_point X || Y; Y is written.
+ * @return true when X is the coordinate of a point.
+ */
+static bool lCrypto_Handshake_RecoverY(uint8_t *ptr_point, const st_Crypto_Handshake_Field *ptr_field)
+{
+    uint32_t rhs[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t y[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t e[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t one[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t limbs = ptr_field->p_st.limbs;
+    uint32_t bit;
+    uint32_t i;
+    bool found = false;
+
+    Crypto_Bn_FromBytes(rhs, ptr_point, limbs * 4UL, limbs);
+    if (Crypto_Bn_Compare(rhs, ptr_field->p_st.m, limbs) < 0L)
+    {
+        Crypto_Bn_MontMul(rhs, rhs, ptr_field->p_st.rr, &ptr_field->p_st);
+        lCrypto_Handshake_CurveRhs(rhs, rhs, ptr_field);
+
+        // e = (p + 1) / 4; p is odd, so p + 1 does not carry out of the top limb.
+        (void)memset(one, 0, sizeof(one));
+        one[0] = 1UL;
+        (void)Crypto_Bn_Add(e, ptr_field->p_st.m, one, limbs);
+        for (i = 0UL; i < limbs; i++)
+        {
+            e[i] = (e[i] >> 2) | ((i + 1UL < limbs) ? (e[i + 1UL] << 30) : 0UL);
+        }
+
+        // Left to right square and multiply, from 1 in Montgomery form.
+        Crypto_Bn_MontMul(y, one, ptr_field->p_st.rr, &ptr_field->p_st);
+        for (bit = limbs * 32UL; bit > 0UL; bit--)
+        {
+            Crypto_Bn_MontMul(y, y, y, &ptr_field->p_st);
+            if (((e[(bit - 1UL) / 32UL] >> ((bit - 1UL) % 32UL)) & 1UL) != 0UL)
+            {
+                Crypto_Bn_MontMul(y, y, rhs, &ptr_field->p_st);
+            }
+        }
+
+        // X^3 - 3X + b has no root when X is not the coordinate of a point.
+        Crypto_Bn_MontMul(e, y, y, &ptr_field->p_st);
+        if (Crypto_Bn_Compare(e, rhs, limbs) == 0L)
+        {
+            Crypto_Bn_MontMul(y, y, one, &ptr_field->p_st);
+            Crypto_Bn_ToBytes(&ptr_point[limbs * 4UL], y, limbs * 4UL);
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Draw a private key in [1, n - 1] from the TRNG.
+ * @param ptr_privKey Receives the private key, a coordinate long.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_PrivKey(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId,
+                                                           const st_Crypto_Handshake_Curve *ptr_curve,
+                                                           uint8_t *ptr_privKey)
+{
+    crypto_Handshake_Status_E status = CRYPTO_HANDSHAKE_ERROR_RNG;
+    uint32_t d[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t n[CRYPTO_HANDSHAKE_MAX_LIMBS];
+    uint32_t limbs = ptr_curve->keyLen / 4UL;
+    uint32_t tries = 0UL;
+
+    Crypto_Bn_FromBytes(n, Crypto_Bn_Curve(ptr_curve->curve_en)->ptr_n, ptr_curve->keyLen, limbs);
+
+    while ((status != CRYPTO_HANDSHAKE_SUCCESS) && (tries < CRYPTO_HANDSHAKE_RNG_TRIES))
+    {
+        if (Crypto_Rng_Generate(hsHandler_en, ptr_privKey, ptr_curve->keyLen, NULL, 0UL,
+                                hsSessionId) != CRYPTO_RNG_SUCCESS)
+        {
+            tries = CRYPTO_HANDSHAKE_RNG_TRIES;
+        }
+        else
+        {
+            Crypto_Bn_FromBytes(d, ptr_privKey, limbs * 4UL, limbs);
+            if ((Crypto_Bn_Compare(d, n, limbs) < 0L) && (!Crypto_Bn_IsZero(d, limbs)))
+            {
+                status = CRYPTO_HANDSHAKE_SUCCESS;
+            }
+            tries++;
+        }
+    }
+    (void)memset(d, 0, sizeof(d));
+
+    return status;
+}
+
+/**
+ * @brief Generate an ephemeral key pair: a private key d from the TRNG and
+ *        the public key d * G on the PKE, with Y recovered when the engine
+ *        does not return it.
+ * @param ptr_privKey Receives the private key, wiped on failure.
+ * @param ptr_pubKey Receives X || Y.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_KeyPair(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId,
+                                                           const st_Crypto_Handshake_Curve *ptr_curve,
+                                                           uint8_t *ptr_privKey, uint8_t *ptr_pubKey)
+{
+    uint8_t generator[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    st_Crypto_Handshake_Field field;
+    const st_Crypto_Bn_Curve *ptr_params = Crypto_Bn_Curve(ptr_curve->curve_en);
+    uint32_t keyLen = ptr_curve->keyLen;
+    crypto_Handshake_Status_E status = lCrypto_Handshake_PrivKey(hsHandler_en, hsSessionId, ptr_curve, ptr_privKey);
+
+    if (status == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        (void)memcpy(generator, ptr_params->ptr_gx, keyLen);
+        (void)memcpy(&generator[keyLen], ptr_params->ptr_gy, keyLen);
+        (void)memset(ptr_pubKey, 0, 2UL * keyLen);
+
+        if (Crypto_Kas_Ecdh_SharedSecret(hsHandler_en, ptr_privKey, keyLen, generator, 2UL * keyLen, ptr_pubKey,
+                                         2UL * keyLen, ptr_curve->curve_en, hsSessionId) != CRYPTO_KAS_SUCCESS)
+        {
+            status = CRYPTO_HANDSHAKE_ERROR_PKE;
+        }
+    }
+
+    if (status == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        lCrypto_Handshake_FieldInit(&field, ptr_curve);
+
+        // Keep the Y of the engine when it gave one, else recover it.
+        if ((!lCrypto_Handshake_OnCurve(ptr_pubKey, &field)) && (!lCrypto_Handshake_RecoverY(ptr_pubKey, &field)))
+        {
+            status = CRYPTO_HANDSHAKE_ERROR_PKE;
+        }
+    }
+
+    if (status != CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        (void)memset(ptr_privKey, 0, keyLen);
+    }
+
+    return status;
+}
+
+#if (CRYPTO_HANDSHAKE_POOL_TOTAL > 0U)
+/**
+ * @brief Take a key pair from the pool of a curve, wiping its entry.
+ * @return true when the pool had one.
+ */
+static bool lCrypto_Handshake_PoolTake(const st_Crypto_Handshake_Curve *ptr_curve, uint8_t *ptr_privKey,
+                                       uint8_t *ptr_pubKey)
+{
+    st_Crypto_Handshake_Pool *ptr_pool = ptr_curve->ptr_pool;
+    st_Crypto_Handshake_PoolEntry *ptr_entry = NULL;
+    uint32_t lockState;
+
+    if (ptr_pool != NULL)
+    {
+        lockState = Crypto_Int_Hw_Lock();
+        if (ptr_pool->ready > 0UL)
+        {
+            ptr_entry = &ptr_pool->ptr_entries[ptr_pool->head];
+            ptr_entry->taken = true;
+            ptr_pool->head = (ptr_pool->head + 1UL) % ptr_pool->count;
+            ptr_pool->ready--;
+        }
+        Crypto_Int_Hw_Unlock(lockState);
+    }
+
+    if (ptr_entry != NULL)
+    {
+        (void)memcpy(ptr_privKey, ptr_entry->privKey, ptr_curve->keyLen);
+        (void)memcpy(ptr_pubKey, ptr_entry->pubKey, 2UL * ptr_curve->keyLen);
+        (void)memset(ptr_entry->privKey, 0, sizeof(ptr_entry->privKey));
+        (void)memset(ptr_entry->pubKey, 0, sizeof(ptr_entry->pubKey));
+
+        lockState = Crypto_Int_Hw_Lock();
+        ptr_entry->taken = false;
+        Crypto_Int_Hw_Unlock(lockState);
+    }
+
+    return (ptr_entry != NULL);
+}
+#endif
+
+/**
+ * @brief Check that a handler runs the handshake.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_Handler(crypto_HandlerType_E hsHandler_en)
+{
+    crypto_Handshake_Status_E status;
+
+    switch(CRYPTO_HANDLER_SELECT(hsHandler_en))
+    {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+        case CRYPTO_HANDLER_AUTO:
+#endif
+        case CRYPTO_HANDLER_HW_INTERNAL:
+            status = CRYPTO_HANDSHAKE_SUCCESS;
+            break;
+        default:
+            status = CRYPTO_HANDSHAKE_ERROR_HDLR;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Get an ephemeral key pair, from the pool of the curve when it has
+ *        one ready, else generated now.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_Ephemeral(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId,
+                                                             const st_Crypto_Handshake_Curve *ptr_curve,
+                                                             uint8_t *ptr_privKey, uint8_t *ptr_pubKey)
+{
+    crypto_Handshake_Status_E status = CRYPTO_HANDSHAKE_SUCCESS;
+
+#if (CRYPTO_HANDSHAKE_POOL_TOTAL > 0U)
+    if (!lCrypto_Handshake_PoolTake(ptr_curve, ptr_privKey, ptr_pubKey))
+#endif
+    {
+        status = lCrypto_Handshake_KeyPair(hsHandler_en, hsSessionId, ptr_curve, ptr_privKey, ptr_pubKey);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Check that the public key of the peer is a point of the curve and
+ *        compute the ECDH product with the private key on the PKE.
+ * @param ptr_secret Receives the product, 2 * keyLen bytes; the secret is
+ *        its X coordinate.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_Agree(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId,
+                                                         const st_Crypto_Handshake_Curve *ptr_curve, uint8_t *ptr_privKey,
+                                                         uint8_t *ptr_peerPubKey, uint8_t *ptr_secret)
+{
+    crypto_Handshake_Status_E status = CRYPTO_HANDSHAKE_SUCCESS;
+    st_Crypto_Handshake_Field field;
+    uint32_t keyLen = ptr_curve->keyLen;
+
+    lCrypto_Handshake_FieldInit(&field, ptr_curve);
+    if (!lCrypto_Handshake_OnCurve(ptr_peerPubKey, &field))
+    {
+        status = CRYPTO_HANDSHAKE_ERROR_PUBKEY;
+    }
+    else
+    {
+        (void)memset(ptr_secret, 0, 2UL * keyLen);
+        if (Crypto_Kas_Ecdh_SharedSecret(hsHandler_en, ptr_privKey, keyLen, ptr_peerPubKey, 2UL * keyLen, ptr_secret,
+                                         2UL * keyLen, ptr_curve->curve_en, hsSessionId) != CRYPTO_KAS_SUCCESS)
+        {
+            status = CRYPTO_HANDSHAKE_ERROR_PKE;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Initialize the GCM context of one direction for its current record.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_SessionInit(st_Crypto_Handshake_Session *ptr_session_st,
+                                                               crypto_CipherOper_E cipherOper_en)
+{
+    crypto_Handshake_Status_E status = CRYPTO_HANDSHAKE_SUCCESS;
+    st_Crypto_Aead_AesGcm_ctx *ptr_gcmCtx_st = &ptr_session_st->txCtx_st;
+    uint8_t *ptr_key = ptr_session_st->txKey;
+    uint8_t *ptr_iv = ptr_session_st->txIv;
+    uint8_t *ptr_nonce = ptr_session_st->txNonce;
+    uint32_t seq = ptr_session_st->txSeq;
+    uint32_t i;
+
+    if (cipherOper_en == CRYPTO_CIOP_DECRYPT)
+    {
+        ptr_gcmCtx_st = &ptr_session_st->rxCtx_st;
+        ptr_key = ptr_session_st->rxKey;
+        ptr_iv = ptr_session_st->rxIv;
+        ptr_nonce = ptr_session_st->rxNonce;
+        seq = ptr_session_st->rxSeq;
+    }
+
+    (void)memcpy(ptr_nonce, ptr_iv, CRYPTO_HANDSHAKE_IV_SIZE);
+    for (i = 0UL; i < 4UL; i++)
+    {
+        ptr_nonce[CRYPTO_HANDSHAKE_IV_SIZE - 1 - i] ^= (uint8_t)(seq >> (8UL * i));
+    }
+
+    if (Crypto_Aead_AesGcm_Init(ptr_gcmCtx_st, ptr_session_st->hsHandler_en, cipherOper_en, ptr_key,
+                                ptr_session_st->keyLen, ptr_nonce, CRYPTO_HANDSHAKE_IV_SIZE,
+                                ptr_session_st->hsSessionId) != CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = CRYPTO_HANDSHAKE_ERROR_AEAD;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Derive the keys and IVs of both directions from the PRK held by the
+ *        HKDF context of the handshake, into the session.
+ */
+static crypto_Handshake_Status_E lCrypto_Handshake_Derive(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st, uint32_t aesKeyLen,
+                                                          st_Crypto_Handshake_Session *ptr_session_st)
+{
+    static const char * const labels[4] = {
+        CRYPTO_HANDSHAKE_LABEL_I2R_KEY, CRYPTO_HANDSHAKE_LABEL_I2R_IV,
+        CRYPTO_HANDSHAKE_LABEL_R2I_KEY, CRYPTO_HANDSHAKE_LABEL_R2I_IV
+    };
+    uint8_t *outputs[4];
+    uint32_t outputLens[4] = { aesKeyLen, CRYPTO_HANDSHAKE_IV_SIZE, aesKeyLen, CRYPTO_HANDSHAKE_IV_SIZE };
+    crypto_Kdf_Status_E kdfStatus = CRYPTO_KDF_SUCCESS;
+    uint32_t i;
+
+    // The initiator sends with the i2r keys, the responder with the r2i keys.
+    if (ptr_hsCtx_st->hsRole_en == CRYPTO_HANDSHAKE_ROLE_INITIATOR)
+    {
+        outputs[0] = ptr_session_st->txKey;
+        outputs[1] = ptr_session_st->txIv;
+        outputs[2] = ptr_session_st->rxKey;
+        outputs[3] = ptr_session_st->rxIv;
+    }
+    else
+    {
+        outputs[0] = ptr_session_st->rxKey;
+        outputs[1] = ptr_session_st->rxIv;
+        outputs[2] = ptr_session_st->txKey;
+        outputs[3] = ptr_session_st->txIv;
+    }
+
+    for (i = 0UL; (i < 4UL) && (kdfStatus == CRYPTO_KDF_SUCCESS); i++)
+    {
+        kdfStatus = Crypto_Kdf_Hkdf_Expand(&ptr_hsCtx_st->kdfCtx_st, (uint8_t *)labels[i], (uint32_t)strlen(labels[i]),
+                                           outputs[i], outputLens[i]);
+    }
+
+    return (kdfStatus == CRYPTO_KDF_SUCCESS) ? CRYPTO_HANDSHAKE_SUCCESS : CRYPTO_HANDSHAKE_ERROR_KDF;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe_Start(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st,
+                                                       crypto_HandlerType_E hsHandler_en, crypto_Handshake_Role_E hsRole_en,
+                                                       crypto_EccCurveType_E hsCurve_en, uint8_t *ptr_pubKey,
+                                                       uint32_t pubKeyLen, uint32_t hsSessionId)
+{
+    crypto_Handshake_Status_E ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_NOTSUPPTED;
+    const st_Crypto_Handshake_Curve *ptr_curve = lCrypto_Handshake_Curve(hsCurve_en);
+    uint32_t keyLen = 0UL;
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_ECDHE_START, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_hsCtx_st == NULL))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CTX;
+    }
+    else if(ptr_curve == NULL)
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CURVE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_pubKey == NULL) || (pubKeyLen < (2UL * ptr_curve->keyLen)) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (hsRole_en <= CRYPTO_HANDSHAKE_ROLE_INVALID) || (hsRole_en >= CRYPTO_HANDSHAKE_ROLE_MAX) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (hsSessionId == 0u) || (hsSessionId > (uint32_t)CRYPTO_HANDSHAKE_SESSION_MAX) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_SID;
+    }
+    else
+    {
+        ret_hsStat_en = lCrypto_Handshake_Handler(hsHandler_en);
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        keyLen = ptr_curve->keyLen;
+        ptr_hsCtx_st->started = false;
+        ptr_hsCtx_st->hsSessionId = hsSessionId;
+        ptr_hsCtx_st->hsHandler_en = hsHandler_en;
+        ptr_hsCtx_st->hsCurve_en = hsCurve_en;
+        ptr_hsCtx_st->hsRole_en = hsRole_en;
+        ptr_hsCtx_st->keyLen = keyLen;
+
+        ret_hsStat_en = lCrypto_Handshake_Ephemeral(hsHandler_en, hsSessionId, ptr_curve, ptr_hsCtx_st->privKey,
+                                                    ptr_hsCtx_st->pubKey);
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        (void)memcpy(ptr_pubKey, ptr_hsCtx_st->pubKey, 2UL * keyLen);
+        ptr_hsCtx_st->started = true;
+    }
+    else if (ptr_hsCtx_st != NULL)
+    {
+        (void)memset(ptr_hsCtx_st->privKey, 0, sizeof(ptr_hsCtx_st->privKey));
+    }
+    else
+    {
+        // Nothing to wipe.
+    }
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_ECDHE_START, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe_Finish(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st,
+                                                        uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                        uint8_t *ptr_salt, uint32_t saltLen, uint32_t aesKeyLen,
+                                                        st_Crypto_Handshake_Session *ptr_session_st)
+{
+    crypto_Handshake_Status_E ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_NOTSUPPTED;
+    const st_Crypto_Handshake_Curve *ptr_curve = NULL;
+    crypto_Kdf_Status_E kdfStatus;
+    uint32_t keyLen = 0UL;
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_ECDHE_FINISH, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_hsCtx_st == NULL))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CTX;
+    }
+    else
+    {
+        ptr_curve = lCrypto_Handshake_Curve(ptr_hsCtx_st->hsCurve_en);
+        keyLen = ptr_hsCtx_st->keyLen;
+
+        if ((!ptr_hsCtx_st->started) || (ptr_curve == NULL))
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_STATE;
+        }
+        else if(CRYPTO_API_CHECK( (ptr_peerPubKey == NULL) || (peerPubKeyLen != (2UL * keyLen)) ))
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_PUBKEY;
+        }
+        else if(CRYPTO_API_CHECK( (ptr_salt == NULL) && (saltLen != 0u) ))
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+        }
+        else if(CRYPTO_API_CHECK( (aesKeyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                                  && (aesKeyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                                  && (aesKeyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ))
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_KEY;
+        }
+        else if(CRYPTO_API_CHECK(ptr_session_st == NULL))
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+        }
+        else
+        {
+            ret_hsStat_en = lCrypto_Handshake_Agree(ptr_hsCtx_st->hsHandler_en, ptr_hsCtx_st->hsSessionId, ptr_curve,
+                                                    ptr_hsCtx_st->privKey, ptr_peerPubKey, ptr_hsCtx_st->secret);
+        }
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        // The secret is the X coordinate of the product.
+        kdfStatus = Crypto_Kdf_Hkdf_Extract(&ptr_hsCtx_st->kdfCtx_st, ptr_hsCtx_st->hsHandler_en, ptr_curve->kdfAlgo_en,
+                                            ptr_salt, saltLen, ptr_hsCtx_st->secret, keyLen, NULL,
+                                            ptr_hsCtx_st->hsSessionId);
+        ret_hsStat_en = (kdfStatus == CRYPTO_KDF_SUCCESS) ? CRYPTO_HANDSHAKE_SUCCESS : CRYPTO_HANDSHAKE_ERROR_KDF;
+    }
+
+    if (ptr_hsCtx_st != NULL)
+    {
+        (void)memset(ptr_hsCtx_st->privKey, 0, sizeof(ptr_hsCtx_st->privKey));
+        (void)memset(ptr_hsCtx_st->secret, 0, sizeof(ptr_hsCtx_st->secret));
+        ptr_hsCtx_st->started = false;
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ptr_session_st->hsSessionId = ptr_hsCtx_st->hsSessionId;
+        ptr_session_st->hsHandler_en = ptr_hsCtx_st->hsHandler_en;
+        ptr_session_st->keyLen = aesKeyLen;
+        ptr_session_st->txSeq = 0UL;
+        ptr_session_st->rxSeq = 0UL;
+
+        ret_hsStat_en = lCrypto_Handshake_Derive(ptr_hsCtx_st, aesKeyLen, ptr_session_st);
+    }
+
+    if (ptr_hsCtx_st != NULL)
+    {
+        (void)memset(&ptr_hsCtx_st->kdfCtx_st, 0, sizeof(ptr_hsCtx_st->kdfCtx_st));
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ret_hsStat_en = lCrypto_Handshake_SessionInit(ptr_session_st, CRYPTO_CIOP_ENCRYPT);
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ret_hsStat_en = lCrypto_Handshake_SessionInit(ptr_session_st, CRYPTO_CIOP_DECRYPT);
+    }
+
+    if ((ret_hsStat_en != CRYPTO_HANDSHAKE_SUCCESS) && (ptr_session_st != NULL))
+    {
+        Crypto_Handshake_Session_Close(ptr_session_st);
+    }
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_ECDHE_FINISH, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+crypto_Handshake_Status_E Crypto_Handshake_Ecdhe(st_Crypto_Handshake_Ecdhe_Ctx *ptr_hsCtx_st, crypto_HandlerType_E hsHandler_en,
+                                                 crypto_Handshake_Role_E hsRole_en, crypto_EccCurveType_E hsCurve_en,
+                                                 uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                 uint8_t *ptr_salt, uint32_t saltLen, uint32_t aesKeyLen,
+                                                 st_Crypto_Handshake_Session *ptr_session_st, uint32_t hsSessionId)
+{
+    crypto_Handshake_Status_E ret_hsStat_en;
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_ECDHE, 0UL);
+
+    ret_hsStat_en = Crypto_Handshake_Ecdhe_Start(ptr_hsCtx_st, hsHandler_en, hsRole_en, hsCurve_en, ptr_pubKey,
+                                                 pubKeyLen, hsSessionId);
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ret_hsStat_en = Crypto_Handshake_Ecdhe_Finish(ptr_hsCtx_st, ptr_peerPubKey, peerPubKeyLen, ptr_salt, saltLen,
+                                                      aesKeyLen, ptr_session_st);
+    }
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_ECDHE, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+crypto_Handshake_Status_E Crypto_Handshake_Session_Next(st_Crypto_Handshake_Session *ptr_session_st,
+                                                        crypto_CipherOper_E cipherOper_en)
+{
+    crypto_Handshake_Status_E ret_hsStat_en = CRYPTO_HANDSHAKE_SUCCESS;
+    uint32_t *ptr_seq = NULL;
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_SESSION_NEXT, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_session_st == NULL))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CTX;
+    }
+    else if(cipherOper_en == CRYPTO_CIOP_ENCRYPT)
+    {
+        ptr_seq = &ptr_session_st->txSeq;
+    }
+    else if(cipherOper_en == CRYPTO_CIOP_DECRYPT)
+    {
+        ptr_seq = &ptr_session_st->rxSeq;
+    }
+    else
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+
+    if (ptr_seq != NULL)
+    {
+        // A nonce is never used twice with a key; the session ends at the last one.
+        if (*ptr_seq == UINT32_MAX)
+        {
+            ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_LIMIT;
+        }
+        else
+        {
+            (*ptr_seq)++;
+            ret_hsStat_en = lCrypto_Handshake_SessionInit(ptr_session_st, cipherOper_en);
+        }
+    }
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_SESSION_NEXT, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+void Crypto_Handshake_Session_Close(st_Crypto_Handshake_Session *ptr_session_st)
+{
+    if (ptr_session_st != NULL)
+    {
+        (void)memset(ptr_session_st, 0, sizeof(*ptr_session_st));
+    }
+}
+
+crypto_Handshake_Status_E Crypto_Handshake_KeyPair(crypto_HandlerType_E hsHandler_en, crypto_EccCurveType_E hsCurve_en,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                   uint8_t *ptr_pubKey, uint32_t pubKeyLen, uint32_t hsSessionId)
+{
+    crypto_Handshake_Status_E ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_NOTSUPPTED;
+    const st_Crypto_Handshake_Curve *ptr_curve = lCrypto_Handshake_Curve(hsCurve_en);
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_KEYPAIR, 0UL);
+
+    if(ptr_curve == NULL)
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CURVE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen < ptr_curve->keyLen) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_pubKey == NULL) || (pubKeyLen < (2UL * ptr_curve->keyLen)) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (hsSessionId == 0u) || (hsSessionId > (uint32_t)CRYPTO_HANDSHAKE_SESSION_MAX) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_SID;
+    }
+    else
+    {
+        ret_hsStat_en = lCrypto_Handshake_Handler(hsHandler_en);
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ret_hsStat_en = lCrypto_Handshake_Ephemeral(hsHandler_en, hsSessionId, ptr_curve, ptr_privKey, ptr_pubKey);
+    }
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_KEYPAIR, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+crypto_Handshake_Status_E Crypto_Handshake_Agree(crypto_HandlerType_E hsHandler_en, crypto_EccCurveType_E hsCurve_en,
+                                                 uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                 uint8_t *ptr_peerPubKey, uint32_t peerPubKeyLen,
+                                                 uint8_t *ptr_secret, uint32_t secretLen, uint32_t hsSessionId)
+{
+    crypto_Handshake_Status_E ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_NOTSUPPTED;
+    const st_Crypto_Handshake_Curve *ptr_curve = lCrypto_Handshake_Curve(hsCurve_en);
+    uint8_t product[2 * CRYPTO_HANDSHAKE_MAX_KEY_SIZE] __attribute__((aligned (4)));
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_AGREE, 0UL);
+
+    if(ptr_curve == NULL)
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_CURVE;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen != ptr_curve->keyLen) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_peerPubKey == NULL) || (peerPubKeyLen != (2UL * ptr_curve->keyLen)) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_PUBKEY;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_secret == NULL) || (secretLen < ptr_curve->keyLen) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_ARG;
+    }
+    else if(CRYPTO_API_CHECK( (hsSessionId == 0u) || (hsSessionId > (uint32_t)CRYPTO_HANDSHAKE_SESSION_MAX) ))
+    {
+        ret_hsStat_en = CRYPTO_HANDSHAKE_ERROR_SID;
+    }
+    else
+    {
+        ret_hsStat_en = lCrypto_Handshake_Handler(hsHandler_en);
+    }
+
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        ret_hsStat_en = lCrypto_Handshake_Agree(hsHandler_en, hsSessionId, ptr_curve, ptr_privKey, ptr_peerPubKey,
+                                                product);
+    }
+    if (ret_hsStat_en == CRYPTO_HANDSHAKE_SUCCESS)
+    {
+        (void)memcpy(ptr_secret, product, ptr_curve->keyLen);
+    }
+
+    (void)memset(product, 0, sizeof(product));
+
+    return CRYPTO_TRACE_EXIT(HANDSHAKE_AGREE, crypto_Handshake_Status_E, ret_hsStat_en);
+}
+
+bool Crypto_Handshake_Pool_Task(crypto_HandlerType_E hsHandler_en, uint32_t hsSessionId)
+{
+    bool added = false;
+#if (CRYPTO_HANDSHAKE_POOL_TOTAL > 0U)
+    const st_Crypto_Handshake_Curve *ptr_curve = NULL;
+    st_Crypto_Handshake_Pool *ptr_pool;
+    st_Crypto_Handshake_PoolEntry *ptr_entry = NULL;
+    uint32_t generation = 0UL;
+    uint32_t fewest = UINT32_MAX;
+    uint32_t lockState;
+    uint32_t i;
+
+    CRYPTO_TRACE_ENTER(HANDSHAKE_POOL_TASK, 0UL);
+
+    // Reserve the next entry of the pool with the fewest key pairs ready.
+    lockState = Crypto_Int_Hw_Lock();
+    for (i = 0UL; i < (sizeof(handshakeCurves) / sizeof(handshakeCurves[0])); i++)
+    {
+        ptr_pool = handshakeCurves[i].ptr_pool;
+        if ((ptr_pool != NULL) && (!ptr_pool->filling) && (ptr_pool->ready < ptr_pool->count) &&
+            (!ptr_pool->ptr_entries[(ptr_pool->head + ptr_pool->ready) % ptr_pool->count].taken) &&
+            (ptr_pool->ready < fewest))
+        {
+            fewest = ptr_pool->ready;
+            ptr_curve = &handshakeCurves[i];
+        }
+    }
+    if (ptr_curve != NULL)
+    {
+        ptr_pool = ptr_curve->ptr_pool;
+        ptr_entry = &ptr_pool->ptr_entries[(ptr_pool->head + ptr_pool->ready) % ptr_pool->count];
+        ptr_pool->filling = true;
+        generation = ptr_pool->generation;
+    }
+    Crypto_Int_Hw_Unlock(lockState);
+
+    if (ptr_entry != NULL)
+    {
+        ptr_pool = ptr_curve->ptr_pool;
+        added = (lCrypto_Handshake_KeyPair(hsHandler_en, hsSessionId, ptr_curve, ptr_entry->privKey,
+                                           ptr_entry->pubKey) == CRYPTO_HANDSHAKE_SUCCESS);
+
+        lockState = Crypto_Int_Hw_Lock();
+        if (added && (generation == ptr_pool->generation))
+        {
+            ptr_pool->ready++;
+            ptr_pool->filling = false;
+        }
+        else
+        {
+            added = false;
+        }
+        Crypto_Int_Hw_Unlock(lockState);
+
+        if (!added)
+        {
+            (void)memset(ptr_entry->privKey, 0, sizeof(ptr_entry->privKey));
+            (void)memset(ptr_entry->pubKey, 0, sizeof(ptr_entry->pubKey));
+
+            lockState = Crypto_Int_Hw_Lock();
+            ptr_pool->filling = false;
+            Crypto_Int_Hw_Unlock(lockState);
+        }
+    }
+
+    CRYPTO_TRACE_EXIT_VOID(HANDSHAKE_POOL_TASK);
+#else
+    (void)hsHandler_en;
+    (void)hsSessionId;
+#endif
+
+    return added;
+}
+
+uint32_t Crypto_Handshake_Pool_Count(crypto_EccCurveType_E hsCurve_en)
+{
+    const st_Crypto_Handshake_Curve *ptr_curve = lCrypto_Handshake_Curve(hsCurve_en);
+    uint32_t ready = 0UL;
+
+    if ((ptr_curve != NULL) && (ptr_curve->ptr_pool != NULL))
+    {
+        ready = ptr_curve->ptr_pool->ready;
+    }
+
+    return ready;
+}
+
+void Crypto_Handshake_Pool_Flush(void)
+{
+#if (CRYPTO_HANDSHAKE_POOL_TOTAL > 0U)
+    st_Crypto_Handshake_Pool *ptr_pool;
+    st_Crypto_Handshake_PoolEntry *ptr_entry;
+    uint32_t lockState;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < (sizeof(handshakeCurves) / sizeof(handshakeCurves[0])); i++)
+    {
+        ptr_pool = handshakeCurves[i].ptr_pool;
+        if (ptr_pool != NULL)
+        {
+            /* The ready entries are wiped before the lock is released, so
+             * that Crypto_Handshake_Pool_Task() does not refill one of them
+             * meanwhile; a key pair being generated is dropped at its end. */
+            lockState = Crypto_Int_Hw_Lock();
+            for (j = 0UL; j < ptr_pool->ready; j++)
+            {
+                ptr_entry = &ptr_pool->ptr_entries[(ptr_pool->head + j) % ptr_pool->count];
+                (void)memset(ptr_entry->privKey, 0, sizeof(ptr_entry->privKey));
+                (void)memset(ptr_entry->pubKey, 0, sizeof(ptr_entry->pubKey));
+            }
+            ptr_pool->ready = 0UL;
+            ptr_pool->generation++;
+            Crypto_Int_Hw_Unlock(lockState);
+        }
+    }
+#endif
+}
+
+#endif /* CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1 */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_kas.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+ 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/drivers/wrapper/crypto_kas_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_pke.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if (CRYPTO_CONFIG_KAS_ECDH == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_KAS_SESSION_MAX (1) 
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Kas_Status_E lCrypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId,
+                                                    void *ptr_workspace)
+{
+    crypto_Kas_Status_E ret_ecdhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+
+    if(CRYPTO_API_CHECK( (ptr_pubKey == NULL) || (pubKeyLen == 0u) ))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH) ))
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    else if(CRYPTO_API_CHECK( (eccCurveType_en <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_en >= CRYPTO_ECC_CURVE_MAX) ))
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else if(CRYPTO_API_CHECK((ecdhSessionId == 0u) || (ecdhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) ))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_SID;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(KAS_ECDH))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_FAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ecdhHandlerType_en))
+        {            
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software handler; always the CAM.
+#endif
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+	                ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecret(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+	                                                                  sharedSecretLen, eccCurveType_en);
+                }
+                else
+                {
+	                ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecretEx(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+	                                                                    sharedSecretLen, eccCurveType_en, ptr_workspace);
+                }
+	            break;
+            default:
+                ret_ecdhStat_en = CRYPTO_KAS_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_ecdhStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId)
+{
+    CRYPTO_TRACE_ENTER(KAS_ECDH_SHAREDSECRET, 0UL);
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_SHAREDSECRET, crypto_Kas_Status_E,
+        lCrypto_Kas_Ecdh_SharedSecret(ecdhHandlerType_en, ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret, sharedSecretLen,
+                                      eccCurveType_en, ecdhSessionId, NULL));
+}
+
+uint32_t Crypto_Kas_Ecdh_WorkspaceSize(crypto_HandlerType_E ecdhHandlerType_en)
+{
+    uint32_t size = 0UL;
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    if ((ecdhHandlerType_en == CRYPTO_HANDLER_HW_INTERNAL) || (ecdhHandlerType_en == CRYPTO_HANDLER_AUTO))
+#else
+    if (ecdhHandlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
+#endif
+    {
+        size = (uint32_t)sizeof(PKE_CONFIG);
+    }
+
+    return size;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecretEx(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId,
+                                                    void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Kas_Status_E ret_ecdhStat_en;
+
+    CRYPTO_TRACE_ENTER(KAS_ECDH_SHAREDSECRETEX, 0UL);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Kas_Ecdh_WorkspaceSize(ecdhHandlerType_en))))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_ARG;
+    }
+    else
+    {
+        ret_ecdhStat_en = lCrypto_Kas_Ecdh_SharedSecret(ecdhHandlerType_en, ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret, sharedSecretLen,
+                                                        eccCurveType_en, ecdhSessionId, ptr_workspace);
+    }
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_SHAREDSECRETEX, crypto_Kas_Status_E, ret_ecdhStat_en);
+}
+
+#endif /* CRYPTO_CONFIG_KAS_ECDH == 1 */
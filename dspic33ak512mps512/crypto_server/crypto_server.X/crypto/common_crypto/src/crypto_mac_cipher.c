@@ -0,0 +1,342 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_cipher.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/drivers/wrapper/crypto_mac_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+#include "crypto/drivers/sw/crypto_mac_sw_wrapper.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#endif
+
+#if (CRYPTO_CONFIG_MAC_AESCMAC == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_MAC_SESSION_MAX (1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+/**
+ * @brief Resolve CRYPTO_HANDLER_AUTO to the handler that runs an operation.
+ * @param handlerType_en The handler asked for; other handlers are returned as they are.
+ * @param dataLen Length of the message, or UINT32_MAX when it is not known yet.
+ * @return CRYPTO_HANDLER_SW_INTERNAL when the message is below
+ *         CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER or the engine is busy,
+ *         CRYPTO_HANDLER_HW_INTERNAL otherwise.
+ */
+static crypto_HandlerType_E lCrypto_Mac_AesCmac_AutoHandler(crypto_HandlerType_E handlerType_en, uint32_t dataLen)
+{
+    crypto_HandlerType_E handler = handlerType_en;
+
+    if (handlerType_en == CRYPTO_HANDLER_AUTO)
+    {
+        handler = CRYPTO_HANDLER_HW_INTERNAL;
+
+        if (CRYPTO_AUTO_CMAC_BELOW_CROSSOVER(dataLen) || Crypto_Osal_EngineBusy(CRYPTO_OSAL_ENGINE_SYM))
+        {
+            handler = CRYPTO_HANDLER_SW_INTERNAL;
+        }
+    }
+
+    return handler;
+}
+
+#define CRYPTO_MAC_CMAC_HANDLER(handler, len)  lCrypto_Mac_AesCmac_AutoHandler((handler), (len))
+#else
+#define CRYPTO_MAC_CMAC_HANDLER(handler, len)  (handler)
+#endif
+
+static crypto_Mac_Status_E lCrypto_Mac_AesCmac_Direct(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID,
+                                                void *ptr_workspace)
+{
+    crypto_Mac_Status_E ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    if(CRYPTO_API_CHECK( (ptr_inputData == NULL) && (dataLen != 0UL) ))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_INPUTDATA;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_outMac == NULL) || (macLen == 0UL) ))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_MACDATA;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256)  ))
+    {
+       ret_aesCmacStat_en =  CRYPTO_MAC_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0U) || (sessionID > (uint32_t)CRYPTO_MAC_SESSION_MAX) ))
+    {
+       ret_aesCmacStat_en =  CRYPTO_MAC_ERROR_SID;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(MAC_AESCMAC))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_MAC_CMAC_HANDLER(macHandlerType_en, dataLen)))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                if (ptr_workspace == NULL)
+                {
+                    ret_aesCmacStat_en = Crypto_Sym_Hw_Cmac_Direct(ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen);
+                }
+                else
+                {
+                    ret_aesCmacStat_en = Crypto_Sym_Hw_Cmac_DirectEx(ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Sw_Cmac_Direct(ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen, ptr_workspace);
+                break;
+#endif
+            default:
+                ret_aesCmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+				break;
+        }
+    }
+    return ret_aesCmacStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_Init(st_Crypto_Mac_Aes_ctx *ptr_aesCmacCtx_st, crypto_HandlerType_E handlerType_en,
+                                              uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    crypto_Mac_Status_E ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    CRYPTO_TRACE_ENTER(MAC_AESCMAC_INIT, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_aesCmacCtx_st == NULL))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_key == NULL) || (keyLen < (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen > (uint32_t)CRYPTO_AESKEYSIZE_256)  ))
+    {
+       ret_aesCmacStat_en =  CRYPTO_MAC_ERROR_KEY;
+    }
+    else if(CRYPTO_API_CHECK( (sessionID == 0U) || (sessionID > (uint32_t)CRYPTO_MAC_SESSION_MAX) ))
+    {
+       ret_aesCmacStat_en =  CRYPTO_MAC_ERROR_SID;
+    }
+    else if(!CRYPTO_SELFTEST_REQUIRE(MAC_AESCMAC))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+    else
+    {
+        ptr_aesCmacCtx_st->cryptoSessionID =  sessionID;
+        // CRYPTO_HANDLER_AUTO is settled here for the whole stream; its length is not known yet.
+        ptr_aesCmacCtx_st->macHandlerType_en = CRYPTO_MAC_CMAC_HANDLER(handlerType_en, UINT32_MAX);
+        ptr_aesCmacCtx_st->ptr_key = ptr_key;
+        ptr_aesCmacCtx_st->mackeyLen = keyLen;
+
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCmacCtx_st->macHandlerType_en))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+            	ret_aesCmacStat_en = Crypto_Sym_Hw_Cmac_Init((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_aesCmacCtx_st->ptr_key, keyLen);
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Sw_Cmac_Init((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_aesCmacCtx_st->ptr_key, keyLen);
+                break;
+#endif
+            default:
+                ret_aesCmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+                break;
+        }
+
+    }
+    return CRYPTO_TRACE_EXIT(MAC_AESCMAC_INIT, crypto_Mac_Status_E, ret_aesCmacStat_en);
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_Cipher(st_Crypto_Mac_Aes_ctx *ptr_aesCmacCtx_st, uint8_t *ptr_inputData, uint32_t dataLen)
+{
+    crypto_Mac_Status_E ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    CRYPTO_TRACE_ENTER(MAC_AESCMAC_CIPHER, dataLen);
+
+    if(CRYPTO_API_CHECK(ptr_aesCmacCtx_st == NULL))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK( (ptr_inputData == NULL) && (dataLen != 0UL) ))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_INPUTDATA;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCmacCtx_st->macHandlerType_en))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Hw_Cmac_Cipher((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_inputData, dataLen);
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Sw_Cmac_Cipher((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_inputData, dataLen);
+                break;
+#endif
+            default:
+                ret_aesCmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+				break;
+        }
+    }
+    return CRYPTO_TRACE_EXIT(MAC_AESCMAC_CIPHER, crypto_Mac_Status_E, ret_aesCmacStat_en);
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_Final(st_Crypto_Mac_Aes_ctx *ptr_aesCmacCtx_st, uint8_t *ptr_outMac, uint32_t macLen)
+{
+    crypto_Mac_Status_E ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    CRYPTO_TRACE_ENTER(MAC_AESCMAC_FINAL, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_aesCmacCtx_st == NULL))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else if(CRYPTO_API_CHECK((ptr_outMac == NULL) || (macLen == 0U)))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_MACDATA;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ptr_aesCmacCtx_st->macHandlerType_en))
+        {
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Hw_Cmac_Final((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_outMac, macLen);
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_aesCmacStat_en = Crypto_Sym_Sw_Cmac_Final((void*)ptr_aesCmacCtx_st->arr_macDataCtx, ptr_outMac, macLen);
+                break;
+#endif
+            default:
+                ret_aesCmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+				break;
+        }
+    }
+    return CRYPTO_TRACE_EXIT(MAC_AESCMAC_FINAL, crypto_Mac_Status_E, ret_aesCmacStat_en);
+}
+
+uint32_t Crypto_Mac_AesCmac_WorkspaceSize(crypto_HandlerType_E macHandlerType_en)
+{
+    uint32_t size = 0UL;
+
+    if (macHandlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
+    {
+        size = (uint32_t)sizeof(CRYPTO_CMAC_HW_CONTEXT);
+    }
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    else if (macHandlerType_en == CRYPTO_HANDLER_SW_INTERNAL)
+    {
+        size = (uint32_t)sizeof(CRYPTO_CMAC_SW_CONTEXT);
+    }
+    else if (macHandlerType_en == CRYPTO_HANDLER_AUTO)
+    {
+        // Either handler may run the operation.
+        size = (uint32_t)((sizeof(CRYPTO_CMAC_HW_CONTEXT) > sizeof(CRYPTO_CMAC_SW_CONTEXT)) ?
+            sizeof(CRYPTO_CMAC_HW_CONTEXT) : sizeof(CRYPTO_CMAC_SW_CONTEXT));
+    }
+#endif
+
+    return size;
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_Direct(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    CRYPTO_TRACE_ENTER(MAC_AESCMAC_DIRECT, dataLen);
+
+    return CRYPTO_TRACE_EXIT(MAC_AESCMAC_DIRECT, crypto_Mac_Status_E,
+        lCrypto_Mac_AesCmac_Direct(macHandlerType_en, ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen, sessionID, NULL));
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_DirectEx(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID,
+                                                void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Mac_Status_E ret_aesCmacStat_en;
+
+    CRYPTO_TRACE_ENTER(MAC_AESCMAC_DIRECTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Mac_AesCmac_WorkspaceSize(macHandlerType_en))))
+    {
+        ret_aesCmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else
+    {
+        ret_aesCmacStat_en = lCrypto_Mac_AesCmac_Direct(macHandlerType_en, ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen, sessionID, ptr_workspace);
+    }
+
+    return CRYPTO_TRACE_EXIT(MAC_AESCMAC_DIRECTEX, crypto_Mac_Status_E, ret_aesCmacStat_en);
+}
+
+// *****************************************************************************
+
+#endif /* CRYPTO_CONFIG_MAC_AESCMAC == 1 */
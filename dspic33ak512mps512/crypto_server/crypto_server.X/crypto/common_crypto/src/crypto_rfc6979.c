@@ -0,0 +1,580 @@
+/*******************************************************************************
+  Crypto RFC 6979 ECDSA Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rfc6979.c
+
+  Summary:
+    This file contains deterministic ECDSA on the Crypto_Kdf and Crypto_Kas
+    APIs.
+
+  Description:
+    HMAC-DRBG runs on the HKDF context of crypto_kdf.c, keyed with
+    Crypto_Kdf_Hkdf_Init() at each new K, and R = k * G on the ECDH of the
+    PKE. The scalar arithmetic mod n is the constant-time Montgomery
+    multiplication of crypto_bn.c, which the secret nonce and private key go
+    through. See crypto_rfc6979.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_rfc6979.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/src/crypto_bn.h"
+
+#if (CRYPTO_CONFIG_DIGISIGN_RFC6979 == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_RFC6979_SESSION_MAX      (1)
+
+// Longest coordinate and order of the curves built.
+#define CRYPTO_RFC6979_MAX_KEY_SIZE     (CRYPTO_ECC_MAX_KEY_LENGTH)
+
+// Longest HMAC-DRBG seed: V || 0x00 or 0x01 || int2octets(x) || bits2octets(h1).
+#define CRYPTO_RFC6979_MAX_SEED_SIZE    (CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE + 1 + (2 * CRYPTO_RFC6979_MAX_KEY_SIZE))
+
+/* Nonces tried before giving up. A candidate of these curves is rejected
+ * (k >= n, r = 0 or s = 0) with a probability below 2^-32. */
+#define CRYPTO_RFC6979_TRIES            (4UL)
+
+// HMAC-DRBG of RFC 6979 section 3.2; the HMAC context is keyed with K.
+typedef struct{
+    st_Crypto_Kdf_Hkdf_Ctx hmacCtx_st;
+    crypto_HandlerType_E handler_en;
+    crypto_Hash_Algo_E hmacAlgo_en;
+    uint32_t sessionId;
+    uint32_t hLen;
+    uint8_t v[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+    uint8_t k[CRYPTO_KDF_HKDF_MAX_DIGEST_SIZE] __attribute__((aligned (4)));
+}st_Crypto_Rfc6979_Drbg;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Get the HMAC hash of a hash length, the hash of the message.
+ * @return The algorithm, CRYPTO_HASH_INVALID for a length of no built hash.
+ */
+static crypto_Hash_Algo_E lCrypto_Rfc6979_HmacAlgo(uint32_t hashLen)
+{
+    crypto_Hash_Algo_E algo_en;
+
+    switch(hashLen)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case 32UL:
+            algo_en = CRYPTO_HASH_SHA2_256;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case 48UL:
+            algo_en = CRYPTO_HASH_SHA2_384;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case 64UL:
+            algo_en = CRYPTO_HASH_SHA2_512;
+            break;
+#endif
+        default:
+            algo_en = CRYPTO_HASH_INVALID;
+            break;
+    }
+
+    return algo_en;
+}
+
+/**
+ * @brief bits2int of RFC 6979: the leftmost qlen bits of a string as a
+ *        number, below 2^qlen.
+ */
+static void lCrypto_Rfc6979_Bits2Int(uint32_t *ptr_a, const uint8_t *ptr_bytes, uint32_t len,
+                                     const st_Crypto_Bn_Curve *ptr_curve, uint32_t limbs)
+{
+    uint32_t shift = 0UL;
+    uint32_t i;
+
+    if ((len * 8UL) > ptr_curve->orderBits)
+    {
+        // The first rlen bytes hold the leftmost qlen bits and at most 7 more.
+        len = ptr_curve->keyLen;
+        shift = (len * 8UL) - ptr_curve->orderBits;
+    }
+    Crypto_Bn_FromBytes(ptr_a, ptr_bytes, len, limbs);
+
+    if (shift != 0UL)
+    {
+        for (i = 0UL; i < limbs; i++)
+        {
+            ptr_a[i] = (ptr_a[i] >> shift) | ((i + 1UL < limbs) ? (ptr_a[i + 1UL] << (32UL - shift)) : 0UL);
+        }
+    }
+}
+
+/**
+ * @brief V = HMAC_K(V).
+ */
+static crypto_Kdf_Status_E lCrypto_Rfc6979_DrbgStep(st_Crypto_Rfc6979_Drbg *ptr_drbg)
+{
+    return Crypto_Kdf_Hkdf_Mac(&ptr_drbg->hmacCtx_st, ptr_drbg->v, ptr_drbg->hLen, ptr_drbg->v);
+}
+
+/**
+ * @brief K = HMAC_K(V || sep || seed), then V = HMAC_K(V) with the new K.
+ * @param ptr_seed int2octets(x) || bits2octets(h1), or NULL for none.
+ */
+static crypto_Kdf_Status_E lCrypto_Rfc6979_DrbgRekey(st_Crypto_Rfc6979_Drbg *ptr_drbg, uint8_t sep,
+                                                     const uint8_t *ptr_seed, uint32_t seedLen)
+{
+    uint8_t msg[CRYPTO_RFC6979_MAX_SEED_SIZE] __attribute__((aligned (4)));
+    uint32_t msgLen = ptr_drbg->hLen;
+    crypto_Kdf_Status_E status;
+
+    (void)memcpy(msg, ptr_drbg->v, ptr_drbg->hLen);
+    msg[msgLen] = sep;
+    msgLen++;
+    if (seedLen != 0UL)
+    {
+        (void)memcpy(&msg[msgLen], ptr_seed, seedLen);
+        msgLen += seedLen;
+    }
+
+    status = Crypto_Kdf_Hkdf_Mac(&ptr_drbg->hmacCtx_st, msg, msgLen, ptr_drbg->k);
+    if (status == CRYPTO_KDF_SUCCESS)
+    {
+        status = Crypto_Kdf_Hkdf_Init(&ptr_drbg->hmacCtx_st, ptr_drbg->handler_en, ptr_drbg->hmacAlgo_en,
+                                      ptr_drbg->k, ptr_drbg->hLen, ptr_drbg->sessionId);
+    }
+    if (status == CRYPTO_KDF_SUCCESS)
+    {
+        status = lCrypto_Rfc6979_DrbgStep(ptr_drbg);
+    }
+    (void)memset(msg, 0, sizeof(msg));
+
+    return status;
+}
+
+/**
+ * @brief Steps a to f of RFC 6979 section 3.2: seed the HMAC-DRBG with the
+ *        private key and the hash.
+ * @param ptr_seed int2octets(x) || bits2octets(h1), two coordinates long.
+ */
+static crypto_Kdf_Status_E lCrypto_Rfc6979_DrbgInit(st_Crypto_Rfc6979_Drbg *ptr_drbg, const uint8_t *ptr_seed,
+                                                    uint32_t seedLen)
+{
+    crypto_Kdf_Status_E status;
+
+    (void)memset(ptr_drbg->v, 0x01, ptr_drbg->hLen);
+    (void)memset(ptr_drbg->k, 0x00, ptr_drbg->hLen);
+
+    status = Crypto_Kdf_Hkdf_Init(&ptr_drbg->hmacCtx_st, ptr_drbg->handler_en, ptr_drbg->hmacAlgo_en,
+                                  ptr_drbg->k, ptr_drbg->hLen, ptr_drbg->sessionId);
+    if (status == CRYPTO_KDF_SUCCESS)
+    {
+        status = lCrypto_Rfc6979_DrbgRekey(ptr_drbg, 0x00U, ptr_seed, seedLen);
+    }
+    if (status == CRYPTO_KDF_SUCCESS)
+    {
+        status = lCrypto_Rfc6979_DrbgRekey(ptr_drbg, 0x01U, ptr_seed, seedLen);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Step h of RFC 6979 section 3.2: the next candidate k in [1, n - 1].
+ *        A call after the first moves the DRBG past the candidate before,
+ *        rejected by the caller (step h.3).
+ * @param ptr_k Receives k.
+ * @param retry false for the first candidate.
+ */
+static crypto_DigiSign_Status_E lCrypto_Rfc6979_DrbgNonce(st_Crypto_Rfc6979_Drbg *ptr_drbg,
+                                                          const st_Crypto_Bn_Curve *ptr_curve,
+                                                          const st_Crypto_Bn_Mod *ptr_order,
+                                                          uint32_t *ptr_k, bool retry)
+{
+    uint8_t t[CRYPTO_RFC6979_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_ERROR_FAIL;
+    crypto_Kdf_Status_E kdfStatus = CRYPTO_KDF_SUCCESS;
+    uint32_t tries = 0UL;
+    uint32_t done;
+    uint32_t take;
+
+    while ((status != CRYPTO_DIGISIGN_SUCCESS) && (kdfStatus == CRYPTO_KDF_SUCCESS) && (tries < CRYPTO_RFC6979_TRIES))
+    {
+        if (retry)
+        {
+            kdfStatus = lCrypto_Rfc6979_DrbgRekey(ptr_drbg, 0x00U, NULL, 0UL);
+        }
+        retry = true;
+        tries++;
+
+        // T = V || V || ... up to qlen bits; only the first rlen bytes count.
+        done = 0UL;
+        while ((kdfStatus == CRYPTO_KDF_SUCCESS) && (done < ptr_curve->keyLen))
+        {
+            kdfStatus = lCrypto_Rfc6979_DrbgStep(ptr_drbg);
+            take = ((ptr_curve->keyLen - done) < ptr_drbg->hLen) ? (ptr_curve->keyLen - done) : ptr_drbg->hLen;
+            (void)memcpy(&t[done], ptr_drbg->v, take);
+            done += take;
+        }
+
+        if (kdfStatus == CRYPTO_KDF_SUCCESS)
+        {
+            lCrypto_Rfc6979_Bits2Int(ptr_k, t, ptr_curve->keyLen, ptr_curve, ptr_order->limbs);
+            if ((!Crypto_Bn_IsZero(ptr_k, ptr_order->limbs)) &&
+                (Crypto_Bn_Compare(ptr_k, ptr_order->m, ptr_order->limbs) < 0L))
+            {
+                status = CRYPTO_DIGISIGN_SUCCESS;
+            }
+        }
+    }
+    (void)memset(t, 0, sizeof(t));
+
+    return status;
+}
+
+/**
+ * @brief Check the arguments shared by the nonce and the sign, set up the
+ *        order and seed the DRBG.
+ * @param ptr_z Receives the hash as a number mod n.
+ * @param ptr_d Receives the private key as a number.
+ */
+static crypto_DigiSign_Status_E lCrypto_Rfc6979_Setup(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                      uint32_t hashLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                      crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId,
+                                                      const st_Crypto_Bn_Curve **ptr_ptr_curve,
+                                                      st_Crypto_Bn_Mod *ptr_order, st_Crypto_Rfc6979_Drbg *ptr_drbg,
+                                                      uint32_t *ptr_z, uint32_t *ptr_d)
+{
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    uint8_t seed[2 * CRYPTO_RFC6979_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    const st_Crypto_Bn_Curve *ptr_curve = Crypto_Bn_Curve(eccCurveType_En);
+
+    *ptr_ptr_curve = ptr_curve;
+
+    if(CRYPTO_API_CHECK( (ptr_inputHash == NULL) || (hashLen == 0u) ))
+    {
+        status = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    else if(CRYPTO_API_CHECK(ptr_privKey == NULL))
+    {
+        status = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    else if(CRYPTO_API_CHECK((ecdsaSessionId == 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_RFC6979_SESSION_MAX) ))
+    {
+        status = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else if (ptr_curve == NULL)
+    {
+        status = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if (privKeyLen != ptr_curve->keyLen)
+    {
+        status = CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+    }
+    else if (lCrypto_Rfc6979_HmacAlgo(hashLen) == CRYPTO_HASH_INVALID)
+    {
+        status = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    else
+    {
+        switch(CRYPTO_HANDLER_SELECT(ecdsaHandlerType_en))
+        {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:
+#endif
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                break;
+            default:
+                status = CRYPTO_DIGISIGN_ERROR_HDLR;
+                break;
+        }
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        Crypto_Bn_ModInit(ptr_order, ptr_curve->ptr_n, ptr_curve->keyLen);
+
+        // 0 < d < n
+        Crypto_Bn_FromBytes(ptr_d, ptr_privKey, privKeyLen, ptr_order->limbs);
+        if ((Crypto_Bn_IsZero(ptr_d, ptr_order->limbs)) ||
+            (Crypto_Bn_Compare(ptr_d, ptr_order->m, ptr_order->limbs) >= 0L))
+        {
+            status = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+        }
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        // z = bits2int(h1) mod n, below 2n as n > 2^(qlen - 1)
+        lCrypto_Rfc6979_Bits2Int(ptr_z, ptr_inputHash, hashLen, ptr_curve, ptr_order->limbs);
+        Crypto_Bn_Reduce(ptr_z, ptr_order);
+
+        // int2octets(x) || bits2octets(h1)
+        (void)memcpy(seed, ptr_privKey, privKeyLen);
+        Crypto_Bn_ToBytes(&seed[privKeyLen], ptr_z, privKeyLen);
+
+        ptr_drbg->handler_en = ecdsaHandlerType_en;
+        ptr_drbg->hmacAlgo_en = lCrypto_Rfc6979_HmacAlgo(hashLen);
+        ptr_drbg->sessionId = ecdsaSessionId;
+        ptr_drbg->hLen = hashLen;
+        if (lCrypto_Rfc6979_DrbgInit(ptr_drbg, seed, 2UL * privKeyLen) != CRYPTO_KDF_SUCCESS)
+        {
+            status = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+    }
+    (void)memset(seed, 0, sizeof(seed));
+
+    return status;
+}
+
+/**
+ * @brief Sign with a candidate nonce: r = (k * G).x mod n on the PKE and
+ *        s = k^-1 * (z + r * d) mod n here.
+ * @param ptr_outSig Receives r || s.
+ * @return CRYPTO_DIGISIGN_SUCCESS, CRYPTO_DIGISIGN_ERROR_SIGNATURE when r or
+ *         s is 0 and the next nonce must be tried, or the error of the PKE.
+ */
+static crypto_DigiSign_Status_E lCrypto_Rfc6979_SignWith(crypto_HandlerType_E ecdsaHandlerType_en, uint32_t ecdsaSessionId,
+                                                         const st_Crypto_Bn_Curve *ptr_curve,
+                                                         const st_Crypto_Bn_Mod *ptr_order,
+                                                         const uint32_t *ptr_k, const uint32_t *ptr_z,
+                                                         const uint32_t *ptr_d, uint8_t *ptr_outSig)
+{
+    uint8_t generator[2 * CRYPTO_RFC6979_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t product[2 * CRYPTO_RFC6979_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint8_t kBytes[CRYPTO_RFC6979_MAX_KEY_SIZE] __attribute__((aligned (4)));
+    uint32_t r[CRYPTO_BN_MAX_LIMBS];
+    uint32_t t[CRYPTO_BN_MAX_LIMBS];
+    uint32_t y[CRYPTO_BN_MAX_LIMBS];
+    uint32_t e[CRYPTO_BN_MAX_LIMBS];
+    uint32_t km[CRYPTO_BN_MAX_LIMBS];
+    uint32_t keyLen = ptr_curve->keyLen;
+    uint32_t limbs = ptr_order->limbs;
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    uint32_t bit;
+
+    // R = k * G, X only is needed.
+    (void)memcpy(generator, ptr_curve->ptr_gx, keyLen);
+    (void)memcpy(&generator[keyLen], ptr_curve->ptr_gy, keyLen);
+    Crypto_Bn_ToBytes(kBytes, ptr_k, keyLen);
+    if (Crypto_Kas_Ecdh_SharedSecret(ecdsaHandlerType_en, kBytes, keyLen, generator, 2UL * keyLen, product,
+                                     2UL * keyLen, ptr_curve->curve_en, ecdsaSessionId) != CRYPTO_KAS_SUCCESS)
+    {
+        status = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        // r = X mod n; X < p < 2n on these curves.
+        Crypto_Bn_FromBytes(r, product, keyLen, limbs);
+        Crypto_Bn_Reduce(r, ptr_order);
+
+        // t = z + r * d mod n: (r * R) * d / R, plus z.
+        Crypto_Bn_MontMul(t, r, ptr_order->rr, ptr_order);
+        Crypto_Bn_MontMul(t, t, ptr_d, ptr_order);
+        Crypto_Bn_ModAdd(t, t, ptr_z, ptr_order);
+
+        /* y = k^(n - 2) * R = k^-1 * R, left to right square and multiply.
+         * The branch follows the bits of n - 2, which are public. */
+        (void)memset(e, 0, sizeof(e));
+        e[0] = 2UL;
+        (void)Crypto_Bn_Sub(e, ptr_order->m, e, limbs);
+        Crypto_Bn_MontMul(km, ptr_k, ptr_order->rr, ptr_order);
+        (void)memset(y, 0, sizeof(y));
+        y[0] = 1UL;
+        Crypto_Bn_MontMul(y, y, ptr_order->rr, ptr_order);
+        for (bit = limbs * 32UL; bit > 0UL; bit--)
+        {
+            Crypto_Bn_MontMul(y, y, y, ptr_order);
+            if (((e[(bit - 1UL) / 32UL] >> ((bit - 1UL) % 32UL)) & 1UL) != 0UL)
+            {
+                Crypto_Bn_MontMul(y, y, km, ptr_order);
+            }
+        }
+
+        // s = (k^-1 * R) * t / R
+        Crypto_Bn_MontMul(t, y, t, ptr_order);
+
+        if (Crypto_Bn_IsZero(r, limbs) || Crypto_Bn_IsZero(t, limbs))
+        {
+            status = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+        }
+        else
+        {
+            Crypto_Bn_ToBytes(ptr_outSig, r, keyLen);
+            Crypto_Bn_ToBytes(&ptr_outSig[keyLen], t, keyLen);
+        }
+    }
+
+    (void)memset(product, 0, sizeof(product));
+    (void)memset(kBytes, 0, sizeof(kBytes));
+    (void)memset(t, 0, sizeof(t));
+    (void)memset(y, 0, sizeof(y));
+    (void)memset(km, 0, sizeof(km));
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_DigiSign_Status_E Crypto_Rfc6979_Ecdsa_Nonce(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                    uint32_t hashLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                    crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_nonce,
+                                                    uint32_t nonceLen, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en;
+    const st_Crypto_Bn_Curve *ptr_curve = NULL;
+    st_Crypto_Bn_Mod order;
+    st_Crypto_Rfc6979_Drbg drbg;
+    uint32_t z[CRYPTO_BN_MAX_LIMBS];
+    uint32_t d[CRYPTO_BN_MAX_LIMBS];
+    uint32_t k[CRYPTO_BN_MAX_LIMBS];
+
+    CRYPTO_TRACE_ENTER(RFC6979_ECDSA_NONCE, hashLen);
+
+    if(CRYPTO_API_CHECK(ptr_nonce == NULL))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else
+    {
+        ret_ecdsaStat_en = lCrypto_Rfc6979_Setup(ecdsaHandlerType_en, ptr_inputHash, hashLen, ptr_privKey, privKeyLen,
+                                                 eccCurveType_En, ecdsaSessionId, &ptr_curve, &order, &drbg, z, d);
+        if ((ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS) && (nonceLen < ptr_curve->keyLen))
+        {
+            ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+        }
+        if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+        {
+            ret_ecdsaStat_en = lCrypto_Rfc6979_DrbgNonce(&drbg, ptr_curve, &order, k, false);
+        }
+
+        if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+        {
+            Crypto_Bn_ToBytes(ptr_nonce, k, ptr_curve->keyLen);
+        }
+        else if ((ptr_curve != NULL) && (nonceLen >= ptr_curve->keyLen))
+        {
+            (void)memset(ptr_nonce, 0, ptr_curve->keyLen);
+        }
+        else
+        {
+            // Nothing written.
+        }
+    }
+
+    (void)memset(&drbg, 0, sizeof(drbg));
+    (void)memset(d, 0, sizeof(d));
+    (void)memset(k, 0, sizeof(k));
+
+    return CRYPTO_TRACE_EXIT(RFC6979_ECDSA_NONCE, crypto_DigiSign_Status_E, ret_ecdsaStat_en);
+}
+
+crypto_DigiSign_Status_E Crypto_Rfc6979_Ecdsa_Sign(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                   uint32_t hashLen, uint8_t *ptr_outSig, uint32_t sigLen,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                   crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en;
+    const st_Crypto_Bn_Curve *ptr_curve = NULL;
+    st_Crypto_Bn_Mod order;
+    st_Crypto_Rfc6979_Drbg drbg;
+    uint32_t z[CRYPTO_BN_MAX_LIMBS];
+    uint32_t d[CRYPTO_BN_MAX_LIMBS];
+    uint32_t k[CRYPTO_BN_MAX_LIMBS];
+    uint32_t tries = 0UL;
+
+    CRYPTO_TRACE_ENTER(RFC6979_ECDSA_SIGN, hashLen);
+
+    if(CRYPTO_API_CHECK( (ptr_outSig == NULL) || (sigLen == 0u) ))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else
+    {
+        ret_ecdsaStat_en = lCrypto_Rfc6979_Setup(ecdsaHandlerType_en, ptr_inputHash, hashLen, ptr_privKey, privKeyLen,
+                                                 eccCurveType_En, ecdsaSessionId, &ptr_curve, &order, &drbg, z, d);
+        if ((ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS) && (sigLen < (2UL * ptr_curve->keyLen)))
+        {
+            ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+        }
+
+        // Step h, again from h.3 while r or s comes out 0.
+        if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+        {
+            do
+            {
+                ret_ecdsaStat_en = lCrypto_Rfc6979_DrbgNonce(&drbg, ptr_curve, &order, k, (tries != 0UL));
+                if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+                {
+                    ret_ecdsaStat_en = lCrypto_Rfc6979_SignWith(ecdsaHandlerType_en, ecdsaSessionId, ptr_curve, &order,
+                                                                k, z, d, ptr_outSig);
+                }
+                tries++;
+            } while ((ret_ecdsaStat_en == CRYPTO_DIGISIGN_ERROR_SIGNATURE) && (tries < CRYPTO_RFC6979_TRIES));
+
+            if (ret_ecdsaStat_en == CRYPTO_DIGISIGN_ERROR_SIGNATURE)
+            {
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+            }
+        }
+    }
+
+    (void)memset(&drbg, 0, sizeof(drbg));
+    (void)memset(d, 0, sizeof(d));
+    (void)memset(k, 0, sizeof(k));
+
+    return CRYPTO_TRACE_EXIT(RFC6979_ECDSA_SIGN, crypto_DigiSign_Status_E, ret_ecdsaStat_en);
+}
+
+#endif /* CRYPTO_CONFIG_DIGISIGN_RFC6979 == 1 */
@@ -0,0 +1,472 @@
+/*******************************************************************************
+  Crypto Verified-Signature Cache Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_verify_cache.c
+
+  Summary:
+    This file contains the cache of successful ECDSA verifications.
+
+  Description:
+    The tag of a verification is the HMAC-SHA-256, under a key of the TRNG,
+    of the SHA-256 of its curve, lengths, public key, hash and signature.
+    The table holds the tags of valid signatures with a use stamp for the
+    LRU replacement and a keyed check word. See crypto_verify_cache.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_kdf.h"
+#include "crypto/common_crypto/crypto_rng.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_verify_cache.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if (CRYPTO_CONFIG_VERIFY_CACHE == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_VERIFY_CACHE_SESSION_MAX (1)
+#define CRYPTO_VERIFY_CACHE_TAG_WORDS   (8U)        // SHA-256
+#define CRYPTO_VERIFY_CACHE_TAG_SIZE    (4U * CRYPTO_VERIFY_CACHE_TAG_WORDS)
+
+typedef struct{
+    uint32_t tag[CRYPTO_VERIFY_CACHE_TAG_WORDS];    // HMAC of the digest of the verification
+    uint32_t lastUse;                               // Use stamp, 0 for a free entry
+    uint32_t check;                                 // lCrypto_VerifyCache_Check() of the entry
+}st_Crypto_VerifyCache_Entry;
+
+static st_Crypto_VerifyCache_Entry verifyCacheEntries[CRYPTO_VERIFY_CACHE_ENTRIES];
+static st_Crypto_Kdf_Hkdf_Ctx verifyCacheMacCtx;
+static uint32_t verifyCacheCheckKey;
+static uint32_t verifyCacheClock;
+static bool verifyCacheKeyed;
+static uint32_t verifyCacheEpoch;                   // Count of the wipes, so a tag of an old key is not stored
+static volatile bool verifyCacheFlushPending;       // Set by a Flush() that could not take the lock
+static st_Crypto_VerifyCache_Stats verifyCacheStats;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Check word of an entry: its tag and stamp mixed into the check key
+ *        and its index.
+ */
+static uint32_t lCrypto_VerifyCache_Check(const st_Crypto_VerifyCache_Entry *ptr_entry, uint32_t index)
+{
+    uint32_t check = verifyCacheCheckKey + (index * 0x9E3779B1UL);
+    uint32_t i;
+
+    for (i = 0UL; i < CRYPTO_VERIFY_CACHE_TAG_WORDS; i++)
+    {
+        check = (check ^ ptr_entry->tag[i]) * 0x85EBCA6BUL;
+        check ^= check >> 13;
+    }
+    check = (check ^ ptr_entry->lastUse) * 0xC2B2AE35UL;
+    check ^= check >> 16;
+
+    return check;
+}
+
+/**
+ * @brief Wipe an entry to free.
+ */
+static void lCrypto_VerifyCache_Free(uint32_t index)
+{
+    st_Crypto_VerifyCache_Entry *ptr_entry = &verifyCacheEntries[index];
+
+    (void)memset(ptr_entry->tag, 0, sizeof(ptr_entry->tag));
+    ptr_entry->lastUse = 0UL;
+    ptr_entry->check = lCrypto_VerifyCache_Check(ptr_entry, index);
+}
+
+/**
+ * @brief Give an entry the next use stamp. At the end of the stamps every
+ *        entry is freed, so that the order of the stamps stays that of use.
+ */
+static void lCrypto_VerifyCache_Touch(uint32_t index)
+{
+    uint32_t i;
+
+    if (verifyCacheClock == UINT32_MAX)
+    {
+        for (i = 0UL; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++)
+        {
+            if (i != index)
+            {
+                lCrypto_VerifyCache_Free(i);
+            }
+        }
+        verifyCacheClock = 0UL;
+    }
+
+    verifyCacheClock++;
+    verifyCacheEntries[index].lastUse = verifyCacheClock;
+    verifyCacheEntries[index].check = lCrypto_VerifyCache_Check(&verifyCacheEntries[index], index);
+}
+
+/**
+ * @brief Wipe the table and the key, with the lock held.
+ */
+static void lCrypto_VerifyCache_Wipe(void)
+{
+    verifyCacheFlushPending = false;
+    (void)memset(verifyCacheEntries, 0, sizeof(verifyCacheEntries));
+    (void)memset(&verifyCacheMacCtx, 0, sizeof(verifyCacheMacCtx));
+    verifyCacheCheckKey = 0UL;
+    verifyCacheClock = 0UL;
+    verifyCacheKeyed = false;
+    verifyCacheEpoch++;
+}
+
+/**
+ * @brief Take the lock of the table, and carry out a Flush() that found it
+ *        held.
+ * @return true when the lock is held.
+ */
+static bool lCrypto_VerifyCache_Lock(void)
+{
+    bool locked = (Crypto_Osal_StateLock(CRYPTO_OSAL_STATE_VERIFY_CACHE, CRYPTO_OSAL_ENGINE_TIMEOUT_MS) ==
+                   CRYPTO_OSAL_SUCCESS);
+
+    if (locked && verifyCacheFlushPending)
+    {
+        lCrypto_VerifyCache_Wipe();
+    }
+
+    return locked;
+}
+
+static void lCrypto_VerifyCache_Unlock(void)
+{
+    (void)Crypto_Osal_StateUnlock(CRYPTO_OSAL_STATE_VERIFY_CACHE);
+}
+
+/**
+ * @brief Draw the HMAC key and the check key from the TRNG and free the
+ *        table, on the first call after reset or Flush().
+ * @return true when the cache is keyed.
+ */
+static bool lCrypto_VerifyCache_Key(crypto_HandlerType_E ecdsaHandlerType_en, uint32_t ecdsaSessionId)
+{
+    uint8_t key[CRYPTO_VERIFY_CACHE_TAG_SIZE + 4U] __attribute__((aligned (4)));
+    uint32_t i;
+
+    if (!verifyCacheKeyed)
+    {
+        if ((Crypto_Rng_Generate(ecdsaHandlerType_en, key, sizeof(key), NULL, 0UL,
+                                 ecdsaSessionId) == CRYPTO_RNG_SUCCESS) &&
+            (Crypto_Kdf_Hkdf_Init(&verifyCacheMacCtx, ecdsaHandlerType_en, CRYPTO_HASH_SHA2_256, key,
+                                  CRYPTO_VERIFY_CACHE_TAG_SIZE, ecdsaSessionId) == CRYPTO_KDF_SUCCESS))
+        {
+            (void)memcpy(&verifyCacheCheckKey, &key[CRYPTO_VERIFY_CACHE_TAG_SIZE], sizeof(verifyCacheCheckKey));
+            for (i = 0UL; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++)
+            {
+                lCrypto_VerifyCache_Free(i);
+            }
+            verifyCacheClock = 0UL;
+            verifyCacheKeyed = true;
+        }
+        (void)memset(key, 0, sizeof(key));
+    }
+
+    return verifyCacheKeyed;
+}
+
+/**
+ * @brief Compute the tag of a verification: the SHA-256 of the curve, the
+ *        lengths, the public key, the hash and the signature, then its HMAC.
+ * @return true when the hashes succeed.
+ */
+static bool lCrypto_VerifyCache_Tag(crypto_HandlerType_E ecdsaHandlerType_en, uint32_t ecdsaSessionId,
+                                    crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                    uint8_t *ptr_inputSig, uint32_t sigLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                    uint32_t *ptr_tag)
+{
+    st_Crypto_Hash_Sha_Ctx shaCtx_st;
+    uint32_t header[4];
+    uint8_t digest[CRYPTO_VERIFY_CACHE_TAG_SIZE] __attribute__((aligned (4)));
+    crypto_Hash_Status_E hashStatus;
+    bool ok;
+
+    header[0] = (uint32_t)eccCurveType_En;
+    header[1] = pubKeyLen;
+    header[2] = hashLen;
+    header[3] = sigLen;
+
+    hashStatus = Crypto_Hash_Sha_Init(&shaCtx_st, CRYPTO_HASH_SHA2_256, ecdsaHandlerType_en, ecdsaSessionId);
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, (uint8_t *)header, sizeof(header));
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, ptr_pubKey, pubKeyLen);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, ptr_inputHash, hashLen);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Update(&shaCtx_st, ptr_inputSig, sigLen);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Sha_Final(&shaCtx_st, digest);
+    }
+
+    ok = (hashStatus == CRYPTO_HASH_SUCCESS) &&
+         (Crypto_Kdf_Hkdf_Mac(&verifyCacheMacCtx, digest, sizeof(digest), digest) == CRYPTO_KDF_SUCCESS);
+    if (ok)
+    {
+        (void)memcpy(ptr_tag, digest, sizeof(digest));
+    }
+
+    return ok;
+}
+
+/**
+ * @brief Check every entry, dropping those whose check word fails, and
+ *        find the entry of a tag and the entry to replace.
+ * @param ptr_victim Receives a free entry, else the least recently used.
+ * @return The index of the entry of the tag, CRYPTO_VERIFY_CACHE_ENTRIES
+ *         when it has none.
+ */
+static uint32_t lCrypto_VerifyCache_Find(const uint32_t *ptr_tag, uint32_t *ptr_victim)
+{
+    st_Crypto_VerifyCache_Entry *ptr_entry;
+    uint32_t found = CRYPTO_VERIFY_CACHE_ENTRIES;
+    uint32_t oldest = UINT32_MAX;
+    uint32_t diff;
+    uint32_t i;
+    uint32_t w;
+
+    *ptr_victim = 0UL;
+
+    for (i = 0UL; i < CRYPTO_VERIFY_CACHE_ENTRIES; i++)
+    {
+        ptr_entry = &verifyCacheEntries[i];
+        if (ptr_entry->check != lCrypto_VerifyCache_Check(ptr_entry, i))
+        {
+            verifyCacheStats.corrupt++;
+            lCrypto_VerifyCache_Free(i);
+        }
+
+        if (ptr_entry->lastUse == 0UL)
+        {
+            if (oldest != 0UL)
+            {
+                oldest = 0UL;
+                *ptr_victim = i;
+            }
+        }
+        else
+        {
+            diff = 0UL;
+            for (w = 0UL; w < CRYPTO_VERIFY_CACHE_TAG_WORDS; w++)
+            {
+                diff |= ptr_entry->tag[w] ^ ptr_tag[w];
+            }
+            if (diff == 0UL)
+            {
+                found = i;
+            }
+            if (ptr_entry->lastUse < oldest)
+            {
+                oldest = ptr_entry->lastUse;
+                *ptr_victim = i;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Check that the cache takes a verification: a handler that runs
+ *        it, a valid session, arguments that can be hashed and an ECDSA
+ *        that passed its self-test. Other calls go to Crypto_DigiSign_Ecdsa_Verify() alone,
+ *        which reports the error.
+ */
+static bool lCrypto_VerifyCache_Takes(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                      uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                      uint8_t *ptr_pubKey, uint32_t pubKeyLen, int8_t *ptr_sigVerifyStat,
+                                      uint32_t ecdsaSessionId)
+{
+    bool takes;
+
+    switch(CRYPTO_HANDLER_SELECT(ecdsaHandlerType_en))
+    {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+        case CRYPTO_HANDLER_AUTO:
+#endif
+        case CRYPTO_HANDLER_HW_INTERNAL:
+            takes = true;
+            break;
+        default:
+            takes = false;
+            break;
+    }
+
+    return takes && (ecdsaSessionId > 0UL) && (ecdsaSessionId <= CRYPTO_VERIFY_CACHE_SESSION_MAX) &&
+           (ptr_inputHash != NULL) && (hashLen > 0UL) && (hashLen <= 64UL) &&
+           (ptr_inputSig != NULL) && (sigLen > 0UL) && (sigLen <= (2UL * CRYPTO_ECC_MAX_KEY_LENGTH)) &&
+           (ptr_pubKey != NULL) && (pubKeyLen > 0UL) && (pubKeyLen <= ((2UL * CRYPTO_ECC_MAX_KEY_LENGTH) + 1UL)) &&
+           (ptr_sigVerifyStat != NULL) && CRYPTO_SELFTEST_REQUIRE(DIGISIGN_ECDSA);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_DigiSign_Status_E Crypto_VerifyCache_Ecdsa_Verify(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+                                                         uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                         uint8_t *ptr_pubKey, uint32_t pubKeyLen, int8_t *ptr_sigVerifyStat,
+                                                         crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en;
+    uint32_t tag[CRYPTO_VERIFY_CACHE_TAG_WORDS];
+    uint32_t victim = 0UL;
+    uint32_t found = CRYPTO_VERIFY_CACHE_ENTRIES;
+    uint32_t epoch = 0UL;
+    bool cached = false;
+
+    CRYPTO_TRACE_ENTER(VERIFYCACHE_ECDSA_VERIFY, sigLen);
+
+    // The key, the tag and the lookup under the lock; the PKE runs unlocked.
+    if (lCrypto_VerifyCache_Takes(ecdsaHandlerType_en, ptr_inputHash, hashLen, ptr_inputSig, sigLen,
+                                  ptr_pubKey, pubKeyLen, ptr_sigVerifyStat, ecdsaSessionId) &&
+        lCrypto_VerifyCache_Lock())
+    {
+        cached = lCrypto_VerifyCache_Key(ecdsaHandlerType_en, ecdsaSessionId) &&
+                 lCrypto_VerifyCache_Tag(ecdsaHandlerType_en, ecdsaSessionId, eccCurveType_En, ptr_inputHash, hashLen,
+                                         ptr_inputSig, sigLen, ptr_pubKey, pubKeyLen, tag);
+        if (cached)
+        {
+            epoch = verifyCacheEpoch;
+            found = lCrypto_VerifyCache_Find(tag, &victim);
+        }
+        if (found < CRYPTO_VERIFY_CACHE_ENTRIES)
+        {
+            lCrypto_VerifyCache_Touch(found);
+            verifyCacheStats.hits++;
+        }
+        lCrypto_VerifyCache_Unlock();
+    }
+
+    if (found < CRYPTO_VERIFY_CACHE_ENTRIES)
+    {
+        *ptr_sigVerifyStat = 1;
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    }
+    else
+    {
+        ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Verify(ecdsaHandlerType_en, ptr_inputHash, hashLen, ptr_inputSig,
+                                                        sigLen, ptr_pubKey, pubKeyLen, ptr_sigVerifyStat,
+                                                        eccCurveType_En, ecdsaSessionId);
+
+        if (lCrypto_VerifyCache_Lock())
+        {
+            verifyCacheStats.misses++;
+
+            /* Another task may have stored the tag or flushed the table
+             * while the PKE ran: look again, and drop a tag of an old key. */
+            if (cached && (epoch == verifyCacheEpoch) &&
+                (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS) && (*ptr_sigVerifyStat == 1))
+            {
+                found = lCrypto_VerifyCache_Find(tag, &victim);
+                if (found < CRYPTO_VERIFY_CACHE_ENTRIES)
+                {
+                    victim = found;
+                }
+                else
+                {
+                    if (verifyCacheEntries[victim].lastUse != 0UL)
+                    {
+                        verifyCacheStats.evictions++;
+                    }
+                    (void)memcpy(verifyCacheEntries[victim].tag, tag, sizeof(tag));
+                    verifyCacheStats.inserts++;
+                }
+                lCrypto_VerifyCache_Touch(victim);
+            }
+            lCrypto_VerifyCache_Unlock();
+        }
+    }
+
+    return CRYPTO_TRACE_EXIT(VERIFYCACHE_ECDSA_VERIFY, crypto_DigiSign_Status_E, ret_ecdsaStat_en);
+}
+
+void Crypto_VerifyCache_Flush(void)
+{
+    /* A Flush() from an interrupt that preempted the holder of the lock
+     * leaves the wipe to the next call that takes it, before its lookup. */
+    verifyCacheFlushPending = true;
+    if (Crypto_Osal_StateLock(CRYPTO_OSAL_STATE_VERIFY_CACHE, CRYPTO_OSAL_WAIT_FOREVER) == CRYPTO_OSAL_SUCCESS)
+    {
+        lCrypto_VerifyCache_Wipe();
+        lCrypto_VerifyCache_Unlock();
+    }
+}
+
+void Crypto_VerifyCache_GetStats(st_Crypto_VerifyCache_Stats *ptr_stats)
+{
+    bool locked;
+
+    if (ptr_stats != NULL)
+    {
+        locked = (Crypto_Osal_StateLock(CRYPTO_OSAL_STATE_VERIFY_CACHE, CRYPTO_OSAL_WAIT_FOREVER) ==
+                  CRYPTO_OSAL_SUCCESS);
+        *ptr_stats = verifyCacheStats;
+        if (locked)
+        {
+            lCrypto_VerifyCache_Unlock();
+        }
+    }
+}
+
+#endif /* CRYPTO_CONFIG_VERIFY_CACHE == 1 */
@@ -0,0 +1,65 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    cam_version.h
+
+  Summary:
+    CAM Hardware Driver Version.
+
+  Description:
+    This header file contains version information on the CAM Hardware Driver.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+ #ifndef CAM_VERSION_H
+ #define CAM_VERSION_H
+
+ /**
+ * @brief Version date format (yyyymmdd).
+ **/
+ #define CAM_LIBRARY_VERSION_DATE   "20251014"
+
+/**
+ * @brief This number represents the Major version in SemVer format.
+ **/
+ #define CAM_LIBRARY_VERSION_MAJOR  1
+
+/**
+ * @brief This number represents the Minor version in SemVer format.
+ **/
+ #define CAM_LIBRARY_VERSION_MINOR  2
+
+ /**
+ * @brief This number represents the Patch version in SemVer format.
+ **/
+ #define CAM_LIBRARY_VERSION_PATCH  0
+
+ #endif /* CAM_VERSION_H */
\ No newline at end of file
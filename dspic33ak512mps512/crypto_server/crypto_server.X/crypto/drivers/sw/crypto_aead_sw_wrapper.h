@@ -0,0 +1,127 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_aead_sw_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES-GCM.
+
+  Description:
+    This header file contains the software implementation of AES-GCM used
+    by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_AEAD_SW_WRAPPER_H
+#define CRYPTO_AEAD_SW_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/drivers/sw/crypto_sw_aes.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+  CRYPTO_SW_AES_KEY key;
+  CRYPTO_SW_AES_CTR ctr;
+  CRYPTO_SW_GHASH ghash;
+
+  // E(K, J0), XORed into the GHASH output to form the tag.
+  uint8_t tagMask[CRYPTO_SW_AES_BLOCK_SIZE];
+
+  uint64_t aadLen;
+  uint64_t dataLen;
+  crypto_CipherOper_E operation;
+
+  // Set by the first Cipher call, after which no more AAD is taken.
+  bool cipherStarted;
+
+} CRYPTO_AEAD_SW_CONTEXT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: AEAD Algorithms Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Init(void *aeadInitCtx,
+    crypto_CipherOper_E cipherOper_en, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen);
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_AddAadData(void *aeadCipherCtx,
+      uint8_t *aad, uint32_t aadLen);
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Cipher(void *aeadCipherCtx,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData);
+
+// Writes the computed tag for both operations, as the hardware handler does.
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Final(void *aeadCipherCtx,
+      uint8_t *authTag, uint32_t authTagLen);
+
+// With a NULL workspace the context is kept on the stack.
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_EncryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace);
+
+// Compares the tag in constant time; the output is cleared on CRYPTO_AEAD_ERROR_AUTHFAIL.
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_AEAD_SW_WRAPPER_H */
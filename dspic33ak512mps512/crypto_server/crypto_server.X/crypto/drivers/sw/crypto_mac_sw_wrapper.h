@@ -0,0 +1,113 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_sw_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES-CMAC.
+
+  Description:
+    This header file contains the software implementation of AES-CMAC used
+    by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_MAC_SW_WRAPPER_H
+#define CRYPTO_MAC_SW_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/drivers/sw/crypto_sw_aes.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef struct
+{
+  CRYPTO_SW_AES_KEY key;
+
+  // Subkeys for a complete (k1) and a padded (k2) last block.
+  uint8_t k1[CRYPTO_SW_AES_BLOCK_SIZE];
+  uint8_t k2[CRYPTO_SW_AES_BLOCK_SIZE];
+
+  // CBC-MAC chaining value.
+  uint8_t state[CRYPTO_SW_AES_BLOCK_SIZE];
+
+  // Last block, held back until Final as it gets a subkey.
+  uint8_t block[CRYPTO_SW_AES_BLOCK_SIZE];
+  uint32_t blockLen;
+
+  bool initialized;
+
+} CRYPTO_CMAC_SW_CONTEXT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MAC Algorithms Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Init(void *contextData, uint8_t *key, uint32_t keyLen);
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Cipher(void *contextData, uint8_t *inputData, uint32_t dataLen);
+
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Final(void *contextData, uint8_t *outputMac, uint32_t macLen);
+
+// With a NULL workspace the context is kept on the stack.
+crypto_Mac_Status_E Crypto_Sym_Sw_Cmac_Direct(uint8_t *ptr_inputData, uint32_t dataLen,
+                                              uint8_t *ptr_outMac, uint32_t macLen,
+                                              uint8_t *ptr_key, uint32_t keyLen, void *workspace);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_MAC_SW_WRAPPER_H */
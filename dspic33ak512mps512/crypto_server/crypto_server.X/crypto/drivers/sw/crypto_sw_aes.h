@@ -0,0 +1,149 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_sw_aes.h
+
+  Summary:
+    Crypto Framework Library software AES block cipher.
+
+  Description:
+    This header file contains the AES block cipher, counter mode and GHASH
+    used by the software handler (CRYPTO_HANDLER_SW_INTERNAL). The cipher is
+    bitsliced and GHASH is computed bit by bit with masks: neither uses
+    lookup tables or branches on secret data, so their timing does not
+    depend on the key or the data.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SW_AES_H
+#define CRYPTO_SW_AES_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_SW_AES_BLOCK_SIZE    (16UL)
+#define CRYPTO_SW_AES_MAX_ROUNDS    (14UL)
+
+typedef struct
+{
+  // Round keys in bitsliced form, four words per round.
+  uint32_t roundKey[(CRYPTO_SW_AES_MAX_ROUNDS + 1UL) * 4UL];
+  uint32_t rounds;
+
+} CRYPTO_SW_AES_KEY;
+
+// Keystream state of counter mode, kept between calls.
+typedef struct
+{
+  uint8_t counter[CRYPTO_SW_AES_BLOCK_SIZE];
+  uint8_t keystream[CRYPTO_SW_AES_BLOCK_SIZE];
+  // Keystream bytes already used, 0 to 16.
+  uint32_t used;
+  // Trailing counter bytes incremented per block: 16 for CTR, 4 for GCM.
+  uint32_t counterBytes;
+
+} CRYPTO_SW_AES_CTR;
+
+// GHASH state, with a partial block kept between calls.
+typedef struct
+{
+  uint32_t h[4];
+  uint32_t y[4];
+  uint8_t block[CRYPTO_SW_AES_BLOCK_SIZE];
+  uint32_t blockLen;
+
+} CRYPTO_SW_GHASH;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Software AES Interface
+// *****************************************************************************
+// *****************************************************************************
+
+// Expand a 16, 24 or 32 byte key; returns false for another length.
+bool Crypto_Sw_Aes_SetKey(CRYPTO_SW_AES_KEY *aesKey, const uint8_t *key, uint32_t keyLen);
+
+// Encrypt or decrypt whole blocks; in and out may be the same buffer.
+void Crypto_Sw_Aes_Encrypt(const CRYPTO_SW_AES_KEY *aesKey, const uint8_t *in, uint8_t *out, uint32_t blocks);
+void Crypto_Sw_Aes_Decrypt(const CRYPTO_SW_AES_KEY *aesKey, const uint8_t *in, uint8_t *out, uint32_t blocks);
+
+// Start counter mode at the counter block initCounter.
+void Crypto_Sw_Aes_CtrInit(CRYPTO_SW_AES_CTR *ctr, const uint8_t *initCounter, uint32_t counterBytes);
+
+// XOR dataLen bytes of keystream into in; continues where the last call stopped.
+void Crypto_Sw_Aes_Ctr(const CRYPTO_SW_AES_KEY *aesKey, CRYPTO_SW_AES_CTR *ctr,
+    const uint8_t *in, uint8_t *out, uint32_t dataLen);
+
+// Start GHASH with the hash key H = E(K, 0^128).
+void Crypto_Sw_Ghash_Init(CRYPTO_SW_GHASH *ghash, const CRYPTO_SW_AES_KEY *aesKey);
+
+// Absorb data; Crypto_Sw_Ghash_Pad() zero-pads a partial block, as between the AAD and the ciphertext.
+void Crypto_Sw_Ghash_Update(CRYPTO_SW_GHASH *ghash, const uint8_t *data, uint32_t dataLen);
+void Crypto_Sw_Ghash_Pad(CRYPTO_SW_GHASH *ghash);
+
+// Pad, absorb the bit lengths of the AAD and ciphertext and write the 16-byte hash.
+void Crypto_Sw_Ghash_Final(CRYPTO_SW_GHASH *ghash, uint64_t aadLen, uint64_t dataLen, uint8_t *out);
+
+// Zero memory in a way the compiler cannot remove.
+void Crypto_Sw_Wipe(void *ptr, uint32_t len);
+
+// Compare in constant time; returns 0 when equal.
+uint32_t Crypto_Sw_Compare(const uint8_t *a, const uint8_t *b, uint32_t len);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_SW_AES_H */
@@ -0,0 +1,305 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_aead_sw_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for software AES-GCM.
+
+  Description:
+    This source file contains the software implementation of AES-GCM used
+    by the software handler (CRYPTO_HANDLER_SW_INTERNAL).
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/common_crypto/crypto_config.h"
+#include "crypto/drivers/sw/crypto_aead_sw_wrapper.h"
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1) && (CRYPTO_CONFIG_AEAD_AESGCM == 1)
+
+// Length of the IV used directly as the first 96 bits of J0.
+#define CRYPTO_AEAD_SW_GCM_IV_SIZE  (12UL)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Common AES-GCM direct function on a given context.
+ * @param aeadCtx The context.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @param initVectLen Length of the initialization vector.
+ * @param aad Pointer to the additional authentication data.
+ * @param aadLen Length of the AAD.
+ * @param authTag Pointer to a buffer to hold the authentication tag.
+ * @param authTagLen Length of the authentication tag.
+ * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Aead_Status_E lCrypto_Aead_Sw_AesGcm_Direct(CRYPTO_AEAD_SW_CONTEXT *aeadCtx,
+    crypto_CipherOper_E operation, uint8_t *inputData, uint32_t dataLen, uint8_t *outData,
+    uint8_t *key, uint32_t keyLen, uint8_t *initVect, uint32_t initVectLen,
+    uint8_t *aad, uint32_t aadLen, uint8_t *authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E result = Crypto_Aead_Sw_AesGcm_Init(aeadCtx, operation, key, keyLen, initVect, initVectLen);
+
+    if ((result == CRYPTO_AEAD_CIPHER_SUCCESS) && (aadLen > 0UL))
+    {
+        result = Crypto_Aead_Sw_AesGcm_AddAadData(aeadCtx, aad, aadLen);
+    }
+
+    if ((result == CRYPTO_AEAD_CIPHER_SUCCESS) && (dataLen > 0UL))
+    {
+        result = Crypto_Aead_Sw_AesGcm_Cipher(aeadCtx, inputData, dataLen, outData);
+    }
+
+    if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        result = Crypto_Aead_Sw_AesGcm_Final(aeadCtx, authTag, authTagLen);
+    }
+
+    Crypto_Sw_Wipe(aeadCtx, (uint32_t)sizeof(CRYPTO_AEAD_SW_CONTEXT));
+
+    return result;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: AEAD Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Init(void *aeadInitCtx,
+    crypto_CipherOper_E cipherOper_en, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *aeadCtx = (CRYPTO_AEAD_SW_CONTEXT*) aeadInitCtx;
+    crypto_Aead_Status_E result = CRYPTO_AEAD_CIPHER_SUCCESS;
+    uint8_t j0[CRYPTO_SW_AES_BLOCK_SIZE] = { 0U };
+
+    (void)memset(aeadCtx, 0, sizeof(CRYPTO_AEAD_SW_CONTEXT));
+
+    if ((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        result = CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    else if ((initVect == NULL) || (initVectLen == 0UL))
+    {
+        result = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if (!Crypto_Sw_Aes_SetKey(&aeadCtx->key, key, keyLen))
+    {
+        result = CRYPTO_AEAD_ERROR_KEY;
+    }
+    else
+    {
+        Crypto_Sw_Ghash_Init(&aeadCtx->ghash, &aeadCtx->key);
+
+        if (initVectLen == CRYPTO_AEAD_SW_GCM_IV_SIZE)
+        {
+            // J0 = IV || 0^31 || 1
+            (void)memcpy(j0, initVect, CRYPTO_AEAD_SW_GCM_IV_SIZE);
+            j0[CRYPTO_SW_AES_BLOCK_SIZE - 1UL] = 1U;
+        }
+        else
+        {
+            // J0 = GHASH(IV || 0^(s+64) || [len(IV)]64), on the context's GHASH before it takes AAD.
+            Crypto_Sw_Ghash_Update(&aeadCtx->ghash, initVect, initVectLen);
+            Crypto_Sw_Ghash_Final(&aeadCtx->ghash, 0U, initVectLen, j0);
+            Crypto_Sw_Ghash_Init(&aeadCtx->ghash, &aeadCtx->key);
+        }
+
+        /* The first keystream block, E(K, J0), masks the tag; the data starts
+         * at inc32(J0). */
+        Crypto_Sw_Aes_CtrInit(&aeadCtx->ctr, j0, 4UL);
+        Crypto_Sw_Aes_Ctr(&aeadCtx->key, &aeadCtx->ctr, aeadCtx->tagMask, aeadCtx->tagMask, CRYPTO_SW_AES_BLOCK_SIZE);
+
+        aeadCtx->operation = cipherOper_en;
+    }
+
+    Crypto_Sw_Wipe(j0, (uint32_t)sizeof(j0));
+
+    return result;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_AddAadData(void *aeadCipherCtx,
+      uint8_t *aad, uint32_t aadLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *aeadCtx = (CRYPTO_AEAD_SW_CONTEXT*) aeadCipherCtx;
+    crypto_Aead_Status_E result = CRYPTO_AEAD_CIPHER_SUCCESS;
+
+    if (aeadCtx->operation == CRYPTO_CIOP_INVALID)
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else if (aeadCtx->cipherStarted)
+    {
+        result = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else
+    {
+        Crypto_Sw_Ghash_Update(&aeadCtx->ghash, aad, aadLen);
+        aeadCtx->aadLen += aadLen;
+    }
+
+    return result;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Cipher(void *aeadCipherCtx,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *aeadCtx = (CRYPTO_AEAD_SW_CONTEXT*) aeadCipherCtx;
+    crypto_Aead_Status_E result = CRYPTO_AEAD_CIPHER_SUCCESS;
+
+    if (aeadCtx->operation == CRYPTO_CIOP_INVALID)
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else
+    {
+        if (!aeadCtx->cipherStarted)
+        {
+            // The AAD is zero-padded to a block before the ciphertext.
+            Crypto_Sw_Ghash_Pad(&aeadCtx->ghash);
+            aeadCtx->cipherStarted = true;
+        }
+
+        // GHASH always covers the ciphertext; hashing the input first allows in-place decryption.
+        if (aeadCtx->operation == CRYPTO_CIOP_DECRYPT)
+        {
+            Crypto_Sw_Ghash_Update(&aeadCtx->ghash, inputData, dataLen);
+            Crypto_Sw_Aes_Ctr(&aeadCtx->key, &aeadCtx->ctr, inputData, outData, dataLen);
+        }
+        else
+        {
+            Crypto_Sw_Aes_Ctr(&aeadCtx->key, &aeadCtx->ctr, inputData, outData, dataLen);
+            Crypto_Sw_Ghash_Update(&aeadCtx->ghash, outData, dataLen);
+        }
+
+        aeadCtx->dataLen += dataLen;
+    }
+
+    return result;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_Final(void *aeadFinalCtx,
+      uint8_t *authTag, uint32_t authTagLen)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *aeadCtx = (CRYPTO_AEAD_SW_CONTEXT*) aeadFinalCtx;
+    crypto_Aead_Status_E result = CRYPTO_AEAD_CIPHER_SUCCESS;
+    uint8_t tag[CRYPTO_SW_AES_BLOCK_SIZE];
+    uint32_t i;
+
+    if (aeadCtx->operation == CRYPTO_CIOP_INVALID)
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else if ((authTagLen == 0UL) || (authTagLen > CRYPTO_SW_AES_BLOCK_SIZE))
+    {
+        result = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else
+    {
+        Crypto_Sw_Ghash_Final(&aeadCtx->ghash, aeadCtx->aadLen, aeadCtx->dataLen, tag);
+        for (i = 0UL; i < authTagLen; i++)
+        {
+            authTag[i] = tag[i] ^ aeadCtx->tagMask[i];
+        }
+
+        Crypto_Sw_Wipe(tag, (uint32_t)sizeof(tag));
+        Crypto_Sw_Wipe(aeadCtx, (uint32_t)sizeof(CRYPTO_AEAD_SW_CONTEXT));
+    }
+
+    return result;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_EncryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    CRYPTO_AEAD_SW_CONTEXT aeadCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *ptr_aeadCtx = (workspace != NULL) ? (CRYPTO_AEAD_SW_CONTEXT*) workspace : &aeadCtx;
+
+    return lCrypto_Aead_Sw_AesGcm_Direct(ptr_aeadCtx, CRYPTO_CIOP_ENCRYPT, inputData, dataLen, outData,
+        key, keyLen, initVect, initVectLen, aad, aadLen, authTag, authTagLen);
+}
+
+crypto_Aead_Status_E Crypto_Aead_Sw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    CRYPTO_AEAD_SW_CONTEXT aeadCtx;
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_SW_CONTEXT *ptr_aeadCtx = (workspace != NULL) ? (CRYPTO_AEAD_SW_CONTEXT*) workspace : &aeadCtx;
+    uint8_t generatedAuthTag[CRYPTO_SW_AES_BLOCK_SIZE];
+    crypto_Aead_Status_E result;
+
+    result = lCrypto_Aead_Sw_AesGcm_Direct(ptr_aeadCtx, CRYPTO_CIOP_DECRYPT, inputData, dataLen, outData,
+        key, keyLen, initVect, initVectLen, aad, aadLen, generatedAuthTag, authTagLen);
+
+    if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        // The tag must be verified against what was calculated.
+        if (0UL != Crypto_Sw_Compare(generatedAuthTag, authTag, authTagLen))
+        {
+            Crypto_Sw_Wipe(outData, dataLen);
+            result = CRYPTO_AEAD_ERROR_AUTHFAIL;
+        }
+    }
+
+    Crypto_Sw_Wipe(generatedAuthTag, (uint32_t)sizeof(generatedAuthTag));
+
+    return result;
+}
+
+#endif /* CRYPTO_CONFIG_SW_HANDLER == 1 */
@@ -0,0 +1,116 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digisign_cam05346_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for the digital signature in the 
+    hardware cryptographic library.
+
+  Description:
+    This header file contains the wrapper interface to access the hardware 
+    cryptographic library in Microchip microcontrollers for digital signature.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_DIGISIGN_CAM05346_WRAPPER_H
+#define CRYPTO_DIGISIGN_CAM05346_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DigSign Common Interface 
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Sign(uint8_t *inputHash, 
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey, 
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash, 
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey, 
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus, 
+    crypto_EccCurveType_E eccCurveType_En);
+
+// As the functions above, with the PKE_CONFIG in a caller workspace.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, void *workspace);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus,
+    crypto_EccCurveType_E eccCurveType_En, void *workspace);
+
+/* Writes the digest of a streamed message to ptr_digest for the *Stream()
+ * functions below; returns false when the hash fails. */
+typedef bool (*crypto_DigiSign_Ecdsa_Hw_DigestFn)(void *ptr_arg, uint8_t *ptr_digest);
+
+/* As Crypto_DigiSign_Ecdsa_Hw_Sign() and _Verify(), with inputHash written
+ * by digestFn(digestArg, inputHash) once the PKE engine is held and the curve
+ * and the PKE_CONFIG are set up, so the digest goes to the PKE as it comes
+ * out of the hash engine. Return CRYPTO_DIGISIGN_ERROR_INPUTHASH when
+ * digestFn fails. */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En);
+
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_DIGISIGN_CAM05346_WRAPPER_H */
@@ -0,0 +1,665 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_aead_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for CAM hardware AES.
+
+  Description:
+    This source file contains the wrapper interface to access the AEAD
+    algorithms in the CAM AES hardware driver for Microchip microcontrollers.
+**************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_aead_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_aes.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_AEAD_AESGCM == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Initialize the CAM library's AES interrupt handler.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
+ */
+static crypto_Int_Status_E lCrypto_Aead_Hw_Aes_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the SHA engine, which the caller holds as
+         * well, so the vector is taken over from the SHA handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lCrypto_Aead_Hw_Aes_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lCrypto_Aead_Hw_Aes_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
+}
+
+/**
+ * @brief Determine the AES operation type to pass to the CAM library.
+ * @param cipherOpType Crypto operation type.
+ * @param operation Pointer to a value to hold the equivalent CAM library operation type.
+ * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, CRYPTO_AEAD_ERROR_CIPOPER on failure.
+ */
+static crypto_Aead_Status_E lCrypto_Aead_Hw_Aes_GetOperation
+    (crypto_CipherOper_E cipherOpType, AESCON_OPERATION* operation)
+{
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPOPER;
+
+    switch (cipherOpType)
+    {
+        case CRYPTO_CIOP_ENCRYPT:
+            *operation = OP_ENCRYPT;
+            status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            break;
+        case CRYPTO_CIOP_DECRYPT:
+            *operation = OP_DECRYPT;
+            status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            break;
+        default:
+            status = CRYPTO_AEAD_ERROR_CIPOPER;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Calculate the number of pad bytes for an AES block.
+ * @param dataLen Size of the data.
+ * @return Number of pad bytes to complete the AES block.
+ */
+static uint32_t lCrypto_Aead_Hw_Aes_GetPadBytes(uint32_t dataLen)
+{
+    uint32_t mask = (AES_BLOCK_SIZE - 1UL);
+    uint32_t pad = ((dataLen + mask) & ~mask) - dataLen;
+
+    return pad;
+}
+
+/**
+ * @brief Direct byte-compare function.
+ * @param cmp1 Pointer to first byte stream.
+ * @param cmp2 Pointer to second byte stream.
+ * @param cmpLen Number of bytes to compare.
+ * @return 0 on success, 1 on failure.
+ */
+static uint32_t lCrypto_Aead_Hw_CompareAsBytes(uint8_t *cmp1, uint8_t *cmp2, uint32_t cmpLen)
+{
+    register uint8_t* c1 = cmp1;
+    register uint8_t* c2 = cmp2;
+    register int32_t len = (int32_t)cmpLen;
+    uint32_t result = 0UL;
+
+    while (len > 0L)
+    {
+        if (*c1 != *c2)
+        {
+            result = 1UL;
+            break;
+        }
+        else
+        {
+            len--;
+            c1++;
+            c2++;
+        }
+    }
+    return result;
+}
+/**
+ * @brief Common AES-GCM direct-cipher function on a given context.
+ * @param aesContext The cleared CAM library context data.
+ * @param mode The cipher mode.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @param initVectLen Length of the initialization vector.
+ * @param aad Pointer to the additional authentication data.
+ * @param aadLen Length of the AAD.
+ * @param authTag Pointer to a buffer to hold the authentication tag.
+ * @param authTagLen Length of the authentication tag.
+ * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_DirectCtx(uint8_t *aesContext,
+    AESCON_MODE mode, AESCON_OPERATION operation,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    AES_ERROR aesStatus = DRV_CRYPTO_AES_Initialize(aesContext, mode, operation, key, keyLen, initVect, initVectLen);
+    if (aesStatus == AES_NO_ERROR)
+    {
+        if (aadLen > 0UL)
+        {
+            aesStatus = DRV_CRYPTO_AES_AddHeader(aesContext, aad, aadLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                /* AES-GCM hardware includes the authentication data in its output.  This data needs to be
+                 * discarded from the output stream.  The data is padded to a block size. */
+                uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(aadLen);
+                aesStatus = DRV_CRYPTO_AES_DiscardData(aesContext, (aadLen + pad));
+            }
+        }
+    }
+    if(aesStatus == AES_NO_ERROR)
+    {
+        /* AES GCM cipher/decipher accepts the actual number of bytes, and the library will
+         * automatically pad to a block size and configure the descriptor to ignore the pad bytes.*/
+        aesStatus = DRV_CRYPTO_AES_AddInputData(aesContext, inputData, dataLen);
+        if(aesStatus == AES_NO_ERROR)
+        {
+            aesStatus = DRV_CRYPTO_AES_AddOutputData(aesContext, outData, dataLen);
+        }
+        if((aesStatus == AES_NO_ERROR) && (dataLen > 0UL))
+        {
+            /* AES-GCM hardware operates on block size boundaries.  When data size is not aligned to
+             * a block size boundary, the excess must be discarded from the output stream.
+             * When data is not specified, this is skipped. */
+            uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(dataLen);
+            aesStatus = DRV_CRYPTO_AES_DiscardData(aesContext, pad);
+        }
+    }
+    if(aesStatus == AES_NO_ERROR)
+    {
+        aesStatus = DRV_CRYPTO_AES_AddOutputData(aesContext, authTag, authTagLen);
+        if(aesStatus == AES_NO_ERROR)
+        {
+            aesStatus = DRV_CRYPTO_AES_AddLenALenC(aesContext);
+        }
+        if(aesStatus == AES_NO_ERROR)
+        {
+            aesStatus = DRV_CRYPTO_AES_Execute(aesContext);
+        }
+    }
+    if (aesStatus == AES_NO_ERROR)
+    {
+        result = CRYPTO_AEAD_CIPHER_SUCCESS;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Common AES-GCM direct-cipher function; the context is taken from
+ *        the stack, or from the CRYPTO_POOL_AEAD_HW pool when it has blocks.
+ * @param mode The cipher mode.
+ * @param operation The operation type.
+ * @param inputData Pointer to input data.
+ * @param dataLen Length of the input/output data.
+ * @param outData Pointer to a buffer to hold the output data.
+ * @param key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @param initVect Pointer to the initialization vector data.
+ * @param initVectLen Length of the initialization vector.
+ * @param aad Pointer to the additional authentication data.
+ * @param aadLen Length of the AAD.
+ * @param authTag Pointer to a buffer to hold the authentication tag.
+ * @param authTagLen Length of the authentication tag.
+ * @return CRYPTO_AEAD_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Aead_Status_E lCrypto_Aead_Hw_AesGcm_Direct(AESCON_MODE mode, AESCON_OPERATION operation,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E result = CRYPTO_AEAD_ERROR_CIPFAIL;
+#if (CRYPTO_POOL_AEAD_HW_COUNT > 0U)
+    // Pool blocks are zeroed when acquired.
+    CRYPTO_AEAD_HW_CONTEXT *ptr_aeadCtx = (CRYPTO_AEAD_HW_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_AEAD_HW);
+
+    if (ptr_aeadCtx != NULL)
+    {
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(ptr_aeadCtx->contextData, mode, operation, inputData, dataLen, outData,
+            key, keyLen, initVect, initVectLen, aad, aadLen, authTag, authTagLen);
+        (void)Crypto_Pool_Release(CRYPTO_POOL_AEAD_HW, ptr_aeadCtx);
+    }
+#else
+    CRYPTO_AEAD_HW_CONTEXT aeadCtx;
+
+    // Context data must be cleared.
+    (void)memset(aeadCtx.contextData, 0, sizeof(aeadCtx.contextData));
+    result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx.contextData, mode, operation, inputData, dataLen, outData,
+        key, keyLen, initVect, initVectLen, aad, aadLen, authTag, authTagLen);
+#endif
+
+    return result;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: AEAD Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Init(void *aeadInitCtx,
+    crypto_CipherOper_E cipherOper_en, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the AEAD context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) aeadInitCtx;
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    AES_ERROR aesStatus = AES_INITIALIZE_ERROR;
+
+    AESCON_MODE mode = MODE_GCM;
+    AESCON_OPERATION operation;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        status = lCrypto_Aead_Hw_Aes_GetOperation(cipherOper_en, &operation);
+
+        if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            // Context data must be cleared as the context may be on a stack versus static memory.
+            (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+
+            aesStatus = DRV_CRYPTO_AES_Initialize(aeadCtx, mode, operation, key, keyLen, initVect, initVectLen);
+        }
+
+        if(aesStatus != AES_NO_ERROR)
+        {
+            status = CRYPTO_AEAD_ERROR_CIPFAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_INIT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, 0UL, status));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_AddAadData(void *aeadCipherCtx,
+    uint8_t *aad, uint32_t aadLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the AEAD context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) aeadCipherCtx;
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    AES_ERROR aesStatus;
+    AES_ERROR aesActive;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ADDAADDATA, aadLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+        {
+            if (aadLen > 0UL)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddHeader(aeadCtx->contextData, aad, aadLen);
+                if(aesStatus == AES_NO_ERROR)
+                {
+                    /* AES-GCM hardware includes the authentication data in its output.  This data needs to be
+                     * discarded from the output stream.  The data is padded to a block size. */
+                    uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(aadLen);
+
+                    aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, (aadLen + pad));
+                }
+
+                if(aesStatus == AES_NO_ERROR)
+                {
+                    status = CRYPTO_AEAD_CIPHER_SUCCESS;
+                }
+            }
+            else
+            {
+                // Empty AAD data is allowed.
+                status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
+    }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ADDAADDATA, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, aadLen, status));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Cipher(void *aeadCipherCtx,
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the AEAD context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) aeadCipherCtx;
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    AES_ERROR aesStatus;
+    AES_ERROR aesActive;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_CIPHER, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+        {
+            /* AES GCM cipher/decipher accepts the actual number of bytes, and the library will
+             * automatically pad to a block size and configure the descriptor to ignore the pad bytes.*/
+            aesStatus = DRV_CRYPTO_AES_AddInputData(aeadCtx->contextData, inputData, dataLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, outData, dataLen);
+            }
+
+            if((aesStatus == AES_NO_ERROR) && (dataLen > 0UL))
+            {
+                /* AES-GCM hardware operates on block size boundaries.  When data size is not aligned to
+                 * a block size boundary, the excess must be discarded from the output stream.
+                 * When data is not specified, this is skipped. */
+                uint32_t pad = lCrypto_Aead_Hw_Aes_GetPadBytes(dataLen);
+
+                aesStatus = DRV_CRYPTO_AES_DiscardData(aeadCtx->contextData, pad);
+            }
+
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_CIPHER, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, status));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_Final(void *aeadFinalCtx,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the AEAD context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) aeadFinalCtx;
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    AES_ERROR aesStatus;
+    AES_ERROR aesActive;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_FINAL, 0UL);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(aeadCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+        {
+            aesStatus = DRV_CRYPTO_AES_AddOutputData(aeadCtx->contextData, authTag, authTagLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_AddLenALenC(aeadCtx->contextData);
+            }
+
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_Execute(aeadCtx->contextData);
+            }
+
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_FINAL, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, 0UL, status));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_ENCRYPT,
+                                                                    inputData, dataLen, outData,
+                                                                    key, keyLen, initVect, initVectLen,
+
+
+                                                                    aad, aadLen, authTag, authTagLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen)
+{
+
+
+
+        uint8_t generatedAuthTag[AES_GCM_AUTHTAG_SIZE];
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_DECRYPTAUTHDIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        result = lCrypto_Aead_Hw_AesGcm_Direct(MODE_GCM, OP_DECRYPT,
+                                                                    inputData, dataLen, outData,
+                                                                    key, keyLen, initVect, initVectLen,
+                                                                    aad, aadLen, generatedAuthTag, authTagLen);
+
+            if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
+            {
+                // The tag must be verified against what was calculated.
+                if (0UL != lCrypto_Aead_Hw_CompareAsBytes(generatedAuthTag, authTag, authTagLen))
+                {
+                    result = CRYPTO_AEAD_ERROR_AUTHFAIL;
+                }
+            }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_DECRYPTAUTHDIRECT, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_EncryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) workspace;
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx->contextData, MODE_GCM, OP_ENCRYPT,
+                                                    inputData, dataLen, outData,
+                                                    key, keyLen, initVect, initVectLen,
+                                                    aad, aadLen, authTag, authTagLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_ENCRYPTAUTHDIRECTEX, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirectEx(uint8_t *inputData,
+    uint32_t dataLen, uint8_t *outData, uint8_t *key, uint32_t keyLen,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *authTag, uint32_t authTagLen, void *workspace)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_AEAD_HW_CONTEXT *aeadCtx = (CRYPTO_AEAD_HW_CONTEXT*) workspace;
+    uint8_t generatedAuthTag[AES_GCM_AUTHTAG_SIZE];
+    crypto_Aead_Status_E result;
+
+    CRYPTO_TRACE_ENTER(AEAD_HW_AESGCM_DECRYPTAUTHDIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(AEAD_AESGCM);
+
+    if (lCrypto_Aead_Hw_Aes_EngineAcquire())
+    {
+        (void)memset(aeadCtx->contextData, 0, sizeof(aeadCtx->contextData));
+        result = lCrypto_Aead_Hw_AesGcm_DirectCtx(aeadCtx->contextData, MODE_GCM, OP_DECRYPT,
+                                                    inputData, dataLen, outData,
+                                                    key, keyLen, initVect, initVectLen,
+                                                    aad, aadLen, generatedAuthTag, authTagLen);
+
+        if (result == CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            // The tag must be verified against what was calculated.
+            if (0UL != lCrypto_Aead_Hw_CompareAsBytes(generatedAuthTag, authTag, authTagLen))
+            {
+                result = CRYPTO_AEAD_ERROR_AUTHFAIL;
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        result = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(AEAD_HW_AESGCM_DECRYPTAUTHDIRECTEX, crypto_Aead_Status_E, CRYPTO_STATS_END(AEAD_AESGCM, crypto_Aead_Status_E, dataLen, result));
+}
+
+#endif /* CRYPTO_CONFIG_AEAD_AESGCM == 1 */
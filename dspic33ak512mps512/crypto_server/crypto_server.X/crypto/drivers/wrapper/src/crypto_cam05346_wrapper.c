@@ -0,0 +1,290 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for common CAM hardware management.
+
+  Description:
+    This source file contains the wrapper interface to manage common CAM hardware
+    interactions for Microchip microcontrollers.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stddef.h>
+#include <xc.h>
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_INT_HANDLER_COUNT (CRYPTO3_INT + 1)
+struct crypto_Int_Handlers {
+    crypto_Int_Handler handlers[CRYPTO_INT_HANDLER_COUNT];
+    crypto_Int_Completion completions[CRYPTO_INT_HANDLER_COUNT];
+    void *contexts[CRYPTO_INT_HANDLER_COUNT];
+};
+static struct crypto_Int_Handlers cryptoIntHandlers = {{NULL}, {NULL}, {NULL}};
+
+void __attribute__((interrupt)) _CRYPTO1Interrupt(void);
+void __attribute__((interrupt)) _CRYPTO2Interrupt(void);
+void __attribute__((interrupt)) _CRYPTO3Interrupt(void);
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+void __attribute__((interrupt)) _CRYPTO1Interrupt(void)
+{
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO1, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO1_INT);
+
+    if (cryptoIntHandlers.handlers[CRYPTO1_INT] != NULL)
+    {
+        cryptoIntHandlers.handlers[CRYPTO1_INT]();
+    }
+
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_SYM);
+
+    if (cryptoIntHandlers.completions[CRYPTO1_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO1_INT](cryptoIntHandlers.contexts[CRYPTO1_INT]);
+    }
+
+    _CRYPT1IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO1);
+}
+
+void __attribute__((interrupt)) _CRYPTO2Interrupt(void)
+{
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO2, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO2_INT);
+
+    if (cryptoIntHandlers.handlers[CRYPTO2_INT] != NULL)
+    {
+        cryptoIntHandlers.handlers[CRYPTO2_INT]();
+    }
+
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_TRNG);
+
+    if (cryptoIntHandlers.completions[CRYPTO2_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO2_INT](cryptoIntHandlers.contexts[CRYPTO2_INT]);
+    }
+
+    _CRYPT2IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO2);
+}
+
+void __attribute__((interrupt)) _CRYPTO3Interrupt(void)
+{
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO3, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO3_INT);
+
+    if (cryptoIntHandlers.handlers[CRYPTO3_INT] != NULL)
+    {
+        cryptoIntHandlers.handlers[CRYPTO3_INT]();
+    }
+
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_PKE);
+
+    if (cryptoIntHandlers.completions[CRYPTO3_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO3_INT](cryptoIntHandlers.contexts[CRYPTO3_INT]);
+    }
+
+    _CRYPT3IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO3);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interrupts Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Int_Status_E Crypto_Int_Hw_Register_Handler(crypto_Int_Handler_Id handlerID, crypto_Int_Handler handler)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+
+    CRYPTO_TRACE_ENTER(INT_HW_REGISTER_HANDLER, 0UL);
+
+    if ((handlerID < CRYPTO1_INT) || (handlerID > CRYPTO3_INT))
+    {
+        status = CRYPTO_INT_INVALID_ID;
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        // Registering the handler already in place succeeds.
+        if ((handler != NULL) && (cryptoIntHandlers.handlers[handlerID] != NULL) &&
+            (cryptoIntHandlers.handlers[handlerID] != handler))
+        {
+            status = CRYPTO_INT_ALREADY_REGISTERED;
+        }
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        cryptoIntHandlers.handlers[handlerID] = handler;
+    }
+
+    return CRYPTO_TRACE_EXIT(INT_HW_REGISTER_HANDLER, crypto_Int_Status_E, status);
+}
+
+crypto_Int_Status_E Crypto_Int_Hw_Register_Completion(crypto_Int_Handler_Id handlerID,
+    crypto_Int_Completion completion, void *context)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+    uint32_t lockState;
+
+    CRYPTO_TRACE_ENTER(INT_HW_REGISTER_COMPLETION, 0UL);
+
+    if ((handlerID < CRYPTO1_INT) || (handlerID > CRYPTO3_INT))
+    {
+        status = CRYPTO_INT_INVALID_ID;
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        if ((completion != NULL) && (cryptoIntHandlers.completions[handlerID] != NULL))
+        {
+            status = CRYPTO_INT_ALREADY_REGISTERED;
+        }
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        /* The interrupt must not see the new function with the old context. */
+        lockState = Crypto_Int_Hw_Lock();
+        cryptoIntHandlers.completions[handlerID] = completion;
+        cryptoIntHandlers.contexts[handlerID] = context;
+        Crypto_Int_Hw_Unlock(lockState);
+    }
+
+    return CRYPTO_TRACE_EXIT(INT_HW_REGISTER_COMPLETION, crypto_Int_Status_E, status);
+}
+
+crypto_Int_Status_E Crypto_Int_Hw_Enable(crypto_Int_Handler_Id handlerID)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+
+    CRYPTO_TRACE_ENTER(INT_HW_ENABLE, 0UL);
+
+    switch (handlerID)
+    {
+        case CRYPTO1_INT:
+            _CRYPT1IF = 0;
+            _CRYPT1IE = 1;
+            break;
+
+        case CRYPTO2_INT:
+            _CRYPT2IF = 0;
+            _CRYPT2IE = 1;
+            break;
+
+        case CRYPTO3_INT:
+            _CRYPT3IF = 0;
+            _CRYPT3IE = 1;
+            break;
+
+        default:
+            status = CRYPTO_INT_INVALID_ID;
+            break;
+    }
+
+    return CRYPTO_TRACE_EXIT(INT_HW_ENABLE, crypto_Int_Status_E, status);
+}
+
+crypto_Int_Status_E Crypto_Int_Hw_Disable(crypto_Int_Handler_Id handlerID)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+
+    CRYPTO_TRACE_ENTER(INT_HW_DISABLE, 0UL);
+
+    switch (handlerID)
+    {
+        case CRYPTO1_INT:
+            _CRYPT1IF = 0;
+            _CRYPT1IE = 0;
+            break;
+
+        case CRYPTO2_INT:
+            _CRYPT2IF = 0;
+            _CRYPT2IE = 0;
+            break;
+
+        case CRYPTO3_INT:
+            _CRYPT3IF = 0;
+            _CRYPT3IE = 0;
+            break;
+
+        default:
+            status = CRYPTO_INT_INVALID_ID;
+            break;
+    }
+
+    return CRYPTO_TRACE_EXIT(INT_HW_DISABLE, crypto_Int_Status_E, status);
+}
+
+uint32_t Crypto_Int_Hw_Lock(void)
+{
+    uint32_t lockState = (uint32_t)__builtin_get_isr_state();
+
+    __builtin_disable_interrupts();
+
+    return lockState;
+}
+
+void Crypto_Int_Hw_Unlock(uint32_t lockState)
+{
+    __builtin_set_isr_state((unsigned int)lockState);
+}
@@ -0,0 +1,412 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digisign_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for the digital signature in the
+    hardware cryptographic library.
+
+  Description:
+    This source file contains the wrapper interface to access the hardware
+    cryptographic library in Microchip microcontrollers for digital signature.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <xc.h>
+#include "crypto/drivers/wrapper/crypto_digisign_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_pke_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_ecdsa.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+
+#if (CRYPTO_CONFIG_DIGISIGN_ECDSA == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Function Implementations
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_GetCurve(
+    crypto_EccCurveType_E eccCurveType, PKE_ECC_CURVE *hwEccCurve)
+{
+    CRYPTO_PKE_RESULT eccStatus = CRYPTO_PKE_RESULT_SUCCESS;
+
+    switch (eccCurveType)
+    {
+#if (CRYPTO_CONFIG_ECC_P192 == 1)
+        case CRYPTO_ECC_CURVE_P192:
+            *hwEccCurve = P192;
+            break;
+#endif
+        
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+        case CRYPTO_ECC_CURVE_P256:
+            *hwEccCurve = P256;
+            break;
+#endif
+        
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+        case CRYPTO_ECC_CURVE_P384:
+            *hwEccCurve = P384;
+            break;
+#endif
+        
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+        case CRYPTO_ECC_CURVE_P521:
+            *hwEccCurve = P521;
+            break;
+#endif
+            
+        default:
+            eccStatus = CRYPTO_PKE_RESULT_ERROR_CURVE;
+            break;
+    }
+    
+    return eccStatus;
+}
+
+static crypto_DigiSign_Status_E lCrypto_DigSign_Ecdsa_Hw_MapResult(CRYPTO_PKE_RESULT result)
+{
+    crypto_DigiSign_Status_E digiSignStatus;
+
+    switch (result)
+    {
+        case CRYPTO_PKE_RESULT_SUCCESS:
+            digiSignStatus = CRYPTO_DIGISIGN_SUCCESS;
+            break;
+
+        case CRYPTO_PKE_ERROR_PUBKEYCOMPRESS:
+            digiSignStatus = CRYPTO_DIGISIGN_ERROR_PUBKEYCOMPRESS;
+            break;
+
+        case CRYPTO_PKE_RESULT_ERROR_CURVE:
+            digiSignStatus = CRYPTO_DIGISIGN_ERROR_CURVE;
+            break;
+
+        case CRYPTO_PKE_RESULT_ERROR_RNG:
+            digiSignStatus = CRYPTO_DIGISIGN_ERROR_RNG;
+            break;
+
+        case CRYPTO_PKE_RESULT_INIT_FAIL:
+        case CRYPTO_PKE_RESULT_ERROR_FAIL:
+            digiSignStatus = CRYPTO_DIGISIGN_ERROR_FAIL;
+            break;
+
+        default:
+            digiSignStatus = CRYPTO_DIGISIGN_ERROR_FAIL;
+            break;
+    }
+
+    return digiSignStatus;
+}
+
+static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_SignCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, PKE_ECC_CURVE hwEccCurve)
+{
+    /* Initialize the hardware library for ECDSA signature */
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDSA_InitEccParamsSign(ptr_eccData, inputHash, hashLen, privKey, privKeyLen, hwEccCurve);
+
+    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Generate the signature */
+        hwResult = DRV_CRYPTO_ECDSA_Sign(ptr_eccData, outSig, sigLen);
+    }
+
+    return hwResult;
+}
+
+static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_VerifyCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, PKE_ECC_CURVE hwEccCurve)
+{
+    /* Initialize the hardware library for ECDSA signature verification */
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDSA_InitEccParamsVerify(ptr_eccData,
+                                                                      inputHash,
+                                                                      hashLen,
+                                                                      inputSig,
+                                                                      sigLen,
+                                                                      pubKey,
+                                                                      pubKeyLen,
+                                                                      hwEccCurve);
+
+    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Verify the signature */
+        hwResult = DRV_CRYPTO_ECDSA_Verify(ptr_eccData);
+    }
+
+    return hwResult;
+}
+
+/**
+ * @brief Sign with the PKE workspace of crypto_pke_cam05346_wrapper.h.
+ * @param digestFn NULL when inputHash holds the digest already; otherwise
+ *        called to write it there once the engine, the curve and the
+ *        PKE_CONFIG are set up.
+ * @param ptr_status Receives CRYPTO_DIGISIGN_ERROR_INPUTHASH when digestFn
+ *        fails, else the status of the sign.
+ */
+static void lCrypto_DigSign_Ecdsa_Hw_SignShared(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn, void *digestArg,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, crypto_DigiSign_Status_E *ptr_status)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+    bool digestOk = true;
+    PKE_CONFIG *ptr_eccData;
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && (digestFn != NULL))
+        {
+            digestOk = digestFn(digestArg, inputHash);
+        }
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_SignCtx(ptr_eccData, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+    }
+
+    *ptr_status = digestOk ? lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult) : CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+}
+
+/**
+ * @brief Verify with the PKE workspace; digestFn as for
+ *        lCrypto_DigSign_Ecdsa_Hw_SignShared().
+ */
+static void lCrypto_DigSign_Ecdsa_Hw_VerifyShared(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn, void *digestArg,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En,
+    crypto_DigiSign_Status_E *ptr_status)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+    bool digestOk = true;
+    PKE_CONFIG *ptr_eccData;
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && (digestFn != NULL))
+        {
+            digestOk = digestFn(digestArg, inputHash);
+        }
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_VerifyCtx(ptr_eccData, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hwEccCurve);
+        }
+
+        /* Set verification status */
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            *hashVerifyStatus = 1;
+        }
+        else
+        {
+            *hashVerifyStatus = 0;
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+        *hashVerifyStatus = 0;
+    }
+
+    *ptr_status = digestOk ? lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult) : CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: DigSign Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Sign(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGN, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
+
+    lCrypto_DigSign_Ecdsa_Hw_SignShared(NULL, NULL, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGN, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus,
+    crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFY, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    lCrypto_DigSign_Ecdsa_Hw_VerifyShared(NULL, NULL, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hashVerifyStatus,
+                                          eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFY, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGNSTREAM, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
+
+    lCrypto_DigSign_Ecdsa_Hw_SignShared(digestFn, digestArg, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGNSTREAM, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFYSTREAM, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    lCrypto_DigSign_Ecdsa_Hw_VerifyShared(digestFn, digestArg, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hashVerifyStatus,
+                                          eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFYSTREAM, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, void *workspace)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGNEX, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_SignCtx((PKE_CONFIG*) workspace, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGNEX, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult)));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus,
+    crypto_EccCurveType_E eccCurveType_En, void *workspace)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFYEX, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_VerifyCtx((PKE_CONFIG*) workspace, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hwEccCurve);
+        }
+
+        /* Set verification status */
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            *hashVerifyStatus = 1;
+        }
+        else
+        {
+            *hashVerifyStatus = 0;
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+        *hashVerifyStatus = 0;
+    }
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFYEX, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult)));
+}
+
+#endif /* CRYPTO_CONFIG_DIGISIGN_ECDSA == 1 */
@@ -0,0 +1,495 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for hardware SHA.
+
+  Description:
+    This source file contains the wrapper interface to access the SHA
+    hardware driver for Microchip microcontrollers.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_hash_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_hash.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_HASH_SHA == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Initialize the CAM library's AES interrupt handlers.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
+ */
+static crypto_Int_Status_E lDRV_CRYPTO_HASH_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_HASH_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the AES engine, which the caller holds as
+         * well, so the vector is taken over from the AES handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_HASH_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lDRV_CRYPTO_HASH_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_HASH_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
+}
+
+/**
+ * @brief Get the equivalent CAM library hash algorithm (operation mode).
+ * @param shaAlgorithm The crypto SHA algorithm.
+ * @param mode Pointer to a value to hold the equivalent CAM library hash operation mode.
+ * @return CRYPTO_HASH_SUCCESS on success, CRYPTO_HASH_ERROR_FAIL on failure.
+ */
+static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetAlgorithm(crypto_Hash_Algo_E shaAlgorithm,
+        HASHCON_MODE* mode)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+
+    switch(shaAlgorithm)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            *mode = MODE_SHA1;
+            status = CRYPTO_HASH_SUCCESS;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+        case CRYPTO_HASH_SHA2_224:
+            *mode = MODE_SHA224;
+            status = CRYPTO_HASH_SUCCESS;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_HASH_SHA2_256:
+            *mode = MODE_SHA256;
+            status = CRYPTO_HASH_SUCCESS;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_HASH_SHA2_384:
+            *mode = MODE_SHA384;
+            status = CRYPTO_HASH_SUCCESS;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_HASH_SHA2_512:
+            *mode = MODE_SHA512;
+            status = CRYPTO_HASH_SUCCESS;
+            break;
+#endif
+        default:
+            status = CRYPTO_HASH_ERROR_ALGO;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Get the length of the SHA digest for the given algorithm.
+ * @param shaAlgorithm The crypto SHA algorithm.
+ * @param digestLength Pointer to a value to hold the length of the SHA digest.
+ * @return CRYPTO_HASH_SUCCESS on success, CRYPTO_HASH_ERROR_FAIL on failure.
+ */
+static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetDigestLength(crypto_Hash_Algo_E shaAlgorithm, uint32_t *digestLength)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+
+    switch(shaAlgorithm)
+    {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+        case CRYPTO_HASH_SHA1:
+            *digestLength = 20;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+        case CRYPTO_HASH_SHA2_224:
+            *digestLength = 28;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+        case CRYPTO_HASH_SHA2_256:
+            *digestLength = 32;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+        case CRYPTO_HASH_SHA2_384:
+            *digestLength = 48;
+            break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+        case CRYPTO_HASH_SHA2_512:
+            *digestLength = 64;
+            break;
+#endif
+        default:
+            *digestLength = 0;
+            status = CRYPTO_HASH_ERROR_FAIL;
+            break;
+    }
+
+    return status;
+}
+
+/**
+ * @brief One-shot SHA digest on a given context.
+ * @param ptr_shaDigestCtx The context; its data is cleared here.
+ * @param mode The CAM library mode of the algorithm.
+ * @param data Pointer to the input data.
+ * @param dataLen Length of the input data.
+ * @param digest Pointer to a buffer to hold the digest.
+ * @param shaAlgorithm_en The SHA algorithm.
+ * @return CRYPTO_HASH_SUCCESS on success, other on failure.
+ */
+static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_DigestCtx(CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx,
+    HASHCON_MODE mode, uint8_t *data, uint32_t dataLen, uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en)
+{
+    crypto_Hash_Status_E status = CRYPTO_HASH_SUCCESS;
+    HASH_ERROR hashStatus = HASH_INITIALIZE_ERROR;
+    uint32_t digestLength = 0;
+
+    ptr_shaDigestCtx->algorithm = shaAlgorithm_en;
+    (void)memset(ptr_shaDigestCtx->contextData, 0, sizeof(ptr_shaDigestCtx->contextData));
+
+    if (CRYPTO_HASH_SUCCESS == lCrypto_Hash_Hw_Sha_GetDigestLength(ptr_shaDigestCtx->algorithm, &digestLength))
+    {
+        hashStatus = DRV_CRYPTO_HASH_Digest(ptr_shaDigestCtx->contextData, mode, data, dataLen, digest, digestLength);
+    }
+
+    if (hashStatus != HASH_NO_ERROR)
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Hash Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Init(void *shaInitCtx,
+        crypto_Hash_Algo_E shaAlgorithm)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the HASH context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_HW_CONTEXT *shaCtx = (CRYPTO_HASH_HW_CONTEXT*) shaInitCtx;
+    HASHCON_MODE mode;
+    crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+    HASH_ERROR hashStatus = HASH_INITIALIZE_ERROR;
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm, &mode);
+
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            shaCtx->algorithm = shaAlgorithm;
+            (void)memset(shaCtx->contextData, 0, sizeof(shaCtx->contextData));
+            hashStatus = DRV_CRYPTO_HASH_Initialize(shaCtx->contextData, mode);
+        }
+
+        if (hashStatus != HASH_NO_ERROR)
+        {
+            status = CRYPTO_HASH_ERROR_FAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_INIT, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, 0UL, status));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
+    uint8_t *data, uint32_t dataLen)
+{
+   /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the HASH context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_HW_CONTEXT *shaCtx = (CRYPTO_HASH_HW_CONTEXT*) shaUpdateCtx;
+    crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+    HASH_ERROR hashStatus;
+    HASH_ERROR hashActive;
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_UPDATE, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
+        if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
+        {
+            hashStatus = DRV_CRYPTO_HASH_Update(shaCtx->contextData, data, dataLen);
+
+            if (hashStatus == HASH_NO_ERROR)
+            {
+                status = CRYPTO_HASH_SUCCESS;
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_UPDATE, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Final(void *shaFinalCtx,
+    uint8_t *digest)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the HASH context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_HASH_HW_CONTEXT *shaCtx = (CRYPTO_HASH_HW_CONTEXT*) shaFinalCtx;
+    crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+    HASH_ERROR hashStatus;
+    HASH_ERROR hashActive;
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_FINAL, 0UL);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        hashStatus = DRV_CRYPTO_HASH_IsActive(shaCtx->contextData, &hashActive);
+        if ((hashStatus == HASH_NO_ERROR) && (hashActive == HASH_OPERATION_IS_ACTIVE))
+        {
+            uint32_t digestLen;
+
+            switch(shaCtx->algorithm)
+            {
+#if (CRYPTO_CONFIG_HASH_SHA1 == 1)
+                case CRYPTO_HASH_SHA1:
+                    digestLen = 20;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_224 == 1)
+                case CRYPTO_HASH_SHA2_224:
+                    digestLen = 28;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_256 == 1)
+                case CRYPTO_HASH_SHA2_256:
+                    digestLen = 32;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_384 == 1)
+                case CRYPTO_HASH_SHA2_384:
+                    digestLen = 48;
+                    break;
+#endif
+#if (CRYPTO_CONFIG_HASH_SHA2_512 == 1)
+                case CRYPTO_HASH_SHA2_512:
+                    digestLen = 64;
+                    break;
+#endif
+                default:
+                    digestLen = 0;
+                    hashStatus = HASH_READ_ERROR;
+                    break;
+            }
+
+            if (hashStatus == HASH_NO_ERROR)
+            {
+                hashStatus = DRV_CRYPTO_HASH_Final(shaCtx->contextData, digest, digestLen);
+                if (hashStatus == HASH_NO_ERROR)
+                {
+                    status = CRYPTO_HASH_SUCCESS;
+                }
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_FINAL, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, 0UL, status));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Digest(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en)
+{
+    HASHCON_MODE mode;
+    crypto_Hash_Status_E status = CRYPTO_HASH_ERROR_FAIL;
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+    CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx = NULL;
+#else
+    CRYPTO_HASH_HW_DIGEST_CONTEXT shaDigestCtx;
+    CRYPTO_HASH_HW_DIGEST_CONTEXT *ptr_shaDigestCtx = &shaDigestCtx;
+#endif
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_DIGEST, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm_en, &mode);
+
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            // Pool blocks are zeroed when acquired.
+            ptr_shaDigestCtx = (CRYPTO_HASH_HW_DIGEST_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_HASH_HW_DIGEST);
+            if (ptr_shaDigestCtx == NULL)
+            {
+                status = CRYPTO_HASH_ERROR_FAIL;
+            }
+        }
+#endif
+
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            status = lCrypto_Hash_Hw_Sha_DigestCtx(ptr_shaDigestCtx, mode, data, dataLen, digest, shaAlgorithm_en);
+        }
+
+#if (CRYPTO_POOL_HASH_HW_DIGEST_COUNT > 0U)
+        if (ptr_shaDigestCtx != NULL)
+        {
+            (void)Crypto_Pool_Release(CRYPTO_POOL_HASH_HW_DIGEST, ptr_shaDigestCtx);
+        }
+#endif
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_DIGEST, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_DigestEx(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en, void *workspace)
+{
+    HASHCON_MODE mode;
+    crypto_Hash_Status_E status;
+
+    CRYPTO_TRACE_ENTER(HASH_HW_SHA_DIGESTEX, dataLen);
+    CRYPTO_STATS_BEGIN(HASH_SHA);
+
+    if (lDRV_CRYPTO_HASH_EngineAcquire())
+    {
+        status = lCrypto_Hash_Hw_Sha_GetAlgorithm(shaAlgorithm_en, &mode);
+
+        if (status == CRYPTO_HASH_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            status = lCrypto_Hash_Hw_Sha_DigestCtx((CRYPTO_HASH_HW_DIGEST_CONTEXT*) workspace, mode, data, dataLen, digest, shaAlgorithm_en);
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_HASH_ERROR_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_HW_SHA_DIGESTEX, crypto_Hash_Status_E, CRYPTO_STATS_END(HASH_SHA, crypto_Hash_Status_E, dataLen, status));
+}
+
+#endif /* CRYPTO_CONFIG_HASH_SHA == 1 */
@@ -0,0 +1,205 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_kas_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for the Shared Secret generation in the
+    hardware cryptographic library.
+
+  Description:
+    This source file contains the wrapper interface to access the hardware
+    cryptographic library in Microchip microcontrollers for Shared Secret generation.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto/drivers/wrapper/crypto_kas_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_pke_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_ecdh.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+
+#if (CRYPTO_CONFIG_KAS_ECDH == 1)
+
+static CRYPTO_PKE_RESULT lCrypto_Kas_Ecdh_Hw_GetCurve(
+    crypto_EccCurveType_E eccCurveType, PKE_ECC_CURVE *hwEccCurve)
+{
+    CRYPTO_PKE_RESULT eccStatus = CRYPTO_PKE_RESULT_SUCCESS;
+
+    switch (eccCurveType)
+    {
+#if (CRYPTO_CONFIG_ECC_P192 == 1)
+        case CRYPTO_ECC_CURVE_P192:
+            *hwEccCurve = P192;
+            break;
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
+        case CRYPTO_ECC_CURVE_P256:
+            *hwEccCurve = P256;
+            break;
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
+        case CRYPTO_ECC_CURVE_P384:
+            *hwEccCurve = P384;
+            break;
+#endif
+
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+        case CRYPTO_ECC_CURVE_P521:
+            *hwEccCurve = P521;
+            break;
+#endif
+
+        default:
+            eccStatus = CRYPTO_PKE_RESULT_ERROR_CURVE;
+            break;
+    }
+
+    return eccStatus;
+}
+
+static crypto_Kas_Status_E lCrypto_Kas_Ecdh_Hw_MapResult(CRYPTO_PKE_RESULT result)
+{
+    crypto_Kas_Status_E kasStatus;
+
+    switch (result)
+    {
+        case CRYPTO_PKE_RESULT_SUCCESS:
+            kasStatus = CRYPTO_KAS_SUCCESS;
+            break;
+
+        case CRYPTO_PKE_ERROR_PUBKEYCOMPRESS:
+            kasStatus = CRYPTO_KAS_ERROR_PUBKEY;
+            break;
+
+        case CRYPTO_PKE_RESULT_ERROR_CURVE:
+            kasStatus = CRYPTO_KAS_ERROR_CURVE;
+            break;
+
+        case CRYPTO_PKE_RESULT_INIT_FAIL:
+        case CRYPTO_PKE_RESULT_ERROR_FAIL:
+            kasStatus = CRYPTO_KAS_ERROR_FAIL;
+            break;
+        default:
+            kasStatus = CRYPTO_KAS_ERROR_FAIL;
+            break;
+    }
+
+    return kasStatus;
+}
+
+static CRYPTO_PKE_RESULT lCrypto_Kas_Ecdh_Hw_SharedSecretCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *privKey, uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, PKE_ECC_CURVE hwEccCurve)
+{
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDH_InitEccParams(ptr_eccData, privKey, privKeyLen,
+                                                               pubKey, pubKeyLen, hwEccCurve);
+
+    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Get shared key */
+        hwResult = DRV_CRYPTO_ECDH_GetSharedSecret(ptr_eccData, secret, secretLen);
+    }
+
+    return hwResult;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecret(uint8_t *privKey,
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_CONFIG *ptr_eccData;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(KAS_ECDH_HW_SHAREDSECRET, 0UL);
+    CRYPTO_STATS_BEGIN(KAS_ECDH);
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            hwResult = lCrypto_Kas_Ecdh_Hw_SharedSecretCtx(ptr_eccData, privKey, privKeyLen, pubKey, pubKeyLen, secret, secretLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_HW_SHAREDSECRET, crypto_Kas_Status_E, CRYPTO_STATS_END(KAS_ECDH, crypto_Kas_Status_E, 0UL, lCrypto_Kas_Ecdh_Hw_MapResult(hwResult)));
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecretEx(uint8_t *privKey,
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en,
+    void *workspace)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(KAS_ECDH_HW_SHAREDSECRETEX, 0UL);
+    CRYPTO_STATS_BEGIN(KAS_ECDH);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_Kas_Ecdh_Hw_SharedSecretCtx((PKE_CONFIG*) workspace, privKey, privKeyLen, pubKey, pubKeyLen, secret, secretLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_HW_SHAREDSECRETEX, crypto_Kas_Status_E, CRYPTO_STATS_END(KAS_ECDH, crypto_Kas_Status_E, 0UL, lCrypto_Kas_Ecdh_Hw_MapResult(hwResult)));
+}
+
+#endif /* CRYPTO_CONFIG_KAS_ECDH == 1 */
@@ -0,0 +1,358 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for CAM hardware AES MAC.
+
+  Description:
+    This source file contains the wrapper interface to access the
+    AES MAC algorithms in the AES hardware driver for Microchip microcontrollers.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_mac_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_aes.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#include "crypto/common_crypto/crypto_pool.h"
+
+#if (CRYPTO_CONFIG_MAC_AESCMAC == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Initialize the CAM library's AES interrupt handlers.
+ * @return CRYPTO_INT_SUCCESS on success, other on failure.
+ */
+static crypto_Int_Status_E lDRV_CRYPTO_AES_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+
+    if (status == CRYPTO_INT_ALREADY_REGISTERED)
+    {
+        /* CRYPTO1 is shared with the SHA engine, which the caller holds as
+         * well, so the vector is taken over from the SHA handler. */
+        (void)Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, NULL);
+        status = Crypto_Int_Hw_Register_Handler(CRYPTO1_INT, DRV_CRYPTO_AES_IsrHelper);
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO1_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lDRV_CRYPTO_AES_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_SYM) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_AES_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+        }
+    }
+
+    return owner;
+}
+
+/**
+ * @brief One-shot AES-CMAC on a given context.
+ * @param cmacContext The cleared CAM library context data.
+ * @param ptr_inputData Pointer to the input data.
+ * @param dataLen Length of the input data.
+ * @param ptr_outMac Pointer to a buffer to hold the MAC.
+ * @param macLen Length of the MAC.
+ * @param ptr_key Pointer to the key.
+ * @param keyLen Length of the key.
+ * @return CRYPTO_MAC_CIPHER_SUCCESS on success, other on failure.
+ */
+static crypto_Mac_Status_E lCrypto_Sym_Hw_Cmac_DirectCtx(uint8_t *cmacContext, uint8_t *ptr_inputData, uint32_t dataLen,
+                                                         uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen)
+{
+    crypto_Mac_Status_E status = CRYPTO_MAC_ERROR_CIPFAIL;
+    AES_ERROR aesStatus = DRV_CRYPTO_AES_Initialize(cmacContext, MODE_CMAC, OP_ENCRYPT, ptr_key, keyLen, NULL, 0U);
+
+    if(aesStatus == AES_NO_ERROR)
+    {
+        aesStatus = DRV_CRYPTO_AES_AddInputData(cmacContext, ptr_inputData, dataLen);
+    }
+
+    if(aesStatus == AES_NO_ERROR)
+    {
+        if ((NULL != ptr_outMac) && (0UL != macLen))
+        {
+            aesStatus = DRV_CRYPTO_AES_AddOutputData(cmacContext, ptr_outMac, macLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                aesStatus = DRV_CRYPTO_AES_Execute(cmacContext);
+            }
+        }
+    }
+
+    if (aesStatus == AES_NO_ERROR)
+    {
+        status = CRYPTO_MAC_CIPHER_SUCCESS;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MAC Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_Init(void *cmacInitCtx, uint8_t *key, uint32_t keyLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the CMAC context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_HW_CONTEXT *cmacCtx = (CRYPTO_CMAC_HW_CONTEXT*) cmacInitCtx;
+    crypto_Mac_Status_E status = CRYPTO_MAC_ERROR_CIPFAIL;
+    AES_ERROR aesStatus = AES_INITIALIZE_ERROR;
+
+    AESCON_MODE mode = MODE_CMAC;
+    AESCON_OPERATION operation = OP_ENCRYPT;
+
+    CRYPTO_TRACE_ENTER(SYM_HW_CMAC_INIT, 0UL);
+    CRYPTO_STATS_BEGIN(MAC_AESCMAC);
+
+    if (lDRV_CRYPTO_AES_EngineAcquire())
+    {
+        // Context data must be cleared as the context may be on a stack versus static memory.
+        (void)memset(cmacCtx->contextData, 0, sizeof(cmacCtx->contextData));
+
+        aesStatus = DRV_CRYPTO_AES_Initialize(cmacCtx->contextData, mode, operation, key, keyLen, NULL, 0U);
+
+        if(aesStatus == AES_NO_ERROR)
+        {
+            status = CRYPTO_MAC_CIPHER_SUCCESS;
+        }
+        else
+        {
+            status = CRYPTO_MAC_ERROR_CIPFAIL;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_CMAC_INIT, crypto_Mac_Status_E, CRYPTO_STATS_END(MAC_AESCMAC, crypto_Mac_Status_E, 0UL, status));
+}
+
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_Cipher(void *cmacCipherCtx, uint8_t *inputData, uint32_t dataLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the CMAC context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_HW_CONTEXT *cmacCtx = (CRYPTO_CMAC_HW_CONTEXT*) cmacCipherCtx;
+    crypto_Mac_Status_E status = CRYPTO_MAC_ERROR_CIPFAIL;
+    AES_ERROR aesStatus;
+    AES_ERROR aesActive;
+
+    CRYPTO_TRACE_ENTER(SYM_HW_CMAC_CIPHER, dataLen);
+    CRYPTO_STATS_BEGIN(MAC_AESCMAC);
+
+    if (lDRV_CRYPTO_AES_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(cmacCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+        {
+            aesStatus = DRV_CRYPTO_AES_AddInputData(cmacCtx->contextData, inputData, dataLen);
+            if(aesStatus == AES_NO_ERROR)
+            {
+                status = CRYPTO_MAC_CIPHER_SUCCESS;
+            }
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_CMAC_CIPHER, crypto_Mac_Status_E, CRYPTO_STATS_END(MAC_AESCMAC, crypto_Mac_Status_E, dataLen, status));
+}
+
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_Final(void *cmacFinalCtx, uint8_t *outputMac, uint32_t macLen)
+{
+    /* MISRA C:2012 Rule 11.5 deviation:
+    * Reason: Conversion from void* to the CMAC context defined by the 
+    *         CAM Hardware Driver pre-compiled library is required since 
+    *         the library does not have access to the upper context structures 
+    *         defined by the Crypto APIs.
+    */
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_HW_CONTEXT *cmacCtx = (CRYPTO_CMAC_HW_CONTEXT*) cmacFinalCtx;
+    crypto_Mac_Status_E status = CRYPTO_MAC_ERROR_CIPFAIL;
+
+    AES_ERROR aesStatus;
+    AES_ERROR aesActive;
+
+    CRYPTO_TRACE_ENTER(SYM_HW_CMAC_FINAL, 0UL);
+    CRYPTO_STATS_BEGIN(MAC_AESCMAC);
+
+    if (lDRV_CRYPTO_AES_EngineAcquire())
+    {
+        aesStatus = DRV_CRYPTO_AES_IsActive(cmacCtx->contextData, &aesActive);
+        if ((aesStatus == AES_NO_ERROR) && (aesActive == AES_OPERATION_IS_ACTIVE))
+        {
+            if ((NULL != outputMac) && (0UL != macLen))
+            {
+                aesStatus = DRV_CRYPTO_AES_AddOutputData(cmacCtx->contextData, outputMac, macLen);
+                if(aesStatus == AES_NO_ERROR)
+                {
+                    aesStatus = DRV_CRYPTO_AES_Execute(cmacCtx->contextData);
+                }
+            }
+        }
+
+        if(aesStatus == AES_NO_ERROR)
+        {
+            status = CRYPTO_MAC_CIPHER_SUCCESS;
+        }
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_CMAC_FINAL, crypto_Mac_Status_E, CRYPTO_STATS_END(MAC_AESCMAC, crypto_Mac_Status_E, 0UL, status));
+}
+
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_Direct(uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outMac, uint32_t macLen,
+                                              uint8_t *ptr_key, uint32_t keyLen)
+{
+    crypto_Mac_Status_E status = CRYPTO_MAC_ERROR_CIPFAIL;
+#if (CRYPTO_POOL_CMAC_HW_COUNT > 0U)
+    CRYPTO_CMAC_HW_CONTEXT *ptr_cmacCtx = NULL;
+#else
+    CRYPTO_CMAC_HW_CONTEXT cmacCtx;
+#endif
+
+    CRYPTO_TRACE_ENTER(SYM_HW_CMAC_DIRECT, dataLen);
+    CRYPTO_STATS_BEGIN(MAC_AESCMAC);
+
+    if (lDRV_CRYPTO_AES_EngineAcquire())
+    {
+#if (CRYPTO_POOL_CMAC_HW_COUNT > 0U)
+        // Pool blocks are zeroed when acquired.
+        ptr_cmacCtx = (CRYPTO_CMAC_HW_CONTEXT *)Crypto_Pool_Acquire(CRYPTO_POOL_CMAC_HW);
+        if (ptr_cmacCtx != NULL)
+        {
+            status = lCrypto_Sym_Hw_Cmac_DirectCtx(ptr_cmacCtx->contextData, ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen);
+            (void)Crypto_Pool_Release(CRYPTO_POOL_CMAC_HW, ptr_cmacCtx);
+        }
+#else
+        // Context data must be cleared.
+        (void)memset(cmacCtx.contextData, 0, sizeof(cmacCtx.contextData));
+        status = lCrypto_Sym_Hw_Cmac_DirectCtx(cmacCtx.contextData, ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen);
+#endif
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_CMAC_DIRECT, crypto_Mac_Status_E, CRYPTO_STATS_END(MAC_AESCMAC, crypto_Mac_Status_E, dataLen, status));
+}
+
+crypto_Mac_Status_E Crypto_Sym_Hw_Cmac_DirectEx(uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outMac, uint32_t macLen,
+                                                uint8_t *ptr_key, uint32_t keyLen, void *workspace)
+{
+    /* cppcheck-suppress misra-c2012-11.5 */
+    CRYPTO_CMAC_HW_CONTEXT *cmacCtx = (CRYPTO_CMAC_HW_CONTEXT*) workspace;
+    crypto_Mac_Status_E status;
+
+    CRYPTO_TRACE_ENTER(SYM_HW_CMAC_DIRECTEX, dataLen);
+    CRYPTO_STATS_BEGIN(MAC_AESCMAC);
+
+    if (lDRV_CRYPTO_AES_EngineAcquire())
+    {
+        (void)memset(cmacCtx->contextData, 0, sizeof(cmacCtx->contextData));
+        status = lCrypto_Sym_Hw_Cmac_DirectCtx(cmacCtx->contextData, ptr_inputData, dataLen, ptr_outMac, macLen, ptr_key, keyLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_SYM);
+    }
+    else
+    {
+        status = CRYPTO_MAC_ERROR_CIPFAIL;
+    }
+
+    return CRYPTO_TRACE_EXIT(SYM_HW_CMAC_DIRECTEX, crypto_Mac_Status_E, CRYPTO_STATS_END(MAC_AESCMAC, crypto_Mac_Status_E, dataLen, status));
+}
+
+#endif /* CRYPTO_CONFIG_MAC_AESCMAC == 1 */
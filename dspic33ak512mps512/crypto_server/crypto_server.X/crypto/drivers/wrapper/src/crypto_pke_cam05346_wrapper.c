@@ -0,0 +1,120 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_pke_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for the public key engine shared by the
+    ECDSA and ECDH wrappers.
+
+  Description:
+    This source file contains the wrapper interface to access the hardware
+    cryptographic library in Microchip microcontrollers for the public key engine.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_pke_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+#if ((CRYPTO_CONFIG_DIGISIGN_ECDSA == 1) || (CRYPTO_CONFIG_KAS_ECDH == 1))
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Data
+// *****************************************************************************
+// *****************************************************************************
+
+/* The CAM library copies the operands into the engine, so the workspace is
+ * the PKE_CONFIG of pointers and sizes alone, whatever the curve. It belongs
+ * to the holder of the engine. */
+static PKE_CONFIG pkeWorkspace;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Function Implementations
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Int_Status_E lDRV_CRYPTO_PKE_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO3_INT, DRV_CRYPTO_PKE_IsrHelper);
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO3_INT);
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: PKE Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+PKE_CONFIG *Crypto_Pke_Hw_Acquire(void)
+{
+    PKE_CONFIG *ptr_workspace = NULL;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_PKE) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_PKE_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            /* Wiped by the last release, or never used */
+            ptr_workspace = &pkeWorkspace;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_PKE);
+        }
+    }
+
+    return ptr_workspace;
+}
+
+void Crypto_Pke_Hw_Release(void)
+{
+    /* Wiped while the engine is still held, so no other task sees the
+     * pointers to the keys of this operation */
+    (void)memset(&pkeWorkspace, 0, sizeof(pkeWorkspace));
+    (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_PKE);
+}
+
+#endif /* (CRYPTO_CONFIG_DIGISIGN_ECDSA == 1) || (CRYPTO_CONFIG_KAS_ECDH == 1) */
@@ -0,0 +1,126 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rng_cam05346_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for hardware TRNG.
+
+  Description:
+    This source file contains the wrapper interface to access the TRNG
+    hardware driver for Microchip microcontrollers.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <xc.h>
+#include "crypto/drivers/wrapper/crypto_rng_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_trng.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+#if (CRYPTO_CONFIG_RNG_TRNG == 1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Int_Status_E lDRV_CRYPTO_TRNG_InterruptSetup(void)
+{
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO2_INT, DRV_CRYPTO_TRNG_IsrHelper);
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO2_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lDRV_CRYPTO_TRNG_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_TRNG) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_TRNG_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_TRNG);
+        }
+    }
+
+    return owner;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: TRNG Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Rng_Status_E Crypto_Rng_Hw_Trng_Generate(uint8_t *rngData, uint32_t rngLen)
+{
+    crypto_Rng_Status_E status = CRYPTO_RNG_ERROR_FAIL;
+
+    CRYPTO_TRACE_ENTER(RNG_HW_TRNG_GENERATE, rngLen);
+    CRYPTO_STATS_BEGIN(RNG_TRNG);
+
+    if (lDRV_CRYPTO_TRNG_EngineAcquire())
+    {
+        (void) DRV_CRYPTO_TRNG_Setup();
+        (void) DRV_CRYPTO_TRNG_ReadData(rngData, rngLen);
+
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_TRNG);
+        status = CRYPTO_RNG_SUCCESS;
+    }
+
+    return CRYPTO_TRACE_EXIT(RNG_HW_TRNG_GENERATE, crypto_Rng_Status_E, CRYPTO_STATS_END(RNG_TRNG, crypto_Rng_Status_E, rngLen, status));
+}
+
+#endif /* CRYPTO_CONFIG_RNG_TRNG == 1 */
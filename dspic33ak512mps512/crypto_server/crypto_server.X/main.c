@@ -0,0 +1,216 @@
+/*******************************************************************************
+  Main Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    main.c
+
+  Summary:
+    This source file starts the crypto offload server on UART1.
+ *******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "mcc_generated_files/system/system.h"
+#include "app/crypto_server.h"
+#include "app/crypto_server_uart.h"
+#include "app/app_timer.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+#ifdef CRYPTO_LATENCY_BENCH_ENABLE
+#include "app/app_bench.h"
+#include "app/app_load.h"
+#include "app/crypto_latency_bench.h"
+#endif
+#include "crypto/common_crypto/crypto_handshake.h"
+#if defined(CRYPTO_SELFTEST_ENABLE) && defined(CRYPTO_SELFTEST_BENCH_ENABLE)
+#include "app/app_selftest_bench.h"
+#endif
+#ifdef CRYPTO_HANDSHAKE_BENCH_ENABLE
+#include "app/app_handshake_bench.h"
+#endif
+#ifdef CRYPTO_ECIES_BENCH_ENABLE
+#include "app/app_ecies_bench.h"
+#endif
+#ifdef CRYPTO_RFC6979_BENCH_ENABLE
+#include "app/app_rfc6979_bench.h"
+#endif
+#ifdef CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE
+#include "app/app_digisign_stream_bench.h"
+#endif
+#ifdef CRYPTO_VERIFY_CACHE_BENCH_ENABLE
+#include "app/app_verify_cache_bench.h"
+#endif
+
+#ifdef CRYPTO_SELFTEST_ENABLE
+// Self-test run at reset, before the server takes requests.
+#ifndef CRYPTO_SELFTEST_BOOT_MODE
+#define CRYPTO_SELFTEST_BOOT_MODE   CRYPTO_SELFTEST_MODE_FULL
+#endif
+#endif
+
+
+#ifdef CRYPTO_TRACE_ENABLE
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Trace Port
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t CRYPTO_TRACE_PORT_Timestamp(void)
+{
+    return APP_TIMER_Get();
+}
+
+uint32_t CRYPTO_TRACE_PORT_TickRate(void)
+{
+    return APP_TIMER_TICK_RATE_HZ;
+}
+#endif
+
+#ifdef CRYPTO_LATENCY_BENCH_ENABLE
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Latency Benchmark Port
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t CRYPTO_LATENCY_BENCH_PORT_Timestamp(void)
+{
+    return APP_TIMER_Get();
+}
+
+uint32_t CRYPTO_LATENCY_BENCH_PORT_TickRate(void)
+{
+    return APP_TIMER_TICK_RATE_HZ;
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_LoadStart(uint32_t rateHz)
+{
+    APP_LOAD_Start(rateHz);
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_LoadStop(void)
+{
+    APP_LOAD_Stop();
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_WriteLine(const char *line)
+{
+    APP_BENCH_WriteLine(line);
+}
+
+/**
+ * @brief Sweep the load rates once and end the output with a comment line.
+ */
+static void runLatencyBench(void)
+{
+    static const uint32_t loadRates[] = CRYPTO_LATENCY_BENCH_LOAD_RATES;
+
+    CRYPTO_LATENCY_BENCH_PORT_WriteLine(CRYPTO_LATENCY_BENCH_CSV_HEADER);
+    for (uint32_t index = 0UL; index < (sizeof(loadRates) / sizeof(loadRates[0])); index++)
+    {
+        (void) CRYPTO_LATENCY_BENCH_Run(NULL, loadRates[index], 0UL);
+    }
+    CRYPTO_LATENCY_BENCH_PORT_WriteLine("# end");
+}
+#endif
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main(void)
+{
+    SYSTEM_Initialize();
+    APP_TIMER_Initialize();
+    CRYPTO_SERVER_UART_Initialize();
+
+#ifdef CRYPTO_SELFTEST_ENABLE
+    {
+        /* An algorithm that fails its test stays failed, and the server
+         * returns the error of its module for it. */
+        uint32_t bootStart = APP_TIMER_Get();
+        crypto_SelfTest_Status_E bootStatus = Crypto_SelfTest_Run(CRYPTO_SELFTEST_BOOT_MODE);
+#ifdef CRYPTO_SELFTEST_BENCH_ENABLE
+        APP_SELFTEST_BENCH_Run(CRYPTO_SELFTEST_BOOT_MODE, APP_TIMER_Elapsed(bootStart), bootStatus);
+#else
+        (void)bootStart;
+        (void)bootStatus;
+#endif
+    }
+#endif
+
+#ifdef CRYPTO_LATENCY_BENCH_ENABLE
+    runLatencyBench();
+#endif
+
+#ifdef CRYPTO_HANDSHAKE_BENCH_ENABLE
+    APP_HANDSHAKE_BENCH_Run();
+#endif
+
+#ifdef CRYPTO_ECIES_BENCH_ENABLE
+    APP_ECIES_BENCH_Run();
+#endif
+
+#ifdef CRYPTO_RFC6979_BENCH_ENABLE
+    APP_RFC6979_BENCH_Run();
+#endif
+
+#ifdef CRYPTO_DIGISIGN_STREAM_BENCH_ENABLE
+    APP_DIGISIGN_STREAM_BENCH_Run();
+#endif
+
+#ifdef CRYPTO_VERIFY_CACHE_BENCH_ENABLE
+    APP_VERIFY_CACHE_BENCH_Run();
+#endif
+
+    while(1)
+    {
+        if (!CRYPTO_SERVER_Task())
+        {
+#if (CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1)
+            // Idle: generate the next ephemeral key pair ahead of a handshake.
+            (void) Crypto_Handshake_Pool_Task(CRYPTO_HANDLER_HW_INTERNAL, 1UL);
+#endif
+        }
+    };
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,336 @@
+/*******************************************************************************
+  Crypto Boot Verifier Host Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_boot_verify_bench.c
+
+  Summary:
+    Times the secure-boot verifier (crypto_boot_verify.c) on Linux, pipelined
+    against sequential, with a file as the program flash.
+
+  Description:
+    The images are written to a file that is mapped read-only, so the
+    verifier hashes them in place as it does from flash on the board. Each
+    image is signed with the Crypto_* stand-in, whose CRYPTO_STANDIN_NS_PER_BYTE
+    and CRYPTO_STANDIN_PKE_US model the engine times. The stand-in waits for
+    a deadline on the clock, so a SHA and a PKE wait on two threads overlap
+    as the two engines do, even on one CPU. The POSIX port of crypto_osal.h
+    runs the verification task.
+
+    One CSV row is written per mode:
+      mode,images,image_bytes,runs,best_ms,mean_ms,errors
+    Both modes are also run with a corrupted signature on the second image,
+    which must be the only one rejected; the tool exits with 1 otherwise.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "app/crypto_boot_verify.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+#define BOOT_MAX_IMAGES         (16U)
+#define BOOT_KEY_LEN            (48U)           // P-384
+#define BOOT_SIG_LEN            (2U * BOOT_KEY_LEN)
+#define BOOT_PUBKEY_LEN         (1U + (2U * BOOT_KEY_LEN))
+#define BOOT_DIGEST_LEN         (48U)           // CRYPTO_BOOT_VERIFY_HASH, SHA-384
+
+static const uint8_t *bootFlash;
+static size_t bootFlashSize;
+
+static uint8_t bootPrivateKey[BOOT_KEY_LEN];
+static uint8_t bootPublicKey[BOOT_PUBKEY_LEN];
+static uint8_t bootSignatures[BOOT_MAX_IMAGES][BOOT_SIG_LEN];
+static CRYPTO_BOOT_VERIFY_IMAGE bootImages[BOOT_MAX_IMAGES];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Boot Verifier Port
+// *****************************************************************************
+// *****************************************************************************
+
+uint8_t *CRYPTO_BOOT_VERIFY_PORT_Flash(uint32_t address, uint32_t length)
+{
+    if (((size_t)address > bootFlashSize) || ((size_t)length > (bootFlashSize - (size_t)address)))
+    {
+        return NULL;
+    }
+
+    // The engine only reads it; the mapping is read-only.
+    return (uint8_t *)(uintptr_t)(bootFlash + address);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Flash Image
+// *****************************************************************************
+// *****************************************************************************
+
+/* Write count images of imageBytes pseudo-random bytes to path and map the
+ * file read-only. */
+static int lBoot_FlashCreate(const char *path, uint32_t count, uint32_t imageBytes)
+{
+    uint8_t block[4096];
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    size_t total = (size_t)count * imageBytes;
+    size_t done = 0U;
+    void *map;
+    int fd;
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (done < total)
+    {
+        size_t len = ((total - done) < sizeof(block)) ? (total - done) : sizeof(block);
+
+        for (size_t i = 0U; i < len; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            block[i] = (uint8_t)(x >> 32);
+        }
+        if (write(fd, block, len) != (ssize_t)len)
+        {
+            perror(path);
+            (void)close(fd);
+            return -1;
+        }
+        done += len;
+    }
+
+    map = mmap(NULL, total, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        return -1;
+    }
+
+    bootFlash = (const uint8_t *)map;
+    bootFlashSize = total;
+
+    return 0;
+}
+
+// Describe the images and sign each over its digest.
+static int lBoot_Sign(uint32_t count, uint32_t imageBytes)
+{
+    uint8_t digest[CRYPTO_BOOT_VERIFY_DIGEST_MAX];
+
+    for (uint32_t i = 0U; i < BOOT_KEY_LEN; i++)
+    {
+        bootPrivateKey[i] = (uint8_t)(i + 1U);
+    }
+    bootPublicKey[0] = 0x04U;
+
+    for (uint32_t index = 0U; index < count; index++)
+    {
+        CRYPTO_BOOT_VERIFY_IMAGE *image = &bootImages[index];
+
+        image->address = index * imageBytes;
+        image->length = imageBytes;
+        image->signature = bootSignatures[index];
+        image->signatureLen = BOOT_SIG_LEN;
+        image->pubKey = bootPublicKey;
+        image->pubKeyLen = BOOT_PUBKEY_LEN;
+
+        if ((CRYPTO_BOOT_VERIFY_Digest(image, digest) != CRYPTO_BOOT_VERIFY_SUCCESS) ||
+            (Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, digest, BOOT_DIGEST_LEN, bootSignatures[index],
+                BOOT_SIG_LEN, bootPrivateKey, BOOT_KEY_LEN, CRYPTO_BOOT_VERIFY_CURVE, 1U) != CRYPTO_DIGISIGN_SUCCESS))
+        {
+            fprintf(stderr, "signing image %u failed\n", (unsigned int)index);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark
+// *****************************************************************************
+// *****************************************************************************
+
+static double lBoot_NowMs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+static void lBoot_Time(const char *mode, bool pipelined, uint32_t count, uint32_t imageBytes, uint32_t runs)
+{
+    CRYPTO_BOOT_VERIFY_STATUS results[BOOT_MAX_IMAGES];
+    double best = 0.0;
+    double sum = 0.0;
+    unsigned long errors = 0UL;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        double start = lBoot_NowMs();
+        CRYPTO_BOOT_VERIFY_STATUS status = CRYPTO_BOOT_VERIFY_Run(bootImages, count, pipelined, results);
+        double elapsed = lBoot_NowMs() - start;
+
+        if (status != CRYPTO_BOOT_VERIFY_SUCCESS)
+        {
+            errors++;
+        }
+        sum += elapsed;
+        if ((run == 0U) || (elapsed < best))
+        {
+            best = elapsed;
+        }
+    }
+
+    printf("%s,%u,%u,%u,%.3f,%.3f,%lu\n", mode, (unsigned int)count, (unsigned int)imageBytes,
+           (unsigned int)runs, best, sum / (double)runs, errors);
+}
+
+// Corrupt the signature of the second image; it alone must be rejected.
+static int lBoot_CheckTamper(bool pipelined, uint32_t count)
+{
+    CRYPTO_BOOT_VERIFY_STATUS results[BOOT_MAX_IMAGES];
+    CRYPTO_BOOT_VERIFY_STATUS status;
+    int failed = 0;
+    uint32_t bad = (count > 1U) ? 1U : 0U;
+
+    bootSignatures[bad][0] ^= 0x01U;
+    status = CRYPTO_BOOT_VERIFY_Run(bootImages, count, pipelined, results);
+    bootSignatures[bad][0] ^= 0x01U;
+
+    if (status != CRYPTO_BOOT_VERIFY_ERROR_SIGNATURE)
+    {
+        failed = 1;
+    }
+    for (uint32_t index = 0U; index < count; index++)
+    {
+        if (results[index] != ((index == bad) ? CRYPTO_BOOT_VERIFY_ERROR_SIGNATURE : CRYPTO_BOOT_VERIFY_SUCCESS))
+        {
+            failed = 1;
+        }
+    }
+    if (failed != 0)
+    {
+        fprintf(stderr, "%s: corrupted signature of image %u not rejected alone\n",
+                pipelined ? "pipelined" : "sequential", (unsigned int)bad);
+    }
+
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    char path[64] = "/tmp/crypto_boot_flashXXXXXX";
+    const char *flashPath = NULL;
+    uint32_t count = 4U;
+    uint32_t imageBytes = 256U * 1024U;
+    uint32_t runs = 5U;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:s:n:f:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'i':
+                count = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                imageBytes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                runs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                flashPath = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-i images] [-s image_bytes] [-n runs] [-f flash_file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if ((count == 0U) || (count > BOOT_MAX_IMAGES) || (imageBytes == 0U) || (runs == 0U))
+    {
+        fprintf(stderr, "images must be 1 to %u, image_bytes and runs at least 1\n", BOOT_MAX_IMAGES);
+        return 2;
+    }
+
+    if (flashPath == NULL)
+    {
+        int fd = mkstemp(path);
+
+        if (fd < 0)
+        {
+            perror(path);
+            return 2;
+        }
+        (void)close(fd);
+        flashPath = path;
+    }
+
+    if ((Crypto_Osal_Initialize() != CRYPTO_OSAL_SUCCESS) ||
+        (lBoot_FlashCreate(flashPath, count, imageBytes) != 0) || (lBoot_Sign(count, imageBytes) != 0))
+    {
+        failed = 2;
+    }
+    else
+    {
+        printf("mode,images,image_bytes,runs,best_ms,mean_ms,errors\n");
+        lBoot_Time("sequential", false, count, imageBytes, runs);
+        lBoot_Time("pipelined", true, count, imageBytes, runs);
+        failed = lBoot_CheckTamper(false, count) | lBoot_CheckTamper(true, count);
+    }
+
+    if (flashPath == path)
+    {
+        (void)unlink(path);
+    }
+
+    return failed;
+}
@@ -0,0 +1,541 @@
+/*******************************************************************************
+  Crypto Offload Client Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_client.c
+
+  Summary:
+    Host client library for the crypto offload server.
+
+  Description:
+    Implements the framing, the in-flight window and response matching
+    described in crypto_client.h. Only POSIX interfaces are used.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _DEFAULT_SOURCE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "crypto_client.h"
+
+#define CRYPTO_CLIENT_FRAME_SIZE    (CRYPTO_SERVER_FRAME_OVERHEAD + CRYPTO_SERVER_MAX_PAYLOAD)
+#define CRYPTO_CLIENT_READ_SIZE     (4096U)
+
+typedef struct
+{
+    uint16_t tag;
+    CRYPTO_CLIENT_CALLBACK callback;
+    void *context;
+} CRYPTO_CLIENT_PENDING;
+
+struct CRYPTO_CLIENT
+{
+    int fd;
+    int timeoutMs;
+    int error;
+    uint32_t window;
+    uint16_t nextTag;
+
+    // Pending requests in submission order (responses arrive in this order).
+    CRYPTO_CLIENT_PENDING pending[CRYPTO_CLIENT_MAX_IN_FLIGHT];
+    uint32_t pendingHead;
+    uint32_t pendingCount;
+    uint32_t completed;
+
+    // Response parser; rxFrame holds the bytes following the SOF.
+    uint8_t rxFrame[CRYPTO_CLIENT_FRAME_SIZE];
+    uint32_t rxHave;
+    uint32_t rxNeed;
+    bool rxInFrame;
+
+    uint8_t txFrame[CRYPTO_CLIENT_FRAME_SIZE];
+};
+
+typedef struct
+{
+    bool done;
+    int status;
+    uint8_t *response;
+    uint16_t responseSize;
+    uint16_t *responseLength;
+} CRYPTO_CLIENT_CALL;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static int64_t lCRYPTO_CLIENT_NowMs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((int64_t)now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+}
+
+static void lCRYPTO_CLIENT_CompleteHead(CRYPTO_CLIENT *client, int status, const uint8_t *payload, uint16_t length)
+{
+    CRYPTO_CLIENT_PENDING entry = client->pending[client->pendingHead];
+
+    client->pendingHead = (client->pendingHead + 1U) % CRYPTO_CLIENT_MAX_IN_FLIGHT;
+    client->pendingCount--;
+    client->completed++;
+
+    if (entry.callback != NULL)
+    {
+        entry.callback(entry.context, status, payload, length);
+    }
+}
+
+static void lCRYPTO_CLIENT_FailAll(CRYPTO_CLIENT *client, int status)
+{
+    while (client->pendingCount > 0U)
+    {
+        lCRYPTO_CLIENT_CompleteHead(client, status, NULL, 0U);
+    }
+}
+
+static void lCRYPTO_CLIENT_Response(CRYPTO_CLIENT *client, uint16_t tag, int status, const uint8_t *payload,
+    uint16_t length)
+{
+    uint32_t i;
+
+    // Ignore stray responses whose tag is not pending.
+    for (i = 0U; i < client->pendingCount; i++)
+    {
+        if (client->pending[(client->pendingHead + i) % CRYPTO_CLIENT_MAX_IN_FLIGHT].tag == tag)
+        {
+            break;
+        }
+    }
+
+    if (i == client->pendingCount)
+    {
+        return;
+    }
+
+    // Responses are in order, so anything older than this one was lost.
+    while (i-- > 0U)
+    {
+        lCRYPTO_CLIENT_CompleteHead(client, CRYPTO_CLIENT_STATUS_LOST, NULL, 0U);
+    }
+
+    lCRYPTO_CLIENT_CompleteHead(client, status, payload, length);
+}
+
+static void lCRYPTO_CLIENT_ParseByte(CRYPTO_CLIENT *client, uint8_t byte)
+{
+    uint8_t *frame = client->rxFrame;
+
+    if (client->rxInFrame == false)
+    {
+        if (byte == CRYPTO_SERVER_SOF)
+        {
+            client->rxInFrame = true;
+            client->rxHave = 0U;
+            client->rxNeed = CRYPTO_SERVER_HEADER_SIZE;
+        }
+        return;
+    }
+
+    frame[client->rxHave++] = byte;
+
+    if (client->rxHave == CRYPTO_SERVER_HEADER_SIZE)
+    {
+        uint32_t length = (uint32_t)frame[4] | ((uint32_t)frame[5] << 8);
+
+        if (length > CRYPTO_SERVER_MAX_PAYLOAD)
+        {
+            client->rxInFrame = false;
+            return;
+        }
+        client->rxNeed = CRYPTO_SERVER_HEADER_SIZE + length + CRYPTO_SERVER_CRC_SIZE;
+    }
+
+    if (client->rxHave == client->rxNeed)
+    {
+        uint32_t end = client->rxNeed - CRYPTO_SERVER_CRC_SIZE;
+        uint16_t crc = CRYPTO_SERVER_CRC_INIT;
+
+        for (uint32_t i = 0U; i < end; i++)
+        {
+            crc = CRYPTO_SERVER_CrcUpdate(crc, frame[i]);
+        }
+
+        client->rxInFrame = false;
+        if (crc == (uint16_t)(frame[end] | (frame[end + 1U] << 8)))
+        {
+            lCRYPTO_CLIENT_Response(client, (uint16_t)(frame[2] | (frame[3] << 8)), (int)(int8_t)frame[1],
+                &frame[CRYPTO_SERVER_HEADER_SIZE], (uint16_t)(end - CRYPTO_SERVER_HEADER_SIZE));
+        }
+    }
+}
+
+/* Read whatever is available and parse it. Returns -1 on error or end of
+ * stream. */
+static int lCRYPTO_CLIENT_Receive(CRYPTO_CLIENT *client)
+{
+    uint8_t buffer[CRYPTO_CLIENT_READ_SIZE];
+    ssize_t count = read(client->fd, buffer, sizeof(buffer));
+
+    if (count < 0)
+    {
+        return ((errno == EAGAIN) || (errno == EINTR)) ? 0 : -1;
+    }
+    if (count == 0)
+    {
+        return -1;
+    }
+
+    for (ssize_t i = 0; i < count; i++)
+    {
+        lCRYPTO_CLIENT_ParseByte(client, buffer[i]);
+    }
+
+    return 0;
+}
+
+/* Write a whole frame, servicing responses meanwhile so neither side can
+ * block the other on a small stream buffer. */
+static int lCRYPTO_CLIENT_WriteAll(CRYPTO_CLIENT *client, const uint8_t *data, uint32_t size)
+{
+    struct pollfd pfd = { .fd = client->fd, .events = POLLIN | POLLOUT };
+
+    while (size > 0U)
+    {
+        int ready = poll(&pfd, 1, client->timeoutMs);
+
+        if (ready == 0)
+        {
+            return -1;
+        }
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+
+        if (((pfd.revents & POLLIN) != 0) && (lCRYPTO_CLIENT_Receive(client) != 0))
+        {
+            return -1;
+        }
+
+        if ((pfd.revents & POLLOUT) != 0)
+        {
+            ssize_t written = write(client->fd, data, size);
+
+            if (written > 0)
+            {
+                data += written;
+                size -= (uint32_t)written;
+            }
+            else if ((errno != EAGAIN) && (errno != EINTR))
+            {
+                return -1;
+            }
+        }
+        else if ((pfd.revents & (POLLERR | POLLHUP)) != 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* Wait until fewer than 'limit' requests are pending. On timeout every
+ * pending request fails. */
+static int lCRYPTO_CLIENT_WaitBelow(CRYPTO_CLIENT *client, uint32_t limit)
+{
+    int64_t deadline = lCRYPTO_CLIENT_NowMs() + client->timeoutMs;
+
+    while ((client->pendingCount >= limit) && (client->pendingCount > 0U))
+    {
+        int64_t left = deadline - lCRYPTO_CLIENT_NowMs();
+        int done;
+
+        if (left <= 0)
+        {
+            lCRYPTO_CLIENT_FailAll(client, CRYPTO_CLIENT_STATUS_TIMEOUT);
+            return -1;
+        }
+
+        done = CRYPTO_CLIENT_Poll(client, (int)left);
+        if (done < 0)
+        {
+            return -1;
+        }
+        if (done > 0)
+        {
+            deadline = lCRYPTO_CLIENT_NowMs() + client->timeoutMs;
+        }
+    }
+
+    return 0;
+}
+
+static void lCRYPTO_CLIENT_CallDone(void *context, int status, const uint8_t *payload, uint16_t length)
+{
+    CRYPTO_CLIENT_CALL *call = context;
+
+    call->done = true;
+    call->status = status;
+    *call->responseLength = 0U;
+
+    if ((payload != NULL) && (length <= call->responseSize))
+    {
+        (void)memcpy(call->response, payload, length);
+        *call->responseLength = length;
+    }
+}
+
+static speed_t lCRYPTO_CLIENT_Speed(uint32_t baudRate)
+{
+    switch (baudRate)
+    {
+        case 9600UL:
+            return B9600;
+        case 57600UL:
+            return B57600;
+        case 230400UL:
+            return B230400;
+#ifdef B460800
+        case 460800UL:
+            return B460800;
+#endif
+#ifdef B921600
+        case 921600UL:
+            return B921600;
+#endif
+        default:
+            return B115200;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Client Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_CLIENT *CRYPTO_CLIENT_Open(const char *path, uint32_t baudRate, int timeoutMs)
+{
+    struct termios tio;
+    int fd = open(path, O_RDWR | O_NOCTTY);
+
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    if (tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        (void)cfsetispeed(&tio, lCRYPTO_CLIENT_Speed(baudRate));
+        (void)cfsetospeed(&tio, lCRYPTO_CLIENT_Speed(baudRate));
+        (void)tcsetattr(fd, TCSANOW, &tio);
+        (void)tcflush(fd, TCIOFLUSH);
+    }
+
+    return CRYPTO_CLIENT_OpenFd(fd, timeoutMs);
+}
+
+CRYPTO_CLIENT *CRYPTO_CLIENT_OpenFd(int fd, int timeoutMs)
+{
+    uint8_t info[16];
+    uint16_t infoLen = 0U;
+    CRYPTO_CLIENT *client = calloc(1U, sizeof(*client));
+
+    if (client == NULL)
+    {
+        (void)close(fd);
+        return NULL;
+    }
+
+    client->fd = fd;
+    client->timeoutMs = timeoutMs;
+    client->window = 1U;
+    (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+    if ((CRYPTO_CLIENT_Call(client, CRYPTO_SERVER_OP_INFO, NULL, 0U, info, sizeof(info), &infoLen)
+            != (int)CRYPTO_SERVER_STATUS_OK) || (infoLen < 4U) || (info[0] != CRYPTO_SERVER_PROTOCOL_VERSION)
+        || (info[1] == 0U))
+    {
+        CRYPTO_CLIENT_Close(client);
+        return NULL;
+    }
+
+    client->window = (info[1] < CRYPTO_CLIENT_MAX_IN_FLIGHT) ? info[1] : CRYPTO_CLIENT_MAX_IN_FLIGHT;
+
+    return client;
+}
+
+void CRYPTO_CLIENT_Close(CRYPTO_CLIENT *client)
+{
+    if (client != NULL)
+    {
+        lCRYPTO_CLIENT_FailAll(client, CRYPTO_CLIENT_STATUS_LOST);
+        (void)close(client->fd);
+        free(client);
+    }
+}
+
+uint32_t CRYPTO_CLIENT_Window(const CRYPTO_CLIENT *client)
+{
+    return client->window;
+}
+
+uint32_t CRYPTO_CLIENT_InFlight(const CRYPTO_CLIENT *client)
+{
+    return client->pendingCount;
+}
+
+int CRYPTO_CLIENT_Submit(CRYPTO_CLIENT *client, crypto_Server_Op_E op, const uint8_t *payload, uint16_t length,
+    CRYPTO_CLIENT_CALLBACK callback, void *context)
+{
+    uint8_t *frame = client->txFrame;
+    uint16_t crc = CRYPTO_SERVER_CRC_INIT;
+    uint32_t size = 1U + CRYPTO_SERVER_HEADER_SIZE + length;
+    CRYPTO_CLIENT_PENDING *entry;
+
+    if ((client->error != 0) || (length > CRYPTO_SERVER_MAX_PAYLOAD) || ((payload == NULL) && (length > 0U)))
+    {
+        return -1;
+    }
+
+    if (lCRYPTO_CLIENT_WaitBelow(client, client->window) != 0)
+    {
+        return -1;
+    }
+
+    entry = &client->pending[(client->pendingHead + client->pendingCount) % CRYPTO_CLIENT_MAX_IN_FLIGHT];
+    entry->tag = client->nextTag++;
+    entry->callback = callback;
+    entry->context = context;
+    client->pendingCount++;
+
+    frame[0] = CRYPTO_SERVER_SOF;
+    frame[1] = (uint8_t)op;
+    frame[2] = 0U;
+    frame[3] = (uint8_t)entry->tag;
+    frame[4] = (uint8_t)(entry->tag >> 8);
+    frame[5] = (uint8_t)length;
+    frame[6] = (uint8_t)(length >> 8);
+    if (length > 0U)
+    {
+        (void)memcpy(&frame[7], payload, length);
+    }
+    for (uint32_t i = 1U; i < size; i++)
+    {
+        crc = CRYPTO_SERVER_CrcUpdate(crc, frame[i]);
+    }
+    frame[size] = (uint8_t)crc;
+    frame[size + 1U] = (uint8_t)(crc >> 8);
+
+    if (lCRYPTO_CLIENT_WriteAll(client, frame, size + CRYPTO_SERVER_CRC_SIZE) != 0)
+    {
+        client->error = -1;
+        lCRYPTO_CLIENT_FailAll(client, CRYPTO_CLIENT_STATUS_LOST);
+        return -1;
+    }
+
+    return 0;
+}
+
+int CRYPTO_CLIENT_Poll(CRYPTO_CLIENT *client, int timeoutMs)
+{
+    struct pollfd pfd = { .fd = client->fd, .events = POLLIN };
+    uint32_t before = client->completed;
+    int ready;
+
+    if (client->error != 0)
+    {
+        return -1;
+    }
+
+    ready = poll(&pfd, 1, timeoutMs);
+    if ((ready < 0) && (errno != EINTR))
+    {
+        client->error = -1;
+    }
+    else if ((ready > 0) && (lCRYPTO_CLIENT_Receive(client) != 0))
+    {
+        client->error = -1;
+    }
+
+    if (client->error != 0)
+    {
+        lCRYPTO_CLIENT_FailAll(client, CRYPTO_CLIENT_STATUS_LOST);
+        return -1;
+    }
+
+    return (int)(client->completed - before);
+}
+
+int CRYPTO_CLIENT_Drain(CRYPTO_CLIENT *client)
+{
+    return lCRYPTO_CLIENT_WaitBelow(client, 1U);
+}
+
+int CRYPTO_CLIENT_Call(CRYPTO_CLIENT *client, crypto_Server_Op_E op, const uint8_t *payload, uint16_t length,
+    uint8_t *response, uint16_t responseSize, uint16_t *responseLength)
+{
+    CRYPTO_CLIENT_CALL call = { false, CRYPTO_CLIENT_STATUS_LOST, response, responseSize, responseLength };
+
+    if (CRYPTO_CLIENT_Submit(client, op, payload, length, lCRYPTO_CLIENT_CallDone, &call) != 0)
+    {
+        return call.done ? call.status : CRYPTO_CLIENT_STATUS_LOST;
+    }
+
+    while (call.done == false)
+    {
+        if (lCRYPTO_CLIENT_WaitBelow(client, client->pendingCount) != 0)
+        {
+            break;
+        }
+    }
+
+    return call.status;
+}
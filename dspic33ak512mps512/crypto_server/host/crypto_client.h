@@ -0,0 +1,151 @@
+/*******************************************************************************
+  Crypto Offload Client Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_client.h
+
+  Summary:
+    Host client library for the crypto offload server.
+
+  Description:
+    Requests are submitted asynchronously: CRYPTO_CLIENT_Submit() frames and
+    sends a request and returns immediately, and the callback runs from
+    CRYPTO_CLIENT_Poll() when the matching response arrives. Up to the
+    server's slot count (read with CRYPTO_SERVER_OP_INFO when the client is
+    opened) requests are kept in flight; Submit() services responses while
+    it waits for a free slot. The library is not thread-safe; use one client
+    per thread.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_CLIENT_H
+#define CRYPTO_CLIENT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "app/crypto_server_protocol.h"
+
+// Status passed to callbacks when no response arrived before the timeout.
+#define CRYPTO_CLIENT_STATUS_TIMEOUT    (-100)
+// Status passed to callbacks whose response was lost (tag skipped).
+#define CRYPTO_CLIENT_STATUS_LOST       (-101)
+
+// Upper bound on the in-flight window, whatever the server reports.
+#define CRYPTO_CLIENT_MAX_IN_FLIGHT     (64U)
+
+typedef struct CRYPTO_CLIENT CRYPTO_CLIENT;
+
+/**
+ * @brief Completion callback.
+ * @param context The context passed to CRYPTO_CLIENT_Submit().
+ * @param status A crypto_Server_Status_E value, or one of the
+ *        CRYPTO_CLIENT_STATUS_* values.
+ * @param payload The response payload (valid only during the callback).
+ * @param length The response payload length.
+ */
+typedef void (*CRYPTO_CLIENT_CALLBACK)(void *context, int status, const uint8_t *payload, uint16_t length);
+
+/**
+ * @brief Open a serial device or pty and query the server.
+ * @param path Device path.
+ * @param baudRate Line rate applied to real serial ports.
+ * @param timeoutMs Response timeout for every request.
+ * @return The client, or NULL on failure.
+ */
+CRYPTO_CLIENT *CRYPTO_CLIENT_Open(const char *path, uint32_t baudRate, int timeoutMs);
+
+/**
+ * @brief Wrap an already connected byte stream and query the server.
+ * @param fd The stream; the client takes ownership.
+ * @param timeoutMs Response timeout for every request.
+ * @return The client, or NULL on failure.
+ */
+CRYPTO_CLIENT *CRYPTO_CLIENT_OpenFd(int fd, int timeoutMs);
+
+/**
+ * @brief Close the stream and free the client. Pending requests are
+ *        completed with CRYPTO_CLIENT_STATUS_LOST.
+ */
+void CRYPTO_CLIENT_Close(CRYPTO_CLIENT *client);
+
+/**
+ * @brief Number of requests the client keeps in flight.
+ */
+uint32_t CRYPTO_CLIENT_Window(const CRYPTO_CLIENT *client);
+
+/**
+ * @brief Number of requests currently awaiting a response.
+ */
+uint32_t CRYPTO_CLIENT_InFlight(const CRYPTO_CLIENT *client);
+
+/**
+ * @brief Send a request without waiting for its response.
+ * @param op The operation.
+ * @param payload Request payload (see crypto_server_protocol.h).
+ * @param length Payload length, at most CRYPTO_SERVER_MAX_PAYLOAD.
+ * @param callback Called once with the result; may be NULL.
+ * @param context Passed to the callback.
+ * @return 0 on success, -1 on an I/O error, timeout or bad argument.
+ */
+int CRYPTO_CLIENT_Submit(CRYPTO_CLIENT *client, crypto_Server_Op_E op, const uint8_t *payload, uint16_t length,
+    CRYPTO_CLIENT_CALLBACK callback, void *context);
+
+/**
+ * @brief Process received responses and run their callbacks.
+ * @param timeoutMs How long to wait for the first response (0 to not wait).
+ * @return The number of completed requests, or -1 on an I/O error.
+ */
+int CRYPTO_CLIENT_Poll(CRYPTO_CLIENT *client, int timeoutMs);
+
+/**
+ * @brief Wait until every submitted request has completed.
+ * @return 0 on success, -1 if requests timed out or an I/O error occurred.
+ */
+int CRYPTO_CLIENT_Drain(CRYPTO_CLIENT *client);
+
+/**
+ * @brief Submit one request and wait for its response.
+ * @param response Buffer for the response payload.
+ * @param responseSize Size of the response buffer.
+ * @param responseLength Receives the response payload length.
+ * @return The response status, or a CRYPTO_CLIENT_STATUS_* value.
+ */
+int CRYPTO_CLIENT_Call(CRYPTO_CLIENT *client, crypto_Server_Op_E op, const uint8_t *payload, uint16_t length,
+    uint8_t *response, uint16_t responseSize, uint16_t *responseLength);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_CLIENT_H */
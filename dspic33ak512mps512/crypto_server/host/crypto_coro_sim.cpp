@@ -0,0 +1,393 @@
+/*******************************************************************************
+  Crypto Coroutine Simulation Host Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_coro_sim.cpp
+
+  Summary:
+    Runs coroutine tasks on the C++ executor (crypto_cam_coro.hpp) against a
+    simulated CAM whose operations complete from an interrupt.
+
+  Description:
+    The simulated driver computes each result with cam::CamDriver and the
+    Crypto_* stand-in when the operation starts, then returns
+    cam::detail::pending and keeps the engine busy for the time set with -a
+    (AES and SHA) or -p (PKE). A POSIX interval timer stands for the
+    CRYPTO1 and CRYPTO3 interrupts: its SIGALRM handler ends the operations
+    whose time is up and calls the completion hooks registered by
+    Executor::attach(), as _CRYPTO1Interrupt() and _CRYPTO3Interrupt() do on
+    the board. Crypto_Int_Hw_Lock() blocks SIGALRM.
+
+    Seal tasks encrypt and decrypt with AES-GCM, verify tasks hash, sign and
+    verify with ECDSA P-384, and a ticker task yields in a loop to show that
+    other tasks keep running while operations are in flight. The run fails
+    if any status is not success or a decrypted message differs.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#include <csignal>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "crypto/common_crypto/crypto_cam_coro.hpp"
+
+#define SIM_MAX_TASKS           (CRYPTO_CAM_EXECUTOR_TASKS - 1U)
+#define SIM_PAYLOAD             (256U)
+#define SIM_TICK_US             (50L)
+
+using Gcm = cam::Aes<cam::Mode::Gcm, cam::KeySize::k128>;
+using EcdsaP384 = cam::Ecdsa<cam::Curve::P384>;
+
+typedef struct
+{
+    volatile sig_atomic_t busy;     // Operation running
+    volatile sig_atomic_t done;     // Result ready for poll()
+    std::int32_t status;
+    std::uint64_t deadlineNs;
+    std::uint64_t busyNs;           // Sum of the operation times
+} sim_Engine;
+
+static sim_Engine simEngines[cam::detail::engineCount];
+static crypto_Int_Completion simCompletions[CRYPTO3_INT + 1];
+static void *simContexts[CRYPTO3_INT + 1];
+static long simAesUs = 200L;
+static long simPkeUs = 19000L;
+
+static std::size_t simMaxInFlight;
+static unsigned long simOperations;
+static unsigned long simErrors;
+static unsigned long simTicks;
+
+static std::uint64_t simNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (static_cast<std::uint64_t>(now.tv_sec) * 1000000000ULL) + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Simulated Interrupts
+// *****************************************************************************
+// *****************************************************************************
+
+extern "C" crypto_Int_Status_E Crypto_Int_Hw_Register_Completion(crypto_Int_Handler_Id handlerID,
+    crypto_Int_Completion completion, void *context)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+
+    if ((handlerID < CRYPTO1_INT) || (handlerID > CRYPTO3_INT))
+    {
+        status = CRYPTO_INT_INVALID_ID;
+    }
+    else if ((completion != nullptr) && (simCompletions[handlerID] != nullptr))
+    {
+        status = CRYPTO_INT_ALREADY_REGISTERED;
+    }
+    else
+    {
+        std::uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        simCompletions[handlerID] = completion;
+        simContexts[handlerID] = context;
+        Crypto_Int_Hw_Unlock(lockState);
+    }
+    return status;
+}
+
+extern "C" std::uint32_t Crypto_Int_Hw_Lock(void)
+{
+    sigset_t block;
+    sigset_t previous;
+
+    (void)sigemptyset(&block);
+    (void)sigaddset(&block, SIGALRM);
+    (void)sigprocmask(SIG_BLOCK, &block, &previous);
+
+    return (sigismember(&previous, SIGALRM) == 1) ? 1U : 0U;
+}
+
+extern "C" void Crypto_Int_Hw_Unlock(std::uint32_t lockState)
+{
+    if (lockState == 0U)
+    {
+        sigset_t block;
+
+        (void)sigemptyset(&block);
+        (void)sigaddset(&block, SIGALRM);
+        (void)sigprocmask(SIG_UNBLOCK, &block, nullptr);
+    }
+}
+
+static void simInterrupt(int signo)
+{
+    static const crypto_Int_Handler_Id vectors[cam::detail::engineCount] = { CRYPTO1_INT, CRYPTO3_INT };
+    std::uint64_t now = simNowNs();
+
+    (void)signo;
+    for (std::size_t e = 0U; e < cam::detail::engineCount; e++)
+    {
+        if ((simEngines[e].busy != 0) && (now >= simEngines[e].deadlineNs))
+        {
+            simEngines[e].busy = 0;
+            simEngines[e].done = 1;
+            if (simCompletions[vectors[e]] != nullptr)
+            {
+                simCompletions[vectors[e]](simContexts[vectors[e]]);
+            }
+        }
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Simulated Driver
+// *****************************************************************************
+// *****************************************************************************
+
+struct SimDriver
+{
+    template <typename Args>
+    static std::int32_t start(const Args &args) noexcept
+    {
+        cam::Engine engine = engineOf(args);
+        sim_Engine &sim = simEngines[static_cast<std::size_t>(engine)];
+        std::uint64_t ns = static_cast<std::uint64_t>((engine == cam::Engine::Pke) ? simPkeUs : simAesUs) * 1000ULL;
+
+        sim.status = cam::CamDriver::start(args);
+        sim.done = 0;
+        sim.deadlineNs = simNowNs() + ns;
+        sim.busyNs += ns;
+        sim.busy = 1;
+        simOperations++;
+
+        return cam::detail::pending;
+    }
+
+    static std::int32_t poll(cam::Engine engine) noexcept
+    {
+        sim_Engine &sim = simEngines[static_cast<std::size_t>(engine)];
+        std::int32_t status = cam::detail::pending;
+
+        if (sim.done != 0)
+        {
+            sim.done = 0;
+            status = sim.status;
+        }
+        return status;
+    }
+
+private:
+    static cam::Engine engineOf(const cam::detail::AeadArgs &) noexcept { return cam::Engine::Sym; }
+    static cam::Engine engineOf(const cam::detail::HashArgs &) noexcept { return cam::Engine::Sym; }
+    static cam::Engine engineOf(const cam::detail::SignArgs &) noexcept { return cam::Engine::Pke; }
+    static cam::Engine engineOf(const cam::detail::VerifyArgs &) noexcept { return cam::Engine::Pke; }
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Tasks
+// *****************************************************************************
+// *****************************************************************************
+
+static cam::Executor simExecutor;
+
+static void simCheck(bool ok)
+{
+    simErrors += ok ? 0UL : 1UL;
+
+    std::size_t inFlight = simExecutor.inFlight();
+    simMaxInFlight = (inFlight > simMaxInFlight) ? inFlight : simMaxInFlight;
+}
+
+static cam::Task simSealTask(unsigned id, unsigned rounds)
+{
+    Gcm::Key key;
+    std::uint8_t iv[12];
+    std::uint8_t aad[16];
+    std::uint8_t plain[SIM_PAYLOAD];
+    std::uint8_t cipher[SIM_PAYLOAD];
+    std::uint8_t decrypted[SIM_PAYLOAD];
+    Gcm::Tag tag;
+
+    for (std::size_t i = 0U; i < key.size(); i++)
+    {
+        key[i] = static_cast<std::uint8_t>(id + i);
+    }
+    (void)std::memset(aad, static_cast<int>(id), sizeof(aad));
+
+    for (unsigned round = 0U; round < rounds; round++)
+    {
+        (void)std::memset(iv, static_cast<int>(round), sizeof(iv));
+        (void)std::memset(plain, static_cast<int>(id ^ round), sizeof(plain));
+
+        crypto_Aead_Status_E status = co_await cam::seal<SimDriver>(key, iv, aad, plain, cipher, tag);
+        simCheck(status == CRYPTO_AEAD_CIPHER_SUCCESS);
+
+        status = co_await cam::open<SimDriver>(key, iv, aad, cipher, decrypted, tag);
+        simCheck((status == CRYPTO_AEAD_CIPHER_SUCCESS) && (std::memcmp(plain, decrypted, sizeof(plain)) == 0));
+    }
+}
+
+static cam::Task simVerifyTask(unsigned id, unsigned rounds)
+{
+    EcdsaP384::PrivateKey privateKey;
+    EcdsaP384::PublicKey publicKey;
+    EcdsaP384::Signature signature;
+    cam::Sha<cam::Algo::Sha384>::Digest hash;
+    std::uint8_t message[SIM_PAYLOAD];
+
+    (void)std::memset(privateKey.data(), static_cast<int>(id), privateKey.size());
+    (void)std::memset(publicKey.data(), static_cast<int>(id), publicKey.size());
+    publicKey[0] = 0x04U;
+
+    for (unsigned round = 0U; round < rounds; round++)
+    {
+        (void)std::memset(message, static_cast<int>(id + round), sizeof(message));
+
+        crypto_Hash_Status_E hashStatus = co_await cam::digest<cam::Algo::Sha384, SimDriver>(message, hash);
+        simCheck(hashStatus == CRYPTO_HASH_SUCCESS);
+
+        crypto_DigiSign_Status_E status = co_await cam::sign<cam::Curve::P384, SimDriver>(hash, privateKey, signature);
+        simCheck(status == CRYPTO_DIGISIGN_SUCCESS);
+
+        status = co_await cam::verify<cam::Curve::P384, SimDriver>(hash, signature, publicKey);
+        simCheck(status == CRYPTO_DIGISIGN_SUCCESS);
+    }
+}
+
+// Runs until it is the only task left.
+static cam::Task simTickerTask(void)
+{
+    while (simExecutor.tasks() > 1U)
+    {
+        std::size_t inFlight = simExecutor.inFlight();
+
+        simMaxInFlight = (inFlight > simMaxInFlight) ? inFlight : simMaxInFlight;
+        simTicks++;
+        co_await simExecutor.yield();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned sealTasks = 8U;
+    unsigned verifyTasks = 4U;
+    unsigned rounds = 10U;
+    struct sigaction action;
+    struct itimerval timer;
+    std::uint64_t start;
+    double seconds;
+    double busySym;
+    double busyPke;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:v:r:a:p:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                sealTasks = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+                break;
+            case 'v':
+                verifyTasks = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+                break;
+            case 'r':
+                rounds = static_cast<unsigned>(std::strtoul(optarg, nullptr, 10));
+                break;
+            case 'a':
+                simAesUs = std::strtol(optarg, nullptr, 10);
+                break;
+            case 'p':
+                simPkeUs = std::strtol(optarg, nullptr, 10);
+                break;
+            default:
+                std::fprintf(stderr, "usage: %s [-s seal_tasks] [-v verify_tasks] [-r rounds] [-a aes_us] "
+                    "[-p pke_us]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if ((sealTasks + verifyTasks) > SIM_MAX_TASKS)
+    {
+        std::fprintf(stderr, "crypto_coro_sim: at most %u seal and verify tasks\n", SIM_MAX_TASKS);
+        return 2;
+    }
+
+    (void)std::memset(&action, 0, sizeof(action));
+    action.sa_handler = &simInterrupt;
+    (void)sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    (void)sigaction(SIGALRM, &action, nullptr);
+
+    if (simExecutor.attach() != CRYPTO_INT_SUCCESS)
+    {
+        std::fprintf(stderr, "crypto_coro_sim: completion hooks already registered\n");
+        return 1;
+    }
+
+    for (unsigned i = 0U; i < sealTasks; i++)
+    {
+        (void)simExecutor.spawn(simSealTask(i, rounds));
+    }
+    for (unsigned i = 0U; i < verifyTasks; i++)
+    {
+        (void)simExecutor.spawn(simVerifyTask(i, rounds));
+    }
+    (void)simExecutor.spawn(simTickerTask());
+
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = SIM_TICK_US;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, nullptr);
+
+    start = simNowNs();
+    simExecutor.run();
+    seconds = static_cast<double>(simNowNs() - start) / 1.0e9;
+
+    (void)std::memset(&timer, 0, sizeof(timer));
+    (void)setitimer(ITIMER_REAL, &timer, nullptr);
+    simExecutor.detach();
+
+    busySym = static_cast<double>(simEngines[static_cast<std::size_t>(cam::Engine::Sym)].busyNs) / 1.0e9;
+    busyPke = static_cast<double>(simEngines[static_cast<std::size_t>(cam::Engine::Pke)].busyNs) / 1.0e9;
+    std::printf("tasks,operations,max_in_flight,errors,seconds,sym_busy_s,pke_busy_s,serial_s,ticker_turns\n");
+    std::printf("%u,%lu,%zu,%lu,%.3f,%.3f,%.3f,%.3f,%lu\n", sealTasks + verifyTasks + 1U, simOperations,
+        simMaxInFlight, simErrors, seconds, busySym, busyPke, busySym + busyPke, simTicks);
+
+    return (simErrors == 0UL) ? 0 : 1;
+}
@@ -0,0 +1,411 @@
+/*******************************************************************************
+  Crypto C++ Interface Benchmark Host Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cpp_bench.cpp
+
+  Summary:
+    Times the same operations through the Crypto_* C API and through the C++
+    interface (crypto/common_crypto/crypto_cam.hpp) on Linux with the
+    Crypto_* stand-in.
+
+  Description:
+    Each row runs one operation -n times through each interface, takes the
+    best of BENCH_REPEATS alternating runs per interface to drop scheduler
+    noise and prints the time per operation. The stand-in is built as a separate C object, so both sides
+    make the same out-of-line calls and the difference is the cost of the C++
+    layer only. The C side is written as careful C code: contexts are zeroed
+    before use and wiped after, as the C++ contexts do in their constructor
+    and destructor. The outputs of both sides are compared; any difference
+    fails the run.
+
+    The stand-in is not the CAM: the times are host times of the calls, not
+    the times of the operations on the board.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+#include <unistd.h>
+
+#include "crypto/common_crypto/crypto_cam.hpp"
+
+#define BENCH_REPEATS           (7U)
+#define BENCH_MAX_PAYLOAD       (4096U)
+#define BENCH_GCM_IV_SIZE       (12U)
+#define BENCH_GCM_AAD_SIZE      (16U)
+
+using Gcm = cam::Aes<cam::Mode::Gcm, cam::KeySize::k128>;
+using Sha256 = cam::Sha<cam::Algo::Sha256>;
+using EcdsaP256 = cam::Ecdsa<cam::Curve::P256>;
+
+// Inputs; the values do not matter.
+static Gcm::Key benchKey;
+static std::uint8_t benchIv[BENCH_GCM_IV_SIZE];
+static std::uint8_t benchAad[BENCH_GCM_AAD_SIZE];
+static std::uint8_t benchData[BENCH_MAX_PAYLOAD];
+static EcdsaP256::PrivateKey benchPrivKey;
+static std::uint32_t benchPayload = 256U;
+
+// Outputs of the C side and of the C++ side.
+static std::uint8_t benchOutC[BENCH_MAX_PAYLOAD];
+static std::uint8_t benchOutCpp[BENCH_MAX_PAYLOAD];
+static Gcm::Tag benchTagC;
+static Gcm::Tag benchTagCpp;
+static Sha256::Digest benchDigestC;
+static Sha256::Digest benchDigestCpp;
+static EcdsaP256::Signature benchSigC;
+static EcdsaP256::Signature benchSigCpp;
+
+// Statuses that are not success, per side.
+static unsigned long benchErrorsC;
+static unsigned long benchErrorsCpp;
+
+typedef struct
+{
+    const char *op;
+    bool payload;           // The op processes benchPayload bytes
+    void (*cOp)(void);
+    void (*cppOp)(void);
+    const std::uint8_t *cOut;
+    const std::uint8_t *cppOut;
+    std::size_t outLen;     // Bytes of output to compare, 0 for the payload size
+    const std::uint8_t *cTag;
+    const std::uint8_t *cppTag;
+} bench_Row;
+
+static std::uint64_t benchNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (static_cast<std::uint64_t>(now.tv_sec) * 1000000000ULL) + static_cast<std::uint64_t>(now.tv_nsec);
+}
+
+// Same zeroization as the C++ contexts, so both sides do the same work.
+static void benchWipe(void *ptr, std::size_t len)
+{
+    volatile std::uint8_t *byte = static_cast<volatile std::uint8_t *>(ptr);
+
+    while (len > 0U)
+    {
+        *byte = 0U;
+        byte++;
+        len--;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: C API
+// *****************************************************************************
+// *****************************************************************************
+
+__attribute__((noinline)) static void benchShaStreamC(void)
+{
+    st_Crypto_Hash_Sha_Ctx ctx;
+    crypto_Hash_Status_E status;
+
+    (void)std::memset(&ctx, 0, sizeof(ctx));
+    status = Crypto_Hash_Sha_Init(&ctx, CRYPTO_HASH_SHA2_256, CRYPTO_HANDLER_HW_INTERNAL, 1U);
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Update(&ctx, benchData, benchPayload);
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = Crypto_Hash_Sha_Final(&ctx, benchDigestC.data());
+    }
+    benchWipe(&ctx, sizeof(ctx));
+    benchErrorsC += (status != CRYPTO_HASH_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchShaDigestC(void)
+{
+    crypto_Hash_Status_E status = Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, benchData, benchPayload,
+        benchDigestC.data(), CRYPTO_HASH_SHA2_256, 1U);
+
+    benchErrorsC += (status != CRYPTO_HASH_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchGcmStreamC(void)
+{
+    st_Crypto_Aead_AesGcm_ctx ctx;
+    crypto_Aead_Status_E status;
+
+    (void)std::memset(&ctx, 0, sizeof(ctx));
+    status = Crypto_Aead_AesGcm_Init(&ctx, CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_CIOP_ENCRYPT, benchKey.data(),
+        static_cast<std::uint32_t>(benchKey.size()), benchIv, sizeof(benchIv), 1U);
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = Crypto_Aead_AesGcm_AddAadData(&ctx, benchAad, sizeof(benchAad));
+    }
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = Crypto_Aead_AesGcm_Cipher(&ctx, benchData, benchPayload, benchOutC);
+    }
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = Crypto_Aead_AesGcm_Final(&ctx, benchTagC.data(), static_cast<std::uint8_t>(benchTagC.size()));
+    }
+    benchWipe(&ctx, sizeof(ctx));
+    benchErrorsC += (status != CRYPTO_AEAD_CIPHER_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchGcmSealC(void)
+{
+    crypto_Aead_Status_E status = Crypto_Aead_AesGcm_EncryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, benchData,
+        benchPayload, benchOutC, benchKey.data(), static_cast<std::uint32_t>(benchKey.size()), benchIv,
+        sizeof(benchIv), benchAad, sizeof(benchAad), benchTagC.data(), static_cast<std::uint8_t>(benchTagC.size()), 1U);
+
+    benchErrorsC += (status != CRYPTO_AEAD_CIPHER_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchEcdsaSignC(void)
+{
+    crypto_DigiSign_Status_E status = Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, benchDigestC.data(),
+        static_cast<std::uint32_t>(benchDigestC.size()), benchSigC.data(), static_cast<std::uint32_t>(benchSigC.size()),
+        benchPrivKey.data(), static_cast<std::uint32_t>(benchPrivKey.size()), CRYPTO_ECC_CURVE_P256, 1U);
+
+    benchErrorsC += (status != CRYPTO_DIGISIGN_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchContextC(void)
+{
+    st_Crypto_Aead_AesGcm_ctx ctx;
+
+    (void)std::memset(&ctx, 0, sizeof(ctx));
+    __asm__ volatile ("" : : "r"(&ctx) : "memory");
+    benchWipe(&ctx, sizeof(ctx));
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: C++ Interface
+// *****************************************************************************
+// *****************************************************************************
+
+__attribute__((noinline)) static void benchShaStreamCpp(void)
+{
+    Sha256 sha;
+    crypto_Hash_Status_E status = sha.init();
+
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = sha.update(cam::ConstBytes(benchData, benchPayload));
+    }
+    if (status == CRYPTO_HASH_SUCCESS)
+    {
+        status = sha.final(benchDigestCpp);
+    }
+    benchErrorsCpp += (status != CRYPTO_HASH_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchShaDigestCpp(void)
+{
+    crypto_Hash_Status_E status = Sha256::digest(cam::ConstBytes(benchData, benchPayload), benchDigestCpp);
+
+    benchErrorsCpp += (status != CRYPTO_HASH_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchGcmStreamCpp(void)
+{
+    Gcm gcm;
+    crypto_Aead_Status_E status = gcm.init(cam::Direction::Encrypt, benchKey, benchIv);
+
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = gcm.aad(benchAad);
+    }
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = gcm.update(cam::ConstBytes(benchData, benchPayload), cam::Bytes(benchOutCpp, benchPayload));
+    }
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        status = gcm.final(benchTagCpp);
+    }
+    benchErrorsCpp += (status != CRYPTO_AEAD_CIPHER_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchGcmSealCpp(void)
+{
+    crypto_Aead_Status_E status = Gcm::seal(benchKey, benchIv, benchAad, cam::ConstBytes(benchData, benchPayload),
+        cam::Bytes(benchOutCpp, benchPayload), benchTagCpp);
+
+    benchErrorsCpp += (status != CRYPTO_AEAD_CIPHER_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchEcdsaSignCpp(void)
+{
+    crypto_DigiSign_Status_E status = EcdsaP256::sign(benchDigestCpp, benchPrivKey, benchSigCpp);
+
+    benchErrorsCpp += (status != CRYPTO_DIGISIGN_SUCCESS) ? 1UL : 0UL;
+}
+
+__attribute__((noinline)) static void benchContextCpp(void)
+{
+    Gcm gcm;
+
+    __asm__ volatile ("" : : "r"(&gcm) : "memory");
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark
+// *****************************************************************************
+// *****************************************************************************
+
+static const bench_Row benchRows[] =
+{
+    { "sha256_stream", true, benchShaStreamC, benchShaStreamCpp, benchDigestC.data(), benchDigestCpp.data(), 32U,
+        nullptr, nullptr },
+    { "sha256_digest", true, benchShaDigestC, benchShaDigestCpp, benchDigestC.data(), benchDigestCpp.data(), 32U,
+        nullptr, nullptr },
+    { "gcm_stream", true, benchGcmStreamC, benchGcmStreamCpp, benchOutC, benchOutCpp, 0U,
+        benchTagC.data(), benchTagCpp.data() },
+    { "gcm_seal", true, benchGcmSealC, benchGcmSealCpp, benchOutC, benchOutCpp, 0U,
+        benchTagC.data(), benchTagCpp.data() },
+    { "ecdsa_sign_p256", false, benchEcdsaSignC, benchEcdsaSignCpp, benchSigC.data(), benchSigCpp.data(), 64U,
+        nullptr, nullptr },
+    { "gcm_context", false, benchContextC, benchContextCpp, nullptr, nullptr, 0U, nullptr, nullptr },
+};
+
+// Time per call of iterations calls, in ns.
+static double benchTime(void (*op)(void), unsigned long iterations)
+{
+    std::uint64_t start = benchNowNs();
+
+    for (unsigned long i = 0UL; i < iterations; i++)
+    {
+        op();
+    }
+
+    return static_cast<double>(benchNowNs() - start) / static_cast<double>(iterations);
+}
+
+/* Best of BENCH_REPEATS runs of each side. The runs of the two sides
+ * alternate, so a slow period of the host affects both. */
+static void benchRun(const bench_Row *row, unsigned long iterations, double *ptr_cNs, double *ptr_cppNs)
+{
+    *ptr_cNs = 1.0e30;
+    *ptr_cppNs = 1.0e30;
+
+    for (std::uint32_t repeat = 0U; repeat < BENCH_REPEATS; repeat++)
+    {
+        double cNs = benchTime(row->cOp, iterations);
+        double cppNs = benchTime(row->cppOp, iterations);
+
+        *ptr_cNs = (cNs < *ptr_cNs) ? cNs : *ptr_cNs;
+        *ptr_cppNs = (cppNs < *ptr_cppNs) ? cppNs : *ptr_cppNs;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long iterations = 100000UL;
+    const char *only = nullptr;
+    int mismatches = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:p:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                iterations = std::strtoul(optarg, nullptr, 10);
+                break;
+            case 'p':
+                benchPayload = static_cast<std::uint32_t>(std::strtoul(optarg, nullptr, 10));
+                break;
+            case 'o':
+                only = optarg;
+                break;
+            default:
+                std::fprintf(stderr, "usage: %s [-n iterations] [-p payload_bytes] [-o op]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if ((iterations == 0UL) || (benchPayload == 0U) || (benchPayload > BENCH_MAX_PAYLOAD))
+    {
+        std::fprintf(stderr, "crypto_cpp_bench: -n must be above 0 and -p from 1 to %u\n", BENCH_MAX_PAYLOAD);
+        return 2;
+    }
+
+    for (std::size_t i = 0U; i < sizeof(benchData); i++)
+    {
+        benchData[i] = static_cast<std::uint8_t>(i);
+    }
+    for (std::size_t i = 0U; i < benchKey.size(); i++)
+    {
+        benchKey[i] = static_cast<std::uint8_t>(0xA0U + i);
+    }
+    for (std::size_t i = 0U; i < benchPrivKey.size(); i++)
+    {
+        benchPrivKey[i] = static_cast<std::uint8_t>(0x50U + i);
+    }
+
+    std::printf("op,payload_bytes,iterations,c_ns,cpp_ns,overhead_pct\n");
+    for (const bench_Row &row : benchRows)
+    {
+        double cNs;
+        double cppNs;
+        std::size_t outLen = (row.outLen == 0U) ? benchPayload : row.outLen;
+
+        if ((only != nullptr) && (std::strncmp(row.op, only, std::strlen(only)) != 0))
+        {
+            continue;
+        }
+
+        benchRun(&row, iterations, &cNs, &cppNs);
+        std::printf("%s,%u,%lu,%.1f,%.1f,%.1f\n", row.op, row.payload ? benchPayload : 0U, iterations, cNs, cppNs,
+            (cNs > 0.0) ? (((cppNs - cNs) * 100.0) / cNs) : 0.0);
+
+        if (((row.cOut != nullptr) && (std::memcmp(row.cOut, row.cppOut, outLen) != 0)) ||
+            ((row.cTag != nullptr) && (std::memcmp(row.cTag, row.cppTag, Gcm::tagBytes) != 0)))
+        {
+            std::fprintf(stderr, "crypto_cpp_bench: %s: C and C++ outputs differ\n", row.op);
+            mismatches++;
+        }
+    }
+
+    if ((benchErrorsC != 0UL) || (benchErrorsCpp != 0UL))
+    {
+        std::fprintf(stderr, "crypto_cpp_bench: %lu C and %lu C++ calls failed\n", benchErrorsC, benchErrorsCpp);
+        mismatches++;
+    }
+
+    return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,360 @@
+/*******************************************************************************
+  Crypto Digest Cache Host Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_digest_cache_bench.c
+
+  Summary:
+    Times the attestation of a flash region through the digest cache
+    (crypto_digest_cache.c) on Linux, with a file as the program flash.
+
+  Description:
+    The region is written to a file that is mapped as the flash. Each run
+    attests it once to fill the cache, changes 0 %, 1 % or 100 % of its pages
+    through the mapping, reporting each write with
+    CRYPTO_DIGEST_CACHE_FlashWritten(), and times the next attestation. The
+    "full" row times one Crypto_Hash_Sha_Digest() over the whole region, the
+    way the region was attested without the cache. The Crypto_* stand-in
+    models the SHA engine time with CRYPTO_STANDIN_NS_PER_BYTE.
+
+    One CSV row is written per case:
+      case,region_bytes,pages,pages_hashed,runs,best_us,mean_us
+    After each change the cached digest is checked against the digest of a
+    newly registered copy of the region and against the digest before the
+    change; the tool exits with 1 when one does not match.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "app/crypto_digest_cache.h"
+
+#define CACHE_ALGORITHM         CRYPTO_HASH_SHA2_384
+#define CACHE_DIGEST_LEN        (48U)
+#define CACHE_MAX_BYTES         (16UL * 1024UL * 1024UL)
+#define CACHE_MAX_PAGES         CRYPTO_DIGEST_CACHE_PAGE_COUNT(CACHE_MAX_BYTES)
+
+static uint8_t *cacheFlash;
+static size_t cacheFlashSize;
+
+static CRYPTO_DIGEST_CACHE_REGION cacheRegion;
+static CRYPTO_DIGEST_CACHE_PAGE cachePages[CACHE_MAX_PAGES];
+static uint8_t cachePageDigests[CACHE_MAX_PAGES * CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+
+static CRYPTO_DIGEST_CACHE_REGION checkRegion;
+static CRYPTO_DIGEST_CACHE_PAGE checkPages[CACHE_MAX_PAGES];
+static uint8_t checkPageDigests[CACHE_MAX_PAGES * CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Digest Cache Port
+// *****************************************************************************
+// *****************************************************************************
+
+uint8_t *CRYPTO_DIGEST_CACHE_PORT_Flash(uint32_t address, uint32_t length)
+{
+    if (((size_t)address > cacheFlashSize) || ((size_t)length > (cacheFlashSize - (size_t)address)))
+    {
+        return NULL;
+    }
+
+    return cacheFlash + address;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Flash Image
+// *****************************************************************************
+// *****************************************************************************
+
+// Write regionBytes pseudo-random bytes to path and map the file.
+static int lCache_FlashCreate(const char *path, uint32_t regionBytes)
+{
+    uint8_t block[4096];
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    size_t done = 0U;
+    void *map;
+    int fd;
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (done < regionBytes)
+    {
+        size_t len = ((regionBytes - done) < sizeof(block)) ? (regionBytes - done) : sizeof(block);
+
+        for (size_t i = 0U; i < len; i++)
+        {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            block[i] = (uint8_t)(x >> 32);
+        }
+        if (write(fd, block, len) != (ssize_t)len)
+        {
+            perror(path);
+            (void)close(fd);
+            return -1;
+        }
+        done += len;
+    }
+
+    map = mmap(NULL, regionBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        return -1;
+    }
+
+    cacheFlash = (uint8_t *)map;
+    cacheFlashSize = regionBytes;
+
+    return 0;
+}
+
+// Program one byte in each of count pages spread over the region.
+static void lCache_Change(uint32_t pageCount, uint32_t count, uint8_t value)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t address = ((i * pageCount) / count) * CRYPTO_DIGEST_CACHE_PAGE_SIZE;
+
+        cacheFlash[address] ^= value;
+        CRYPTO_DIGEST_CACHE_FlashWritten(address, 1U);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark
+// *****************************************************************************
+// *****************************************************************************
+
+static double lCache_NowUs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1000000.0) + ((double)now.tv_nsec / 1000.0);
+}
+
+// The cached digest must match a fresh region's and, after a change, differ from the previous one.
+static int lCache_Check(const char *name, const uint8_t *digest, const uint8_t *previous, uint32_t regionBytes)
+{
+    uint8_t fresh[CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+    int failed = 0;
+
+    if ((CRYPTO_DIGEST_CACHE_Register(&checkRegion, 0U, regionBytes, checkPages, checkPageDigests) !=
+         CRYPTO_DIGEST_CACHE_SUCCESS) ||
+        (CRYPTO_DIGEST_CACHE_Attest(&checkRegion, CACHE_ALGORITHM, fresh, NULL) != CRYPTO_DIGEST_CACHE_SUCCESS) ||
+        (memcmp(fresh, digest, CACHE_DIGEST_LEN) != 0))
+    {
+        fprintf(stderr, "%s: cached digest differs from a fresh attestation\n", name);
+        failed = 1;
+    }
+    else if ((previous != NULL) && (memcmp(previous, digest, CACHE_DIGEST_LEN) == 0))
+    {
+        fprintf(stderr, "%s: digest did not change with the region\n", name);
+        failed = 1;
+    }
+    CRYPTO_DIGEST_CACHE_Unregister(&checkRegion);
+
+    return failed;
+}
+
+static int lCache_Time(const char *name, uint32_t changed, uint32_t regionBytes, uint32_t runs)
+{
+    uint8_t before[CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+    uint8_t digest[CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+    uint32_t pageCount = cacheRegion.pageCount;
+    uint32_t pagesHashed = 0U;
+    double best = 0.0;
+    double sum = 0.0;
+    int failed = 0;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        double start;
+        double elapsed;
+        CRYPTO_DIGEST_CACHE_STATUS status;
+
+        // Fill the cache, then change the pages of the case.
+        if (CRYPTO_DIGEST_CACHE_Attest(&cacheRegion, CACHE_ALGORITHM, before, NULL) != CRYPTO_DIGEST_CACHE_SUCCESS)
+        {
+            fprintf(stderr, "%s: attestation failed\n", name);
+            return 1;
+        }
+        lCache_Change(pageCount, changed, (uint8_t)(run + 1U));
+
+        start = lCache_NowUs();
+        status = CRYPTO_DIGEST_CACHE_Attest(&cacheRegion, CACHE_ALGORITHM, digest, &pagesHashed);
+        elapsed = lCache_NowUs() - start;
+
+        if (status != CRYPTO_DIGEST_CACHE_SUCCESS)
+        {
+            fprintf(stderr, "%s: attestation failed\n", name);
+            return 1;
+        }
+        if (run == 0U)
+        {
+            failed |= lCache_Check(name, digest, (changed != 0U) ? before : NULL, regionBytes);
+        }
+
+        sum += elapsed;
+        if ((run == 0U) || (elapsed < best))
+        {
+            best = elapsed;
+        }
+    }
+
+    printf("%s,%u,%u,%u,%u,%.1f,%.1f\n", name, (unsigned int)regionBytes, (unsigned int)pageCount,
+           (unsigned int)pagesHashed, (unsigned int)runs, best, sum / (double)runs);
+
+    return failed;
+}
+
+static int lCache_TimeFull(uint32_t regionBytes, uint32_t runs)
+{
+    uint8_t digest[CRYPTO_DIGEST_CACHE_DIGEST_MAX];
+    double best = 0.0;
+    double sum = 0.0;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        double start = lCache_NowUs();
+        crypto_Hash_Status_E status = Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, cacheFlash, regionBytes,
+                                                             digest, CACHE_ALGORITHM, 1U);
+        double elapsed = lCache_NowUs() - start;
+
+        if (status != CRYPTO_HASH_SUCCESS)
+        {
+            fprintf(stderr, "full: digest failed\n");
+            return 1;
+        }
+        sum += elapsed;
+        if ((run == 0U) || (elapsed < best))
+        {
+            best = elapsed;
+        }
+    }
+
+    printf("full,%u,%u,%u,%u,%.1f,%.1f\n", (unsigned int)regionBytes,
+           (unsigned int)CRYPTO_DIGEST_CACHE_PAGE_COUNT(regionBytes), 0U, (unsigned int)runs, best,
+           sum / (double)runs);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char path[64] = "/tmp/crypto_cache_flashXXXXXX";
+    const char *flashPath = NULL;
+    uint32_t regionBytes = 256U * 1024U;
+    uint32_t runs = 5U;
+    uint32_t pageCount;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:n:f:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                regionBytes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                runs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                flashPath = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s region_bytes] [-n runs] [-f flash_file]\n", argv[0]);
+                return 2;
+        }
+    }
+    if ((regionBytes == 0U) || (regionBytes > CACHE_MAX_BYTES) || (runs == 0U))
+    {
+        fprintf(stderr, "region_bytes must be 1 to %lu, runs at least 1\n", CACHE_MAX_BYTES);
+        return 2;
+    }
+
+    if (flashPath == NULL)
+    {
+        int fd = mkstemp(path);
+
+        if (fd < 0)
+        {
+            perror(path);
+            return 2;
+        }
+        (void)close(fd);
+        flashPath = path;
+    }
+
+    if ((lCache_FlashCreate(flashPath, regionBytes) != 0) ||
+        (CRYPTO_DIGEST_CACHE_Register(&cacheRegion, 0U, regionBytes, cachePages, cachePageDigests) !=
+         CRYPTO_DIGEST_CACHE_SUCCESS))
+    {
+        failed = 2;
+    }
+    else
+    {
+        pageCount = cacheRegion.pageCount;
+
+        printf("case,region_bytes,pages,pages_hashed,runs,best_us,mean_us\n");
+        failed |= lCache_TimeFull(regionBytes, runs);
+        failed |= lCache_Time("changed_0", 0U, regionBytes, runs);
+        failed |= lCache_Time("changed_1", (pageCount + 99U) / 100U, regionBytes, runs);
+        failed |= lCache_Time("changed_100", pageCount, regionBytes, runs);
+    }
+
+    if (flashPath == path)
+    {
+        (void)unlink(path);
+    }
+
+    return failed;
+}
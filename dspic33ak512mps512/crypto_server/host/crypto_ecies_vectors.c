@@ -0,0 +1,539 @@
+/*******************************************************************************
+  Crypto ECIES Interop Vector Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecies_vectors.c
+
+  Summary:
+    Generates the ECIES interop vectors of the firmware (crypto_ecies.h) with
+    OpenSSL on Linux, and opens messages the board sealed.
+
+  Description:
+    The sealing here is written from the format, not from crypto_ecies.c:
+    R = 0x04 || X || Y of the ephemeral key, Z = X of the ECDH product, key
+    and IV = X9.63-KDF(Z, SharedInfo = R) with SHA-256 and AES-128 for P-256
+    and SHA-384 and AES-256 for P-384, a 16-byte GCM IV and a 16-byte tag.
+    The keys are derived from fixed labels, so the vectors come out the same
+    on every run.
+
+    Without options the tool writes app/crypto_ecies_vectors.h to stdout
+    (-o names a file). The ECIES benchmark of the firmware opens each vector
+    and seals the last message of each curve to the vector recipient again,
+    writing lines
+      sealed,<curve>,<hex of R || C || T>
+    to the COM port. -c reads a capture of that output, opens each sealed
+    line with the recipient key of its curve and checks the message; the
+    tool exits with 1 when one does not open.
+
+    Build with -lcrypto (OpenSSL 1.1 or 3).
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#include <openssl/obj_mac.h>
+
+#define ECIES_TAG_SIZE          (16U)
+#define ECIES_IV_SIZE           (16U)
+#define ECIES_MAX_KEY_SIZE      (48U)
+#define ECIES_MAX_POINT_SIZE    (1U + (2U * ECIES_MAX_KEY_SIZE))
+#define ECIES_MAX_MSG_SIZE      (256U)
+#define ECIES_MAX_SEALED_SIZE   (ECIES_MAX_POINT_SIZE + ECIES_MAX_MSG_SIZE + ECIES_TAG_SIZE)
+
+typedef struct
+{
+    const char *name;                   // As in the firmware CSV
+    const char *macro;                  // crypto_EccCurveType_E value
+    int nid;
+    const EVP_MD *(*md)(void);
+    const EVP_CIPHER *(*gcm)(void);
+    size_t keyLen;                      // Coordinate and private key
+    size_t aesKeyLen;
+} ecies_curve_t;
+
+typedef struct
+{
+    size_t msgLen;
+    const char *aad;                    // NULL for none
+} ecies_case_t;
+
+static const ecies_curve_t eciesCurves[] = {
+    { "p256", "CRYPTO_ECC_CURVE_P256", NID_X9_62_prime256v1, EVP_sha256, EVP_aes_128_gcm, 32U, 16U },
+    { "p384", "CRYPTO_ECC_CURVE_P384", NID_secp384r1, EVP_sha384, EVP_aes_256_gcm, 48U, 32U },
+};
+
+// The last case of each curve is the one the firmware seals again.
+static const ecies_case_t eciesCases[] = {
+    { 0U, NULL },
+    { 16U, NULL },
+    { 200U, NULL },
+    { 61U, "sensor-7" },
+};
+
+#define ECIES_CURVES    (sizeof(eciesCurves) / sizeof(eciesCurves[0]))
+#define ECIES_CASES     (sizeof(eciesCases) / sizeof(eciesCases[0]))
+
+static void fail(const char *what)
+{
+    fprintf(stderr, "%s failed\n", what);
+    exit(2);
+}
+
+/* Message of a case: a JSON sensor report padded with a counting pattern,
+ * so that every length has printable, distinct content. */
+static void caseMessage(size_t caseIndex, uint8_t *msg)
+{
+    static const char report[] = "{\"id\":7,\"seq\":1042,\"t\":21.5,\"rh\":40.2,\"p\":1013.2,\"bat\":3.61}";
+    size_t i;
+
+    for (i = 0U; i < eciesCases[caseIndex].msgLen; i++)
+    {
+        msg[i] = (i < (sizeof(report) - 1U)) ? (uint8_t)report[i] : (uint8_t)(0x20U + ((i + caseIndex) % 0x5FU));
+    }
+}
+
+// Private key from a label: the hash of the curve, reduced to 1..n-1.
+static BIGNUM *labelKey(const ecies_curve_t *curve, const EC_GROUP *group, const char *label)
+{
+    uint8_t digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen = 0U;
+    BIGNUM *d = BN_new();
+    BIGNUM *nm1 = BN_dup(EC_GROUP_get0_order(group));
+    BN_CTX *ctx = BN_CTX_new();
+
+    if ((d == NULL) || (nm1 == NULL) || (ctx == NULL) ||
+        (EVP_Digest(label, strlen(label), digest, &digestLen, curve->md(), NULL) != 1) ||
+        (BN_bin2bn(digest, (int)digestLen, d) == NULL) || (BN_sub_word(nm1, 1U) != 1) ||
+        (BN_nnmod(d, d, nm1, ctx) != 1) || (BN_add_word(d, 1U) != 1))
+    {
+        fail("key derivation");
+    }
+    BN_free(nm1);
+    BN_CTX_free(ctx);
+
+    return d;
+}
+
+// Public key d * G as 0x04 || X || Y.
+static void publicKey(const ecies_curve_t *curve, const EC_GROUP *group, const BIGNUM *d, uint8_t *point)
+{
+    EC_POINT *q = EC_POINT_new(group);
+
+    if ((q == NULL) || (EC_POINT_mul(group, q, d, NULL, NULL, NULL) != 1) ||
+        (EC_POINT_point2oct(group, q, POINT_CONVERSION_UNCOMPRESSED, point, 1U + (2U * curve->keyLen), NULL) !=
+         1U + (2U * curve->keyLen)))
+    {
+        fail("public key");
+    }
+    EC_POINT_free(q);
+}
+
+/* Key and IV from the X coordinate of d * P, P given as 0x04 || X || Y, with
+ * R as shared information. Returns 0 when P is not a point of the curve. */
+static int deriveKeyIv(const ecies_curve_t *curve, const EC_GROUP *group, const BIGNUM *d, const uint8_t *peer,
+                       const uint8_t *r, uint8_t *keyIv)
+{
+    size_t pointLen = 1U + (2U * curve->keyLen);
+    size_t outLen = curve->aesKeyLen + ECIES_IV_SIZE;
+    uint8_t product[ECIES_MAX_POINT_SIZE];
+    uint8_t block[EVP_MAX_MD_SIZE];
+    uint32_t counter = 0U;
+    size_t done = 0U;
+    EC_POINT *p = EC_POINT_new(group);
+    EC_POINT *s = EC_POINT_new(group);
+    int ok;
+
+    ok = (p != NULL) && (s != NULL) && (EC_POINT_oct2point(group, p, peer, pointLen, NULL) == 1) &&
+         (EC_POINT_mul(group, s, NULL, p, d, NULL) == 1) && (EC_POINT_is_at_infinity(group, s) == 0) &&
+         (EC_POINT_point2oct(group, s, POINT_CONVERSION_UNCOMPRESSED, product, pointLen, NULL) == pointLen);
+
+    // X9.63: block i = Hash(Z || i || SharedInfo), i 32-bit big endian from 1.
+    while (ok && (done < outLen))
+    {
+        uint8_t counterBytes[4];
+        unsigned int blockLen = 0U;
+        EVP_MD_CTX *md = EVP_MD_CTX_new();
+        size_t take;
+
+        counter++;
+        counterBytes[0] = (uint8_t)(counter >> 24);
+        counterBytes[1] = (uint8_t)(counter >> 16);
+        counterBytes[2] = (uint8_t)(counter >> 8);
+        counterBytes[3] = (uint8_t)counter;
+        ok = (md != NULL) && (EVP_DigestInit_ex(md, curve->md(), NULL) == 1) &&
+             (EVP_DigestUpdate(md, &product[1], curve->keyLen) == 1) &&
+             (EVP_DigestUpdate(md, counterBytes, sizeof(counterBytes)) == 1) &&
+             (EVP_DigestUpdate(md, r, pointLen) == 1) && (EVP_DigestFinal_ex(md, block, &blockLen) == 1);
+        EVP_MD_CTX_free(md);
+
+        take = ((outLen - done) < blockLen) ? (outLen - done) : blockLen;
+        memcpy(&keyIv[done], block, take);
+        done += take;
+    }
+
+    EC_POINT_free(p);
+    EC_POINT_free(s);
+
+    return ok;
+}
+
+// AES-GCM with the 16-byte IV; returns 0 on a tag mismatch.
+static int gcm(const ecies_curve_t *curve, int encrypt, const uint8_t *keyIv, const uint8_t *aad, size_t aadLen,
+               uint8_t *data, size_t dataLen, uint8_t *tag)
+{
+    EVP_CIPHER_CTX *c = EVP_CIPHER_CTX_new();
+    int outLen = 0;
+    int ok;
+
+    ok = (c != NULL) && (EVP_CipherInit_ex(c, curve->gcm(), NULL, NULL, NULL, encrypt) == 1) &&
+         (EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_SET_IVLEN, (int)ECIES_IV_SIZE, NULL) == 1) &&
+         (EVP_CipherInit_ex(c, NULL, NULL, keyIv, &keyIv[curve->aesKeyLen], encrypt) == 1);
+    if (ok && (aadLen != 0U))
+    {
+        ok = (EVP_CipherUpdate(c, NULL, &outLen, aad, (int)aadLen) == 1);
+    }
+    if (ok && (dataLen != 0U))
+    {
+        ok = (EVP_CipherUpdate(c, data, &outLen, data, (int)dataLen) == 1);
+    }
+    if (ok && !encrypt)
+    {
+        ok = (EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_SET_TAG, (int)ECIES_TAG_SIZE, tag) == 1);
+    }
+    ok = ok && (EVP_CipherFinal_ex(c, data, &outLen) == 1);
+    if (ok && encrypt)
+    {
+        ok = (EVP_CIPHER_CTX_ctrl(c, EVP_CTRL_GCM_GET_TAG, (int)ECIES_TAG_SIZE, tag) == 1);
+    }
+    EVP_CIPHER_CTX_free(c);
+
+    return ok;
+}
+
+// Seal msg to the recipient point with the ephemeral key e; returns the sealed length.
+static size_t seal(const ecies_curve_t *curve, const EC_GROUP *group, const BIGNUM *e, const uint8_t *recipient,
+                   const char *aad, const uint8_t *msg, size_t msgLen, uint8_t *sealed)
+{
+    size_t pointLen = 1U + (2U * curve->keyLen);
+    uint8_t keyIv[32U + ECIES_IV_SIZE];
+
+    publicKey(curve, group, e, sealed);
+    memcpy(&sealed[pointLen], msg, msgLen);
+    if ((deriveKeyIv(curve, group, e, recipient, sealed, keyIv) == 0) ||
+        (gcm(curve, 1, keyIv, (const uint8_t *)aad, (aad != NULL) ? strlen(aad) : 0U, &sealed[pointLen], msgLen,
+             &sealed[pointLen + msgLen]) == 0))
+    {
+        fail("seal");
+    }
+
+    return pointLen + msgLen + ECIES_TAG_SIZE;
+}
+
+// Open in place; returns the message length, or -1 when it does not open.
+static long open_(const ecies_curve_t *curve, const EC_GROUP *group, const BIGNUM *d, const char *aad,
+                  uint8_t *sealed, size_t sealedLen)
+{
+    size_t pointLen = 1U + (2U * curve->keyLen);
+    uint8_t keyIv[32U + ECIES_IV_SIZE];
+    size_t msgLen;
+
+    if ((sealedLen < (pointLen + ECIES_TAG_SIZE)) || (sealed[0] != 0x04U) ||
+        (deriveKeyIv(curve, group, d, sealed, sealed, keyIv) == 0))
+    {
+        return -1;
+    }
+    msgLen = sealedLen - pointLen - ECIES_TAG_SIZE;
+
+    return gcm(curve, 0, keyIv, (const uint8_t *)aad, (aad != NULL) ? strlen(aad) : 0U, &sealed[pointLen], msgLen,
+               &sealed[pointLen + msgLen]) ? (long)msgLen : -1L;
+}
+
+static void writeArray(FILE *out, const char *name, const uint8_t *data, size_t len)
+{
+    size_t i;
+
+    if (len == 0U)
+    {
+        return;
+    }
+    fprintf(out, "static const uint8_t %s[%zu] = {", name, len);
+    for (i = 0U; i < len; i++)
+    {
+        fprintf(out, "%s0x%02X%s", ((i % 16U) == 0U) ? "\n    " : " ", data[i], (i + 1U < len) ? "," : "");
+    }
+    fprintf(out, "\n};\n");
+}
+
+static void writeHeader(FILE *out)
+{
+    uint8_t msg[ECIES_MAX_MSG_SIZE];
+    uint8_t check[ECIES_MAX_SEALED_SIZE];
+    uint8_t sealed[ECIES_MAX_SEALED_SIZE];
+    uint8_t point[ECIES_MAX_POINT_SIZE];
+    uint8_t priv[ECIES_MAX_KEY_SIZE];
+    char name[64];
+    char label[96];
+    size_t c;
+    size_t k;
+
+    fprintf(out, "/* Generated by host/crypto_ecies_vectors.c with OpenSSL; do not edit. ECIES\n"
+                 " * interop vectors of crypto_ecies.h: recipient key pair, additional data,\n"
+                 " * message and the message sealed with a fixed ephemeral key. */\n\n");
+    fprintf(out, "#ifndef CRYPTO_ECIES_VECTORS_H\n#define CRYPTO_ECIES_VECTORS_H\n\n");
+    fprintf(out, "#include \"crypto/common_crypto/crypto_common.h\"\n\n");
+    fprintf(out, "typedef struct{\n"
+                 "    crypto_EccCurveType_E curve_en;\n"
+                 "    const uint8_t *ptr_privKey;\n"
+                 "    uint32_t privKeyLen;\n"
+                 "    const uint8_t *ptr_pubKey;                  // 0x04 || X || Y\n"
+                 "    uint32_t pubKeyLen;\n"
+                 "    const uint8_t *ptr_aad;\n"
+                 "    uint32_t aadLen;\n"
+                 "    const uint8_t *ptr_msg;\n"
+                 "    uint32_t msgLen;\n"
+                 "    const uint8_t *ptr_sealed;\n"
+                 "    uint32_t sealedLen;\n"
+                 "}st_Crypto_Ecies_Vector;\n\n");
+
+    for (c = 0U; c < ECIES_CURVES; c++)
+    {
+        const ecies_curve_t *curve = &eciesCurves[c];
+        EC_GROUP *group = EC_GROUP_new_by_curve_name(curve->nid);
+        BIGNUM *d;
+
+        (void)snprintf(label, sizeof(label), "crypto_ecies_vectors recipient %s", curve->name);
+        d = labelKey(curve, group, label);
+        if (BN_bn2binpad(d, priv, (int)curve->keyLen) != (int)curve->keyLen)
+        {
+            fail("private key");
+        }
+        publicKey(curve, group, d, point);
+        (void)snprintf(name, sizeof(name), "eciesVector_%s_priv", curve->name);
+        writeArray(out, name, priv, curve->keyLen);
+        (void)snprintf(name, sizeof(name), "eciesVector_%s_pub", curve->name);
+        writeArray(out, name, point, 1U + (2U * curve->keyLen));
+
+        for (k = 0U; k < ECIES_CASES; k++)
+        {
+            BIGNUM *e;
+            size_t sealedLen;
+
+            (void)snprintf(label, sizeof(label), "crypto_ecies_vectors ephemeral %s %zu", curve->name, k);
+            e = labelKey(curve, group, label);
+            caseMessage(k, msg);
+            sealedLen = seal(curve, group, e, point, eciesCases[k].aad, msg, eciesCases[k].msgLen, sealed);
+
+            // The vector must open with the recipient key.
+            memcpy(check, sealed, sealedLen);
+            if ((open_(curve, group, d, eciesCases[k].aad, check, sealedLen) != (long)eciesCases[k].msgLen) ||
+                (memcmp(&check[1U + (2U * curve->keyLen)], msg, eciesCases[k].msgLen) != 0))
+            {
+                fail("self-check");
+            }
+
+            (void)snprintf(name, sizeof(name), "eciesVector_%s_%zu_msg", curve->name, k);
+            writeArray(out, name, msg, eciesCases[k].msgLen);
+            (void)snprintf(name, sizeof(name), "eciesVector_%s_%zu_sealed", curve->name, k);
+            writeArray(out, name, sealed, sealedLen);
+            if (eciesCases[k].aad != NULL)
+            {
+                (void)snprintf(name, sizeof(name), "eciesVector_%s_%zu_aad", curve->name, k);
+                writeArray(out, name, (const uint8_t *)eciesCases[k].aad, strlen(eciesCases[k].aad));
+            }
+            BN_free(e);
+        }
+        fprintf(out, "\n");
+        BN_free(d);
+        EC_GROUP_free(group);
+    }
+
+    fprintf(out, "static const st_Crypto_Ecies_Vector eciesVectors[] = {\n");
+    for (c = 0U; c < ECIES_CURVES; c++)
+    {
+        const ecies_curve_t *curve = &eciesCurves[c];
+        size_t pointLen = 1U + (2U * curve->keyLen);
+
+        for (k = 0U; k < ECIES_CASES; k++)
+        {
+            size_t aadLen = (eciesCases[k].aad != NULL) ? strlen(eciesCases[k].aad) : 0U;
+            char aadName[64] = "NULL";
+            char msgName[64] = "NULL";
+
+            if (aadLen != 0U)
+            {
+                (void)snprintf(aadName, sizeof(aadName), "eciesVector_%s_%zu_aad", curve->name, k);
+            }
+            if (eciesCases[k].msgLen != 0U)
+            {
+                (void)snprintf(msgName, sizeof(msgName), "eciesVector_%s_%zu_msg", curve->name, k);
+            }
+            fprintf(out, "    { %s, eciesVector_%s_priv, %zuUL, eciesVector_%s_pub, %zuUL,\n"
+                         "      %s, %zuUL, %s, %zuUL, eciesVector_%s_%zu_sealed, %zuUL },\n",
+                    curve->macro, curve->name, curve->keyLen, curve->name, pointLen, aadName, aadLen, msgName,
+                    eciesCases[k].msgLen, curve->name, k, pointLen + eciesCases[k].msgLen + ECIES_TAG_SIZE);
+        }
+    }
+    fprintf(out, "};\n\n#endif /* CRYPTO_ECIES_VECTORS_H */\n");
+}
+
+static size_t fromHex(const char *hex, uint8_t *out, size_t outSize)
+{
+    size_t len = 0U;
+    unsigned int byte;
+
+    while ((hex[0] != '\0') && (hex[1] != '\0') && (hex[0] != '\n') && (hex[0] != '\r') && (len < outSize) &&
+           (sscanf(hex, "%2x", &byte) == 1))
+    {
+        out[len++] = (uint8_t)byte;
+        hex += 2;
+    }
+
+    return len;
+}
+
+// Open the sealed lines of a firmware capture with the vector recipient keys.
+static int checkCapture(const char *path)
+{
+    FILE *in = fopen(path, "r");
+    char line[2U * ECIES_MAX_SEALED_SIZE + 64U];
+    uint8_t sealed[ECIES_MAX_SEALED_SIZE];
+    uint8_t msg[ECIES_MAX_MSG_SIZE];
+    char label[96];
+    int failed = 0;
+    int opened = 0;
+    size_t c;
+
+    if (in == NULL)
+    {
+        perror(path);
+        return 2;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        if (strncmp(line, "sealed,", 7U) != 0)
+        {
+            continue;
+        }
+        for (c = 0U; c < ECIES_CURVES; c++)
+        {
+            const ecies_curve_t *curve = &eciesCurves[c];
+            size_t nameLen = strlen(curve->name);
+
+            if ((strncmp(&line[7], curve->name, nameLen) == 0) && (line[7U + nameLen] == ','))
+            {
+                const ecies_case_t *last = &eciesCases[ECIES_CASES - 1U];
+                EC_GROUP *group = EC_GROUP_new_by_curve_name(curve->nid);
+                size_t sealedLen = fromHex(&line[8U + nameLen], sealed, sizeof(sealed));
+                long msgLen;
+                BIGNUM *d;
+
+                (void)snprintf(label, sizeof(label), "crypto_ecies_vectors recipient %s", curve->name);
+                d = labelKey(curve, group, label);
+                msgLen = open_(curve, group, d, last->aad, sealed, sealedLen);
+                caseMessage(ECIES_CASES - 1U, msg);
+
+                if ((msgLen != (long)last->msgLen) ||
+                    (memcmp(&sealed[1U + (2U * curve->keyLen)], msg, last->msgLen) != 0))
+                {
+                    printf("open,%s,fail\n", curve->name);
+                    failed = 1;
+                }
+                else
+                {
+                    printf("open,%s,ok\n", curve->name);
+                }
+                opened++;
+                BN_free(d);
+                EC_GROUP_free(group);
+            }
+        }
+    }
+    fclose(in);
+
+    if (opened == 0)
+    {
+        fprintf(stderr, "%s: no sealed lines\n", path);
+        failed = 1;
+    }
+
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outPath = NULL;
+    const char *capturePath = NULL;
+    FILE *out = stdout;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:c:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'o':
+                outPath = optarg;
+                break;
+            case 'c':
+                capturePath = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-o header] | -c capture\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (capturePath != NULL)
+    {
+        return checkCapture(capturePath);
+    }
+
+    if ((outPath != NULL) && ((out = fopen(outPath, "w")) == NULL))
+    {
+        perror(outPath);
+        return 2;
+    }
+    writeHeader(out);
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    return 0;
+}
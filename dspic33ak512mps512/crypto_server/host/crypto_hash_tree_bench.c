@@ -0,0 +1,508 @@
+/*******************************************************************************
+  Crypto Hash Tree Host Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_tree_bench.c
+
+  Summary:
+    Times the hash tree (crypto_hash_tree.c) on Linux over an image received
+    in chunks: the verification latency of each chunk and the total time,
+    against hashing the whole image once it has arrived.
+
+  Description:
+    The sender side keeps every node of the tree to cut the proof of each
+    chunk, as an update server would; the receiver side uses only the
+    builder and the verifier. The Crypto_* stand-in models the SHA engine
+    time with CRYPTO_STANDIN_NS_PER_BYTE.
+
+    One CSV row is written per case:
+      case,image_bytes,chunk_bytes,chunks,runs,total_ms,cpu_ms,chunk_mean_us,chunk_max_us
+    "flat" hashes the whole image with one Crypto_Hash_Sha_Digest(), the
+    check done without the tree once the last chunk arrived; "build" feeds
+    the chunks to the builder; "verify" checks each chunk with its proof as
+    it arrives, in order, and "verify_shuffled" in a shuffled order. cpu_ms is
+    the process CPU time, which on the host includes the stand-in's wait for
+    the modelled engine. The root of the builder is checked against the
+    sender's, and a corrupted chunk and a corrupted proof must be rejected;
+    the tool exits with 1 otherwise.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "app/crypto_hash_tree.h"
+
+#define TREE_MAX_DEPTH          CRYPTO_HASH_TREE_DEPTH_MAX
+#define TREE_MAX_CHUNKS         (1UL << TREE_MAX_DEPTH)
+
+static uint8_t *treeImage;
+static uint32_t treeImageBytes;
+static uint32_t treeChunkBytes;
+static uint32_t treeChunks;
+static crypto_Hash_Algo_E treeAlgorithm;
+static uint32_t treeDigestLen;
+
+// Sender side: every level of the tree.
+static uint8_t *treeLevels[TREE_MAX_DEPTH + 1U];
+static uint32_t treeWidths[TREE_MAX_DEPTH + 1U];
+static uint32_t treeDepth;
+
+static CRYPTO_HASH_TREE_BUILDER treeBuilder;
+static CRYPTO_HASH_TREE_VERIFIER treeVerifier;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Sender
+// *****************************************************************************
+// *****************************************************************************
+
+static int lTree_Hash(const uint8_t prefix, const uint8_t *a, uint32_t aLen, const uint8_t *b, uint32_t bLen,
+                      uint8_t *out)
+{
+    static uint8_t buffer[1U + (2U * CRYPTO_HASH_TREE_DIGEST_MAX) + 65536U];
+
+    if ((aLen + bLen + 1U) > sizeof(buffer))
+    {
+        return -1;
+    }
+    buffer[0] = prefix;
+    (void)memcpy(&buffer[1], a, aLen);
+    if (bLen > 0U)
+    {
+        (void)memcpy(&buffer[1U + aLen], b, bLen);
+    }
+
+    return (Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, buffer, 1U + aLen + bLen, out, treeAlgorithm, 1U) ==
+            CRYPTO_HASH_SUCCESS) ? 0 : -1;
+}
+
+// Build every level the way the tree is defined, independently of the builder.
+static int lTree_SenderBuild(void)
+{
+    uint32_t level = 0U;
+
+    treeWidths[0] = treeChunks;
+    treeLevels[0] = malloc((size_t)treeChunks * treeDigestLen);
+    if (treeLevels[0] == NULL)
+    {
+        return -1;
+    }
+    for (uint32_t i = 0U; i < treeChunks; i++)
+    {
+        uint32_t len = ((i + 1U) < treeChunks) ? treeChunkBytes : (treeImageBytes - (i * treeChunkBytes));
+
+        if (lTree_Hash(0x00U, &treeImage[i * treeChunkBytes], len, NULL, 0U, &treeLevels[0][i * treeDigestLen]) != 0)
+        {
+            return -1;
+        }
+    }
+
+    while (treeWidths[level] > 1U)
+    {
+        uint32_t width = (treeWidths[level] + 1U) / 2U;
+
+        treeLevels[level + 1U] = malloc((size_t)width * treeDigestLen);
+        if (treeLevels[level + 1U] == NULL)
+        {
+            return -1;
+        }
+        for (uint32_t j = 0U; j < width; j++)
+        {
+            const uint8_t *left = &treeLevels[level][(2U * j) * treeDigestLen];
+
+            if (((2U * j) + 1U) < treeWidths[level])
+            {
+                if (lTree_Hash(0x01U, left, treeDigestLen, left + treeDigestLen, treeDigestLen,
+                               &treeLevels[level + 1U][j * treeDigestLen]) != 0)
+                {
+                    return -1;
+                }
+            }
+            else
+            {
+                (void)memcpy(&treeLevels[level + 1U][j * treeDigestLen], left, treeDigestLen);
+            }
+        }
+        treeWidths[level + 1U] = width;
+        level++;
+    }
+    treeDepth = level;
+
+    return 0;
+}
+
+// Cut the proof of a chunk: its siblings from the leaf up.
+static uint32_t lTree_Proof(uint32_t index, uint8_t *proof)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t level = 0U; level < treeDepth; level++)
+    {
+        uint32_t j = index >> level;
+        uint32_t sibling = j ^ 1U;
+
+        if (sibling < treeWidths[level])
+        {
+            (void)memcpy(&proof[count * treeDigestLen], &treeLevels[level][sibling * treeDigestLen], treeDigestLen);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark
+// *****************************************************************************
+// *****************************************************************************
+
+static double lTree_NowUs(clockid_t clock)
+{
+    struct timespec now;
+
+    (void)clock_gettime(clock, &now);
+
+    return ((double)now.tv_sec * 1000000.0) + ((double)now.tv_nsec / 1000.0);
+}
+
+static uint32_t lTree_ChunkLen(uint32_t index)
+{
+    return ((index + 1U) < treeChunks) ? treeChunkBytes : (treeImageBytes - (index * treeChunkBytes));
+}
+
+typedef struct
+{
+    double total;
+    double cpu;
+    double chunkSum;
+    double chunkMax;
+} TREE_TIMES;
+
+static void lTree_Report(const char *name, uint32_t runs, const TREE_TIMES *best, double chunkSum, uint32_t chunks)
+{
+    printf("%s,%u,%u,%u,%u,%.3f,%.3f,%.1f,%.1f\n", name, (unsigned int)treeImageBytes, (unsigned int)treeChunkBytes,
+           (unsigned int)treeChunks, (unsigned int)runs, best->total / 1000.0, best->cpu / 1000.0,
+           (chunks > 0U) ? (chunkSum / (double)chunks) : 0.0, best->chunkMax);
+}
+
+static int lTree_TimeFlat(uint32_t runs)
+{
+    uint8_t digest[CRYPTO_HASH_TREE_DIGEST_MAX];
+    TREE_TIMES best = { 0.0, 0.0, 0.0, 0.0 };
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        double start = lTree_NowUs(CLOCK_MONOTONIC);
+        double cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID);
+
+        if (Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, treeImage, treeImageBytes, digest, treeAlgorithm, 1U) !=
+            CRYPTO_HASH_SUCCESS)
+        {
+            return 1;
+        }
+        cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+        start = lTree_NowUs(CLOCK_MONOTONIC) - start;
+        if ((run == 0U) || (start < best.total))
+        {
+            best.total = start;
+            best.cpu = cpu;
+            best.chunkMax = start;
+        }
+    }
+
+    // Nothing is known about any chunk until the whole image is hashed.
+    lTree_Report("flat", runs, &best, best.total, 1U);
+
+    return 0;
+}
+
+static int lTree_TimeBuild(uint32_t runs, const uint8_t *root)
+{
+    uint8_t built[CRYPTO_HASH_TREE_DIGEST_MAX];
+    TREE_TIMES best = { 0.0, 0.0, 0.0, 0.0 };
+    double bestChunkSum = 0.0;
+    uint32_t leafCount = 0U;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        TREE_TIMES times = { 0.0, 0.0, 0.0, 0.0 };
+        double start = lTree_NowUs(CLOCK_MONOTONIC);
+        double cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID);
+        CRYPTO_HASH_TREE_STATUS status = CRYPTO_HASH_TREE_BuilderInit(&treeBuilder, treeAlgorithm, treeChunkBytes);
+
+        for (uint32_t i = 0U; (status == CRYPTO_HASH_TREE_SUCCESS) && (i < treeChunks); i++)
+        {
+            double chunkStart = lTree_NowUs(CLOCK_MONOTONIC);
+
+            status = CRYPTO_HASH_TREE_BuilderUpdate(&treeBuilder, &treeImage[i * treeChunkBytes], lTree_ChunkLen(i));
+            chunkStart = lTree_NowUs(CLOCK_MONOTONIC) - chunkStart;
+            times.chunkSum += chunkStart;
+            if (chunkStart > times.chunkMax)
+            {
+                times.chunkMax = chunkStart;
+            }
+        }
+        if (status == CRYPTO_HASH_TREE_SUCCESS)
+        {
+            status = CRYPTO_HASH_TREE_BuilderFinal(&treeBuilder, built, &leafCount);
+        }
+        times.cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+        times.total = lTree_NowUs(CLOCK_MONOTONIC) - start;
+
+        if ((status != CRYPTO_HASH_TREE_SUCCESS) || (leafCount != treeChunks) ||
+            (memcmp(built, root, treeDigestLen) != 0))
+        {
+            fprintf(stderr, "build: root differs from the sender's\n");
+            return 1;
+        }
+        if ((run == 0U) || (times.total < best.total))
+        {
+            best = times;
+            bestChunkSum = times.chunkSum;
+        }
+    }
+
+    lTree_Report("build", runs, &best, bestChunkSum, treeChunks);
+
+    return 0;
+}
+
+static int lTree_TimeVerify(const char *name, const uint32_t *order, uint32_t runs, const uint8_t *root)
+{
+    static uint8_t proof[TREE_MAX_DEPTH * CRYPTO_HASH_TREE_DIGEST_MAX];
+    TREE_TIMES best = { 0.0, 0.0, 0.0, 0.0 };
+    double bestChunkSum = 0.0;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        TREE_TIMES times = { 0.0, 0.0, 0.0, 0.0 };
+        double start;
+        double cpu;
+        CRYPTO_HASH_TREE_STATUS status;
+
+        status = CRYPTO_HASH_TREE_VerifierInit(&treeVerifier, treeAlgorithm, treeChunkBytes, treeChunks, root);
+        start = lTree_NowUs(CLOCK_MONOTONIC);
+        cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID);
+
+        for (uint32_t n = 0U; (status == CRYPTO_HASH_TREE_SUCCESS) && (n < treeChunks); n++)
+        {
+            uint32_t i = order[n];
+            uint32_t count = lTree_Proof(i, proof);
+            double chunkStart;
+
+            if (count != CRYPTO_HASH_TREE_ProofCount(treeChunks, i))
+            {
+                fprintf(stderr, "%s: proof of chunk %u has %u nodes\n", name, (unsigned int)i, (unsigned int)count);
+                return 1;
+            }
+
+            // The proof is cut by the sender; only the receiver's check is timed.
+            chunkStart = lTree_NowUs(CLOCK_MONOTONIC);
+            status = CRYPTO_HASH_TREE_VerifyChunk(&treeVerifier, i, &treeImage[i * treeChunkBytes], lTree_ChunkLen(i),
+                                                  proof, count);
+            chunkStart = lTree_NowUs(CLOCK_MONOTONIC) - chunkStart;
+            times.chunkSum += chunkStart;
+            if (chunkStart > times.chunkMax)
+            {
+                times.chunkMax = chunkStart;
+            }
+        }
+        times.cpu = lTree_NowUs(CLOCK_PROCESS_CPUTIME_ID) - cpu;
+        times.total = lTree_NowUs(CLOCK_MONOTONIC) - start;
+
+        if (status != CRYPTO_HASH_TREE_SUCCESS)
+        {
+            fprintf(stderr, "%s: a good chunk was rejected (%d)\n", name, (int)status);
+            return 1;
+        }
+        if ((run == 0U) || (times.total < best.total))
+        {
+            best = times;
+            bestChunkSum = times.chunkSum;
+        }
+    }
+
+    // The proofs are cut outside the timed calls, so the total is the sum of the chunks.
+    best.total = bestChunkSum;
+    lTree_Report(name, runs, &best, bestChunkSum, treeChunks);
+
+    return 0;
+}
+
+// A changed byte in a chunk after good chunks were verified, or in its proof, must be rejected.
+static int lTree_CheckTamper(const uint8_t *root)
+{
+    static uint8_t proof[TREE_MAX_DEPTH * CRYPTO_HASH_TREE_DIGEST_MAX];
+    uint32_t bad = treeChunks / 2U;
+    uint32_t count;
+    int failed = 0;
+
+    if (CRYPTO_HASH_TREE_VerifierInit(&treeVerifier, treeAlgorithm, treeChunkBytes, treeChunks, root) !=
+        CRYPTO_HASH_TREE_SUCCESS)
+    {
+        return 1;
+    }
+    for (uint32_t i = 0U; i < bad; i++)
+    {
+        count = lTree_Proof(i, proof);
+        failed |= (CRYPTO_HASH_TREE_VerifyChunk(&treeVerifier, i, &treeImage[i * treeChunkBytes], lTree_ChunkLen(i),
+                                                proof, count) != CRYPTO_HASH_TREE_SUCCESS);
+    }
+
+    count = lTree_Proof(bad, proof);
+    treeImage[bad * treeChunkBytes] ^= 0x01U;
+    failed |= (CRYPTO_HASH_TREE_VerifyChunk(&treeVerifier, bad, &treeImage[bad * treeChunkBytes], lTree_ChunkLen(bad),
+                                            proof, count) != CRYPTO_HASH_TREE_ERROR_MISMATCH);
+    treeImage[bad * treeChunkBytes] ^= 0x01U;
+
+    // A fresh verifier knows no node, so it reads every sibling of the proof.
+    if (count > 0U)
+    {
+        failed |= (CRYPTO_HASH_TREE_VerifierInit(&treeVerifier, treeAlgorithm, treeChunkBytes, treeChunks, root) !=
+                   CRYPTO_HASH_TREE_SUCCESS);
+        proof[(count - 1U) * treeDigestLen] ^= 0x01U;
+        failed |= (CRYPTO_HASH_TREE_VerifyChunk(&treeVerifier, bad, &treeImage[bad * treeChunkBytes],
+                                                lTree_ChunkLen(bad), proof, count) != CRYPTO_HASH_TREE_ERROR_MISMATCH);
+        proof[(count - 1U) * treeDigestLen] ^= 0x01U;
+    }
+
+    failed |= (CRYPTO_HASH_TREE_VerifyChunk(&treeVerifier, bad, &treeImage[bad * treeChunkBytes], lTree_ChunkLen(bad),
+                                            proof, count) != CRYPTO_HASH_TREE_SUCCESS);
+    if (failed != 0)
+    {
+        fprintf(stderr, "tamper: a corrupted chunk or proof was not rejected\n");
+    }
+
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t root[CRYPTO_HASH_TREE_DIGEST_MAX];
+    uint32_t *order;
+    uint32_t runs = 5U;
+    uint32_t bits = 384U;
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    int failed = 0;
+    int opt;
+
+    treeImageBytes = 512U * 1024U;
+    treeChunkBytes = 4096U;
+
+    while ((opt = getopt(argc, argv, "s:c:a:n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                treeImageBytes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                treeChunkBytes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'a':
+                bits = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                runs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s image_bytes] [-c chunk_bytes] [-a 256|384] [-n runs]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    treeAlgorithm = (bits == 256U) ? CRYPTO_HASH_SHA2_256 : CRYPTO_HASH_SHA2_384;
+    treeDigestLen = (bits == 256U) ? 32U : 48U;
+    if (((bits != 256U) && (bits != 384U)) || (treeImageBytes == 0U) || (treeChunkBytes == 0U) ||
+        (treeChunkBytes > 65536U) || (runs == 0U) ||
+        ((((uint64_t)treeImageBytes + treeChunkBytes - 1U) / treeChunkBytes) > TREE_MAX_CHUNKS))
+    {
+        fprintf(stderr, "bad arguments: at most %lu chunks of at most 65536 bytes, SHA-256 or SHA-384\n",
+                TREE_MAX_CHUNKS);
+        return 2;
+    }
+    treeChunks = (treeImageBytes + treeChunkBytes - 1U) / treeChunkBytes;
+
+    treeImage = malloc(treeImageBytes);
+    order = malloc((size_t)treeChunks * sizeof(uint32_t));
+    if ((treeImage == NULL) || (order == NULL))
+    {
+        return 2;
+    }
+    for (uint32_t i = 0U; i < treeImageBytes; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        treeImage[i] = (uint8_t)(x >> 32);
+    }
+    if (lTree_SenderBuild() != 0)
+    {
+        fprintf(stderr, "building the sender's tree failed\n");
+        return 2;
+    }
+    (void)memcpy(root, treeLevels[treeDepth], treeDigestLen);
+
+    printf("case,image_bytes,chunk_bytes,chunks,runs,total_ms,cpu_ms,chunk_mean_us,chunk_max_us\n");
+    failed |= lTree_TimeFlat(runs);
+    failed |= lTree_TimeBuild(runs, root);
+
+    for (uint32_t i = 0U; i < treeChunks; i++)
+    {
+        order[i] = i;
+    }
+    failed |= lTree_TimeVerify("verify", order, runs, root);
+
+    for (uint32_t i = treeChunks - 1U; i > 0U; i--)
+    {
+        uint32_t j;
+        uint32_t t;
+
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        j = (uint32_t)(x % (i + 1U));
+        t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+    failed |= lTree_TimeVerify("verify_shuffled", order, runs, root);
+    failed |= lTree_CheckTamper(root);
+
+    return failed;
+}
@@ -0,0 +1,487 @@
+/*******************************************************************************
+  Crypto Latency Benchmark Host Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_latency_bench.c
+
+  Summary:
+    Runs the tail-latency benchmark (crypto_latency_bench.c) on Linux with the
+    Crypto_* stand-in and compares results against a baseline.
+
+  Description:
+    The background interrupt load is a POSIX interval timer whose SIGALRM
+    handler busy-waits for the same time as the board's load interrupt
+    (app/app_load.h). The rows have the same CSV schema as the board output,
+    so a capture from the board can be compared with -r instead of running.
+
+    A row regresses when its p50, p99 or p99.9 latency exceeds the baseline
+    row with the same op, payload_bytes and load_hz by more than the
+    tolerance and by more than the absolute slack (one load interrupt by
+    default, so sub-microsecond jitter is not flagged), or when it has more
+    errors. A percentile is only compared when at least -k samples of both
+    rows lie above it; with fewer it is decided by one or two outliers (the
+    p99.9 of 2000 samples is the third largest) and varies too much between
+    runs to gate on. Rows missing from either file are
+    reported but are not regressions. Tail percentiles vary from run to run,
+    so a baseline is best made with -u, which folds several runs into their
+    per-field worst case.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "app/crypto_latency_bench.h"
+
+#define LATENCY_MAX_ROWS        (256U)
+#define LATENCY_MAX_RATES       (16U)
+#define LATENCY_LINE_SIZE       (256U)
+
+typedef struct
+{
+    char op[32];
+    unsigned long payloadBytes;
+    unsigned long loadHz;
+    unsigned long samples;
+    unsigned long errors;
+    unsigned long minNs;
+    unsigned long p50Ns;
+    unsigned long p99Ns;
+    unsigned long p999Ns;
+    unsigned long maxNs;
+} LATENCY_ROW;
+
+typedef struct
+{
+    LATENCY_ROW rows[LATENCY_MAX_ROWS];
+    unsigned int count;
+} LATENCY_TABLE;
+
+static LATENCY_TABLE latencyResults;
+static LATENCY_TABLE latencyBaseline;
+
+static timer_t latencyTimer;
+static int latencyTimerActive;
+static volatile sig_atomic_t latencyInterrupts;
+
+// Time spent in each load signal, matching APP_LOAD_WORK_TICKS on the board.
+static long latencyWorkNs = 2000L;
+
+// Samples that must lie above a percentile for it to be compared.
+static unsigned long latencyMinTail = 5UL;
+
+// Rows are written to stdout, except when they are folded into a baseline.
+static int latencyEcho = 1;
+
+// Increase below which a latency never counts as a regression.
+static unsigned long latencySlackNs = 2000UL;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Result Tables
+// *****************************************************************************
+// *****************************************************************************
+
+/* Parse one CSV row into the table. The header, comments and malformed
+ * lines are skipped. */
+static void latencyParseRow(LATENCY_TABLE *table, const char *line)
+{
+    LATENCY_ROW row;
+
+    if ((line[0] == '#') || (table->count >= LATENCY_MAX_ROWS))
+    {
+        return;
+    }
+
+    if (sscanf(line, "%31[^,],%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu", row.op, &row.payloadBytes, &row.loadHz,
+        &row.samples, &row.errors, &row.minNs, &row.p50Ns, &row.p99Ns, &row.p999Ns, &row.maxNs) == 10)
+    {
+        table->rows[table->count++] = row;
+    }
+}
+
+static int latencyLoad(LATENCY_TABLE *table, const char *path)
+{
+    char line[LATENCY_LINE_SIZE];
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        latencyParseRow(table, line);
+    }
+
+    (void)fclose(file);
+
+    return 0;
+}
+
+static const LATENCY_ROW *latencyFind(const LATENCY_TABLE *table, const LATENCY_ROW *key)
+{
+    for (unsigned int i = 0U; i < table->count; i++)
+    {
+        const LATENCY_ROW *row = &table->rows[i];
+
+        if ((strcmp(row->op, key->op) == 0) && (row->payloadBytes == key->payloadBytes)
+            && (row->loadHz == key->loadHz))
+        {
+            return row;
+        }
+    }
+
+    return NULL;
+}
+
+/* Samples above a percentile (in hundredths of a percent) of a row. */
+static unsigned long latencyTail(const LATENCY_ROW *row, unsigned long hundredths)
+{
+    return (unsigned long)(((unsigned long long)row->samples * (10000ULL - hundredths)) / 10000ULL);
+}
+
+static int latencyWorse(const char *field, unsigned long hundredths, unsigned long current, unsigned long baseline,
+    unsigned long tolerance, const LATENCY_ROW *row, const LATENCY_ROW *base)
+{
+    unsigned long long limit = ((unsigned long long)baseline * (100ULL + tolerance)) / 100ULL;
+
+    if ((latencyTail(row, hundredths) < latencyMinTail) || (latencyTail(base, hundredths) < latencyMinTail)
+        || ((unsigned long long)current <= limit) || ((current - baseline) <= latencySlackNs))
+    {
+        return 0;
+    }
+
+    fprintf(stderr, "REGRESSION %s,%lu,%lu: %s %lu ns, baseline %lu ns (+%llu%%)\n", row->op, row->payloadBytes,
+        row->loadHz, field, current, baseline,
+        (baseline > 0UL) ? ((((unsigned long long)current - baseline) * 100ULL) / baseline) : 0ULL);
+
+    return 1;
+}
+
+/* Compare every result row with its baseline row. Returns the number of
+ * regressed rows. */
+static unsigned int latencyCompare(const LATENCY_TABLE *results, const LATENCY_TABLE *baseline,
+    unsigned long tolerance)
+{
+    unsigned int regressions = 0U;
+
+    for (unsigned int i = 0U; i < results->count; i++)
+    {
+        const LATENCY_ROW *row = &results->rows[i];
+        const LATENCY_ROW *base = latencyFind(baseline, row);
+        int worse = 0;
+
+        if (base == NULL)
+        {
+            fprintf(stderr, "new      %s,%lu,%lu: not in the baseline\n", row->op, row->payloadBytes, row->loadHz);
+            continue;
+        }
+
+        worse |= latencyWorse("p50", CRYPTO_LATENCY_BENCH_P50, row->p50Ns, base->p50Ns, tolerance, row, base);
+        worse |= latencyWorse("p99", CRYPTO_LATENCY_BENCH_P99, row->p99Ns, base->p99Ns, tolerance, row, base);
+        worse |= latencyWorse("p99.9", CRYPTO_LATENCY_BENCH_P999, row->p999Ns, base->p999Ns, tolerance, row, base);
+        if (row->errors > base->errors)
+        {
+            fprintf(stderr, "REGRESSION %s,%lu,%lu: %lu errors, baseline %lu\n", row->op, row->payloadBytes,
+                row->loadHz, row->errors, base->errors);
+            worse = 1;
+        }
+
+        if (worse != 0)
+        {
+            regressions++;
+        }
+    }
+
+    for (unsigned int i = 0U; i < baseline->count; i++)
+    {
+        if (latencyFind(results, &baseline->rows[i]) == NULL)
+        {
+            fprintf(stderr, "missing  %s,%lu,%lu: not in the results\n", baseline->rows[i].op,
+                baseline->rows[i].payloadBytes, baseline->rows[i].loadHz);
+        }
+    }
+
+    fprintf(stderr, "%u of %u rows regressed beyond %lu%%\n", regressions, results->count, tolerance);
+
+    return regressions;
+}
+
+/* Write the baseline widened by the results: every field is the larger of
+ * the two, and rows found in only one of them are kept. */
+static void latencyFold(const LATENCY_TABLE *results, LATENCY_TABLE *baseline)
+{
+    for (unsigned int i = 0U; i < results->count; i++)
+    {
+        const LATENCY_ROW *row = &results->rows[i];
+        LATENCY_ROW *base = (LATENCY_ROW *)latencyFind(baseline, row);
+
+        if (base == NULL)
+        {
+            if (baseline->count < LATENCY_MAX_ROWS)
+            {
+                baseline->rows[baseline->count++] = *row;
+            }
+            continue;
+        }
+
+        base->samples = (row->samples > base->samples) ? row->samples : base->samples;
+        base->errors = (row->errors > base->errors) ? row->errors : base->errors;
+        base->minNs = (row->minNs > base->minNs) ? row->minNs : base->minNs;
+        base->p50Ns = (row->p50Ns > base->p50Ns) ? row->p50Ns : base->p50Ns;
+        base->p99Ns = (row->p99Ns > base->p99Ns) ? row->p99Ns : base->p99Ns;
+        base->p999Ns = (row->p999Ns > base->p999Ns) ? row->p999Ns : base->p999Ns;
+        base->maxNs = (row->maxNs > base->maxNs) ? row->maxNs : base->maxNs;
+    }
+
+    printf("%s\n", CRYPTO_LATENCY_BENCH_CSV_HEADER);
+    for (unsigned int i = 0U; i < baseline->count; i++)
+    {
+        const LATENCY_ROW *row = &baseline->rows[i];
+
+        printf("%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", row->op, row->payloadBytes, row->loadHz, row->samples,
+            row->errors, row->minNs, row->p50Ns, row->p99Ns, row->p999Ns, row->maxNs);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Latency Benchmark Port
+// *****************************************************************************
+// *****************************************************************************
+
+static uint64_t latencyNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static void latencySignal(int signo)
+{
+    uint64_t start = latencyNowNs();
+
+    (void)signo;
+    while ((latencyNowNs() - start) < (uint64_t)latencyWorkNs)
+    {
+    }
+    latencyInterrupts++;
+}
+
+uint32_t CRYPTO_LATENCY_BENCH_PORT_Timestamp(void)
+{
+    return (uint32_t)latencyNowNs();
+}
+
+uint32_t CRYPTO_LATENCY_BENCH_PORT_TickRate(void)
+{
+    return 1000000000UL;
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_LoadStart(uint32_t rateHz)
+{
+    struct sigevent event;
+    struct itimerspec period;
+    long intervalNs;
+
+    CRYPTO_LATENCY_BENCH_PORT_LoadStop();
+    if (rateHz == 0UL)
+    {
+        return;
+    }
+
+    (void)memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGALRM;
+    if (timer_create(CLOCK_MONOTONIC, &event, &latencyTimer) != 0)
+    {
+        perror("timer_create");
+        return;
+    }
+
+    intervalNs = 1000000000L / (long)rateHz;
+    period.it_interval.tv_sec = intervalNs / 1000000000L;
+    period.it_interval.tv_nsec = intervalNs % 1000000000L;
+    period.it_value = period.it_interval;
+    (void)timer_settime(latencyTimer, 0, &period, NULL);
+    latencyTimerActive = 1;
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_LoadStop(void)
+{
+    if (latencyTimerActive != 0)
+    {
+        (void)timer_delete(latencyTimer);
+        latencyTimerActive = 0;
+    }
+}
+
+void CRYPTO_LATENCY_BENCH_PORT_WriteLine(const char *line)
+{
+    if (latencyEcho != 0)
+    {
+        (void)printf("%s\n", line);
+        (void)fflush(stdout);
+    }
+    latencyParseRow(&latencyResults, line);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main(int argc, char **argv)
+{
+    static const uint32_t defaultRates[] = CRYPTO_LATENCY_BENCH_LOAD_RATES;
+    uint32_t rates[LATENCY_MAX_RATES];
+    size_t rateCount = 0U;
+    const char *only = NULL;
+    const char *resultsPath = NULL;
+    const char *baselinePath = NULL;
+    unsigned long iterations = 0UL;
+    unsigned long tolerance = 25UL;
+    int fold = 0;
+    struct sigaction action;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:l:o:w:r:c:t:s:k:u")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n':
+                iterations = strtoul(optarg, NULL, 10);
+                break;
+            case 'l':
+                for (char *rate = strtok(optarg, ","); (rate != NULL) && (rateCount < LATENCY_MAX_RATES);
+                    rate = strtok(NULL, ","))
+                {
+                    rates[rateCount++] = (uint32_t)strtoul(rate, NULL, 10);
+                }
+                break;
+            case 'o':
+                only = optarg;
+                break;
+            case 'w':
+                latencyWorkNs = strtol(optarg, NULL, 10);
+                break;
+            case 'r':
+                resultsPath = optarg;
+                break;
+            case 'c':
+                baselinePath = optarg;
+                break;
+            case 't':
+                tolerance = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                latencySlackNs = strtoul(optarg, NULL, 10);
+                break;
+            case 'k':
+                latencyMinTail = strtoul(optarg, NULL, 10);
+                break;
+            case 'u':
+                fold = 1;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-n iterations] [-l rate,...] [-o op] [-w work_ns] "
+                    "[-r results.csv] [-c baseline.csv [-u]] [-t percent] [-s slack_ns] [-k samples]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (((resultsPath != NULL) || (fold != 0)) && (baselinePath == NULL))
+    {
+        fprintf(stderr, "crypto_latency_bench: -r and -u need -c\n");
+        return 2;
+    }
+
+    if (resultsPath != NULL)
+    {
+        if (latencyLoad(&latencyResults, resultsPath) != 0)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        if (rateCount == 0U)
+        {
+            for (; rateCount < (sizeof(defaultRates) / sizeof(defaultRates[0])); rateCount++)
+            {
+                rates[rateCount] = defaultRates[rateCount];
+            }
+        }
+
+        (void)memset(&action, 0, sizeof(action));
+        action.sa_handler = &latencySignal;
+        (void)sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        (void)sigaction(SIGALRM, &action, NULL);
+
+        latencyEcho = (fold == 0);
+        CRYPTO_LATENCY_BENCH_PORT_WriteLine(CRYPTO_LATENCY_BENCH_CSV_HEADER);
+        for (size_t r = 0U; r < rateCount; r++)
+        {
+            if (CRYPTO_LATENCY_BENCH_Run(only, rates[r], (uint32_t)iterations) == 0UL)
+            {
+                fprintf(stderr, "crypto_latency_bench: unknown op %s\n", only);
+                return 2;
+            }
+        }
+        fprintf(stderr, "%ld load signals\n", (long)latencyInterrupts);
+    }
+
+    if ((baselinePath != NULL) && (latencyLoad(&latencyBaseline, baselinePath) != 0))
+    {
+        return 1;
+    }
+
+    if (fold != 0)
+    {
+        latencyFold(&latencyResults, &latencyBaseline);
+        return 0;
+    }
+
+    return ((baselinePath != NULL) && (latencyCompare(&latencyResults, &latencyBaseline, tolerance) > 0U)) ? 1 : 0;
+}
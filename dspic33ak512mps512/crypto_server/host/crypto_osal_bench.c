@@ -0,0 +1,425 @@
+/*******************************************************************************
+  Crypto OS Abstraction Contention Benchmark Host Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_osal_bench.c
+
+  Summary:
+    Drives the POSIX port of the OS abstraction (crypto_osal.c) from several
+    threads contending for simulated CAM engines on Linux.
+
+  Description:
+    Each simulated engine is a thread that runs one operation at a time for
+    the service time (-s) and then does what the engine's interrupt does on
+    the board: it calls Crypto_Osal_EngineSignal(). Worker threads each run
+    -n operations on engine (worker % -e) in one of three modes:
+      sleep  Crypto_Osal_EngineAcquire(), start, Crypto_Osal_EngineWait(),
+             Crypto_Osal_EngineRelease()
+      spin   the same ownership, but polls the engine's completion count in
+             place of the wait, as the driver library does today
+      none   no ownership and polling, as the wrappers were before the OS
+             abstraction; a start while the engine is busy is an overlap, and
+             an operation that ends with another worker's result is corrupt
+
+    One CSV row is printed per mode and thread count. mean_us and p99_us run from
+    acquire to release, cpu_ms is the process CPU time, which for spin grows
+    with the number of waiting threads. The exit status is 1 when sleep or
+    spin shows an overlap or a corrupt result.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "crypto/common_crypto/crypto_osal.h"
+
+#define OSAL_BENCH_MAX_THREADS      (64U)
+#define OSAL_BENCH_MAX_COUNTS       (8U)
+
+typedef enum {
+    OSAL_BENCH_SLEEP = 0,
+    OSAL_BENCH_SPIN,
+    OSAL_BENCH_NONE,
+    OSAL_BENCH_MODES
+}OSAL_BENCH_MODE;
+
+static const char *const osalBenchModeName[OSAL_BENCH_MODES] = { "sleep", "spin", "none" };
+
+// One simulated engine: the start register, the result register and the
+// completion count the driver library polls.
+typedef struct{
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool pending;
+    atomic_uint owner;
+    atomic_uint result;
+    atomic_bool busy;
+    atomic_ulong completed;
+}OSAL_BENCH_ENGINE;
+
+typedef struct{
+    OSAL_BENCH_MODE mode;
+    unsigned int id;
+    OSAL_BENCH_ENGINE *engine;
+    crypto_Osal_Engine_E engineId;
+    unsigned long ops;
+    uint64_t *latencyNs;
+    unsigned long overlaps;
+    unsigned long corrupt;
+    unsigned long errors;
+}OSAL_BENCH_WORKER;
+
+static OSAL_BENCH_ENGINE osalBenchEngine[CRYPTO_OSAL_ENGINE_MAX];
+static long osalBenchServiceNs = 50000L;
+static atomic_bool osalBenchStop;
+
+static uint64_t osalBenchNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+static void *osalBenchEngineThread(void *arg)
+{
+    OSAL_BENCH_ENGINE *engine = arg;
+    crypto_Osal_Engine_E engineId = (crypto_Osal_Engine_E)(engine - osalBenchEngine);
+    struct timespec service = { 0, osalBenchServiceNs };
+
+    for (;;)
+    {
+        (void)pthread_mutex_lock(&engine->mutex);
+        while ((!engine->pending) && (!atomic_load(&osalBenchStop)))
+        {
+            (void)pthread_cond_wait(&engine->cond, &engine->mutex);
+        }
+        engine->pending = false;
+        (void)pthread_mutex_unlock(&engine->mutex);
+
+        if (atomic_load(&osalBenchStop))
+        {
+            break;
+        }
+
+        (void)nanosleep(&service, NULL);
+
+        // The result belongs to whoever wrote the start register last.
+        atomic_store(&engine->result, atomic_load(&engine->owner));
+        atomic_store(&engine->busy, false);
+        (void)atomic_fetch_add(&engine->completed, 1UL);
+        Crypto_Osal_EngineSignal(engineId);
+    }
+
+    return NULL;
+}
+
+// Write the start register; returns true when the engine was already busy.
+static bool osalBenchStart(OSAL_BENCH_ENGINE *engine, unsigned int owner)
+{
+    bool overlap = atomic_exchange(&engine->busy, true);
+
+    atomic_store(&engine->owner, owner);
+    (void)pthread_mutex_lock(&engine->mutex);
+    engine->pending = true;
+    (void)pthread_cond_signal(&engine->cond);
+    (void)pthread_mutex_unlock(&engine->mutex);
+
+    return overlap;
+}
+
+static void *osalBenchWorkerThread(void *arg)
+{
+    OSAL_BENCH_WORKER *worker = arg;
+    OSAL_BENCH_ENGINE *engine = worker->engine;
+    unsigned long op;
+
+    for (op = 0UL; op < worker->ops; op++)
+    {
+        uint64_t start = osalBenchNowNs();
+        unsigned long seen;
+        bool owned = true;
+
+        if (worker->mode != OSAL_BENCH_NONE)
+        {
+            owned = (Crypto_Osal_EngineAcquire(worker->engineId) == CRYPTO_OSAL_SUCCESS);
+        }
+
+        if (owned)
+        {
+            seen = atomic_load(&engine->completed);
+            if (osalBenchStart(engine, worker->id))
+            {
+                worker->overlaps++;
+            }
+
+            if (worker->mode == OSAL_BENCH_SLEEP)
+            {
+                if (Crypto_Osal_EngineWait(worker->engineId, CRYPTO_OSAL_WAIT_FOREVER) != CRYPTO_OSAL_SUCCESS)
+                {
+                    worker->errors++;
+                }
+            }
+            else
+            {
+                while (atomic_load(&engine->completed) == seen)
+                {
+                }
+            }
+
+            if (atomic_load(&engine->result) != worker->id)
+            {
+                worker->corrupt++;
+            }
+
+            if (worker->mode != OSAL_BENCH_NONE)
+            {
+                (void)Crypto_Osal_EngineRelease(worker->engineId);
+            }
+        }
+        else
+        {
+            worker->errors++;
+        }
+
+        worker->latencyNs[op] = osalBenchNowNs() - start;
+    }
+
+    return NULL;
+}
+
+static int osalBenchCompare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint64_t osalBenchCpuNs(void)
+{
+    struct rusage usage;
+
+    (void)getrusage(RUSAGE_SELF, &usage);
+    return (((uint64_t)usage.ru_utime.tv_sec + (uint64_t)usage.ru_stime.tv_sec) * 1000000000ULL)
+        + (((uint64_t)usage.ru_utime.tv_usec + (uint64_t)usage.ru_stime.tv_usec) * 1000ULL);
+}
+
+// Runs one row; returns the overlaps plus corrupt results plus errors.
+static unsigned long osalBenchRun(OSAL_BENCH_MODE mode, unsigned int threads, unsigned int engines,
+                                  unsigned long ops)
+{
+    static OSAL_BENCH_WORKER workers[OSAL_BENCH_MAX_THREADS];
+    pthread_t thread[OSAL_BENCH_MAX_THREADS];
+    unsigned long total = threads * ops;
+    uint64_t *latencyNs = calloc(total, sizeof(uint64_t));
+    unsigned long overlaps = 0UL;
+    unsigned long corrupt = 0UL;
+    unsigned long errors = 0UL;
+    uint64_t sumNs = 0ULL;
+    uint64_t startNs;
+    uint64_t elapsedNs;
+    uint64_t cpuNs;
+    unsigned long i;
+    unsigned int t;
+
+    if (latencyNs == NULL)
+    {
+        fprintf(stderr, "crypto_osal_bench: out of memory\n");
+        exit(2);
+    }
+
+    for (t = 0U; t < threads; t++)
+    {
+        workers[t] = (OSAL_BENCH_WORKER){ .mode = mode, .id = t + 1U, .ops = ops,
+            .engineId = (crypto_Osal_Engine_E)(t % engines), .latencyNs = &latencyNs[t * ops] };
+        workers[t].engine = &osalBenchEngine[workers[t].engineId];
+    }
+
+    cpuNs = osalBenchCpuNs();
+    startNs = osalBenchNowNs();
+    for (t = 0U; t < threads; t++)
+    {
+        (void)pthread_create(&thread[t], NULL, osalBenchWorkerThread, &workers[t]);
+    }
+    for (t = 0U; t < threads; t++)
+    {
+        (void)pthread_join(thread[t], NULL);
+        overlaps += workers[t].overlaps;
+        corrupt += workers[t].corrupt;
+        errors += workers[t].errors;
+    }
+    elapsedNs = osalBenchNowNs() - startNs;
+    cpuNs = osalBenchCpuNs() - cpuNs;
+
+    // A worker of the unguarded mode can return before the engine finishes
+    // an operation it overwrote; let it drain before the next row.
+    for (i = 0UL; i < (unsigned long)engines; i++)
+    {
+        while (atomic_load(&osalBenchEngine[i].busy))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    for (i = 0UL; i < total; i++)
+    {
+        sumNs += latencyNs[i];
+    }
+    qsort(latencyNs, total, sizeof(uint64_t), osalBenchCompare);
+
+    printf("%s,%u,%u,%lu,%.1f,%.0f,%.1f,%.1f,%.1f,%lu,%lu,%lu\n", osalBenchModeName[mode], threads, engines, total,
+        (double)elapsedNs / 1e6, ((double)total * 1e9) / (double)elapsedNs, (double)sumNs / (double)total / 1e3,
+        (double)latencyNs[(total * 99UL) / 100UL] / 1e3, (double)cpuNs / 1e6, overlaps, corrupt, errors);
+    (void)fflush(stdout);
+
+    free(latencyNs);
+
+    return (mode == OSAL_BENCH_NONE) ? 0UL : (overlaps + corrupt + errors);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int counts[OSAL_BENCH_MAX_COUNTS] = { 1U, 2U, 4U, 8U };
+    size_t countCount = 4U;
+    bool runMode[OSAL_BENCH_MODES] = { true, true, true };
+    unsigned int engines = 1U;
+    unsigned long ops = 2000UL;
+    unsigned long failures = 0UL;
+    unsigned int engine;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:n:s:e:m:")) != -1)
+    {
+        switch (opt)
+        {
+            case 't':
+                countCount = 0U;
+                for (char *count = strtok(optarg, ","); (count != NULL) && (countCount < OSAL_BENCH_MAX_COUNTS);
+                    count = strtok(NULL, ","))
+                {
+                    counts[countCount] = (unsigned int)strtoul(count, NULL, 10);
+                    if ((counts[countCount] == 0U) || (counts[countCount] > OSAL_BENCH_MAX_THREADS))
+                    {
+                        fprintf(stderr, "crypto_osal_bench: thread counts are 1 to %u\n", OSAL_BENCH_MAX_THREADS);
+                        return 2;
+                    }
+                    countCount++;
+                }
+                break;
+            case 'n':
+                ops = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                osalBenchServiceNs = strtol(optarg, NULL, 10) * 1000L;
+                break;
+            case 'e':
+                engines = (unsigned int)strtoul(optarg, NULL, 10);
+                break;
+            case 'm':
+                memset(runMode, 0, sizeof(runMode));
+                for (char *mode = strtok(optarg, ","); mode != NULL; mode = strtok(NULL, ","))
+                {
+                    for (engine = 0U; engine < (unsigned int)OSAL_BENCH_MODES; engine++)
+                    {
+                        if (strcmp(mode, osalBenchModeName[engine]) == 0)
+                        {
+                            runMode[engine] = true;
+                        }
+                    }
+                }
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-t threads,...] [-n ops_per_thread] [-s service_us] [-e engines] "
+                    "[-m sleep,spin,none]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if ((ops == 0UL) || (engines == 0U) || (engines > (unsigned int)CRYPTO_OSAL_ENGINE_MAX)
+        || (osalBenchServiceNs < 0L) || (osalBenchServiceNs >= 1000000000L))
+    {
+        fprintf(stderr, "crypto_osal_bench: -n must be positive, -e 1 to %u and -s below one second\n",
+            (unsigned int)CRYPTO_OSAL_ENGINE_MAX);
+        return 2;
+    }
+
+    if (Crypto_Osal_Initialize() != CRYPTO_OSAL_SUCCESS)
+    {
+        fprintf(stderr, "crypto_osal_bench: Crypto_Osal_Initialize failed\n");
+        return 1;
+    }
+
+    for (engine = 0U; engine < engines; engine++)
+    {
+        (void)pthread_mutex_init(&osalBenchEngine[engine].mutex, NULL);
+        (void)pthread_cond_init(&osalBenchEngine[engine].cond, NULL);
+        (void)pthread_create(&osalBenchEngine[engine].thread, NULL, osalBenchEngineThread, &osalBenchEngine[engine]);
+    }
+
+    fprintf(stderr, "%ld cpus, %ld us service time\n", sysconf(_SC_NPROCESSORS_ONLN), osalBenchServiceNs / 1000L);
+    printf("mode,threads,engines,ops,elapsed_ms,ops_per_s,mean_us,p99_us,cpu_ms,overlaps,corrupt,errors\n");
+    for (size_t c = 0U; c < countCount; c++)
+    {
+        for (OSAL_BENCH_MODE mode = OSAL_BENCH_SLEEP; mode < OSAL_BENCH_MODES; mode++)
+        {
+            if (runMode[mode])
+            {
+                failures += osalBenchRun(mode, counts[c], engines, ops);
+            }
+        }
+    }
+
+    atomic_store(&osalBenchStop, true);
+    for (engine = 0U; engine < engines; engine++)
+    {
+        (void)pthread_mutex_lock(&osalBenchEngine[engine].mutex);
+        (void)pthread_cond_signal(&osalBenchEngine[engine].cond);
+        (void)pthread_mutex_unlock(&osalBenchEngine[engine].mutex);
+        (void)pthread_join(osalBenchEngine[engine].thread, NULL);
+    }
+
+    if (failures != 0UL)
+    {
+        fprintf(stderr, "crypto_osal_bench: %lu overlaps, corrupt results or errors with ownership\n", failures);
+    }
+
+    return (failures != 0UL) ? 1 : 0;
+}
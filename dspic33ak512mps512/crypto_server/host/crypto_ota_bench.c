@@ -0,0 +1,622 @@
+/*******************************************************************************
+  Crypto OTA Receiver Host Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ota_bench.c
+
+  Summary:
+    Times the OTA receiver (crypto_ota.c) on Linux, receiving an encrypted
+    image over a pty into a file used as the flash slot, overlapped against
+    one stage at a time.
+
+  Description:
+    A sender thread writes the image to the pty at the chosen baud rate (ten
+    bit times per byte). In the overlapped mode a receive thread stands in
+    for the UART interrupt: it reads the pty and passes the bytes to
+    CRYPTO_OTA_RxByte() with the main thread's lock held, while the main
+    thread runs CRYPTO_OTA_Task(). In the sequential mode the receiver holds
+    one block at a time, so the sender waits for a one-byte acknowledgement
+    after each block, sent once the block is decrypted and programmed.
+
+    The flash stand-in writes the file at once and then reports busy for
+    -p nanoseconds per byte, as an NVM controller programming in the
+    background; the Crypto_* stand-in models the AES-GCM engine with
+    CRYPTO_STANDIN_NS_PER_BYTE.
+
+    One CSV row is written per mode:
+      mode,image_bytes,block_bytes,baud,flash_ns_per_byte,runs,best_ms,bytes_per_s,line_rate_pct
+    line_rate_pct compares the image bytes per second with the raw rate of
+    the line, baud / 10. The slot is compared with the image after each run,
+    and an image with a corrupted ciphertext byte must fail with
+    CRYPTO_OTA_ERROR_AUTH without being activated; the tool exits with 1
+    otherwise.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _XOPEN_SOURCE 700
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <termios.h>
+
+#include "app/crypto_ota.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+
+#define OTA_PIECE_BYTES         (256U)
+#define OTA_ACK                 (0x06U)
+
+static uint8_t otaKeyBytes[16];
+static uint8_t *otaImage;
+static uint8_t *otaStream;
+static uint32_t otaImageBytes;
+static uint32_t otaStreamBytes;
+static uint32_t otaBaud;
+static uint32_t otaFlashNsPerByte;
+
+static int otaMaster = -1;
+static int otaSlave = -1;
+static int otaFlashFd = -1;
+static uint32_t otaFlashSize;
+
+static pthread_mutex_t otaLock = PTHREAD_MUTEX_INITIALIZER;
+static sem_t otaWake;
+static volatile bool otaStop;
+static bool otaAcked;
+static bool otaActivated;
+static struct timespec otaFlashReady;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Time
+// *****************************************************************************
+// *****************************************************************************
+
+static void lOta_After(struct timespec *t, uint64_t ns)
+{
+    (void)clock_gettime(CLOCK_MONOTONIC, t);
+    ns += (uint64_t)t->tv_nsec;
+    t->tv_sec += (time_t)(ns / 1000000000ULL);
+    t->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+static bool lOta_Passed(const struct timespec *t)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (now.tv_sec > t->tv_sec) || ((now.tv_sec == t->tv_sec) && (now.tv_nsec >= t->tv_nsec));
+}
+
+static double lOta_NowMs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: OTA Receiver Port
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_OTA_PORT_RxLock(void)
+{
+    (void)pthread_mutex_lock(&otaLock);
+}
+
+void CRYPTO_OTA_PORT_RxUnlock(void)
+{
+    (void)pthread_mutex_unlock(&otaLock);
+}
+
+bool CRYPTO_OTA_PORT_FlashWrite(uint32_t address, const uint8_t *data, uint32_t length)
+{
+    if (((size_t)address > otaFlashSize) || (length > (otaFlashSize - address)) ||
+        (pwrite(otaFlashFd, data, length, (off_t)address) != (ssize_t)length))
+    {
+        return false;
+    }
+    lOta_After(&otaFlashReady, (uint64_t)length * otaFlashNsPerByte);
+
+    return true;
+}
+
+bool CRYPTO_OTA_PORT_FlashBusy(bool *failed)
+{
+    *failed = false;
+
+    return !lOta_Passed(&otaFlashReady);
+}
+
+bool CRYPTO_OTA_PORT_Activate(uint32_t address, uint32_t length)
+{
+    otaActivated = (address == 0U) && (length == otaImageBytes);
+
+    return otaActivated;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Sender
+// *****************************************************************************
+// *****************************************************************************
+
+// Encrypt the image into the stream: header, ciphertext and tag.
+static int lOta_MakeStream(void)
+{
+    uint8_t *header = otaStream;
+    uint8_t *tag;
+
+    (void)memcpy(header, CRYPTO_OTA_MAGIC, 4U);
+    header[4] = (uint8_t)otaImageBytes;
+    header[5] = (uint8_t)(otaImageBytes >> 8);
+    header[6] = (uint8_t)(otaImageBytes >> 16);
+    header[7] = (uint8_t)(otaImageBytes >> 24);
+    for (uint32_t i = 0U; i < CRYPTO_OTA_IV_SIZE; i++)
+    {
+        header[8U + i] = (uint8_t)(0xA0U + i);
+    }
+    tag = &otaStream[CRYPTO_OTA_HEADER_SIZE + otaImageBytes];
+
+    return (Crypto_Aead_AesGcm_EncryptAuthDirect(CRYPTO_HANDLER_HW_INTERNAL, otaImage, otaImageBytes,
+                &otaStream[CRYPTO_OTA_HEADER_SIZE], otaKeyBytes, sizeof(otaKeyBytes), &header[8],
+                CRYPTO_OTA_IV_SIZE, header, CRYPTO_OTA_HEADER_SIZE, tag, (uint8_t)CRYPTO_OTA_TAG_SIZE, 1U) ==
+            CRYPTO_AEAD_CIPHER_SUCCESS) ? 0 : -1;
+}
+
+static int lOta_WriteAll(const uint8_t *data, uint32_t length)
+{
+    while (length > 0U)
+    {
+        ssize_t written = write(otaSlave, data, length);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        data += written;
+        length -= (uint32_t)written;
+    }
+
+    return 0;
+}
+
+// Send the stream at the line rate; with acknowledgements, wait for one after each block.
+static void *lOta_Sender(void *arg)
+{
+    bool acked = *(const bool *)arg;
+    uint64_t nsPerByte = 10000000000ULL / otaBaud;
+    uint32_t cipherEnd = CRYPTO_OTA_HEADER_SIZE + otaImageBytes;
+    uint32_t sent = 0U;
+    struct timespec start;
+    struct timespec due;
+    uint8_t ack;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    while ((sent < otaStreamBytes) && !otaStop)
+    {
+        uint32_t length = otaStreamBytes - sent;
+        uint32_t blockEnd;
+        uint64_t ns;
+
+        if (length > OTA_PIECE_BYTES)
+        {
+            length = OTA_PIECE_BYTES;
+        }
+        if (acked && (sent >= CRYPTO_OTA_HEADER_SIZE) && (sent < cipherEnd))
+        {
+            blockEnd = CRYPTO_OTA_HEADER_SIZE +
+                       ((((sent - CRYPTO_OTA_HEADER_SIZE) / CRYPTO_OTA_BLOCK_SIZE) + 1U) * CRYPTO_OTA_BLOCK_SIZE);
+            blockEnd = (blockEnd < cipherEnd) ? blockEnd : cipherEnd;
+            length = ((sent + length) > blockEnd) ? (blockEnd - sent) : length;
+        }
+        else if (acked && (sent < CRYPTO_OTA_HEADER_SIZE))
+        {
+            length = CRYPTO_OTA_HEADER_SIZE;
+        }
+
+        if (lOta_WriteAll(&otaStream[sent], length) != 0)
+        {
+            break;
+        }
+        sent += length;
+
+        // Keep to the line rate from the start, or from the last acknowledgement.
+        ns = (uint64_t)sent * nsPerByte;
+        due.tv_sec = start.tv_sec + (time_t)(ns / 1000000000ULL);
+        due.tv_nsec = start.tv_nsec + (long)(ns % 1000000000ULL);
+        if (due.tv_nsec >= 1000000000L)
+        {
+            due.tv_sec++;
+            due.tv_nsec -= 1000000000L;
+        }
+        (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL);
+
+        if (acked && (sent > CRYPTO_OTA_HEADER_SIZE) && (sent <= cipherEnd) &&
+            ((((sent - CRYPTO_OTA_HEADER_SIZE) % CRYPTO_OTA_BLOCK_SIZE) == 0U) || (sent == cipherEnd)))
+        {
+            if (read(otaSlave, &ack, 1U) != 1)
+            {
+                break;
+            }
+            // The wait for the acknowledgement is not line time.
+            (void)clock_gettime(CLOCK_MONOTONIC, &start);
+            start.tv_sec -= (time_t)(((uint64_t)sent * nsPerByte) / 1000000000ULL);
+            start.tv_nsec -= (long)(((uint64_t)sent * nsPerByte) % 1000000000ULL);
+            if (start.tv_nsec < 0)
+            {
+                start.tv_sec--;
+                start.tv_nsec += 1000000000L;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Receiver
+// *****************************************************************************
+// *****************************************************************************
+
+// Feed a batch of received bytes, as one receive interrupt would.
+static ssize_t lOta_Receive(void)
+{
+    uint8_t buffer[512];
+    ssize_t count = read(otaMaster, buffer, sizeof(buffer));
+
+    if (count > 0)
+    {
+        CRYPTO_OTA_PORT_RxLock();
+        for (ssize_t i = 0; i < count; i++)
+        {
+            CRYPTO_OTA_RxByte(buffer[i]);
+        }
+        CRYPTO_OTA_PORT_RxUnlock();
+    }
+
+    return count;
+}
+
+static void *lOta_RxInterrupt(void *arg)
+{
+    struct pollfd pfd = { .fd = otaMaster, .events = POLLIN };
+
+    (void)arg;
+    while (!otaStop)
+    {
+        if ((poll(&pfd, 1, 10) > 0) && (lOta_Receive() > 0))
+        {
+            (void)sem_post(&otaWake);
+        }
+    }
+
+    return NULL;
+}
+
+static CRYPTO_OTA_STATUS lOta_RunOverlapped(void)
+{
+    CRYPTO_OTA_STATUS status = CRYPTO_OTA_PENDING;
+    uint32_t committed = 0U;
+    uint32_t last = 0U;
+    struct timespec wait;
+
+    while (status == CRYPTO_OTA_PENDING)
+    {
+        status = CRYPTO_OTA_Task();
+        CRYPTO_OTA_GetProgress(NULL, &committed, NULL);
+
+        // Sleep until the next bytes arrive, polling for the end of programming.
+        if ((status == CRYPTO_OTA_PENDING) && (committed == last))
+        {
+            lOta_After(&wait, 50000U);
+            (void)sem_timedwait(&otaWake, &wait);
+        }
+        last = committed;
+    }
+
+    return status;
+}
+
+static CRYPTO_OTA_STATUS lOta_RunSequential(void)
+{
+    CRYPTO_OTA_STATUS status = CRYPTO_OTA_PENDING;
+    struct pollfd pfd = { .fd = otaMaster, .events = POLLIN };
+    uint32_t received = 0U;
+    uint32_t committed = 0U;
+    uint32_t length = 0U;
+    uint32_t acked = 0U;
+    uint8_t ack = OTA_ACK;
+
+    while (status == CRYPTO_OTA_PENDING)
+    {
+        if ((poll(&pfd, 1, 100) > 0) && (lOta_Receive() < 0))
+        {
+            return CRYPTO_OTA_ERROR_ARG;
+        }
+        CRYPTO_OTA_GetProgress(&received, &committed, &length);
+
+        // A whole block in: decrypt and program it, then let the sender go on.
+        if ((length > 0U) && (received > acked) &&
+            (((received - acked) == CRYPTO_OTA_BLOCK_SIZE) || (received == length)))
+        {
+            while ((status == CRYPTO_OTA_PENDING) && (committed < received))
+            {
+                status = CRYPTO_OTA_Task();
+                CRYPTO_OTA_GetProgress(NULL, &committed, NULL);
+            }
+            acked = received;
+            if (write(otaMaster, &ack, 1U) != 1)
+            {
+                return CRYPTO_OTA_ERROR_ARG;
+            }
+        }
+
+        if (status == CRYPTO_OTA_PENDING)
+        {
+            status = CRYPTO_OTA_Task();
+        }
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Benchmark
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_OTA_STATUS lOta_Transfer(bool sequential, double *ms)
+{
+    pthread_t sender;
+    pthread_t rx;
+    CRYPTO_OTA_STATUS status;
+    double start;
+
+    otaStop = false;
+    otaAcked = sequential;
+    otaActivated = false;
+    otaFlashReady.tv_sec = 0;
+    otaFlashReady.tv_nsec = 0;
+    (void)tcflush(otaSlave, TCIOFLUSH);
+    (void)CRYPTO_OTA_Start(otaKeyBytes, sizeof(otaKeyBytes), 0U, otaFlashSize);
+
+    start = lOta_NowMs();
+    (void)pthread_create(&sender, NULL, lOta_Sender, &otaAcked);
+    if (sequential)
+    {
+        status = lOta_RunSequential();
+    }
+    else
+    {
+        (void)pthread_create(&rx, NULL, lOta_RxInterrupt, NULL);
+        status = lOta_RunOverlapped();
+    }
+    *ms = lOta_NowMs() - start;
+
+    otaStop = true;
+    if (!sequential)
+    {
+        (void)pthread_join(rx, NULL);
+    }
+    // The sender may wait for an acknowledgement that will not come after a failure.
+    if (status != CRYPTO_OTA_SUCCESS)
+    {
+        uint8_t ack = OTA_ACK;
+
+        (void)write(otaMaster, &ack, 1U);
+    }
+    (void)pthread_join(sender, NULL);
+
+    return status;
+}
+
+static int lOta_CheckSlot(void)
+{
+    uint8_t buffer[4096];
+
+    for (uint32_t offset = 0U; offset < otaImageBytes; offset += sizeof(buffer))
+    {
+        uint32_t length = ((otaImageBytes - offset) < sizeof(buffer)) ? (otaImageBytes - offset) : sizeof(buffer);
+
+        if ((pread(otaFlashFd, buffer, length, (off_t)offset) != (ssize_t)length) ||
+            (memcmp(buffer, &otaImage[offset], length) != 0))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int lOta_Time(const char *name, bool sequential, uint32_t runs)
+{
+    double best = 0.0;
+    double ms;
+    CRYPTO_OTA_STATUS status;
+
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        if (ftruncate(otaFlashFd, 0) != 0)
+        {
+            return 1;
+        }
+        (void)ftruncate(otaFlashFd, (off_t)otaFlashSize);
+
+        status = lOta_Transfer(sequential, &ms);
+        if ((status != CRYPTO_OTA_SUCCESS) || !otaActivated || (lOta_CheckSlot() != 0))
+        {
+            fprintf(stderr, "%s: transfer failed (%d) or slot differs from the image\n", name, (int)status);
+            return 1;
+        }
+        if ((run == 0U) || (ms < best))
+        {
+            best = ms;
+        }
+    }
+
+    printf("%s,%u,%lu,%u,%u,%u,%.1f,%.0f,%.1f\n", name, (unsigned int)otaImageBytes, CRYPTO_OTA_BLOCK_SIZE,
+           (unsigned int)otaBaud, (unsigned int)otaFlashNsPerByte, (unsigned int)runs, best,
+           (double)otaImageBytes * 1000.0 / best,
+           100.0 * ((double)otaImageBytes * 1000.0 / best) / ((double)otaBaud / 10.0));
+
+    return 0;
+}
+
+static int lOta_CheckTamper(void)
+{
+    uint32_t offset = CRYPTO_OTA_HEADER_SIZE + (otaImageBytes / 2U);
+    CRYPTO_OTA_STATUS status;
+    double ms;
+
+    otaStream[offset] ^= 0x01U;
+    status = lOta_Transfer(false, &ms);
+    otaStream[offset] ^= 0x01U;
+
+    if ((status != CRYPTO_OTA_ERROR_AUTH) || otaActivated)
+    {
+        fprintf(stderr, "tamper: corrupted image not rejected (%d)\n", (int)status);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char path[64] = "/tmp/crypto_ota_flashXXXXXX";
+    struct termios tio;
+    uint32_t runs = 3U;
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    int failed = 0;
+    int opt;
+
+    otaImageBytes = 256U * 1024U;
+    otaBaud = 2000000U;
+    otaFlashNsPerByte = 0U;
+
+    while ((opt = getopt(argc, argv, "s:b:p:n:")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                otaImageBytes = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                otaBaud = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                otaFlashNsPerByte = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                runs = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s image_bytes] [-b baud] [-p flash_ns_per_byte] [-n runs]\n", argv[0]);
+                return 2;
+        }
+    }
+    if ((otaImageBytes == 0U) || (otaImageBytes > (64U * 1024U * 1024U)) || (otaBaud == 0U) || (runs == 0U))
+    {
+        fprintf(stderr, "image_bytes must be 1 to 64 MiB, baud and runs at least 1\n");
+        return 2;
+    }
+
+    otaFlashSize = otaImageBytes;
+    otaStreamBytes = CRYPTO_OTA_HEADER_SIZE + otaImageBytes + CRYPTO_OTA_TAG_SIZE;
+    otaImage = malloc(otaImageBytes);
+    otaStream = malloc(otaStreamBytes);
+    if ((otaImage == NULL) || (otaStream == NULL) || (sem_init(&otaWake, 0, 0U) != 0))
+    {
+        return 2;
+    }
+    for (uint32_t i = 0U; i < sizeof(otaKeyBytes); i++)
+    {
+        otaKeyBytes[i] = (uint8_t)(0x10U + i);
+    }
+    for (uint32_t i = 0U; i < otaImageBytes; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        otaImage[i] = (uint8_t)(x >> 32);
+    }
+    if (lOta_MakeStream() != 0)
+    {
+        fprintf(stderr, "encrypting the image failed\n");
+        return 2;
+    }
+
+    otaFlashFd = mkstemp(path);
+    otaMaster = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((otaFlashFd < 0) || (otaMaster < 0) || (grantpt(otaMaster) != 0) || (unlockpt(otaMaster) != 0))
+    {
+        perror("setup");
+        return 2;
+    }
+    (void)unlink(path);
+    otaSlave = open(ptsname(otaMaster), O_RDWR | O_NOCTTY);
+    if ((otaSlave < 0) || (tcgetattr(otaSlave, &tio) != 0))
+    {
+        perror("pty");
+        return 2;
+    }
+    cfmakeraw(&tio);
+    (void)tcsetattr(otaSlave, TCSANOW, &tio);
+
+    printf("mode,image_bytes,block_bytes,baud,flash_ns_per_byte,runs,best_ms,bytes_per_s,line_rate_pct\n");
+    failed |= lOta_Time("sequential", true, runs);
+    failed |= lOta_Time("overlapped", false, runs);
+    failed |= lOta_CheckTamper();
+
+    return failed;
+}
@@ -0,0 +1,300 @@
+/*******************************************************************************
+  Crypto Offload Benchmark Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_bench.c
+
+  Summary:
+    Measures crypto offload server throughput (requests per second) against
+    payload size.
+
+  Description:
+    With -d the benchmark talks to a board (or a crypto_server_posix pty)
+    through a serial device. Without -d it forks an in-process server
+    (crypto_server.c with the host stand-in) connected by a socketpair,
+    which measures the framing and pipelining overhead of the host side only.
+
+    Results are written to stdout as CSV:
+        op,payload_bytes,window,requests,seconds,requests_per_s,kib_per_s,errors
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "crypto_client.h"
+#include "crypto_server_posix.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+#define BENCH_TIMEOUT_MS    (5000)
+
+typedef struct
+{
+    const char *name;
+    crypto_Server_Op_E op;
+} BENCH_OP;
+
+static const BENCH_OP benchOps[] = {
+    { "hash", CRYPTO_SERVER_OP_HASH },
+    { "gcm_seal", CRYPTO_SERVER_OP_GCM_SEAL },
+    { "cmac", CRYPTO_SERVER_OP_CMAC },
+    { "ecdsa_sign", CRYPTO_SERVER_OP_ECDSA_SIGN },
+    { "trng", CRYPTO_SERVER_OP_TRNG },
+};
+
+static const uint16_t benchSizes[] = { 16U, 64U, 256U, 1024U, 2000U };
+
+static unsigned long benchErrors;
+
+static void benchDone(void *context, int status, const uint8_t *payload, uint16_t length)
+{
+    (void)context;
+    (void)payload;
+    (void)length;
+
+    if (status != (int)CRYPTO_SERVER_STATUS_OK)
+    {
+        benchErrors++;
+    }
+}
+
+static double benchNow(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+
+/* Build a request whose data part is 'size' bytes. Returns the payload
+ * length, or 0 if the size does not fit the operation. */
+static uint16_t benchRequest(crypto_Server_Op_E op, uint16_t size, uint8_t *req)
+{
+    static const uint8_t key[32] = { 0x01 };
+    uint16_t len = 0U;
+
+    switch (op)
+    {
+        case CRYPTO_SERVER_OP_HASH:
+            req[len++] = (uint8_t)CRYPTO_HASH_SHA2_256;
+            break;
+        case CRYPTO_SERVER_OP_GCM_SEAL:
+            // keyLen ivLen tagLen aadLen(2) key iv
+            req[len++] = 16U;
+            req[len++] = 12U;
+            req[len++] = 16U;
+            req[len++] = 0U;
+            req[len++] = 0U;
+            (void)memcpy(&req[len], key, 16U);
+            len += 16U;
+            (void)memset(&req[len], 0x5A, 12U);
+            len += 12U;
+            break;
+        case CRYPTO_SERVER_OP_CMAC:
+            req[len++] = 16U;
+            req[len++] = 16U;
+            (void)memcpy(&req[len], key, 16U);
+            len += 16U;
+            break;
+        case CRYPTO_SERVER_OP_ECDSA_SIGN:
+            // Fixed P-256 sign of a 32-byte hash; the size sweep does not apply.
+            req[len++] = (uint8_t)CRYPTO_ECC_CURVE_P256;
+            req[len++] = 32U;
+            req[len++] = 32U;
+            (void)memcpy(&req[len], key, 32U);
+            len += 32U;
+            (void)memset(&req[len], 0xA5, 32U);
+            return (uint16_t)(len + 32U);
+        case CRYPTO_SERVER_OP_TRNG:
+            req[0] = (uint8_t)size;
+            req[1] = (uint8_t)(size >> 8);
+            return 2U;
+        default:
+            return 0U;
+    }
+
+    // GCM_SEAL responses carry the data plus a tag.
+    if (((uint32_t)len + size > CRYPTO_SERVER_MAX_PAYLOAD)
+        || ((op == CRYPTO_SERVER_OP_GCM_SEAL) && ((uint32_t)size + 16U > CRYPTO_SERVER_MAX_PAYLOAD)))
+    {
+        return 0U;
+    }
+
+    for (uint16_t i = 0U; i < size; i++)
+    {
+        req[len + i] = (uint8_t)i;
+    }
+
+    return (uint16_t)(len + size);
+}
+
+static int benchRun(CRYPTO_CLIENT *client, const BENCH_OP *op, uint16_t size, unsigned long count)
+{
+    static uint8_t req[CRYPTO_SERVER_MAX_PAYLOAD];
+    uint16_t reqLen = benchRequest(op->op, size, req);
+    double start;
+    double seconds;
+
+    if (reqLen == 0U)
+    {
+        return 0;
+    }
+
+    benchErrors = 0UL;
+    start = benchNow();
+    for (unsigned long i = 0UL; i < count; i++)
+    {
+        if (CRYPTO_CLIENT_Submit(client, op->op, req, reqLen, benchDone, NULL) != 0)
+        {
+            return -1;
+        }
+    }
+    if (CRYPTO_CLIENT_Drain(client) != 0)
+    {
+        return -1;
+    }
+    seconds = benchNow() - start;
+
+    printf("%s,%u,%u,%lu,%.6f,%.1f,%.1f,%lu\n", op->name, size, CRYPTO_CLIENT_Window(client), count, seconds,
+           (double)count / seconds, ((double)count * size) / (1024.0 * seconds), benchErrors);
+    fflush(stdout);
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *device = NULL;
+    const char *only = NULL;
+    unsigned long count = 1000UL;
+    uint32_t baudRate = 921600UL;
+    CRYPTO_CLIENT *client;
+    pid_t server = -1;
+    int opt;
+    int status = 0;
+
+    while ((opt = getopt(argc, argv, "d:b:n:o:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd':
+                device = optarg;
+                break;
+            case 'b':
+                baudRate = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            case 'o':
+                only = optarg;
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-d device] [-b baud] [-n requests] [-o op]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (device != NULL)
+    {
+        client = CRYPTO_CLIENT_Open(device, baudRate, BENCH_TIMEOUT_MS);
+    }
+    else
+    {
+        int sv[2];
+
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0)
+        {
+            perror("socketpair");
+            return 1;
+        }
+
+        server = fork();
+        if (server == 0)
+        {
+            (void)close(sv[0]);
+            _exit((CRYPTO_SERVER_POSIX_Run(sv[1]) == 0) ? 0 : 1);
+        }
+
+        (void)close(sv[1]);
+        client = CRYPTO_CLIENT_OpenFd(sv[0], BENCH_TIMEOUT_MS);
+    }
+
+    if (client == NULL)
+    {
+        fprintf(stderr, "crypto_server_bench: no response from server\n");
+        return 1;
+    }
+
+    printf("op,payload_bytes,window,requests,seconds,requests_per_s,kib_per_s,errors\n");
+    for (size_t o = 0U; (o < (sizeof(benchOps) / sizeof(benchOps[0]))) && (status == 0); o++)
+    {
+        if ((only != NULL) && (strcmp(only, benchOps[o].name) != 0))
+        {
+            continue;
+        }
+
+        for (size_t s = 0U; (s < (sizeof(benchSizes) / sizeof(benchSizes[0]))) && (status == 0); s++)
+        {
+            if (benchOps[o].op == CRYPTO_SERVER_OP_ECDSA_SIGN)
+            {
+                // One point: a P-256 signature over a 32-byte hash.
+                status = benchRun(client, &benchOps[o], 32U, count);
+                break;
+            }
+
+            status = benchRun(client, &benchOps[o], benchSizes[s], count);
+        }
+    }
+
+    CRYPTO_CLIENT_Close(client);
+    if (server > 0)
+    {
+        (void)waitpid(server, NULL, 0);
+    }
+
+    if (status != 0)
+    {
+        fprintf(stderr, "crypto_server_bench: request failed or timed out\n");
+    }
+
+    return (status == 0) ? 0 : 1;
+}
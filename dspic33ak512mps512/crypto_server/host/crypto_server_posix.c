@@ -0,0 +1,243 @@
+/*******************************************************************************
+  Crypto Server POSIX Port Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_posix.c
+
+  Summary:
+    POSIX transport port and entry point for the crypto offload server.
+
+  Description:
+    With no arguments a pseudo-terminal is created and its slave path is
+    printed, so host clients can open it exactly like the board's serial
+    port. With -f <fd> the server runs on an inherited file descriptor.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _XOPEN_SOURCE 700
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "app/crypto_server.h"
+#include "crypto_server_posix.h"
+#include "crypto/common_crypto/crypto_trace.h"
+
+#define CRYPTO_SERVER_POSIX_READ_SIZE   (4096U)
+
+static int serverFd = -1;
+static int serverError;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Stands in for the receive interrupt. Returns the number of bytes read,
+ * 0 on end of stream or -1 on error. */
+static ssize_t lCRYPTO_SERVER_POSIX_Receive(void)
+{
+    uint8_t buffer[CRYPTO_SERVER_POSIX_READ_SIZE];
+    ssize_t count = read(serverFd, buffer, sizeof(buffer));
+
+    if ((count < 0) && ((errno == EAGAIN) || (errno == EINTR)))
+    {
+        return 1;
+    }
+
+    for (ssize_t i = 0; i < count; i++)
+    {
+        CRYPTO_SERVER_RxByte(buffer[i]);
+    }
+
+    return count;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Server Port Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+void CRYPTO_SERVER_PORT_Write(const uint8_t *data, uint32_t size)
+{
+    struct pollfd pfd = { .fd = serverFd, .events = POLLIN | POLLOUT };
+
+    while ((size > 0U) && (serverError == 0))
+    {
+        if (poll(&pfd, 1, -1) < 0)
+        {
+            if (errno != EINTR)
+            {
+                serverError = -1;
+            }
+            continue;
+        }
+
+        if ((pfd.revents & POLLIN) != 0)
+        {
+            if (lCRYPTO_SERVER_POSIX_Receive() <= 0)
+            {
+                serverError = -1;
+            }
+        }
+
+        if ((pfd.revents & POLLOUT) != 0)
+        {
+            ssize_t written = write(serverFd, data, size);
+
+            if (written > 0)
+            {
+                data += written;
+                size -= (uint32_t)written;
+            }
+            else if ((errno != EAGAIN) && (errno != EINTR))
+            {
+                serverError = -1;
+            }
+        }
+        else if ((pfd.revents & (POLLERR | POLLHUP)) != 0)
+        {
+            serverError = -1;
+        }
+    }
+}
+
+#ifdef CRYPTO_TRACE_ENABLE
+// Microsecond ticks: the 32-bit count wraps after about 71 minutes.
+uint32_t CRYPTO_TRACE_PORT_Timestamp(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * 1000000ULL) + ((uint64_t)now.tv_nsec / 1000ULL));
+}
+
+uint32_t CRYPTO_TRACE_PORT_TickRate(void)
+{
+    return 1000000UL;
+}
+#endif
+
+int CRYPTO_SERVER_POSIX_Run(int fd)
+{
+    struct pollfd pfd = { .fd = fd, .events = POLLIN };
+    ssize_t count;
+
+    serverFd = fd;
+    serverError = 0;
+    (void)fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    CRYPTO_SERVER_Initialize();
+
+    while (serverError == 0)
+    {
+        if (CRYPTO_SERVER_Task() == true)
+        {
+            continue;
+        }
+
+        if ((poll(&pfd, 1, -1) < 0) && (errno != EINTR))
+        {
+            return -1;
+        }
+
+        count = lCRYPTO_SERVER_POSIX_Receive();
+        if (count == 0)
+        {
+            return 0;
+        }
+        if (count < 0)
+        {
+            /* A pty master reports EIO once the last client closes the
+             * slave; keep serving the next client. */
+            if (errno != EIO)
+            {
+                return -1;
+            }
+            (void)poll(NULL, 0, 10);
+        }
+    }
+
+    return serverError;
+}
+
+#ifndef CRYPTO_SERVER_POSIX_NO_MAIN
+int main(int argc, char **argv)
+{
+    struct termios tio;
+    int master;
+    int slave;
+
+    if ((argc == 3) && (strcmp(argv[1], "-f") == 0))
+    {
+        return (CRYPTO_SERVER_POSIX_Run(atoi(argv[2])) == 0) ? 0 : 1;
+    }
+
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: %s [-f fd]\n", argv[0]);
+        return 2;
+    }
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+    {
+        perror("posix_openpt");
+        return 1;
+    }
+
+    /* Keep the slave open so the master does not see a hangup between
+     * clients, and put the line discipline into raw mode. */
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if ((slave < 0) || (tcgetattr(slave, &tio) != 0))
+    {
+        perror(ptsname(master));
+        return 1;
+    }
+    cfmakeraw(&tio);
+    (void)tcsetattr(slave, TCSANOW, &tio);
+
+    printf("%s\n", ptsname(master));
+    fflush(stdout);
+
+    return (CRYPTO_SERVER_POSIX_Run(master) == 0) ? 0 : 1;
+}
+#endif
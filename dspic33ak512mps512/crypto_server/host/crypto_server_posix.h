@@ -0,0 +1,64 @@
+/*******************************************************************************
+  Crypto Server POSIX Port Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_server_posix.h
+
+  Summary:
+    Runs the crypto offload server (crypto_server.X/app/src/crypto_server.c)
+    on a POSIX host over any byte-stream file descriptor.
+
+  Description:
+    The port plays the role of the UART interrupts on the device: received
+    bytes are fed to CRYPTO_SERVER_RxByte() whenever they arrive, including
+    while a response is being written, so a client that keeps several
+    requests in flight never deadlocks against a small pty buffer.
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_SERVER_POSIX_H
+#define CRYPTO_SERVER_POSIX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Serve requests on a file descriptor until the peer closes it.
+ * @param fd A connected socket, pipe-like stream or pty master.
+ * @return 0 when the peer closed the stream, -1 on an I/O error.
+ */
+int CRYPTO_SERVER_POSIX_Run(int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRYPTO_SERVER_POSIX_H */
@@ -0,0 +1,669 @@
+/*******************************************************************************
+  Host Crypto Stand-in Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_standin.c
+
+  Summary:
+    Software stand-in for the Crypto_* APIs used by the crypto offload server
+    and the C++ interface benchmark, for building and exercising them on a
+    Linux host without hardware.
+
+  Description:
+    THIS IS NOT A CRYPTOGRAPHIC IMPLEMENTATION. Each function checks its
+    arguments like the real Crypto_* API and produces deterministic output of
+    the correct size from a keyed mixing function, so that round trips work
+    (seal then open, sign then verify with the same hash) and the transport,
+    framing and pipelining can be tested and benchmarked.
+
+    The environment variables below add a busy-wait to every call to model
+    engine latency in benchmarks:
+      CRYPTO_STANDIN_NS_PER_BYTE   per input byte for hash, GCM and CMAC
+      CRYPTO_STANDIN_PKE_US        per ECDSA or ECDH operation
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_rng.h"
+
+#define STANDIN_BLOCK_SIZE  (16U)
+
+// State of the multi-step calls, kept in the data array of the API context.
+typedef struct
+{
+    uint64_t tag;       // Hash of key, IV, AAD and ciphertext so far
+    uint64_t seed;      // Key stream seed
+    uint32_t offset;    // Message bytes processed
+} standin_GcmState;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint64_t lStandin_Mix(uint64_t state, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        state ^= data[i];
+        state *= 0x100000001B3ULL;
+    }
+
+    return state;
+}
+
+static void lStandin_Expand(uint64_t seed, uint8_t *out, uint32_t len)
+{
+    uint64_t x = seed | 1U;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        out[i] = (uint8_t)(x >> 32);
+    }
+}
+
+static void lStandin_Delay(const char *name, uint64_t units)
+{
+    const char *env = getenv(name);
+    uint64_t ns;
+    struct timespec start;
+    struct timespec now;
+
+    if ((env == NULL) || (units == 0U))
+    {
+        return;
+    }
+
+    ns = strtoull(env, NULL, 10) * units;
+    if (ns == 0U)
+    {
+        return;
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    } while ((uint64_t)((now.tv_sec - start.tv_sec) * 1000000000LL + (now.tv_nsec - start.tv_nsec)) < ns);
+}
+
+static uint32_t lStandin_DigestLen(crypto_Hash_Algo_E algo)
+{
+    static const uint32_t lengths[] = { 0U, 20U, 28U, 32U, 48U, 64U };
+
+    return ((algo > CRYPTO_HASH_INVALID) && (algo < CRYPTO_HASH_MAX)) ? lengths[algo] : 0U;
+}
+
+static bool lStandin_ValidAesKey(uint32_t keyLen)
+{
+    return (keyLen == (uint32_t)CRYPTO_AESKEYSIZE_128) || (keyLen == (uint32_t)CRYPTO_AESKEYSIZE_192)
+        || (keyLen == (uint32_t)CRYPTO_AESKEYSIZE_256);
+}
+
+static uint64_t lStandin_GcmTag(uint8_t *key, uint32_t keyLen, uint8_t *iv, uint32_t ivLen,
+    uint8_t *aad, uint32_t aadLen, const uint8_t *ct, uint32_t ctLen)
+{
+    uint64_t state = 0xCBF29CE484222325ULL;
+
+    state = lStandin_Mix(state, key, keyLen);
+    state = lStandin_Mix(state, iv, ivLen);
+    if (aad != NULL)
+    {
+        state = lStandin_Mix(state, aad, aadLen);
+    }
+    return lStandin_Mix(state, ct, ctLen);
+}
+
+static uint64_t lStandin_GcmSeed(uint8_t *key, uint32_t keyLen, uint8_t *iv, uint32_t ivLen)
+{
+    return lStandin_Mix(lStandin_Mix(0x84222325CBF29CE4ULL, key, keyLen), iv, ivLen);
+}
+
+// XOR with the key stream from byte offset of the message on.
+static void lStandin_GcmXorAt(uint64_t seed, uint32_t offset, const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    uint8_t block[STANDIN_BLOCK_SIZE];
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        uint32_t pos = offset + i;
+
+        if (((pos % STANDIN_BLOCK_SIZE) == 0U) || (i == 0U))
+        {
+            lStandin_Expand(seed + (pos - (pos % STANDIN_BLOCK_SIZE)), block, STANDIN_BLOCK_SIZE);
+        }
+        out[i] = in[i] ^ block[pos % STANDIN_BLOCK_SIZE];
+    }
+}
+
+static void lStandin_GcmXor(uint8_t *key, uint32_t keyLen, uint8_t *iv, uint32_t ivLen,
+    const uint8_t *in, uint8_t *out, uint32_t len)
+{
+    lStandin_GcmXorAt(lStandin_GcmSeed(key, keyLen, iv, ivLen), 0U, in, out, len);
+}
+
+static uint32_t lStandin_CurveKeyLen(crypto_EccCurveType_E curve)
+{
+    switch (curve)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            return 24U;
+        case CRYPTO_ECC_CURVE_P256:
+            return 32U;
+        case CRYPTO_ECC_CURVE_P384:
+            return 48U;
+        case CRYPTO_ECC_CURVE_P521:
+            return 66U;
+        default:
+            return 0U;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto_* API Stand-ins
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Hash_Status_E Crypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen,
+    uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en, uint32_t shaSessionId)
+{
+    uint32_t digestLen = lStandin_DigestLen(shaAlgorithm_en);
+
+    if ((ptr_data == NULL) && (dataLen > 0U))
+    {
+        return CRYPTO_HASH_ERROR_INPUTDATA;
+    }
+    if (ptr_digest == NULL)
+    {
+        return CRYPTO_HASH_ERROR_OUTPUTDATA;
+    }
+    if (digestLen == 0U)
+    {
+        return CRYPTO_HASH_ERROR_ALGO;
+    }
+    if ((shaSessionId == 0U) || (shaHandler_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (shaSessionId == 0U) ? CRYPTO_HASH_ERROR_SID : CRYPTO_HASH_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", dataLen);
+    lStandin_Expand(lStandin_Mix((uint64_t)shaAlgorithm_en, ptr_data, dataLen), ptr_digest, digestLen);
+
+    return CRYPTO_HASH_SUCCESS;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sha_Init(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, crypto_Hash_Algo_E shaAlgorithm_en,
+    crypto_HandlerType_E shaHandler_en, uint32_t shaSessionId)
+{
+    uint64_t state = (uint64_t)shaAlgorithm_en;
+
+    if (ptr_shaCtx_st == NULL)
+    {
+        return CRYPTO_HASH_ERROR_CTX;
+    }
+    if (lStandin_DigestLen(shaAlgorithm_en) == 0U)
+    {
+        return CRYPTO_HASH_ERROR_ALGO;
+    }
+    if ((shaSessionId == 0U) || (shaHandler_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (shaSessionId == 0U) ? CRYPTO_HASH_ERROR_SID : CRYPTO_HASH_ERROR_HDLR;
+    }
+
+    ptr_shaCtx_st->shaSessionId = shaSessionId;
+    ptr_shaCtx_st->shaAlgo_en = shaAlgorithm_en;
+    ptr_shaCtx_st->shaHandler_en = shaHandler_en;
+    (void)memcpy(ptr_shaCtx_st->arr_shaDataCtx, &state, sizeof(state));
+
+    return CRYPTO_HASH_SUCCESS;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sha_Update(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_data, uint32_t dataLen)
+{
+    uint64_t state;
+
+    if (ptr_shaCtx_st == NULL)
+    {
+        return CRYPTO_HASH_ERROR_CTX;
+    }
+    if ((ptr_data == NULL) && (dataLen > 0U))
+    {
+        return CRYPTO_HASH_ERROR_INPUTDATA;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", dataLen);
+    (void)memcpy(&state, ptr_shaCtx_st->arr_shaDataCtx, sizeof(state));
+    state = lStandin_Mix(state, ptr_data, dataLen);
+    (void)memcpy(ptr_shaCtx_st->arr_shaDataCtx, &state, sizeof(state));
+
+    return CRYPTO_HASH_SUCCESS;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sha_Final(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_digest)
+{
+    uint64_t state;
+
+    if (ptr_shaCtx_st == NULL)
+    {
+        return CRYPTO_HASH_ERROR_CTX;
+    }
+    if (ptr_digest == NULL)
+    {
+        return CRYPTO_HASH_ERROR_OUTPUTDATA;
+    }
+
+    (void)memcpy(&state, ptr_shaCtx_st->arr_shaDataCtx, sizeof(state));
+    lStandin_Expand(state, ptr_digest, lStandin_DigestLen(ptr_shaCtx_st->shaAlgo_en));
+
+    return CRYPTO_HASH_SUCCESS;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData,
+    uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+    uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen,
+    uint32_t sessionID)
+{
+    uint8_t tag[STANDIN_BLOCK_SIZE];
+
+    if ((ptr_key == NULL) || (lStandin_ValidAesKey(keyLen) == false))
+    {
+        return CRYPTO_AEAD_ERROR_KEY;
+    }
+    if ((ptr_initVect == NULL) || (initVectLen == 0U))
+    {
+        return CRYPTO_AEAD_ERROR_NONCE;
+    }
+    if ((ptr_authTag == NULL) || (authTagLen < 4U) || (authTagLen > STANDIN_BLOCK_SIZE))
+    {
+        return CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    if ((dataLen > 0U) && ((ptr_inputData == NULL) || (ptr_outData == NULL)))
+    {
+        return CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    if ((sessionID == 0U) || (handlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (sessionID == 0U) ? CRYPTO_AEAD_ERROR_SID : CRYPTO_AEAD_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", (uint64_t)dataLen + aadLen);
+    lStandin_GcmXor(ptr_key, keyLen, ptr_initVect, initVectLen, ptr_inputData, ptr_outData, dataLen);
+    lStandin_Expand(lStandin_GcmTag(ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen,
+        ptr_outData, dataLen), tag, sizeof(tag));
+    (void)memcpy(ptr_authTag, tag, authTagLen);
+
+    return CRYPTO_AEAD_CIPHER_SUCCESS;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData,
+    uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect,
+    uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen,
+    uint32_t sessionID)
+{
+    uint8_t tag[STANDIN_BLOCK_SIZE];
+    uint8_t diff = 0U;
+
+    if ((ptr_key == NULL) || (lStandin_ValidAesKey(keyLen) == false))
+    {
+        return CRYPTO_AEAD_ERROR_KEY;
+    }
+    if ((ptr_initVect == NULL) || (initVectLen == 0U))
+    {
+        return CRYPTO_AEAD_ERROR_NONCE;
+    }
+    if ((ptr_authTag == NULL) || (authTagLen < 4U) || (authTagLen > STANDIN_BLOCK_SIZE))
+    {
+        return CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    if ((dataLen > 0U) && ((ptr_inputData == NULL) || (ptr_outData == NULL)))
+    {
+        return CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    if ((sessionID == 0U) || (handlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (sessionID == 0U) ? CRYPTO_AEAD_ERROR_SID : CRYPTO_AEAD_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", (uint64_t)dataLen + aadLen);
+    lStandin_Expand(lStandin_GcmTag(ptr_key, keyLen, ptr_initVect, initVectLen, ptr_aad, aadLen,
+        ptr_inputData, dataLen), tag, sizeof(tag));
+    for (uint32_t i = 0U; i < authTagLen; i++)
+    {
+        diff |= (uint8_t)(tag[i] ^ ptr_authTag[i]);
+    }
+    lStandin_GcmXor(ptr_key, keyLen, ptr_initVect, initVectLen, ptr_inputData, ptr_outData, dataLen);
+
+    return (diff == 0U) ? CRYPTO_AEAD_CIPHER_SUCCESS : CRYPTO_AEAD_ERROR_AUTHFAIL;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_Init(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, crypto_HandlerType_E handlerType_en,
+    crypto_CipherOper_E cipherOper_en, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, uint32_t initVectLen,
+    uint32_t sessionID)
+{
+    standin_GcmState state;
+
+    if (ptr_aesGcmCtx_st == NULL)
+    {
+        return CRYPTO_AEAD_ERROR_CTX;
+    }
+    if ((ptr_key == NULL) || (lStandin_ValidAesKey(keyLen) == false))
+    {
+        return CRYPTO_AEAD_ERROR_KEY;
+    }
+    if ((ptr_initVect == NULL) || (initVectLen == 0U))
+    {
+        return CRYPTO_AEAD_ERROR_NONCE;
+    }
+    if ((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        return CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    if ((sessionID == 0U) || (handlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (sessionID == 0U) ? CRYPTO_AEAD_ERROR_SID : CRYPTO_AEAD_ERROR_HDLR;
+    }
+
+    ptr_aesGcmCtx_st->cryptoSessionID = sessionID;
+    ptr_aesGcmCtx_st->aeadHandlerType_en = handlerType_en;
+    ptr_aesGcmCtx_st->aeadCipherOper_en = cipherOper_en;
+    ptr_aesGcmCtx_st->ptr_key = ptr_key;
+    ptr_aesGcmCtx_st->aeadKeySize = keyLen;
+    ptr_aesGcmCtx_st->ptr_initVect = ptr_initVect;
+    ptr_aesGcmCtx_st->initVectLen = initVectLen;
+
+    state.tag = lStandin_Mix(lStandin_Mix(0xCBF29CE484222325ULL, ptr_key, keyLen), ptr_initVect, initVectLen);
+    state.seed = lStandin_GcmSeed(ptr_key, keyLen, ptr_initVect, initVectLen);
+    state.offset = 0U;
+    (void)memcpy(ptr_aesGcmCtx_st->arr_aeadDataCtx, &state, sizeof(state));
+
+    return CRYPTO_AEAD_CIPHER_SUCCESS;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_AddAadData(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_aad,
+    uint32_t aadLen)
+{
+    standin_GcmState state;
+
+    if (ptr_aesGcmCtx_st == NULL)
+    {
+        return CRYPTO_AEAD_ERROR_CTX;
+    }
+    if ((ptr_aad == NULL) != (aadLen == 0U))
+    {
+        return CRYPTO_AEAD_ERROR_AAD;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", aadLen);
+    (void)memcpy(&state, ptr_aesGcmCtx_st->arr_aeadDataCtx, sizeof(state));
+    state.tag = lStandin_Mix(state.tag, ptr_aad, aadLen);
+    (void)memcpy(ptr_aesGcmCtx_st->arr_aeadDataCtx, &state, sizeof(state));
+
+    return CRYPTO_AEAD_CIPHER_SUCCESS;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_Cipher(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_inputData,
+    uint32_t dataLen, uint8_t *ptr_outData)
+{
+    standin_GcmState state;
+
+    if (ptr_aesGcmCtx_st == NULL)
+    {
+        return CRYPTO_AEAD_ERROR_CTX;
+    }
+    if ((dataLen > 0U) && ((ptr_inputData == NULL) || (ptr_outData == NULL)))
+    {
+        return CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", dataLen);
+    (void)memcpy(&state, ptr_aesGcmCtx_st->arr_aeadDataCtx, sizeof(state));
+    if (ptr_aesGcmCtx_st->aeadCipherOper_en == CRYPTO_CIOP_DECRYPT)
+    {
+        state.tag = lStandin_Mix(state.tag, ptr_inputData, dataLen);
+        lStandin_GcmXorAt(state.seed, state.offset, ptr_inputData, ptr_outData, dataLen);
+    }
+    else
+    {
+        lStandin_GcmXorAt(state.seed, state.offset, ptr_inputData, ptr_outData, dataLen);
+        state.tag = lStandin_Mix(state.tag, ptr_outData, dataLen);
+    }
+    state.offset += dataLen;
+    (void)memcpy(ptr_aesGcmCtx_st->arr_aeadDataCtx, &state, sizeof(state));
+
+    return CRYPTO_AEAD_CIPHER_SUCCESS;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_Final(st_Crypto_Aead_AesGcm_ctx *ptr_aesGcmCtx_st, uint8_t *ptr_authTag,
+    uint8_t authTagLen)
+{
+    standin_GcmState state;
+    uint8_t tag[STANDIN_BLOCK_SIZE];
+
+    if (ptr_aesGcmCtx_st == NULL)
+    {
+        return CRYPTO_AEAD_ERROR_CTX;
+    }
+    if ((ptr_authTag == NULL) || (authTagLen < 4U) || (authTagLen > STANDIN_BLOCK_SIZE))
+    {
+        return CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+
+    (void)memcpy(&state, ptr_aesGcmCtx_st->arr_aeadDataCtx, sizeof(state));
+    lStandin_Expand(state.tag, tag, sizeof(tag));
+    (void)memcpy(ptr_authTag, tag, authTagLen);
+
+    return CRYPTO_AEAD_CIPHER_SUCCESS;
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesCmac_Direct(crypto_HandlerType_E macHandlerType_en, uint8_t *ptr_inputData,
+    uint32_t dataLen, uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    uint8_t mac[STANDIN_BLOCK_SIZE];
+
+    if ((ptr_key == NULL) || (lStandin_ValidAesKey(keyLen) == false))
+    {
+        return CRYPTO_MAC_ERROR_KEY;
+    }
+    if ((ptr_inputData == NULL) && (dataLen > 0U))
+    {
+        return CRYPTO_MAC_ERROR_INPUTDATA;
+    }
+    if ((ptr_outMac == NULL) || (macLen == 0U) || (macLen > STANDIN_BLOCK_SIZE))
+    {
+        return CRYPTO_MAC_ERROR_MACDATA;
+    }
+    if ((sessionID == 0U) || (macHandlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (sessionID == 0U) ? CRYPTO_MAC_ERROR_SID : CRYPTO_MAC_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_NS_PER_BYTE", dataLen);
+    lStandin_Expand(lStandin_Mix(lStandin_Mix(0x5A5AU, ptr_key, keyLen), ptr_inputData, dataLen), mac, sizeof(mac));
+    (void)memcpy(ptr_outMac, mac, macLen);
+
+    return CRYPTO_MAC_CIPHER_SUCCESS;
+}
+
+/* The stand-in signature depends only on the hash, so any public key
+ * verifies a signature made over the same hash. */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Sign(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+    uint32_t hashLen, uint8_t *ptr_outSig, uint32_t sigLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+    crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    uint32_t keyLen = lStandin_CurveKeyLen(eccCurveType_En);
+
+    if ((ptr_inputHash == NULL) || (hashLen == 0U))
+    {
+        return CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    if ((ptr_privKey == NULL) || (privKeyLen == 0U) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH))
+    {
+        return CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    if (keyLen == 0U)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    if ((ptr_outSig == NULL) || (sigLen < (2U * keyLen)))
+    {
+        return CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    if ((ecdsaSessionId == 0U) || (ecdsaHandlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (ecdsaSessionId == 0U) ? CRYPTO_DIGISIGN_ERROR_SID : CRYPTO_DIGISIGN_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_PKE_US", 1000U);
+    lStandin_Expand(lStandin_Mix((uint64_t)eccCurveType_En, ptr_inputHash, hashLen), ptr_outSig, 2U * keyLen);
+
+    return CRYPTO_DIGISIGN_SUCCESS;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Verify(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash,
+    uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+    int8_t *ptr_sigVerifyStat, crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    uint8_t expected[2U * CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint32_t keyLen = lStandin_CurveKeyLen(eccCurveType_En);
+
+    if (ptr_sigVerifyStat == NULL)
+    {
+        return CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    *ptr_sigVerifyStat = 0;
+
+    if ((ptr_inputHash == NULL) || (hashLen == 0U))
+    {
+        return CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    if ((ptr_pubKey == NULL) || (pubKeyLen == 0U))
+    {
+        return CRYPTO_DIGISIGN_ERROR_PUBKEY;
+    }
+    if (keyLen == 0U)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    if ((ptr_inputSig == NULL) || (sigLen != (2U * keyLen)))
+    {
+        return CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    if ((ecdsaSessionId == 0U) || (ecdsaHandlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (ecdsaSessionId == 0U) ? CRYPTO_DIGISIGN_ERROR_SID : CRYPTO_DIGISIGN_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_PKE_US", 1000U);
+    lStandin_Expand(lStandin_Mix((uint64_t)eccCurveType_En, ptr_inputHash, hashLen), expected, sigLen);
+    if (memcmp(expected, ptr_inputSig, sigLen) != 0)
+    {
+        return CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+
+    *ptr_sigVerifyStat = 1;
+
+    return CRYPTO_DIGISIGN_SUCCESS;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey,
+    uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen, uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen,
+    crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId)
+{
+    uint32_t keyLen = lStandin_CurveKeyLen(eccCurveType_en);
+
+    if ((ptr_pubKey == NULL) || (pubKeyLen == 0U))
+    {
+        return CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    if ((ptr_privKey == NULL) || (privKeyLen == 0U) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH))
+    {
+        return CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    if (keyLen == 0U)
+    {
+        return CRYPTO_KAS_ERROR_CURVE;
+    }
+    if ((ptr_sharedSecret == NULL) || (sharedSecretLen < keyLen))
+    {
+        return CRYPTO_KAS_ERROR_ARG;
+    }
+    if ((ecdhSessionId == 0U) || (ecdhHandlerType_en != CRYPTO_HANDLER_HW_INTERNAL))
+    {
+        return (ecdhSessionId == 0U) ? CRYPTO_KAS_ERROR_SID : CRYPTO_KAS_ERROR_HDLR;
+    }
+
+    lStandin_Delay("CRYPTO_STANDIN_PKE_US", 1000U);
+    lStandin_Expand(lStandin_Mix(lStandin_Mix(0U, ptr_privKey, privKeyLen), ptr_pubKey, pubKeyLen),
+        ptr_sharedSecret, sharedSecretLen);
+
+    return CRYPTO_KAS_SUCCESS;
+}
+
+crypto_Rng_Status_E Crypto_Rng_Generate(crypto_HandlerType_E rngHandlerType_en, uint8_t* ptr_rngData, uint32_t rngLen,
+    uint8_t* ptr_nonce, uint32_t nonceLen, uint32_t sessionID)
+{
+    static uint64_t counter = 0x9E3779B97F4A7C15ULL;
+
+    (void)ptr_nonce;
+    (void)nonceLen;
+    (void)sessionID;
+
+    if ((ptr_rngData == NULL) || (rngLen == 0U))
+    {
+        return CRYPTO_RNG_ERROR_ARG;
+    }
+    if (rngHandlerType_en != CRYPTO_HANDLER_HW_INTERNAL)
+    {
+        return CRYPTO_RNG_ERROR_HDLR;
+    }
+
+    counter += 0x9E3779B97F4A7C15ULL;
+    lStandin_Expand(counter, ptr_rngData, rngLen);
+
+    return CRYPTO_RNG_SUCCESS;
+}
@@ -0,0 +1,419 @@
+/*******************************************************************************
+  Crypto Trace Decoder Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_trace_decoder.c
+
+  Summary:
+    Turns Crypto Library trace events (crypto_trace.h) into per-function and
+    per-layer latency figures.
+
+  Description:
+    With -d the decoder drains the trace ring of a board running the crypto
+    offload server built with CRYPTO_TRACE_ENABLE, by sending TRACE requests
+    until only the header comes back. With -w the raw responses are also
+    saved, each prefixed with its 16-bit little-endian length, and -r reads
+    such a file back instead of a device.
+
+    Entry and exit events are paired with a stack. The time between a pair
+    is the total time of the call; subtracting the total time of the calls
+    and interrupts nested inside it gives the self time. Self time is summed
+    per layer (API, HW, ISR), so the HW layer includes the driver library and
+    the time spent waiting for the engine.
+
+    Results are written to stdout as text, or as CSV with -c:
+        function,layer,calls,errors,total_us,self_us,avg_us,min_us,max_us
+*******************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto_client.h"
+
+#define DECODER_TIMEOUT_MS      (2000)
+#define DECODER_STACK_DEPTH     (32U)
+
+typedef struct
+{
+    const char *name;
+    crypto_Trace_Layer_E layer;
+} DECODER_ID_INFO;
+
+typedef struct
+{
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t total;
+    uint64_t self;
+    uint32_t min;
+    uint32_t max;
+} DECODER_FUNC_STATS;
+
+typedef struct
+{
+    uint16_t id;
+    uint32_t start;
+    uint64_t nested;
+} DECODER_FRAME;
+
+static const DECODER_ID_INFO decoderIds[CRYPTO_TRACE_ID_MAX] =
+{
+#define DECODER_ID_INFO_ENTRY(id, function, layer) [CRYPTO_TRACE_ID_##id] = { #function, layer },
+    CRYPTO_TRACE_ID_LIST(DECODER_ID_INFO_ENTRY)
+#undef DECODER_ID_INFO_ENTRY
+};
+
+static const char *const decoderLayerNames[] = { "API", "HW", "ISR" };
+
+static DECODER_FUNC_STATS decoderStats[CRYPTO_TRACE_ID_MAX];
+static DECODER_FRAME decoderStack[DECODER_STACK_DEPTH];
+static uint32_t decoderDepth;
+static uint32_t decoderTickRate;
+static uint64_t decoderDropped;
+static uint64_t decoderEvents;
+static uint64_t decoderUnmatched;
+static uint64_t decoderTopLevel;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t decoderGetU32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static double decoderTicksToUs(uint64_t ticks)
+{
+    return (decoderTickRate == 0U) ? 0.0 : ((double)ticks * 1000000.0) / (double)decoderTickRate;
+}
+
+static void decoderExit(uint16_t id, uint32_t timestamp, int32_t status)
+{
+    uint32_t match = decoderDepth;
+
+    // Find the matching entry; events lost to an overrun leave stale frames.
+    while ((match > 0U) && (decoderStack[match - 1U].id != id))
+    {
+        match--;
+    }
+
+    if (match == 0U)
+    {
+        decoderUnmatched++;
+        return;
+    }
+
+    decoderUnmatched += decoderDepth - match;
+    decoderDepth = match - 1U;
+
+    DECODER_FRAME *frame = &decoderStack[decoderDepth];
+    DECODER_FUNC_STATS *stats = &decoderStats[id];
+    uint32_t elapsed = timestamp - frame->start;
+
+    stats->calls++;
+    stats->total += elapsed;
+    stats->self += (elapsed > frame->nested) ? (elapsed - frame->nested) : 0U;
+    stats->min = ((stats->calls == 1U) || (elapsed < stats->min)) ? elapsed : stats->min;
+    stats->max = (elapsed > stats->max) ? elapsed : stats->max;
+    if ((decoderIds[id].layer != CRYPTO_TRACE_LAYER_ISR) && (status < 0))
+    {
+        stats->errors++;
+    }
+
+    if (decoderDepth > 0U)
+    {
+        decoderStack[decoderDepth - 1U].nested += elapsed;
+    }
+    else
+    {
+        decoderTopLevel += elapsed;
+    }
+}
+
+static void decoderEvent(uint32_t timestamp, uint32_t value, uint16_t rawId)
+{
+    uint16_t id = rawId & (uint16_t)~CRYPTO_TRACE_EXIT_FLAG;
+
+    decoderEvents++;
+    if ((id == CRYPTO_TRACE_ID_INVALID) || (id >= CRYPTO_TRACE_ID_MAX))
+    {
+        decoderUnmatched++;
+    }
+    else if ((rawId & CRYPTO_TRACE_EXIT_FLAG) != 0U)
+    {
+        decoderExit(id, timestamp, (int32_t)value);
+    }
+    else if (decoderDepth < DECODER_STACK_DEPTH)
+    {
+        decoderStack[decoderDepth].id = id;
+        decoderStack[decoderDepth].start = timestamp;
+        decoderStack[decoderDepth].nested = 0U;
+        decoderDepth++;
+    }
+    else
+    {
+        decoderUnmatched++;
+    }
+}
+
+/* Decode one TRACE response payload. Returns the number of events in it,
+ * or -1 if it is malformed. */
+static int decoderChunk(const uint8_t *data, uint16_t length)
+{
+    if ((length < CRYPTO_TRACE_HEADER_SIZE) || (((length - CRYPTO_TRACE_HEADER_SIZE) % CRYPTO_TRACE_RECORD_SIZE) != 0U))
+    {
+        return -1;
+    }
+
+    decoderTickRate = decoderGetU32(&data[0]);
+    decoderDropped += decoderGetU32(&data[4]);
+
+    for (uint16_t offset = CRYPTO_TRACE_HEADER_SIZE; offset < length; offset += CRYPTO_TRACE_RECORD_SIZE)
+    {
+        decoderEvent(decoderGetU32(&data[offset]), decoderGetU32(&data[offset + 4U]),
+                     (uint16_t)(data[offset + 8U] | (data[offset + 9U] << 8)));
+    }
+
+    return (int)((length - CRYPTO_TRACE_HEADER_SIZE) / CRYPTO_TRACE_RECORD_SIZE);
+}
+
+static int decoderReadFile(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t prefix[2];
+    uint8_t chunk[CRYPTO_SERVER_MAX_PAYLOAD];
+    int status = 0;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while ((status == 0) && (fread(prefix, 1U, sizeof(prefix), file) == sizeof(prefix)))
+    {
+        uint16_t length = (uint16_t)(prefix[0] | (prefix[1] << 8));
+
+        if ((length > sizeof(chunk)) || (fread(chunk, 1U, length, file) != length) || (decoderChunk(chunk, length) < 0))
+        {
+            fprintf(stderr, "%s: malformed trace dump\n", path);
+            status = -1;
+        }
+    }
+
+    (void)fclose(file);
+
+    return status;
+}
+
+static int decoderReadDevice(const char *device, uint32_t baudRate, const char *savePath)
+{
+    CRYPTO_CLIENT *client = CRYPTO_CLIENT_Open(device, baudRate, DECODER_TIMEOUT_MS);
+    FILE *save = NULL;
+    uint8_t chunk[CRYPTO_SERVER_MAX_PAYLOAD];
+    uint16_t length;
+    int events = 1;
+    int status = 0;
+
+    if (client == NULL)
+    {
+        fprintf(stderr, "crypto_trace_decoder: no response from server\n");
+        return -1;
+    }
+
+    if (savePath != NULL)
+    {
+        save = fopen(savePath, "wb");
+        if (save == NULL)
+        {
+            perror(savePath);
+            status = -1;
+        }
+    }
+
+    while ((status == 0) && (events > 0))
+    {
+        int result = CRYPTO_CLIENT_Call(client, CRYPTO_SERVER_OP_TRACE, NULL, 0U, chunk, sizeof(chunk), &length);
+
+        if (result == CRYPTO_SERVER_STATUS_BAD_OP)
+        {
+            fprintf(stderr, "crypto_trace_decoder: firmware built without CRYPTO_TRACE_ENABLE\n");
+            status = -1;
+        }
+        else if (result != CRYPTO_SERVER_STATUS_OK)
+        {
+            fprintf(stderr, "crypto_trace_decoder: TRACE request failed (%d)\n", result);
+            status = -1;
+        }
+        else
+        {
+            if (save != NULL)
+            {
+                uint8_t prefix[2] = { (uint8_t)length, (uint8_t)(length >> 8) };
+
+                (void)fwrite(prefix, 1U, sizeof(prefix), save);
+                (void)fwrite(chunk, 1U, length, save);
+            }
+
+            events = decoderChunk(chunk, length);
+            if (events < 0)
+            {
+                fprintf(stderr, "crypto_trace_decoder: malformed TRACE response\n");
+                status = -1;
+            }
+        }
+    }
+
+    if (save != NULL)
+    {
+        (void)fclose(save);
+    }
+    CRYPTO_CLIENT_Close(client);
+
+    return status;
+}
+
+static void decoderReport(int csv)
+{
+    double layerSelf[CRYPTO_TRACE_LAYER_ISR + 1] = { 0.0 };
+    double topLevelUs = decoderTicksToUs(decoderTopLevel);
+
+    if (csv != 0)
+    {
+        printf("function,layer,calls,errors,total_us,self_us,avg_us,min_us,max_us\n");
+    }
+    else
+    {
+        printf("%-40s %-4s %8s %6s %12s %12s %10s %10s %10s\n", "function", "layer", "calls", "errors",
+               "total_us", "self_us", "avg_us", "min_us", "max_us");
+    }
+
+    for (uint16_t id = 1U; id < CRYPTO_TRACE_ID_MAX; id++)
+    {
+        const DECODER_FUNC_STATS *stats = &decoderStats[id];
+        const char *format = (csv != 0) ? "%s,%s,%llu,%llu,%.2f,%.2f,%.2f,%.2f,%.2f\n"
+                                        : "%-40s %-4s %8llu %6llu %12.2f %12.2f %10.2f %10.2f %10.2f\n";
+
+        if (stats->calls == 0U)
+        {
+            continue;
+        }
+
+        layerSelf[decoderIds[id].layer] += decoderTicksToUs(stats->self);
+        printf(format, decoderIds[id].name, decoderLayerNames[decoderIds[id].layer],
+               (unsigned long long)stats->calls, (unsigned long long)stats->errors,
+               decoderTicksToUs(stats->total), decoderTicksToUs(stats->self),
+               decoderTicksToUs(stats->total) / (double)stats->calls,
+               decoderTicksToUs(stats->min), decoderTicksToUs(stats->max));
+    }
+
+    if (csv != 0)
+    {
+        return;
+    }
+
+    printf("\n%-8s %12s %8s\n", "layer", "self_us", "share");
+    for (uint32_t layer = 0U; layer <= (uint32_t)CRYPTO_TRACE_LAYER_ISR; layer++)
+    {
+        printf("%-8s %12.2f %7.1f%%\n", decoderLayerNames[layer], layerSelf[layer],
+               (topLevelUs > 0.0) ? (100.0 * layerSelf[layer]) / topLevelUs : 0.0);
+    }
+
+    printf("\n%llu events, %llu dropped on target, %llu unmatched, %u calls still open, tick rate %lu Hz\n",
+           (unsigned long long)decoderEvents, (unsigned long long)decoderDropped,
+           (unsigned long long)decoderUnmatched, decoderDepth, (unsigned long)decoderTickRate);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Main Entry Point
+// *****************************************************************************
+// *****************************************************************************
+
+int main(int argc, char **argv)
+{
+    const char *device = NULL;
+    const char *readPath = NULL;
+    const char *savePath = NULL;
+    uint32_t baudRate = 921600UL;
+    int csv = 0;
+    int opt;
+    int status;
+
+    while ((opt = getopt(argc, argv, "d:b:r:w:c")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd':
+                device = optarg;
+                break;
+            case 'b':
+                baudRate = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                readPath = optarg;
+                break;
+            case 'w':
+                savePath = optarg;
+                break;
+            case 'c':
+                csv = 1;
+                break;
+            default:
+                device = NULL;
+                readPath = NULL;
+                break;
+        }
+    }
+
+    if ((device == NULL) == (readPath == NULL))
+    {
+        fprintf(stderr, "usage: %s (-d device [-b baud] [-w dump] | -r dump) [-c]\n", argv[0]);
+        return 2;
+    }
+
+    status = (device != NULL) ? decoderReadDevice(device, baudRate, savePath) : decoderReadFile(readPath);
+    if (status == 0)
+    {
+        decoderReport(csv);
+    }
+
+    return (status == 0) ? 0 : 1;
+}
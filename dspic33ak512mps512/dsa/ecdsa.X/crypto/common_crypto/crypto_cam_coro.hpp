@@ -0,0 +1,679 @@
+/*******************************************************************************
+  Crypto C++ Coroutine Interface Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cam_coro.hpp
+
+  Summary:
+    This header file provides C++20 awaitable Crypto Library operations and
+    a single-threaded executor for them.
+
+  Description:
+    A cam::Task coroutine runs on a cam::Executor and awaits operations such
+    as co_await cam::seal(key, iv, aad, in, out, tag) or
+    co_await cam::verify<cam::Curve::P384>(hash, signature, publicKey); the
+    result of co_await is the status of the C API. Awaiting queues the
+    operation on its engine (AES and SHA on CRYPTO1, PKE on CRYPTO3) and
+    suspends the task. The executor starts the next operation of each idle
+    engine and resumes the tasks whose operations completed, one at a time
+    and in order, so operations on different engines can be in flight
+    together and no task waits for an engine another task holds.
+
+    How an operation is started and completed is the Driver template
+    parameter. cam::CamDriver calls the Crypto_* API, which returns once the
+    engine is done: the calling task is resumed at the next turn of the
+    executor and other tasks run between operations, but the time of the
+    call itself is not given to them. A driver whose start returns
+    detail::pending before the engine is done completes the operation from
+    the interrupt of its engine: Executor::attach() registers the executor
+    with Crypto_Int_Hw_Register_Completion() for CRYPTO1 and CRYPTO3, and
+    the hook polls the driver and queues the continuation of the task.
+
+    The operation, with its arguments, lives in the frame of the awaiting
+    task, so the buffers passed to it must stay valid until co_await
+    returns, as they do for locals of the task. Coroutine frames are
+    allocated with operator new; firmware without a heap provides an
+    operator new that takes them from a static pool.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_CAM_CORO_HPP
+#define CRYPTO_CAM_CORO_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+#error "crypto_cam_coro.hpp requires C++20"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <array>
+#include <climits>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+#include "crypto/common_crypto/crypto_cam.hpp"
+
+extern "C" {
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+// Tasks one executor runs at once; each can be ready at most once.
+#ifndef CRYPTO_CAM_EXECUTOR_TASKS
+#define CRYPTO_CAM_EXECUTOR_TASKS   (16U)
+#endif
+
+namespace cam {
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+// CAM engines that run one operation at a time, by interrupt vector.
+enum class Engine
+{
+    Sym = 0,    // AES and SHA, CRYPTO1
+    Pke = 1     // ECDSA and ECDH, CRYPTO3
+};
+
+class Executor;
+
+namespace detail {
+
+inline constexpr std::size_t engineCount = 2U;
+
+// Status of a driver start or poll for an operation the engine still runs.
+inline constexpr std::int32_t pending = INT32_MIN;
+
+// Interrupts disabled for the lifetime of the object.
+class Lock
+{
+public:
+    Lock() noexcept : state_(Crypto_Int_Hw_Lock()) {}
+    ~Lock() { Crypto_Int_Hw_Unlock(state_); }
+
+    Lock(const Lock &) = delete;
+    Lock &operator=(const Lock &) = delete;
+
+private:
+    std::uint32_t state_;
+};
+
+// Queued or running operation; lives in the frame of the awaiting task.
+struct Operation
+{
+    Operation() noexcept = default;
+    Operation(const Operation &) = delete;
+    Operation &operator=(const Operation &) = delete;
+
+    Operation *next = nullptr;
+    Engine engine = Engine::Sym;
+    std::int32_t (*start)(Operation *op) noexcept = nullptr;
+    std::int32_t (*poll)(Operation *op) noexcept = nullptr;
+    std::coroutine_handle<> continuation;
+    std::int32_t status = 0;
+};
+
+// Arguments of each operation type, passed to the driver.
+struct AeadArgs
+{
+    Direction direction;
+    const std::uint8_t *key;
+    std::size_t keyLen;
+    ConstBytes iv;
+    ConstBytes aad;
+    ConstBytes in;
+    Bytes out;
+    std::uint8_t *tag;
+    std::size_t tagLen;
+};
+
+#ifdef CRYPTO_CAM_HASH
+struct HashArgs
+{
+    crypto_Hash_Algo_E algo;
+    ConstBytes data;
+    std::uint8_t *digest;
+};
+#endif
+
+struct SignArgs
+{
+    crypto_EccCurveType_E curve;
+    ConstBytes hash;
+    const std::uint8_t *privateKey;
+    std::size_t keyLen;
+    std::uint8_t *signature;
+    std::size_t signatureLen;
+};
+
+struct VerifyArgs
+{
+    crypto_EccCurveType_E curve;
+    ConstBytes hash;
+    ConstBytes signature;
+    ConstBytes publicKey;
+};
+
+} // namespace detail
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Task
+// *****************************************************************************
+// *****************************************************************************
+
+// Coroutine run by Executor::spawn(); its frame is freed when it returns.
+class Task
+{
+public:
+    struct promise_type
+    {
+        Executor *executor = nullptr;
+
+        Task get_return_object() noexcept
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+
+        ~promise_type();
+    };
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+    Task &operator=(Task &&) = delete;
+
+    // A task never spawned is destroyed without running.
+    ~Task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+private:
+    friend class Executor;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Executor
+// *****************************************************************************
+// *****************************************************************************
+
+class Executor
+{
+public:
+    Executor() noexcept = default;
+
+    ~Executor() { detach(); }
+
+    Executor(const Executor &) = delete;
+    Executor &operator=(const Executor &) = delete;
+
+    // Completes operations from the CRYPTO1 and CRYPTO3 interrupts; needed
+    // only with a driver that returns detail::pending.
+    crypto_Int_Status_E attach() noexcept
+    {
+        crypto_Int_Status_E status = Crypto_Int_Hw_Register_Completion(CRYPTO1_INT, &Executor::onInterrupt,
+            &engines_[static_cast<std::size_t>(Engine::Sym)]);
+
+        if (status == CRYPTO_INT_SUCCESS)
+        {
+            status = Crypto_Int_Hw_Register_Completion(CRYPTO3_INT, &Executor::onInterrupt,
+                &engines_[static_cast<std::size_t>(Engine::Pke)]);
+            if (status != CRYPTO_INT_SUCCESS)
+            {
+                (void)Crypto_Int_Hw_Register_Completion(CRYPTO1_INT, nullptr, nullptr);
+            }
+        }
+        attached_ = (status == CRYPTO_INT_SUCCESS);
+        return status;
+    }
+
+    void detach() noexcept
+    {
+        if (attached_)
+        {
+            (void)Crypto_Int_Hw_Register_Completion(CRYPTO1_INT, nullptr, nullptr);
+            (void)Crypto_Int_Hw_Register_Completion(CRYPTO3_INT, nullptr, nullptr);
+            attached_ = false;
+        }
+    }
+
+    // Queues the task to start at the next turn; false when
+    // CRYPTO_CAM_EXECUTOR_TASKS tasks are running.
+    bool spawn(Task &&task) noexcept
+    {
+        bool spawned = false;
+
+        if (task.handle_ && (tasks_ < CRYPTO_CAM_EXECUTOR_TASKS))
+        {
+            task.handle_.promise().executor = this;
+            tasks_++;
+            post(std::exchange(task.handle_, nullptr));
+            spawned = true;
+        }
+        return spawned;
+    }
+
+    /* One turn: starts the next operation of each idle engine, then resumes
+     * the tasks that were ready when the turn began. Returns the number of
+     * tasks resumed. */
+    std::size_t poll() noexcept
+    {
+        std::size_t resumed = 0U;
+        std::size_t count;
+
+        for (Queue &engine : engines_)
+        {
+            startNext(engine);
+        }
+
+        {
+            detail::Lock lock;
+            count = readyCount_;
+        }
+        while (resumed < count)
+        {
+            std::coroutine_handle<> handle;
+
+            {
+                detail::Lock lock;
+                handle = ready_[readyHead_];
+                readyHead_ = (readyHead_ + 1U) % ready_.size();
+                readyCount_--;
+            }
+            handle.resume();
+            resumed++;
+        }
+        return resumed;
+    }
+
+    // Turns until every task has returned; idle, if given, runs when a turn
+    // resumes nothing, for example to wait for an interrupt.
+    void run(void (*idle)(void) = nullptr) noexcept
+    {
+        while (tasks_ > 0U)
+        {
+            if ((poll() == 0U) && (idle != nullptr))
+            {
+                idle();
+            }
+        }
+    }
+
+    // Tasks spawned and not yet returned.
+    std::size_t tasks() const noexcept { return tasks_; }
+
+    // Operations awaited and not yet completed, queued or running.
+    std::size_t inFlight() const noexcept
+    {
+        detail::Lock lock;
+
+        return operations_;
+    }
+
+    // co_await executor.yield() lets the other ready tasks run.
+    auto yield() noexcept
+    {
+        struct Yield
+        {
+            Executor *executor;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) const noexcept { executor->post(handle); }
+            void await_resume() const noexcept {}
+        };
+
+        return Yield{this};
+    }
+
+    // Used by the awaitables.
+    void submit(detail::Operation &op) noexcept
+    {
+        Queue &engine = engines_[static_cast<std::size_t>(op.engine)];
+        detail::Lock lock;
+
+        op.next = nullptr;
+        if (engine.tail != nullptr)
+        {
+            engine.tail->next = &op;
+        }
+        else
+        {
+            engine.head = &op;
+        }
+        engine.tail = &op;
+        operations_++;
+    }
+
+    void finished() noexcept { tasks_--; }
+
+private:
+    struct Queue
+    {
+        Executor *executor;
+        detail::Operation *head;
+        detail::Operation *tail;
+        detail::Operation *active;
+    };
+
+    // Holds each running task at most once, so it cannot overflow.
+    void post(std::coroutine_handle<> handle) noexcept
+    {
+        detail::Lock lock;
+
+        ready_[(readyHead_ + readyCount_) % ready_.size()] = handle;
+        readyCount_++;
+    }
+
+    // Called with interrupts disabled.
+    void complete(Queue &engine, std::int32_t status) noexcept
+    {
+        detail::Operation *op = engine.active;
+
+        engine.active = nullptr;
+        operations_--;
+        op->status = status;
+        post(op->continuation);
+    }
+
+    void startNext(Queue &engine) noexcept
+    {
+        detail::Operation *op = nullptr;
+        std::int32_t status;
+
+        {
+            detail::Lock lock;
+
+            if ((engine.active == nullptr) && (engine.head != nullptr))
+            {
+                op = engine.head;
+                engine.head = op->next;
+                if (engine.head == nullptr)
+                {
+                    engine.tail = nullptr;
+                }
+                engine.active = op;
+            }
+        }
+
+        if (op != nullptr)
+        {
+            status = op->start(op);
+            if (status != detail::pending)
+            {
+                detail::Lock lock;
+
+                complete(engine, status);
+            }
+        }
+    }
+
+    static void onInterrupt(void *context) noexcept
+    {
+        Queue *engine = static_cast<Queue *>(context);
+        detail::Lock lock;
+
+        if (engine->active != nullptr)
+        {
+            std::int32_t status = engine->active->poll(engine->active);
+
+            if (status != detail::pending)
+            {
+                engine->executor->complete(*engine, status);
+            }
+        }
+    }
+
+    std::array<std::coroutine_handle<>, CRYPTO_CAM_EXECUTOR_TASKS> ready_{};
+    std::size_t readyHead_ = 0U;
+    std::size_t readyCount_ = 0U;
+    std::array<Queue, detail::engineCount> engines_{{{this, nullptr, nullptr, nullptr},
+        {this, nullptr, nullptr, nullptr}}};
+    std::size_t tasks_ = 0U;
+    std::size_t operations_ = 0U;
+    bool attached_ = false;
+};
+
+inline Task::promise_type::~promise_type()
+{
+    if (executor != nullptr)
+    {
+        executor->finished();
+    }
+}
+
+namespace detail {
+
+// Awaitable operation; Status is the enum returned by co_await.
+template <typename Args, typename Status, typename Driver>
+class Op : public Operation
+{
+public:
+    Op(Engine opEngine, const Args &args) noexcept : args_(args)
+    {
+        engine = opEngine;
+        start = &Op::startOp;
+        poll = &Op::pollOp;
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<Task::promise_type> handle) noexcept
+    {
+        continuation = handle;
+        handle.promise().executor->submit(*this);
+    }
+
+    Status await_resume() const noexcept { return static_cast<Status>(status); }
+
+private:
+    static std::int32_t startOp(Operation *op) noexcept
+    {
+        return Driver::start(static_cast<Op *>(op)->args_);
+    }
+
+    static std::int32_t pollOp(Operation *op) noexcept
+    {
+        return Driver::poll(op->engine);
+    }
+
+    Args args_;
+};
+
+} // namespace detail
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CAM Driver
+// *****************************************************************************
+// *****************************************************************************
+
+// Runs each operation with the Crypto_* API; never pending.
+struct CamDriver
+{
+#ifdef CRYPTO_CAM_AEAD
+    static std::int32_t start(const detail::AeadArgs &args) noexcept
+    {
+        crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+        std::uint8_t *out = args.in.empty() ? nullptr : args.out.data();
+
+        if (!CRYPTO_API_CHECK(args.out.size() < args.in.size()))
+        {
+            if (args.direction == Direction::Encrypt)
+            {
+                status = Crypto_Aead_AesGcm_EncryptAuthDirect(detail::handler, detail::input(args.in),
+                    static_cast<std::uint32_t>(args.in.size()), out, const_cast<std::uint8_t *>(args.key),
+                    static_cast<std::uint32_t>(args.keyLen), detail::input(args.iv),
+                    static_cast<std::uint32_t>(args.iv.size()), detail::input(args.aad),
+                    static_cast<std::uint32_t>(args.aad.size()), args.tag, static_cast<std::uint8_t>(args.tagLen),
+                    detail::sessionId);
+            }
+            else
+            {
+                status = Crypto_Aead_AesGcm_DecryptAuthDirect(detail::handler, detail::input(args.in),
+                    static_cast<std::uint32_t>(args.in.size()), out, const_cast<std::uint8_t *>(args.key),
+                    static_cast<std::uint32_t>(args.keyLen), detail::input(args.iv),
+                    static_cast<std::uint32_t>(args.iv.size()), detail::input(args.aad),
+                    static_cast<std::uint32_t>(args.aad.size()), args.tag, static_cast<std::uint8_t>(args.tagLen),
+                    detail::sessionId);
+            }
+        }
+        return static_cast<std::int32_t>(status);
+    }
+#endif
+
+#ifdef CRYPTO_CAM_HASH
+    static std::int32_t start(const detail::HashArgs &args) noexcept
+    {
+        return static_cast<std::int32_t>(Crypto_Hash_Sha_Digest(detail::handler, detail::input(args.data),
+            static_cast<std::uint32_t>(args.data.size()), args.digest, args.algo, detail::sessionId));
+    }
+#endif
+
+#ifdef CRYPTO_CAM_ECDSA
+    static std::int32_t start(const detail::SignArgs &args) noexcept
+    {
+        return static_cast<std::int32_t>(Crypto_DigiSign_Ecdsa_Sign(detail::handler, detail::input(args.hash),
+            static_cast<std::uint32_t>(args.hash.size()), args.signature,
+            static_cast<std::uint32_t>(args.signatureLen), const_cast<std::uint8_t *>(args.privateKey),
+            static_cast<std::uint32_t>(args.keyLen), args.curve, detail::sessionId));
+    }
+
+    // CRYPTO_DIGISIGN_SUCCESS only for a valid signature.
+    static std::int32_t start(const detail::VerifyArgs &args) noexcept
+    {
+        std::int8_t valid = 0;
+        crypto_DigiSign_Status_E status = Crypto_DigiSign_Ecdsa_Verify(detail::handler, detail::input(args.hash),
+            static_cast<std::uint32_t>(args.hash.size()), detail::input(args.signature),
+            static_cast<std::uint32_t>(args.signature.size()), detail::input(args.publicKey),
+            static_cast<std::uint32_t>(args.publicKey.size()), &valid, args.curve, detail::sessionId);
+
+        if ((status == CRYPTO_DIGISIGN_SUCCESS) && (valid != 1))
+        {
+            status = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+        return static_cast<std::int32_t>(status);
+    }
+#endif
+
+    static std::int32_t poll(Engine engine) noexcept
+    {
+        (void)engine;
+        return detail::pending;
+    }
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Awaitable Operations
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_CAM_AEAD
+// AES-GCM encryption; tag.size() is the tag length.
+template <typename Driver = CamDriver, std::size_t N>
+detail::Op<detail::AeadArgs, crypto_Aead_Status_E, Driver> seal(const std::array<std::uint8_t, N> &key,
+    ConstBytes iv, ConstBytes aad, ConstBytes in, Bytes out, Bytes tag) noexcept
+{
+    static_assert((N == 16U) || (N == 24U) || (N == 32U), "AES-GCM takes 128, 192 or 256-bit keys");
+    return detail::Op<detail::AeadArgs, crypto_Aead_Status_E, Driver>(Engine::Sym,
+        detail::AeadArgs{Direction::Encrypt, key.data(), N, iv, aad, in, out, tag.data(), tag.size()});
+}
+
+// AES-GCM decryption and tag check.
+template <typename Driver = CamDriver, std::size_t N>
+detail::Op<detail::AeadArgs, crypto_Aead_Status_E, Driver> open(const std::array<std::uint8_t, N> &key,
+    ConstBytes iv, ConstBytes aad, ConstBytes in, Bytes out, ConstBytes tag) noexcept
+{
+    static_assert((N == 16U) || (N == 24U) || (N == 32U), "AES-GCM takes 128, 192 or 256-bit keys");
+    return detail::Op<detail::AeadArgs, crypto_Aead_Status_E, Driver>(Engine::Sym,
+        detail::AeadArgs{Direction::Decrypt, key.data(), N, iv, aad, in, out,
+        const_cast<std::uint8_t *>(tag.data()), tag.size()});
+}
+#endif
+
+#ifdef CRYPTO_CAM_HASH
+template <Algo A, typename Driver = CamDriver>
+detail::Op<detail::HashArgs, crypto_Hash_Status_E, Driver> digest(ConstBytes data,
+    typename Sha<A>::Digest &out) noexcept
+{
+    return detail::Op<detail::HashArgs, crypto_Hash_Status_E, Driver>(Engine::Sym,
+        detail::HashArgs{detail::AlgoTraits<A>::algo, data, out.data()});
+}
+#endif
+
+#ifdef CRYPTO_CAM_ECDSA
+template <Curve C, typename Driver = CamDriver>
+detail::Op<detail::SignArgs, crypto_DigiSign_Status_E, Driver> sign(ConstBytes hash,
+    const typename Ecdsa<C>::PrivateKey &privateKey, typename Ecdsa<C>::Signature &signature) noexcept
+{
+    return detail::Op<detail::SignArgs, crypto_DigiSign_Status_E, Driver>(Engine::Pke,
+        detail::SignArgs{detail::CurveTraits<C>::curve, hash, privateKey.data(), privateKey.size(),
+        signature.data(), signature.size()});
+}
+
+// CRYPTO_DIGISIGN_SUCCESS only for a valid signature.
+template <Curve C, typename Driver = CamDriver>
+detail::Op<detail::VerifyArgs, crypto_DigiSign_Status_E, Driver> verify(ConstBytes hash,
+    const typename Ecdsa<C>::Signature &signature, ConstBytes publicKey) noexcept
+{
+    return detail::Op<detail::VerifyArgs, crypto_DigiSign_Status_E, Driver>(Engine::Pke,
+        detail::VerifyArgs{detail::CurveTraits<C>::curve, hash, signature, publicKey});
+}
+#endif
+
+} // namespace cam
+
+#endif /* CRYPTO_CAM_CORO_HPP */
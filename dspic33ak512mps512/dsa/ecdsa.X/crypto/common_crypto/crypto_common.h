@@ -53,8 +53,25 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include "crypto/common_crypto/crypto_config.h"
 //******************************************************************************
-#define CRYPTO_ECC_MAX_KEY_LENGTH (66) //Max size of Private key; Public Key will be double of it for ECC
+//Max size of Private key of the largest curve built; Public Key will be double of it for ECC
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
+#define CRYPTO_ECC_MAX_KEY_LENGTH (66)
+#elif (CRYPTO_CONFIG_ECC_P384 == 1)
+#define CRYPTO_ECC_MAX_KEY_LENGTH (48)
+#elif (CRYPTO_CONFIG_ECC_P256 == 1)
+#define CRYPTO_ECC_MAX_KEY_LENGTH (32)
+#else
+#define CRYPTO_ECC_MAX_KEY_LENGTH (24)
+#endif
+
+//Alignment of the caller workspaces passed to the *DirectEx() functions
+#define CRYPTO_WORKSPACE_ALIGN (4UL)
+
+//True when a workspace is non-NULL, aligned and holds at least size bytes
+#define CRYPTO_WORKSPACE_VALID(ptr, len, size) \
+    (((ptr) != NULL) && ((((uintptr_t)(ptr)) & (CRYPTO_WORKSPACE_ALIGN - 1UL)) == 0UL) && ((len) >= (size)))
 
 // *****************************************************************************
 // *****************************************************************************
@@ -67,6 +84,10 @@ typedef enum {
 #ifdef CRYPTO_WOLFCRYPT_SUPPORT_ENABLE            
 	CRYPTO_HANDLER_SW_WOLFCRYPT = 2,    //Enum used when SW library Wolfssl is used
 #endif /* CRYPTO_WOLFCRYPT_SUPPORTED */            
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+	CRYPTO_HANDLER_SW_INTERNAL = 3,     //Enum used when the built-in software is used
+	CRYPTO_HANDLER_AUTO = 4,            //Enum used to pick HW or SW per operation by size and engine load
+#endif /* CRYPTO_CONFIG_SW_HANDLER */
 	CRYPTO_HANDLER_MAX
 }crypto_HandlerType_E;
 
@@ -81,6 +81,25 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Verify(crypto_HandlerType_E ecdsa
                                                         uint8_t *ptr_inputSig, uint32_t sigLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
                                                         int8_t *ptr_sigVerifyStat, crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
 
+/* Bytes of workspace the *Ex() functions need for a handler, 0 when the
+ * handler does not support them. */
+uint32_t Crypto_DigiSign_Ecdsa_WorkspaceSize(crypto_HandlerType_E ecdsaHandlerType_en);
+
+/* As Crypto_DigiSign_Ecdsa_Sign() and Crypto_DigiSign_Ecdsa_Verify(), with
+ * the working data in a caller workspace aligned to CRYPTO_WORKSPACE_ALIGN
+ * instead of on the stack. The workspace may be shared by calls that do not
+ * overlap. Return CRYPTO_DIGISIGN_ERROR_ARG for a workspace that is NULL,
+ * misaligned or smaller than Crypto_DigiSign_Ecdsa_WorkspaceSize(). */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignEx(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_outSig, 
+                                                    uint32_t sigLen, uint8_t *ptr_privKey, uint32_t privKeyLen, 
+                                                    crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId,
+                                                    void *ptr_workspace, uint32_t workspaceLen);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyEx(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                        uint8_t *ptr_inputSig, uint32_t sigLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                        int8_t *ptr_sigVerifyStat, crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId,
+                                                        void *ptr_workspace, uint32_t workspaceLen);
+
 
 
 #endif /* CRYPTO_DIGSIGN_H */
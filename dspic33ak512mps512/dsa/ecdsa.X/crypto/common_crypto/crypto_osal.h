@@ -0,0 +1,301 @@
+/*******************************************************************************
+  Crypto OS Abstraction Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_osal.h
+
+  Summary:
+    This header file provides the mutex, semaphore and event primitives and
+    the per-engine ownership of the Crypto Library.
+
+  Description:
+    CRYPTO_OSAL_PORT selects the port the primitives are built on:
+      CRYPTO_OSAL_PORT_BARE_METAL  (default) flags changed with interrupts
+                                   disabled, waits in IDLE mode
+      CRYPTO_OSAL_PORT_FREERTOS    static FreeRTOS semaphores and event groups
+      CRYPTO_OSAL_PORT_POSIX       POSIX threads and semaphores, for hosts
+
+    The CAM has one owner per engine: CRYPTO_OSAL_ENGINE_SYM for the AES and
+    SHA engines, which share the CRYPTO1 vector, CRYPTO_OSAL_ENGINE_TRNG
+    (CRYPTO2) and CRYPTO_OSAL_ENGINE_PKE (CRYPTO3). Each Crypto_*_Hw_* wrapper
+    holds its engine for the duration of the call and fails with the module's
+    generic error when it cannot get it within CRYPTO_OSAL_ENGINE_TIMEOUT_MS.
+    The interrupt of each engine posts its completion semaphore, which
+    Crypto_Osal_EngineWait() sleeps on. Modules that keep state across calls,
+    such as the table of crypto_verify_cache.c, guard it with a mutex of
+    crypto_Osal_State_E through Crypto_Osal_StateLock().
+
+    Crypto_Osal_Initialize() must run once, before any crypto call, with the
+    FreeRTOS and POSIX ports. The bare-metal port starts out valid from zeroed
+    memory and has no waiting owner to hand over to: an engine taken while
+    it is held, from an interrupt that preempted its holder, is reported as
+    CRYPTO_OSAL_ERROR_BUSY at once.
+
+    Crypto_Osal_TaskStart() runs a function on a task of its own, so work on
+    one engine can overlap work on another; the bare-metal port has no tasks
+    and runs the function before it returns.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_OSAL_H
+#define CRYPTO_OSAL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_OSAL_PORT_BARE_METAL     (0)
+#define CRYPTO_OSAL_PORT_FREERTOS       (1)
+#define CRYPTO_OSAL_PORT_POSIX          (2)
+
+#ifndef CRYPTO_OSAL_PORT
+#define CRYPTO_OSAL_PORT                CRYPTO_OSAL_PORT_BARE_METAL
+#endif
+
+// Stack of a FreeRTOS task started by Crypto_Osal_TaskStart(), in StackType_t words.
+#ifndef CRYPTO_OSAL_TASK_STACK_WORDS
+#define CRYPTO_OSAL_TASK_STACK_WORDS    (512UL)
+#endif
+
+// Longest time a wrapper waits for its engine before it fails.
+#ifndef CRYPTO_OSAL_ENGINE_TIMEOUT_MS
+#define CRYPTO_OSAL_ENGINE_TIMEOUT_MS   CRYPTO_OSAL_WAIT_FOREVER
+#endif
+
+/* The bare-metal port has no time base of its own: define
+ * CRYPTO_OSAL_GET_TICK_MS() to an expression returning a free-running
+ * millisecond count to bound its waits; without it a timeout other than
+ * CRYPTO_OSAL_NO_WAIT waits forever. */
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "task.h"
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+#include <pthread.h>
+#include <semaphore.h>
+#endif
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_OSAL_NO_WAIT             (0UL)
+#define CRYPTO_OSAL_WAIT_FOREVER        (0xFFFFFFFFUL)
+
+typedef enum {
+    CRYPTO_OSAL_ERROR_NOTINIT = -127,   // Crypto_Osal_Initialize() has not run
+    CRYPTO_OSAL_ERROR_ARG = -126,       // Bad engine or state, or NULL pointer
+    CRYPTO_OSAL_ERROR_TIMEOUT = -125,   // Not available within the timeout
+    CRYPTO_OSAL_ERROR_BUSY = -124,      // Held by the context this call preempted
+    CRYPTO_OSAL_ERROR_FAIL = -123,      // The port reported an error
+    CRYPTO_OSAL_SUCCESS = 0
+}crypto_Osal_Status_E;
+
+// Engines, numbered as their vectors in crypto_Int_Handler_Id.
+typedef enum {
+    CRYPTO_OSAL_ENGINE_SYM = 0,         // AES and SHA, CRYPTO1
+    CRYPTO_OSAL_ENGINE_TRNG = 1,        // CRYPTO2
+    CRYPTO_OSAL_ENGINE_PKE = 2,         // CRYPTO3
+    CRYPTO_OSAL_ENGINE_MAX
+}crypto_Osal_Engine_E;
+
+// State shared by the tasks that call a library module, one mutex each.
+typedef enum {
+    CRYPTO_OSAL_STATE_VERIFY_CACHE = 0, // Table and key of crypto_verify_cache.c
+    CRYPTO_OSAL_STATE_MAX
+}crypto_Osal_State_E;
+
+typedef void (*CRYPTO_OSAL_TASK_FUNCTION)(void *arg);
+
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+typedef struct{
+    StaticSemaphore_t buffer;
+    SemaphoreHandle_t handle;
+}CRYPTO_OSAL_MUTEX;
+
+typedef struct{
+    StaticSemaphore_t buffer;
+    SemaphoreHandle_t handle;
+}CRYPTO_OSAL_SEM;
+
+typedef struct{
+    StaticEventGroup_t buffer;
+    EventGroupHandle_t handle;
+}CRYPTO_OSAL_EVENT;
+
+typedef struct{
+    StaticTask_t buffer;
+    StackType_t stack[CRYPTO_OSAL_TASK_STACK_WORDS];
+    TaskHandle_t handle;
+    CRYPTO_OSAL_SEM done;
+    CRYPTO_OSAL_TASK_FUNCTION function;
+    void *arg;
+}CRYPTO_OSAL_TASK;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+typedef struct{
+    pthread_mutex_t mutex;
+}CRYPTO_OSAL_MUTEX;
+
+typedef struct{
+    sem_t sem;
+    uint32_t maxCount;
+}CRYPTO_OSAL_SEM;
+
+typedef struct{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t flags;
+}CRYPTO_OSAL_EVENT;
+
+typedef struct{
+    pthread_t thread;
+    CRYPTO_OSAL_SEM done;
+    CRYPTO_OSAL_TASK_FUNCTION function;
+    void *arg;
+}CRYPTO_OSAL_TASK;
+#else
+typedef struct{
+    volatile bool locked;
+}CRYPTO_OSAL_MUTEX;
+
+typedef struct{
+    volatile uint32_t count;
+    uint32_t maxCount;
+}CRYPTO_OSAL_SEM;
+
+typedef struct{
+    volatile uint32_t flags;
+}CRYPTO_OSAL_EVENT;
+
+typedef struct{
+    CRYPTO_OSAL_TASK_FUNCTION function;
+    void *arg;
+}CRYPTO_OSAL_TASK;
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Primitives
+// *****************************************************************************
+// *****************************************************************************
+
+/* Timeouts are in milliseconds, or CRYPTO_OSAL_NO_WAIT or
+ * CRYPTO_OSAL_WAIT_FOREVER. The *FromIsr functions are the only ones that
+ * may be called from an interrupt. */
+
+crypto_Osal_Status_E Crypto_Osal_MutexCreate(CRYPTO_OSAL_MUTEX *mutex);
+crypto_Osal_Status_E Crypto_Osal_MutexLock(CRYPTO_OSAL_MUTEX *mutex, uint32_t timeoutMs);
+crypto_Osal_Status_E Crypto_Osal_MutexUnlock(CRYPTO_OSAL_MUTEX *mutex);
+
+/* Counting semaphore of at most maxCount (at least 1), holding initialCount.
+ * A post to a full semaphore is dropped, so completions do not pile up. */
+crypto_Osal_Status_E Crypto_Osal_SemCreate(CRYPTO_OSAL_SEM *sem, uint32_t maxCount, uint32_t initialCount);
+crypto_Osal_Status_E Crypto_Osal_SemPost(CRYPTO_OSAL_SEM *sem);
+crypto_Osal_Status_E Crypto_Osal_SemPostFromIsr(CRYPTO_OSAL_SEM *sem);
+crypto_Osal_Status_E Crypto_Osal_SemPend(CRYPTO_OSAL_SEM *sem, uint32_t timeoutMs);
+
+/* Event flags, 24 usable bits (8 with FreeRTOS 16-bit ticks).
+ * Crypto_Osal_EventWait() waits for any (or, with waitAll, all) of the
+ * flags, clears the flags it waited for and returns the flags that were set
+ * in *ptr_flags when it is not NULL. */
+crypto_Osal_Status_E Crypto_Osal_EventCreate(CRYPTO_OSAL_EVENT *event);
+crypto_Osal_Status_E Crypto_Osal_EventSet(CRYPTO_OSAL_EVENT *event, uint32_t flags);
+crypto_Osal_Status_E Crypto_Osal_EventSetFromIsr(CRYPTO_OSAL_EVENT *event, uint32_t flags);
+crypto_Osal_Status_E Crypto_Osal_EventWait(CRYPTO_OSAL_EVENT *event, uint32_t flags, bool waitAll,
+                                           uint32_t timeoutMs, uint32_t *ptr_flags);
+
+/* Run function(arg) on a new task at the priority of the caller, which
+ * Crypto_Osal_TaskJoin() waits for and deletes; the task structure must
+ * stay valid until then. The bare-metal port runs the function on the
+ * caller before it returns. */
+crypto_Osal_Status_E Crypto_Osal_TaskStart(CRYPTO_OSAL_TASK *task, CRYPTO_OSAL_TASK_FUNCTION function, void *arg);
+crypto_Osal_Status_E Crypto_Osal_TaskJoin(CRYPTO_OSAL_TASK *task, uint32_t timeoutMs);
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Engine Ownership
+// *****************************************************************************
+// *****************************************************************************
+
+// Create the engine mutexes and completion semaphores and the state mutexes.
+crypto_Osal_Status_E Crypto_Osal_Initialize(void);
+
+/* Take the engine for the calling task, waiting up to
+ * CRYPTO_OSAL_ENGINE_TIMEOUT_MS. Completions left over from the previous
+ * owner are discarded. */
+crypto_Osal_Status_E Crypto_Osal_EngineAcquire(crypto_Osal_Engine_E engine);
+crypto_Osal_Status_E Crypto_Osal_EngineRelease(crypto_Osal_Engine_E engine);
+
+/* True when another task or a preempted context holds the engine. The answer
+ * is a snapshot, for picking a handler: it does not reserve the engine. */
+bool Crypto_Osal_EngineBusy(crypto_Osal_Engine_E engine);
+
+// Post the completion semaphore of the engine; called from its interrupt.
+void Crypto_Osal_EngineSignal(crypto_Osal_Engine_E engine);
+
+/* Sleep until the interrupt of the engine signals a completion, for the
+ * owner of an engine whose operation was started without waiting. */
+crypto_Osal_Status_E Crypto_Osal_EngineWait(crypto_Osal_Engine_E engine, uint32_t timeoutMs);
+
+/* Take and give the mutex of the shared state of a module. A module holds
+ * it around its reads and writes of that state, not across engine
+ * operations it can run unlocked. */
+crypto_Osal_Status_E Crypto_Osal_StateLock(crypto_Osal_State_E state, uint32_t timeoutMs);
+crypto_Osal_Status_E Crypto_Osal_StateUnlock(crypto_Osal_State_E state);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_OSAL_H */
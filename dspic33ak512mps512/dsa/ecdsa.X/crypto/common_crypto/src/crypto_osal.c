@@ -0,0 +1,852 @@
+/*******************************************************************************
+  Crypto OS Abstraction Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_osal.c
+
+  Summary:
+    This source file implements the primitives and engine ownership of
+    crypto_osal.h for the port selected by CRYPTO_OSAL_PORT.
+
+  Description:
+    Each engine has a mutex, held by the wrapper call that drives the engine,
+    and a binary completion semaphore, posted from the interrupt of the
+    engine. The bare-metal port changes its flags and counters with
+    interrupts disabled (Crypto_Int_Hw_Lock()) and waits in IDLE mode; the
+    FreeRTOS port uses static semaphores and event groups; the POSIX port
+    uses pthread mutexes and condition variables and POSIX semaphores, whose
+    posts also work from signal handlers.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stddef.h>
+#include "crypto/common_crypto/crypto_osal.h"
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+#include <errno.h>
+#include <time.h>
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_BARE_METAL)
+#include <xc.h>
+#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_OSAL_MUTEX osalEngineMutex[CRYPTO_OSAL_ENGINE_MAX];
+static CRYPTO_OSAL_SEM osalEngineDone[CRYPTO_OSAL_ENGINE_MAX];
+static CRYPTO_OSAL_MUTEX osalStateMutex[CRYPTO_OSAL_STATE_MAX];
+
+#if (CRYPTO_OSAL_PORT != CRYPTO_OSAL_PORT_BARE_METAL)
+static volatile bool osalInitialized = false;
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Functions
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+
+static TickType_t lCrypto_Osal_Ticks(uint32_t timeoutMs)
+{
+    TickType_t ticks = portMAX_DELAY;
+
+    if (timeoutMs != CRYPTO_OSAL_WAIT_FOREVER)
+    {
+        ticks = pdMS_TO_TICKS(timeoutMs);
+        // A timeout shorter than a tick still waits for one.
+        if ((ticks == 0U) && (timeoutMs != CRYPTO_OSAL_NO_WAIT))
+        {
+            ticks = 1U;
+        }
+    }
+
+    return ticks;
+}
+
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+
+static void lCrypto_Osal_Deadline(struct timespec *ptr_deadline, uint32_t timeoutMs)
+{
+    (void)clock_gettime(CLOCK_REALTIME, ptr_deadline);
+    ptr_deadline->tv_sec += (time_t)(timeoutMs / 1000UL);
+    ptr_deadline->tv_nsec += (long)(timeoutMs % 1000UL) * 1000000L;
+    if (ptr_deadline->tv_nsec >= 1000000000L)
+    {
+        ptr_deadline->tv_sec += 1;
+        ptr_deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+static crypto_Osal_Status_E lCrypto_Osal_MapError(int error)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_FAIL;
+
+    if (error == 0)
+    {
+        status = CRYPTO_OSAL_SUCCESS;
+    }
+    else if ((error == ETIMEDOUT) || (error == EBUSY) || (error == EAGAIN))
+    {
+        status = CRYPTO_OSAL_ERROR_TIMEOUT;
+    }
+    else
+    {
+        /* Any other error is a port failure. */
+    }
+
+    return status;
+}
+
+#else
+
+static uint32_t lCrypto_Osal_Now(void)
+{
+#ifdef CRYPTO_OSAL_GET_TICK_MS
+    return (uint32_t)CRYPTO_OSAL_GET_TICK_MS();
+#else
+    return 0UL;
+#endif
+}
+
+static bool lCrypto_Osal_Expired(uint32_t start, uint32_t timeoutMs)
+{
+    bool expired = (timeoutMs == CRYPTO_OSAL_NO_WAIT);
+
+#ifdef CRYPTO_OSAL_GET_TICK_MS
+    if ((!expired) && (timeoutMs != CRYPTO_OSAL_WAIT_FOREVER))
+    {
+        expired = ((lCrypto_Osal_Now() - start) >= timeoutMs);
+    }
+#else
+    (void)start;
+#endif
+
+    return expired;
+}
+
+/* Called with interrupts disabled. A pending interrupt ends IDLE mode even
+ * while it cannot be taken; it is taken once the caller restores the
+ * interrupt state, so a post made between the test of the caller and the
+ * IDLE instruction is not missed. */
+static void lCrypto_Osal_Idle(void)
+{
+    Idle();
+}
+
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Primitives Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Osal_Status_E Crypto_Osal_MutexCreate(CRYPTO_OSAL_MUTEX *mutex)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (mutex != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        mutex->handle = xSemaphoreCreateMutexStatic(&mutex->buffer);
+        status = (mutex->handle != NULL) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        status = lCrypto_Osal_MapError(pthread_mutex_init(&mutex->mutex, NULL));
+#else
+        mutex->locked = false;
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_MutexLock(CRYPTO_OSAL_MUTEX *mutex, uint32_t timeoutMs)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (mutex != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        status = (xSemaphoreTake(mutex->handle, lCrypto_Osal_Ticks(timeoutMs)) == pdTRUE) ?
+                 CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_TIMEOUT;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        struct timespec deadline;
+
+        if (timeoutMs == CRYPTO_OSAL_WAIT_FOREVER)
+        {
+            status = lCrypto_Osal_MapError(pthread_mutex_lock(&mutex->mutex));
+        }
+        else if (timeoutMs == CRYPTO_OSAL_NO_WAIT)
+        {
+            status = lCrypto_Osal_MapError(pthread_mutex_trylock(&mutex->mutex));
+        }
+        else
+        {
+            lCrypto_Osal_Deadline(&deadline, timeoutMs);
+            status = lCrypto_Osal_MapError(pthread_mutex_timedlock(&mutex->mutex, &deadline));
+        }
+#else
+        /* The holder is the context this call preempted and cannot run
+         * before it returns, so there is nothing to wait for. */
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        (void)timeoutMs;
+        if (mutex->locked)
+        {
+            status = CRYPTO_OSAL_ERROR_BUSY;
+        }
+        else
+        {
+            mutex->locked = true;
+            status = CRYPTO_OSAL_SUCCESS;
+        }
+        Crypto_Int_Hw_Unlock(lockState);
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_MutexUnlock(CRYPTO_OSAL_MUTEX *mutex)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (mutex != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        status = (xSemaphoreGive(mutex->handle) == pdTRUE) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        status = lCrypto_Osal_MapError(pthread_mutex_unlock(&mutex->mutex));
+#else
+        mutex->locked = false;
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_SemCreate(CRYPTO_OSAL_SEM *sem, uint32_t maxCount, uint32_t initialCount)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if ((sem != NULL) && (maxCount > 0UL) && (initialCount <= maxCount))
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        sem->handle = xSemaphoreCreateCountingStatic((UBaseType_t)maxCount, (UBaseType_t)initialCount, &sem->buffer);
+        status = (sem->handle != NULL) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        sem->maxCount = maxCount;
+        status = (sem_init(&sem->sem, 0, (unsigned int)initialCount) == 0) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+#else
+        sem->maxCount = maxCount;
+        sem->count = initialCount;
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_SemPost(CRYPTO_OSAL_SEM *sem)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (sem != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        (void)xSemaphoreGive(sem->handle);
+        status = CRYPTO_OSAL_SUCCESS;
+#else
+        status = Crypto_Osal_SemPostFromIsr(sem);
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_SemPostFromIsr(CRYPTO_OSAL_SEM *sem)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (sem != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        BaseType_t woken = pdFALSE;
+
+        (void)xSemaphoreGiveFromISR(sem->handle, &woken);
+        portYIELD_FROM_ISR(woken);
+        status = CRYPTO_OSAL_SUCCESS;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        /* sem_getvalue() and sem_post() are async-signal-safe; a post racing
+         * another one may pass the limit by one, which only wakes one
+         * waiter too many. */
+        int value = 0;
+
+        (void)sem_getvalue(&sem->sem, &value);
+        if ((uint32_t)value < sem->maxCount)
+        {
+            (void)sem_post(&sem->sem);
+        }
+        status = CRYPTO_OSAL_SUCCESS;
+#else
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        // A zeroed semaphore is binary.
+        if ((sem->count < sem->maxCount) || ((sem->maxCount == 0UL) && (sem->count == 0UL)))
+        {
+            sem->count++;
+        }
+        Crypto_Int_Hw_Unlock(lockState);
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_SemPend(CRYPTO_OSAL_SEM *sem, uint32_t timeoutMs)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (sem != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        status = (xSemaphoreTake(sem->handle, lCrypto_Osal_Ticks(timeoutMs)) == pdTRUE) ?
+                 CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_TIMEOUT;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        struct timespec deadline;
+        int result;
+
+        if (timeoutMs == CRYPTO_OSAL_NO_WAIT)
+        {
+            result = sem_trywait(&sem->sem);
+        }
+        else if (timeoutMs == CRYPTO_OSAL_WAIT_FOREVER)
+        {
+            do
+            {
+                result = sem_wait(&sem->sem);
+            } while ((result != 0) && (errno == EINTR));
+        }
+        else
+        {
+            lCrypto_Osal_Deadline(&deadline, timeoutMs);
+            do
+            {
+                result = sem_timedwait(&sem->sem, &deadline);
+            } while ((result != 0) && (errno == EINTR));
+        }
+        status = lCrypto_Osal_MapError((result == 0) ? 0 : errno);
+#else
+        uint32_t start = lCrypto_Osal_Now();
+        uint32_t lockState;
+        bool done = false;
+
+        while (!done)
+        {
+            lockState = Crypto_Int_Hw_Lock();
+            if (sem->count > 0UL)
+            {
+                sem->count--;
+                status = CRYPTO_OSAL_SUCCESS;
+                done = true;
+            }
+            else if (lCrypto_Osal_Expired(start, timeoutMs))
+            {
+                status = CRYPTO_OSAL_ERROR_TIMEOUT;
+                done = true;
+            }
+            else
+            {
+                lCrypto_Osal_Idle();
+            }
+            Crypto_Int_Hw_Unlock(lockState);
+        }
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EventCreate(CRYPTO_OSAL_EVENT *event)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (event != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        event->handle = xEventGroupCreateStatic(&event->buffer);
+        status = (event->handle != NULL) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        event->flags = 0UL;
+        status = lCrypto_Osal_MapError(pthread_mutex_init(&event->mutex, NULL));
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            status = lCrypto_Osal_MapError(pthread_cond_init(&event->cond, NULL));
+        }
+#else
+        event->flags = 0UL;
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EventSet(CRYPTO_OSAL_EVENT *event, uint32_t flags)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (event != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        (void)xEventGroupSetBits(event->handle, (EventBits_t)flags);
+        status = CRYPTO_OSAL_SUCCESS;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        (void)pthread_mutex_lock(&event->mutex);
+        event->flags |= flags;
+        (void)pthread_cond_broadcast(&event->cond);
+        (void)pthread_mutex_unlock(&event->mutex);
+        status = CRYPTO_OSAL_SUCCESS;
+#else
+        status = Crypto_Osal_EventSetFromIsr(event, flags);
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EventSetFromIsr(CRYPTO_OSAL_EVENT *event, uint32_t flags)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (event != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        BaseType_t woken = pdFALSE;
+
+        /* Deferred to the timer task, which needs INCLUDE_xTimerPendFunctionCall. */
+        status = (xEventGroupSetBitsFromISR(event->handle, (EventBits_t)flags, &woken) == pdPASS) ?
+                 CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+        portYIELD_FROM_ISR(woken);
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        // Takes a mutex: set events from interrupt threads, not signal handlers.
+        status = Crypto_Osal_EventSet(event, flags);
+#else
+        uint32_t lockState = Crypto_Int_Hw_Lock();
+
+        event->flags |= flags;
+        Crypto_Int_Hw_Unlock(lockState);
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EventWait(CRYPTO_OSAL_EVENT *event, uint32_t flags, bool waitAll,
+                                           uint32_t timeoutMs, uint32_t *ptr_flags)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+    uint32_t setFlags = 0UL;
+
+    if ((event != NULL) && (flags != 0UL))
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        setFlags = (uint32_t)xEventGroupWaitBits(event->handle, (EventBits_t)flags, pdTRUE,
+                                                 waitAll ? pdTRUE : pdFALSE, lCrypto_Osal_Ticks(timeoutMs));
+        status = (waitAll ? ((setFlags & flags) == flags) : ((setFlags & flags) != 0UL)) ?
+                 CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_TIMEOUT;
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        struct timespec deadline;
+        int result = 0;
+        bool ready;
+
+        if ((timeoutMs != CRYPTO_OSAL_NO_WAIT) && (timeoutMs != CRYPTO_OSAL_WAIT_FOREVER))
+        {
+            lCrypto_Osal_Deadline(&deadline, timeoutMs);
+        }
+        (void)pthread_mutex_lock(&event->mutex);
+        ready = waitAll ? ((event->flags & flags) == flags) : ((event->flags & flags) != 0UL);
+        while ((!ready) && (result == 0) && (timeoutMs != CRYPTO_OSAL_NO_WAIT))
+        {
+            if (timeoutMs == CRYPTO_OSAL_WAIT_FOREVER)
+            {
+                result = pthread_cond_wait(&event->cond, &event->mutex);
+            }
+            else
+            {
+                result = pthread_cond_timedwait(&event->cond, &event->mutex, &deadline);
+            }
+            ready = waitAll ? ((event->flags & flags) == flags) : ((event->flags & flags) != 0UL);
+        }
+        setFlags = event->flags;
+        if (ready)
+        {
+            event->flags &= ~flags;
+        }
+        (void)pthread_mutex_unlock(&event->mutex);
+        status = ready ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_TIMEOUT;
+#else
+        uint32_t start = lCrypto_Osal_Now();
+        uint32_t lockState;
+        bool ready;
+        bool done = false;
+
+        while (!done)
+        {
+            lockState = Crypto_Int_Hw_Lock();
+            setFlags = event->flags;
+            ready = waitAll ? ((setFlags & flags) == flags) : ((setFlags & flags) != 0UL);
+            if (ready)
+            {
+                event->flags &= ~flags;
+                status = CRYPTO_OSAL_SUCCESS;
+                done = true;
+            }
+            else if (lCrypto_Osal_Expired(start, timeoutMs))
+            {
+                status = CRYPTO_OSAL_ERROR_TIMEOUT;
+                done = true;
+            }
+            else
+            {
+                lCrypto_Osal_Idle();
+            }
+            Crypto_Int_Hw_Unlock(lockState);
+        }
+#endif
+    }
+
+    if (ptr_flags != NULL)
+    {
+        *ptr_flags = setFlags;
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Engine Ownership Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Osal_Status_E lCrypto_Osal_EngineCheck(crypto_Osal_Engine_E engine)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_SUCCESS;
+
+    if ((engine < CRYPTO_OSAL_ENGINE_SYM) || (engine >= CRYPTO_OSAL_ENGINE_MAX))
+    {
+        status = CRYPTO_OSAL_ERROR_ARG;
+    }
+#if (CRYPTO_OSAL_PORT != CRYPTO_OSAL_PORT_BARE_METAL)
+    else if (!osalInitialized)
+    {
+        status = CRYPTO_OSAL_ERROR_NOTINIT;
+    }
+#endif
+    else
+    {
+        /* The engine can be used. */
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_Initialize(void)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_SUCCESS;
+    uint32_t engine;
+    uint32_t state;
+
+#if (CRYPTO_OSAL_PORT != CRYPTO_OSAL_PORT_BARE_METAL)
+    if (!osalInitialized)
+#endif
+    {
+        for (engine = 0UL; (engine < (uint32_t)CRYPTO_OSAL_ENGINE_MAX) && (status == CRYPTO_OSAL_SUCCESS); engine++)
+        {
+            status = Crypto_Osal_MutexCreate(&osalEngineMutex[engine]);
+            if (status == CRYPTO_OSAL_SUCCESS)
+            {
+                status = Crypto_Osal_SemCreate(&osalEngineDone[engine], 1UL, 0UL);
+            }
+        }
+        for (state = 0UL; (state < (uint32_t)CRYPTO_OSAL_STATE_MAX) && (status == CRYPTO_OSAL_SUCCESS); state++)
+        {
+            status = Crypto_Osal_MutexCreate(&osalStateMutex[state]);
+        }
+#if (CRYPTO_OSAL_PORT != CRYPTO_OSAL_PORT_BARE_METAL)
+        osalInitialized = (status == CRYPTO_OSAL_SUCCESS);
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EngineAcquire(crypto_Osal_Engine_E engine)
+{
+    crypto_Osal_Status_E status = lCrypto_Osal_EngineCheck(engine);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_MutexLock(&osalEngineMutex[engine], CRYPTO_OSAL_ENGINE_TIMEOUT_MS);
+    }
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        // The driver library waits for its own completions; drop their posts.
+        while (Crypto_Osal_SemPend(&osalEngineDone[engine], CRYPTO_OSAL_NO_WAIT) == CRYPTO_OSAL_SUCCESS)
+        {
+        }
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_EngineRelease(crypto_Osal_Engine_E engine)
+{
+    crypto_Osal_Status_E status = lCrypto_Osal_EngineCheck(engine);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_MutexUnlock(&osalEngineMutex[engine]);
+    }
+
+    return status;
+}
+
+bool Crypto_Osal_EngineBusy(crypto_Osal_Engine_E engine)
+{
+    bool busy = false;
+    crypto_Osal_Status_E status = lCrypto_Osal_EngineCheck(engine);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_MutexLock(&osalEngineMutex[engine], CRYPTO_OSAL_NO_WAIT);
+
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            (void)Crypto_Osal_MutexUnlock(&osalEngineMutex[engine]);
+        }
+        else
+        {
+            busy = ((status == CRYPTO_OSAL_ERROR_TIMEOUT) || (status == CRYPTO_OSAL_ERROR_BUSY));
+        }
+    }
+
+    return busy;
+}
+
+void Crypto_Osal_EngineSignal(crypto_Osal_Engine_E engine)
+{
+    if (lCrypto_Osal_EngineCheck(engine) == CRYPTO_OSAL_SUCCESS)
+    {
+        (void)Crypto_Osal_SemPostFromIsr(&osalEngineDone[engine]);
+    }
+}
+
+crypto_Osal_Status_E Crypto_Osal_EngineWait(crypto_Osal_Engine_E engine, uint32_t timeoutMs)
+{
+    crypto_Osal_Status_E status = lCrypto_Osal_EngineCheck(engine);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_SemPend(&osalEngineDone[engine], timeoutMs);
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Shared State Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Osal_Status_E lCrypto_Osal_StateCheck(crypto_Osal_State_E state)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_SUCCESS;
+
+    if ((state < CRYPTO_OSAL_STATE_VERIFY_CACHE) || (state >= CRYPTO_OSAL_STATE_MAX))
+    {
+        status = CRYPTO_OSAL_ERROR_ARG;
+    }
+#if (CRYPTO_OSAL_PORT != CRYPTO_OSAL_PORT_BARE_METAL)
+    else if (!osalInitialized)
+    {
+        status = CRYPTO_OSAL_ERROR_NOTINIT;
+    }
+#endif
+    else
+    {
+        /* The state can be locked. */
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_StateLock(crypto_Osal_State_E state, uint32_t timeoutMs)
+{
+    crypto_Osal_Status_E status = lCrypto_Osal_StateCheck(state);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_MutexLock(&osalStateMutex[state], timeoutMs);
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_StateUnlock(crypto_Osal_State_E state)
+{
+    crypto_Osal_Status_E status = lCrypto_Osal_StateCheck(state);
+
+    if (status == CRYPTO_OSAL_SUCCESS)
+    {
+        status = Crypto_Osal_MutexUnlock(&osalStateMutex[state]);
+    }
+
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Task Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+
+static void lCrypto_Osal_TaskEntry(void *param)
+{
+    CRYPTO_OSAL_TASK *task = (CRYPTO_OSAL_TASK *)param;
+
+    task->function(task->arg);
+    (void)Crypto_Osal_SemPost(&task->done);
+    // Crypto_Osal_TaskJoin() deletes the task.
+    for (;;)
+    {
+        vTaskSuspend(NULL);
+    }
+}
+
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+
+static void *lCrypto_Osal_TaskEntry(void *param)
+{
+    CRYPTO_OSAL_TASK *task = (CRYPTO_OSAL_TASK *)param;
+
+    task->function(task->arg);
+    (void)Crypto_Osal_SemPost(&task->done);
+
+    return NULL;
+}
+
+#endif
+
+crypto_Osal_Status_E Crypto_Osal_TaskStart(CRYPTO_OSAL_TASK *task, CRYPTO_OSAL_TASK_FUNCTION function, void *arg)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if ((task != NULL) && (function != NULL))
+    {
+        task->function = function;
+        task->arg = arg;
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        status = Crypto_Osal_SemCreate(&task->done, 1UL, 0UL);
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            task->handle = xTaskCreateStatic(lCrypto_Osal_TaskEntry, "crypto", CRYPTO_OSAL_TASK_STACK_WORDS,
+                                             task, uxTaskPriorityGet(NULL), task->stack, &task->buffer);
+            status = (task->handle != NULL) ? CRYPTO_OSAL_SUCCESS : CRYPTO_OSAL_ERROR_FAIL;
+        }
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            // Let the new task start its engine before the caller starts its own.
+            taskYIELD();
+        }
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        status = Crypto_Osal_SemCreate(&task->done, 1UL, 0UL);
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            status = lCrypto_Osal_MapError(pthread_create(&task->thread, NULL, lCrypto_Osal_TaskEntry, task));
+            if (status != CRYPTO_OSAL_SUCCESS)
+            {
+                status = CRYPTO_OSAL_ERROR_FAIL;
+            }
+        }
+#else
+        task->function(task->arg);
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
+
+crypto_Osal_Status_E Crypto_Osal_TaskJoin(CRYPTO_OSAL_TASK *task, uint32_t timeoutMs)
+{
+    crypto_Osal_Status_E status = CRYPTO_OSAL_ERROR_ARG;
+
+    if (task != NULL)
+    {
+#if (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_FREERTOS)
+        status = Crypto_Osal_SemPend(&task->done, timeoutMs);
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            vTaskDelete(task->handle);
+            vSemaphoreDelete(task->done.handle);
+        }
+#elif (CRYPTO_OSAL_PORT == CRYPTO_OSAL_PORT_POSIX)
+        status = Crypto_Osal_SemPend(&task->done, timeoutMs);
+        if (status == CRYPTO_OSAL_SUCCESS)
+        {
+            status = lCrypto_Osal_MapError(pthread_join(task->thread, NULL));
+            (void)sem_destroy(&task->done.sem);
+        }
+#else
+        (void)timeoutMs;
+        status = CRYPTO_OSAL_SUCCESS;
+#endif
+    }
+
+    return status;
+}
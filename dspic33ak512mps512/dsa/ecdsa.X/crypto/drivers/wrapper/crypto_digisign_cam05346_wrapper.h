@@ -77,6 +77,33 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
     uint32_t pubKeyLen, int8_t *hashVerifyStatus, 
     crypto_EccCurveType_E eccCurveType_En);
 
+// As the functions above, with the PKE_CONFIG in a caller workspace.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, void *workspace);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus,
+    crypto_EccCurveType_E eccCurveType_En, void *workspace);
+
+/* Writes the digest of a streamed message to ptr_digest for the *Stream()
+ * functions below; returns false when the hash fails. */
+typedef bool (*crypto_DigiSign_Ecdsa_Hw_DigestFn)(void *ptr_arg, uint8_t *ptr_digest);
+
+/* As Crypto_DigiSign_Ecdsa_Hw_Sign() and _Verify(), with inputHash written
+ * by digestFn(digestArg, inputHash) once the PKE engine is held and the curve
+ * and the PKE_CONFIG are set up, so the digest goes to the PKE as it comes
+ * out of the hash engine. Return CRYPTO_DIGISIGN_ERROR_INPUTHASH when
+ * digestFn fails. */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
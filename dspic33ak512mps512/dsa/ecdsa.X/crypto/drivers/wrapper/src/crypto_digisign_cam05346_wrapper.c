@@ -50,8 +50,12 @@ Microchip or any third party.
 #include <stdint.h>
 #include <xc.h>
 #include "crypto/drivers/wrapper/crypto_digisign_cam05346_wrapper.h"
-#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_pke_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_ecdsa.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+
+#if (CRYPTO_CONFIG_DIGISIGN_ECDSA == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -59,12 +63,6 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
-static void lDRV_CRYPTO_ECDSA_InterruptSetup(void)
-{
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO3_INT, DRV_CRYPTO_PKE_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO3_INT);
-}
-
 static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_GetCurve(
     crypto_EccCurveType_E eccCurveType, PKE_ECC_CURVE *hwEccCurve)
 {
@@ -72,21 +70,29 @@ static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_GetCurve(
 
     switch (eccCurveType)
     {
+#if (CRYPTO_CONFIG_ECC_P192 == 1)
         case CRYPTO_ECC_CURVE_P192:
             *hwEccCurve = P192;
             break;
+#endif
         
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
         case CRYPTO_ECC_CURVE_P256:
             *hwEccCurve = P256;
             break;
+#endif
         
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
         case CRYPTO_ECC_CURVE_P384:
             *hwEccCurve = P384;
             break;
+#endif
         
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
         case CRYPTO_ECC_CURVE_P521:
             *hwEccCurve = P521;
             break;
+#endif
             
         default:
             eccStatus = CRYPTO_PKE_RESULT_ERROR_CURVE;
@@ -131,6 +137,139 @@ static crypto_DigiSign_Status_E lCrypto_DigSign_Ecdsa_Hw_MapResult(CRYPTO_PKE_RE
     return digiSignStatus;
 }
 
+static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_SignCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, PKE_ECC_CURVE hwEccCurve)
+{
+    /* Initialize the hardware library for ECDSA signature */
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDSA_InitEccParamsSign(ptr_eccData, inputHash, hashLen, privKey, privKeyLen, hwEccCurve);
+
+    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Generate the signature */
+        hwResult = DRV_CRYPTO_ECDSA_Sign(ptr_eccData, outSig, sigLen);
+    }
+
+    return hwResult;
+}
+
+static CRYPTO_PKE_RESULT lCrypto_DigSign_Ecdsa_Hw_VerifyCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, PKE_ECC_CURVE hwEccCurve)
+{
+    /* Initialize the hardware library for ECDSA signature verification */
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDSA_InitEccParamsVerify(ptr_eccData,
+                                                                      inputHash,
+                                                                      hashLen,
+                                                                      inputSig,
+                                                                      sigLen,
+                                                                      pubKey,
+                                                                      pubKeyLen,
+                                                                      hwEccCurve);
+
+    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Verify the signature */
+        hwResult = DRV_CRYPTO_ECDSA_Verify(ptr_eccData);
+    }
+
+    return hwResult;
+}
+
+/**
+ * @brief Sign with the PKE workspace of crypto_pke_cam05346_wrapper.h.
+ * @param digestFn NULL when inputHash holds the digest already; otherwise
+ *        called to write it there once the engine, the curve and the
+ *        PKE_CONFIG are set up.
+ * @param ptr_status Receives CRYPTO_DIGISIGN_ERROR_INPUTHASH when digestFn
+ *        fails, else the status of the sign.
+ */
+static void lCrypto_DigSign_Ecdsa_Hw_SignShared(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn, void *digestArg,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, crypto_DigiSign_Status_E *ptr_status)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+    bool digestOk = true;
+    PKE_CONFIG *ptr_eccData;
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && (digestFn != NULL))
+        {
+            digestOk = digestFn(digestArg, inputHash);
+        }
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_SignCtx(ptr_eccData, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+    }
+
+    *ptr_status = digestOk ? lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult) : CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+}
+
+/**
+ * @brief Verify with the PKE workspace; digestFn as for
+ *        lCrypto_DigSign_Ecdsa_Hw_SignShared().
+ */
+static void lCrypto_DigSign_Ecdsa_Hw_VerifyShared(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn, void *digestArg,
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En,
+    crypto_DigiSign_Status_E *ptr_status)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+    bool digestOk = true;
+    PKE_CONFIG *ptr_eccData;
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && (digestFn != NULL))
+        {
+            digestOk = digestFn(digestArg, inputHash);
+        }
+
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_VerifyCtx(ptr_eccData, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hwEccCurve);
+        }
+
+        /* Set verification status */
+        if ((hwResult == CRYPTO_PKE_RESULT_SUCCESS) && digestOk)
+        {
+            *hashVerifyStatus = 1;
+        }
+        else
+        {
+            *hashVerifyStatus = 0;
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
+        *hashVerifyStatus = 0;
+    }
+
+    *ptr_status = digestOk ? lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult) : CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: DigSign Common Interface Implementation
@@ -141,72 +280,133 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Sign(uint8_t *inputHash,
     uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
     uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En)
 {
-    CRYPTO_PKE_RESULT hwResult;
-    PKE_ECC_CURVE hwEccCurve;
-    PKE_CONFIG eccData;
+    crypto_DigiSign_Status_E status;
 
-    /* Get curve */
-    hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGN, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
 
-    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
-    {
-        /* Initialize the hardware library for ECDSA signature */
-        hwResult = DRV_CRYPTO_ECDSA_InitEccParamsSign(&eccData, inputHash, hashLen, privKey, privKeyLen, hwEccCurve);
-    }
-    
-    lDRV_CRYPTO_ECDSA_InterruptSetup();
-    
-    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
-    {
-        /* Generate the signature */
-        hwResult = DRV_CRYPTO_ECDSA_Sign(&eccData, outSig, sigLen);
-    }
-    
-    return lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult);
+    lCrypto_DigSign_Ecdsa_Hw_SignShared(NULL, NULL, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGN, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, status));
 }
 
 crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
     uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
     uint32_t pubKeyLen, int8_t *hashVerifyStatus,
     crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFY, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    lCrypto_DigSign_Ecdsa_Hw_VerifyShared(NULL, NULL, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hashVerifyStatus,
+                                          eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFY, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen,
+    uint8_t *privKey, uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGNSTREAM, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
+
+    lCrypto_DigSign_Ecdsa_Hw_SignShared(digestFn, digestArg, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGNSTREAM, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyStream(crypto_DigiSign_Ecdsa_Hw_DigestFn digestFn,
+    void *digestArg, uint8_t *inputHash, uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen,
+    uint8_t *pubKey, uint32_t pubKeyLen, int8_t *hashVerifyStatus, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E status;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFYSTREAM, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    lCrypto_DigSign_Ecdsa_Hw_VerifyShared(digestFn, digestArg, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hashVerifyStatus,
+                                          eccCurveType_En, &status);
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFYSTREAM, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, status));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey,
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, void *workspace)
 {
     CRYPTO_PKE_RESULT hwResult;
     PKE_ECC_CURVE hwEccCurve;
-    PKE_CONFIG eccData;
 
-    /* Get curve */
-    hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
-    
-    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_SIGNEX, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_SIGN);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
     {
-        /* Initialize the hardware library for ECDSA signature verification */
-        hwResult = DRV_CRYPTO_ECDSA_InitEccParamsVerify(&eccData,
-                                                        inputHash,
-                                                        hashLen,
-                                                        inputSig,
-                                                        sigLen,
-                                                        pubKey,
-                                                        pubKeyLen,
-                                                        hwEccCurve);
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_SignCtx((PKE_CONFIG*) workspace, inputHash, hashLen, outSig, sigLen, privKey, privKeyLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
     }
-    
-    lDRV_CRYPTO_ECDSA_InterruptSetup();
-    
-    if(hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    else
     {
-        /* Verify the signature */
-        hwResult = DRV_CRYPTO_ECDSA_Verify(&eccData);
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
     }
-    
-    /* Set verification status */
-    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_SIGNEX, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_SIGN, crypto_DigiSign_Status_E, hashLen, lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult)));
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyEx(uint8_t *inputHash,
+    uint32_t hashLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey,
+    uint32_t pubKeyLen, int8_t *hashVerifyStatus,
+    crypto_EccCurveType_E eccCurveType_En, void *workspace)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(DIGISIGN_ECDSA_HW_VERIFYEX, hashLen);
+    CRYPTO_STATS_BEGIN(DIGISIGN_ECDSA_VERIFY);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
     {
-        *hashVerifyStatus = 1;
+        /* Get curve */
+        hwResult = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_DigSign_Ecdsa_Hw_VerifyCtx((PKE_CONFIG*) workspace, inputHash, hashLen, inputSig, sigLen, pubKey, pubKeyLen, hwEccCurve);
+        }
+
+        /* Set verification status */
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            *hashVerifyStatus = 1;
+        }
+        else
+        {
+            *hashVerifyStatus = 0;
+        }
+
+        Crypto_Pke_Hw_Release();
     }
     else
     {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
         *hashVerifyStatus = 0;
     }
 
-    return lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult);
-}
\ No newline at end of file
+    return CRYPTO_TRACE_EXIT(DIGISIGN_ECDSA_HW_VERIFYEX, crypto_DigiSign_Status_E, CRYPTO_STATS_END(DIGISIGN_ECDSA_VERIFY, crypto_DigiSign_Status_E, hashLen, lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult)));
+}
+
+#endif /* CRYPTO_CONFIG_DIGISIGN_ECDSA == 1 */
@@ -0,0 +1,291 @@
+/*******************************************************************************
+  Crypto Build Configuration Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_config.h
+
+  Summary:
+    This header file selects the algorithms, modes, curves and checks built
+    into the Crypto Library.
+
+  Description:
+    Every option defaults to the full library and can be overridden in the
+    compiler macros of the project. An algorithm, mode or curve set to 0 is
+    compiled out of the common API and the CAM wrappers; calls that ask for it
+    fail as for an unsupported one.
+
+    With CRYPTO_CONFIG_API_CHECKS set to 0 the argument, session and handler
+    checks of the Crypto_* entry points compile out and, in a build with the
+    hardware handler only, the handler dispatch of each entry point folds into
+    a direct call of its Crypto_*_Hw_* wrapper. The caller is then responsible
+    for passing valid arguments.
+
+    Example profile, AES-GCM + SHA-256 + P-256 only:
+      CRYPTO_CONFIG_SYM_AES=0;CRYPTO_CONFIG_MAC_AESCMAC=0;
+      CRYPTO_CONFIG_KAS_ECDH=0;CRYPTO_CONFIG_RNG_TRNG=0;
+      CRYPTO_CONFIG_HASH_SHA1=0;CRYPTO_CONFIG_HASH_SHA2_224=0;
+      CRYPTO_CONFIG_HASH_SHA2_384=0;CRYPTO_CONFIG_HASH_SHA2_512=0;
+      CRYPTO_CONFIG_ECC_P192=0;CRYPTO_CONFIG_ECC_P384=0;
+      CRYPTO_CONFIG_ECC_P521=0;CRYPTO_CONFIG_API_CHECKS=0
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_CONFIG_H
+#define CRYPTO_CONFIG_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdbool.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Algorithms
+// *****************************************************************************
+// *****************************************************************************
+
+// AES block cipher (crypto_sym_cipher.h).
+#ifndef CRYPTO_CONFIG_SYM_AES
+#define CRYPTO_CONFIG_SYM_AES           (1)
+#endif
+
+// AES-GCM (crypto_aead_cipher.h).
+#ifndef CRYPTO_CONFIG_AEAD_AESGCM
+#define CRYPTO_CONFIG_AEAD_AESGCM       (1)
+#endif
+
+// AES-CMAC (crypto_mac_cipher.h).
+#ifndef CRYPTO_CONFIG_MAC_AESCMAC
+#define CRYPTO_CONFIG_MAC_AESCMAC       (1)
+#endif
+
+// SHA-1 and SHA-2 (crypto_hash.h).
+#ifndef CRYPTO_CONFIG_HASH_SHA
+#define CRYPTO_CONFIG_HASH_SHA          (1)
+#endif
+
+// ECDSA (crypto_digsign.h).
+#ifndef CRYPTO_CONFIG_DIGISIGN_ECDSA
+#define CRYPTO_CONFIG_DIGISIGN_ECDSA    (1)
+#endif
+
+// ECDH (crypto_kas.h).
+#ifndef CRYPTO_CONFIG_KAS_ECDH
+#define CRYPTO_CONFIG_KAS_ECDH          (1)
+#endif
+
+// TRNG (crypto_rng.h).
+#ifndef CRYPTO_CONFIG_RNG_TRNG
+#define CRYPTO_CONFIG_RNG_TRNG          (1)
+#endif
+
+// HKDF (crypto_kdf.h), on SHA.
+#ifndef CRYPTO_CONFIG_KDF_HKDF
+#define CRYPTO_CONFIG_KDF_HKDF          (CRYPTO_CONFIG_HASH_SHA)
+#endif
+
+// ANSI X9.63 KDF (crypto_kdf.h), on SHA.
+#ifndef CRYPTO_CONFIG_KDF_X963
+#define CRYPTO_CONFIG_KDF_X963          (CRYPTO_CONFIG_HASH_SHA)
+#endif
+
+// ECDHE handshake (crypto_handshake.h), on TRNG, ECDH, HKDF and AES-GCM.
+#ifndef CRYPTO_CONFIG_HANDSHAKE_ECDHE
+#define CRYPTO_CONFIG_HANDSHAKE_ECDHE   ((CRYPTO_CONFIG_RNG_TRNG == 1) && (CRYPTO_CONFIG_KAS_ECDH == 1) && \
+                                         (CRYPTO_CONFIG_KDF_HKDF == 1) && (CRYPTO_CONFIG_AEAD_AESGCM == 1))
+#endif
+
+// ECIES (crypto_ecies.h), on the ECDHE handshake key pairs, X9.63 KDF and AES-GCM.
+#ifndef CRYPTO_CONFIG_ECIES
+#define CRYPTO_CONFIG_ECIES             ((CRYPTO_CONFIG_HANDSHAKE_ECDHE == 1) && (CRYPTO_CONFIG_KDF_X963 == 1))
+#endif
+
+// Deterministic ECDSA of RFC 6979 (crypto_rfc6979.h), on HKDF and ECDH.
+#ifndef CRYPTO_CONFIG_DIGISIGN_RFC6979
+#define CRYPTO_CONFIG_DIGISIGN_RFC6979  ((CRYPTO_CONFIG_KDF_HKDF == 1) && (CRYPTO_CONFIG_KAS_ECDH == 1))
+#endif
+
+// Streaming ECDSA sign and verify (crypto_digsign_stream.h), hashing on the SHA engine.
+#ifndef CRYPTO_CONFIG_DIGISIGN_STREAM
+#define CRYPTO_CONFIG_DIGISIGN_STREAM   ((CRYPTO_CONFIG_DIGISIGN_ECDSA == 1) && ((CRYPTO_CONFIG_HASH_SHA2_256 == 1) || \
+                                         (CRYPTO_CONFIG_HASH_SHA2_384 == 1) || (CRYPTO_CONFIG_HASH_SHA2_512 == 1)))
+#endif
+
+// Cache of successful ECDSA verifications (crypto_verify_cache.h), keyed by the TRNG, on SHA-256 and HKDF.
+#ifndef CRYPTO_CONFIG_VERIFY_CACHE
+#define CRYPTO_CONFIG_VERIFY_CACHE      ((CRYPTO_CONFIG_DIGISIGN_ECDSA == 1) && (CRYPTO_CONFIG_RNG_TRNG == 1) && \
+                                         (CRYPTO_CONFIG_KDF_HKDF == 1) && (CRYPTO_CONFIG_HASH_SHA2_256 == 1))
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Modes, Hash Algorithms and Curves
+// *****************************************************************************
+// *****************************************************************************
+
+#ifndef CRYPTO_CONFIG_AES_ECB
+#define CRYPTO_CONFIG_AES_ECB           (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_AES_CTR
+#define CRYPTO_CONFIG_AES_CTR           (1)
+#endif
+
+// Also builds Crypto_Sym_AesXts_Cipher().
+#ifndef CRYPTO_CONFIG_AES_XTS
+#define CRYPTO_CONFIG_AES_XTS           (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_HASH_SHA1
+#define CRYPTO_CONFIG_HASH_SHA1         (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_HASH_SHA2_224
+#define CRYPTO_CONFIG_HASH_SHA2_224     (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_HASH_SHA2_256
+#define CRYPTO_CONFIG_HASH_SHA2_256     (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_HASH_SHA2_384
+#define CRYPTO_CONFIG_HASH_SHA2_384     (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_HASH_SHA2_512
+#define CRYPTO_CONFIG_HASH_SHA2_512     (1)
+#endif
+
+// Curves of ECDSA and ECDH.
+#ifndef CRYPTO_CONFIG_ECC_P192
+#define CRYPTO_CONFIG_ECC_P192          (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_ECC_P256
+#define CRYPTO_CONFIG_ECC_P256          (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_ECC_P384
+#define CRYPTO_CONFIG_ECC_P384          (1)
+#endif
+
+#ifndef CRYPTO_CONFIG_ECC_P521
+#define CRYPTO_CONFIG_ECC_P521          (1)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Handlers and Checks
+// *****************************************************************************
+// *****************************************************************************
+
+/* Software AES-ECB/CTR, AES-GCM, AES-CMAC and SHA-1/SHA-2
+ * (CRYPTO_HANDLER_SW_INTERNAL) and the size-based dispatch between the CAM
+ * and the software (CRYPTO_HANDLER_AUTO). */
+#ifndef CRYPTO_CONFIG_SW_HANDLER
+#define CRYPTO_CONFIG_SW_HANDLER        (0)
+#endif
+
+/* Payload lengths in bytes below which CRYPTO_HANDLER_AUTO runs an operation
+ * in software; at or above them it uses the CAM unless the engine is busy.
+ * 0 sends only the operations that find the engine busy to software. Measure
+ * them on the target with the RUN_CROSSOVER_TEST benchmark of aes_hash. */
+#ifndef CRYPTO_CONFIG_AUTO_AES_CROSSOVER
+#define CRYPTO_CONFIG_AUTO_AES_CROSSOVER    (0UL)
+#endif
+
+#ifndef CRYPTO_CONFIG_AUTO_GCM_CROSSOVER
+#define CRYPTO_CONFIG_AUTO_GCM_CROSSOVER    (0UL)
+#endif
+
+#ifndef CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER
+#define CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER   (0UL)
+#endif
+
+#ifndef CRYPTO_CONFIG_AUTO_SHA_CROSSOVER
+#define CRYPTO_CONFIG_AUTO_SHA_CROSSOVER    (0UL)
+#endif
+
+/* True when a payload of len bytes is below the crossover; constant false
+ * at a crossover of 0, so that no unsigned compare with 0 is built. */
+#if (CRYPTO_CONFIG_AUTO_AES_CROSSOVER > 0UL)
+#define CRYPTO_AUTO_AES_BELOW_CROSSOVER(len)   ((len) < CRYPTO_CONFIG_AUTO_AES_CROSSOVER)
+#else
+#define CRYPTO_AUTO_AES_BELOW_CROSSOVER(len)   ((void)(len), false)
+#endif
+
+#if (CRYPTO_CONFIG_AUTO_GCM_CROSSOVER > 0UL)
+#define CRYPTO_AUTO_GCM_BELOW_CROSSOVER(len)   ((len) < CRYPTO_CONFIG_AUTO_GCM_CROSSOVER)
+#else
+#define CRYPTO_AUTO_GCM_BELOW_CROSSOVER(len)   ((void)(len), false)
+#endif
+
+#if (CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER > 0UL)
+#define CRYPTO_AUTO_CMAC_BELOW_CROSSOVER(len)  ((len) < CRYPTO_CONFIG_AUTO_CMAC_CROSSOVER)
+#else
+#define CRYPTO_AUTO_CMAC_BELOW_CROSSOVER(len)  ((void)(len), false)
+#endif
+
+#if (CRYPTO_CONFIG_AUTO_SHA_CROSSOVER > 0UL)
+#define CRYPTO_AUTO_SHA_BELOW_CROSSOVER(len)   ((len) < CRYPTO_CONFIG_AUTO_SHA_CROSSOVER)
+#else
+#define CRYPTO_AUTO_SHA_BELOW_CROSSOVER(len)   ((void)(len), false)
+#endif
+
+// 1 when CRYPTO_HANDLER_HW_INTERNAL is the only handler built.
+#if defined(CRYPTO_WOLFCRYPT_SUPPORT_ENABLE) || (CRYPTO_CONFIG_SW_HANDLER == 1)
+#define CRYPTO_CONFIG_SINGLE_HANDLER    (0)
+#else
+#define CRYPTO_CONFIG_SINGLE_HANDLER    (1)
+#endif
+
+// Argument, session and handler checks of the Crypto_* entry points.
+#ifndef CRYPTO_CONFIG_API_CHECKS
+#define CRYPTO_CONFIG_API_CHECKS        (1)
+#endif
+
+/* Condition of an argument check; constant false, so the check and its error
+ * branch are removed, when the checks are compiled out. The condition is kept
+ * unevaluated to leave its arguments referenced. */
+#if (CRYPTO_CONFIG_API_CHECKS == 0)
+#define CRYPTO_API_CHECK(cond)          (false && (cond))
+#else
+#define CRYPTO_API_CHECK(cond)          (cond)
+#endif
+
+/* Controlling expression of a handler switch; constant, so the switch folds
+ * into the call of the only handler, when there is nothing to check. */
+#if (CRYPTO_CONFIG_API_CHECKS == 0) && (CRYPTO_CONFIG_SINGLE_HANDLER == 1)
+#define CRYPTO_HANDLER_SELECT(handler)  ((void)(handler), CRYPTO_HANDLER_HW_INTERNAL)
+#else
+#define CRYPTO_HANDLER_SELECT(handler)  (handler)
+#endif
+
+#endif /* CRYPTO_CONFIG_H */
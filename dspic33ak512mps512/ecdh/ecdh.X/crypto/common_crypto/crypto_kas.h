@@ -70,4 +70,17 @@ typedef enum
 crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
                                                     uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId);
 
+/* Bytes of workspace Crypto_Kas_Ecdh_SharedSecretEx() needs for a handler, 0
+ * when the handler does not support it. */
+uint32_t Crypto_Kas_Ecdh_WorkspaceSize(crypto_HandlerType_E ecdhHandlerType_en);
+
+/* As Crypto_Kas_Ecdh_SharedSecret(), with the working data in a caller
+ * workspace aligned to CRYPTO_WORKSPACE_ALIGN instead of on the stack. The
+ * workspace may be shared by calls that do not overlap. Returns
+ * CRYPTO_KAS_ERROR_ARG for a workspace that is NULL, misaligned or smaller
+ * than Crypto_Kas_Ecdh_WorkspaceSize(). */
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecretEx(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId,
+                                                    void *ptr_workspace, uint32_t workspaceLen);
+
 #endif /* CRYPTO_KAS_H */
\ No newline at end of file
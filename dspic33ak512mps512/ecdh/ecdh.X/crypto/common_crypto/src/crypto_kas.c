@@ -53,6 +53,11 @@
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_kas.h"
 #include "crypto/drivers/wrapper/crypto_kas_cam05346_wrapper.h"
+#include "crypto/drivers/library/cam_pke.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+
+#if (CRYPTO_CONFIG_KAS_ECDH == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -64,38 +69,54 @@
 
 // *****************************************************************************
 // *****************************************************************************
-// Section: Function Definitions
+// Section: File Scope Functions
 // *****************************************************************************
 // *****************************************************************************
 
-crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
-                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId)
+static crypto_Kas_Status_E lCrypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId,
+                                                    void *ptr_workspace)
 {
     crypto_Kas_Status_E ret_ecdhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
-    
-    if( (ptr_pubKey == NULL) || (pubKeyLen == 0u) )
+
+    if(CRYPTO_API_CHECK( (ptr_pubKey == NULL) || (pubKeyLen == 0u) ))
     {
         ret_ecdhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
     }
-    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH) )
+    else if(CRYPTO_API_CHECK( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH) ))
     {
          ret_ecdhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
     }
-    else if( (eccCurveType_en <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_en >= CRYPTO_ECC_CURVE_MAX) )
+    else if(CRYPTO_API_CHECK( (eccCurveType_en <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_en >= CRYPTO_ECC_CURVE_MAX) ))
     {
          ret_ecdhStat_en = CRYPTO_KAS_ERROR_CURVE;
     }
-    else if((ecdhSessionId == 0u) || (ecdhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) )
+    else if(CRYPTO_API_CHECK((ecdhSessionId == 0u) || (ecdhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) ))
     {
         ret_ecdhStat_en = CRYPTO_KAS_ERROR_SID;
     }
+    else if(!CRYPTO_SELFTEST_REQUIRE(KAS_ECDH))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_FAIL;
+    }
     else
     {
-        switch(ecdhHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(ecdhHandlerType_en))
         {            
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software handler; always the CAM.
+#endif
             case CRYPTO_HANDLER_HW_INTERNAL:
-	              ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecret(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
-	                                                                    sharedSecretLen, eccCurveType_en);
+                if (ptr_workspace == NULL)
+                {
+	                ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecret(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+	                                                                  sharedSecretLen, eccCurveType_en);
+                }
+                else
+                {
+	                ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecretEx(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+	                                                                    sharedSecretLen, eccCurveType_en, ptr_workspace);
+                }
 	            break;
             default:
                 ret_ecdhStat_en = CRYPTO_KAS_ERROR_HDLR;
@@ -104,3 +125,58 @@ crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandle
     }
     return ret_ecdhStat_en;
 }
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId)
+{
+    CRYPTO_TRACE_ENTER(KAS_ECDH_SHAREDSECRET, 0UL);
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_SHAREDSECRET, crypto_Kas_Status_E,
+        lCrypto_Kas_Ecdh_SharedSecret(ecdhHandlerType_en, ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret, sharedSecretLen,
+                                      eccCurveType_en, ecdhSessionId, NULL));
+}
+
+uint32_t Crypto_Kas_Ecdh_WorkspaceSize(crypto_HandlerType_E ecdhHandlerType_en)
+{
+    uint32_t size = 0UL;
+
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    if ((ecdhHandlerType_en == CRYPTO_HANDLER_HW_INTERNAL) || (ecdhHandlerType_en == CRYPTO_HANDLER_AUTO))
+#else
+    if (ecdhHandlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
+#endif
+    {
+        size = (uint32_t)sizeof(PKE_CONFIG);
+    }
+
+    return size;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecretEx(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                    uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId,
+                                                    void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Kas_Status_E ret_ecdhStat_en;
+
+    CRYPTO_TRACE_ENTER(KAS_ECDH_SHAREDSECRETEX, 0UL);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Kas_Ecdh_WorkspaceSize(ecdhHandlerType_en))))
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_ARG;
+    }
+    else
+    {
+        ret_ecdhStat_en = lCrypto_Kas_Ecdh_SharedSecret(ecdhHandlerType_en, ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret, sharedSecretLen,
+                                                        eccCurveType_en, ecdhSessionId, ptr_workspace);
+    }
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_SHAREDSECRETEX, crypto_Kas_Status_E, ret_ecdhStat_en);
+}
+
+#endif /* CRYPTO_CONFIG_KAS_ECDH == 1 */
@@ -60,6 +60,12 @@ crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecret(uint8_t *privKey,
     uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
     uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en);
 
+// As Crypto_Kas_Ecdh_Hw_SharedSecret(), with the PKE_CONFIG in a caller workspace.
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecretEx(uint8_t *privKey,
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en,
+    void *workspace);
+
 #ifdef	__cplusplus
 }
 #endif
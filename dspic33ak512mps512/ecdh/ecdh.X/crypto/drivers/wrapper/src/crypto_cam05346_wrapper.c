@@ -50,6 +50,9 @@ Microchip or any third party.
 #include <stddef.h>
 #include <xc.h>
 #include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -60,8 +63,10 @@ Microchip or any third party.
 #define CRYPTO_INT_HANDLER_COUNT (CRYPTO3_INT + 1)
 struct crypto_Int_Handlers {
     crypto_Int_Handler handlers[CRYPTO_INT_HANDLER_COUNT];
+    crypto_Int_Completion completions[CRYPTO_INT_HANDLER_COUNT];
+    void *contexts[CRYPTO_INT_HANDLER_COUNT];
 };
-static struct crypto_Int_Handlers cryptoIntHandlers = {{NULL}};
+static struct crypto_Int_Handlers cryptoIntHandlers = {{NULL}, {NULL}, {NULL}};
 
 void __attribute__((interrupt)) _CRYPTO1Interrupt(void);
 void __attribute__((interrupt)) _CRYPTO2Interrupt(void);
@@ -76,32 +81,68 @@ void __attribute__((interrupt)) _CRYPTO3Interrupt(void);
 
 void __attribute__((interrupt)) _CRYPTO1Interrupt(void)
 {
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO1, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO1_INT);
+
     if (cryptoIntHandlers.handlers[CRYPTO1_INT] != NULL)
     {
         cryptoIntHandlers.handlers[CRYPTO1_INT]();
     }
 
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_SYM);
+
+    if (cryptoIntHandlers.completions[CRYPTO1_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO1_INT](cryptoIntHandlers.contexts[CRYPTO1_INT]);
+    }
+
     _CRYPT1IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO1);
 }
 
 void __attribute__((interrupt)) _CRYPTO2Interrupt(void)
 {
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO2, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO2_INT);
+
     if (cryptoIntHandlers.handlers[CRYPTO2_INT] != NULL)
     {
         cryptoIntHandlers.handlers[CRYPTO2_INT]();
     }
 
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_TRNG);
+
+    if (cryptoIntHandlers.completions[CRYPTO2_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO2_INT](cryptoIntHandlers.contexts[CRYPTO2_INT]);
+    }
+
     _CRYPT2IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO2);
 }
 
 void __attribute__((interrupt)) _CRYPTO3Interrupt(void)
 {
+    CRYPTO_TRACE_ENTER(ISR_CRYPTO3, 0UL);
+    CRYPTO_STATS_INTERRUPT(CRYPTO3_INT);
+
     if (cryptoIntHandlers.handlers[CRYPTO3_INT] != NULL)
     {
         cryptoIntHandlers.handlers[CRYPTO3_INT]();
     }
 
+    Crypto_Osal_EngineSignal(CRYPTO_OSAL_ENGINE_PKE);
+
+    if (cryptoIntHandlers.completions[CRYPTO3_INT] != NULL)
+    {
+        cryptoIntHandlers.completions[CRYPTO3_INT](cryptoIntHandlers.contexts[CRYPTO3_INT]);
+    }
+
     _CRYPT3IF = 0;
+
+    CRYPTO_TRACE_EXIT_VOID(ISR_CRYPTO3);
 }
 
 // *****************************************************************************
@@ -114,6 +155,8 @@ crypto_Int_Status_E Crypto_Int_Hw_Register_Handler(crypto_Int_Handler_Id handler
 {
     crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
 
+    CRYPTO_TRACE_ENTER(INT_HW_REGISTER_HANDLER, 0UL);
+
     if ((handlerID < CRYPTO1_INT) || (handlerID > CRYPTO3_INT))
     {
         status = CRYPTO_INT_INVALID_ID;
@@ -121,7 +164,9 @@ crypto_Int_Status_E Crypto_Int_Hw_Register_Handler(crypto_Int_Handler_Id handler
 
     if (status == CRYPTO_INT_SUCCESS)
     {
-        if ((handler != NULL) && (cryptoIntHandlers.handlers[handlerID] != NULL))
+        // Registering the handler already in place succeeds.
+        if ((handler != NULL) && (cryptoIntHandlers.handlers[handlerID] != NULL) &&
+            (cryptoIntHandlers.handlers[handlerID] != handler))
         {
             status = CRYPTO_INT_ALREADY_REGISTERED;
         }
@@ -132,13 +177,48 @@ crypto_Int_Status_E Crypto_Int_Hw_Register_Handler(crypto_Int_Handler_Id handler
         cryptoIntHandlers.handlers[handlerID] = handler;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(INT_HW_REGISTER_HANDLER, crypto_Int_Status_E, status);
+}
+
+crypto_Int_Status_E Crypto_Int_Hw_Register_Completion(crypto_Int_Handler_Id handlerID,
+    crypto_Int_Completion completion, void *context)
+{
+    crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
+    uint32_t lockState;
+
+    CRYPTO_TRACE_ENTER(INT_HW_REGISTER_COMPLETION, 0UL);
+
+    if ((handlerID < CRYPTO1_INT) || (handlerID > CRYPTO3_INT))
+    {
+        status = CRYPTO_INT_INVALID_ID;
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        if ((completion != NULL) && (cryptoIntHandlers.completions[handlerID] != NULL))
+        {
+            status = CRYPTO_INT_ALREADY_REGISTERED;
+        }
+    }
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        /* The interrupt must not see the new function with the old context. */
+        lockState = Crypto_Int_Hw_Lock();
+        cryptoIntHandlers.completions[handlerID] = completion;
+        cryptoIntHandlers.contexts[handlerID] = context;
+        Crypto_Int_Hw_Unlock(lockState);
+    }
+
+    return CRYPTO_TRACE_EXIT(INT_HW_REGISTER_COMPLETION, crypto_Int_Status_E, status);
 }
 
 crypto_Int_Status_E Crypto_Int_Hw_Enable(crypto_Int_Handler_Id handlerID)
 {
     crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
 
+    CRYPTO_TRACE_ENTER(INT_HW_ENABLE, 0UL);
+
     switch (handlerID)
     {
         case CRYPTO1_INT:
@@ -161,13 +241,15 @@ crypto_Int_Status_E Crypto_Int_Hw_Enable(crypto_Int_Handler_Id handlerID)
             break;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(INT_HW_ENABLE, crypto_Int_Status_E, status);
 }
 
 crypto_Int_Status_E Crypto_Int_Hw_Disable(crypto_Int_Handler_Id handlerID)
 {
     crypto_Int_Status_E status = CRYPTO_INT_SUCCESS;
 
+    CRYPTO_TRACE_ENTER(INT_HW_DISABLE, 0UL);
+
     switch (handlerID)
     {
         case CRYPTO1_INT:
@@ -190,5 +272,19 @@ crypto_Int_Status_E Crypto_Int_Hw_Disable(crypto_Int_Handler_Id handlerID)
             break;
     }
 
-    return status;
+    return CRYPTO_TRACE_EXIT(INT_HW_DISABLE, crypto_Int_Status_E, status);
+}
+
+uint32_t Crypto_Int_Hw_Lock(void)
+{
+    uint32_t lockState = (uint32_t)__builtin_get_isr_state();
+
+    __builtin_disable_interrupts();
+
+    return lockState;
+}
+
+void Crypto_Int_Hw_Unlock(uint32_t lockState)
+{
+    __builtin_set_isr_state((unsigned int)lockState);
 }
@@ -48,14 +48,12 @@ Microchip or any third party.
 // *****************************************************************************
 #include <stdint.h>
 #include "crypto/drivers/wrapper/crypto_kas_cam05346_wrapper.h"
-#include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_pke_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_ecdh.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
 
-static void lDRV_CRYPTO_ECC_InterruptSetup(void)
-{
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO3_INT, DRV_CRYPTO_PKE_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO3_INT);
-}
+#if (CRYPTO_CONFIG_KAS_ECDH == 1)
 
 static CRYPTO_PKE_RESULT lCrypto_Kas_Ecdh_Hw_GetCurve(
     crypto_EccCurveType_E eccCurveType, PKE_ECC_CURVE *hwEccCurve)
@@ -64,21 +62,29 @@ static CRYPTO_PKE_RESULT lCrypto_Kas_Ecdh_Hw_GetCurve(
 
     switch (eccCurveType)
     {
+#if (CRYPTO_CONFIG_ECC_P192 == 1)
         case CRYPTO_ECC_CURVE_P192:
             *hwEccCurve = P192;
             break;
+#endif
 
+#if (CRYPTO_CONFIG_ECC_P256 == 1)
         case CRYPTO_ECC_CURVE_P256:
             *hwEccCurve = P256;
             break;
+#endif
 
+#if (CRYPTO_CONFIG_ECC_P384 == 1)
         case CRYPTO_ECC_CURVE_P384:
             *hwEccCurve = P384;
             break;
+#endif
 
+#if (CRYPTO_CONFIG_ECC_P521 == 1)
         case CRYPTO_ECC_CURVE_P521:
             *hwEccCurve = P521;
             break;
+#endif
 
         default:
             eccStatus = CRYPTO_PKE_RESULT_ERROR_CURVE;
@@ -118,28 +124,82 @@ static crypto_Kas_Status_E lCrypto_Kas_Ecdh_Hw_MapResult(CRYPTO_PKE_RESULT resul
     return kasStatus;
 }
 
+static CRYPTO_PKE_RESULT lCrypto_Kas_Ecdh_Hw_SharedSecretCtx(PKE_CONFIG *ptr_eccData,
+    uint8_t *privKey, uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, PKE_ECC_CURVE hwEccCurve)
+{
+    CRYPTO_PKE_RESULT hwResult = DRV_CRYPTO_ECDH_InitEccParams(ptr_eccData, privKey, privKeyLen,
+                                                               pubKey, pubKeyLen, hwEccCurve);
+
+    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    {
+        /* Get shared key */
+        hwResult = DRV_CRYPTO_ECDH_GetSharedSecret(ptr_eccData, secret, secretLen);
+    }
+
+    return hwResult;
+}
+
 crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecret(uint8_t *privKey,
     uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
     uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en)
 {
     CRYPTO_PKE_RESULT hwResult;
-    PKE_CONFIG eccData;
+    PKE_CONFIG *ptr_eccData;
     PKE_ECC_CURVE hwEccCurve;
 
-    /* Get curve */
-    hwResult = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
-    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+    CRYPTO_TRACE_ENTER(KAS_ECDH_HW_SHAREDSECRET, 0UL);
+    CRYPTO_STATS_BEGIN(KAS_ECDH);
+
+    ptr_eccData = Crypto_Pke_Hw_Acquire();
+    if (ptr_eccData != NULL)
+    {
+        /* Get curve */
+        hwResult = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            hwResult = lCrypto_Kas_Ecdh_Hw_SharedSecretCtx(ptr_eccData, privKey, privKeyLen, pubKey, pubKeyLen, secret, secretLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
     {
-        hwResult = DRV_CRYPTO_ECDH_InitEccParams(&eccData, privKey, privKeyLen,
-                                             pubKey, pubKeyLen, hwEccCurve);
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
     }
 
-    lDRV_CRYPTO_ECC_InterruptSetup();
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_HW_SHAREDSECRET, crypto_Kas_Status_E, CRYPTO_STATS_END(KAS_ECDH, crypto_Kas_Status_E, 0UL, lCrypto_Kas_Ecdh_Hw_MapResult(hwResult)));
+}
 
-    if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecretEx(uint8_t *privKey,
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen,
+    uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en,
+    void *workspace)
+{
+    CRYPTO_PKE_RESULT hwResult;
+    PKE_ECC_CURVE hwEccCurve;
+
+    CRYPTO_TRACE_ENTER(KAS_ECDH_HW_SHAREDSECRETEX, 0UL);
+    CRYPTO_STATS_BEGIN(KAS_ECDH);
+
+    if (Crypto_Pke_Hw_Acquire() != NULL)
     {
-        /* Get shared key */
-        hwResult = DRV_CRYPTO_ECDH_GetSharedSecret(&eccData, secret, secretLen);
+        /* Get curve */
+        hwResult = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
+        if (hwResult == CRYPTO_PKE_RESULT_SUCCESS)
+        {
+            /* cppcheck-suppress misra-c2012-11.5 */
+            hwResult = lCrypto_Kas_Ecdh_Hw_SharedSecretCtx((PKE_CONFIG*) workspace, privKey, privKeyLen, pubKey, pubKeyLen, secret, secretLen, hwEccCurve);
+        }
+
+        Crypto_Pke_Hw_Release();
+    }
+    else
+    {
+        hwResult = CRYPTO_PKE_RESULT_INIT_FAIL;
     }
-    return lCrypto_Kas_Ecdh_Hw_MapResult(hwResult);
-}
\ No newline at end of file
+
+    return CRYPTO_TRACE_EXIT(KAS_ECDH_HW_SHAREDSECRETEX, crypto_Kas_Status_E, CRYPTO_STATS_END(KAS_ECDH, crypto_Kas_Status_E, 0UL, lCrypto_Kas_Ecdh_Hw_MapResult(hwResult)));
+}
+
+#endif /* CRYPTO_CONFIG_KAS_ECDH == 1 */
@@ -0,0 +1,678 @@
+/*******************************************************************************
+  Crypto C++ Interface Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cam.hpp
+
+  Summary:
+    This header file provides a header-only C++17 interface to the Crypto
+    Library.
+
+  Description:
+    cam::Aes<Mode, KeySize>, cam::Sha<Algo> and cam::Ecdsa<Curve> call the
+    Crypto_* APIs of the modules present in the project. The mode, key size,
+    hash algorithm and curve are template parameters: a configuration that is
+    not built (see crypto_config.h) fails to compile, key, IV, digest and
+    signature sizes are fixed by std::array types, and the C enums are
+    constants, so the wrappers inline to the same calls a C caller makes.
+
+    Aes and Sha own their Crypto Library context. They cannot be copied, can
+    be moved, and wipe the context when destroyed. The context only references
+    the key and IV given to init(), which must stay valid until the context is
+    destroyed or initialized again. Data is passed as cam::Span: std::span
+    from C++20, otherwise a minimal pointer and length view with the same
+    constructors for arrays and contiguous containers. Nothing is copied.
+
+    Every call returns the status of the C API; the C++ layer adds no
+    exceptions and no dynamic memory. Spans whose sizes do not fit the call
+    are rejected with the module's data error unless CRYPTO_CONFIG_API_CHECKS
+    is 0.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_CAM_HPP
+#define CRYPTO_CAM_HPP
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "crypto_cam.hpp requires C++17"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#if (__cplusplus > 201703L) && __has_include(<span>)
+#include <span>
+#endif
+
+extern "C" {
+#include "crypto/common_crypto/crypto_common.h"
+#if __has_include("crypto/common_crypto/crypto_sym_cipher.h") && (CRYPTO_CONFIG_SYM_AES == 1)
+#include "crypto/common_crypto/crypto_sym_cipher.h"
+#define CRYPTO_CAM_SYM      (1)
+#endif
+#if __has_include("crypto/common_crypto/crypto_aead_cipher.h") && (CRYPTO_CONFIG_AEAD_AESGCM == 1)
+#include "crypto/common_crypto/crypto_aead_cipher.h"
+#define CRYPTO_CAM_AEAD     (1)
+#endif
+#if __has_include("crypto/common_crypto/crypto_hash.h") && (CRYPTO_CONFIG_HASH_SHA == 1)
+#include "crypto/common_crypto/crypto_hash.h"
+#define CRYPTO_CAM_HASH     (1)
+#endif
+#if __has_include("crypto/common_crypto/crypto_digsign.h") && (CRYPTO_CONFIG_DIGISIGN_ECDSA == 1)
+#include "crypto/common_crypto/crypto_digsign.h"
+#define CRYPTO_CAM_ECDSA    (1)
+#endif
+}
+
+namespace cam {
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+enum class Mode { Ecb, Ctr, Xts, Gcm };
+
+enum class KeySize : std::uint32_t
+{
+    k128 = 16U,
+    k192 = 24U,
+    k256 = 32U
+};
+
+enum class Algo { Sha1, Sha224, Sha256, Sha384, Sha512 };
+
+enum class Curve { P192, P256, P384, P521 };
+
+enum class Direction { Encrypt, Decrypt };
+
+#if defined(__cpp_lib_span)
+template <typename T>
+using Span = std::span<T>;
+#else
+// View of size() contiguous T at data(); a subset of std::span.
+template <typename T>
+class Span
+{
+    template <typename C>
+    using Element = std::remove_pointer_t<decltype(std::declval<C &>().data())>;
+
+public:
+    constexpr Span() noexcept = default;
+
+    constexpr Span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    template <std::size_t N>
+    constexpr Span(T (&array)[N]) noexcept : data_(array), size_(N) {}
+
+    // std::array, std::vector, Span and other containers with data() and size().
+    template <typename C, typename = std::enable_if_t<std::is_convertible_v<Element<C> (*)[], T (*)[]>>>
+    constexpr Span(C &&container) noexcept : data_(container.data()), size_(container.size()) {}
+
+    constexpr T *data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return size_ == 0U; }
+
+private:
+    T *data_ = nullptr;
+    std::size_t size_ = 0U;
+};
+#endif
+
+using ConstBytes = Span<const std::uint8_t>;
+using Bytes = Span<std::uint8_t>;
+
+namespace detail {
+
+// The only session ID the Crypto Library accepts.
+inline constexpr std::uint32_t sessionId = 1U;
+
+inline constexpr crypto_HandlerType_E handler = CRYPTO_HANDLER_HW_INTERNAL;
+
+// Zeroes len bytes in a way the compiler cannot remove as a dead store.
+inline void wipe(void *ptr, std::size_t len) noexcept
+{
+    volatile std::uint8_t *byte = static_cast<volatile std::uint8_t *>(ptr);
+
+    while (len > 0U)
+    {
+        *byte = 0U;
+        byte++;
+        len--;
+    }
+}
+
+/* The C API takes inputs through non-const pointers without writing to them.
+ * An empty input is passed as NULL, which the API expects with length 0. */
+inline std::uint8_t *input(ConstBytes bytes) noexcept
+{
+    return bytes.empty() ? nullptr : const_cast<std::uint8_t *>(bytes.data());
+}
+
+inline std::uint8_t *output(Bytes bytes) noexcept
+{
+    return bytes.empty() ? nullptr : bytes.data();
+}
+
+inline constexpr crypto_CipherOper_E cipherOper(Direction direction) noexcept
+{
+    return (direction == Direction::Encrypt) ? CRYPTO_CIOP_ENCRYPT : CRYPTO_CIOP_DECRYPT;
+}
+
+template <Mode M>
+struct ModeTraits
+{
+    static constexpr bool enabled = false;
+};
+
+#ifdef CRYPTO_CAM_SYM
+template <>
+struct ModeTraits<Mode::Ecb>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_AES_ECB == 1);
+    static constexpr crypto_Sym_OpModes_E opMode = CRYPTO_SYM_OPMODE_ECB;
+    static constexpr std::size_t keyFactor = 1U;
+};
+
+template <>
+struct ModeTraits<Mode::Ctr>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_AES_CTR == 1);
+    static constexpr crypto_Sym_OpModes_E opMode = CRYPTO_SYM_OPMODE_CTR;
+    static constexpr std::size_t keyFactor = 1U;
+};
+
+// XTS takes two AES keys of the key size.
+template <>
+struct ModeTraits<Mode::Xts>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_AES_XTS == 1);
+    static constexpr crypto_Sym_OpModes_E opMode = CRYPTO_SYM_OPMODE_XTS;
+    static constexpr std::size_t keyFactor = 2U;
+};
+#endif
+
+template <Algo A>
+struct AlgoTraits
+{
+    static constexpr bool enabled = false;
+};
+
+#ifdef CRYPTO_CAM_HASH
+template <>
+struct AlgoTraits<Algo::Sha1>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_HASH_SHA1 == 1);
+    static constexpr crypto_Hash_Algo_E algo = CRYPTO_HASH_SHA1;
+    static constexpr std::size_t digestBytes = 20U;
+};
+
+template <>
+struct AlgoTraits<Algo::Sha224>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_HASH_SHA2_224 == 1);
+    static constexpr crypto_Hash_Algo_E algo = CRYPTO_HASH_SHA2_224;
+    static constexpr std::size_t digestBytes = 28U;
+};
+
+template <>
+struct AlgoTraits<Algo::Sha256>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_HASH_SHA2_256 == 1);
+    static constexpr crypto_Hash_Algo_E algo = CRYPTO_HASH_SHA2_256;
+    static constexpr std::size_t digestBytes = 32U;
+};
+
+template <>
+struct AlgoTraits<Algo::Sha384>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_HASH_SHA2_384 == 1);
+    static constexpr crypto_Hash_Algo_E algo = CRYPTO_HASH_SHA2_384;
+    static constexpr std::size_t digestBytes = 48U;
+};
+
+template <>
+struct AlgoTraits<Algo::Sha512>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_HASH_SHA2_512 == 1);
+    static constexpr crypto_Hash_Algo_E algo = CRYPTO_HASH_SHA2_512;
+    static constexpr std::size_t digestBytes = 64U;
+};
+#endif
+
+template <Curve C>
+struct CurveTraits
+{
+    static constexpr bool enabled = false;
+};
+
+#ifdef CRYPTO_CAM_ECDSA
+template <>
+struct CurveTraits<Curve::P192>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_ECC_P192 == 1);
+    static constexpr crypto_EccCurveType_E curve = CRYPTO_ECC_CURVE_P192;
+    static constexpr std::size_t keyBytes = 24U;
+};
+
+template <>
+struct CurveTraits<Curve::P256>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_ECC_P256 == 1);
+    static constexpr crypto_EccCurveType_E curve = CRYPTO_ECC_CURVE_P256;
+    static constexpr std::size_t keyBytes = 32U;
+};
+
+template <>
+struct CurveTraits<Curve::P384>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_ECC_P384 == 1);
+    static constexpr crypto_EccCurveType_E curve = CRYPTO_ECC_CURVE_P384;
+    static constexpr std::size_t keyBytes = 48U;
+};
+
+template <>
+struct CurveTraits<Curve::P521>
+{
+    static constexpr bool enabled = (CRYPTO_CONFIG_ECC_P521 == 1);
+    static constexpr crypto_EccCurveType_E curve = CRYPTO_ECC_CURVE_P521;
+    static constexpr std::size_t keyBytes = 66U;
+};
+#endif
+
+// Owns a C context: zeroed when constructed, wiped when destroyed or moved from.
+template <typename Ctx>
+class Context
+{
+public:
+    Context() noexcept : ctx_() {}
+
+    ~Context() { wipe(&ctx_, sizeof(ctx_)); }
+
+    Context(const Context &) = delete;
+    Context &operator=(const Context &) = delete;
+
+    Context(Context &&other) noexcept : ctx_(other.ctx_)
+    {
+        wipe(&other.ctx_, sizeof(other.ctx_));
+    }
+
+    Context &operator=(Context &&other) noexcept
+    {
+        if (this != &other)
+        {
+            ctx_ = other.ctx_;
+            wipe(&other.ctx_, sizeof(other.ctx_));
+        }
+        return *this;
+    }
+
+protected:
+    Ctx ctx_;
+};
+
+} // namespace detail
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: AES
+// *****************************************************************************
+// *****************************************************************************
+
+template <Mode M, KeySize K>
+class Aes;
+
+#ifdef CRYPTO_CAM_SYM
+// AES-ECB, AES-CTR and AES-XTS.
+template <Mode M, KeySize K>
+class Aes : private detail::Context<st_Crypto_Sym_BlockCtx>
+{
+    using Traits = detail::ModeTraits<M>;
+
+    static_assert(Traits::enabled, "AES mode not built, see crypto_config.h");
+    static_assert((M != Mode::Xts) || (K != KeySize::k192), "AES-XTS takes 128-bit or 256-bit keys");
+
+public:
+    static constexpr std::size_t keyBytes = static_cast<std::size_t>(K) * Traits::keyFactor;
+    static constexpr std::size_t blockBytes = 16U;
+
+    using Key = std::array<std::uint8_t, keyBytes>;
+    // Initial counter block (CTR) or data unit tweak (XTS).
+    using Iv = std::array<std::uint8_t, blockBytes>;
+
+    Aes() noexcept = default;
+
+    // ECB and XTS.
+    crypto_Sym_Status_E init(Direction direction, const Key &key) noexcept
+    {
+        static_assert(M != Mode::Ctr, "AES-CTR needs an initial counter block");
+        return Crypto_Sym_Aes_Init(&ctx_, detail::handler, detail::cipherOper(direction), Traits::opMode,
+            const_cast<std::uint8_t *>(key.data()), static_cast<std::uint32_t>(keyBytes), nullptr, detail::sessionId);
+    }
+
+    // CTR.
+    crypto_Sym_Status_E init(Direction direction, const Key &key, const Iv &iv) noexcept
+    {
+        static_assert(M == Mode::Ctr, "Only AES-CTR takes an initial counter block");
+        return Crypto_Sym_Aes_Init(&ctx_, detail::handler, detail::cipherOper(direction), Traits::opMode,
+            const_cast<std::uint8_t *>(key.data()), static_cast<std::uint32_t>(keyBytes),
+            const_cast<std::uint8_t *>(iv.data()), detail::sessionId);
+    }
+
+    // ECB and CTR; out holds at least in.size() bytes and may be in.
+    crypto_Sym_Status_E update(ConstBytes in, Bytes out) noexcept
+    {
+        static_assert(M != Mode::Xts, "AES-XTS takes a tweak per data unit");
+        crypto_Sym_Status_E status = CRYPTO_SYM_ERROR_OUTPUTDATA;
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            status = Crypto_Sym_Aes_Cipher(&ctx_, detail::input(in), static_cast<std::uint32_t>(in.size()), out.data());
+        }
+        return status;
+    }
+
+    // XTS, one data unit.
+    crypto_Sym_Status_E update(ConstBytes in, Bytes out, const Iv &tweak) noexcept
+    {
+        static_assert(M == Mode::Xts, "Only AES-XTS takes a tweak");
+        crypto_Sym_Status_E status = CRYPTO_SYM_ERROR_OUTPUTDATA;
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            status = Crypto_Sym_AesXts_Cipher(&ctx_, detail::input(in), static_cast<std::uint32_t>(in.size()), out.data(),
+                const_cast<std::uint8_t *>(tweak.data()));
+        }
+        return status;
+    }
+
+    // One-shot ECB.
+    static crypto_Sym_Status_E encrypt(const Key &key, ConstBytes in, Bytes out) noexcept
+    {
+        static_assert(M == Mode::Ecb, "Only AES-ECB has no IV");
+        return direct(Direction::Encrypt, key, nullptr, in, out);
+    }
+
+    static crypto_Sym_Status_E decrypt(const Key &key, ConstBytes in, Bytes out) noexcept
+    {
+        static_assert(M == Mode::Ecb, "Only AES-ECB has no IV");
+        return direct(Direction::Decrypt, key, nullptr, in, out);
+    }
+
+    // One-shot CTR and XTS.
+    static crypto_Sym_Status_E encrypt(const Key &key, const Iv &iv, ConstBytes in, Bytes out) noexcept
+    {
+        static_assert(M != Mode::Ecb, "AES-ECB has no IV");
+        return direct(Direction::Encrypt, key, iv.data(), in, out);
+    }
+
+    static crypto_Sym_Status_E decrypt(const Key &key, const Iv &iv, ConstBytes in, Bytes out) noexcept
+    {
+        static_assert(M != Mode::Ecb, "AES-ECB has no IV");
+        return direct(Direction::Decrypt, key, iv.data(), in, out);
+    }
+
+private:
+    static crypto_Sym_Status_E direct(Direction direction, const Key &key, const std::uint8_t *iv,
+        ConstBytes in, Bytes out) noexcept
+    {
+        crypto_Sym_Status_E status = CRYPTO_SYM_ERROR_OUTPUTDATA;
+        std::uint8_t *ptr_key = const_cast<std::uint8_t *>(key.data());
+        std::uint8_t *ptr_iv = const_cast<std::uint8_t *>(iv);
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            if (direction == Direction::Encrypt)
+            {
+                status = Crypto_Sym_Aes_EncryptDirect(detail::handler, Traits::opMode, detail::input(in),
+                    static_cast<std::uint32_t>(in.size()), out.data(), ptr_key, static_cast<std::uint32_t>(keyBytes),
+                    ptr_iv, detail::sessionId);
+            }
+            else
+            {
+                status = Crypto_Sym_Aes_DecryptDirect(detail::handler, Traits::opMode, detail::input(in),
+                    static_cast<std::uint32_t>(in.size()), out.data(), ptr_key, static_cast<std::uint32_t>(keyBytes),
+                    ptr_iv, detail::sessionId);
+            }
+        }
+        return status;
+    }
+};
+#endif
+
+#ifdef CRYPTO_CAM_AEAD
+// AES-GCM.
+template <KeySize K>
+class Aes<Mode::Gcm, K> : private detail::Context<st_Crypto_Aead_AesGcm_ctx>
+{
+public:
+    static constexpr std::size_t keyBytes = static_cast<std::size_t>(K);
+    static constexpr std::size_t tagBytes = 16U;
+
+    using Key = std::array<std::uint8_t, keyBytes>;
+    using Tag = std::array<std::uint8_t, tagBytes>;
+
+    Aes() noexcept = default;
+
+    crypto_Aead_Status_E init(Direction direction, const Key &key, ConstBytes iv) noexcept
+    {
+        return Crypto_Aead_AesGcm_Init(&ctx_, detail::handler, detail::cipherOper(direction),
+            const_cast<std::uint8_t *>(key.data()), static_cast<std::uint32_t>(keyBytes), detail::input(iv),
+            static_cast<std::uint32_t>(iv.size()), detail::sessionId);
+    }
+
+    crypto_Aead_Status_E aad(ConstBytes aad) noexcept
+    {
+        return Crypto_Aead_AesGcm_AddAadData(&ctx_, detail::input(aad), static_cast<std::uint32_t>(aad.size()));
+    }
+
+    // out holds at least in.size() bytes and may be in.
+    crypto_Aead_Status_E update(ConstBytes in, Bytes out) noexcept
+    {
+        crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            status = Crypto_Aead_AesGcm_Cipher(&ctx_, detail::input(in), static_cast<std::uint32_t>(in.size()),
+                in.empty() ? nullptr : out.data());
+        }
+        return status;
+    }
+
+    // Writes the first tag.size() (4 to 16) bytes of the tag.
+    crypto_Aead_Status_E final(Bytes tag) noexcept
+    {
+        return Crypto_Aead_AesGcm_Final(&ctx_, detail::output(tag), static_cast<std::uint8_t>(tag.size()));
+    }
+
+    // Decryption: compares the tag in constant time.
+    crypto_Aead_Status_E verify(ConstBytes tag) noexcept
+    {
+        Tag computed;
+        crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_AUTHTAG;
+
+        if (!CRYPTO_API_CHECK(tag.size() > tagBytes))
+        {
+            status = final(Bytes(computed.data(), tag.size()));
+        }
+        if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+        {
+            std::uint8_t diff = 0U;
+
+            for (std::size_t i = 0U; i < tag.size(); i++)
+            {
+                diff |= static_cast<std::uint8_t>(computed[i] ^ tag.data()[i]);
+            }
+            status = (diff == 0U) ? CRYPTO_AEAD_CIPHER_SUCCESS : CRYPTO_AEAD_ERROR_AUTHFAIL;
+        }
+        detail::wipe(computed.data(), computed.size());
+        return status;
+    }
+
+    // One-shot encryption; tag.size() is the tag length.
+    static crypto_Aead_Status_E seal(const Key &key, ConstBytes iv, ConstBytes aad, ConstBytes in, Bytes out,
+        Bytes tag) noexcept
+    {
+        crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            status = Crypto_Aead_AesGcm_EncryptAuthDirect(detail::handler, detail::input(in),
+                static_cast<std::uint32_t>(in.size()), in.empty() ? nullptr : out.data(),
+                const_cast<std::uint8_t *>(key.data()), static_cast<std::uint32_t>(keyBytes), detail::input(iv),
+                static_cast<std::uint32_t>(iv.size()), detail::input(aad), static_cast<std::uint32_t>(aad.size()),
+                detail::output(tag), static_cast<std::uint8_t>(tag.size()), detail::sessionId);
+        }
+        return status;
+    }
+
+    // One-shot decryption and tag check.
+    static crypto_Aead_Status_E open(const Key &key, ConstBytes iv, ConstBytes aad, ConstBytes in, Bytes out,
+        ConstBytes tag) noexcept
+    {
+        crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+
+        if (!CRYPTO_API_CHECK(out.size() < in.size()))
+        {
+            status = Crypto_Aead_AesGcm_DecryptAuthDirect(detail::handler, detail::input(in),
+                static_cast<std::uint32_t>(in.size()), in.empty() ? nullptr : out.data(),
+                const_cast<std::uint8_t *>(key.data()), static_cast<std::uint32_t>(keyBytes), detail::input(iv),
+                static_cast<std::uint32_t>(iv.size()), detail::input(aad), static_cast<std::uint32_t>(aad.size()),
+                detail::input(tag), static_cast<std::uint8_t>(tag.size()), detail::sessionId);
+        }
+        return status;
+    }
+};
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: SHA
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_CAM_HASH
+template <Algo A>
+class Sha : private detail::Context<st_Crypto_Hash_Sha_Ctx>
+{
+    using Traits = detail::AlgoTraits<A>;
+
+    static_assert(Traits::enabled, "Hash algorithm not built, see crypto_config.h");
+
+public:
+    static constexpr std::size_t digestBytes = Traits::digestBytes;
+
+    using Digest = std::array<std::uint8_t, digestBytes>;
+
+    Sha() noexcept = default;
+
+    crypto_Hash_Status_E init() noexcept
+    {
+        return Crypto_Hash_Sha_Init(&ctx_, Traits::algo, detail::handler, detail::sessionId);
+    }
+
+    crypto_Hash_Status_E update(ConstBytes data) noexcept
+    {
+        return Crypto_Hash_Sha_Update(&ctx_, detail::input(data), static_cast<std::uint32_t>(data.size()));
+    }
+
+    crypto_Hash_Status_E final(Digest &digest) noexcept
+    {
+        return Crypto_Hash_Sha_Final(&ctx_, digest.data());
+    }
+
+    // One-shot digest.
+    static crypto_Hash_Status_E digest(ConstBytes data, Digest &digest) noexcept
+    {
+        return Crypto_Hash_Sha_Digest(detail::handler, detail::input(data), static_cast<std::uint32_t>(data.size()),
+            digest.data(), Traits::algo, detail::sessionId);
+    }
+};
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: ECDSA
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_CAM_ECDSA
+template <Curve C>
+class Ecdsa
+{
+    using Traits = detail::CurveTraits<C>;
+
+    static_assert(Traits::enabled, "Curve not built, see crypto_config.h");
+
+public:
+    static constexpr std::size_t keyBytes = Traits::keyBytes;
+
+    using PrivateKey = std::array<std::uint8_t, keyBytes>;
+    // Uncompressed point 0x04 || X || Y; verify() also takes a compressed one.
+    using PublicKey = std::array<std::uint8_t, 1U + (2U * keyBytes)>;
+    // r || s.
+    using Signature = std::array<std::uint8_t, 2U * keyBytes>;
+
+    Ecdsa() = delete;
+
+    static crypto_DigiSign_Status_E sign(ConstBytes hash, const PrivateKey &privateKey, Signature &signature) noexcept
+    {
+        return Crypto_DigiSign_Ecdsa_Sign(detail::handler, detail::input(hash), static_cast<std::uint32_t>(hash.size()),
+            signature.data(), static_cast<std::uint32_t>(signature.size()), const_cast<std::uint8_t *>(privateKey.data()),
+            static_cast<std::uint32_t>(keyBytes), Traits::curve, detail::sessionId);
+    }
+
+    // CRYPTO_DIGISIGN_SUCCESS only for a valid signature.
+    static crypto_DigiSign_Status_E verify(ConstBytes hash, const Signature &signature, ConstBytes publicKey) noexcept
+    {
+        std::int8_t valid = 0;
+        crypto_DigiSign_Status_E status = Crypto_DigiSign_Ecdsa_Verify(detail::handler, detail::input(hash),
+            static_cast<std::uint32_t>(hash.size()), const_cast<std::uint8_t *>(signature.data()),
+            static_cast<std::uint32_t>(signature.size()), detail::input(publicKey),
+            static_cast<std::uint32_t>(publicKey.size()), &valid, Traits::curve, detail::sessionId);
+
+        if ((status == CRYPTO_DIGISIGN_SUCCESS) && (valid != 1))
+        {
+            status = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+        return status;
+    }
+};
+#endif
+
+} // namespace cam
+
+#endif /* CRYPTO_CAM_HPP */
@@ -0,0 +1,221 @@
+/*******************************************************************************
+  Crypto Statistics Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_stats.h
+
+  Summary:
+    This header file provides the optional usage counters of the CAM engines.
+
+  Description:
+    When CRYPTO_STATS_ENABLE is defined for the project, every Crypto_*_Hw_*
+    wrapper counts its call, the bytes it was given, its returned status and
+    the time it held its engine, per algorithm and per engine (AES, HASH, TRNG
+    and PKE). The CAM interrupt handlers count their interrupts. The counters
+    are updated inside a short interrupt-disabled section, so the wrappers may
+    be called from several tasks or interrupts, and Crypto_Stats_Get() returns
+    a consistent snapshot and can reset the counters in the same step.
+
+    Engine busy time is the time during which at least one wrapper call was
+    in progress on the engine; the queue depth is the number of such calls
+    in progress at once. Without CRYPTO_STATS_ENABLE the hooks compile to
+    nothing and Crypto_Stats_Get() returns CRYPTO_STATS_ERROR_NOTSUPPTD.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_STATS_H
+#define CRYPTO_STATS_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum {
+    CRYPTO_STATS_ERROR_NOTSUPPTD = -127,
+    CRYPTO_STATS_ERROR_ARG = -126,
+    CRYPTO_STATS_SUCCESS = 0
+}crypto_Stats_Status_E;
+
+typedef enum {
+    CRYPTO_STATS_ENGINE_AES = 0,        // AES engine, CRYPTO1 interrupt
+    CRYPTO_STATS_ENGINE_HASH,           // SHA engine, CRYPTO1 interrupt
+    CRYPTO_STATS_ENGINE_TRNG,           // TRNG, CRYPTO2 interrupt
+    CRYPTO_STATS_ENGINE_PKE,            // Public key engine, CRYPTO3 interrupt
+    CRYPTO_STATS_ENGINE_MAX
+}crypto_Stats_Engine_E;
+
+typedef enum {
+    CRYPTO_STATS_ALGO_SYM_AES = 0,
+    CRYPTO_STATS_ALGO_AEAD_AESGCM,
+    CRYPTO_STATS_ALGO_MAC_AESCMAC,
+    CRYPTO_STATS_ALGO_HASH_SHA,
+    CRYPTO_STATS_ALGO_RNG_TRNG,
+    CRYPTO_STATS_ALGO_DIGISIGN_ECDSA_SIGN,
+    CRYPTO_STATS_ALGO_DIGISIGN_ECDSA_VERIFY,
+    CRYPTO_STATS_ALGO_KAS_ECDH,
+    CRYPTO_STATS_ALGO_MAX
+}crypto_Stats_Algo_E;
+
+/* Every crypto_*_Status_E error code lies in this range; errorCodes[i]
+ * counts the code (CRYPTO_STATS_ERROR_CODE_FIRST + i). */
+#define CRYPTO_STATS_ERROR_CODE_FIRST   (-127)
+#define CRYPTO_STATS_ERROR_CODE_LAST    (-111)
+#define CRYPTO_STATS_ERROR_CODE_COUNT   (CRYPTO_STATS_ERROR_CODE_LAST - CRYPTO_STATS_ERROR_CODE_FIRST + 1)
+
+// Interrupt vectors counted in st_Crypto_Stats.interrupts (CRYPTO1..CRYPTO3).
+#define CRYPTO_STATS_VECTOR_COUNT       (3U)
+
+typedef struct{
+    uint32_t operations;        // Wrapper calls; each step of a multi-step operation counts
+    uint32_t errors;            // Calls that returned a negative status
+    uint32_t errorCodes[CRYPTO_STATS_ERROR_CODE_COUNT];
+    uint64_t bytes;             // Input bytes passed to the wrappers
+    uint64_t busyTicks;         // Time spent in the wrappers, in timestamp ticks
+    uint16_t queueDepth;        // Calls in progress when the snapshot was taken
+    uint16_t peakQueueDepth;    // Most calls in progress at once
+}st_Crypto_Stats_Counters;
+
+typedef struct{
+    uint64_t elapsedTicks;      // Time covered by the counters (since the last reset)
+    uint32_t tickRate;          // Timestamp ticks per second
+    st_Crypto_Stats_Counters algo[CRYPTO_STATS_ALGO_MAX];
+    st_Crypto_Stats_Counters engine[CRYPTO_STATS_ENGINE_MAX];
+    uint32_t interrupts[CRYPTO_STATS_VECTOR_COUNT];
+}st_Crypto_Stats;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Statistics Hooks
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_STATS_ENABLE
+
+// Marks the start of a wrapper call; declares the start timestamp.
+#define CRYPTO_STATS_BEGIN(algo) \
+    uint32_t cryptoStatsStart = Crypto_Stats_Begin(CRYPTO_STATS_ALGO_##algo)
+
+/* Wraps the returned status: counts the finished call and yields the status
+ * unchanged. Must follow CRYPTO_STATS_BEGIN() in the same function. */
+#define CRYPTO_STATS_END(algo, type, length, status) \
+    ((type)Crypto_Stats_End(CRYPTO_STATS_ALGO_##algo, cryptoStatsStart, (uint32_t)(length), (int32_t)(status)))
+
+#define CRYPTO_STATS_INTERRUPT(vector) Crypto_Stats_Interrupt(vector)
+
+#else
+
+#define CRYPTO_STATS_BEGIN(algo)
+#define CRYPTO_STATS_END(algo, type, length, status) (status)
+#define CRYPTO_STATS_INTERRUPT(vector)
+
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Copy all counters, optionally resetting them in the same step.
+ * @param ptr_stats_st Destination of the snapshot.
+ * @param reset TRUE to clear the counters and restart elapsedTicks.
+ * @return CRYPTO_STATS_SUCCESS, CRYPTO_STATS_ERROR_ARG if ptr_stats_st is
+ *         NULL, or CRYPTO_STATS_ERROR_NOTSUPPTD without CRYPTO_STATS_ENABLE.
+ */
+crypto_Stats_Status_E Crypto_Stats_Get(st_Crypto_Stats *ptr_stats_st, bool reset);
+
+/**
+ * @brief Clear all counters and restart elapsedTicks.
+ */
+void Crypto_Stats_Reset(void);
+
+#ifdef CRYPTO_STATS_ENABLE
+
+/**
+ * @brief Timestamp source for the busy time. Provided by the application.
+ * @return A free-running tick count.
+ */
+uint32_t CRYPTO_STATS_PORT_Timestamp(void);
+
+/**
+ * @brief Tick rate of CRYPTO_STATS_PORT_Timestamp(). Provided by the application.
+ * @return Ticks per second.
+ */
+uint32_t CRYPTO_STATS_PORT_TickRate(void);
+
+/**
+ * @brief Count the start of a wrapper call. Use CRYPTO_STATS_BEGIN().
+ * @param algo The algorithm of the call; selects the engine.
+ * @return The start timestamp, to pass to Crypto_Stats_End().
+ */
+uint32_t Crypto_Stats_Begin(crypto_Stats_Algo_E algo);
+
+/**
+ * @brief Count the end of a wrapper call. Use CRYPTO_STATS_END().
+ * @param algo The algorithm passed to Crypto_Stats_Begin().
+ * @param start The timestamp returned by Crypto_Stats_Begin().
+ * @param length Input bytes of the call.
+ * @param status The status being returned.
+ * @return status, unchanged.
+ */
+int32_t Crypto_Stats_End(crypto_Stats_Algo_E algo, uint32_t start, uint32_t length, int32_t status);
+
+/**
+ * @brief Count one interrupt. Use CRYPTO_STATS_INTERRUPT().
+ * @param vector 0 for CRYPTO1, 1 for CRYPTO2, 2 for CRYPTO3.
+ */
+void Crypto_Stats_Interrupt(uint32_t vector);
+
+#endif /* CRYPTO_STATS_ENABLE */
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_STATS_H */
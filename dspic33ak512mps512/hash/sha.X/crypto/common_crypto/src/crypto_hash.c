@@ -53,6 +53,14 @@
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_hash.h"
 #include "crypto/drivers/wrapper/crypto_hash_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_selftest.h"
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+#include "crypto/drivers/sw/crypto_hash_sw_wrapper.h"
+#include "crypto/common_crypto/crypto_osal.h"
+#endif
+
+#if (CRYPTO_CONFIG_HASH_SHA == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -64,39 +72,86 @@
 
 // *****************************************************************************
 // *****************************************************************************
-// Section: Function Definitions
+// Section: File Scope Functions
 // *****************************************************************************
 // *****************************************************************************
 
-//SHA-1, SHA-2 and SHA-3 except SHAKE Algorithm
-crypto_Hash_Status_E Crypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen,
-                                                uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en,  uint32_t shaSessionId)
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+/**
+ * @brief Resolve CRYPTO_HANDLER_AUTO to the handler that runs an operation.
+ * @param shaHandler_en The handler asked for; other handlers are returned as they are.
+ * @param dataLen Length of the message, or UINT32_MAX when it is not known yet.
+ * @return CRYPTO_HANDLER_SW_INTERNAL when the message is below
+ *         CRYPTO_CONFIG_AUTO_SHA_CROSSOVER or the engine is busy,
+ *         CRYPTO_HANDLER_HW_INTERNAL otherwise.
+ */
+static crypto_HandlerType_E lCrypto_Hash_Sha_AutoHandler(crypto_HandlerType_E shaHandler_en, uint32_t dataLen)
+{
+    crypto_HandlerType_E handler = shaHandler_en;
+
+    if (shaHandler_en == CRYPTO_HANDLER_AUTO)
+    {
+        handler = CRYPTO_HANDLER_HW_INTERNAL;
+
+        if (CRYPTO_AUTO_SHA_BELOW_CROSSOVER(dataLen) || Crypto_Osal_EngineBusy(CRYPTO_OSAL_ENGINE_SYM))
+        {
+            handler = CRYPTO_HANDLER_SW_INTERNAL;
+        }
+    }
+
+    return handler;
+}
+
+#define CRYPTO_HASH_SHA_HANDLER(handler, len)  lCrypto_Hash_Sha_AutoHandler((handler), (len))
+#else
+#define CRYPTO_HASH_SHA_HANDLER(handler, len)  (handler)
+#endif
+
+static crypto_Hash_Status_E lCrypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen,
+                                                uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en,  uint32_t shaSessionId,
+                                                void *ptr_workspace)
 {
  	crypto_Hash_Status_E ret_shaStat_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
 
-    if( (ptr_data == NULL) && (dataLen != 0u) )
+    if(CRYPTO_API_CHECK( (ptr_data == NULL) && (dataLen != 0u) ))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_INPUTDATA;
     }
-    else if(ptr_digest == NULL)
+    else if(CRYPTO_API_CHECK(ptr_digest == NULL))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_OUTPUTDATA;
     }
-    else if( (shaAlgorithm_en <= CRYPTO_HASH_INVALID) || (shaAlgorithm_en >= CRYPTO_HASH_MAX))
+    else if(CRYPTO_API_CHECK( (shaAlgorithm_en <= CRYPTO_HASH_INVALID) || (shaAlgorithm_en >= CRYPTO_HASH_MAX)))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_ALGO;
     }
-    else if( (shaSessionId == 0u) || (shaSessionId > (uint32_t)CRYPTO_HASH_SESSION_MAX) )
+    else if(CRYPTO_API_CHECK( (shaSessionId == 0u) || (shaSessionId > (uint32_t)CRYPTO_HASH_SESSION_MAX) ))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_SID;
     }
+    else if(!CRYPTO_SELFTEST_REQUIRE(HASH_SHA))
+    {
+        ret_shaStat_en = CRYPTO_HASH_ERROR_FAIL;
+    }
     else
     {
-        switch(shaHandler_en)
+        switch(CRYPTO_HANDLER_SELECT(CRYPTO_HASH_SHA_HANDLER(shaHandler_en, dataLen)))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
-                ret_shaStat_en = Crypto_Hash_Hw_Sha_Digest((void*)ptr_data, dataLen, ptr_digest, shaAlgorithm_en);
+                if (ptr_workspace == NULL)
+                {
+                    ret_shaStat_en = Crypto_Hash_Hw_Sha_Digest((void*)ptr_data, dataLen, ptr_digest, shaAlgorithm_en);
+                }
+                else
+                {
+                    ret_shaStat_en = Crypto_Hash_Hw_Sha_DigestEx((void*)ptr_data, dataLen, ptr_digest, shaAlgorithm_en, ptr_workspace);
+                }
+                break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_shaStat_en = Crypto_Hash_Sw_Sha_Digest(ptr_data, dataLen, ptr_digest, shaAlgorithm_en, ptr_workspace);
                 break;
+#endif
             default:
                 ret_shaStat_en = CRYPTO_HASH_ERROR_HDLR;
                 break;
@@ -105,92 +160,179 @@ crypto_Hash_Status_E Crypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en,
     return ret_shaStat_en;
 }
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+uint32_t Crypto_Hash_Sha_WorkspaceSize(crypto_HandlerType_E shaHandler_en)
+{
+    uint32_t size = 0UL;
+
+    if (shaHandler_en == CRYPTO_HANDLER_HW_INTERNAL)
+    {
+        size = (uint32_t)sizeof(CRYPTO_HASH_HW_DIGEST_CONTEXT);
+    }
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+    else if (shaHandler_en == CRYPTO_HANDLER_SW_INTERNAL)
+    {
+        size = (uint32_t)sizeof(CRYPTO_HASH_SW_CONTEXT);
+    }
+    else if (shaHandler_en == CRYPTO_HANDLER_AUTO)
+    {
+        // Either handler may run the operation.
+        size = (uint32_t)((sizeof(CRYPTO_HASH_HW_DIGEST_CONTEXT) > sizeof(CRYPTO_HASH_SW_CONTEXT)) ?
+            sizeof(CRYPTO_HASH_HW_DIGEST_CONTEXT) : sizeof(CRYPTO_HASH_SW_CONTEXT));
+    }
+#endif
+
+    return size;
+}
+
+//SHA-1, SHA-2 and SHA-3 except SHAKE Algorithm
+crypto_Hash_Status_E Crypto_Hash_Sha_Digest(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen,
+                                                uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en,  uint32_t shaSessionId)
+{
+    CRYPTO_TRACE_ENTER(HASH_SHA_DIGEST, dataLen);
+
+    return CRYPTO_TRACE_EXIT(HASH_SHA_DIGEST, crypto_Hash_Status_E,
+        lCrypto_Hash_Sha_Digest(shaHandler_en, ptr_data, dataLen, ptr_digest, shaAlgorithm_en, shaSessionId, NULL));
+}
+
+crypto_Hash_Status_E Crypto_Hash_Sha_DigestEx(crypto_HandlerType_E shaHandler_en, uint8_t *ptr_data, uint32_t dataLen,
+                                                uint8_t *ptr_digest, crypto_Hash_Algo_E shaAlgorithm_en,  uint32_t shaSessionId,
+                                                void *ptr_workspace, uint32_t workspaceLen)
+{
+    crypto_Hash_Status_E ret_shaStat_en;
+
+    CRYPTO_TRACE_ENTER(HASH_SHA_DIGESTEX, dataLen);
+
+    if (CRYPTO_API_CHECK(!CRYPTO_WORKSPACE_VALID(ptr_workspace, workspaceLen, Crypto_Hash_Sha_WorkspaceSize(shaHandler_en))))
+    {
+        ret_shaStat_en = CRYPTO_HASH_ERROR_CTX;
+    }
+    else
+    {
+        ret_shaStat_en = lCrypto_Hash_Sha_Digest(shaHandler_en, ptr_data, dataLen, ptr_digest, shaAlgorithm_en, shaSessionId, ptr_workspace);
+    }
+
+    return CRYPTO_TRACE_EXIT(HASH_SHA_DIGESTEX, crypto_Hash_Status_E, ret_shaStat_en);
+}
+
 crypto_Hash_Status_E Crypto_Hash_Sha_Init(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, crypto_Hash_Algo_E shaAlgorithm_en, crypto_HandlerType_E shaHandler_en, uint32_t shaSessionId)
 {
  	crypto_Hash_Status_E ret_shaStat_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
 
-    if(ptr_shaCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(HASH_SHA_INIT, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_shaCtx_st == NULL))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_CTX;
     }
-    else if( (shaAlgorithm_en <= CRYPTO_HASH_INVALID) || (shaAlgorithm_en >= CRYPTO_HASH_MAX))
+    else if(CRYPTO_API_CHECK( (shaAlgorithm_en <= CRYPTO_HASH_INVALID) || (shaAlgorithm_en >= CRYPTO_HASH_MAX)))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_ALGO;
     }
-    else if( (shaSessionId == 0u) || (shaSessionId > (uint32_t)CRYPTO_HASH_SESSION_MAX) )
+    else if(CRYPTO_API_CHECK( (shaSessionId == 0u) || (shaSessionId > (uint32_t)CRYPTO_HASH_SESSION_MAX) ))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_SID;
     }
+    else if(!CRYPTO_SELFTEST_REQUIRE(HASH_SHA))
+    {
+        ret_shaStat_en = CRYPTO_HASH_ERROR_FAIL;
+    }
     else
     {
         ptr_shaCtx_st->shaSessionId = shaSessionId;
         ptr_shaCtx_st->shaAlgo_en = shaAlgorithm_en;
-        ptr_shaCtx_st->shaHandler_en = shaHandler_en;
+        // CRYPTO_HANDLER_AUTO is settled here for the whole stream; its length is not known yet.
+        ptr_shaCtx_st->shaHandler_en = CRYPTO_HASH_SHA_HANDLER(shaHandler_en, UINT32_MAX);
 
-        switch(ptr_shaCtx_st->shaHandler_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_shaCtx_st->shaHandler_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_shaStat_en = Crypto_Hash_Hw_Sha_Init((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_shaCtx_st->shaAlgo_en);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_shaStat_en = Crypto_Hash_Sw_Sha_Init((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_shaCtx_st->shaAlgo_en);
+                break;
+#endif
             default:
                 ret_shaStat_en = CRYPTO_HASH_ERROR_HDLR;
                 break;
         }
     }
-    return ret_shaStat_en;
+    return CRYPTO_TRACE_EXIT(HASH_SHA_INIT, crypto_Hash_Status_E, ret_shaStat_en);
 }
 
 crypto_Hash_Status_E Crypto_Hash_Sha_Update(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_data, uint32_t dataLen)
 {
 	crypto_Hash_Status_E ret_shaStat_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
 
-    if(ptr_shaCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(HASH_SHA_UPDATE, dataLen);
+
+    if(CRYPTO_API_CHECK(ptr_shaCtx_st == NULL))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_CTX;
     }
-    else if( (ptr_data == NULL) && (dataLen != 0u) )
+    else if(CRYPTO_API_CHECK( (ptr_data == NULL) && (dataLen != 0u) ))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_INPUTDATA;
     }
     else
     {
-        switch(ptr_shaCtx_st->shaHandler_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_shaCtx_st->shaHandler_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_shaStat_en = Crypto_Hash_Hw_Sha_Update((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_data, dataLen);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_shaStat_en = Crypto_Hash_Sw_Sha_Update((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_data, dataLen);
+                break;
+#endif
             default:
                 ret_shaStat_en = CRYPTO_HASH_ERROR_HDLR;
                 break;
         }
     }
-    return ret_shaStat_en;
+    return CRYPTO_TRACE_EXIT(HASH_SHA_UPDATE, crypto_Hash_Status_E, ret_shaStat_en);
 }
 
 crypto_Hash_Status_E Crypto_Hash_Sha_Final(st_Crypto_Hash_Sha_Ctx *ptr_shaCtx_st, uint8_t *ptr_digest)
 {
 	crypto_Hash_Status_E ret_shaStat_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
 
-    if(ptr_shaCtx_st == NULL)
+    CRYPTO_TRACE_ENTER(HASH_SHA_FINAL, 0UL);
+
+    if(CRYPTO_API_CHECK(ptr_shaCtx_st == NULL))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_CTX;
     }
-    else if(ptr_digest == NULL)
+    else if(CRYPTO_API_CHECK(ptr_digest == NULL))
     {
         ret_shaStat_en = CRYPTO_HASH_ERROR_OUTPUTDATA;
     }
     else
     {
-        switch(ptr_shaCtx_st->shaHandler_en)
+        switch(CRYPTO_HANDLER_SELECT(ptr_shaCtx_st->shaHandler_en))
         {
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_shaStat_en = Crypto_Hash_Hw_Sha_Final((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_digest);
                 break;
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_SW_INTERNAL:
+                ret_shaStat_en = Crypto_Hash_Sw_Sha_Final((void*)ptr_shaCtx_st->arr_shaDataCtx, ptr_digest);
+                break;
+#endif
             default:
                 ret_shaStat_en = CRYPTO_HASH_ERROR_HDLR;
                 break;
         }
     }
-    return ret_shaStat_en;
+    return CRYPTO_TRACE_EXIT(HASH_SHA_FINAL, crypto_Hash_Status_E, ret_shaStat_en);
 }
 
+#endif /* CRYPTO_CONFIG_HASH_SHA == 1 */
@@ -0,0 +1,117 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_hash_sw_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for software SHA.
+
+  Description:
+    This header file contains the software implementation of SHA-1 and
+    SHA-2 used by the software handler (CRYPTO_HANDLER_SW_INTERNAL). It runs
+    on the CPU and does not need the SHA engine.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2025, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_HASH_SW_WRAPPER_H
+#define CRYPTO_HASH_SW_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+// Largest block of the SHA algorithms, the 128 bytes of SHA-384 and SHA-512.
+#define CRYPTO_HASH_SW_MAX_BLOCK_SIZE   (128UL)
+
+typedef struct
+{
+  crypto_Hash_Algo_E algorithm;
+
+  // Chaining state; SHA-1, SHA-224 and SHA-256 use the low 32 bits of each word.
+  uint64_t state[8];
+
+  // Partial block waiting for more data.
+  uint8_t block[CRYPTO_HASH_SW_MAX_BLOCK_SIZE];
+  uint32_t blockLen;
+
+  // Bytes hashed so far.
+  uint64_t totalLen;
+
+} CRYPTO_HASH_SW_CONTEXT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Hash Algorithms Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+// With a NULL workspace the context is kept on the stack.
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Digest(uint8_t *data, uint32_t dataLen,
+    uint8_t *digest, crypto_Hash_Algo_E shaAlgorithm_en, void *workspace);
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Init(void *shaInitCtx,
+    crypto_Hash_Algo_E shaAlgorithm_en);
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Update(void *shaUpdateCtx,
+    uint8_t *data, uint32_t dataLen);
+
+crypto_Hash_Status_E Crypto_Hash_Sw_Sha_Final(void *shaFinalCtx,
+    uint8_t *digest);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_HASH_SW_WRAPPER_H */
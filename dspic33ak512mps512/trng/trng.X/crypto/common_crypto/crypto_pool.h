@@ -0,0 +1,212 @@
+/*******************************************************************************
+  Crypto Context Pool Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_pool.h
+
+  Summary:
+    This header file provides the fixed-block pools of the Crypto Library
+    context types.
+
+  Description:
+    Each context type has its own pool of CRYPTO_POOL_<TYPE>_COUNT blocks,
+    sized with sizeof() of the type at build time and placed in static
+    memory. Crypto_Pool_Acquire() and Crypto_Pool_Release() take constant
+    time: each pool keeps a stack of its free blocks and hands out blocks
+    that were never used before from a watermark, so no start-up call is
+    needed. Every acquired block is zeroed; a released block is wiped at
+    release, or with CRYPTO_POOL_LAZY_ZEROIZE only marked for wiping, which
+    happens at its next acquisition or in Crypto_Pool_Scrub().
+
+    A pool with a count of 0 (the default) takes no memory. When the pool of
+    a CAM wrapper context type (CRYPTO_POOL_AES_HW, CRYPTO_POOL_AEAD_HW,
+    CRYPTO_POOL_CMAC_HW, CRYPTO_POOL_HASH_HW_DIGEST) has blocks, the matching
+    one-shot wrappers take their context from it instead of their stack and
+    fail with the module's generic error when it is empty. Set the counts
+    only for the modules present in the project: the header of each type is
+    included only when its pool has blocks. The ECDSA and ECDH wrappers
+    share the PKE workspace of crypto_pke_cam05346_wrapper.c instead.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2025 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef CRYPTO_POOL_H
+#define CRYPTO_POOL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Configuration Options
+// *****************************************************************************
+// *****************************************************************************
+
+/* Define CRYPTO_POOL_LAZY_ZEROIZE to leave released blocks dirty until they
+ * are acquired again or Crypto_Pool_Scrub() runs, which moves the wipe out
+ * of Crypto_Pool_Release(). */
+
+// Blocks of st_Crypto_Sym_BlockCtx (crypto_sym_cipher.h).
+#ifndef CRYPTO_POOL_SYM_BLOCK_COUNT
+#define CRYPTO_POOL_SYM_BLOCK_COUNT         (0U)
+#endif
+
+// Blocks of st_Crypto_Aead_AesGcm_ctx (crypto_aead_cipher.h).
+#ifndef CRYPTO_POOL_AEAD_AESGCM_COUNT
+#define CRYPTO_POOL_AEAD_AESGCM_COUNT       (0U)
+#endif
+
+// Blocks of st_Crypto_Mac_Aes_ctx (crypto_mac_cipher.h).
+#ifndef CRYPTO_POOL_MAC_AESCMAC_COUNT
+#define CRYPTO_POOL_MAC_AESCMAC_COUNT       (0U)
+#endif
+
+// Blocks of st_Crypto_Hash_Sha_Ctx (crypto_hash.h).
+#ifndef CRYPTO_POOL_HASH_SHA_COUNT
+#define CRYPTO_POOL_HASH_SHA_COUNT          (0U)
+#endif
+
+// Blocks of CRYPTO_AES_HW_CONTEXT, used by Crypto_Sym_Hw_Aes_*Direct().
+#ifndef CRYPTO_POOL_AES_HW_COUNT
+#define CRYPTO_POOL_AES_HW_COUNT            (0U)
+#endif
+
+// Blocks of CRYPTO_AEAD_HW_CONTEXT, used by Crypto_Aead_Hw_AesGcm_*Direct().
+#ifndef CRYPTO_POOL_AEAD_HW_COUNT
+#define CRYPTO_POOL_AEAD_HW_COUNT           (0U)
+#endif
+
+// Blocks of CRYPTO_CMAC_HW_CONTEXT, used by Crypto_Sym_Hw_Cmac_Direct().
+#ifndef CRYPTO_POOL_CMAC_HW_COUNT
+#define CRYPTO_POOL_CMAC_HW_COUNT           (0U)
+#endif
+
+// Blocks of CRYPTO_HASH_HW_DIGEST_CONTEXT, used by Crypto_Hash_Hw_Sha_Digest().
+#ifndef CRYPTO_POOL_HASH_HW_DIGEST_COUNT
+#define CRYPTO_POOL_HASH_HW_DIGEST_COUNT    (0U)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum {
+    CRYPTO_POOL_ERROR_NOTSUPPTD = -127,     // The pool of the type has no blocks
+    CRYPTO_POOL_ERROR_ARG = -126,           // Bad type or NULL pointer
+    CRYPTO_POOL_ERROR_NOTOWNED = -125,      // The pointer is not a block of the pool
+    CRYPTO_POOL_ERROR_NOTINUSE = -124,      // The block is already free
+    CRYPTO_POOL_SUCCESS = 0
+}crypto_Pool_Status_E;
+
+typedef enum {
+    CRYPTO_POOL_SYM_BLOCK = 0,
+    CRYPTO_POOL_AEAD_AESGCM,
+    CRYPTO_POOL_MAC_AESCMAC,
+    CRYPTO_POOL_HASH_SHA,
+    CRYPTO_POOL_AES_HW,
+    CRYPTO_POOL_AEAD_HW,
+    CRYPTO_POOL_CMAC_HW,
+    CRYPTO_POOL_HASH_HW_DIGEST,
+    CRYPTO_POOL_TYPE_MAX
+}crypto_Pool_Type_E;
+
+typedef struct{
+    uint32_t blockSize;         // Bytes per block, sizeof() of the type rounded up to 4
+    uint16_t blockCount;        // Blocks in the pool
+    uint16_t inUse;             // Blocks acquired and not yet released
+    uint16_t highWater;         // Most blocks in use at once
+    uint16_t dirty;             // Free blocks still waiting to be wiped
+    uint32_t acquisitions;      // Successful Crypto_Pool_Acquire() calls
+    uint32_t failures;          // Crypto_Pool_Acquire() calls that found the pool empty
+}st_Crypto_Pool_Stats;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/**
+ * @brief Take a block from the pool of a context type. Interrupt safe.
+ * @param type The context type.
+ * @return A zeroed block aligned to 4 bytes, or NULL if the pool is empty or
+ *         has no blocks.
+ */
+void *Crypto_Pool_Acquire(crypto_Pool_Type_E type);
+
+/**
+ * @brief Return a block to the pool it was taken from. Interrupt safe.
+ * @param type The context type passed to Crypto_Pool_Acquire().
+ * @param ptr_block The block returned by Crypto_Pool_Acquire().
+ * @return CRYPTO_POOL_SUCCESS; CRYPTO_POOL_ERROR_NOTSUPPTD for a type without
+ *         blocks; CRYPTO_POOL_ERROR_NOTOWNED or
+ *         CRYPTO_POOL_ERROR_NOTINUSE for a pointer that is not an acquired
+ *         block of the pool, which is left unchanged.
+ */
+crypto_Pool_Status_E Crypto_Pool_Release(crypto_Pool_Type_E type, void *ptr_block);
+
+/**
+ * @brief Wipe the free blocks left dirty by Crypto_Pool_Release() with
+ *        CRYPTO_POOL_LAZY_ZEROIZE, for example from the idle loop. Interrupts
+ *        are disabled for one block at a time.
+ * @return The number of blocks wiped.
+ */
+uint32_t Crypto_Pool_Scrub(void);
+
+/**
+ * @brief Copy the counters of one pool, optionally resetting the high-water
+ *        mark to the blocks now in use and clearing the call counters.
+ * @param type The context type.
+ * @param ptr_stats_st Destination of the counters.
+ * @param reset TRUE to reset the counters in the same step.
+ * @return CRYPTO_POOL_SUCCESS, or CRYPTO_POOL_ERROR_ARG.
+ */
+crypto_Pool_Status_E Crypto_Pool_Stats_Get(crypto_Pool_Type_E type, st_Crypto_Pool_Stats *ptr_stats_st, bool reset);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+    }
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_POOL_H */
@@ -53,6 +53,9 @@
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_rng.h"
 #include "crypto/drivers/wrapper/crypto_rng_cam05346_wrapper.h"
+#include "crypto/common_crypto/crypto_trace.h"
+
+#if (CRYPTO_CONFIG_RNG_TRNG == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -73,15 +76,20 @@ crypto_Rng_Status_E Crypto_Rng_Generate(crypto_HandlerType_E rngHandlerType_en,
     uint32_t sessionID)
 {
     crypto_Rng_Status_E ret_rngStat_en = CRYPTO_RNG_ERROR_NOTSUPPTED;
+
+    CRYPTO_TRACE_ENTER(RNG_GENERATE, rngLen);
     
-    if((ptr_rngData == NULL) || (rngLen == 0u))
+    if(CRYPTO_API_CHECK((ptr_rngData == NULL) || (rngLen == 0u)))
     {
         ret_rngStat_en = CRYPTO_RNG_ERROR_ARG;
     }
     else
     {
-        switch(rngHandlerType_en)
+        switch(CRYPTO_HANDLER_SELECT(rngHandlerType_en))
         {
+#if (CRYPTO_CONFIG_SW_HANDLER == 1)
+            case CRYPTO_HANDLER_AUTO:   // No software handler; always the CAM.
+#endif
             case CRYPTO_HANDLER_HW_INTERNAL:
                 ret_rngStat_en = Crypto_Rng_Hw_Trng_Generate(ptr_rngData, rngLen);
 				break;
@@ -91,5 +99,7 @@ crypto_Rng_Status_E Crypto_Rng_Generate(crypto_HandlerType_E rngHandlerType_en,
         }
     }
 
-    return ret_rngStat_en;
+    return CRYPTO_TRACE_EXIT(RNG_GENERATE, crypto_Rng_Status_E, ret_rngStat_en);
 }
+
+#endif /* CRYPTO_CONFIG_RNG_TRNG == 1 */
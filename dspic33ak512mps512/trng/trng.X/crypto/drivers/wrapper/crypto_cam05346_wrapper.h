@@ -49,6 +49,8 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
+#include <stdint.h>
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -79,16 +81,32 @@ typedef enum crypto_Int_Handler_Id {
 
 typedef void (*crypto_Int_Handler)(void);
 
+/* Completion hook of an interrupt vector, called with the context given at
+ * registration. */
+typedef void (*crypto_Int_Completion)(void *context);
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Interrupts Common Interface
 // *****************************************************************************
 // *****************************************************************************
 
+/* Register the driver handler of handlerID; NULL removes it. Returns
+ * CRYPTO_INT_ALREADY_REGISTERED if a different handler is set. */
 crypto_Int_Status_E Crypto_Int_Hw_Register_Handler(crypto_Int_Handler_Id handlerID, crypto_Int_Handler handler);
+/* Register a function called from the interrupt of handlerID after its driver
+ * handler, for code that resumes work when the engine signals; NULL removes
+ * it. One hook per vector; CRYPTO_INT_ALREADY_REGISTERED if one is set. */
+crypto_Int_Status_E Crypto_Int_Hw_Register_Completion(crypto_Int_Handler_Id handlerID,
+    crypto_Int_Completion completion, void *context);
 crypto_Int_Status_E Crypto_Int_Hw_Enable(crypto_Int_Handler_Id handlerID);
 crypto_Int_Status_E Crypto_Int_Hw_Disable(crypto_Int_Handler_Id handlerID);
 
+/* Disable interrupts for a short critical section. Returns the previous
+ * interrupt state, to be passed to Crypto_Int_Hw_Unlock(). */
+uint32_t Crypto_Int_Hw_Lock(void);
+void Crypto_Int_Hw_Unlock(uint32_t lockState);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -51,6 +51,11 @@ Microchip or any third party.
 #include "crypto/drivers/wrapper/crypto_rng_cam05346_wrapper.h"
 #include "crypto/drivers/wrapper/crypto_cam05346_wrapper.h"
 #include "crypto/drivers/library/cam_trng.h"
+#include "crypto/common_crypto/crypto_trace.h"
+#include "crypto/common_crypto/crypto_stats.h"
+#include "crypto/common_crypto/crypto_osal.h"
+
+#if (CRYPTO_CONFIG_RNG_TRNG == 1)
 
 // *****************************************************************************
 // *****************************************************************************
@@ -58,10 +63,39 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
-static void lDRV_CRYPTO_TRNG_InterruptSetup(void)
+static crypto_Int_Status_E lDRV_CRYPTO_TRNG_InterruptSetup(void)
 {
-    (void)Crypto_Int_Hw_Register_Handler(CRYPTO2_INT, DRV_CRYPTO_TRNG_IsrHelper);
-    (void)Crypto_Int_Hw_Enable(CRYPTO2_INT);
+    crypto_Int_Status_E status = Crypto_Int_Hw_Register_Handler(CRYPTO2_INT, DRV_CRYPTO_TRNG_IsrHelper);
+
+    if (status == CRYPTO_INT_SUCCESS)
+    {
+        status = Crypto_Int_Hw_Enable(CRYPTO2_INT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Take the engine for the calling task and install its interrupt handler.
+ * @return true when the engine is held, to be released with Crypto_Osal_EngineRelease().
+ */
+static bool lDRV_CRYPTO_TRNG_EngineAcquire(void)
+{
+    bool owner = false;
+
+    if (Crypto_Osal_EngineAcquire(CRYPTO_OSAL_ENGINE_TRNG) == CRYPTO_OSAL_SUCCESS)
+    {
+        if (lDRV_CRYPTO_TRNG_InterruptSetup() == CRYPTO_INT_SUCCESS)
+        {
+            owner = true;
+        }
+        else
+        {
+            (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_TRNG);
+        }
+    }
+
+    return owner;
 }
 
 // *****************************************************************************
@@ -72,10 +106,21 @@ static void lDRV_CRYPTO_TRNG_InterruptSetup(void)
 
 crypto_Rng_Status_E Crypto_Rng_Hw_Trng_Generate(uint8_t *rngData, uint32_t rngLen)
 {
+    crypto_Rng_Status_E status = CRYPTO_RNG_ERROR_FAIL;
+
+    CRYPTO_TRACE_ENTER(RNG_HW_TRNG_GENERATE, rngLen);
+    CRYPTO_STATS_BEGIN(RNG_TRNG);
 
-    (void) DRV_CRYPTO_TRNG_Setup();
-    lDRV_CRYPTO_TRNG_InterruptSetup();
-    (void) DRV_CRYPTO_TRNG_ReadData(rngData, rngLen);
+    if (lDRV_CRYPTO_TRNG_EngineAcquire())
+    {
+        (void) DRV_CRYPTO_TRNG_Setup();
+        (void) DRV_CRYPTO_TRNG_ReadData(rngData, rngLen);
 
-    return CRYPTO_RNG_SUCCESS;
+        (void)Crypto_Osal_EngineRelease(CRYPTO_OSAL_ENGINE_TRNG);
+        status = CRYPTO_RNG_SUCCESS;
+    }
+
+    return CRYPTO_TRACE_EXIT(RNG_HW_TRNG_GENERATE, crypto_Rng_Status_E, CRYPTO_STATS_END(RNG_TRNG, crypto_Rng_Status_E, rngLen, status));
 }
+
+#endif /* CRYPTO_CONFIG_RNG_TRNG == 1 */